@@ -0,0 +1,25 @@
+#ifndef BOOT_REPORT_H
+#define BOOT_REPORT_H
+
+#include <stdint.h>
+
+// Boot-phase timing recorded by the setup() orchestration in main.cpp.
+// The table is filled during boot and frozen once logBootTiming() runs;
+// the web server reads it afterwards, so no locking is needed here.
+// The previous boot's breakdown survives a reboot in RTC noinit memory
+// (same mechanism as the crash log buffer) so a regression is attributable
+// even when the slow boot is the one that just happened.
+
+uint8_t boot_report_phase_count();
+const char* boot_report_phase_name(uint8_t index);
+uint32_t boot_report_phase_ms(uint8_t index);
+uint32_t boot_report_total_ms();
+
+// Previous boot (false on cold power-on or RTC memory corruption)
+bool boot_report_prev_valid();
+uint8_t boot_report_prev_phase_count();
+const char* boot_report_prev_phase_name(uint8_t index);
+uint32_t boot_report_prev_phase_ms(uint8_t index);
+uint32_t boot_report_prev_total_ms();
+
+#endif // BOOT_REPORT_H
@@ -6,10 +6,12 @@
  * 
  * Features:
  * - Configurable target weight
- * - Pre-infusion offset (stop early to account for drip)
+ * - Adaptive drip prediction (learns drip mass from recent shots and the
+ *   stop latency of the valve path, extrapolates flow to pick the stop point)
+ * - Fixed stop offset as fallback until enough shots are learned
  * - Dose weight for ratio calculation
  * - Auto-stop toggle
- * - Settings persisted in NVS
+ * - Settings and learned values persisted in NVS
  */
 
 #ifndef BREW_BY_WEIGHT_H
@@ -37,6 +39,13 @@
 #define BBW_MIN_STOP_OFFSET           0.0f    // grams
 #define BBW_MAX_STOP_OFFSET           10.0f   // grams
 
+// Drip predictor
+#define BBW_DRIP_HISTORY_LEN          5       // Shots to average drip mass over
+#define BBW_MIN_LEARNED_SHOTS         2       // Use fixed stop_offset until this many learned
+#define BBW_SETTLE_TIME_MS            4000    // Post-shot window to let drip land on the scale
+#define BBW_MAX_DRIP_MASS             8.0f    // Discard samples beyond this (cup bumped, refill..)
+#define BBW_DEFAULT_STOP_LATENCY_MS   300.0f  // Valve path latency until measured
+
 // NVS keys
 #define NVS_BBW_NAMESPACE             "bbw"
 #define NVS_BBW_TARGET                "target"
@@ -44,6 +53,10 @@
 #define NVS_BBW_OFFSET                "offset"
 #define NVS_BBW_AUTO_STOP             "auto_stop"
 #define NVS_BBW_AUTO_TARE             "auto_tare"
+#define NVS_BBW_DRIP_HIST             "drip_hist"
+#define NVS_BBW_DRIP_CNT              "drip_cnt"
+#define NVS_BBW_DRIP_IDX              "drip_idx"
+#define NVS_BBW_LATENCY               "latency"
 
 // =============================================================================
 // Settings Structure
@@ -88,9 +101,12 @@ public:
      * Process - call in main loop
      * @param is_brewing Current brewing state from Pico
      * @param scale_weight Current weight from scale (grams)
+     * @param flow_rate Estimated flow rate from scale (g/s)
      * @param scale_connected Whether scale is connected
+     * @param sample_ms millis() timestamp of the scale sample (0 = unknown)
      */
-    void update(bool is_brewing, float scale_weight, bool scale_connected);
+    void update(bool is_brewing, float scale_weight, float flow_rate, bool scale_connected,
+                uint32_t sample_ms = 0);
     
     // =========================================================================
     // Settings
@@ -120,9 +136,17 @@ public:
     
     bbw_state_t getState() const { return _state; }
     bool isActive() const { return _state.active; }
+    bool isSettling() const { return _settling; }
     bool isTargetReached() const { return _state.target_reached; }
     float getProgress() const;  // 0.0 - 1.0
     float getCurrentRatio() const;  // output / dose
+    float getPredictedDrip() const;  // Learned drip mass (falls back to stop_offset)
+    float getStopLatencyMs() const { return _stopLatencyMs; }
+
+    // Latency budget of the last weight-stopped shot (see ShotRecord)
+    uint32_t getStopSignalTime() const { return _stopSignalTime; }
+    uint16_t getLastStopSampleAgeMs() const { return _stopSampleAgeMs; }
+    uint16_t getLastStopChainMs() const { return _stopChainMs; }
     
     // =========================================================================
     // Actions
@@ -157,17 +181,33 @@ private:
     
     bool _wasBrewing;
     uint32_t _lastProgressCallback;
-    
+
+    // Drip predictor - learned from observed shots, persisted in NVS
+    float _dripHistory[BBW_DRIP_HISTORY_LEN];  // Ring of measured drip masses
+    uint8_t _dripCount;
+    uint8_t _dripIndex;
+    float _stopLatencyMs;      // EMA of stop-signal -> brew-end latency
+    float _currentFlow;        // Latest flow estimate from the scale (g/s)
+    float _weightAtStop;       // Effective weight when stop was signaled
+    uint32_t _stopSignalTime;
+    uint32_t _lastSampleMs;    // RX timestamp of the latest scale sample
+    uint16_t _stopSampleAgeMs; // Sample age when stop was decided
+    uint16_t _stopChainMs;     // Stop decision -> observed brew end
+    bool _settling;            // Post-shot: waiting for drip to land
+    uint32_t _settleDeadline;
+
     // Callbacks
     stop_callback_t _onStop;
     tare_callback_t _onTare;
     progress_callback_t _onProgress;
-    
+
     void loadSettings();
     void saveSettings();
+    void saveLearned();
     void startSession(float initial_weight);
     void endSession();
     void checkTarget();
+    void recordShotOutcome(float settled_weight);
 };
 
 // Global instance
@@ -0,0 +1,121 @@
+#ifndef BROADCAST_SCHEDULER_H
+#define BROADCAST_SCHEDULER_H
+
+#include "utils/status_change_detector.h"
+#include <stdint.h>
+
+/**
+ * Broadcast Scheduler
+ *
+ * Decides which status sinks (local WebSocket clients, cloud, MQTT) are due
+ * for an update on each broadcast tick. Replaces the ad-hoc statics that used
+ * to live in broadcastFullStatus() and loopUpdateMQTTStatus() - per-sink
+ * change detectors, heartbeat timers and full-sync timers all live here, so
+ * one evaluate() call answers "who gets what" for the whole tick and a single
+ * serialized payload can be fanned out to every due sink.
+ *
+ * Per sink it tracks:
+ *  - A StatusChangeDetector, reset on (re)connect so the first frame after a
+ *    connection is a full keyframe.
+ *  - A minimum send interval (rate limit). Changes that land while a sink is
+ *    rate-limited are coalesced into a pending mask and flushed in one delta
+ *    when the sink is due again - nothing is lost, nothing is sent twice.
+ *  - A keepalive interval: when idle past it, the sink gets a lightweight
+ *    keepalive instead of a status rebuild.
+ *  - A full-sync interval: periodic full keyframe so late joiners and drifted
+ *    consumers converge.
+ */
+class BroadcastScheduler {
+public:
+    enum Sink : uint8_t {
+        SINK_LOCAL = 0,   // Local WebSocket clients
+        SINK_CLOUD,       // Cloud relay connection
+        SINK_MQTT,        // MQTT broker (own payload shape, shared schedule)
+        SINK_COUNT
+    };
+
+    /**
+     * What to send this tick. Sinks with send[] clear need nothing.
+     * changed[] holds the coalesced pending changes for each due sink;
+     * callers sharing one payload across sinks should merge() the masks of
+     * the due sinks (a superset delta is still a valid delta).
+     */
+    struct Decision {
+        bool send[SINK_COUNT] = {};       // Sink should receive a frame
+        bool full[SINK_COUNT] = {};       // ...and it must be a full keyframe
+        bool keepalive[SINK_COUNT] = {};  // ...or just a lightweight keepalive
+        bool fullSync[SINK_COUNT] = {};   // Full keyframe due to periodic sync
+        ChangedFields changed[SINK_COUNT];
+        bool firstLocal = false;          // Local client connected recently
+
+        bool anySend() const {
+            for (uint8_t i = 0; i < SINK_COUNT; i++) {
+                if (send[i]) return true;
+            }
+            return false;
+        }
+    };
+
+    BroadcastScheduler();
+
+    /**
+     * Evaluate all sinks for the current tick.
+     * @param state Current machine state (fed to the change detectors)
+     * @param connected Per-sink connectivity, indexed by Sink
+     * @param now millis()
+     */
+    Decision evaluate(const ui_state_t& state, const bool connected[SINK_COUNT],
+                      unsigned long now);
+
+    /**
+     * Commit a decision after the sends actually happened. Clears pending
+     * masks and restarts the per-sink timers. Callers may clear send[] flags
+     * for sinks that failed (e.g. serialization error) so their pending
+     * changes survive to the next tick.
+     */
+    void markSent(const Decision& decision, unsigned long now);
+
+    /**
+     * Override a sink's rate limit (0 = every tick). Used by the degraded
+     * broadcast policy to stretch local delta intervals under client load;
+     * pending changes keep coalescing while the sink waits.
+     */
+    void setMinInterval(Sink sink, unsigned long minInterval);
+
+    /**
+     * Override a sink's keepalive interval. The cloud sink's heartbeat
+     * cadence follows measured link quality (CloudConnection probes the
+     * relay): good links stretch to long idle heartbeats, flaky ones
+     * tighten so a dead link is noticed quickly.
+     */
+    void setKeepaliveInterval(Sink sink, unsigned long keepaliveInterval);
+
+    /**
+     * Make the sink's next frame a full keyframe. For clients joining a sink
+     * that is already connected (a second browser tab, an SSE client
+     * attaching while WebSocket clients hold SINK_LOCAL up) - the reconnect
+     * detection in evaluate() never fires for them, and without this they
+     * would sit on deltas against state they never saw until the periodic
+     * full sync comes around.
+     */
+    void forceKeyframe(Sink sink);
+
+private:
+    struct SinkState {
+        StatusChangeDetector detector;
+        ChangedFields pending;            // Coalesced while rate-limited
+        unsigned long minInterval = 0;    // Rate limit (0 = every tick)
+        unsigned long keepaliveInterval = 0;  // 0 = no keepalives
+        unsigned long fullSyncInterval = 0;   // 0 = no periodic keyframes
+        unsigned long connectGrace = 0;   // Force keyframes this long after connect
+        unsigned long lastSend = 0;
+        unsigned long lastFullSync = 0;
+        unsigned long connectTime = 0;
+        bool wasConnected = false;
+        bool needsFull = false;           // First frame after (re)connect
+    };
+
+    SinkState _sinks[SINK_COUNT];
+};
+
+#endif // BROADCAST_SCHEDULER_H
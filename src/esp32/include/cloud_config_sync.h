@@ -0,0 +1,56 @@
+#ifndef CLOUD_CONFIG_SYNC_H
+#define CLOUD_CONFIG_SYNC_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+class CloudConnection;
+
+/**
+ * BrewOS Differential Config Sync
+ *
+ * Settings used to reach the cloud as a full device_info re-upload on every
+ * change. This module syncs them differentially instead: each settings
+ * section (the same granularity StateManager persists with) gets a content
+ * hash over its serialized JSON, and only sections whose hash moved since
+ * the relay last saw them are uploaded.
+ *
+ * Protocol (device side - the relay just stores sections keyed by hash):
+ *  - On connect the device sends a bulk-verify frame listing every section
+ *    hash ("config_hashes"). The relay compares against its stored copies
+ *    and answers with a "config_pull" command naming the stale sections.
+ *  - On settings changes (watched via settingsGeneration(), debounced so a
+ *    settings burst uploads once), changed sections go up in one
+ *    "config_sync" frame together with their new hashes.
+ *
+ * Hashes are FNV-1a over the section's serialized JSON, computed straight
+ * from the serializer stream - no staging buffer. Secrets never hash or
+ * upload because the section toJson() methods already redact them.
+ *
+ * Steady state per machine is a ~100-byte hash frame per connect and
+ * silence until something changes, which is what makes continuous
+ * fleet-wide drift audits affordable.
+ */
+class CloudConfigSync {
+public:
+    // Called once from setup() with the cloud connection (may be idle)
+    static void begin(CloudConnection* cloud);
+
+    // Called from the main loop. Self-throttled; edge-detects cloud
+    // connects (bulk verify) and settings generation changes (delta upload).
+    static void loop();
+
+    // "config_pull" command handler: the relay names sections it wants
+    // re-uploaded (null/empty array = everything). The upload happens on
+    // the next loop() pass on the main loop task.
+    static void requestSections(JsonArrayConst sections);
+
+    struct Stats {
+        uint32_t uploads;           // config_sync frames sent
+        uint32_t sectionsSent;
+        uint32_t sectionsSkipped;   // Unchanged sections not re-uploaded
+    };
+    static Stats getStats();
+};
+
+#endif // CLOUD_CONFIG_SYNC_H
@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <WebSocketsClient.h>
 #include <ArduinoJson.h>
+#include "msgpack_helper.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/queue.h>
@@ -34,6 +35,18 @@ public:
     // Regenerate key callback - called when authentication fails to recover
     typedef bool (*RegenerateKeyCallback)();
     
+    /**
+     * Outbound priority classes. Events (shot/brew lifecycle) drain before
+     * status traffic; forwarded logs ride their own small queue with a
+     * per-pass quota and get dropped-and-counted when it overflows, so a log
+     * storm can never delay a shot-complete event.
+     */
+    enum SendPriority : uint8_t {
+        PRIORITY_EVENT = 0,   // Shot/brew lifecycle - never waits behind logs
+        PRIORITY_STATUS,      // Status deltas, settings, device info
+        PRIORITY_LOG          // Forwarded logs - first to drop under pressure
+    };
+
     CloudConnection();
     
     /**
@@ -56,9 +69,12 @@ public:
     
     /**
      * Send JSON message to cloud (broadcast to all connected cloud users)
+     * Priority selects the outbound class (see SendPriority).
+     * The String overload is deleted - pass c_str() explicitly so the
+     * allocation a caller makes on the send path is visible at the call site.
      */
-    void send(const String& json);
-    void send(const char* json);  // Overload to avoid String allocation
+    void send(const String& json, SendPriority priority = PRIORITY_STATUS) = delete;
+    void send(const char* json, SendPriority priority = PRIORITY_STATUS);
     
     /**
      * Send typed message to cloud
@@ -69,6 +85,12 @@ public:
      * Send binary MessagePack data to cloud
      */
     void sendBinary(const uint8_t* data, size_t len);
+
+    /**
+     * Send a MessagePack chunk chain - gathered once straight into the
+     * exact-size queue block, skipping the contiguous staging copy
+     */
+    void sendBinary(MsgPackChain& chain);
     
     /**
      * Set callback for receiving commands from cloud users
@@ -91,6 +113,31 @@ public:
      * Check if connected to cloud
      */
     bool isConnected() const;
+
+    /**
+     * True when the relay acknowledged a compact status schema version we
+     * speak (see cloud_schema.h). Status then goes out as positional
+     * field-id arrays instead of string-keyed maps. Reset on disconnect -
+     * every connection renegotiates.
+     */
+    bool compactStatusEnabled() const;
+
+    /**
+     * Recommended status heartbeat interval for the broadcast scheduler,
+     * derived from measured link quality: the cloud task probes the relay
+     * with WebSocket pings and folds pong RTT into an EWMA. Good links
+     * (low RTT, no recent missed pongs) stretch to 120s keepalives; flaky
+     * ones tighten to 15s so a dead link is noticed quickly.
+     */
+    unsigned long statusHeartbeatMs() const;
+
+    /**
+     * Backpressure signal: true when the send queue is backing up (TLS stall,
+     * radio dropout). The broadcast scheduler stretches the cloud delta
+     * interval while this holds so a stalled link doesn't queue unbounded
+     * PSRAM buffers; pending changes coalesce and flush once it drains.
+     */
+    bool isBacklogged() const;
     
     /**
      * Get connection status string
@@ -143,6 +190,15 @@ private:
     unsigned long _connectedAt = 0;        // Track when connection established for grace period
     unsigned long _lastDisconnectTime = 0; // Track disconnect time to detect auth failures
     int _authFailureCount = 0;             // Track consecutive auth failures
+    uint8_t _peerSchema = 0;               // Compact schema version the relay ack'd (0 = legacy maps)
+
+    // Link quality probing (see servicePing): task-driven pings replace the
+    // library's opaque heartbeat so pong RTT and losses are measurable
+    unsigned long _pingSentAt = 0;         // When the outstanding probe went out
+    bool _pingOutstanding = false;         // Probe sent, pong not yet seen
+    uint8_t _missedPongs = 0;              // Consecutive unanswered probes
+    unsigned long _lastPongMissAt = 0;     // Keeps the heartbeat tightened for a while
+    unsigned long _linkRttEwmaMs = 0;      // Smoothed probe RTT (0 = no sample yet)
     
     CommandCallback _onCommand = nullptr;
     RegisterCallback _onRegister = nullptr;
@@ -162,12 +218,27 @@ private:
     
     // Thread safety - WebSocketsClient is NOT thread-safe
     SemaphoreHandle_t _mutex = nullptr;
-    QueueHandle_t _sendQueue = nullptr;  // Queue of messages to send
+    QueueHandle_t _sendQueue = nullptr;   // Status-class messages (PRIORITY_STATUS)
+    QueueHandle_t _eventQueue = nullptr;  // Shot/brew events - drained first
+    QueueHandle_t _logQueue = nullptr;    // Forwarded logs - quota'd, dropped when full
     static const int SEND_QUEUE_SIZE = 20;  // Increased to handle rapid state updates
+    static const int EVENT_QUEUE_SIZE = 8;
+    static const int LOG_QUEUE_SIZE = 8;
     static const int MAX_MSG_SIZE = 2048;   // Reduced message size
+    uint32_t _droppedLogs = 0;  // Over-quota log traffic (drop-and-count)
+
+    // Send-side coalescing: text messages queued within one drain pass get
+    // packed into a single {"type":"batch"} frame, so the per-frame radio+TLS
+    // overhead is paid once instead of per message. Buffer lives in PSRAM.
+    static const int COALESCE_BUF_SIZE = 3072;
+    char* _coalesceBuf = nullptr;
     
     // Process queued messages (called from task)
     void processSendQueue();
+
+    // Send a link probe ping when one is due; counts misses and disconnects
+    // a dead link (called from task, under the mutex)
+    void servicePing(unsigned long now);
     
     // Parse URL into host, port, path
     bool parseUrl(const String& url, String& host, uint16_t& port, String& path, bool& useSSL);
@@ -177,6 +248,10 @@ private:
     
     // Process incoming message
     void handleMessage(uint8_t* payload, size_t length);
+
+    // Event-journal catch-up sync: stream events newer than the sequence the
+    // cloud reported having (see "sync" in handleMessage)
+    void streamEventsSince(uint32_t haveSeq);
     
     // Attempt to connect
     void connect();
@@ -0,0 +1,92 @@
+#ifndef CLOUD_SCHEMA_H
+#define CLOUD_SCHEMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ui/ui.h"
+#include "utils/status_change_detector.h"
+#include "msgpack_helper.h"
+
+/**
+ * Negotiated compact status schema for the cloud relay link.
+ *
+ * The legacy cloud status frame is the same string-keyed MessagePack map the
+ * local dashboard gets - every delta re-sends its key strings over TLS and
+ * the relay walks a map to fan it out. When device and relay agree on a
+ * schema version at connect time (device appends &schema=N to the WebSocket
+ * path, relay echoes the version it speaks in its "connected" ack), status
+ * flows as a positional MessagePack array instead:
+ *
+ *   [ seq, presence_mask, value, value, ... ]
+ *
+ * presence_mask is a uint32 bitmask over the field ids below; values follow
+ * in ascending field-id order, one per set bit. A full keyframe is simply a
+ * frame with every bit set, and a keepalive is mask 0 (two elements). The
+ * relay tells compact frames from legacy ones by the first MessagePack byte:
+ * arrays (0x9x/0xDC) vs maps (0x8x/0xDE).
+ *
+ * The field-id table is append-only: new fields take the next free bit, ids
+ * are never reused or renumbered, and a bumped CLOUD_SCHEMA_VERSION gates any
+ * change in a value's meaning or type. A relay that doesn't speak the
+ * device's version simply omits "schema" from its ack and the device keeps
+ * sending legacy map frames.
+ */
+
+#define CLOUD_SCHEMA_VERSION 1
+
+// Worst case v1 frame: array header + seq + mask + 24 values at 5 bytes each
+#define CLOUD_SCHEMA_MAX_FRAME 160
+
+// Schema v1 field ids (bit positions in presence_mask). Append-only.
+typedef enum {
+    CLOUD_FIELD_MACHINE_STATE    = 0,   // uint
+    CLOUD_FIELD_IS_HEATING       = 1,   // bool
+    CLOUD_FIELD_IS_BREWING       = 2,   // bool
+    CLOUD_FIELD_HEATING_STRATEGY = 3,   // uint
+    CLOUD_FIELD_BREW_TEMP        = 4,   // float
+    CLOUD_FIELD_BREW_SETPOINT    = 5,   // float
+    CLOUD_FIELD_STEAM_TEMP       = 6,   // float
+    CLOUD_FIELD_STEAM_SETPOINT   = 7,   // float
+    CLOUD_FIELD_GROUP_TEMP       = 8,   // float
+    CLOUD_FIELD_PRESSURE         = 9,   // float
+    CLOUD_FIELD_POWER_WATTS      = 10,  // uint
+    CLOUD_FIELD_SCALE_CONNECTED  = 11,  // bool
+    CLOUD_FIELD_BREW_WEIGHT      = 12,  // float
+    CLOUD_FIELD_FLOW_RATE        = 13,  // float
+    CLOUD_FIELD_TARGET_WEIGHT    = 14,  // float
+    CLOUD_FIELD_PICO_CONNECTED   = 15,  // bool
+    CLOUD_FIELD_WIFI_CONNECTED   = 16,  // bool
+    CLOUD_FIELD_MQTT_CONNECTED   = 17,  // bool
+    CLOUD_FIELD_CLOUD_CONNECTED  = 18,  // bool
+    CLOUD_FIELD_WATER_LOW        = 19,  // bool
+    CLOUD_FIELD_BREW_COUNT       = 20,  // uint
+    CLOUD_FIELD_CLEANING_DUE     = 21,  // bool
+    CLOUD_FIELD_BREW_TIME_MS     = 22,  // uint
+    CLOUD_FIELD_WIFI_RSSI        = 23,  // int
+    CLOUD_FIELD_COUNT
+} cloud_field_id_t;
+
+/**
+ * Encode a compact status frame.
+ *
+ * With full=false, the presence mask is derived from the changed bits (a
+ * ChangedFields group sets every field id it covers, e.g. temps sets 4-8).
+ * With full=true every field is included - use for keyframes/full syncs.
+ * A changed set with nothing relevant yields a mask-0 keepalive frame.
+ *
+ * @return Bytes written, or 0 if the buffer was too small
+ */
+size_t cloudSchemaEncodeStatus(const ui_state_t& state, const ChangedFields& changed,
+                               bool full, uint32_t seq,
+                               uint8_t* buffer, size_t bufferSize);
+
+/**
+ * Same frame, encoded into a chunk chain - the sender gathers it straight
+ * into the exact-size queue block, so the device never has to size a
+ * worst-case frame buffer (CLOUD_SCHEMA_MAX_FRAME stays as relay-side
+ * documentation only)
+ */
+size_t cloudSchemaEncodeStatus(const ui_state_t& state, const ChangedFields& changed,
+                               bool full, uint32_t seq, MsgPackChain& chain);
+
+#endif // CLOUD_SCHEMA_H
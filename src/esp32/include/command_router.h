@@ -0,0 +1,82 @@
+#ifndef COMMAND_ROUTER_H
+#define COMMAND_ROUTER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+// Command sources (producers)
+#define CMD_SOURCE_MQTT   0
+#define CMD_SOURCE_CLOUD  1
+#define CMD_SOURCE_WEB    2
+
+#define CMD_ROUTER_QUEUE_SIZE   8
+#define CMD_ROUTER_PAYLOAD_MAX  512   // Matches the MQTT receive-path cap
+
+/**
+ * Command Router - unified MPSC command path onto Core 1
+ *
+ * MQTT (Core 0 task), cloud (WebSocket task), and local WebSocket
+ * (async_tcp task) commands used to reach the machine through three
+ * different paths - one private FreeRTOS queue drained one-at-a-time, one
+ * direct cross-core callback, one inline dispatch. All three now post into
+ * a single queue that the main loop drains in one batched pass per
+ * scheduling round:
+ *
+ *  - commands execute on Core 1 only, where scaleManager/brewByWeight/
+ *    runtimeState live (the cloud path previously dispatched straight from
+ *    its own task)
+ *  - a burst (e.g. an HA automation fanning out setpoint changes) is
+ *    handled in one pass, and absolute setters superseded by a newer value
+ *    for the same target are skipped instead of replayed in order
+ *
+ * Entries carry the serialized JSON; parsing happens once, on Core 1, at
+ * drain time. post() never blocks - producers fall back to their pre-router
+ * inline path when the queue is full or the payload is oversized.
+ */
+class CommandRouter {
+public:
+    typedef void (*CommandSink)(uint8_t source, const char* type, JsonDocument& doc);
+
+    /**
+     * Create the queue and register the sink. Call once during setup,
+     * before any producer can post.
+     */
+    static bool begin(CommandSink sink);
+
+    /**
+     * Post a command from any task (MPSC-safe, non-blocking).
+     * @param source CMD_SOURCE_xxx
+     * @param type   Command name / message type (copied, max 23 chars)
+     * @param doc    Parsed command document (re-serialized into the entry)
+     * @return false if the router is down, the queue is full, or the
+     *         payload doesn't fit - caller should fall back to its inline path
+     */
+    static bool post(uint8_t source, const char* type, JsonDocument& doc);
+
+    /**
+     * Drain all pending commands in one pass (call from the main loop on
+     * Core 1 only).
+     */
+    static void drain();
+
+private:
+    struct Entry {
+        uint8_t source;                        // CMD_SOURCE_xxx
+        uint8_t dedupeKey;                     // 0 = never superseded
+        char type[24];                         // Command name
+        char payload[CMD_ROUTER_PAYLOAD_MAX];  // Serialized JSON
+    };
+
+    static uint8_t dedupeKeyFor(const char* type, JsonDocument& doc);
+
+    static QueueHandle_t _queue;
+    static CommandSink _sink;
+    static Entry _batch[CMD_ROUTER_QUEUE_SIZE];  // Drain scratch (Core 1 only)
+    static uint32_t _posted;
+    static uint32_t _dropped;
+    static uint32_t _superseded;
+};
+
+#endif // COMMAND_ROUTER_H
@@ -61,17 +61,75 @@
 #define WIFI_CONNECT_TIMEOUT_MS 15000
 #define WIFI_RECONNECT_INTERVAL 30000
 
+// Roaming fast-path: RSSI trend sampling triggers a background candidate
+// scan and a proactive reassociation before a degrading AP rides down to
+// the association timeout (which freezes cloud/WS traffic for 10+ seconds)
+#define WIFI_ROAM_SAMPLE_INTERVAL_MS 5000   // RSSI sample period while associated
+#define WIFI_ROAM_TREND_WINDOW       8      // Samples in the trend ring (40s)
+#define WIFI_ROAM_RSSI_FLOOR         -75    // Avg dBm below which scans start
+#define WIFI_ROAM_MIN_IMPROVEMENT_DB 8      // Candidate must beat current AP by this
+#define WIFI_ROAM_SCAN_INTERVAL_MS   30000  // Min gap between background scans
+#define WIFI_ROAM_HOLDOFF_MS         60000  // Min gap between proactive roams
+#define WIFI_FAST_REJOIN_TIMEOUT_MS  4000   // Persisted-BSSID rejoin before scan fallback
+
+// Shot-window PHY tuning: telemetry frames during a shot are small and
+// latency-bound, so the data rate is pinned at a mid OFDM rate while
+// brewing (rate control can't downshift onto long-preamble DSSS after one
+// bad probe) with full TX power as SNR headroom for the fixed rate.
+// Defaults restore after a hold past brew end, same shape as the task
+// governor's hold-down.
+#define WIFI_SHOT_FIX_RATE           WIFI_PHY_RATE_24M
+#define WIFI_SHOT_HOLD_MS            2000
+
+// Link health history: one RSSI + worst-WS-fanout sample per window, kept
+// in a short ring for diagnostics so "firmware slow" and "WiFi bad"
+// separate in field reports
+#define WIFI_LINK_SAMPLE_INTERVAL_MS 10000  // Sample window
+#define WIFI_LINK_HISTORY_LEN        18     // 3 minutes of history
+
 // -----------------------------------------------------------------------------
 // Web Server
 // -----------------------------------------------------------------------------
 #define WEB_SERVER_PORT         80
 #define WEBSOCKET_PATH          "/ws"
 
+// -----------------------------------------------------------------------------
+// Display - LVGL Render/Flush Task
+// -----------------------------------------------------------------------------
+// The LVGL task renders and flushes frames; its placement matters because
+// flushes contend with WiFi/WebSocket work for CPU and PSRAM bandwidth.
+// Overridable via build flags for experiments on specific units.
+#ifndef LVGL_TASK_CORE
+    #define LVGL_TASK_CORE          1       // Same core as Arduino loop
+#endif
+#ifndef LVGL_TASK_PRIORITY
+    #define LVGL_TASK_PRIORITY      2       // Above idle, below critical tasks
+#endif
+#ifndef LVGL_TASK_STACK_SIZE
+    #define LVGL_TASK_STACK_SIZE    4096
+#endif
+#ifndef LVGL_TASK_INTERVAL_MS
+    #define LVGL_TASK_INTERVAL_MS   16      // ~60 FPS
+#endif
+#ifndef LVGL_TASK_IDLE_INTERVAL_MS
+    #define LVGL_TASK_IDLE_INTERVAL_MS 100  // ~10 FPS when the machine is idle
+#endif
+
 // -----------------------------------------------------------------------------
 // UART - Pico Communication (ESP32 side pins)
 // -----------------------------------------------------------------------------
 #define PICO_UART_NUM           1               // UART1
 #define PICO_UART_BAUD          PROTOCOL_BAUD_RATE
+// Driver RX ring buffer - sized so a full burst of 20Hz status frames plus a
+// bulk config payload can land via the UART ISR while loop() is busy elsewhere.
+// Default Arduino buffer is 256 bytes which overflows during heavy WebSocket traffic.
+#define PICO_UART_RX_BUFFER_SIZE 2048
+
+// Telemetry rates requested during the protocol handshake. The Pico streams
+// status slowly while the machine idles (95% of the day) and fast during
+// brewing when the UI and brew-by-weight logic need fresh data.
+#define PICO_STATUS_RATE_IDLE_HZ    2
+#define PICO_STATUS_RATE_ACTIVE_HZ  20
 #if ENABLE_SCREEN
     // Screen variant: GPIO43/44 available on display module
     #define PICO_UART_TX_PIN        43              // ESP32 TX -> Pico RX (GPIO1) → J15 Pin 4
@@ -163,11 +221,26 @@
     #define SWD_RESET_PIN           PICO_RUN_PIN    // Use existing PICO_RUN_PIN for reset
 #endif // ENABLE_SCREEN
 
+// -----------------------------------------------------------------------------
+// Heap Telemetry (opt-in diagnostic build)
+// -----------------------------------------------------------------------------
+// HEAP_TELEMETRY: Route psram_malloc()/internal_malloc()/safe_free() through
+// per-call-site accounting (see heap_telemetry.h) and expose the top sites at
+// /api/memory/sites. Off by default - adds a mutex + table walk per tracked
+// allocation. Enable with build_flags = -DHEAP_TELEMETRY=1
+#ifndef HEAP_TELEMETRY
+#define HEAP_TELEMETRY          0
+#endif
+
 // -----------------------------------------------------------------------------
 // OTA Configuration
 // -----------------------------------------------------------------------------
 #define OTA_FILE_PATH           "/pico_firmware.bin"
 #define OTA_MAX_SIZE            (2 * 1024 * 1024)   // 2MB max
+// Known-good Pico image cache: last image that passed its post-flash boot
+// health check. Used as the rollback target if a new image fails to come up.
+#define PICO_KNOWN_GOOD_PATH    "/pico_known_good.bin"
+#define PICO_HEALTH_DEADLINE_MS 45000               // Post-flash boot handshake deadline
 
 // GitHub OTA - Download firmware from GitHub releases
 #define GITHUB_OWNER            "brewos-io"
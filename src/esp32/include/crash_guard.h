@@ -0,0 +1,93 @@
+#ifndef CRASH_GUARD_H
+#define CRASH_GUARD_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Crash-count thresholds. The "window" is implemented as a stability timer
+// rather than wall-clock arithmetic (the clock is exactly what may not be
+// set while crash-looping): the counter clears only after the system has
+// stayed up for CRASH_GUARD_STABLE_MS, so N crashes with no stable period
+// between them is equivalent to N crashes within the window.
+#define CRASH_GUARD_SHED_THRESHOLD     3        // Shed the implicated subsystem
+#define CRASH_GUARD_MINIMAL_THRESHOLD  5        // Fall back to minimal boot
+#define CRASH_GUARD_STABLE_MS          600000   // 10 min up = loop broken
+
+// Sheddable subsystems. Everything NOT listed here (Pico UART/control,
+// WiFi, local web server, state manager) is the minimal core and is never
+// shed - that is what keeps the machine making coffee and reachable.
+enum CrashSubsystem : uint8_t {
+    CRASH_SUBSYS_NONE = 0,
+    CRASH_SUBSYS_MQTT,
+    CRASH_SUBSYS_CLOUD,
+    CRASH_SUBSYS_SCALE,
+    CRASH_SUBSYS_DISPLAY,
+    CRASH_SUBSYS_NOTIFICATIONS,
+    CRASH_SUBSYS_FLEET,
+    CRASH_SUBSYS_COUNT
+};
+
+/**
+ * Crash Guard - crash-loop detector with progressive feature shedding
+ *
+ * The panic handler records crashes, but a crash-looping subsystem (field
+ * example: MQTT TLS negotiation) used to take the whole machine down over
+ * and over until someone visited the site. CrashGuard breaks the loop:
+ *
+ * - A crash counter in RTC noinit memory survives panics and watchdog
+ *   resets (like the flight recorder). Each crash-type boot increments it;
+ *   CRASH_GUARD_STABLE_MS of uptime clears it.
+ * - Crashes are attributed via two RTC breadcrumbs: the crashing FreeRTOS
+ *   task name (stored by the panic handler) and the last boot-phase /
+ *   loop-task marker (stored continuously via setContext()). A small table
+ *   maps those names to sheddable subsystems.
+ * - At CRASH_GUARD_SHED_THRESHOLD crashes the implicated subsystem is
+ *   disabled for subsequent boots (allows() returns false at its init
+ *   gate). If attribution failed, or crashes continue to
+ *   CRASH_GUARD_MINIMAL_THRESHOLD, the boot goes minimal: Pico control,
+ *   WiFi and the local web server only.
+ * - Shed subsystems stay shed while the loop is broken (that stability is
+ *   the evidence of implication). Recovery is explicit - the diagnostics
+ *   API reset - or implicit via power cycle, which clears RTC memory.
+ *
+ * The degraded state is surfaced in /api/protocol/diagnostics so a shedded
+ * machine is still remotely diagnosable instead of silently partial.
+ */
+class CrashGuard {
+public:
+    /**
+     * Evaluate the crash history and decide this boot's shed set. Call
+     * once, early in setup() - before any gated subsystem initializes.
+     */
+    static void begin();
+
+    /**
+     * Stability bookkeeping: clears the crash counter once the system has
+     * been up CRASH_GUARD_STABLE_MS. Cheap; called from the loop executor.
+     */
+    static void loop();
+
+    /** False if this subsystem is shed this boot - skip its init/bringup. */
+    static bool allows(CrashSubsystem subsystem);
+
+    /**
+     * Record the currently active boot phase or loop task as the crash
+     * attribution breadcrumb. A few byte stores into RTC memory - safe to
+     * call at dispatch frequency.
+     */
+    static void setContext(const char* name);
+
+    /** Record the crashing task's name (panic handler only). */
+    static void recordCrashTask(const char* taskName);
+
+    /** True when anything is shed (for status/UI surfacing). */
+    static bool degraded();
+
+    /** Clear all shedding and counters (diagnostics API recovery path). */
+    static void reset();
+
+    /** Shed state and crash history for /api/protocol/diagnostics. */
+    static void toJson(JsonObject obj);
+};
+
+#endif // CRASH_GUARD_H
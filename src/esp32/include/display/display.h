@@ -12,6 +12,36 @@
 #include "config.h"
 #include "display_config.h"
 
+// =============================================================================
+// Flush Instrumentation
+// =============================================================================
+
+// Slots for the per-screen invalidation counters. Sized generously so this
+// header does not depend on the UI's screen enum (UI reports the active
+// screen id via setActiveScreenId()).
+#define DISPLAY_STATS_MAX_SCREENS 16
+
+/**
+ * Dirty-rectangle and flush timing statistics
+ *
+ * Used to find screens that invalidate too much: a well-behaved screen
+ * redraws a few small label areas per refresh, a badly-behaved one shows
+ * avg refresh pixels near the full frame (480*480). DMA wait time is the
+ * window where LVGL flushes contend with WiFi/PSRAM traffic.
+ */
+typedef struct {
+    uint32_t flushCount;        // Dirty rectangles sent to the panel
+    uint64_t flushPixels;       // Total dirty-rectangle area (px)
+    uint32_t lastFlushPixels;   // Area of the most recent flush
+    uint32_t maxFlushPixels;    // Largest single flush
+    uint64_t flushWaitUs;       // Total time blocked on the previous DMA transfer
+    uint32_t maxFlushWaitUs;    // Worst single DMA wait (contention spike)
+    uint32_t refreshCount;      // LVGL refresh cycles completed
+    uint64_t refreshPixels;     // Total pixels redrawn across refresh cycles
+    uint32_t maxRefreshTimeMs;  // Worst refresh cycle (render + flush)
+    uint32_t screenInvalidations[DISPLAY_STATS_MAX_SCREENS];  // Refresh cycles per active screen
+} display_flush_stats_t;
+
 // =============================================================================
 // Display Driver Class
 // =============================================================================
@@ -76,7 +106,30 @@ public:
      */
     uint16_t width() const { return DISPLAY_WIDTH; }
     uint16_t height() const { return DISPLAY_HEIGHT; }
-    
+
+    /**
+     * Flush instrumentation (dirty-rectangle areas, DMA wait times,
+     * per-screen invalidation counts for the diagnostics JSON)
+     */
+    void getFlushStats(display_flush_stats_t* stats) const;
+    void resetFlushStats();
+
+    /**
+     * Tell the instrumentation which screen is active
+     * Called by the UI on screen switches so refresh cycles can be
+     * attributed to the screen that caused them.
+     */
+    void setActiveScreenId(uint8_t screenId);
+
+    /**
+     * Frame-pacing governor
+     * When idle pacing is on, the LVGL task drops from LVGL_TASK_INTERVAL_MS
+     * to LVGL_TASK_IDLE_INTERVAL_MS between frames; the saved cycles go to
+     * the network stack on the same core. User input (resetIdleTimer) wakes
+     * the task immediately and holds full rate for a grace window.
+     */
+    void setIdlePacing(bool idle);
+
 private:
     // LVGL display driver
     lv_disp_t* _display;
@@ -92,15 +145,13 @@ private:
     uint8_t _backlightSaved;    // Saved level before dim/off
     bool _isDimmed;
     unsigned long _lastActivityTime;
+    volatile bool _pacingIdle;  // Frame-pacing governor (set from UI, read by LVGL task)
     
     // FreeRTOS task for LVGL timer handler
+    // (core, priority, stack and interval come from config.h: LVGL_TASK_*)
     TaskHandle_t _lvglTaskHandle;
     static void lvglTaskCode(void* parameter);
-    static const int LVGL_TASK_STACK_SIZE = 4096;  // 4KB stack
-    static const int LVGL_TASK_PRIORITY = 2;       // Above idle, below critical tasks
-    static const int LVGL_TASK_CORE = 1;           // Run on Core 1 (same as Arduino loop)
-    static const int LVGL_TASK_INTERVAL_MS = 16;   // ~16ms = ~60 FPS (optimal for smooth animations)
-    
+
     // Internal methods
     void initHardware();
     void initLVGL();
@@ -109,6 +160,7 @@ private:
     
     // Static callbacks for LVGL
     static void flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p);
+    static void monitorCallback(lv_disp_drv_t* drv, uint32_t time_ms, uint32_t px);
 };
 
 // Global display instance (only when screen is enabled)
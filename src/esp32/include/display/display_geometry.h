@@ -0,0 +1,55 @@
+/**
+ * BrewOS Display Geometry
+ *
+ * Compile-time layout system for the UI screens. Layouts are authored
+ * against the GEO_REF_* reference resolution (the 2.1" round 480x480 panel
+ * from display_config.h); GEO_X()/GEO_Y() scale every coordinate to the
+ * actual panel size at compile time, so the round vs. rectangular display
+ * variants under evaluation become a display_config.h change instead of a
+ * per-screen rewrite - and there is no runtime layout engine tax, every
+ * coordinate still folds to an integer constant.
+ *
+ * Shared anchors are named below so screens stop re-deriving the same magic
+ * offsets independently (the top/bottom content bands that clear the round
+ * bezel, the edge arc size, the side-by-side info columns).
+ */
+
+#ifndef DISPLAY_GEOMETRY_H
+#define DISPLAY_GEOMETRY_H
+
+#include <lvgl.h>
+#include "display_config.h"
+
+// Reference resolution the screen layouts were authored at. Scaling is
+// integer and truncating; at the reference panel GEO_X/GEO_Y are identity.
+constexpr int GEO_REF_WIDTH  = 480;
+constexpr int GEO_REF_HEIGHT = 480;
+
+constexpr lv_coord_t GEO_X(int ref_px) {
+    return (lv_coord_t)(ref_px * DISPLAY_WIDTH / GEO_REF_WIDTH);
+}
+
+constexpr lv_coord_t GEO_Y(int ref_px) {
+    return (lv_coord_t)(ref_px * DISPLAY_HEIGHT / GEO_REF_HEIGHT);
+}
+
+// =============================================================================
+// Shared anchors
+// =============================================================================
+
+// Full-bleed progress arc hugging the bezel (home/brewing rings) and the
+// stroke width both scale with the panel
+constexpr lv_coord_t GEO_EDGE_ARC_SIZE  = GEO_X(460);
+constexpr lv_coord_t GEO_EDGE_ARC_WIDTH = GEO_X(10);
+
+// Top/bottom content bands: far enough inside the round bezel that full-width
+// rows are not clipped by the curvature
+constexpr lv_coord_t GEO_TOP_BAND_Y    = GEO_Y(60);
+constexpr lv_coord_t GEO_BOTTOM_BAND_Y = GEO_Y(-60);
+
+// Side-by-side info columns below center (steam/pressure on home, the same
+// split wherever two values share a row)
+constexpr lv_coord_t GEO_COL_LEFT_X  = GEO_X(-80);
+constexpr lv_coord_t GEO_COL_RIGHT_X = GEO_X(80);
+
+#endif // DISPLAY_GEOMETRY_H
@@ -1,8 +1,13 @@
 /**
  * BrewOS Rotary Encoder Driver
- * 
+ *
  * Uses ESP32_Knob and ESP32_Button libraries for reliable input handling.
  * Timer-based polling with proper debouncing.
+ *
+ * Knob events are timestamped when they arrive (in the knob library's
+ * timer context) and queued; update() drains the whole queue each pass
+ * and applies adaptive acceleration from inter-event timing, so slow
+ * turns give fine steps and fast spins move in coarse jumps.
  */
 
 #ifndef ENCODER_H
@@ -118,6 +123,21 @@ private:
     volatile int32_t _position;
     int32_t _lastReportedPosition;    // For custom callback
     int32_t _lastLvglPosition;        // For LVGL input device (separate tracking)
+
+    // Timestamped knob event queue (single producer: knob timer context,
+    // single consumer: update() in the main loop)
+    struct KnobEvent {
+        int8_t dir;           // +1 or -1
+        uint32_t timestampUs; // micros() at event time
+    };
+    static const int KNOB_QUEUE_SIZE = 16;  // Power of two
+    KnobEvent _knobQueue[KNOB_QUEUE_SIZE];
+    volatile uint8_t _knobHead;       // Written by producer only
+    volatile uint8_t _knobTail;       // Written by consumer only
+    uint32_t _lastEventUs;            // For inter-event timing (consumer side)
+    int8_t _lastEventDir;             // Direction change resets acceleration
+
+    void pushKnobEvent(int8_t dir);
     
     // Button state
     bool _buttonPressed;
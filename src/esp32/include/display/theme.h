@@ -123,6 +123,26 @@ void theme_init(void);
  */
 void theme_apply_card_style(lv_obj_t* obj);
 
+/**
+ * Pooled label styles for the combos that recur across screens
+ *
+ * Every lv_obj_set_style_text_font/color call allocates local style
+ * properties on that object and adds entries the style resolver walks on
+ * every redraw. The hot screens (temperatures, weight, shot timer) repeat
+ * the same few font+color combos, so those live in shared lv_style_t
+ * objects initialized once in theme_init(). Per-label color overrides
+ * still work - local properties take precedence over added styles.
+ */
+typedef enum {
+    THEME_LABEL_CAPTION,     // FONT_SMALL, muted (units, hints, captions)
+    THEME_LABEL_FIELD,       // FONT_NORMAL, muted (form/setting labels)
+    THEME_LABEL_TITLE,       // FONT_LARGE, primary (screen titles)
+    THEME_LABEL_VALUE,       // FONT_MEDIUM, primary (setting values)
+    THEME_LABEL_BIG_DIGITS   // FONT_TEMP, primary (large numeric readouts)
+} theme_label_style_t;
+
+void theme_apply_label_style(lv_obj_t* label, theme_label_style_t style);
+
 /**
  * Apply button style to an object
  */
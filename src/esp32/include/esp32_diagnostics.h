@@ -64,5 +64,48 @@ uint8_t esp32_diagnostics_run_test(uint8_t test_id, diag_result_t* result, PicoU
  */
 bool esp32_diagnostics_is_esp32_test(uint8_t test_id);
 
+/**
+ * WEIGHT_STOP loopback latency probe (drives Pico test 0x14)
+ * Raises WEIGHT_STOP_PIN and immediately sends the latency test command, so
+ * the Pico can measure how far the GPIO edge beat the UART command path.
+ * The Pico's result arrives asynchronously via MSG_DIAGNOSTICS.
+ * Caller must ensure the machine is not brewing (raising WEIGHT_STOP
+ * mid-brew stops the shot).
+ * @param picoUart PicoUART reference for sending the command
+ * @return true if the command was sent
+ */
+bool esp32_diagnostics_weight_stop_latency_probe(PicoUART* picoUart);
+
+// =============================================================================
+// Per-Task Watermark Table
+// =============================================================================
+// The task creation sites (cloud, MQTT, display, broadcast, WiFi, OTA,
+// notifications) all guessed their stack sizes. This table reports what each
+// task actually used so the sizes can be trimmed from measurements - exposed
+// at /api/diagnostics/tasks.
+
+#define DIAG_TASK_MAX 20
+
+typedef struct {
+    char name[16];              // Task name (configMAX_TASK_NAME_LEN)
+    uint32_t stack_high_water;  // Bytes of stack that were NEVER used (worst case
+                                // headroom - a large value means the task is oversized)
+    uint8_t priority;           // Current priority
+    int8_t core;                // Pinned core (0/1), -1 = no affinity
+    uint8_t state;              // eTaskState at sample time
+    uint8_t cpu_percent;        // CPU share since the previous call;
+                                // 255 = runtime stats not available in this build
+} diag_task_info_t;
+
+/**
+ * Snapshot all tasks into the caller's table
+ * CPU share is computed against the previous call's runtime counters, so the
+ * first call (and any call after >71min of counter wraparound) reports 255.
+ * @param out Caller-provided array
+ * @param max_tasks Capacity of out
+ * @return Number of entries written
+ */
+size_t esp32_diagnostics_task_table(diag_task_info_t* out, size_t max_tasks);
+
 #endif // ESP32_DIAGNOSTICS_H
 
@@ -0,0 +1,93 @@
+#ifndef EVENT_JOURNAL_H
+#define EVENT_JOURNAL_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "ui/ui.h"  // ui_state_t
+
+#define EVENT_JOURNAL_FILE      "/event_journal.bin"
+#define EVENT_JOURNAL_CAPACITY  256   // Records in the flash ring (~6KB)
+#define EVENT_JOURNAL_MAGIC     0x4C4E4A45  // "EJNL" little-endian
+#define EVENT_JOURNAL_VERSION   1
+
+// Event types
+#define EVENT_TYPE_STATE  1   // Machine state transition
+#define EVENT_TYPE_SHOT   2   // Completed shot
+
+/**
+ * Fixed-size journal record (on-flash layout). seq is monotonic and never
+ * reused - slot position in the ring is seq % EVENT_JOURNAL_CAPACITY, so a
+ * reader holding seq N can fetch exactly the records it missed.
+ */
+struct __attribute__((packed)) EventJournalRecord {
+    uint32_t seq = 0;         // Monotonic sequence (0 = empty slot)
+    uint32_t timestamp = 0;   // Unix time (0 before NTP sync)
+    uint8_t type = 0;         // EVENT_TYPE_*
+    uint8_t stateFrom = 0;    // EVENT_TYPE_STATE
+    uint8_t stateTo = 0;
+    uint8_t reserved = 0;
+    uint32_t durationMs = 0;  // EVENT_TYPE_SHOT
+    float yieldWeight = 0.0f;
+    float peakPressure = 0.0f;
+};
+static_assert(sizeof(EventJournalRecord) == 24, "EventJournalRecord is an on-flash format");
+
+struct __attribute__((packed)) EventJournalHeader {
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint16_t recordSize = 0;  // sizeof(EventJournalRecord)
+    uint32_t capacity = 0;    // Ring slots
+};
+
+/**
+ * Event Journal - sequence-numbered flash ring of state transitions and shots
+ *
+ * Gives the cloud link an event-sourced sync path: on reconnect the cloud
+ * reports the last sequence it has and the device streams only newer events,
+ * instead of re-sending full status and hoping nothing was missed. The ring
+ * file is preallocated and appends overwrite one 24-byte slot in place, so
+ * the flash cost per event is constant. Sequence numbers survive reboots
+ * (recovered by scanning the ring in begin()), which is what makes cloud
+ * shot history gapless.
+ */
+class EventJournal {
+public:
+    /** Mount-time init: create or validate the ring file, recover _nextSeq. */
+    static void begin();
+
+    /**
+     * Drive from the main loop. Appends a state event on every machine_state
+     * transition and a shot event when a brew ends.
+     */
+    static void loop(const ui_state_t& state);
+
+    /** Highest sequence appended so far (0 = journal empty). */
+    static uint32_t latestSeq() { return _nextSeq > 1 ? _nextSeq - 1 : 0; }
+
+    /** Oldest sequence still in the ring (0 = journal empty). */
+    static uint32_t oldestSeq();
+
+    /**
+     * Read up to maxRecords events with seq > afterSeq, oldest first. If
+     * afterSeq has already fallen off the ring, reading starts at the oldest
+     * surviving record - callers detect the gap via out[0].seq > afterSeq+1.
+     * @return Number of records read
+     */
+    static size_t readSince(uint32_t afterSeq, EventJournalRecord* out, size_t maxRecords);
+
+    /** Serialize one record into obj (shared by the cloud sync stream). */
+    static void toJson(const EventJournalRecord& record, JsonObject& obj);
+
+private:
+    static bool append(EventJournalRecord& record);
+
+    static bool _ready;
+    static uint32_t _nextSeq;
+    static uint8_t _lastState;
+    static bool _stateValid;
+    static bool _wasBrewing;
+    static uint32_t _brewStartMs;
+    static float _peakPressure;
+};
+
+#endif // EVENT_JOURNAL_H
@@ -0,0 +1,77 @@
+#ifndef FLEET_MANAGER_H
+#define FLEET_MANAGER_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+/**
+ * BrewOS Fleet Aggregation
+ *
+ * Site installations (cafes, offices) put several machines on one wall
+ * display, and that display used to poll every machine separately. With
+ * network.fleetEnabled, machines advertise a dedicated _brewos._tcp mDNS
+ * service and discover each other; the machine with the lowest IP elects
+ * itself aggregator and polls each peer's /api/status into a cached frame.
+ * The display then makes ONE request to the aggregator's /api/fleet and
+ * gets every machine's status - assembled by appending the cached peer
+ * frames, so serving it costs the aggregator almost nothing.
+ *
+ * Election needs no coordination: every machine sees the same peer set and
+ * picks the same lowest IP. Non-aggregators answer /api/fleet with the
+ * aggregator's address so the display can follow. Discovery and peer
+ * polling run on a Core 0 task (mDNS queries and HTTPClient both block),
+ * demoted by the task governor while a shot runs.
+ */
+
+// How many peers one aggregator tracks (a 15-machine wall plus slack)
+#define FLEET_MAX_PEERS            16
+#define FLEET_DISCOVERY_INTERVAL_MS 60000  // mDNS re-query cadence
+#define FLEET_REFRESH_MS            5000   // Target staleness of a peer frame
+#define FLEET_PEER_STALE_MS         180000 // Drop peers missing this long from mDNS
+#define FLEET_STATUS_BUF_SIZE       4096   // Pool bin holding one peer status frame
+
+class FleetManager {
+public:
+    /**
+     * Start the discovery/poll task if network.fleetEnabled is set.
+     * Safe to call when disabled (no task, endpoint reports disabled).
+     */
+    static void begin();
+
+    static bool enabled();
+
+    /**
+     * True when this machine holds the lowest IP of the known fleet
+     * (a fleet of one is its own aggregator)
+     */
+    static bool isAggregator();
+
+    /**
+     * Address of the current aggregator, for redirecting /api/fleet
+     * callers that landed on a non-aggregator
+     */
+    static IPAddress aggregatorIP();
+
+    /**
+     * Append the peer list as a JSON array of {host, ip, ageMs, status}.
+     * Status is each peer's cached /api/status frame (null until the first
+     * successful fetch). Called from the async web task; takes the peer lock.
+     */
+    static void appendPeersJson(String& out);
+
+    /**
+     * Worst-case serialized peer list size, for String::reserve()
+     */
+    static size_t peersJsonEstimate();
+
+    // Discovery/poll counters for /api/protocol/diagnostics
+    struct Stats {
+        uint32_t discoveries;    // mDNS query rounds completed
+        uint32_t peers;          // Peers currently tracked
+        uint32_t fetches;        // Successful peer status fetches
+        uint32_t fetchFailures;  // Timeouts / HTTP errors
+    };
+    static Stats getStats();
+};
+
+#endif // FLEET_MANAGER_H
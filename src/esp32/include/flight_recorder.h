@@ -0,0 +1,92 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Number of events in the RTC-RAM ring (12 bytes each, ~784 bytes total).
+// RTC slow memory also holds the 2KB crash log buffer - keep this modest.
+#define FLIGHT_RECORDER_EVENTS 64
+
+// Event types. The 'a'/'b'/'value' fields are type-specific:
+enum FlightEventType : uint8_t {
+    FLIGHT_EVENT_BOOT = 1,            // a = reset reason, value = boot count
+    FLIGHT_EVENT_STATE_CHANGE = 2,    // a = old MachineState, b = new MachineState
+    FLIGHT_EVENT_PROTOCOL_ERROR = 3,  // a = error kind, value = detail
+    FLIGHT_EVENT_HEAP_WATERMARK = 4,  // value = new free-heap low (bytes)
+    FLIGHT_EVENT_SHUTDOWN = 5,        // a = reset reason, value = free heap
+};
+
+// Protocol error kinds (FLIGHT_EVENT_PROTOCOL_ERROR 'a' field)
+#define FLIGHT_PROTO_ERR_CRC        1
+#define FLIGHT_PROTO_ERR_LENGTH     2
+#define FLIGHT_PROTO_ERR_BATCH      3
+
+// One fixed-size event (12 bytes). Lives in RTC slow memory, so it must be
+// trivially copyable and still meaningful after a reset.
+struct FlightEvent {
+    uint32_t ms;       // millis() when recorded
+    uint8_t type;      // FlightEventType
+    uint8_t a;         // Type-specific (see enum comments)
+    uint8_t b;
+    uint8_t bootLow;   // Low byte of the boot counter (groups events per boot)
+    uint32_t value;    // Type-specific
+};
+
+/**
+ * Flight Recorder - crash-surviving ring of state transitions
+ *
+ * A fixed ring of binary events in RTC slow memory. Like RTCLogBuffer it
+ * survives software resets, panics and watchdog resets (not power loss).
+ * Recording an event is a handful of stores with no locking or formatting,
+ * so the hooks in hot paths (protocol RX, state changes) cost near nothing.
+ *
+ * After a crash-type reset, begin() snapshots the ring before new events
+ * overwrite it, so the trail leading up to a field lockup can be fetched
+ * from the diagnostics API - no serial cable needed.
+ */
+class FlightRecorder {
+public:
+    /**
+     * Validate/initialize the RTC ring and snapshot the pre-reset trail
+     * when the reset reason indicates a crash. Call once, early in setup().
+     */
+    static void begin();
+
+    static void recordStateChange(uint8_t oldState, uint8_t newState);
+    static void recordProtocolError(uint8_t kind, uint32_t detail);
+
+    /**
+     * Record a free-heap watermark. Only new lows (with hysteresis) are
+     * stored, so this can be fed from periodic memory logging without
+     * flooding the ring.
+     */
+    static void recordHeapWatermark(uint32_t freeHeap);
+
+    /**
+     * Record an orderly or panic shutdown (called from the panic handler).
+     */
+    static void recordShutdown(uint8_t resetReason, uint32_t freeHeap);
+
+    /**
+     * Dump the live ring as JSON (oldest event first).
+     */
+    static void dumpToJson(JsonObject& obj);
+
+    /**
+     * True if the last reset was crash-type and a pre-crash trail was
+     * captured at begin().
+     */
+    static bool hasCrashTrail();
+
+    /**
+     * Dump the pre-crash trail as JSON (no-op when hasCrashTrail() is false).
+     */
+    static void crashTrailToJson(JsonObject& obj);
+
+private:
+    static void record(uint8_t type, uint8_t a, uint8_t b, uint32_t value);
+    static void eventToJson(JsonArray& arr, const FlightEvent& ev);
+};
+
+#endif // FLIGHT_RECORDER_H
@@ -0,0 +1,91 @@
+#ifndef FS_WORKER_H
+#define FS_WORKER_H
+
+#include <Arduino.h>
+#include <functional>
+
+// Queue depth per priority level. Foreground callers block until their job
+// ran, so the queue only ever holds as many entries as there are waiting
+// tasks; background overflow is reported to the caller (keep your dirty
+// flag and retry next interval).
+#define FS_WORKER_QUEUE_DEPTH 8
+
+#define FS_WORKER_STACK       6144
+#define FS_WORKER_PRIORITY    2      // Above loop, below networking (like OtaFlash)
+#define FS_WORKER_CORE        0      // Off the LVGL/loop core
+
+/**
+ * FS Worker - single owner task for LittleFS access
+ *
+ * LittleFS operations block on flash: a small append is ~1ms, but a file
+ * rewrite or log rotation can sit behind a 4KB sector erase (tens of ms)
+ * or a garbage-collection pass (worse). Called synchronously, that stall
+ * is taken by whatever latency-sensitive context happens to be running -
+ * a log rotation inside LogManager::loop() used to stall the whole main
+ * loop a full flash-erase long.
+ *
+ * This facade funnels flash I/O through one worker task with a two-level
+ * priority queue:
+ *
+ *  - PRIO_FOREGROUND: a caller is blocked waiting on the result (display
+ *    asset reads, log export). Always drained before background work.
+ *  - PRIO_BACKGROUND: fire-and-forget persistence (log deltas, statistics
+ *    saves). Runs whenever no foreground job is pending.
+ *
+ * Jobs are std::function closures executed on the worker task, so a
+ * completion callback is simply the tail of the closure. post() is
+ * asynchronous and must only capture by value; runSync() posts and blocks
+ * the caller until the job ran (safe to capture locals by reference), and
+ * is the bridge for code that needs synchronous semantics but still wants
+ * single-owner serialization and priority over queued background writes.
+ *
+ * What this does NOT do: make flash preemptible. A foreground read posted
+ * mid-erase still waits that erase out. What it removes is queueing behind
+ * *pending* background jobs, and it takes the stall off the posting task
+ * entirely.
+ *
+ * Before begin() (early boot) jobs degrade to inline execution on the
+ * caller, so init-order between subsystems and the worker is a non-issue.
+ */
+class FsWorker {
+public:
+    typedef std::function<void()> Job;
+
+    enum Priority {
+        PRIO_FOREGROUND = 0,  // Caller is waiting on the result
+        PRIO_BACKGROUND = 1   // Deferred persistence, runs when idle
+    };
+
+    /**
+     * Start the worker task. Call once after LittleFS is mounted.
+     * @return true if the task and queues were created
+     */
+    static bool begin();
+
+    /**
+     * Queue a job for asynchronous execution on the worker.
+     * The closure must own everything it touches (capture by value) -
+     * it may run long after the caller's stack frame is gone.
+     * @return true if queued (false = queue full, caller should retry)
+     */
+    static bool post(Priority prio, Job job);
+
+    /**
+     * Run a job on the worker and block until it completed. Capturing
+     * caller locals by reference is safe here. Calls from the worker task
+     * itself execute inline (no self-deadlock).
+     * @return true if the job ran
+     */
+    static bool runSync(Priority prio, Job job);
+
+    static bool isStarted() { return _task != nullptr; }
+
+private:
+    static void workerTask(void* param);
+
+    static TaskHandle_t _task;
+    static QueueHandle_t _queue[2];       // Indexed by Priority
+    static SemaphoreHandle_t _pending;    // Counting: one give per queued job
+};
+
+#endif // FS_WORKER_H
@@ -0,0 +1,67 @@
+#ifndef HEAP_TELEMETRY_H
+#define HEAP_TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"  // HEAP_TELEMETRY flag
+
+/**
+ * Opt-in heap telemetry with allocation-site accounting
+ *
+ * Fragmentation hunts used to mean days of bisecting: free-heap graphs show
+ * that something leaks or churns, but not who. With -DHEAP_TELEMETRY=1 the
+ * memory_utils.h helpers (psram_malloc / internal_malloc / safe_free) are
+ * rerouted through the recording allocator below, which keys live bytes,
+ * peak bytes and allocation counts by (file, line) of the expanding macro.
+ * /api/memory/sites in web_server.cpp dumps the top sites sorted by live
+ * bytes, so the offender is readable off one HTTP request.
+ *
+ * Fixed tables, no heap use of its own: unknown sites or pointer-table
+ * overflow are counted as "untracked" rather than dropped silently.
+ * Allocations made directly via malloc/heap_caps_malloc (libraries, IDF)
+ * are not seen - this covers the firmware's own allocation paths, which is
+ * where every fragmentation bug so far has lived.
+ *
+ * When the flag is off this header declares nothing and the helpers keep
+ * their plain inline definitions - zero cost in normal builds.
+ */
+
+#if HEAP_TELEMETRY
+
+/**
+ * Per-site statistics as reported by heap_telemetry_top_sites()
+ */
+struct HeapSiteStats {
+    const char* file;    // __FILE__ of the call site (flash string)
+    uint16_t line;
+    size_t liveBytes;    // Currently outstanding
+    size_t peakBytes;    // Worst concurrent usage seen
+    uint32_t allocs;     // Lifetime allocation count
+};
+
+/**
+ * Allocate with site accounting
+ * @param caps heap_caps_malloc capability mask; a SPIRAM request falls back
+ *             to internal RAM on failure (same policy as psram_malloc)
+ */
+void* heap_telemetry_malloc(size_t size, uint32_t caps, const char* file, int line);
+
+/**
+ * Release an allocation (safe for untracked pointers - just frees them)
+ */
+void heap_telemetry_free(void* ptr);
+
+/**
+ * Copy up to maxSites records, sorted by live bytes descending
+ * @return Number of records written
+ */
+size_t heap_telemetry_top_sites(HeapSiteStats* out, size_t maxSites);
+
+/**
+ * Allocations the fixed tables could not account (site or pointer table full)
+ */
+uint32_t heap_telemetry_untracked();
+
+#endif // HEAP_TELEMETRY
+
+#endif // HEAP_TELEMETRY_H
@@ -2,7 +2,10 @@
 #define LOG_MANAGER_H
 
 #include <Arduino.h>
+#include <FS.h>
 #include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/stream_buffer.h>
 
 // Include config.h for BrewOSLogLevel enum
 // Include guards prevent infinite recursion when config.h includes this file
@@ -39,12 +42,19 @@ struct RTCLogBuffer {
  * 
  * Features:
  * - 50KB ring buffer (only allocated when enabled)
+ * - Binary structured records (8-byte header + raw message bytes);
+ *   text prefixes are rendered lazily when a client fetches logs
  * - Zero memory/performance impact when disabled
  * - Captures ESP32 logs via hook
  * - Receives Pico logs via UART protocol
  * - Provides API for web download
- * - Thread-safe with mutex
- * 
+ *
+ * Transport: producers write records into per-source FreeRTOS stream
+ * buffers (never into the ring directly), and a merge drain moves them
+ * into the ring under the mutex. The mutex therefore serializes only the
+ * drain, saves and fetches - a log call on the Core 1 loop can no longer
+ * block behind Core 0 holding the lock across a flash save.
+ *
  * The buffer is NOT allocated by default - call enable() to start logging.
  * Setting is persisted in NVS via StateManager.
  */
@@ -120,7 +130,16 @@ public:
      * @param length Payload length
      */
     void handlePicoLog(const uint8_t* payload, size_t length);
-    
+
+    /**
+     * Handle incoming compact log record from Pico (MSG_LOG_COMPACT)
+     * Expands the catalog id to text via the shared log_catalog.h table,
+     * then follows the same path as handlePicoLog()
+     * @param payload Record payload: [level][id_lo][id_hi][argc][int32 args]
+     * @param length Payload length
+     */
+    void handlePicoLogCompact(const uint8_t* payload, size_t length);
+
     /**
      * Get the singleton instance
      */
@@ -158,7 +177,48 @@ public:
      * @return String containing all logs
      */
     String getLogsComplete();
-    
+
+    /**
+     * Cursor for streaming the flash log file to a client chunk by chunk.
+     * Holds the open file, a small raw read-ahead buffer and one rendered
+     * entry of carry-over text - the whole download costs ~1.5KB regardless
+     * of file size. Owned by the response (shared_ptr in the chunk lambda)
+     * so it is freed even if the client disconnects mid-transfer; the
+     * destructor closes an abandoned file through the FS worker.
+     */
+    struct LogStreamCursor {
+        File file;
+        size_t fileSize = 0;
+        size_t filePos = 0;     // Next unparsed byte in the file
+        bool rawText = false;   // Legacy /logs.txt - copy bytes straight through
+
+        // Raw record bytes read ahead of the parser (one worker hop per
+        // ~1KB instead of per record)
+        uint8_t raw[1024];
+        size_t rawStart = 0;    // File offset of raw[0]
+        size_t rawLen = 0;
+
+        // Rendered text that didn't fit in the previous chunk
+        char carry[LOG_ENTRY_MAX_SIZE];
+        size_t carryLen = 0;
+        size_t carryOff = 0;
+
+        ~LogStreamCursor();
+    };
+
+    /**
+     * Open the flash log for streaming. Flushes the RAM delta first so the
+     * download includes the latest lines.
+     * @return true if the log file could be opened
+     */
+    bool streamLogsOpen(LogStreamCursor& cur);
+
+    /**
+     * Render the next chunk of log text into out. Returns 0 once the file
+     * is exhausted (which also closes it).
+     */
+    size_t streamLogsChunk(LogStreamCursor& cur, uint8_t* out, size_t maxLen);
+
     /**
      * Periodic update - call from main loop
      * Checks if auto-save is needed and saves to flash if necessary
@@ -167,25 +227,40 @@ public:
     void loop();
 
 private:
-    char* _buffer;              // Circular buffer (nullptr when disabled)
+    char* _buffer;              // Circular buffer of binary records (nullptr when disabled)
     size_t _head;               // Write position
-    size_t _tail;               // Read position (oldest entry)
-    size_t _size;               // Current data size
-    bool _wrapped;              // Buffer has wrapped around
-    SemaphoreHandle_t _mutex;   // Thread safety
+    size_t _tail;               // Read position (oldest record)
+    size_t _size;               // Bytes currently used
+    SemaphoreHandle_t _mutex;   // Guards the ring (drain/save/fetch) - not the log call path
+    StreamBufferHandle_t _streams[2];  // Producer-side transport, indexed by LogSource
+    uint8_t* _streamStorage[2]; // Stream storage areas (PSRAM-preferred)
+    uint32_t _streamDrops[2];   // Records dropped while a stream was full
     bool _picoLogForwarding;    // Pico log forwarding enabled
     bool _enabled;              // Log buffer is enabled
     unsigned long _lastSaveTime; // Last auto-save time (millis)
     size_t _lastSavedHead;      // Last saved head position (for delta saving)
+    volatile bool _savePending; // A delta-save job is queued on the FS worker
     
-    // Internal helpers
+    // Internal helpers - binary record framing (see log_manager.cpp for the
+    // record layout). writeRecord() appends one record; freeSpace() drops
+    // whole records from the tail; renderEntry() produces the text form.
+    void writeRecord(BrewOSLogLevel level, LogSource source, const char* message);
     void writeToBuffer(const char* data, size_t len);
+    void pumpStreams();  // Merge drain: streams -> ring. Caller holds _mutex.
+    void freeSpace(size_t needed);
+    void ringRead(size_t pos, void* out, size_t len) const;
+    size_t renderEntry(char* out, size_t outSize, uint32_t timestamp,
+                       uint8_t level, uint8_t source, const char* msg, size_t msgLen);
     const char* levelToString(BrewOSLogLevel level);
     const char* sourceToString(LogSource source);
     
     // Delta/append mode saving (fast, only writes new entries)
     void saveDelta();
     void rotateLogs();
+
+    // Top the stream cursor's raw buffer up from the file until at least
+    // `need` unparsed bytes are available (or the file runs out)
+    bool streamRefill(LogStreamCursor& cur, size_t need);
     
     /**
      * Get logs without acquiring mutex (assumes caller already has mutex)
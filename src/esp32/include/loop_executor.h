@@ -0,0 +1,72 @@
+#ifndef LOOP_EXECUTOR_H
+#define LOOP_EXECUTOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define LOOP_EXECUTOR_MAX_TASKS 20
+
+/**
+ * Loop Executor - cooperative scheduler for the Core 1 main loop
+ *
+ * Subsystem loop() calls register once with a name, a minimum period, and a
+ * soft deadline, instead of being hard-wired into loop(). Execution stays in
+ * registration order - the phase ordering in main.cpp is semantic (state
+ * sync after UART, UI after state) and must not be re-sorted - but the
+ * executor adds what the hand-rolled chain couldn't:
+ *
+ *  - per-task runtime stats (calls, total/max us, deadline overruns), so
+ *    Core 1 CPU time is finally attributable per subsystem
+ *  - period-based skipping for tasks that don't need every-2ms cadence
+ *  - a "critical" task (the Pico UART poll) that is re-serviced between
+ *    tasks whenever a slow one left it starved past its deadline, so a
+ *    long statistics rollup or JSON rebuild can't back up UART RX
+ */
+class LoopExecutor {
+public:
+    typedef void (*TaskFn)();
+
+    /**
+     * Register a task. Call during setup, in the desired execution order.
+     * @param name       Static string for stats/attribution
+     * @param fn         Task callback
+     * @param periodMs   Minimum ms between runs (0 = every pass)
+     * @param deadlineUs Soft runtime budget; runs past it count as overruns
+     * @param critical   Re-service this task between others when starved
+     */
+    static bool add(const char* name, TaskFn fn, uint32_t periodMs,
+                    uint32_t deadlineUs, bool critical = false);
+
+    /** Run one scheduling pass (call from loop()). */
+    static void run();
+
+    /** Per-task stats for /api/loop-stats. */
+    static void statsToJson(JsonArray& arr);
+
+    /** Reset accumulated stats (keeps registrations). */
+    static void resetStats();
+
+private:
+    struct Task {
+        const char* name;
+        TaskFn fn;
+        uint32_t periodMs;
+        uint32_t deadlineUs;
+        bool critical;
+        uint32_t lastRunMs;
+        // Stats
+        uint32_t calls;
+        uint64_t totalUs;
+        uint32_t maxUs;
+        uint32_t overruns;
+    };
+
+    static void runTask(Task& task);
+
+    static Task _tasks[LOOP_EXECUTOR_MAX_TASKS];
+    static uint8_t _taskCount;
+    static int8_t _criticalIndex;
+    static int64_t _criticalLastServiceUs;
+};
+
+#endif // LOOP_EXECUTOR_H
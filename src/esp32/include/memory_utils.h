@@ -11,6 +11,7 @@
 #include <ArduinoJson.h>
 #include <esp_heap_caps.h>
 #include <esp_log.h>
+#include "heap_telemetry.h"
 
 // Tag for ESP-IDF logging
 static const char* MEMORY_TAG = "PSRAM";
@@ -117,9 +118,21 @@ using SpiRamJsonDocument = BasicJsonDocument<SpiRamAllocator>;
 // Memory Allocation Helpers
 // =============================================================================
 
+#if HEAP_TELEMETRY
+
+// Telemetry build: route the helpers through the recording allocator so each
+// call site is accounted by (file, line). Allocation policy is unchanged -
+// heap_telemetry_malloc applies the same PSRAM->internal fallback, and
+// heap_telemetry_free forwards to heap_caps_free.
+#define psram_malloc(size)    heap_telemetry_malloc((size), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, __FILE__, __LINE__)
+#define internal_malloc(size) heap_telemetry_malloc((size), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, __FILE__, __LINE__)
+#define safe_free(ptr)        heap_telemetry_free(ptr)
+
+#else
+
 /**
  * Allocate a buffer in PSRAM with fallback to internal RAM.
- * 
+ *
  * @param size Size in bytes to allocate
  * @return Pointer to allocated memory, or nullptr on failure
  */
@@ -133,7 +146,7 @@ inline void* psram_malloc(size_t size) {
 
 /**
  * Allocate a buffer strictly in internal RAM (for DMA, ISR, etc).
- * 
+ *
  * @param size Size in bytes to allocate
  * @return Pointer to allocated memory, or nullptr on failure
  */
@@ -151,6 +164,8 @@ inline void safe_free(void* ptr) {
     }
 }
 
+#endif // HEAP_TELEMETRY
+
 // =============================================================================
 // Memory Statistics
 // =============================================================================
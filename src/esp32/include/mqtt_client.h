@@ -11,6 +11,7 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <PubSubClient.h>
+#include <lwip/dns.h>  // Async broker resolution (dns_gethostbyname)
 #include <Preferences.h>
 #include <ArduinoJson.h>
 #include <freertos/FreeRTOS.h>
@@ -36,10 +37,24 @@
 // MQTT Command Queue Structure
 // =============================================================================
 
-// Command structure for thread-safe command passing from Core 0 (MQTT task) to Core 1 (main loop)
-struct MQTTCommand {
-    char cmd[32];
-    char payload[256];  // Serialized JSON payload
+/**
+ * Interned command ids. The MQTT command set is small and fixed (it is what
+ * HA discovery advertises), so the receive path decodes the name once on
+ * Core 0 and unknown commands are rejected before anything is queued.
+ */
+enum mqtt_cmd_id_t : uint8_t {
+    MQTT_CMD_SET_TEMP = 0,
+    MQTT_CMD_SET_MODE,
+    MQTT_CMD_TARE,
+    MQTT_CMD_SET_TARGET_WEIGHT,
+    MQTT_CMD_SET_ECO,
+    MQTT_CMD_ENTER_ECO,
+    MQTT_CMD_EXIT_ECO,
+    MQTT_CMD_BREW_START,
+    MQTT_CMD_BREW_STOP,
+    MQTT_CMD_SET_HEATING_STRATEGY,
+    MQTT_CMD_COUNT,
+    MQTT_CMD_UNKNOWN = MQTT_CMD_COUNT
 };
 
 // =============================================================================
@@ -73,6 +88,23 @@ struct MQTTConfig {
     }
 };
 
+// =============================================================================
+// Publish Statistics
+// =============================================================================
+
+/**
+ * Publish-rate counters for diagnostics
+ *
+ * Tracks what this device actually puts on the broker: messages written,
+ * publishes suppressed because the payload was byte-identical to the last
+ * one on that topic, and total payload bytes sent.
+ */
+struct MQTTPublishStats {
+    uint32_t published;     // Messages written to the socket
+    uint32_t suppressed;    // Publishes skipped (unchanged payload)
+    uint64_t payloadBytes;  // Total payload bytes written
+};
+
 // =============================================================================
 // MQTT Client Class
 // =============================================================================
@@ -93,10 +125,11 @@ public:
     void loop();
     
     /**
-     * Process queued commands - call in main loop on Core 1
-     * Thread-safe: dequeues commands from queue and executes callback
+     * Execute a command via the registered callback
+     * Called by the CommandRouter sink on Core 1 - the receive path posts
+     * commands there instead of draining a private queue one-at-a-time
      */
-    void processCommands();
+    void dispatchCommand(const char* cmd, JsonDocument& doc);
     
     /**
      * Get current configuration
@@ -167,6 +200,11 @@ public:
      * Get connection status string
      */
     String getStatusString() const;
+
+    /**
+     * Get publish-rate counters (for the diagnostics JSON)
+     */
+    void getPublishStats(MQTTPublishStats* stats) const;
     
     /**
      * Events - Simple function pointers to avoid std::function PSRAM allocation issues
@@ -206,6 +244,22 @@ private:
     unsigned long _lastReconnectAttempt;
     unsigned long _lastStatusPublish;
     int _reconnectDelay;
+
+    // Async broker resolution (reconnect path). The lwIP callback runs on
+    // the tcpip task, so the result crosses to the MQTT task as a raw
+    // address guarded by the volatile state flag.
+    enum resolve_state_t : uint8_t {
+        RESOLVE_IDLE = 0,
+        RESOLVE_PENDING,
+        RESOLVE_DONE,
+        RESOLVE_FAILED
+    };
+    static const unsigned long DNS_RESOLVE_TIMEOUT_MS = 5000;
+    volatile resolve_state_t _resolveState = RESOLVE_IDLE;
+    volatile uint32_t _resolvedAddr = 0;   // Network byte order (valid when DONE)
+    unsigned long _resolveStartMs = 0;
+    IPAddress _lastGoodIP;                 // Last IP that completed a connect
+    bool _triedLastGoodIP = false;         // Fast-path attempt made this outage
     
     // Callbacks - simple function pointers
     mqtt_event_callback_t _onConnected = nullptr;
@@ -224,14 +278,13 @@ private:
     SemaphoreHandle_t _mutex = nullptr;
     volatile bool _taskRunning = false;
     
-    // Command queue for thread-safe command passing from Core 0 to Core 1
-    QueueHandle_t _commandQueue = nullptr;
-    static const size_t COMMAND_QUEUE_SIZE = 10;
-    
     // Internal methods
     void loadConfig();
     void saveConfig();
     bool connect();
+    bool connectToBroker(IPAddress brokerIP);
+    bool resolveBroker(IPAddress& out);
+    static void dnsResolvedCallback(const char* name, const ip_addr_t* ipaddr, void* arg);
     void disconnect();
     void publishHomeAssistantDiscovery();
     void publishAvailability(bool online);
@@ -241,6 +294,38 @@ private:
     static void messageCallback(char* topic, byte* payload, unsigned int length);
     static MQTTClient* _instance;
     
+    // Publish pipeline: per-topic last-payload cache + rate counters
+    MQTTPublishStats _publishStats;
+    uint32_t _statusSequence;
+    bool payloadChanged(const char* suffix, const char* payload, size_t len);
+    bool publishPayload(const char* topic, const char* payload, size_t len, bool retained);
+
+    // HA discovery skip: fingerprint of everything that shapes the discovery
+    // payloads. Saved to NVS after a complete publish; while it matches, the
+    // broker's retained configs are still valid and the reconnect burst is
+    // skipped.
+    uint32_t _savedDiscoveryFingerprint;
+    uint32_t discoveryFingerprint() const;
+
+    // Interned topic table: the fixed publish/subscribe topics are assembled
+    // once per configuration (buildTopicTable) instead of snprintf'd on every
+    // publish. Dynamic topics (HA discovery objects, power meter) still use
+    // the builders below.
+    enum TopicId : uint8_t {
+        TOPIC_AVAILABILITY = 0,
+        TOPIC_COMMAND,
+        TOPIC_STATUS,
+        TOPIC_STATUS_DELTA,
+        TOPIC_SHOT,
+        TOPIC_STATISTICS,
+        TOPIC_POWER,
+        TOPIC_COUNT
+    };
+    static const char* const TOPIC_SUFFIXES[TOPIC_COUNT];
+    char _topicTable[TOPIC_COUNT][80];  // prefix(31) + '/' + device_id(31) + '/' + suffix
+    void buildTopicTable();
+    const char* topicFor(TopicId id) const { return _topicTable[id]; }
+
     // Topic builders
     void getTopic(const char* suffix, char* buffer, size_t len) const;
     String topic(const char* suffix) const;  // Deprecated: use getTopic() instead
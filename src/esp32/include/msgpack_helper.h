@@ -24,6 +24,8 @@
  * - Uint8: 0xCC, Uint16: 0xCD, Uint32: 0xCE, Uint64: 0xCF
  * - Int8: 0xD0, Int16: 0xD1, Int32: 0xD2, Int64: 0xD3
  */
+class MsgPackChain;
+
 class MessagePackHelper {
 public:
     /**
@@ -34,7 +36,14 @@ public:
      * @return Number of bytes written, or 0 on error
      */
     static size_t serialize(const JsonDocument& doc, uint8_t* buffer, size_t bufferSize);
-    
+
+    /**
+     * Serialize into a chunk chain instead of a flat buffer - no size cap,
+     * so callers don't have to guess a worst-case buffer up front. The chain
+     * is reset first; on error it is left empty and 0 is returned.
+     */
+    static size_t serialize(const JsonDocument& doc, MsgPackChain& chain);
+
     /**
      * Estimate MessagePack size (rough estimate, ~50-60% of JSON)
      */
@@ -42,5 +51,128 @@ public:
 
 };
 
+/**
+ * Chunked MessagePack output chain
+ *
+ * An iovec-style list of fixed-size PSRAM chunks that encoders grow one
+ * chunk at a time, so nothing has to size a contiguous staging buffer for
+ * the worst-case frame. Both transports we have today (AsyncWebSocket and
+ * the cloud WebSocket client) only accept contiguous frames, so sinks call
+ * gather() to copy the chain once into an exact-size buffer; a transport
+ * that can scatter would walk chunks() directly and skip that copy.
+ *
+ * reset() rewinds without releasing, so a chain owned by a steady-rate
+ * producer (the status broadcast) settles at its largest frame ever and
+ * causes no pool traffic per tick. Chunks come from the PsramPool 1K bin.
+ */
+class MsgPackChain {
+public:
+    // Chunk allocation size, header included - matches a PsramPool bin
+    static const size_t CHUNK_SIZE = 1024;
+
+    struct Chunk {
+        Chunk* next;
+        size_t used;
+        uint8_t* data() { return (uint8_t*)(this + 1); }
+        const uint8_t* data() const { return (const uint8_t*)(this + 1); }
+    };
+
+    MsgPackChain();
+    ~MsgPackChain();            // Releases all chunks back to the pool
+
+    void reset();               // Rewind to empty, keeping chunks for reuse
+    bool append(const uint8_t* bytes, size_t len);
+    // Rewrite already-written bytes (map16 count back-patching). The range
+    // may straddle a chunk boundary.
+    bool patch(size_t offset, const uint8_t* bytes, size_t len);
+
+    size_t length() const { return _length; }
+    bool overflowed() const { return _error; }
+
+    // Copy the whole chain into `out`. Returns the frame length, or 0 if the
+    // chain is empty/errored or `cap` is too small.
+    size_t gather(uint8_t* out, size_t cap) const;
+
+    const Chunk* chunks() const { return _head; }
+
+private:
+    static size_t chunkCapacity() { return CHUNK_SIZE - sizeof(Chunk); }
+    Chunk* grow();              // Append a fresh or recycled chunk
+
+    Chunk* _head;
+    Chunk* _tail;               // Last chunk with data (reused chunks may follow)
+    size_t _length;
+    bool _error;                // Pool allocation failed mid-frame
+};
+
+// Internal encode target shared by MessagePackHelper and MsgPackWriter -
+// either a flat bounds-checked buffer or a chain. Not for direct use.
+struct msgpack_sink_t {
+    uint8_t* buffer;
+    size_t size;
+    size_t offset;
+    MsgPackChain* chain;
+};
+
+/**
+ * Incremental MessagePack writer
+ *
+ * Streams key/value pairs straight into a pre-allocated buffer with no
+ * intermediate JsonDocument - the per-tick status broadcast uses this to
+ * write only the sections whose change bits are set, instead of building
+ * and walking a full document every 500ms.
+ *
+ * Maps are emitted with a map16 header and the pair count is back-patched
+ * in endMap(), so callers can decide per-section whether to write anything
+ * at all. On buffer overflow or unbalanced begin/endMap the writer latches
+ * an error and finish() returns 0.
+ *
+ * Usage:
+ *   MsgPackWriter w(buffer, size);
+ *   w.beginMap();
+ *   w.key("type");  w.writeStr("status_delta");
+ *   if (changed.temps) { w.key("temps"); w.beginMap(); ... w.endMap(); }
+ *   w.endMap();
+ *   size_t len = w.finish();
+ */
+class MsgPackWriter {
+public:
+    MsgPackWriter(uint8_t* buffer, size_t bufferSize);
+
+    // Write into a chunk chain instead - no size cap. The chain is reset
+    // first; finish() still returns the total frame length.
+    explicit MsgPackWriter(MsgPackChain& chain);
+
+    void beginMap();            // Open a map (pair count patched in endMap)
+    void endMap();
+
+    // Open a fixed-count array (no end call - the count is known up front,
+    // e.g. the compact cloud status frame sizes it from a presence mask)
+    void beginArray(uint16_t count);
+
+    void key(const char* k);    // Write a map key (counts the pair)
+    void writeStr(const char* v);   // nullptr writes nil
+    void writeBool(bool v);
+    void writeNil();
+    void writeUint(uint32_t v);
+    void writeInt(int32_t v);
+    void writeFloat(float v);
+    void writeDouble(double v);
+
+    // Bytes written, or 0 if the buffer overflowed or maps are unbalanced
+    size_t finish();
+
+private:
+    static constexpr uint8_t MAX_DEPTH = 8;  // Deepest nesting in status is 4
+
+    msgpack_sink_t _sink;
+    bool _error;
+    uint8_t _depth;
+    struct {
+        size_t patchOffset;     // Where the map16 count bytes live
+        uint16_t pairs;
+    } _maps[MAX_DEPTH];
+};
+
 #endif // MSGPACK_HELPER_H
 
@@ -9,13 +9,16 @@
 #include "notification_types.h"
 
 /**
- * Send a notification to the cloud server
+ * Send a notification to the cloud server.
+ * Blocking HTTPS POST - only call from the notification push task, never
+ * from the state-change path.
  * @param cloudUrl The base URL of the cloud service (e.g., "https://brewos.io")
  * @param deviceId The device ID (e.g., "BRW-12345678")
  * @param deviceKey The device key for authentication
  * @param notif The notification to send
+ * @return true if the server accepted the notification (HTTP 200)
  */
-void sendNotificationToCloud(const String& cloudUrl, const String& deviceId, const String& deviceKey, const Notification& notif);
+bool sendNotificationToCloud(const String& cloudUrl, const String& deviceId, const String& deviceKey, const Notification& notif);
 
 #endif // CLOUD_NOTIFIER_H
 
@@ -11,6 +11,9 @@
 #include <Arduino.h>
 #include <vector>
 #include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
 #include "notification_types.h"
 
 // =============================================================================
@@ -48,6 +51,11 @@ struct NotificationPreferences {
 // Simple function pointer to avoid std::function PSRAM allocation issues
 typedef void (*NotificationSendCallback)(const Notification&);
 
+// Cloud push callback - returns true on successful delivery so the push
+// task knows whether to retry. WebSocket/MQTT stay fire-and-forget (they
+// hand off to queues internally); cloud push is a blocking HTTPS POST.
+typedef bool (*NotificationPushCallback)(const Notification&);
+
 // =============================================================================
 // Notification Manager
 // =============================================================================
@@ -77,6 +85,7 @@ public:
     void descaleDue(uint32_t days_overdue = 0);
     void serviceDue(uint32_t total_shots);
     void backflushDue();
+    void pumpWear(float drift_pct, uint32_t shots);
     void machineError(uint8_t error_code, const char* details = nullptr);
     void picoOffline();
     
@@ -138,7 +147,7 @@ public:
     
     void onWebSocket(NotificationSendCallback cb) { _onWebSocket = cb; }
     void onMQTT(NotificationSendCallback cb) { _onMQTT = cb; }
-    void onCloud(NotificationSendCallback cb) { _onCloud = cb; }
+    void onCloud(NotificationPushCallback cb) { _onCloud = cb; }
     
 private:
     Notification _active[NOTIF_MAX_ACTIVE];
@@ -152,8 +161,22 @@ private:
     // Callbacks
     NotificationSendCallback _onWebSocket;
     NotificationSendCallback _onMQTT;
-    NotificationSendCallback _onCloud;
-    
+    NotificationPushCallback _onCloud;
+
+    // Cloud push dispatch - the HTTPS POST to the push service can take
+    // hundreds of ms (TLS handshake), so it must never run inline from the
+    // state-change path that created the notification. Creators enqueue the
+    // already-rendered Notification here; a low-priority task drains it.
+    struct PendingPush {
+        Notification notif;
+        uint32_t enqueuedAt;   // millis() when queued, for expiry
+    };
+    QueueHandle_t _pushQueue = nullptr;
+    TaskHandle_t _pushTaskHandle = nullptr;
+    static void pushTaskCode(void* arg);
+    void runPushTask();
+    void enqueuePush(const Notification& notif);
+
     // Internal
     void send(const Notification& notif);
     void addActive(const Notification& notif);
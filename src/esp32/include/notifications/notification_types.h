@@ -12,7 +12,7 @@
 #include <cstdint>
 
 // =============================================================================
-// Notification Types (Keep it simple - only 7 types)
+// Notification Types (Keep it simple - only 8 types)
 // =============================================================================
 
 enum class NotificationType : uint8_t {
@@ -22,7 +22,8 @@ enum class NotificationType : uint8_t {
     DESCALE_DUE    = 3,   // Time to descale
     SERVICE_DUE    = 4,   // Maintenance recommended
     BACKFLUSH_DUE  = 5,   // Backflush reminder
-    
+    PUMP_WEAR      = 6,   // Pump transient fingerprint drifting from baseline
+
     // Alerts (10+)
     MACHINE_ERROR  = 10,  // Pico reported an error
     PICO_OFFLINE   = 11   // Control board disconnected
@@ -66,6 +67,7 @@ inline const char* getNotificationCode(NotificationType type) {
         case NotificationType::DESCALE_DUE:    return "DESCALE_DUE";
         case NotificationType::SERVICE_DUE:    return "SERVICE_DUE";
         case NotificationType::BACKFLUSH_DUE:  return "BACKFLUSH_DUE";
+        case NotificationType::PUMP_WEAR:      return "PUMP_WEAR";
         case NotificationType::MACHINE_ERROR:  return "MACHINE_ERROR";
         case NotificationType::PICO_OFFLINE:   return "PICO_OFFLINE";
         default: return "UNKNOWN";
@@ -56,6 +56,21 @@ public:
      * Check if current token is still valid
      */
     bool isTokenValid() const;
+
+    /**
+     * Check if the current token is valid AND already registered with the
+     * cloud. When true, serving a pairing QR is a pure lookup - no TLS
+     * handshake on the requesting task.
+     */
+    bool hasRegisteredToken() const;
+
+    /**
+     * Pre-register a pairing token in the background so the next QR
+     * request hits the fast path. Spawns a short-lived task (TLS needs
+     * its own stack); no-op if a registered token already exists, a
+     * prewarm is in flight, or WiFi is down.
+     */
+    void prewarmTokenAsync();
     
     /**
      * Get token expiry time (Unix timestamp)
@@ -92,11 +107,14 @@ private:
     String _deviceKey;
     String _currentToken;
     unsigned long _tokenExpiry;
+    bool _tokenRegistered;           // Current token is known to the cloud
+    volatile bool _prewarmActive;    // A prewarm task is in flight
     std::function<void(const String&)> _onPairingSuccess;
-    
+
     String generateRandomToken(size_t length = 32);
     void initDeviceId();
     void initDeviceKey();
+    static void prewarmTask(void* param);
 };
 
 #endif // PAIRING_MANAGER_H
@@ -55,6 +55,19 @@ public:
      * Parses version info, updates StateManager, and sends configuration
      */
     void handleBoot(const PicoPacket& packet);
+
+    /**
+     * Handle bulk config snapshot message
+     * Applies the whole machine config from a single MSG_CONFIG_SNAPSHOT frame
+     */
+    void handleConfigSnapshot(const PicoPacket& packet);
+
+    /**
+     * Handle warm-boot state snapshot message
+     * Applies version, machine type and the embedded status frame in one go
+     * so an ESP32-only reboot shows truthful state without polling the Pico
+     */
+    void handleWarmState(const PicoPacket& packet);
     
     /**
      * Get current backoff timestamp (for PicoUART to check)
@@ -67,6 +80,20 @@ private:
      * Parses Pico status packet and updates RuntimeState
      */
     void handleStatus(const uint8_t* payload, uint8_t length);
+
+    /**
+     * Handle delta status message
+     * Applies the changed-field mask onto the mirrored status payload and
+     * reuses handleStatus() on the reconstructed full frame. Deltas arriving
+     * before the first MSG_STATUS keyframe are dropped (no baseline yet).
+     */
+    void handleStatusDelta(const uint8_t* payload, uint8_t length);
+
+    // Raw mirror of the last full status payload (delta reconstruction base)
+    static constexpr uint8_t STATUS_PAYLOAD_SIZE = 47;
+    uint8_t _statusMirror[STATUS_PAYLOAD_SIZE];
+    bool _statusMirrorValid = false;
+
     PicoUART* _uart;
     BrewWebServer* _server;
     BrewOS::StateManager* _state;
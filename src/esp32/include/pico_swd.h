@@ -148,6 +148,9 @@ private:
     // Memory/Core
     bool writeWord(uint32_t addr, uint32_t data);
     uint32_t readWord(uint32_t addr);
+    bool writeMemBlock(uint32_t addr, const uint8_t* data, size_t len);  // CSW auto-increment bulk write
+    bool readMemBlock(uint32_t addr, uint8_t* data, size_t len);         // CSW auto-increment bulk read
+    void setFastClock(bool fast);  // Fast bit clock for bulk transfers (slow for connect/handshake)
     bool initAP();
     bool haltCore();
     bool runCore();
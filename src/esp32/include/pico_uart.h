@@ -3,20 +3,34 @@
 
 #include <Arduino.h>
 #include "config.h"  // Includes protocol_defs.h for PROTOCOL_MAX_PACKET
+#include "protocol_latency.h"  // Shared command->ACK latency histogram buckets
 
-// Packet structure
+// Packet view - zero-copy dispatch
+// `payload` points directly into the PicoUART RX buffer; no per-packet memcpy.
+// The view is only valid for the duration of the callback. Handlers that defer
+// work must copy what they need and can compare `generation` against
+// PicoUART::rxGeneration() to detect that the buffer has since been reused.
 struct PicoPacket {
     uint8_t type;
     uint8_t length;
     uint8_t seq;
-    uint8_t payload[64];  // Updated to match PROTOCOL_MAX_PAYLOAD (was 56)
+    const uint8_t* payload;  // View into RX buffer (valid during callback only)
     uint16_t crc;
     bool valid;
+    uint32_t generation;     // Increments per received frame (staleness check)
 };
 
 // Simple function pointer callback to avoid std::function PSRAM allocation issues
 typedef void (*PacketCallback)(const PicoPacket& packet);
 
+// TX priority classes - control traffic (brew stop, mode changes) must never
+// queue behind bulk config/log writes; brew-stop latency is safety-adjacent
+enum class TxPriority : uint8_t {
+    CONTROL = 0,   // Brew start/stop, mode, weight-stop fallback
+    NORMAL  = 1,   // Pings, handshake, temp/PID setpoints
+    BULK    = 2    // Config dumps, debug, log-level traffic
+};
+
 class PicoUART {
 public:
     PicoUART(HardwareSerial& serial);
@@ -27,13 +41,18 @@ public:
     // Update - call in loop, processes incoming data
     void loop();
     
-    // Send packet to Pico
+    // Send packet to Pico (enqueued by priority; CONTROL drains first)
     bool sendPacket(uint8_t type, const uint8_t* payload, uint8_t length);
+
+    // TX queue statistics
+    uint32_t getTxDropped() { return _txDropped; }
+    uint8_t getTxQueueDepth(TxPriority prio) { return _txQueues[(uint8_t)prio].count; }
     
     // Convenience methods
     bool sendPing();
     bool sendCommand(uint8_t cmdType, const uint8_t* data, uint8_t len);
     bool requestConfig();
+    bool requestConfigSnapshot();  // Bulk config in one round trip (MSG_CMD_GET_SNAPSHOT)
     bool requestBootInfo();  // Request boot info (version, machine type)
     bool sendHandshake();    // Send protocol handshake
     
@@ -60,8 +79,39 @@ public:
     // Statistics
     uint32_t getPacketsReceived() { return _packetsReceived; }
     uint32_t getPacketErrors() { return _packetErrors; }
+    uint32_t rxGeneration() { return _rxGeneration; }  // Bumped per received frame
     bool isConnected() { return _connected; }
-    int bytesAvailable() { return Serial1.available(); }  // Check if any raw bytes are available
+
+    // Command->ACK round-trip latency (mirror of the Pico-side histogram;
+    // percentiles derived from the shared fixed buckets in protocol_latency.h)
+    uint32_t getAckLatencyPercentile(uint8_t percentile) {
+        return protocol_latency_percentile_ms(_ackLatencyBuckets, _ackLatencySamples, percentile);
+    }
+    uint32_t getAckLatencyMax() { return _ackLatencyMaxMs; }
+    uint32_t getAckLatencySamples() { return _ackLatencySamples; }
+
+    // Pico control-loop jitter report (MSG_JITTER, pushed every 60s).
+    // Lateness of the Core 0 control tick vs its 100ms period; bucket
+    // bounds are the shared control_jitter_bounds_us in protocol_latency.h.
+    struct PicoJitterStats {
+        bool valid;                 // false until the first report arrives
+        uint32_t samples;
+        uint32_t lateBuckets[CONTROL_JITTER_BUCKET_COUNT];
+        uint32_t maxLateUs;         // Worst lateness overall
+        uint32_t maxLateFlashUs;    // Worst with a flash pause as the cause
+        uint32_t maxLateClassBUs;   // Worst dominated by Class B slices
+        uint32_t maxLateProtocolUs; // Worst dominated by Core 0 protocol sends
+        uint32_t maxLateOtherUs;    // Worst with no identified cause
+    };
+    const PicoJitterStats& getControlJitter() { return _jitter; }
+
+    // RX ring statistics (bytes dropped because loop() fell behind, and the
+    // worst fill level seen - both indicate UI load starving the main loop)
+    uint32_t getRxRingOverflow() { return _rxRingOverflow; }
+    uint32_t getRxRingHighWater() { return _rxRingHighWater; }
+    int bytesAvailable() {  // Check if any raw bytes are available (ring + driver)
+        return (int)(_rxRingHead - _rxRingTail) + Serial1.available();
+    }
     
     // Reset connection state (used during OTA to properly detect reconnection)
     void clearConnectionState() { _connected = false; _lastPacketTime = 0; }
@@ -74,14 +124,13 @@ private:
     HardwareSerial& _serial;
     PacketCallback _packetCallback = nullptr;
     
-    // Receive state machine
+    // Receive state machine (chunk-oriented)
+    // WAIT_START scans for the sync byte, GOT_HEADER accumulates type/length/seq,
+    // READING_BODY accumulates payload + CRC in bulk copies
     enum class RxState {
         WAIT_START,
-        GOT_TYPE,
-        GOT_LENGTH,
-        GOT_SEQ,
-        READING_PAYLOAD,
-        READING_CRC
+        GOT_HEADER,
+        READING_BODY
     };
     
     RxState _rxState;
@@ -89,20 +138,101 @@ private:
     uint8_t _rxIndex;
     uint8_t _rxLength;
     uint8_t _txSeq;
+
+    // Lock-free SPSC ring between the UART event task (producer, onUartData)
+    // and loop() (consumer). The driver ISR wakes the event task immediately,
+    // so bytes land here even when LVGL stretches the main loop interval and
+    // loop() polls late. Free-running 32-bit indices, power-of-two size, one
+    // writer per index - no locks needed.
+    //
+    // Sized for >1s of worst-case real protocol traffic (20Hz status frames,
+    // log forwarding, config snapshots: ~4KB/s). Full line rate at 921600 baud
+    // would need 92KB - not a realistic sustained load and not worth the RAM.
+    static constexpr uint32_t RX_RING_SIZE = 8192;  // Must be a power of two
+
+    uint8_t _rxRing[RX_RING_SIZE];
+    volatile uint32_t _rxRingHead = 0;  // Written only by the event task
+    volatile uint32_t _rxRingTail = 0;  // Written only by loop()/readRawByte()
+    uint32_t _rxRingOverflow = 0;       // Bytes dropped because the ring was full
+    uint32_t _rxRingHighWater = 0;      // Max fill level observed
+
+    // Producer: drain the driver buffer into the ring (UART event task context)
+    void onUartData();
+
+    // Consumer: pull up to maxLen buffered bytes out of the ring
+    size_t ringRead(uint8_t* dst, size_t maxLen);
+
+    // Read one raw byte - ring first, then driver (for the paused/OTA path
+    // where the event task leaves bytes in the driver). Returns -1 if empty.
+    int readRawByte();
     
     // Statistics
     uint32_t _packetsReceived;
     uint32_t _packetErrors;
+    uint32_t _rxGeneration = 0;  // Frame generation counter for view validity
     unsigned long _lastPacketTime;
     bool _connected;
     bool _paused;  // When true, loop() won't process incoming data (for OTA)
     uint32_t _backoffUntil;  // Non-blocking backoff timestamp (0 = no backoff)
     
+    // TX queue - one ring per priority, drained strictly CONTROL > NORMAL > BULK.
+    // Sequence numbers and CRC are assigned at dequeue time so seq stays
+    // monotonic in wire order even when priorities reorder submissions.
+    static constexpr uint8_t TX_QUEUE_DEPTH = 8;
+    // BULK enqueues above this watermark are rejected (backpressure to caller);
+    // CONTROL and NORMAL may fill their full ring
+    static constexpr uint8_t TX_BULK_WATERMARK = 6;
+
+    struct TxEntry {
+        uint8_t type;
+        uint8_t length;
+        uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+    };
+
+    struct TxQueue {
+        TxEntry entries[TX_QUEUE_DEPTH];
+        uint8_t head = 0;   // Next slot to dequeue
+        uint8_t count = 0;  // Entries in queue
+    };
+
+    TxQueue _txQueues[3];
+    uint32_t _txDropped = 0;  // Frames rejected because their ring was full
+
+    // Command->ACK latency tracking. Send timestamps are recorded per seq at
+    // wire-write time (writeFrame) so queueing delay isn't counted as RTT.
+    static constexpr uint8_t CMD_TIMESTAMP_SLOTS = 8;
+    struct CmdTimestamp {
+        uint8_t seq = 0;
+        uint32_t sentMs = 0;
+        bool active = false;
+    };
+    CmdTimestamp _cmdSendTimes[CMD_TIMESTAMP_SLOTS];
+    uint32_t _ackLatencyBuckets[PROTOCOL_LATENCY_BUCKET_COUNT] = {0};
+    uint32_t _ackLatencySamples = 0;
+    uint32_t _ackLatencyMaxMs = 0;
+
+    // Record wire-write time for a command awaiting ACK / match an ACK to it
+    void trackCommandSent(uint8_t seq);
+    void recordAckLatency(uint8_t cmdSeq);
+
+    // Last MSG_JITTER report (snooped in processPacket like the ACK RTT)
+    PicoJitterStats _jitter = {};
+    void recordJitterReport(const uint8_t* payload, uint8_t length);
+
+    // Classify a message type into a TX priority class
+    static TxPriority classifyTxPriority(uint8_t type);
+
+    // Drain queued frames into the UART driver (called from loop() and sendPacket)
+    void pumpTx();
+
+    // Write one fully framed packet if driver TX buffer has room
+    bool writeFrame(uint8_t type, const uint8_t* payload, uint8_t length);
+
     // CRC calculation
     uint16_t calculateCRC(const uint8_t* data, size_t length);
     
-    // Process received byte
-    void processByte(uint8_t byte);
+    // Process a chunk of received bytes (bulk frame assembly)
+    void processChunk(const uint8_t* data, size_t len);
     
     // Process complete packet
     void processPacket();
@@ -14,14 +14,16 @@
 #include <time.h>
 #include <unistd.h>
 
+#include "simulator/sim_clock.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Routed through the shared simulator clock: wall time normally, virtual
+// time when a headless/replay harness is driving the run
 static inline uint32_t platform_millis(void) {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint32_t)((ts.tv_sec * 1000) + (ts.tv_nsec / 1000000));
+    return sim_clock_millis();
 }
 
 static inline void platform_delay(uint32_t ms) {
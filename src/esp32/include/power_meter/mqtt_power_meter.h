@@ -50,7 +50,17 @@ public:
     
     // Timeout detection
     bool isStale() const;
-    
+
+    /**
+     * Monotonic version, bumped only when a reading clears the ingestion
+     * deadband (or the heartbeat interval lapses). Consumers keep their own
+     * cookie and skip rebroadcasting readings where watts barely moved.
+     * read() always returns the latest exact values - the meter's cumulative
+     * energy register is the accumulator, so decimation costs no kWh accuracy.
+     */
+    uint32_t readingVersion() const { return _readingVersion; }
+    uint32_t suppressedCount() const { return _suppressedReadings; }
+
 private:
     String _topic;
     MqttFormat _format;
@@ -75,10 +85,24 @@ private:
     // JSON path extraction helper
     bool extractJsonValue(JsonDocument& doc, const String& path, float& value);
     
+    // Deadband decimation state
+    uint32_t _readingVersion;
+    uint32_t _suppressedReadings;
+    float _acceptedPower;       // Power at the last version bump
+    uint32_t _lastAcceptTime;
+
     // Stale threshold: how long after the last SENSOR message before we consider
     // data "stale". Only used as fallback when LWT is not available.
     // Set generously to accommodate Tasmota TelePeriod (default 300s).
     static constexpr uint32_t STALE_THRESHOLD_MS = 330000;  // 5.5 minutes
+
+    // Ingestion deadband: a reading bumps the version only when power moved
+    // at least max(DEADBAND_WATTS, DEADBAND_PERCENT of the last accepted
+    // value), or the heartbeat lapsed (keeps energy totals flowing even at
+    // rock-steady load).
+    static constexpr float DEADBAND_WATTS = 2.0f;
+    static constexpr float DEADBAND_PERCENT = 2.0f;
+    static constexpr uint32_t DEADBAND_HEARTBEAT_MS = 60000;
 };
 
 #endif // MQTT_POWER_METER_H
@@ -61,6 +61,13 @@ public:
     
     // Data access
     bool getReading(PowerMeterReading& reading);
+
+    /**
+     * True when the meter accepted a reading (deadband cleared) since the
+     * last call. The periodic broadcast/publish path keys off this so a
+     * rock-steady load doesn't wake the status pipeline at meter rate.
+     */
+    bool consumeReadingChange();
     bool isConnected() const;
     const char* getMeterName() const;
     const char* getLastError() const;
@@ -95,6 +102,9 @@ private:
     // Polling interval (don't query too frequently)
     static constexpr uint32_t POLL_INTERVAL_MS = 1000;
     uint32_t _lastPollTime;
+
+    // Last meter reading version handed out by consumeReadingChange()
+    uint32_t _lastSeenVersion = 0;
     
     // Daily energy tracking
     float _dayStartKwh = 0.0f;   // Energy reading at start of current day
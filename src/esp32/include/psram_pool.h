@@ -0,0 +1,120 @@
+#ifndef PSRAM_POOL_H
+#define PSRAM_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/**
+ * Size-class pooled PSRAM allocator
+ *
+ * General replacement for the ad-hoc buffers that grew around JSON
+ * serialization (web_server_broadcast), the cloud send queues
+ * (cloud_connection) and MQTT publishing (mqtt_client). Mixed-size
+ * heap_caps_malloc/free churn fragments PSRAM over multi-week uptimes; the
+ * pool carves fixed-size bins (256B / 1K / 4K / 16K) out of one PSRAM region
+ * per bin at first use and recycles blocks forever, so steady-state traffic
+ * causes no heap churn at all.
+ *
+ * - Thread-safe (mutex), usable from any task.
+ * - allocate() rounds up to the smallest bin that fits; oversize or
+ *   exhausted-bin requests fall back to heap_caps_malloc so exhaustion
+ *   degrades to today's behavior instead of failing the caller.
+ * - Every allocation carries a caller tag (must be a string literal) for
+ *   leak tracking: per-tag live counts are reported via getStats(), so a
+ *   subsystem that stops releasing shows up in diagnostics by name.
+ *   Heap-fallback allocations are counted but not tag-tracked.
+ *
+ * Usage:
+ *   char* buf = (char*)PsramPool::instance().allocate(len, "cloud-tx");
+ *   ...
+ *   PsramPool::instance().release(buf);
+ */
+class PsramPool {
+public:
+    static const size_t BIN_COUNT = 4;
+    static const size_t MAX_TAGS = 12;
+
+    /**
+     * Get singleton instance
+     */
+    static PsramPool& instance();
+
+    /**
+     * Allocate a block of at least `size` bytes
+     * @param size Required size in bytes
+     * @param tag Caller identity for leak tracking (string literal)
+     * @return Pointer to block, or nullptr if even the heap fallback fails
+     *
+     * Note: Block must be returned with release() when done
+     */
+    void* allocate(size_t size, const char* tag);
+
+    /**
+     * Release a block back to its bin (frees heap-fallback pointers)
+     */
+    void release(void* ptr);
+
+    /**
+     * Per-bin and per-tag statistics for diagnostics
+     */
+    struct BinStats {
+        size_t blockSize;
+        size_t totalBlocks;
+        size_t inUse;
+        size_t highWater;    // Worst concurrent usage seen
+        uint32_t allocs;     // Lifetime allocations served from this bin
+        uint32_t exhausted;  // Requests that found the bin full
+    };
+    struct TagStats {
+        const char* tag;     // nullptr past the last registered tag
+        uint32_t live;       // Outstanding (un-released) pool blocks
+        uint32_t total;      // Lifetime pool allocations
+    };
+    struct Stats {
+        BinStats bins[BIN_COUNT];
+        TagStats tags[MAX_TAGS];
+        uint32_t oversize;       // Requests larger than the biggest bin
+        uint32_t heapFallbacks;  // Total requests served by the heap instead
+    };
+    Stats getStats() const;
+
+private:
+    PsramPool();
+    ~PsramPool() = default;
+
+    // Non-copyable
+    PsramPool(const PsramPool&) = delete;
+    PsramPool& operator=(const PsramPool&) = delete;
+
+    // Largest per-bin block count (sizes metadata arrays)
+    static const size_t MAX_BLOCKS = 8;
+
+    struct Bin {
+        size_t blockSize;
+        size_t blockCount;
+        uint8_t* region;              // blockSize * blockCount, PSRAM, lazy
+        bool inUse[MAX_BLOCKS];
+        int8_t tagIdx[MAX_BLOCKS];    // Tag table index per block (-1 = none)
+        size_t used;
+        size_t highWater;
+        uint32_t allocs;
+        uint32_t exhausted;
+    };
+
+    int tagIndexFor(const char* tag);  // Register/look up a tag (call locked)
+    bool ensureRegion(Bin& bin);       // Lazy PSRAM carve-out (call locked)
+
+    Bin _bins[BIN_COUNT];
+    const char* _tags[MAX_TAGS];
+    uint32_t _tagLive[MAX_TAGS];
+    uint32_t _tagTotal[MAX_TAGS];
+    uint32_t _oversize;
+    uint32_t _heapFallbacks;
+    SemaphoreHandle_t _mutex;
+
+    static PsramPool* _instance;
+};
+
+#endif // PSRAM_POOL_H
@@ -0,0 +1,65 @@
+#ifndef PUMP_HEALTH_H
+#define PUMP_HEALTH_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Shots fed into the baseline before drift checking starts. A fresh (or
+// just-serviced) pump needs a settled reference first.
+#define PUMP_HEALTH_BASELINE_SHOTS   20
+
+// Relative drift of the ripple metric from baseline that counts as a
+// degraded shot, and how many consecutive degraded shots raise the
+// notification (one noisy shot - cold pump, choked puck - must not)
+#define PUMP_HEALTH_DRIFT_THRESHOLD  0.35f
+#define PUMP_HEALTH_FLAG_STREAK      5
+
+/**
+ * Pump Health - transient fingerprint trending for predictive maintenance
+ *
+ * A vibratory pump writes its mechanical condition into the raw pressure
+ * transient at shot start: the ripple at the mains drive frequency grows
+ * as the piston spring and valves wear. Each completed burst capture (see
+ * ShotCapture::onTransientFrame) is reduced to two numbers - AC RMS and
+ * the drive-frequency Goertzel magnitude normalized by that RMS - stored
+ * with the shot's BrewRecord and folded into a slow EWMA baseline kept in
+ * NVS. Sustained drift past the threshold raises a PUMP_WEAR reminder
+ * through NotificationManager, a month or more before the pump gives up
+ * mid-shot. Current state is served from GET /api/maintenance/pump.
+ */
+class PumpHealth {
+public:
+    /** Load the persisted baseline. Call during setup. */
+    static void begin();
+
+    /**
+     * Analyze one assembled shot transient (raw ADC counts, pre-filter).
+     * Cheap enough to run inline: two Goertzel passes over <=600 samples.
+     */
+    static void analyzeTransient(const uint16_t* samples, uint16_t count,
+                                 uint16_t rateHz);
+
+    /** Current metrics and baseline for /api/maintenance/pump. */
+    static void toJson(JsonObject obj);
+
+    /** Drop the baseline (call after a pump service/replacement). */
+    static void resetBaseline();
+
+private:
+    static float goertzelMagnitude(const uint16_t* samples, uint16_t count,
+                                   float mean, float binHz, float rateHz);
+    static void persist();
+
+    // Baseline state (NVS-backed)
+    static float _baselineRipple;   // EWMA of the normalized ripple metric
+    static float _baselineRms;      // EWMA of the AC RMS (ADC counts)
+    static uint32_t _shotsAnalyzed;
+
+    // Last shot's metrics (RAM only)
+    static float _lastRipple;
+    static float _lastRms;
+    static float _lastDriveHz;      // 50 or 60, whichever bin dominated
+    static uint8_t _driftStreak;    // Consecutive shots past the threshold
+};
+
+#endif // PUMP_HEALTH_H
@@ -0,0 +1,67 @@
+#ifndef RADIO_RESERVE_H
+#define RADIO_RESERVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Internal-RAM reserve for the radio stacks (WiFi/SSL + NimBLE)
+ *
+ * The radio stacks and SSL need contiguous internal RAM at unpredictable
+ * moments (reconnect, handshake, BLE scan), and they crash rather than
+ * degrade when they can't get it. Our own code is careful to prefer PSRAM,
+ * but over multi-week uptimes the internal heap still erodes and we see the
+ * occasional allocation-failure crash under fragmentation.
+ *
+ * This module grabs a slab of internal RAM at boot - before WiFi or BLE
+ * initialize - and simply holds it. While the slab is held, that much
+ * contiguous internal RAM is guaranteed untouched by everything else. When
+ * free internal RAM outside the slab drops below a panic threshold, the slab
+ * is released so the radio stacks inherit it (logged and counted - a release
+ * means the erosion this exists to absorb actually happened). Once the heap
+ * recovers past a re-arm threshold with room for the slab on top, it is
+ * re-acquired.
+ *
+ * begin() is called early in setup(); loop() is fed from the memory monitor
+ * phase and self-throttles. Watermarks are reported in
+ * /api/protocol/diagnostics under "internal_reserve".
+ */
+
+// Slab size: covers an SSL handshake (~16KB contiguous) plus BLE scan churn
+#define RADIO_RESERVE_SIZE      (24 * 1024)
+// Release the slab when free internal RAM (excluding it) falls below this
+#define RADIO_RESERVE_LOW_WATER 20000
+// Re-acquire once free internal RAM could hold the slab plus the low water
+#define RADIO_RESERVE_REARM     (RADIO_RESERVE_LOW_WATER + RADIO_RESERVE_SIZE + 8192)
+
+class RadioReserve {
+public:
+    /**
+     * Acquire the slab. Call once, early in setup(), before WiFi/BLE init.
+     */
+    static void begin();
+
+    /**
+     * Release/re-arm hysteresis. Call every loop; checks every 2 seconds.
+     */
+    static void loop();
+
+    /**
+     * Reserve state and internal-heap watermarks for diagnostics
+     */
+    struct Stats {
+        size_t reserveSize;      // Configured slab size
+        bool held;               // Slab currently held
+        uint32_t releases;       // Times the slab was handed to the heap
+        size_t freeInternal;     // Current free internal RAM
+        size_t minFreeInternal;  // Lifetime low-water mark (heap_caps)
+        size_t largestBlock;     // Largest free internal block right now
+    };
+    static Stats getStats();
+
+private:
+    static void* _slab;
+    static uint32_t _releases;
+};
+
+#endif // RADIO_RESERVE_H
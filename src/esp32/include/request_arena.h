@@ -0,0 +1,222 @@
+#ifndef REQUEST_ARENA_H
+#define REQUEST_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+/**
+ * Per-request arena allocator for HTTP handlers
+ *
+ * Handlers in web_server.cpp allocate JsonDocuments and serialization
+ * buffers per request and free them on return. Over multi-week uptimes the
+ * malloc/free churn fragments the heap - the same problem PsramPool
+ * solves for broadcasts, extended here to request scope.
+ *
+ * The arena is a fixed PSRAM region with a bump pointer: allocations are a
+ * pointer increment, and the whole region is reset in one move when the
+ * outermost RequestArenaScope leaves the handler. Nothing is ever returned
+ * to the heap, so nothing can fragment it. Allocations that don't fit fall
+ * back to psram_malloc and are freed individually, so exhaustion degrades
+ * to today's behavior instead of failing the request.
+ *
+ * NOT thread-safe by design: all HTTP handlers run on the single AsyncTCP
+ * task, which is the only intended user. Do not use from loop() or other
+ * tasks - use PsramPool there.
+ *
+ * Usage:
+ *   RequestArenaScope arena;             // At the top of the handler
+ *   ArenaJsonDocument doc(2048);         // Document memory from the arena
+ *   char* buf = (char*)RequestArena::instance().alloc(jsonSize);
+ *   ...                                  // No free - scope resets the arena
+ */
+class RequestArena {
+public:
+    static RequestArena& instance();
+
+    /**
+     * Allocate from the arena (8-byte aligned)
+     * @return Pointer valid until the outermost scope resets, or a heap
+     *         fallback pointer (freed automatically by release())
+     */
+    void* alloc(size_t size);
+
+    /**
+     * Grow a previous allocation (used by the JSON allocator)
+     */
+    void* realloc(void* ptr, size_t new_size);
+
+    /**
+     * Return an allocation. No-op for arena pointers; frees heap fallbacks.
+     */
+    void release(void* ptr);
+
+    /**
+     * Reset the bump pointer. Called by the outermost RequestArenaScope -
+     * handlers should not call this directly.
+     */
+    void reset();
+
+    /**
+     * Usage statistics for diagnostics
+     */
+    struct Stats {
+        size_t regionSize;
+        size_t highWater;       // Largest per-request usage seen
+        uint32_t fallbackAllocs; // Requests that spilled to the heap
+    };
+    Stats getStats() const;
+
+private:
+    RequestArena() = default;
+    ~RequestArena() = default;
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    bool ensureRegion();
+    bool ownsPointer(const void* ptr) const;
+
+    // 24KB covers the largest handler (stats/extended builds ~8KB of JSON
+    // plus the serialized copy) with headroom; sized once, lives forever
+    static const size_t REGION_SIZE = 24 * 1024;
+
+    // Each block is prefixed with its size so realloc can copy the old data
+    static const size_t BLOCK_HEADER = 8;  // Keeps 8-byte alignment
+
+    uint8_t* _region = nullptr;
+    size_t _offset = 0;
+    size_t _highWater = 0;
+    uint32_t _fallbackAllocs = 0;
+};
+
+/**
+ * RAII scope that resets the arena when the handler returns.
+ * Nestable: only the outermost scope resets, so helpers that open their own
+ * scope compose with callers that already did.
+ */
+class RequestArenaScope {
+public:
+    RequestArenaScope();
+    ~RequestArenaScope();
+
+    RequestArenaScope(const RequestArenaScope&) = delete;
+    RequestArenaScope& operator=(const RequestArenaScope&) = delete;
+
+private:
+    static int _depth;
+};
+
+/**
+ * Allocator adapter so JsonDocuments can draw from the arena
+ * (same BasicJsonDocument pattern as SpiRamJsonDocument in memory_utils.h)
+ */
+struct RequestArenaAllocator {
+    void* allocate(size_t size) {
+        return RequestArena::instance().alloc(size);
+    }
+    void deallocate(void* ptr) {
+        RequestArena::instance().release(ptr);
+    }
+    void* reallocate(void* ptr, size_t new_size) {
+        return RequestArena::instance().realloc(ptr, new_size);
+    }
+};
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+using ArenaJsonDocument = BasicJsonDocument<RequestArenaAllocator>;
+#pragma GCC diagnostic pop
+
+// =============================================================================
+// Learned document sizing
+// =============================================================================
+
+/**
+ * Endpoints with an arena-backed JsonDocument. Indexes the learned
+ * high-water table - append only, the persisted blob is keyed on the count.
+ */
+enum ArenaDocId : uint8_t {
+    ARENA_DOC_SCHEDULES = 0,   // /api/schedules fragment rebuild
+    ARENA_DOC_LOOP_STATS,      // /api/loop-stats
+    ARENA_DOC_COMMAND_STATS,   // /api/command-stats
+    ARENA_DOC_WATCHDOG,        // /api/diagnostics/watchdog
+    ARENA_DOC_BENCH,           // /api/bench
+    ARENA_DOC_BOOT_REPORT,     // /api/boot-report
+    ARENA_DOC_FLIGHT,          // /api/diagnostics/flight
+    ARENA_DOC_STATS_EXTENDED,  // /api/stats/extended rebuild
+    ARENA_DOC_STATS_POWER,     // /api/stats/power
+    ARENA_DOC_ARCHIVE,         // /api/stats/daily-archive
+    ARENA_DOC_SHOT_TRANSIENT,  // /api/shot/transient
+    ARENA_DOC_PUMP_HEALTH,     // /api/maintenance/pump
+    ARENA_DOC_COUNT
+};
+
+/**
+ * Per-endpoint JsonDocument capacity learning.
+ *
+ * ArduinoJson v6 documents never grow: a capacity guessed too small
+ * silently truncates the response (overflowed()), and one guessed too big
+ * burns arena space and pushes later allocations in the same request to
+ * the heap fallback. DocSizer records the measured memoryUsage() high
+ * water per endpoint, persists the table to NVS, and hands each handler
+ * the learned size plus headroom - so after the first boot every document
+ * is right-sized by evidence instead of guesswork.
+ *
+ * Same threading contract as the arena: AsyncTCP task only.
+ *
+ * Usage:
+ *   ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_X, 2048));
+ *   ...build + serialize...
+ *   DocSizer::instance().note(ARENA_DOC_X, doc);
+ */
+class DocSizer {
+public:
+    static DocSizer& instance();
+
+    /**
+     * Capacity for this endpoint's document: learned high water plus 25%
+     * headroom (rounded up to 256), or `seed` - the old hand-tuned guess -
+     * until a measurement exists.
+     */
+    size_t capacity(ArenaDocId id, size_t seed);
+
+    /**
+     * Record the document's final memoryUsage(). Call after serialization;
+     * raises the learned high water and schedules an NVS save. An
+     * overflowed document doubles the learned size so the next request
+     * gets a usable response.
+     */
+    void note(ArenaDocId id, const JsonDocument& doc);
+
+    /**
+     * Diagnostics: learned high water for one endpoint (0 = not measured)
+     */
+    size_t learned(ArenaDocId id) const;
+
+    /**
+     * Diagnostics: documents that overflowed their capacity since boot
+     */
+    uint32_t overflows() const { return _overflows; }
+
+private:
+    DocSizer() = default;
+    DocSizer(const DocSizer&) = delete;
+    DocSizer& operator=(const DocSizer&) = delete;
+
+    void load();
+    void maybeSave();
+
+    // Ceiling matches the largest endpoint (/api/stats/archive, a year of
+    // daily records); floor keeps tiny endpoints from thrashing relearns
+    static const size_t DOC_CAP_MIN = 512;
+    static const size_t DOC_CAP_MAX = 49152;
+    static const uint32_t SAVE_INTERVAL_MS = 60000;
+
+    uint32_t _highWater[ARENA_DOC_COUNT] = {0};
+    bool _loaded = false;
+    bool _dirty = false;
+    uint32_t _lastSaveMs = 0;
+    uint32_t _overflows = 0;
+};
+
+#endif // REQUEST_ARENA_H
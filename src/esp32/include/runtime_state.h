@@ -37,7 +37,21 @@ public:
      * Safe for concurrent reads without mutex
      */
     const ui_state_t& get() const;
-    
+
+    /**
+     * Copy a consistent snapshot of the state into `out` - thread-safe,
+     * never blocks the writer.
+     *
+     * get() is fine for reading a field or two, but a slow reader holding
+     * the reference (serializing JSON, publishing MQTT) can see the buffer
+     * rewritten under it: after two swaps the active buffer becomes the
+     * writing buffer again, and the update*() helpers patch the active
+     * buffer in place. snapshot() copies the active buffer under a sequence
+     * check and retries if a writer published mid-copy, so the result is
+     * always a coherent single point in time.
+     */
+    void snapshot(ui_state_t& out) const;
+
     /**
      * Begin a state update transaction
      * Takes mutex and returns reference to writing buffer
@@ -95,6 +109,11 @@ private:
     
     // Mutex protects buffer copy/swap operations
     SemaphoreHandle_t _mutex;
+
+    // Seqlock counter for snapshot(): odd while a writer is touching
+    // reader-visible memory, bumped to even when it's done. Writers only
+    // modify it while holding the mutex; readers spin/retry on it.
+    volatile uint32_t _seq = 0;
     
     /**
      * Swap active and writing buffers atomically
@@ -32,12 +32,36 @@ typedef enum {
 typedef struct {
     bool connected;         // Connected to scale
     bool stable;            // Weight reading is stable
-    float weight;           // Weight in grams
-    float flow_rate;        // Calculated flow rate (g/s)
+    float weight;           // Weight in grams (Kalman-smoothed)
+    float flow_rate;        // Estimated flow rate (g/s)
+    float flow_derivative;  // Flow rate change (g/s^2) - for end-of-shot prediction
     int battery_percent;    // Battery level (0-100, -1 if unknown)
     uint32_t last_update_ms;
 } scale_state_t;
 
+// =============================================================================
+// Decoded Weight Sample
+// =============================================================================
+
+// One decoded BLE notification. Produced by the per-model decoder in the
+// NimBLE host task context and handed to ScaleManager through a ring buffer;
+// everything downstream (Kalman filter, weight callbacks) runs on the main
+// loop against this fixed struct, never against the raw packet.
+typedef struct {
+    float weight;           // Grams
+    bool stable;            // Scale-reported stability (true if not reported)
+    uint32_t rx_ms;         // millis() at notification arrival
+} scale_sample_t;
+
+/**
+ * Per-model packet decoder. Pure function: parses one notification into a
+ * sample - no I/O, no allocation, no shared state - so it is safe to run
+ * directly in the NimBLE host task. Resolved once at connect time from the
+ * model dispatch table (no per-notification switch on scale type).
+ * @return true if the notification contained a weight sample
+ */
+typedef bool (*scale_decoder_fn)(const uint8_t* data, size_t length, scale_sample_t* out);
+
 // =============================================================================
 // Scale Info (for discovery)
 // =============================================================================
@@ -49,6 +73,27 @@ typedef struct {
     int rssi;               // Signal strength (dBm)
 } scale_info_t;
 
+// =============================================================================
+// Filter Noise Parameters
+// =============================================================================
+
+typedef struct {
+    float process_noise;      // Acceleration variance for the CV model ((g/s^2)^2)
+    float measurement_noise;  // Weight sample variance (g^2)
+} scale_noise_params_t;
+
+// =============================================================================
+// Preferred Connection Parameters
+// =============================================================================
+
+typedef struct {
+    uint16_t min_interval;  // Connection interval floor (1.25ms units)
+    uint16_t max_interval;  // Connection interval ceiling (1.25ms units)
+    uint16_t latency;       // Slave latency (events the scale may skip)
+    uint16_t timeout;       // Supervision timeout (10ms units)
+    bool bondable;          // Model keeps bonds - pair once, encrypt on reconnect
+} scale_conn_params_t;
+
 // =============================================================================
 // Utility Functions
 // =============================================================================
@@ -65,4 +110,19 @@ scale_type_t detectScaleType(const char* name);
  */
 const char* getScaleTypeName(scale_type_t type);
 
+/**
+ * Kalman filter noise parameters for a scale model.
+ * Resolution and BLE report jitter differ enough between vendors that one
+ * tuning either lags the good scales or chases noise on the cheap ones.
+ */
+scale_noise_params_t getScaleNoiseParams(scale_type_t type);
+
+/**
+ * Preferred BLE connection parameters for a scale model. Enforced by
+ * ScaleManager after every connect - the interval ceiling decides whether
+ * the 10Hz weight stream brew-by-weight assumes can exist at all, and a
+ * bad negotiation otherwise caps it silently.
+ */
+scale_conn_params_t getScaleConnParams(scale_type_t type);
+
 #endif // SCALE_INTERFACE_H
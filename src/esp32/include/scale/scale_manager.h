@@ -21,6 +21,7 @@
 #include <NimBLEDevice.h>
 #include <vector>
 #include "scale_interface.h"
+#include "weight_filter.h"
 
 // =============================================================================
 // Configuration
@@ -28,14 +29,83 @@
 
 #define SCALE_MAX_DISCOVERED     10      // Max scales to track during scan
 #define SCALE_SCAN_DURATION_MS   10000   // Default scan duration
-#define SCALE_RECONNECT_DELAY_MS 5000    // Delay between reconnect attempts
 #define SCALE_WEIGHT_TIMEOUT_MS  3000    // Consider disconnected if no weight update
+#define SCALE_FILTER_PERIOD_MS   100     // Fixed estimator update rate (10Hz)
+
+// Scan duty cycling. BLE and WiFi share the radio; the scan window is the
+// fraction of each interval the controller holds it, and everything WiFi
+// (WebSocket, MQTT, cloud) stalls during that window.
+#define SCALE_SCAN_INTERVAL_MS        100  // Scan interval
+#define SCALE_SCAN_WINDOW_SETUP_MS    60   // Aggressive: shot being set up, find the scale fast
+#define SCALE_SCAN_WINDOW_QUIET_MS    25   // Conservative: machine busy, protect WiFi latency
+
+// Reconnect pacing. A directed connect is cheap next to a scan but still
+// holds the radio for up to the connect timeout, so the cadence follows
+// machine state: probe hard when a shot is plausibly next, stay off the
+// radio during the shot itself, back off exponentially when nobody cares.
+#define SCALE_RECONNECT_ACTIVE_MS     2000   // Heating/ready: fixed fast cadence
+#define SCALE_RECONNECT_DROP_FAST_MS  1500   // Mid-shot drop: single quick retry
+#define SCALE_RECONNECT_IDLE_MS       5000   // Idle/eco: first retry (doubles per attempt)
+#define SCALE_RECONNECT_IDLE_MAX_MS   60000  // Idle/eco: backoff ceiling
+
+// Connection-parameter enforcement: the negotiated interval is verified
+// after the post-connect update settles; anything above the sample budget
+// gets one re-request before the session is counted as slow
+#define SCALE_CONN_CHECK_DELAY_MS     2000   // Settle time before verifying
+#define SCALE_MAX_SAMPLE_PERIOD_MS    100    // 10Hz floor brew-by-weight assumes
+
+// Touch-free auto-tare. A vessel landing on the scale shows up in the
+// Kalman state as a positive weight step that then settles; while the
+// machine is heating/ready (a shot is plausibly next) the tare goes out
+// automatically, so a forgotten manual tare no longer records a garbage
+// shot into the drip predictor's history.
+#define SCALE_AUTOTARE_STEP_G          30.0f  // Min positive step = vessel placed
+#define SCALE_AUTOTARE_SETTLE_FLOW_GS  0.5f   // Flow below this = step has settled
+#define SCALE_AUTOTARE_SETTLE_MS       800    // Settled hold time before taring
+#define SCALE_AUTOTARE_MIN_INTERVAL_MS 5000   // Lockout between automatic tares
 
 // NVS storage keys
 #define NVS_SCALE_NAMESPACE      "scale"
 #define NVS_SCALE_ADDRESS        "address"
 #define NVS_SCALE_TYPE           "type"
 #define NVS_SCALE_NAME           "name"
+#define NVS_SCALE_ADDR_TYPE      "addr_type"  // BLE address type (public/random)
+#define NVS_SCALE_GATT_VAR       "gatt_var"   // Which GATT layout variant worked
+#define NVS_SCALE_AUTO_TARE      "place_tare" // Auto-tare on vessel placement
+
+// =============================================================================
+// Scan Statistics
+// =============================================================================
+
+// WiFi/BLE coexistence counters, surfaced through the scale status endpoint
+// so radio contention is visible instead of guessed at
+struct ScaleScanStats {
+    uint32_t scans;          // Scan sessions started
+    uint32_t totalScanMs;    // Cumulative time spent with the scanner running
+    uint32_t abortedByBrew;  // Scans cut short because a shot started
+    uint16_t lastWindowMs;   // Duty window picked for the most recent scan
+};
+
+// Reconnect state machine counters - how often the link drops unexpectedly
+// and how long recovery takes, surfaced next to the scan stats
+struct ScaleReconnectStats {
+    uint32_t drops;           // Unplanned disconnects (link lost, not disconnect())
+    uint32_t midBrewDrops;    // Subset that happened during a shot
+    uint32_t attempts;        // Directed reconnect attempts issued
+    uint32_t reconnects;      // Attempts that ended with a live link
+    uint32_t lastLatencyMs;   // Drop-to-connected time of the latest recovery
+    uint32_t totalLatencyMs;  // Cumulative recovery time, for averaging
+};
+
+// Connection-parameter negotiation outcomes - whether the link can carry
+// the 10Hz weight stream, and how often peers tried to slow it down
+struct ScaleConnStats {
+    uint16_t intervalUnits;   // Live negotiated connection interval (1.25ms units)
+    uint16_t latency;         // Live negotiated slave latency
+    uint32_t enforcements;    // Post-connect parameter updates issued
+    uint32_t slowSessions;    // Sessions that settled above the sample budget
+    uint32_t peerRejects;     // Peer update requests refused for being too slow
+};
 
 // =============================================================================
 // Scale Manager Class
@@ -91,6 +161,21 @@ public:
      * Clear discovered scales list
      */
     void clearDiscovered() { _discoveredScales.clear(); }
+
+    /**
+     * WiFi/BLE coexistence statistics for diagnostics
+     */
+    ScaleScanStats getScanStats() const { return _scanStats; }
+
+    /**
+     * Drop/recovery statistics for the auto-reconnect state machine
+     */
+    ScaleReconnectStats getReconnectStats() const { return _reconnectStats; }
+
+    /**
+     * Connection-parameter negotiation outcomes for the current session
+     */
+    ScaleConnStats getConnStats() const { return _connStats; }
     
     // =========================================================================
     // Connection
@@ -135,6 +220,19 @@ public:
      * Tare the scale
      */
     void tare();
+
+    /**
+     * Touch-free auto-tare: a vessel-placement classifier on the filter
+     * state tares automatically while the machine is heating/ready.
+     * Persisted to NVS.
+     */
+    bool isAutoTareEnabled() const { return _autoTareEnabled; }
+    void setAutoTare(bool enabled);
+
+    /**
+     * Automatic tares issued since boot (for the status endpoint)
+     */
+    uint32_t getAutoTareCount() const { return _autoTareCount; }
     
     /**
      * Start timer on scale (if supported)
@@ -188,6 +286,11 @@ private:
     scale_type_t _scaleType;
     char _scaleName[32];
     char _scaleAddress[18];
+
+    // Reconnect fast path - cached per device in NVS so a reconnect skips
+    // the GAP name read, type re-detection, and UUID trial-and-error
+    uint8_t _scaleAddrType;  // BLE address type of the saved scale
+    uint8_t _gattVariant;    // 0 = unknown, model-specific meaning otherwise
     
     // Discovered scales
     std::vector<scale_info_t> _discoveredScales;
@@ -196,10 +299,38 @@ private:
     uint32_t _lastWeightTime;
     uint32_t _lastReconnectAttempt;
     bool _autoReconnect;
-    
-    // Flow rate calculation
-    float _lastWeight;
-    uint32_t _lastFlowTime;
+
+    // Reconnect state machine (policy picked per machine state in loop())
+    uint32_t _reconnectDelayMs;   // Current idle backoff, doubled per attempt
+    uint32_t _dropTime;           // millis() of the last unplanned drop (0 = none pending)
+    bool _droppedMidBrew;         // Scale fell off during the shot - one fast retry allowed
+    ScaleReconnectStats _reconnectStats;
+
+    // Connection-parameter enforcement (see verifyConnParams)
+    scale_conn_params_t _connParams;  // Model's preferred parameters, set at connect
+    ScaleConnStats _connStats;
+    uint32_t _connCheckTime;          // When to verify the negotiated interval (0 = idle)
+    bool _connParamRetried;           // One re-request per session
+
+    // Scan duty cycling / coexistence stats
+    ScaleScanStats _scanStats;
+    uint32_t _scanStartTime;
+    
+    // Weight/flow estimator (weight_filter.h) - run at a fixed rate from
+    // loop() so jittery BLE sample timing doesn't feed into the flow estimate
+    float _rawWeight;          // Latest parsed BLE sample (measurement input)
+    bool _haveRawSample;
+    WeightFilter _filter;
+    uint32_t _lastFilterTime;
+    scale_noise_params_t _noise;
+
+    // Vessel-placement auto-tare (classifier state, ticked from updateFilter)
+    bool _autoTareEnabled;
+    float _autoTareBaseline;   // Last settled weight with no vessel pending
+    bool _autoTarePending;     // Step seen, waiting for it to settle
+    uint32_t _autoTareStepTime;
+    uint32_t _lastAutoTareTime;
+    uint32_t _autoTareCount;
     
     // Callbacks
     weight_callback_t _weightCallback;
@@ -213,15 +344,36 @@ private:
     // NimBLE callbacks
     void onConnect(NimBLEClient* client) override;
     void onDisconnect(NimBLEClient* client) override;
+    bool onConnParamsUpdateRequest(NimBLEClient* client, const ble_gap_upd_params* params) override;
     void onResult(NimBLEAdvertisedDevice* device) override;
     
+    // Per-model packet decoder, resolved once from the dispatch table when
+    // characteristics are set up - the notification path never switches on
+    // scale type again
+    scale_decoder_fn _decoder;
+
+    // Decoded-sample ring between the NimBLE host task (producer, in
+    // notifyCallback) and loop() (consumer, in drainSampleRing). Single
+    // producer / single consumer with one writer per index, so plain
+    // volatile indices are enough - no lock in the notification path.
+    // When full the new sample is dropped; the next report supersedes it.
+    static const uint8_t SAMPLE_RING_SIZE = 16;  // Power of two
+    scale_sample_t _sampleRing[SAMPLE_RING_SIZE];
+    volatile uint8_t _sampleHead;  // Written by the NimBLE task only
+    volatile uint8_t _sampleTail;  // Written by loop() only
+
     // Internal methods
     void loadSavedScale();
     void saveScale();
     bool connectToDevice(NimBLEAdvertisedDevice* device);
     bool setupCharacteristics();
-    void processWeightData(const uint8_t* data, size_t length);
-    void updateFlowRate(float weight);
+    void drainSampleRing();
+    void resetFilter();
+    void updateFilter(uint32_t now);
+    void updateAutoTare(uint32_t now);
+    void verifyConnParams(uint32_t now);
+    uint16_t pickScanWindow() const;
+    void scanEnded();
     
     // Scale-specific handlers
     bool setupAcaia();
@@ -231,13 +383,6 @@ private:
     bool setupBookoo();
     bool setupGenericWSS();
     
-    void parseAcaiaWeight(const uint8_t* data, size_t length);
-    void parseFelicitaWeight(const uint8_t* data, size_t length);
-    void parseDecentWeight(const uint8_t* data, size_t length);
-    void parseTimemoreWeight(const uint8_t* data, size_t length);
-    void parseBookooWeight(const uint8_t* data, size_t length);
-    void parseGenericWeight(const uint8_t* data, size_t length);
-    
     void sendAcaiaTare();
     void sendFelicitaTare();
     void sendDecentTare();
@@ -0,0 +1,71 @@
+/**
+ * BrewOS Scale Weight/Flow Filter
+ *
+ * Constant-velocity Kalman filter over raw BLE weight samples. State is
+ * [weight, flow]; the flow derivative is differenced from the already-smooth
+ * flow state. Intended to be ticked at a fixed rate (ScaleManager runs it at
+ * SCALE_FILTER_PERIOD_MS from loop()) so jittery BLE report timing never
+ * feeds into the flow estimate.
+ *
+ * Extracted from ScaleManager so the brew-by-weight replay harness
+ * (simulator, --bbw) exercises the exact estimator that ships on hardware.
+ * Deliberately platform-free: no Arduino, no BLE, no logging.
+ */
+
+#ifndef WEIGHT_FILTER_H
+#define WEIGHT_FILTER_H
+
+#include <stdint.h>
+
+// Innovation beyond this = tare or cup placed/removed - snap the filter to
+// the measurement instead of smearing a step through the flow estimate
+#define WEIGHT_FILTER_JUMP_G  10.0f
+
+class WeightFilter {
+public:
+    WeightFilter();
+
+    /**
+     * Re-arm the filter (new connection, tare). The next update() snaps to
+     * its measurement. now_ms seeds the dt reference.
+     */
+    void reset(uint32_t now_ms);
+
+    /**
+     * Per-model noise parameters (see getScaleNoiseParams). Takes effect at
+     * the next snap/reset.
+     * @param process_noise     Acceleration variance for the CV model ((g/s^2)^2)
+     * @param measurement_noise Weight sample variance (g^2)
+     */
+    void setNoise(float process_noise, float measurement_noise);
+
+    /**
+     * One fixed-rate tick with the latest raw sample. Re-using an unchanged
+     * sample is fine - flow then settles toward 0.
+     * @param raw_weight Latest raw weight sample (grams)
+     * @param now_ms     Tick timestamp (same clock as reset())
+     */
+    void update(float raw_weight, uint32_t now_ms);
+
+    float weight() const { return _weight; }
+
+    // Clamped to [0, 20] g/s - cup lifts read as negative flow, not useful
+    // downstream, and nothing real pours faster than 20 g/s
+    float flow() const { return _flowOut; }
+
+    float flowDerivative() const { return _flowDerivative; }
+
+private:
+    bool _init;
+    float _weight;
+    float _flow;
+    float _flowOut;
+    float _p00, _p01, _p11;  // Covariance (symmetric 2x2)
+    float _prevFlow;
+    float _flowDerivative;
+    float _processNoise;
+    float _measurementNoise;
+    uint32_t _lastTime;
+};
+
+#endif // WEIGHT_FILTER_H
@@ -0,0 +1,103 @@
+#ifndef SHOT_CAPTURE_H
+#define SHOT_CAPTURE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "ui/ui.h"  // ui_state_t
+
+// Fixed sample rate and capture ceiling. 10Hz matches the active-brew status
+// rate from the Pico; 120s covers any defensible shot with margin.
+#define SHOT_CAPTURE_RATE_HZ        10
+#define SHOT_CAPTURE_MAX_SECONDS    120
+#define SHOT_CAPTURE_MAX_SAMPLES    (SHOT_CAPTURE_RATE_HZ * SHOT_CAPTURE_MAX_SECONDS)
+#define SHOT_CAPTURE_CHANNELS       5
+#define SHOT_CAPTURE_FILE           "/shot_capture.bin"
+
+// On-disk header, followed by SHOT_CAPTURE_CHANNELS columnar blocks.
+// Each block is `samples` int16 values: the first is absolute, the rest are
+// deltas from the previous sample - shot channels move slowly, so deltas
+// stay tiny and the format compresses well in transit.
+// Channel order and fixed-point scaling:
+//   0  brew_temp   C * 10
+//   1  steam_temp  C * 10
+//   2  pressure    bar * 100
+//   3  weight      g * 10
+//   4  flow_rate   ml/s * 100
+struct ShotCaptureHeader {
+    uint32_t magic;        // 'S''C''A''P' little-endian (0x50414353)
+    uint8_t version;       // SHOT_CAPTURE_VERSION
+    uint8_t channels;      // SHOT_CAPTURE_CHANNELS
+    uint16_t rate_hz;      // SHOT_CAPTURE_RATE_HZ
+    uint32_t samples;      // Samples per channel
+    uint32_t timestamp;    // Shot start (unix time, 0 if NTP not synced)
+    uint32_t duration_ms;  // Shot duration as seen by the capture
+};
+
+#define SHOT_CAPTURE_MAGIC   0x50414353
+#define SHOT_CAPTURE_VERSION 1
+
+// Pico shot-start transient: raw unfiltered pressure ADC samples captured at
+// the full DMA rate on the Pico (see burst_capture.c) and drained here in
+// MSG_SENSOR_BURST frames after the shot. 600 = 3s at 200Hz.
+#define SHOT_TRANSIENT_MAX_SAMPLES  600
+
+/**
+ * Shot Capture - full-rate columnar telemetry of the current shot
+ *
+ * The summary BrewRecord keeps ~8 numbers per shot; everything else the
+ * machine measured during extraction was thrown away. This records every
+ * status tick (temps, pressure, weight, flow) into a preallocated PSRAM
+ * buffer - a handful of stores per tick, no allocation or flash I/O while
+ * the pump runs - and writes one delta-encoded columnar file after the
+ * shot ends. The last capture is downloadable via GET /api/shot/capture.
+ */
+class ShotCapture {
+public:
+    /**
+     * Drive capture from the main loop. Detects brew start/stop from the
+     * state snapshot, samples at SHOT_CAPTURE_RATE_HZ while brewing, and
+     * flushes to SHOT_CAPTURE_FILE when the shot ends.
+     */
+    static void loop(const ui_state_t& state);
+
+    static bool isCapturing() { return _capturing; }
+
+    /** True once a completed capture file exists (survives reboot). */
+    static bool hasCapture();
+
+    /**
+     * Ingest one MSG_SENSOR_BURST frame from the Pico. Frames of a capture
+     * carry their own position (first_sample), so arrival order and gaps
+     * don't need tracking - a frame 0 resets the assembly.
+     */
+    static void onTransientFrame(const uint8_t* payload, uint16_t length);
+
+    /**
+     * Last assembled transient for GET /api/shot/transient.
+     * @return false if no transient has been received since boot
+     */
+    static bool transientToJson(JsonDocument& doc);
+
+private:
+    static void start(const ui_state_t& state);
+    static void sample(const ui_state_t& state);
+    static void flush();
+    static bool writeChannelDeltas(File& file, uint8_t channel);
+
+    static int16_t* _buffer;       // [channel][sample], PSRAM, lazy-allocated
+    static uint32_t _sampleCount;
+    static uint32_t _lastSampleMs;
+    static uint32_t _startMs;
+    static uint32_t _startTimestamp;
+    static bool _capturing;
+
+    // Pico burst transient assembly (RAM only - a fresh shot overwrites it)
+    static uint16_t _transient[SHOT_TRANSIENT_MAX_SAMPLES];
+    static uint16_t _transientCount;        // Highest sample index seen + 1
+    static uint16_t _transientRateHz;
+    static uint8_t _transientChannel;
+    static uint8_t _transientFramesSeen;
+    static uint8_t _transientTotalFrames;
+};
+
+#endif // SHOT_CAPTURE_H
@@ -0,0 +1,49 @@
+/**
+ * BrewOS Brew-by-Weight Replay Harness
+ *
+ * Dry-runs the shipped stop predictor against recorded shots instead of
+ * espresso. Each trace is replayed through the real WeightFilter and the
+ * real BrewByWeight controller on a virtual clock (as fast as the host
+ * goes); when the predictor signals stop, the harness simulates the valve
+ * path - weight keeps following the trace for the recorded stop latency,
+ * then the recorded drip mass lands - and scores where the cup ends up
+ * against the target. Predictor tuning iterates in seconds, not shots.
+ *
+ * Usage:
+ *   .pio/build/simulator/program --bbw <trace.csv> [<trace.csv> ...]
+ *
+ * The whole library is replayed twice with one controller instance: a cold
+ * pass (predictor on the fixed stop_offset fallback) and a warm pass (drip
+ * mass and latency learned from the cold pass). Budgets apply to the warm
+ * pass; exit code is nonzero when one is blown, so CI can score predictor
+ * changes.
+ *
+ * Trace format - the benchmark capture columns
+ * (t_ms,brew_temp,pressure,flow_rate,weight,brewing), with weight being the
+ * RAW BLE samples (the filter is part of what's under test), plus one
+ * required metadata line:
+ *   # bbw target_g=36.0 drip_g=1.4 latency_ms=280
+ * Traces must be recorded with auto-stop off and pulled well past the
+ * target, so the replay has data wherever the predictor decides to cut.
+ * The library lives in src/simulator/captures/ (bbw_*.csv).
+ */
+
+#ifndef SIMULATOR_BBW_REPLAY_H
+#define SIMULATOR_BBW_REPLAY_H
+
+#include <stdbool.h>
+
+// Parse command line arguments. Returns false on malformed arguments
+// (usage is printed); replay mode stays off when --bbw is absent.
+// Ignores arguments it doesn't own (benchmark parses the same argv).
+bool bbw_replay_parse_args(int argc, char* argv[]);
+
+// True when --bbw was given on the command line
+bool bbw_replay_active(void);
+
+// Replay the trace library and print the accuracy report. Runs headless -
+// call before any SDL/LVGL setup. Returns the process exit code: 0 on
+// pass, 1 when a budget failed or a trace could not be replayed.
+int bbw_replay_run(void);
+
+#endif // SIMULATOR_BBW_REPLAY_H
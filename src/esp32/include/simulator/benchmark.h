@@ -0,0 +1,52 @@
+/**
+ * BrewOS Simulator Benchmark Harness
+ *
+ * Replays a captured shot telemetry stream through the real UI code at a
+ * configurable speed multiplier and measures what the simulator actually
+ * runs: ui.update() cost per telemetry sample and lv_timer_handler() frame
+ * times. Prints an avg/p95/max report and returns a nonzero exit code when
+ * a budget is blown, so CI can catch UI performance regressions before they
+ * reach hardware.
+ *
+ * Usage:
+ *   .pio/build/simulator/program --bench <capture.csv> [--speed N]
+ *
+ * Capture format - one sample per line, header lines start with '#':
+ *   t_ms,brew_temp,pressure,flow_rate,weight,brewing
+ *
+ * A reference capture lives at src/simulator/captures/shot_36g.csv.
+ */
+
+#ifndef SIMULATOR_BENCHMARK_H
+#define SIMULATOR_BENCHMARK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ui/ui.h"
+
+// Parse command line arguments. Returns false on malformed arguments
+// (usage is printed); benchmark mode stays off when --bench is absent.
+bool benchmark_parse_args(int argc, char* argv[]);
+
+// True when --bench was given on the command line
+bool benchmark_active(void);
+
+// Load the capture file. Call once before the main loop when active.
+bool benchmark_init(void);
+
+// Advance the replay: applies every telemetry sample due at the scaled
+// replay clock to `state` and times the resulting ui.update() calls.
+// Returns false once the capture is exhausted.
+bool benchmark_tick(ui_state_t* state);
+
+// Record one lv_timer_handler() duration (no-op when benchmark is off)
+void benchmark_note_frame(uint32_t frame_us);
+
+// Monotonic microsecond clock (also used by main for frame timing)
+uint64_t benchmark_micros(void);
+
+// Print the stats report and evaluate budgets. Returns the process exit
+// code: 0 on pass, 1 when any budget failed.
+int benchmark_report(void);
+
+#endif // SIMULATOR_BENCHMARK_H
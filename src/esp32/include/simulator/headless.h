@@ -0,0 +1,53 @@
+/**
+ * BrewOS Simulator Headless Harness
+ *
+ * Runs the real UI screens, LVGL timers and state handling with no SDL
+ * window and no wall clock: the shared virtual tick source (sim_clock.h)
+ * is advanced in fixed steps, so a scripted scenario executes as fast as
+ * the host allows (typically 100x+) with bit-identical timing on every
+ * run. This is the full-system complement to --bench (frame-time budgets
+ * on a recorded shot) and --bbw (predictor accuracy): CI can drive whole
+ * scenarios - screen flows, brewing sequences, encoder input - without a
+ * display server.
+ *
+ * Usage:
+ *   .pio/build/simulator/program --headless <script.txt>
+ *
+ * Script format - one event per line, '#' starts a comment:
+ *   <t_ms> <event> [arg]
+ *
+ * Events:
+ *   state <idle|heating|ready|brewing|fault|safe|eco>
+ *   brew <0|1>            is_brewing flag
+ *   temp <c>              brew boiler temperature
+ *   steam <c>             steam boiler temperature
+ *   pressure <bar>
+ *   weight <g>            brew weight
+ *   flow <g/s>
+ *   screen <name>         setup|idle|home|brewing|complete|settings|
+ *                         temp|scale|cloud|alarm|ota|splash
+ *   rotate <n>            encoder detents (negative = CCW)
+ *   press / release       encoder button
+ *   longpress             back gesture (calls the long-press handler)
+ *   end                   stop the run at this timestamp
+ */
+
+#ifndef SIMULATOR_HEADLESS_H
+#define SIMULATOR_HEADLESS_H
+
+#include <stdbool.h>
+
+// Parse command line arguments. Returns false on malformed arguments
+// (usage is printed); headless mode stays off when --headless is absent.
+// Ignores arguments it doesn't own.
+bool headless_parse_args(int argc, char* argv[]);
+
+// True when --headless was given on the command line
+bool headless_active(void);
+
+// Load the script and run the scenario on the virtual clock. Call before
+// any SDL setup - this does its own LVGL init with a null display driver.
+// Returns the process exit code: 0 on completion, 1 on a script error.
+int headless_run(void);
+
+#endif // SIMULATOR_HEADLESS_H
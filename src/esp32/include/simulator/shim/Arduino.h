@@ -0,0 +1,30 @@
+/**
+ * Arduino shim for the native simulator build.
+ *
+ * Just enough surface for firmware modules the simulator compiles as-is
+ * (currently brew_by_weight.cpp). This directory is added to the include
+ * path only in the simulator environment; the real core is untouched on
+ * hardware builds.
+ */
+
+#ifndef SIMULATOR_SHIM_ARDUINO_H
+#define SIMULATOR_SHIM_ARDUINO_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// Pulling in the platform layer here means config.h (which firmware modules
+// include after Arduino.h) sees PLATFORM_H and takes its native-safe branch
+#include "platform/platform.h"
+
+// Same macro form as the Arduino core
+#define constrain(amt, low, high) \
+    ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Shared simulator clock (sim_clock.cpp). Wall time normally; when a
+// replay/headless harness enables virtual mode, anything in firmware code
+// that measures time with millis() sees scripted time, not wall time.
+uint32_t millis(void);
+
+#endif // SIMULATOR_SHIM_ARDUINO_H
@@ -0,0 +1,32 @@
+/**
+ * Preferences (NVS) shim for the native simulator build.
+ *
+ * All reads report "not found" so modules come up with their compiled-in
+ * defaults, and writes are swallowed - a replay run never persists state
+ * between invocations.
+ */
+
+#ifndef SIMULATOR_SHIM_PREFERENCES_H
+#define SIMULATOR_SHIM_PREFERENCES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Preferences {
+public:
+    bool begin(const char*, bool readOnly = false) { (void)readOnly; return false; }
+    void end() {}
+
+    float getFloat(const char*, float def = 0.0f) { return def; }
+    bool getBool(const char*, bool def = false) { return def; }
+    uint8_t getUChar(const char*, uint8_t def = 0) { return def; }
+    size_t getBytesLength(const char*) { return 0; }
+    size_t getBytes(const char*, void*, size_t) { return 0; }
+
+    size_t putFloat(const char*, float) { return 0; }
+    size_t putBool(const char*, bool) { return 0; }
+    size_t putUChar(const char*, uint8_t) { return 0; }
+    size_t putBytes(const char*, const void*, size_t) { return 0; }
+};
+
+#endif // SIMULATOR_SHIM_PREFERENCES_H
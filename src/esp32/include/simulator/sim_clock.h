@@ -0,0 +1,48 @@
+/**
+ * BrewOS Simulator Virtual Clock
+ *
+ * Shared tick source for the native build. Normally it passes the wall
+ * clock through, but once a harness enables virtual mode every consumer of
+ * time - the Arduino millis() shim, platform_millis(), and LVGL's tick -
+ * sees the same scripted clock. A run then executes as fast as the host
+ * allows while every timer, animation and state machine observes real
+ * timing, and two runs of the same script produce identical traces.
+ *
+ * The brew-by-weight replay (--bbw) and the headless harness (--headless)
+ * both drive this clock; they are mutually exclusive per process, so a
+ * single owner advancing time is guaranteed.
+ */
+
+#ifndef SIMULATOR_SIM_CLOCK_H
+#define SIMULATOR_SIM_CLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Switch from wall clock to the virtual clock (starts at 0). One-way -
+// harnesses own the whole process lifetime once they start.
+void sim_clock_enable(void);
+
+// True once sim_clock_enable() was called
+bool sim_clock_active(void);
+
+// Advance the virtual clock (no-op in wall mode)
+void sim_clock_advance(uint32_t ms);
+
+// Jump the virtual clock to an absolute time. Replay harnesses track
+// capture timestamps directly and rewind to 0 between traces; everything
+// they drive is reset alongside the clock.
+void sim_clock_set(uint32_t ms);
+
+// Current time: virtual when enabled, CLOCK_MONOTONIC wall time otherwise
+uint32_t sim_clock_millis(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIMULATOR_SIM_CLOCK_H
@@ -0,0 +1,61 @@
+#ifndef SOFT_WATCHDOG_H
+#define SOFT_WATCHDOG_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define SOFT_WATCHDOG_MAX_ENTRIES 12
+
+/**
+ * Soft Watchdog - per-subsystem heartbeat gap tracking
+ *
+ * The hardware/task watchdogs and the panic handler only see a system that
+ * stopped; slow-downs go unmeasured. Each registered subsystem loop calls
+ * beat() once per pass, and the monitor records the worst-observed gap
+ * between beats. A gap past the subsystem's SLO is counted and logged
+ * (through the normal LOG_W path, so it lands in LogManager and the log
+ * buffer) together with which tasks were runnable at that moment - turning
+ * "the UI felt laggy yesterday" into a named subsystem, a worst-case
+ * number, and the co-occurring task states.
+ *
+ * beat() is cheap (a timestamp compare) and safe from any task, as long as
+ * each entry is beaten by exactly one subsystem. The table is exposed at
+ * /api/diagnostics/watchdog.
+ */
+class SoftWatchdog {
+public:
+    /**
+     * Register a subsystem. Call during setup.
+     * @param name     Static string for the table/logs
+     * @param sloGapMs Largest acceptable gap between beats
+     * @return Entry id for beat(), or -1 if the table is full
+     */
+    static int8_t add(const char* name, uint32_t sloGapMs);
+
+    /** Report a heartbeat (call once per subsystem loop pass). */
+    static void beat(int8_t id);
+
+    /** Per-subsystem table for /api/diagnostics/watchdog. */
+    static void toJson(JsonArray& arr);
+
+    /** Reset gap/violation stats (keeps registrations). */
+    static void resetStats();
+
+private:
+    struct Entry {
+        const char* name;
+        uint32_t sloGapMs;
+        uint32_t lastBeatMs;    // 0 = no beat yet
+        uint32_t maxGapMs;
+        uint32_t maxGapAtMs;    // millis() when the worst gap was observed
+        uint32_t violations;
+        uint32_t lastLogMs;     // Violation log rate limit
+    };
+
+    static void logViolation(Entry& entry, uint32_t gapMs);
+
+    static Entry _entries[SOFT_WATCHDOG_MAX_ENTRIES];
+    static uint8_t _count;
+};
+
+#endif // SOFT_WATCHDOG_H
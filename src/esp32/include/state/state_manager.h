@@ -34,8 +34,11 @@ public:
     
     // Save all settings to NVS
     void saveSettings();
-    
-    // Save specific settings section
+
+    // Save specific settings section.
+    // Write-behind: these stage the section in a dirty mask and return
+    // immediately; loop() commits the batch to NVS after a short debounce.
+    // Callers in the request path never block on a flash commit.
     void saveTemperatureSettings();
     void saveBrewSettings();
     void savePowerSettings();
@@ -50,7 +53,19 @@ public:
     void saveNotificationSettings();
     void saveSystemSettings();
     void saveUserPreferences();
-    
+
+    // Commit any staged settings writes synchronously. Call before
+    // restarts/shutdown so a pending debounce window isn't lost.
+    void flushNow();
+
+    // Settings transaction. Wrap a burst of save*Settings() calls in
+    // beginSettingsUpdate()/commitSettingsUpdate() and the SettingsCallback
+    // fires once at commit instead of once per section; the staged NVS
+    // writes already coalesce into one batch via the write-behind queue.
+    // Nestable - only the outermost commit notifies.
+    void beginSettingsUpdate();
+    void commitSettingsUpdate();
+
     // Reset settings to defaults
     void resetSettings();
     void factoryReset();  // Reset everything including stats
@@ -114,6 +129,7 @@ public:
     // Shot tracking
     void startShot();
     void endShot();
+    void recordStopLatency(uint16_t sampleAgeMs, uint16_t gpioMs, uint16_t chainMs);
     bool isShotActive() const { return _state.shotActive; }
     uint32_t getShotDuration() const;
     
@@ -135,7 +151,18 @@ public:
     // Schedule callbacks (for triggering actions) - using function pointers to avoid PSRAM issues
     typedef void (*ScheduleCallback)(const ScheduleEntry&);
     void onScheduleTriggered(ScheduleCallback callback);
-    
+
+    // Fired after any schedule edit - used to re-push the compiled wake
+    // table to the Pico (see buildWakeSchedulePayload)
+    typedef void (*SchedulesChangedCallback)();
+    void onSchedulesChanged(SchedulesChangedCallback callback);
+
+    // Compile enabled turn-on schedules into a MSG_CMD_SET_WAKE_SCHEDULE
+    // payload (includes the current minute-of-week as the Pico's clock
+    // reference). Returns the payload length, or 0 when the wall clock
+    // is not usable yet.
+    size_t buildWakeSchedulePayload(uint8_t* payload, size_t maxLen);
+
     // Check schedules (called from loop)
     void checkSchedules();
     
@@ -157,6 +184,10 @@ public:
     void onStatsChanged(StatsCallback callback);
     void onStateChanged(StateCallback callback);
     void onShotCompleted(ShotCallback callback);
+
+    // Monotonic counter bumped whenever settings change (any save*Settings).
+    // Lets read-only REST handlers serve a cached response until it moves.
+    uint32_t settingsGeneration() const { return _settingsGeneration; }
     
     // ==========================================================================
     // SERIALIZATION
@@ -198,6 +229,9 @@ private:
     float _shotTempSum = 0;
     uint32_t _shotTempCount = 0;
     
+    // Change generation (see settingsGeneration())
+    uint32_t _settingsGeneration = 1;
+
     // Callbacks
     SettingsCallback _onSettingsChanged;
     StatsCallback _onStatsChanged;
@@ -210,6 +244,7 @@ private:
     uint32_t _lastScheduleCheck = 0;
     uint32_t _lastActivityTime = 0;
     uint8_t _lastScheduleMinute = 255;  // Track last minute to avoid duplicate triggers
+    time_t _nextScheduleEpoch = 0;      // Next-deadline cache (0 = none/not computed)
     static constexpr uint32_t STATS_SAVE_INTERVAL = 300000;  // 5 minutes
     static constexpr uint32_t SCHEDULE_CHECK_INTERVAL = 10000;  // 10 seconds
     
@@ -221,13 +256,63 @@ private:
     
     // Schedule callback
     ScheduleCallback _onScheduleTriggered;
+    SchedulesChangedCallback _onSchedulesChanged = nullptr;
     
     // Persistence
     void loadSettings();
+    bool loadSettingsBlob(Preferences& prefs);  // One-read fast path (see .cpp)
+    void writeSettingsBlob();
+    void syncMachineTypeFromString();
     void loadStats();
     void loadShotHistory();
     bool saveShotHistory();  // Returns true on success, false on failure
     void loadScheduleSettings();
+    void recomputeNextSchedule();  // Rebuild the next-deadline cache (see .cpp)
+    void evaluateSchedules(time_t currentTime);  // Full table scan, runs when the deadline fires
+
+    // Write-behind NVS queue (see flushNow()). save*Settings() set a bit,
+    // loop() commits the batch once the debounce window closes.
+    enum SettingsSection : uint16_t {
+        SECTION_TEMPERATURE   = 1 << 0,
+        SECTION_BREW          = 1 << 1,
+        SECTION_POWER         = 1 << 2,
+        SECTION_NETWORK       = 1 << 3,
+        SECTION_TIME          = 1 << 4,
+        SECTION_MQTT          = 1 << 5,
+        SECTION_CLOUD         = 1 << 6,
+        SECTION_SCALE         = 1 << 7,
+        SECTION_DISPLAY       = 1 << 8,
+        SECTION_SCHEDULE      = 1 << 9,
+        SECTION_MACHINE_INFO  = 1 << 10,
+        SECTION_NOTIFICATIONS = 1 << 11,
+        SECTION_SYSTEM        = 1 << 12,
+        SECTION_PREFERENCES   = 1 << 13,
+    };
+    void markDirty(uint16_t section);
+    void flushDirtySections();
+    uint16_t _dirtySections = 0;
+    uint32_t _lastDirtyMark = 0;
+    static constexpr uint32_t SETTINGS_FLUSH_DELAY = 1000;  // Debounce window (ms)
+
+    // Settings transaction state (see beginSettingsUpdate())
+    uint8_t _settingsTxnDepth = 0;
+    bool _settingsTxnNotifyPending = false;
+
+    // Actual NVS/LittleFS writers, called from loop()/flushNow() only
+    void writeTemperatureSettings();
+    void writeBrewSettings();
+    void writePowerSettings();
+    void writeNetworkSettings();
+    void writeTimeSettings();
+    void writeMQTTSettings();
+    void writeCloudSettings();
+    void writeScaleSettings();
+    void writeDisplaySettings();
+    void writeScheduleSettings();
+    void writeMachineInfoSettings();
+    void writeNotificationSettings();
+    void writeSystemSettings();
+    void writeUserPreferences();
     
     // Helpers
     void notifySettingsChanged();
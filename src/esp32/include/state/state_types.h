@@ -73,7 +73,9 @@ struct NetworkSettings {
     bool wifiConfigured = false;
     
     char hostname[32] = "brewos";
-    
+
+    bool fleetEnabled = false;         // Advertise/discover peers for /api/fleet
+
     void toJson(JsonObject& obj) const;
     bool fromJson(JsonObjectConst obj);
 };
@@ -331,7 +333,12 @@ struct ShotRecord {
     float peakPressure = 0.0f;         // Max pressure (bar)
     float avgTemperature = 0.0f;       // Avg brew temp
     uint8_t rating = 0;                // User rating 0-5
-    
+
+    // Weight-stop latency budget (all zero if shot wasn't auto-stopped)
+    uint16_t stopSampleAgeMs = 0;      // Age of decisive scale sample at stop decision
+    uint16_t stopGpioMs = 0;           // Stop decision -> WEIGHT_STOP GPIO asserted
+    uint16_t stopChainMs = 0;          // Stop decision -> Pico brew-end observed
+
     void toJson(JsonObject& obj) const;
     bool fromJson(JsonObjectConst obj);
     
@@ -356,7 +363,7 @@ struct ShotHistory {
     // Format: [magic:4][version:1][count:1][records:count*sizeof(ShotRecord)]
     // Magic: "SHOT" (0x53484F54)
     static constexpr uint32_t BINARY_MAGIC = 0x53484F54;  // "SHOT"
-    static constexpr uint8_t BINARY_VERSION = 1;
+    static constexpr uint8_t BINARY_VERSION = 2;  // v2: stop latency fields added
     size_t toBinary(uint8_t* buffer, size_t bufferSize) const;  // Returns bytes written, 0 on error
     bool fromBinary(const uint8_t* buffer, size_t bufferSize);   // Returns true on success
 };
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <esp_timer.h>
 #include <functional>
 
 namespace BrewOS {
@@ -10,12 +11,16 @@ namespace BrewOS {
 // CONFIGURATION
 // =============================================================================
 
-constexpr size_t STATS_MAX_BREW_HISTORY = 200;       // Max brew records to store
+constexpr size_t STATS_MAX_BREW_HISTORY = 500;       // Max brew records (PSRAM-backed, see begin())
 constexpr size_t STATS_MAX_POWER_SAMPLES = 288;      // 5-min intervals for 24 hours
+constexpr size_t STATS_MAX_HOURLY_SAMPLES = 168;     // 1-hour power aggregates for 7 days
+constexpr size_t STATS_MAX_DAILY_SAMPLES = 90;       // 1-day power aggregates for 90 days
 constexpr size_t STATS_MAX_DAILY_HISTORY = 30;       // 30 days of daily summaries
 constexpr uint32_t STATS_MIN_BREW_TIME_MS = 10000;   // 10 seconds minimum (filters out flushing)
 constexpr uint32_t STATS_MAX_BREW_TIME_MS = 40000;   // 40 seconds maximum (filters out cleaning)
 constexpr uint32_t STATS_POWER_SAMPLE_INTERVAL = 300000;  // 5 minutes
+constexpr uint32_t STATS_POWER_TICK_MS = 1000;       // Fixed energy integration interval
+constexpr size_t STATS_POWER_TICK_RING = 32;         // Tick backlog if loop() stalls (~32s)
 
 // =============================================================================
 // DATA STRUCTURES
@@ -33,7 +38,10 @@ struct BrewRecord {
     float avgTemperature = 0.0f;      // Average brew temperature
     float avgFlowRate = 0.0f;         // Average flow rate (g/s)
     uint8_t rating = 0;               // User rating (0-5, 0=unrated)
-    
+    // Pump transient fingerprint (see pump_health.cpp; 0 = not analyzed)
+    float pumpRmsCounts = 0.0f;       // AC RMS of the raw pressure transient (ADC counts)
+    float pumpRippleNorm = 0.0f;      // Pump-fundamental Goertzel magnitude / AC RMS
+
     void toJson(JsonObject& obj) const;
     bool fromJson(JsonObjectConst obj);
     float ratio() const { return doseWeight > 0 ? yieldWeight / doseWeight : 0; }
@@ -63,11 +71,50 @@ struct DailySummary {
     uint16_t onTimeMinutes = 0;       // Minutes machine was on
     uint8_t steamCycles = 0;          // Steam cycle count
     float avgBrewTimeMs = 0.0f;       // Average brew time
+    float minBrewTimeMs = 0.0f;       // Fastest shot that day (0 = none)
+    float maxBrewTimeMs = 0.0f;       // Slowest shot that day
     
     void toJson(JsonObject& obj) const;
     bool fromJson(JsonObjectConst obj);
 };
 
+/**
+ * Packed daily archive record - the on-flash layout of the append-only
+ * archive file. One fixed-size record per calendar day, so a year of
+ * history is ~11KB and a record's file offset is a direct function of its
+ * date: no rewrite on append, no scan on query. Days the machine never
+ * ran are zero-filled gap records (hasData = 0) to keep the offset math
+ * exact.
+ */
+struct __attribute__((packed)) DailyArchiveRecord {
+    uint32_t date = 0;            // Unix timestamp at local midnight
+    uint16_t shotCount = 0;
+    uint16_t onTimeMinutes = 0;
+    uint32_t totalBrewTimeMs = 0;
+    float totalKwh = 0.0f;
+    float avgBrewTimeMs = 0.0f;
+    float minBrewTimeMs = 0.0f;
+    float maxBrewTimeMs = 0.0f;
+    uint8_t steamCycles = 0;
+    uint8_t hasData = 0;          // 0 = gap filler (no activity that day)
+    uint16_t reserved = 0;
+};
+static_assert(sizeof(DailyArchiveRecord) == 32, "DailyArchiveRecord is an on-flash format");
+
+/**
+ * Archive file header. recordSize is checked on open so a future layout
+ * change can't silently misparse years of accumulated records.
+ */
+struct __attribute__((packed)) DailyArchiveHeader {
+    uint32_t magic = 0;           // STATS_DAILY_ARCHIVE_MAGIC
+    uint16_t version = 0;         // STATS_DAILY_ARCHIVE_VERSION
+    uint16_t recordSize = 0;      // sizeof(DailyArchiveRecord)
+    uint32_t epochDate = 0;       // Midnight of the first archived day
+};
+
+constexpr uint32_t STATS_DAILY_ARCHIVE_MAGIC = 0x43524144;  // "DARC"
+constexpr uint16_t STATS_DAILY_ARCHIVE_VERSION = 1;
+
 /**
  * Time-period statistics (calculated from history)
  */
@@ -177,13 +224,27 @@ public:
      * @param rating 1-5 stars
      */
     bool rateBrew(uint8_t index, uint8_t rating);
-    
+
+    /**
+     * Attach pump transient metrics to the most recent brew record
+     *
+     * The raw burst capture drains from the Pico after the shot, so the
+     * fingerprint arrives a moment after recordBrew(); this patches it in
+     * (only while the record is fresh - a stale arrival is dropped).
+     * @param rmsCounts AC RMS of the raw pressure transient (ADC counts)
+     * @param rippleNorm Pump-fundamental magnitude normalized by AC RMS
+     */
+    bool attachPumpMetrics(float rmsCounts, float rippleNorm);
+
     // ==========================================================================
     // POWER TRACKING
     // ==========================================================================
     
     /**
-     * Update current power reading (call frequently from status updates)
+     * Update current power reading (call frequently from status updates).
+     * Only stores the latest value - energy integration happens on a
+     * fixed-interval timer tick, so kWh accuracy does not depend on how
+     * often (or how jittery) this is called.
      * @param watts Current power draw
      * @param isOn Whether machine is powered on
      */
@@ -197,7 +258,46 @@ public:
      * Get complete statistics package
      */
     void getFullStatistics(FullStatistics& stats) const;
-    
+
+    /**
+     * Serialize the full statistics package (the /api/stats payload).
+     *
+     * Lifetime and maintenance only change on explicit events (shots,
+     * maintenance records, kWh accumulation), so their serialized
+     * fragments are cached and invalidated by section dirty bits; only
+     * the cheap O(1) period folds are serialized fresh. In the common
+     * case the response is assembled by concatenating cached fragments
+     * instead of a full JSON rebuild.
+     * @param out       Receives the serialized JSON object
+     * @param hydrating Adds "hydrating": true (see isHydrated())
+     */
+    void fullStatsJson(String& out, bool hydrating) const;
+
+    /**
+     * Monotonic counter bumped whenever recorded data changes.
+     * REST handlers key cached responses on it to skip rebuilding JSON.
+     */
+    uint32_t generation() const { return _generation; }
+
+    /**
+     * History hydration state. begin() only loads the tiny lifetime
+     * counters; the brew/power/daily history files hydrate from loop()
+     * shortly after boot or when a query asks for them. REST handlers
+     * report "hydrating": true until this returns true.
+     */
+    bool isHydrated() const { return _hydrated; }
+
+    /**
+     * Ask for hydration on the next loop() pass. Safe to call from the
+     * async_tcp task - the actual file I/O happens on the main task.
+     */
+    void requestHydration() { _hydrateRequested = true; }
+
+    /**
+     * Hydrate now if not already done (main task only - does file I/O)
+     */
+    void ensureHydrated();
+
     /**
      * Get lifetime statistics
      */
@@ -220,16 +320,68 @@ public:
      * @param maxEntries Maximum entries to return
      */
     void getBrewHistory(JsonArray& arr, size_t maxEntries = 50) const;
-    
+
+    /**
+     * Number of brew records currently stored
+     */
+    size_t getBrewHistoryCount() const { return _brewHistoryCount; }
+
     /**
-     * Get power samples for chart (last 24 hours)
+     * Get a single brew record for paged/chunked readers
+     * @param index 0 = most recent, 1 = previous, etc.
+     * @return false if index is out of range
      */
-    void getPowerHistory(JsonArray& arr) const;
+    bool getBrewRecord(size_t index, BrewRecord& record) const;
+
+    /**
+     * Number of raw power samples currently stored
+     */
+    size_t getPowerSampleCount() const { return _powerSamplesCount; }
+
+    /**
+     * Get a single raw power sample for paged/chunked readers
+     * @param index 0 = most recent, 1 = previous, etc.
+     * @return false if index is out of range
+     */
+    bool getPowerSample(size_t index, PowerSample& sample) const;
+
+    /**
+     * Total records in the daily archive file (including gap days)
+     */
+    uint32_t getDailyArchiveCount() const;
+
+    /**
+     * Batched read from the daily archive for chunked readers: fills out[]
+     * with up to maxRecords starting at startIndex (0 = oldest). One file
+     * open per call, so callers should read a page at a time.
+     * @return Number of records read
+     */
+    size_t readDailyArchive(uint32_t startIndex, DailyArchiveRecord* out,
+                            size_t maxRecords) const;
+
+    /**
+     * Get power samples for chart, downsampled to the requested span.
+     * Picks the pyramid level that covers the span with the fewest entries:
+     * raw 5-min samples up to 24h, hourly aggregates up to 7 days, daily
+     * aggregates beyond that. Entries older than the span are skipped.
+     * @param spanHours Requested chart span in hours (default 24)
+     */
+    void getPowerHistory(JsonArray& arr, uint32_t spanHours = 24) const;
     
     /**
      * Get daily summaries for trend chart (last 30 days)
      */
     void getDailyHistory(JsonArray& arr) const;
+
+    /**
+     * Read a date range from the append-only daily archive (multi-year
+     * retention, unlike the 30-day RAM ring). startDate/endDate are unix
+     * midnights, inclusive; gap days without activity are skipped. Reads
+     * seek straight to the start offset, so cost is O(days in range)
+     * regardless of archive size.
+     * @return Number of records added to arr
+     */
+    size_t getDailyArchiveRange(uint32_t startDate, uint32_t endDate, JsonArray& arr) const;
     
     /**
      * Get weekly data for chart
@@ -291,29 +443,69 @@ private:
     LifetimeStats _lifetime;
     MaintenanceStats _maintenance;
     
-    // Brew history (circular buffer)
-    BrewRecord _brewHistory[STATS_MAX_BREW_HISTORY];
+    // Brew history (circular buffer, allocated in PSRAM by begin() - at 500
+    // entries it's too large to keep in the singleton's internal RAM)
+    BrewRecord* _brewHistory = nullptr;
     uint16_t _brewHistoryHead = 0;
     uint16_t _brewHistoryCount = 0;
+
+    // Records currently in the binary ring file (the file may hold up to
+    // twice the RAM ring before compaction rewrites it - see
+    // appendBrewRecordToFlash())
+    uint16_t _brewFileRecords = 0;
     
     // Power samples (circular buffer for 24 hours)
     PowerSample _powerSamples[STATS_MAX_POWER_SAMPLES];
     uint16_t _powerSamplesHead = 0;
     uint16_t _powerSamplesCount = 0;
+
+    // Downsampling pyramid above the raw ring: hourly and daily aggregates,
+    // folded incrementally as raw samples close (see foldIntoPowerPyramid())
+    PowerSample _hourlySamples[STATS_MAX_HOURLY_SAMPLES];
+    uint16_t _hourlySamplesHead = 0;
+    uint16_t _hourlySamplesCount = 0;
+    PowerSample _dailySamples[STATS_MAX_DAILY_SAMPLES];
+    uint8_t _dailySamplesHead = 0;
+    uint8_t _dailySamplesCount = 0;
+
+    // Open aggregation bucket for one pyramid level
+    struct PowerBucket {
+        uint32_t start = 0;        // Bucket start timestamp (0 = empty)
+        float wattSum = 0.0f;      // Sum of sample averages
+        float maxWatts = 0.0f;
+        float kwh = 0.0f;
+        uint16_t samples = 0;
+    };
+    PowerBucket _hourBucket;
+    PowerBucket _dayBucket;
     
     // Daily summaries (circular buffer for 30 days)
     DailySummary _dailySummaries[STATS_MAX_DAILY_HISTORY];
     uint8_t _dailySummariesHead = 0;
     uint8_t _dailySummariesCount = 0;
     
-    // Current power tracking
-    float _currentWatts = 0.0f;
+    // Current power tracking. _currentWatts/_machineIsOn are written on the
+    // main task and read from the esp_timer task - 32-bit aligned stores,
+    // no locking needed
+    volatile float _currentWatts = 0.0f;
     float _powerSampleSum = 0.0f;
     float _powerSampleMax = 0.0f;
     uint32_t _powerSampleCount = 0;
     uint32_t _lastPowerSampleTime = 0;
     uint32_t _machineOnStartTime = 0;
-    bool _machineIsOn = false;
+    volatile bool _machineIsOn = false;
+
+    // Fixed-interval power tick ring. Single producer (esp_timer task,
+    // powerTimerCallback) / single consumer (loop() on the main task):
+    // the producer writes the slot first and advances _powerTickHead after,
+    // so no lock is needed. Each entry is exactly STATS_POWER_TICK_MS of
+    // integration time regardless of main-loop load.
+    static void powerTimerCallback(void* arg);
+    volatile float _powerTicks[STATS_POWER_TICK_RING] = {};
+    volatile uint16_t _powerTickHead = 0;
+    volatile uint16_t _powerTickTail = 0;
+    uint32_t _powerTickOverruns = 0;
+    esp_timer_handle_t _powerTimer = nullptr;
     
     // Session tracking
     uint16_t _sessionShots = 0;
@@ -325,30 +517,53 @@ private:
     // Persistence timing
     uint32_t _lastSaveTime = 0;
     bool _dirty = false;
+    uint32_t _generation = 1;  // Bumped alongside _dirty (see generation())
     static constexpr uint32_t SAVE_INTERVAL = 300000;  // 5 minutes
     
-    // Cached period statistics (recalculated only when data changes)
-    mutable PeriodStats _cachedDailyStats;
-    mutable PeriodStats _cachedWeeklyStats;
-    mutable PeriodStats _cachedMonthlyStats;
-    mutable uint32_t _cachedDailyTimestamp = 0;
-    mutable uint32_t _cachedWeeklyTimestamp = 0;
-    mutable uint32_t _cachedMonthlyTimestamp = 0;
-    mutable uint32_t _cachedDailyDay = 0;  // Day of year when cached
-    mutable bool _statsCacheInvalid = true;  // Invalidate cache when data changes (mutable for const functions)
+    // Incrementally-maintained accumulator for the current calendar day.
+    // Updated at record time (recordBrew / addPowerSample); checkDayChange()
+    // folds it into the daily summary ring at midnight and resets it.
+    // Weekly/monthly queries fold this plus the last N daily summaries, so
+    // no stats query ever iterates the raw brew/power history.
+    PeriodStats _todayStats;
     
     // Callback
     StatsCallback _onStatsChanged;
     
+    // Serialized fragment caches for fullStatsJson(). Rebuilt lazily on
+    // read when the matching dirty bit is set (mutation sites set the bit
+    // for the section they touch).
+    mutable String _fragLifetime;
+    mutable String _fragMaintenance;
+    mutable bool _fragLifetimeDirty = true;
+    mutable bool _fragMaintenanceDirty = true;
+
+    // Lazy history hydration (see ensureHydrated())
+    bool _hydrated = false;
+    volatile bool _hydrateRequested = false;
+    uint32_t _beginTime = 0;
+    static constexpr uint32_t HYDRATE_DELAY = 2000;  // ms after begin()
+
     // Helper methods
-    void loadFromFlash();
+    const String& lifetimeFragment() const;
+    const String& maintenanceFragment() const;
+    void loadLifetimeFromFlash();
+    void hydrateHistories();
     void saveToFlash();
     void saveDailySummary();
     void checkDayChange();
     void addBrewRecord(const BrewRecord& record);
+    bool loadBrewHistoryBinary();
+    void migrateBrewHistoryJson();
+    bool appendBrewRecordToFlash(const BrewRecord& record);
+    bool updateBrewRecordInFlash(size_t fileIndex, const BrewRecord& record);
+    void compactBrewHistoryFile();
     void addPowerSample(const PowerSample& sample);
+    void foldIntoPowerPyramid(const PowerSample& sample);
     void addDailySummary(const DailySummary& summary);
+    bool appendDailyArchive(const DailySummary& summary);
     void calculatePeriodStats(PeriodStats& stats, uint32_t startTimestamp) const;
+    void foldPeriod(PeriodStats& stats, uint32_t startTimestamp) const;
     uint32_t getTodayMidnight() const;
     void notifyChange();
     void checkMaintenanceThresholds();
@@ -0,0 +1,82 @@
+/**
+ * BrewOS Task Priority Governor
+ *
+ * During a shot the weight/stop chain (scale samples -> brew-by-weight ->
+ * WEIGHT_STOP/UART) runs on the Arduino loop task at priority 1, where the
+ * LVGL render task (priority 2, same core) can preempt it mid-decision and
+ * the background network tasks add scheduling noise on top. The static
+ * priorities are right for the other 99% of uptime - a shot is the ~30
+ * seconds where bounded latency actually matters - so rather than
+ * permanently re-ranking every task, this governor elevates the critical
+ * path and demotes the background tasks for exactly the brewing window,
+ * enforced in one place.
+ *
+ * Owners register their task once with a role after creating it (and must
+ * unmanage() before the task exits). The governor watches the machine state
+ * from the main loop and applies/restores priorities on the brewing edge,
+ * with a short hold-down past brew end so the stop chain and the drip
+ * settle window stay protected. Normal priorities are captured at manage()
+ * time, so restore always returns exactly what static configuration set up.
+ */
+
+#ifndef TASK_GOVERNOR_H
+#define TASK_GOVERNOR_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Priorities applied while brewing. Critical sits above the LVGL task (2)
+// so rendering can no longer preempt a stop decision on core 1; background
+// floors at 1 rather than 0 so the idle tasks keep feeding the watchdog.
+#define GOVERNOR_CRITICAL_BREW_PRIORITY   3
+#define GOVERNOR_BACKGROUND_BREW_PRIORITY 1
+
+// Keep the elevation through the stop chain and drip settle after brew end
+#define GOVERNOR_HOLD_MS                  2000
+
+// Registration slots - loop task + LVGL + MQTT + cloud, with headroom
+#define GOVERNOR_MAX_TASKS                8
+
+typedef enum {
+    GOV_CRITICAL,    // Elevated while brewing (weight/stop path)
+    GOV_BACKGROUND,  // Demoted while brewing (MQTT, cloud, rendering)
+} governor_role_t;
+
+class TaskGovernor {
+public:
+    /**
+     * Call once from setup(). Registers the calling task (the Arduino loop
+     * task, which runs the whole weight/stop chain) as GOV_CRITICAL.
+     */
+    static void begin();
+
+    /**
+     * Put a task under governance. Captures its current priority as the
+     * value to restore. Safe to call while an elevation is active - the
+     * brewing priority is applied immediately in that case.
+     */
+    static void manage(TaskHandle_t task, governor_role_t role);
+
+    /**
+     * Release a task. MUST be called before a managed task exits; the
+     * normal priority is restored if an elevation is active.
+     */
+    static void unmanage(TaskHandle_t task);
+
+    /**
+     * Brewing-edge detection against runtime state. Call every main loop.
+     */
+    static void loop();
+
+    /**
+     * Diagnostics (surfaced in /api/protocol/diagnostics)
+     */
+    struct Stats {
+        bool elevated;       // Elevation currently applied
+        uint8_t managed;     // Tasks currently under governance
+        uint32_t elevations; // Shots that triggered an elevation
+    };
+    static Stats getStats();
+};
+
+#endif // TASK_GOVERNOR_H
@@ -0,0 +1,43 @@
+#ifndef TEMP_HISTORY_H
+#define TEMP_HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <Arduino.h>
+
+/**
+ * BrewOS Temperature History Ring
+ *
+ * The dashboard chart used to reconstruct temperature history by
+ * accumulating WS deltas client-side, so a fresh page load started with an
+ * empty chart. This ring keeps the last 10 minutes of both boiler
+ * temperatures on-device (1Hz, int16 centidegrees - 2.4KB total) and is
+ * bundled into /api/bootstrap, so the chart is fully seeded on load and the
+ * live status deltas only ever append to it.
+ *
+ * Wire format (JSON, delta-encoded): per channel the first element is the
+ * absolute temperature in centidegrees, every following element is the
+ * difference to its predecessor - steady boilers serialize as long runs of
+ * 0s and single digits, which keeps the bootstrap payload small.
+ */
+
+#define TEMP_HISTORY_SAMPLES     600   // 10 minutes at 1Hz
+#define TEMP_HISTORY_INTERVAL_MS 1000
+
+class TempHistory {
+public:
+    // Called from the main loop; self-throttled to the sample interval.
+    // Samples brew/steam temperature from the runtime state.
+    static void loop();
+
+    // Append the ring as a JSON object ({"intervalMs":...,"count":...,
+    // "brew":[...],"steam":[...]}) - written straight into the response
+    // String, since a 600-element JsonArray per channel would cost far more
+    // heap than the ring itself
+    static void appendJson(String& out);
+
+    // Worst-case serialized size, for String::reserve()
+    static size_t jsonSizeEstimate();
+};
+
+#endif // TEMP_HISTORY_H
@@ -0,0 +1,62 @@
+#ifndef TIME_KEEPER_H
+#define TIME_KEEPER_H
+
+#include <Arduino.h>
+#include <time.h>
+
+/**
+ * TimeKeeper - persisted clock discipline around async SNTP
+ *
+ * The schedule engine needs wall time, but SNTP lands tens of seconds after
+ * boot - or not at all when WiFi is slow - so schedules used to sit idle
+ * until sync and early log timestamps were epoch-zero garbage. TimeKeeper
+ * closes that gap:
+ *
+ * - begin() restores the last NVS clock checkpoint when the RTC domain came
+ *   up cold (power cycle), so time(nullptr) is immediately plausible and
+ *   monotonic-correct: boot logs are ordered and schedule evaluation starts
+ *   right away instead of waiting for SNTP. Warm resets keep the running
+ *   RTC time. Either way the clock is "provisional" until SNTP confirms it.
+ * - SNTP refinement stays fully async (configTzTime in WiFiManager); the
+ *   sync notification callback marks the clock authoritative and measures
+ *   the crystal drift rate between consecutive syncs into a persisted EWMA.
+ * - loop() checkpoints the clock to NVS every few minutes, and once SNTP
+ *   has been unreachable for hours it counters the learned drift rate with
+ *   gentle adjtime() slews so the clock doesn't wander unbounded.
+ *
+ * Restored time can be stale by however long the machine sat powered off
+ * (plus up to one checkpoint interval); SNTP steps it when it arrives and
+ * the schedule deadline cache re-anchors via its 6-hour horizon cap.
+ */
+class TimeKeeper {
+public:
+    /**
+     * Restore the persisted clock and hook the SNTP sync notification.
+     * Call once, early in boot - before the log manager starts capturing.
+     */
+    static void begin();
+
+    /**
+     * Periodic service: NVS checkpoints, deferred sync bookkeeping, drift
+     * slews. Cheap when nothing is due; called from the loop executor.
+     */
+    static void loop();
+
+    /**
+     * True once time(nullptr) is usable for schedules and timestamps -
+     * either SNTP-synced or restored (provisional) from the checkpoint.
+     */
+    static bool isTrusted();
+
+    /**
+     * True while running on restored time that SNTP has not yet confirmed.
+     */
+    static bool isProvisional();
+
+    /**
+     * Smoothed crystal drift vs NTP in ppm (0 until two syncs measured it).
+     */
+    static int32_t driftPpm();
+};
+
+#endif // TIME_KEEPER_H
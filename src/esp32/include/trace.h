@@ -0,0 +1,57 @@
+/**
+ * Hot-Path Tracepoints (ESP32 side)
+ *
+ * Per-core cycle-counter tracepoint rings plus a third ring for records the
+ * Pico forwards in MSG_TRACE batches. See trace_format.h for the shared
+ * record layout and the TRACE_BEGIN/TRACE_END macros; the merged timeline is
+ * dumped at /api/trace as Chrome Trace Event JSON (loads directly into
+ * chrome://tracing or Perfetto).
+ *
+ * Compiled out entirely unless built with -DTRACEPOINTS=1.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "trace_format.h"
+#include <stddef.h>
+
+#if TRACEPOINTS
+
+// Ring indices for the dump accessors
+#define TRACE_RING_CORE0 0   // ESP32 core 0
+#define TRACE_RING_CORE1 1   // ESP32 core 1
+#define TRACE_RING_PICO  2   // Records forwarded from the Pico (both its cores)
+#define TRACE_RING_COUNT 3
+
+/**
+ * Ingest a MSG_TRACE batch from the Pico
+ * Payload: [cpu_hz u32 LE][count][trace_record_t x count]
+ */
+void trace_ingest_pico(const uint8_t* payload, size_t length);
+
+/**
+ * Pause/resume recording around a dump so the rings stay stable while the
+ * chunked /api/trace response iterates them. Events recorded while paused
+ * are dropped, not queued.
+ */
+void trace_pause(void);
+void trace_resume(void);
+
+/**
+ * Dump accessors - only meaningful while paused.
+ * Index 0 is the oldest retained record in the ring.
+ */
+size_t trace_ring_count(uint8_t ring);
+bool trace_ring_get(uint8_t ring, size_t index, trace_record_t* out);
+
+/**
+ * Clock frequency for converting a ring's cycle counts to microseconds.
+ * For TRACE_RING_PICO this is the clk_sys the Pico reported in its last
+ * batch (0 until the first batch arrives).
+ */
+uint32_t trace_ring_cpu_hz(uint8_t ring);
+
+#endif // TRACEPOINTS
+
+#endif // TRACE_H
@@ -26,6 +26,14 @@ lv_obj_t* screen_idle_create(void);
  */
 void screen_idle_update(const ui_state_t* state);
 
+/**
+ * True when the status-line clock has crossed a minute boundary since it
+ * was last drawn. Lets the UI manager wake the otherwise change-gated
+ * update pass once a minute in deep idle - the only periodic work the
+ * idle screen does.
+ */
+bool screen_idle_clock_due(void);
+
 /**
  * Set the selected power mode index (from encoder rotation)
  */
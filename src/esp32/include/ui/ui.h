@@ -107,9 +107,13 @@ typedef struct {
     float target_weight;        // Target weight
     float dose_weight;          // Dose weight (for ratio)
     float flow_rate;            // ml/s
-    
+    uint8_t brew_phase;         // Shot phase (BREW_PHASE_*)
+    uint32_t phase_start_us;    // Phase entry time (Pico us since boot, low 32 bits)
+
     // Power
     uint16_t power_watts;       // Current power consumption
+    uint32_t brew_energy_wh;    // Brew element energy since Pico boot (duty-integrated)
+    uint32_t steam_energy_wh;   // Steam element energy since Pico boot (duty-integrated)
     
     // Cleaning
     uint16_t brew_count;        // Brews since last cleaning
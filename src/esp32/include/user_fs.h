@@ -0,0 +1,48 @@
+#ifndef USER_FS_H
+#define USER_FS_H
+
+#include <LittleFS.h>
+
+/**
+ * User FS - hot-data LittleFS partition for high-churn files
+ *
+ * Logs, statistics, the event journal and shot captures rewrite small
+ * files constantly, while web assets and fonts are written once per web
+ * OTA. On a single LittleFS partition that churn forces the allocator's
+ * garbage collection to walk (and relocate) asset blocks, which shows up
+ * on long-deployed units as slowly rising write latency. Keeping the
+ * append-heavy files on their own partition bounds GC to the blocks that
+ * actually churn and spreads wear across flash the assets never touch.
+ *
+ * Layout (see partitions_*.csv): the "spiffs" partition keeps the web
+ * assets and static data, a new "userdata" partition holds the hot files.
+ *
+ * Deployed units only get a new partition table from a full USB reflash -
+ * app OTA leaves the table untouched. userFsBegin() therefore probes for
+ * the "userdata" partition at boot and, when it is absent, aliases the
+ * shared LittleFS so every call site behaves exactly as before. Code must
+ * not assume the two filesystems are distinct.
+ *
+ * Usage: replace LittleFS.open(...) with userFS().open(...) for hot
+ * files. Paths are unchanged - base path mapping is internal to the FS.
+ */
+
+/**
+ * Mount the hot-data filesystem. Call after LittleFS is mounted.
+ * Safe to call again (e.g. from panic paths) - remounting is a no-op.
+ * @param formatOnFail format the partition if the mount fails
+ *                     (pass false from panic context)
+ * @return true if a filesystem for hot data is available
+ */
+bool userFsBegin(bool formatOnFail = true);
+
+/**
+ * The filesystem hot files live on: the dedicated "userdata" partition
+ * when the flashed table has one, otherwise the shared LittleFS.
+ */
+fs::LittleFSFS& userFS();
+
+/** True if hot data is on its own partition (false = legacy shared FS) */
+bool userFsIsDedicated();
+
+#endif // USER_FS_H
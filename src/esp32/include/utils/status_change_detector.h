@@ -1,9 +1,11 @@
 /**
  * Status Change Detector
  * 
- * Detects meaningful changes in device status to avoid sending redundant updates
- * to cloud and MQTT. Only sends updates when data actually changes or on periodic
- * heartbeats to maintain connectivity.
+ * Detects meaningful changes in device status to avoid sending redundant updates.
+ * This is the single diff layer over ui_state_t: the WebSocket, cloud, and MQTT
+ * serializers all consume the same ChangedFields bits (merged per-sink for
+ * rate-limited channels) and only differ in wire format. Updates go out when
+ * data actually changes or on periodic heartbeats to maintain connectivity.
  */
 
 #ifndef STATUS_CHANGE_DETECTOR_H
@@ -74,6 +76,34 @@ struct ChangedFields {
                brew_time || target_weight || connections || water_low || alarm || cleaning ||
                wifi || mqtt || stats || esp32;
     }
+
+    /**
+     * Merge another set of changed fields into this one (logical OR).
+     * Used to coalesce changes that accumulate while a sink is rate-limited.
+     */
+    void merge(const ChangedFields& other) {
+        machine_state |= other.machine_state;
+        machine_mode |= other.machine_mode;
+        heating_strategy |= other.heating_strategy;
+        is_heating |= other.is_heating;
+        is_brewing |= other.is_brewing;
+        temps |= other.temps;
+        pressure |= other.pressure;
+        power |= other.power;
+        scale_weight |= other.scale_weight;
+        scale_flow_rate |= other.scale_flow_rate;
+        scale_connected |= other.scale_connected;
+        brew_time |= other.brew_time;
+        target_weight |= other.target_weight;
+        connections |= other.connections;
+        water_low |= other.water_low;
+        alarm |= other.alarm;
+        cleaning |= other.cleaning;
+        wifi |= other.wifi;
+        mqtt |= other.mqtt;
+        stats |= other.stats;
+        esp32 |= other.esp32;
+    }
 };
 
 // =============================================================================
@@ -0,0 +1,27 @@
+/**
+ * Status String Mappings
+ *
+ * Single source of truth for machine-state-to-wire-string conversion. The
+ * WebSocket, cloud, and MQTT serializers all publish the same state machine
+ * but previously each carried its own copy of the switch, which is how the
+ * contracts drift apart. Two mappings exist on purpose: the web/cloud
+ * contract reports UI_STATE_IDLE as "idle", while the MQTT contract predates
+ * it and Home Assistant templates expect "standby" - changing either would
+ * break deployed clients.
+ */
+
+#ifndef STATUS_STRINGS_H
+#define STATUS_STRINGS_H
+
+#include <stdint.h>
+
+/** Machine state for web/cloud clients ("idle", "heating", "brewing", ...). */
+const char* statusStateString(uint8_t machine_state);
+
+/** Machine state for MQTT/HA ("standby" instead of "idle", otherwise identical). */
+const char* statusStateStringMqtt(uint8_t machine_state);
+
+/** Coarse mode derived from state: "standby", "on", or "eco". */
+const char* statusModeString(uint8_t machine_state);
+
+#endif // STATUS_STRINGS_H
@@ -0,0 +1,68 @@
+/**
+ * Token Bucket
+ *
+ * Minimal integer-math token bucket for rate limiting log-style event
+ * streams. Refills continuously at ratePerSec up to capacity (the burst
+ * allowance) and counts denials so the caller can emit a
+ * "...N suppressed" summary once the bucket reopens.
+ *
+ * Not thread-safe on its own - callers on multi-producer paths wrap
+ * allow() in their own critical section.
+ */
+
+#ifndef TOKEN_BUCKET_H
+#define TOKEN_BUCKET_H
+
+#include <stdint.h>
+
+struct TokenBucket {
+    uint32_t capacity;      // Burst size (max tokens)
+    uint32_t ratePerSec;    // Sustained refill rate
+    uint32_t tokens;        // Current tokens (initialize to capacity)
+    uint32_t lastRefillMs;  // Timestamp of the last refill accounting
+    uint32_t suppressed;    // Denials since the last allowed event
+
+    /**
+     * Try to consume one token. Refill accounting happens inline, so
+     * this is the only method that needs calling on the hot path.
+     * @param nowMs millis() at the event
+     * @return true if the event may pass, false if it should be dropped
+     */
+    bool allow(uint32_t nowMs) {
+        uint32_t elapsed = nowMs - lastRefillMs;
+        if (elapsed >= (capacity * 1000u) / ratePerSec) {
+            // Full refill - also keeps the scaled math below from
+            // overflowing across long idle gaps
+            tokens = capacity;
+            lastRefillMs = nowMs;
+        } else {
+            uint32_t add = (elapsed * ratePerSec) / 1000u;
+            if (add > 0) {
+                tokens += add;
+                if (tokens > capacity) tokens = capacity;
+                // Advance by the time actually converted to tokens so
+                // sub-token remainders carry into the next refill
+                lastRefillMs += (add * 1000u) / ratePerSec;
+            }
+        }
+
+        if (tokens > 0) {
+            tokens--;
+            return true;
+        }
+        suppressed++;
+        return false;
+    }
+
+    /**
+     * Fetch and reset the suppressed-event count (for summary emission
+     * after the bucket reopens).
+     */
+    uint32_t takeSuppressed() {
+        uint32_t n = suppressed;
+        suppressed = 0;
+        return n;
+    }
+};
+
+#endif // TOKEN_BUCKET_H
@@ -8,9 +8,11 @@
 #include "wifi_manager.h"
 #include "ui/ui.h"
 #include "utils/status_change_detector.h"
+#include "broadcast_scheduler.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
+#include <string_view>  // Non-owning command/broadcast parameters
 
 // Forward declarations
 class PicoUART;
@@ -22,6 +24,11 @@ class CloudConnection;
 // Call this once during setup() to avoid repeated allocations
 void initBroadcastBuffers();
 
+// Post-boot cache warming: pre-builds one throwaway status frame so the
+// first broadcast after an OTA reboot doesn't pay for page faults and
+// pool growth (see warmBroadcastBuffers in web_server_broadcast.cpp)
+void warmBroadcastBuffers();
+
 // Pending OTA management (for reboot-first approach when memory is fragmented)
 bool hasPendingOTA(String& version);
 uint8_t getPendingOTARetries();
@@ -34,7 +41,12 @@ public:
     
     // Initialize
     void begin();
-    
+
+    // Post-boot warming pass: primes the serialized fragment caches and
+    // broadcast buffers so the first client after an OTA reboot doesn't
+    // pay cold-start latency (call once from setup, after begin())
+    void warmUp();
+
     // Update - call in loop
     void loop();
     
@@ -49,10 +61,21 @@ public:
     
     // Check if WiFi is ready to serve requests (prevents crashes from early requests)
     bool isWiFiReady();
+
+    // Admission control: true if this request should be shed with an early
+    // 503 + Retry-After (connection-storm protection - see web_server.cpp).
+    // Called by the AdmissionGate handler registered ahead of every route.
+    bool shouldShedRequest(AsyncWebServerRequest* request);
+
+    // Admission-control health counters (exposed in /api/protocol/diagnostics)
+    uint32_t getRequestsShed() const { return _requestsShed; }
+    uint32_t getStormEvents() const { return _stormEvents; }
     
     // Send data to all WebSocket clients - Unified Status Broadcast
-    bool buildDeltaStatus(const ui_state_t& state, const ChangedFields& changed, 
-                          uint32_t sequence, JsonDocument& doc);  // Build delta status (only changed fields)
+    // Streams changed sections straight into the MessagePack buffer (no
+    // intermediate JsonDocument). Returns bytes written, 0 if nothing changed.
+    size_t buildDeltaStatus(const ui_state_t& state, const ChangedFields& changed,
+                            uint32_t sequence, uint8_t* buffer, size_t bufferSize);
     void broadcastFullStatus(const ui_state_t& machineState);  // Comprehensive status (periodic)
     void sendPingToClients();  // Send WebSocket ping frames to all clients for keepalive
     void broadcastDeviceInfo();   // Device info (on connect only)
@@ -65,17 +88,42 @@ public:
     void broadcastLogLevel(const char* level, const char* format, ...) __attribute__((format(printf, 3, 4)));  // Level first, then format
     void broadcastLogMessage(const char* level, const char* message);  // Direct message (no formatting) - for platform_log
     void broadcastLogMessageWithSource(const char* level, const char* message, const char* source);  // Direct message with source (for Pico logs)
-    void broadcastEvent(const String& event, const JsonDocument* data = nullptr);  // Events (shot_start, shot_end, etc.)
-    
+    void broadcastEvent(const char* event, const JsonDocument* data = nullptr);  // Events (shot_start, shot_end, etc.)
+
     // Legacy/debug - raw pico message forwarding
     void broadcastPicoMessage(uint8_t type, const uint8_t* payload, size_t len);
-    
-    // Broadcast raw JSON string to all WebSocket clients
-    void broadcastRaw(const String& json);
-    void broadcastRaw(const char* json);  // const char* overload to avoid String allocation
+
+    // Broadcast raw JSON string to all WebSocket clients.
+    // The String overload is deleted, not removed: a caller that assembles a
+    // String for the broadcast hot path should fail to compile, not silently
+    // reintroduce a per-broadcast heap allocation.
+    void broadcastRaw(const String& json) = delete;
+    void broadcastRaw(const char* json);
     
     // Get client count
     size_t getClientCount();
+
+    // WebSocket send-queue health counters (exposed in /api/protocol/diagnostics)
+    uint32_t getWsFramesDropped() const { return _wsFramesDropped; }
+    uint32_t getWsClientsEvicted() const { return _wsClientsEvicted; }
+
+    // True if this client opted into MessagePack frames at upgrade time
+    bool isClientMsgPack(uint32_t clientId) const;
+
+    // Send a broadcast frame to local clients: JSON text by default,
+    // MessagePack binary to clients that negotiated it. With primaryOnly the
+    // frame goes only to the primary client (degraded broadcast mode).
+    void sendFrameToLocalClients(const JsonDocument& doc, const char* jsonBuffer,
+                                 bool primaryOnly = false);
+
+    // Degraded broadcast mode: past clientThreshold connected clients, status
+    // deltas are rate-limited to statusIntervalMs and log broadcasts go only
+    // to the primary (oldest) client. Keeps 10+ training-room sessions from
+    // lagging the shot timer on all of them.
+    void setDegradedPolicy(uint8_t clientThreshold, unsigned long statusIntervalMs);
+    bool isDegradedBroadcastMode() const { return _degradedMode; }
+    uint32_t getPrimaryClientId() const { return _primaryClientId; }
+    uint8_t getDegradedClientThreshold() const { return _degradedClientThreshold; }
     
     // Check if OTA update is in progress
     bool isOtaInProgress() const { return _otaInProgress; }
@@ -95,16 +143,21 @@ public:
 private:
     AsyncWebServer _server;
     AsyncWebSocket _ws;  // Built-in WebSocket on same port 80
+    AsyncEventSource _events;  // SSE fallback for WS-hostile networks (same frames)
     WiFiManager& _wifiManager;
     PicoUART& _picoUart;
     MQTTClient& _mqttClient;
     PairingManager* _pairingManager;
     CloudConnection* _cloudConnection = nullptr;
-    
+
+    // Per-sink scheduling for status broadcasts (local WS, cloud, MQTT)
+    BroadcastScheduler _broadcastScheduler;
+
     // Request handlers
     void setupRoutes();
     void handleRoot(AsyncWebServerRequest* request);
     void handleGetStatus(AsyncWebServerRequest* request);
+    void handleBootstrap(AsyncWebServerRequest* request);
     void handleGetWiFiNetworks(AsyncWebServerRequest* request);
     void handleSetWiFi(AsyncWebServerRequest* request, uint8_t* data, size_t len);
     void handleGetConfig(AsyncWebServerRequest* request);
@@ -117,36 +170,108 @@ private:
     void handleStartOTA(AsyncWebServerRequest* request);
     void handleESP32OTAUpload(AsyncWebServerRequest* request, const String& filename,
                               size_t index, uint8_t* data, size_t len, bool final);
+
+    // Section builders shared between the per-endpoint handlers and the
+    // /api/bootstrap bundle (same payloads, one round trip)
+    void fillStatusDoc(JsonDocument& doc);
+    void fillInfoDoc(JsonDocument& doc);
     
     // WebSocket message handler (processes JSON commands)
     void handleWsMessage(uint32_t clientNum, uint8_t* payload, size_t length);
     
     // WebSocket event helpers
-    void handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient* client);
+    void handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient* client, AsyncWebServerRequest* request);
     void handleWsDisconnect(AsyncWebSocket* server, AsyncWebSocketClient* client);
     void handleWsError(AsyncWebSocketClient* client, uint8_t* data, size_t len);
-    
+
+    // Slow-client tracking: AsyncWebSocket bounds each client's send queue
+    // internally (canSend() == false when full). Status frames are stateless
+    // snapshots, so a frame dropped on a full queue is superseded by the next
+    // one - but a client whose queue STAYS full is stalled (phone on weak
+    // WiFi) and would otherwise hold TCP buffers that delay everyone else.
+    // Track consecutive full-queue ticks per client and evict chronic cases.
+    void noteClientSendOk(uint32_t clientId);
+    void noteClientQueueFull(AsyncWebSocketClient& client);  // May close the client
+    void clearClientHealth(uint32_t clientId);
+
+    struct WsClientHealth {
+        uint32_t clientId;
+        uint8_t fullStreak;   // Consecutive status ticks with a full send queue
+        bool inUse;
+    };
+    static constexpr uint8_t WS_HEALTH_SLOTS = 12;  // Covers training-room loads (10+ sessions)
+    static constexpr uint8_t WS_EVICT_STREAK = 10;  // ~5s of 500ms status ticks
+    WsClientHealth _wsHealth[WS_HEALTH_SLOTS] = {};
+    uint32_t _wsFramesDropped = 0;   // Status frames dropped on a full client queue
+    uint32_t _wsClientsEvicted = 0;  // Clients closed for a persistently full queue
+
+    // Admission control state (see shouldShedRequest() in web_server.cpp)
+    unsigned long _admitWindowStart = 0;  // Start of the current 1s admission window
+    uint16_t _admitWindowCount = 0;       // Requests admitted in the current window
+    bool _shedding = false;               // Currently in a shed episode (storm)
+    unsigned long _lastStormLogMs = 0;    // Rate limit for storm log lines
+    uint32_t _requestsShed = 0;           // Total requests answered with an early 503
+    uint32_t _stormEvents = 0;            // Distinct shed episodes since boot
+
+    // Per-client MessagePack opt-in, negotiated from the upgrade request
+    // (ws://host/ws?proto=msgpack). Status/delta frames are binary for
+    // everyone; opted-in clients get the remaining broadcasts (logs, events,
+    // device info, settings) as MessagePack too instead of JSON text.
+    // Client IDs start at 1, so 0 marks a free slot.
+    void markClientMsgPack(uint32_t clientId);
+    uint32_t _msgpackClients[WS_HEALTH_SLOTS] = {};
+
+    // Degraded broadcast policy (see setDegradedPolicy()). Re-evaluated on
+    // every broadcast tick; the primary client is the oldest connection
+    // (lowest ID - IDs are assigned monotonically).
+    void updateBroadcastPolicy();
+    uint8_t _degradedClientThreshold = 6;
+    unsigned long _degradedStatusInterval = 1500;  // ms between deltas when degraded
+    bool _degradedMode = false;
+    uint32_t _primaryClientId = 0;
+
     // Command handlers - organized by category
-    void handleTemperatureCommand(JsonDocument& doc, const String& cmd);
-    void handleModeCommand(JsonDocument& doc, const String& cmd);
-    void handleMqttCommand(JsonDocument& doc, const String& cmd);
-    void handleCloudCommand(JsonDocument& doc, const String& cmd);
-    void handleScheduleCommand(JsonDocument& doc, const String& cmd);
-    void handleScaleCommand(JsonDocument& doc, const String& cmd);
-    void handleBrewByWeightCommand(JsonDocument& doc, const String& cmd);
-    void handlePreinfusionCommand(JsonDocument& doc, const String& cmd);
-    void handlePowerCommand(JsonDocument& doc, const String& cmd);
-    void handlePowerMeterCommand(JsonDocument& doc, const String& cmd);
-    void handleWiFiCommand(JsonDocument& doc, const String& cmd);
-    void handleSystemCommand(JsonDocument& doc, const String& cmd);
-    void handleOtaCommand(JsonDocument& doc, const String& cmd);
-    void handleMachineInfoCommand(JsonDocument& doc, const String& cmd);
-    void handlePreferencesCommand(JsonDocument& doc, const String& cmd);
-    void handleTimeCommand(JsonDocument& doc, const String& cmd);
-    void handleMaintenanceCommand(JsonDocument& doc, const String& cmd);
-    void handleDiagnosticsCommand(JsonDocument& doc, const String& cmd);
-    void handleLogCommand(JsonDocument& doc, const String& cmd);
-    
+    void handleTemperatureCommand(JsonDocument& doc, std::string_view cmd);
+    void handleModeCommand(JsonDocument& doc, std::string_view cmd);
+    void handleMqttCommand(JsonDocument& doc, std::string_view cmd);
+    void handleCloudCommand(JsonDocument& doc, std::string_view cmd);
+    void handleScheduleCommand(JsonDocument& doc, std::string_view cmd);
+    void handleScaleCommand(JsonDocument& doc, std::string_view cmd);
+    void handleBrewByWeightCommand(JsonDocument& doc, std::string_view cmd);
+    void handlePreinfusionCommand(JsonDocument& doc, std::string_view cmd);
+    void handlePowerCommand(JsonDocument& doc, std::string_view cmd);
+    void handlePowerMeterCommand(JsonDocument& doc, std::string_view cmd);
+    void handleWiFiCommand(JsonDocument& doc, std::string_view cmd);
+    void handleSystemCommand(JsonDocument& doc, std::string_view cmd);
+    void handleOtaCommand(JsonDocument& doc, std::string_view cmd);
+    void handleMachineInfoCommand(JsonDocument& doc, std::string_view cmd);
+    void handlePreferencesCommand(JsonDocument& doc, std::string_view cmd);
+    void handleTimeCommand(JsonDocument& doc, std::string_view cmd);
+    void handleMaintenanceCommand(JsonDocument& doc, std::string_view cmd);
+    void handleDiagnosticsCommand(JsonDocument& doc, std::string_view cmd);
+    void handleLogCommand(JsonDocument& doc, std::string_view cmd);
+
+    // Command registry: one sorted table maps every "cmd" string to its
+    // category handler (see web_server_websocket.cpp). Dispatch is a binary
+    // search instead of the old strcmp cascade, and each entry carries
+    // call/latency counters. Static so web, cloud and MQTT sources share
+    // the same stats.
+    typedef void (BrewWebServer::*CommandHandler)(JsonDocument& doc, std::string_view cmd);
+    struct CommandEntry {
+        const char* name;      // Sort key - table must stay sorted (verified once at runtime)
+        CommandHandler handler;
+        // Stats
+        uint32_t calls;
+        uint64_t totalUs;
+        uint32_t maxUs;
+    };
+    static CommandEntry _commandTable[];
+    static const size_t _commandTableSize;
+    bool dispatchCommand(JsonDocument& doc, std::string_view cmd);
+    static void commandStatsToJson(JsonArray& arr);
+    static void resetCommandStats();
+
+
     // Helpers
     String getContentType(const String& filename);
     bool streamFirmwareToPico(File& firmwareFile, size_t firmwareSize);
@@ -154,7 +279,10 @@ private:
     // GitHub OTA - Download and install firmware from GitHub releases
     void startGitHubOTA(const String& version);        // ESP32 only
     bool startPicoGitHubOTA(const String& version);    // Pico only (based on machine type), returns true on success
+    bool verifyPicoBootHealth(uint32_t deadlineMs);    // Post-flash boot handshake within deadline
+    bool rollbackPicoViaSWD();                         // Reflash known-good cached image over SWD
     void updateLittleFS(const char* tag);              // Update web UI filesystem
+    void finishEsp32OTA(const char* tag);              // LittleFS update + restart after flash
     
     // Check for updates from GitHub releases
     void checkForUpdates();
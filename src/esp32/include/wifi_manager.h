@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <Preferences.h>
+#include "config.h"  // WIFI_ROAM_* roaming tunables
 #include <time.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -119,6 +120,29 @@ public:
     void onDisconnected(WiFiEventCallback callback) { _onDisconnected = callback; }
     void onAPStarted(WiFiEventCallback callback) { _onAPStarted = callback; }
 
+    // Shot-window PHY tuning + link health (see "Shot-Window PHY Tuning"
+    // in wifi_manager.cpp)
+    struct LinkSample {
+        int8_t rssi;              // dBm at sample time
+        bool shotPhy;             // Shot-window tuning was active
+        uint16_t maxBroadcastMs;  // Worst WS fanout time in the window
+    };
+
+    /**
+     * Feed the worst-case broadcast fanout time into the current link
+     * sample window. Called from the broadcast path after each WS fanout.
+     */
+    void noteBroadcastLatency(uint32_t ms);
+
+    bool isShotPhyActive() const { return _shotPhyActive; }
+    uint32_t getShotPhyApplies() const { return _shotPhyApplies; }
+
+    /**
+     * Copy out the link history, oldest sample first.
+     * @return Number of samples written (0 if the mutex is busy)
+     */
+    uint8_t getLinkHistory(LinkSample* out, uint8_t maxSamples);
+
 private:
     WiFiManagerMode _mode;
     Preferences _prefs;
@@ -136,6 +160,35 @@ private:
     
     unsigned long _lastConnectAttempt;
     unsigned long _connectStartTime;
+
+    // Roaming fast-path state (see "WiFi Roaming Fast-Path" in wifi_manager.cpp).
+    // RSSI trend ring is written only from the WiFi task.
+    int8_t _rssiSamples[WIFI_ROAM_TREND_WINDOW];
+    uint8_t _rssiSampleCount = 0;
+    uint8_t _rssiSampleIndex = 0;
+    unsigned long _lastRssiSample = 0;
+    bool _roamScanActive = false;       // Async candidate scan in flight
+    unsigned long _lastRoamScan = 0;
+    unsigned long _lastRoam = 0;
+    bool _fastRejoinPending = false;    // Current connect attempt is the fast path
+
+    // Last good AP (persisted per SSID in NVS for sub-second rejoin)
+    uint8_t _lastBSSID[6] = {0};
+    uint8_t _lastChannel = 0;
+    bool _haveLastAP = false;
+
+    // Shot-window PHY tuning state (WiFi task only)
+    bool _shotPhyActive = false;
+    unsigned long _brewEndTime = 0;     // Falling-edge time for the hold-down
+    uint32_t _shotPhyApplies = 0;       // Shots that triggered the tuning
+
+    // Link health ring (written on the WiFi task, copied out under _mutex;
+    // the broadcast latency max is a relaxed cross-task cell)
+    LinkSample _linkSamples[WIFI_LINK_HISTORY_LEN];
+    uint8_t _linkSampleCount = 0;
+    uint8_t _linkSampleIndex = 0;
+    unsigned long _lastLinkSample = 0;
+    volatile uint32_t _broadcastMaxMs = 0;
     
     // NTP settings
     char _ntpServer[64] = "pool.ntp.org";
@@ -171,6 +224,19 @@ private:
     void processCommand(WiFiCommand cmd);
     void doConnectToWiFi();
     void doStartAP();
+
+    // Shot-window PHY tuning + link health (all run on the WiFi task)
+    void updateShotPhy();       // Brewing-edge detection against runtime state
+    void applyShotPhy(bool enable);
+    void sampleLinkHealth();    // RSSI + broadcast latency into the ring
+
+    // Roaming fast-path (all run on the WiFi task)
+    void sampleRoamSignal();    // RSSI trend; may kick off a background scan
+    void evaluateRoamScan();    // Pick a candidate and reassociate if better
+    void noteAssociated();      // Persist BSSID/channel, reset roam state
+    void saveLastAP();
+    void loadLastAP();
+    void clearLastAP();
     void doConfigureNTP();
     void doSyncNTP();
 };
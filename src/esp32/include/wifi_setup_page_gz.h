@@ -0,0 +1,703 @@
+#ifndef WIFI_SETUP_PAGE_GZ_H
+#define WIFI_SETUP_PAGE_GZ_H
+
+#include <Arduino.h>
+
+/**
+ * WiFi Setup Page HTML - gzip pre-compressed at build time
+ *
+ * Same content as WIFI_SETUP_PAGE_HTML (wifi_setup_page.h), compressed with
+ * gzip -9 so /setup can stream it straight from flash with
+ * Content-Encoding: gzip. Clients that don't accept gzip fall back to the
+ * uncompressed PROGMEM copy.
+ *
+ * GENERATED FILE - do not edit. Regenerate with:
+ *   python3 update_wifi_setup_header.py
+ */
+const uint8_t WIFI_SETUP_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x96, 0xe3, 0xc6,
+    0x95, 0xe5, 0xbb, 0xbe, 0x02, 0xa6, 0xdc, 0x76, 0x56, 0x37, 0x80, 0x44, 0x04, 0x02, 0xb7, 0x74,
+    0x66, 0xb9, 0x2d, 0xf9, 0xd2, 0x9a, 0x65, 0x59, 0x5e, 0x5d, 0xb2, 0x67, 0xb5, 0x5f, 0xc6, 0x4c,
+    0x12, 0x59, 0x49, 0x8b, 0x49, 0xb2, 0x49, 0x66, 0x5d, 0x5a, 0x5d, 0x3f, 0xd1, 0x6b, 0xde, 0xe7,
+    0x17, 0xe7, 0x13, 0x66, 0xef, 0x1d, 0x20, 0x09, 0x80, 0x60, 0xde, 0xdc, 0xd2, 0xd3, 0x48, 0x76,
+    0x8a, 0x49, 0x02, 0x71, 0x39, 0x71, 0xce, 0xde, 0xfb, 0x9c, 0x88, 0x04, 0x3f, 0xbb, 0xfc, 0xc9,
+    0xaf, 0xbf, 0xf9, 0xf2, 0xdb, 0x7f, 0xfb, 0xe3, 0x6f, 0x82, 0xdb, 0xed, 0xdd, 0xfc, 0xf5, 0x67,
+    0x97, 0xfe, 0x3f, 0x41, 0x70, 0x79, 0x5b, 0x8f, 0xa7, 0x7c, 0x81, 0x97, 0x77, 0xf5, 0x76, 0x1c,
+    0x4c, 0x6e, 0xc7, 0xeb, 0x4d, 0xbd, 0xbd, 0x1a, 0xfd, 0xe9, 0xdb, 0xdf, 0x46, 0xe5, 0x28, 0x38,
+    0x6f, 0x7f, 0xb8, 0x18, 0xdf, 0xd5, 0x57, 0xa3, 0x77, 0xb3, 0xfa, 0xfd, 0x6a, 0xb9, 0xde, 0x8e,
+    0x82, 0xc9, 0x72, 0xb1, 0xad, 0x17, 0xb8, 0xf8, 0xfd, 0x6c, 0xba, 0xbd, 0xbd, 0x9a, 0xd6, 0xef,
+    0x66, 0x93, 0x3a, 0xd2, 0x2f, 0xe1, 0x6c, 0x31, 0xdb, 0xce, 0xc6, 0xf3, 0x68, 0x33, 0x19, 0xcf,
+    0xeb, 0x2b, 0x73, 0x68, 0x69, 0x3b, 0xdb, 0xce, 0xeb, 0xd7, 0x5f, 0xac, 0xeb, 0xf7, 0xdf, 0xbc,
+    0x09, 0xfe, 0xe7, 0xec, 0xb7, 0xb3, 0xe0, 0x4d, 0xbd, 0xbd, 0x5f, 0x05, 0x67, 0xbf, 0xae, 0xdf,
+    0xbd, 0xba, 0x3c, 0xf7, 0x1f, 0xfb, 0x4b, 0x37, 0xdb, 0x8f, 0xbb, 0xd7, 0x41, 0xf0, 0x8f, 0xc1,
+    0xf7, 0xcd, 0xab, 0x20, 0xb8, 0x5e, 0x7e, 0x88, 0x36, 0xb3, 0xff, 0x98, 0x2d, 0xde, 0x5e, 0xe0,
+    0xf5, 0x7a, 0x5a, 0xaf, 0x23, 0xbc, 0xf5, 0x8b, 0xfd, 0xe7, 0x77, 0xe3, 0xf5, 0xdb, 0xd9, 0xe2,
+    0x22, 0x48, 0x0e, 0x6f, 0xad, 0xc6, 0xd3, 0xa9, 0xae, 0xdf, 0xbf, 0xf7, 0xe9, 0xb3, 0x5d, 0x63,
+    0xd3, 0x8f, 0xad, 0xb6, 0x6f, 0x30, 0xa9, 0xe8, 0x66, 0x7c, 0x37, 0x9b, 0x7f, 0xbc, 0x08, 0x46,
+    0x5f, 0x61, 0x86, 0xeb, 0x51, 0x18, 0x44, 0xe3, 0xd5, 0x6a, 0x5e, 0x47, 0x9b, 0x8f, 0x9b, 0x6d,
+    0x7d, 0x17, 0x06, 0x5f, 0xcc, 0x67, 0x8b, 0xef, 0xbe, 0x1e, 0x4f, 0xde, 0xe8, 0xf7, 0xdf, 0xe2,
+    0x96, 0x30, 0x18, 0xbd, 0xa9, 0xdf, 0x2e, 0xeb, 0xe0, 0x4f, 0x5f, 0x8d, 0xc2, 0x7d, 0x63, 0x41,
+    0xf0, 0xaf, 0xcb, 0xeb, 0xe5, 0x76, 0x19, 0x06, 0x9b, 0xf1, 0x62, 0x13, 0x6d, 0xea, 0xf5, 0xec,
+    0xe6, 0x30, 0xa6, 0xeb, 0xf1, 0xe4, 0xbb, 0xb7, 0xeb, 0xe5, 0xfd, 0x62, 0x7a, 0x11, 0xa0, 0xc1,
+    0x7a, 0xbc, 0x8e, 0xde, 0xae, 0xc7, 0xd3, 0x19, 0x6c, 0x7a, 0xd6, 0x6a, 0xc2, 0xb8, 0x6c, 0x5a,
+    0xbf, 0x6d, 0x37, 0xfa, 0xb9, 0x19, 0x1b, 0x67, 0x6c, 0x90, 0xfc, 0x43, 0xe7, 0x5d, 0x3b, 0x35,
+    0x37, 0xa6, 0x0c, 0xb2, 0xde, 0xdb, 0xcd, 0xc5, 0x26, 0x49, 0xfe, 0x61, 0xff, 0xf6, 0xab, 0x96,
+    0xb1, 0x66, 0x8b, 0xe8, 0xb6, 0x9e, 0xbd, 0xbd, 0xdd, 0x5e, 0xf0, 0x9a, 0x77, 0xb7, 0x87, 0x8f,
+    0xa6, 0xb3, 0xcd, 0x6a, 0x3e, 0x86, 0x1d, 0x6e, 0xe6, 0x75, 0xcb, 0xbc, 0xe3, 0xf9, 0xec, 0xed,
+    0x22, 0x9a, 0x61, 0xe6, 0x9b, 0x8b, 0x60, 0x52, 0xd3, 0x44, 0x87, 0x0f, 0xff, 0x76, 0xbf, 0xd9,
+    0xce, 0x6e, 0x3e, 0x46, 0x8d, 0x73, 0x1c, 0x5f, 0xb0, 0x5f, 0x09, 0x9b, 0xac, 0x3e, 0xf4, 0x17,
+    0x23, 0x9e, 0x8c, 0xd7, 0xd3, 0xf6, 0x4a, 0x3f, 0x60, 0x22, 0x53, 0x26, 0xb4, 0x0b, 0x26, 0x58,
+    0x9b, 0xc2, 0x38, 0x5a, 0x03, 0xaf, 0x0b, 0x63, 0x4d, 0xa2, 0xc9, 0xb6, 0xe6, 0xd8, 0x38, 0x09,
+    0xef, 0xbc, 0xc7, 0x98, 0xad, 0x5b, 0x7d, 0xf8, 0x45, 0xd7, 0x9b, 0x6e, 0xc7, 0xd3, 0xe5, 0x7b,
+    0x78, 0x47, 0x60, 0xb3, 0xd5, 0x87, 0xa0, 0xc4, 0xd0, 0x82, 0xf5, 0xdb, 0xeb, 0xf1, 0x59, 0x12,
+    0x06, 0xcd, 0xff, 0xe2, 0xec, 0x55, 0xdb, 0xac, 0x89, 0xfe, 0x35, 0xbb, 0xeb, 0x4c, 0x99, 0x87,
+    0x81, 0x49, 0x6d, 0x18, 0xf0, 0x45, 0x12, 0x9b, 0xb6, 0x85, 0xc7, 0x1f, 0x7c, 0x54, 0x5c, 0x04,
+    0xae, 0x3d, 0xe9, 0x20, 0x68, 0xde, 0xe5, 0x68, 0x07, 0x0c, 0xe4, 0x38, 0x8a, 0xee, 0x58, 0x57,
+    0xcb, 0x0d, 0xe2, 0x6a, 0x09, 0xdf, 0x5e, 0xd7, 0xf3, 0xf1, 0x76, 0xf6, 0xae, 0x3e, 0x7c, 0xb6,
+    0x7c, 0x57, 0xaf, 0x6f, 0xe6, 0x9c, 0xc5, 0xed, 0x6c, 0x3a, 0xad, 0x17, 0x83, 0xb6, 0xbd, 0xb8,
+    0xb8, 0xae, 0x6f, 0x96, 0xeb, 0xba, 0x65, 0xe3, 0xfd, 0x4a, 0x8d, 0x46, 0x43, 0x1d, 0x8d, 0xaf,
+    0x37, 0xcb, 0xf9, 0xfd, 0xb6, 0xd5, 0xd1, 0x76, 0xb9, 0xea, 0xc4, 0xd6, 0xbc, 0xbe, 0xd9, 0x76,
+    0xde, 0x58, 0x7b, 0x6f, 0x6a, 0xbd, 0xb3, 0x73, 0xb0, 0xb4, 0x63, 0xf8, 0x07, 0x16, 0xb7, 0x6a,
+    0xd6, 0xf6, 0x7a, 0x5c, 0xba, 0x0c, 0x16, 0xfd, 0x7c, 0x92, 0x96, 0x37, 0xd9, 0x0d, 0x5e, 0x8c,
+    0x93, 0xfc, 0x3a, 0x9d, 0xbe, 0x3a, 0x9a, 0xdd, 0x7c, 0xf9, 0x76, 0xd9, 0x9a, 0xd5, 0xce, 0xb4,
+    0xae, 0x63, 0xf0, 0xbd, 0xa3, 0x77, 0xdf, 0xde, 0x03, 0x46, 0x30, 0xbe, 0xdf, 0x2e, 0xdb, 0x03,
+    0xdf, 0x87, 0xc0, 0xf5, 0x7c, 0x39, 0xf9, 0xee, 0xf0, 0xfe, 0xcd, 0x6c, 0x0e, 0xaf, 0xbe, 0x08,
+    0xa6, 0xeb, 0xe5, 0xaa, 0xf1, 0x9e, 0xb3, 0x24, 0xc0, 0x5a, 0x05, 0xc6, 0x9e, 0xf2, 0x89, 0xf4,
+    0xd5, 0xd1, 0xa8, 0x6f, 0x4d, 0x67, 0x21, 0xe6, 0x4b, 0x34, 0xf9, 0x39, 0xe6, 0x99, 0xd4, 0xd7,
+    0x2d, 0x7b, 0xd7, 0x1f, 0xb6, 0x91, 0x82, 0xee, 0x38, 0x9a, 0xfc, 0xc8, 0x01, 0x7f, 0xdb, 0xed,
+    0xf2, 0xee, 0x22, 0x28, 0xdb, 0xb3, 0x12, 0x94, 0x01, 0x27, 0x6b, 0x78, 0x7c, 0x7e, 0xf4, 0xc1,
+    0xfb, 0xc6, 0x14, 0x79, 0xd2, 0x59, 0xca, 0x2d, 0x9a, 0x8f, 0x36, 0xab, 0xf1, 0x44, 0x2e, 0x18,
+    0xc1, 0xed, 0x07, 0xa2, 0x74, 0x73, 0x7f, 0x2d, 0xa0, 0x1e, 0x18, 0x7c, 0x35, 0x2e, 0xb3, 0xa2,
+    0x7c, 0xd1, 0xe0, 0x53, 0x7b, 0x62, 0xf4, 0xc6, 0x0d, 0x8c, 0x01, 0x5e, 0x7c, 0x17, 0xd1, 0x7d,
+    0x56, 0xad, 0x51, 0xf4, 0x5a, 0x1c, 0x82, 0x98, 0xf9, 0xf8, 0xba, 0x9e, 0xb7, 0x6e, 0x39, 0xb5,
+    0xc2, 0xbb, 0x09, 0x4d, 0xdc, 0x75, 0x36, 0xae, 0x4e, 0x18, 0x2f, 0x6b, 0x1b, 0xaf, 0xd7, 0xb9,
+    0x49, 0x4e, 0x4d, 0xa7, 0x13, 0x05, 0x32, 0xd0, 0x76, 0x0d, 0x7e, 0xe0, 0x8c, 0x2e, 0x82, 0xfb,
+    0xd5, 0xaa, 0x5e, 0x4f, 0xc6, 0x9b, 0xfa, 0xf4, 0xaa, 0x0c, 0x2e, 0xca, 0x6c, 0xb1, 0xba, 0xdf,
+    0x0e, 0x04, 0xc0, 0x30, 0xb6, 0x18, 0xb9, 0x6a, 0x7e, 0x2a, 0x1c, 0x3f, 0x4f, 0xa6, 0xc9, 0x38,
+    0xa9, 0xfa, 0x08, 0x7a, 0x21, 0xc0, 0x03, 0x1e, 0xcc, 0xa6, 0xc1, 0xe7, 0xe9, 0xd4, 0xd6, 0xd6,
+    0x9d, 0x04, 0x59, 0x73, 0x72, 0x35, 0xb3, 0xf6, 0x07, 0x27, 0x9d, 0x9e, 0x16, 0xd9, 0x41, 0xd0,
+    0x7c, 0x8e, 0x39, 0xdb, 0xcd, 0xe0, 0x94, 0x2f, 0x2e, 0xb0, 0x7c, 0x93, 0xfa, 0x76, 0x39, 0x47,
+    0xef, 0x03, 0x0e, 0x99, 0x4d, 0xdc, 0xd4, 0xd9, 0xe1, 0x5b, 0x6f, 0x96, 0x93, 0xfb, 0x4d, 0xeb,
+    0x9e, 0xe5, 0xfd, 0x96, 0x40, 0x74, 0x11, 0x2c, 0x96, 0x8b, 0xfa, 0x68, 0x66, 0xbb, 0x16, 0x3d,
+    0x26, 0x9d, 0x22, 0x10, 0xfe, 0x9b, 0x9e, 0xa4, 0x85, 0xec, 0xd5, 0xe0, 0x48, 0xe2, 0x7a, 0xbd,
+    0x5e, 0xae, 0x3b, 0x12, 0xa7, 0xd3, 0xe5, 0x4d, 0x59, 0x80, 0xd9, 0x1e, 0xb8, 0xf5, 0x68, 0x2a,
+    0x0f, 0x36, 0xf0, 0xe0, 0x98, 0xad, 0x2b, 0x31, 0x66, 0x93, 0x36, 0x3f, 0x06, 0x07, 0x1d, 0x5f,
+    0x6f, 0x17, 0x4f, 0xf7, 0xb5, 0xfc, 0xa9, 0xa8, 0x6f, 0xd2, 0xac, 0x0d, 0xfb, 0x9e, 0xd2, 0x3d,
+    0xe0, 0xf7, 0x29, 0x7d, 0x3f, 0xb1, 0x9b, 0x9b, 0x63, 0x2f, 0x1d, 0x5c, 0xbe, 0x67, 0x3a, 0xe6,
+    0x69, 0x90, 0x9c, 0xdc, 0xaf, 0x37, 0xec, 0x7b, 0xb5, 0x9c, 0x75, 0xf1, 0xec, 0x21, 0x9f, 0x7d,
+    0x62, 0x14, 0xd3, 0xb0, 0x17, 0xb7, 0xa4, 0xf2, 0x96, 0x79, 0x5b, 0xe8, 0xa0, 0x97, 0x60, 0xfe,
+    0xfa, 0xdf, 0xce, 0x22, 0xc4, 0xe2, 0xab, 0x53, 0x2b, 0x5a, 0x36, 0xd2, 0xe1, 0x14, 0x13, 0x0d,
+    0xf6, 0x3b, 0x9e, 0x50, 0x51, 0x3c, 0xda, 0x71, 0x32, 0x7c, 0x37, 0x80, 0x74, 0x7c, 0x3d, 0xaf,
+    0xdb, 0xf2, 0x6d, 0xc9, 0xb9, 0x6e, 0x3f, 0x72, 0xae, 0xee, 0xd8, 0x7e, 0x8b, 0x25, 0x99, 0x01,
+    0x8a, 0xa5, 0x9e, 0xfe, 0x62, 0xa8, 0xcb, 0xf6, 0x2a, 0xb6, 0x7b, 0x82, 0x8e, 0x86, 0x66, 0x99,
+    0x8e, 0xd7, 0x1f, 0x4f, 0x28, 0x45, 0x28, 0x61, 0xeb, 0x4c, 0xfd, 0x38, 0x96, 0x37, 0x88, 0x2d,
+    0x41, 0xd3, 0x76, 0x8b, 0xe1, 0xde, 0x8e, 0xd6, 0xa5, 0xd3, 0x67, 0x17, 0x0e, 0x0f, 0x54, 0xb9,
+    0x1d, 0x6f, 0x3b, 0x81, 0xd9, 0xee, 0xb3, 0xab, 0x06, 0x1f, 0x04, 0xe7, 0xa7, 0xfa, 0x70, 0x47,
+    0x2e, 0xee, 0xb9, 0xad, 0x1b, 0x10, 0xa7, 0x39, 0xb9, 0x37, 0x6c, 0x10, 0xfd, 0x64, 0x52, 0x6f,
+    0x36, 0x8f, 0xf2, 0x7c, 0xff, 0xbe, 0x3e, 0x9c, 0x3d, 0x8c, 0x63, 0xbb, 0xbb, 0x66, 0x8b, 0x9b,
+    0xe5, 0xc0, 0x4d, 0xd3, 0x6c, 0x9c, 0x0c, 0xdc, 0xb4, 0xa8, 0xb7, 0xef, 0x97, 0xeb, 0xef, 0xa2,
+    0xf9, 0x6c, 0xb3, 0xed, 0xd8, 0xf7, 0xc3, 0x3e, 0x9f, 0xb1, 0x65, 0xc7, 0xc0, 0x3b, 0x85, 0x1c,
+    0xc1, 0x22, 0x14, 0x7a, 0x3f, 0x12, 0xf7, 0xf5, 0x75, 0x41, 0x3e, 0xe0, 0x68, 0xed, 0xc9, 0x5c,
+    0x5c, 0x00, 0x77, 0xae, 0xbf, 0x9b, 0x61, 0x4d, 0x27, 0xeb, 0xe5, 0x7c, 0x7e, 0x3d, 0x5e, 0x1f,
+    0x63, 0xed, 0x0b, 0x1a, 0xa1, 0xca, 0x98, 0x7c, 0x77, 0xca, 0x7f, 0x7d, 0x9a, 0xf8, 0xfc, 0x36,
+    0x6f, 0xef, 0xef, 0xae, 0x9f, 0x16, 0x13, 0x47, 0x66, 0x4a, 0x1f, 0x98, 0x03, 0xd3, 0xcb, 0x56,
+    0xb3, 0x4f, 0x88, 0x8d, 0xbd, 0x7d, 0x0f, 0xcb, 0x74, 0x84, 0x03, 0x4f, 0x47, 0x6e, 0x93, 0x6d,
+    0x1e, 0x1c, 0xdb, 0xc3, 0x60, 0xf0, 0x88, 0x31, 0xd5, 0xc0, 0x7c, 0xbc, 0xd9, 0x46, 0x93, 0xdb,
+    0xd9, 0x7c, 0x7a, 0x4c, 0xdb, 0xbb, 0xb9, 0x0c, 0x42, 0x60, 0xbb, 0x95, 0x78, 0x53, 0xcf, 0xeb,
+    0xc9, 0xb6, 0x3e, 0x95, 0x34, 0x3f, 0x9a, 0x9c, 0x76, 0x75, 0xc2, 0x53, 0xd9, 0x62, 0x37, 0x84,
+    0xcd, 0x66, 0x36, 0xed, 0x17, 0x4f, 0x06, 0xb5, 0xf1, 0x29, 0x99, 0x77, 0x92, 0x7e, 0x5f, 0x52,
+    0x7b, 0x78, 0x3b, 0x5e, 0x75, 0x52, 0xa0, 0xe1, 0xe1, 0xc6, 0xd4, 0xf9, 0x03, 0x30, 0xd3, 0x97,
+    0x75, 0xed, 0xa1, 0xd9, 0x07, 0x1a, 0x5d, 0xa3, 0xd5, 0xbe, 0x0d, 0x8e, 0x6f, 0x3b, 0xf4, 0x53,
+    0x8c, 0xf3, 0xeb, 0xec, 0x66, 0x98, 0x84, 0x86, 0x12, 0x9d, 0x0d, 0x66, 0x3c, 0x9e, 0x47, 0x08,
+    0xb6, 0xcd, 0x50, 0xda, 0x32, 0x5b, 0x50, 0x45, 0x45, 0x5d, 0x33, 0xc9, 0x12, 0x43, 0x20, 0xe4,
+    0x73, 0xf5, 0x36, 0xf8, 0x0d, 0xf4, 0x73, 0x8c, 0x36, 0x27, 0xf3, 0xf6, 0x47, 0x91, 0xf0, 0xc1,
+    0x09, 0xc5, 0x47, 0x8a, 0xa3, 0xd3, 0x76, 0x77, 0x45, 0xf6, 0xf7, 0xd7, 0x77, 0xab, 0xed, 0xc7,
+    0x88, 0x9c, 0xd1, 0xd1, 0x2a, 0x0f, 0x24, 0x9a, 0xbd, 0x92, 0x4a, 0x32, 0xb4, 0x2c, 0xc3, 0x79,
+    0x42, 0xa7, 0xb3, 0xcd, 0xbb, 0xb7, 0xc7, 0xa6, 0x71, 0xe5, 0x50, 0x81, 0xa1, 0xfb, 0xee, 0x03,
+    0x0c, 0xd0, 0x11, 0x49, 0xd9, 0xb1, 0xad, 0x56, 0xb3, 0xc5, 0xa2, 0x83, 0x33, 0xfd, 0x85, 0xef,
+    0xa5, 0xad, 0x3b, 0x29, 0x3e, 0x38, 0xaa, 0xee, 0xbb, 0x3b, 0x5e, 0xb3, 0x7b, 0xc0, 0xf4, 0xfa,
+    0x3f, 0xcb, 0xc2, 0xe0, 0xf0, 0xa3, 0x1d, 0xff, 0xfb, 0xe5, 0x85, 0xb3, 0x46, 0x0f, 0x28, 0xf0,
+    0xfd, 0xf2, 0x67, 0xed, 0x84, 0x60, 0xbc, 0x98, 0xdd, 0x8d, 0x3d, 0xc6, 0x72, 0x5a, 0x68, 0x39,
+    0xdf, 0x34, 0x29, 0x00, 0x26, 0x73, 0xc3, 0x92, 0x71, 0x7d, 0x64, 0xb3, 0xa6, 0x96, 0xd4, 0x19,
+    0x38, 0x80, 0x77, 0x3b, 0x9b, 0xc0, 0x85, 0x9a, 0xe5, 0xbe, 0x9b, 0x4d, 0xa7, 0xf3, 0x23, 0x9c,
+    0xfc, 0xe7, 0xef, 0xea, 0x8f, 0x37, 0xeb, 0xf1, 0x5d, 0xbd, 0xf1, 0xdd, 0xb5, 0x5c, 0xa5, 0xad,
+    0x32, 0x3a, 0x92, 0x73, 0xbd, 0xe4, 0x42, 0x9f, 0xa5, 0x39, 0xcb, 0x4f, 0xad, 0x69, 0x7f, 0xea,
+    0xaf, 0xcb, 0x74, 0xf6, 0x6e, 0xd6, 0xcd, 0x37, 0xf7, 0x36, 0x7e, 0x66, 0x89, 0x4b, 0xbd, 0xaf,
+    0xc6, 0xeb, 0x9a, 0x45, 0xe4, 0x26, 0x9c, 0x3a, 0xef, 0xbe, 0x3a, 0xae, 0x53, 0x49, 0xd9, 0x27,
+    0xc7, 0x6a, 0xf5, 0x1e, 0xfe, 0x05, 0x93, 0x2d, 0xdf, 0x0f, 0xf9, 0xcb, 0x00, 0x42, 0x74, 0x01,
+    0xea, 0x01, 0x6c, 0x1d, 0xea, 0xa2, 0x97, 0x03, 0xb2, 0x79, 0xb4, 0x78, 0xe4, 0x89, 0x83, 0x58,
+    0x43, 0x5d, 0x3d, 0x83, 0xac, 0x7e, 0x61, 0x38, 0xc1, 0x2f, 0x06, 0x2f, 0x3f, 0xae, 0xf2, 0xbf,
+    0x30, 0x31, 0xf8, 0x7b, 0x25, 0xdf, 0x0b, 0x53, 0xc4, 0x1f, 0xa0, 0xe0, 0x7e, 0x64, 0x72, 0x2f,
+    0x5c, 0x2e, 0x90, 0x7c, 0x9d, 0xed, 0x53, 0xb6, 0x57, 0xcf, 0x14, 0x70, 0xa7, 0x28, 0x73, 0xf8,
+    0xfd, 0xe3, 0x21, 0x3c, 0x9c, 0x2a, 0x66, 0x4f, 0x4a, 0x15, 0x8f, 0x7d, 0x69, 0x10, 0x9e, 0xed,
+    0x60, 0xfd, 0xb7, 0xfb, 0xee, 0x1e, 0x00, 0xa2, 0x25, 0xe0, 0x66, 0xb6, 0x78, 0xd4, 0x86, 0xf1,
+    0x66, 0x32, 0x5e, 0x2c, 0xe0, 0x69, 0xbd, 0x3e, 0xfb, 0x08, 0x67, 0x4e, 0xe2, 0xdb, 0x03, 0x36,
+    0xe9, 0x36, 0xd9, 0xb2, 0x4b, 0xcf, 0xa0, 0x97, 0xe7, 0xad, 0x0d, 0xb2, 0x4b, 0xee, 0x48, 0xed,
+    0x8a, 0xca, 0xeb, 0xfa, 0xe6, 0x6a, 0x74, 0xbb, 0xdd, 0xae, 0x36, 0x17, 0xe7, 0xe7, 0xd4, 0x23,
+    0x9b, 0xf8, 0xed, 0x72, 0xf9, 0x76, 0x5e, 0x8f, 0x57, 0xb3, 0x4d, 0x3c, 0x59, 0xde, 0x9d, 0x4f,
+    0x36, 0x1b, 0xfb, 0x4b, 0xbf, 0xcb, 0x75, 0xa5, 0x3d, 0xae, 0x8b, 0xf7, 0xb0, 0xcb, 0x3f, 0x3b,
+    0x48, 0x36, 0xca, 0xb6, 0x3c, 0x49, 0x7e, 0xd6, 0xf8, 0xe2, 0xd5, 0xe6, 0xfd, 0x78, 0x35, 0x6a,
+    0x5a, 0x5e, 0xd7, 0xf3, 0xab, 0x91, 0x7a, 0xdd, 0xdc, 0xd6, 0xf5, 0xd6, 0xbf, 0xad, 0x9d, 0xbd,
+    0xcb, 0xf3, 0xdd, 0x56, 0xe2, 0x25, 0x37, 0xd4, 0x9a, 0x41, 0x01, 0x25, 0x83, 0x09, 0x74, 0xee,
+    0xe6, 0x6a, 0xc4, 0xcd, 0x87, 0xd1, 0x6e, 0x33, 0xef, 0x12, 0x73, 0x3c, 0xac, 0xb1, 0xbf, 0x80,
+    0xf5, 0xfb, 0xd1, 0x01, 0xe2, 0x67, 0xf5, 0xfb, 0x2f, 0x96, 0x1f, 0xae, 0x46, 0x2c, 0x4d, 0xd9,
+    0x24, 0xf1, 0x3f, 0x46, 0xed, 0xfa, 0x3b, 0x86, 0x42, 0x79, 0x7c, 0x78, 0xef, 0xc3, 0xdd, 0x7c,
+    0xb1, 0xf1, 0x13, 0xc7, 0xbc, 0xdf, 0xbf, 0x7f, 0x1f, 0xbf, 0x4f, 0xe3, 0xe5, 0xfa, 0xed, 0x39,
+    0x6f, 0x3d, 0x47, 0x97, 0xa3, 0x36, 0x83, 0x6c, 0xb0, 0x4c, 0x57, 0x23, 0x13, 0x9b, 0x5e, 0x03,
+    0x17, 0x1f, 0x68, 0xca, 0xa1, 0x66, 0x4c, 0x55, 0x55, 0xe7, 0xfa, 0x74, 0x77, 0xcb, 0xeb, 0xfd,
+    0xad, 0x97, 0x3f, 0x89, 0xa2, 0xe0, 0x77, 0x35, 0xa8, 0x7a, 0xbc, 0xa5, 0xc3, 0xfe, 0x6a, 0xba,
+    0xbc, 0xae, 0x83, 0xaf, 0xe6, 0x73, 0x44, 0xa7, 0xde, 0x0a, 0xd2, 0x24, 0xc6, 0xbf, 0x61, 0xf0,
+    0xe6, 0xcf, 0xbf, 0x0b, 0x7e, 0xf3, 0x81, 0x3b, 0xa8, 0xc1, 0x1f, 0xe7, 0xf7, 0x6f, 0xa3, 0xaf,
+    0x16, 0x41, 0xac, 0x37, 0xff, 0xec, 0xc7, 0x04, 0xe7, 0x8c, 0x31, 0xaa, 0xe0, 0x8b, 0x7b, 0x66,
+    0x06, 0xc6, 0xa6, 0xaf, 0x82, 0x20, 0x8a, 0x5a, 0x3d, 0x4d, 0xeb, 0x9b, 0xcd, 0xeb, 0x16, 0x7d,
+    0x75, 0xf7, 0x49, 0xf7, 0x19, 0x75, 0xd2, 0xe1, 0xb8, 0x9d, 0xcd, 0xc8, 0xd7, 0xe6, 0x26, 0xbd,
+    0x49, 0x7f, 0xd1, 0xf9, 0xf0, 0xd3, 0x67, 0xfd, 0xdb, 0xcd, 0x89, 0xdb, 0xef, 0xd7, 0xf3, 0xb3,
+    0xcf, 0x7b, 0x54, 0x66, 0x5f, 0x3d, 0xd6, 0x9a, 0x3d, 0x35, 0x98, 0x34, 0x37, 0xf5, 0x21, 0x51,
+    0x3a, 0x75, 0x7b, 0x7a, 0xea, 0xf6, 0xea, 0x3a, 0xaf, 0x5d, 0xfe, 0xd8, 0xed, 0xee, 0x19, 0x73,
+    0x31, 0x8f, 0xce, 0x25, 0x3b, 0x69, 0xd8, 0xeb, 0x9b, 0xc9, 0x4d, 0xf9, 0xd8, 0xed, 0xf9, 0xa9,
+    0xdb, 0xaf, 0xaf, 0xaf, 0xab, 0xeb, 0xec, 0xb1, 0xdb, 0x8b, 0x67, 0xcc, 0xc5, 0x3d, 0x3a, 0x97,
+    0xf2, 0x19, 0xad, 0x65, 0x8f, 0xb6, 0x56, 0x3d, 0xa3, 0xb5, 0xf4, 0xd1, 0xd6, 0xcc, 0x49, 0x0f,
+    0x2e, 0x8c, 0x9b, 0xa4, 0xc9, 0xa3, 0xf7, 0x9f, 0x72, 0xe1, 0x5e, 0x41, 0xe9, 0xe4, 0xfd, 0xf6,
+    0x19, 0xd3, 0x79, 0x7c, 0x36, 0x27, 0x7d, 0xb8, 0x98, 0xb8, 0x89, 0x9d, 0x3c, 0x7a, 0xff, 0x29,
+    0x27, 0xfe, 0x7c, 0x5c, 0x15, 0xd6, 0x1d, 0xb9, 0x5d, 0x0b, 0x1f, 0xce, 0x8f, 0x00, 0xe2, 0xd2,
+    0x8f, 0xfe, 0x77, 0xcd, 0xe0, 0x3b, 0xb7, 0xce, 0xa6, 0xc0, 0xe2, 0xee, 0xe4, 0x46, 0x9d, 0x0b,
+    0x3e, 0x98, 0xab, 0x51, 0xea, 0x8a, 0x38, 0xc9, 0xbb, 0xef, 0x7f, 0xc4, 0xfb, 0x26, 0xc9, 0x6d,
+    0x5c, 0x64, 0xbd, 0x1b, 0x2c, 0x3e, 0x48, 0xcb, 0x2c, 0x76, 0x55, 0xef, 0x0e, 0x7b, 0xe2, 0x8e,
+    0x5d, 0xc7, 0x7f, 0x02, 0x65, 0x02, 0xd1, 0xef, 0x37, 0xf5, 0xfa, 0x0d, 0x78, 0xb0, 0xfe, 0x66,
+    0xf1, 0xa7, 0x4d, 0xdd, 0xbe, 0xb4, 0x8b, 0x7a, 0x40, 0xc2, 0xe5, 0x2a, 0x58, 0xde, 0xdc, 0xe8,
+    0x08, 0x4b, 0x32, 0x0a, 0x36, 0xfb, 0x3c, 0xe5, 0x6a, 0xf4, 0xf9, 0x78, 0x52, 0x5c, 0x67, 0xc9,
+    0xfe, 0x24, 0xca, 0xf0, 0x4d, 0xb1, 0x2b, 0x7a, 0xb7, 0x5d, 0xa7, 0xd0, 0x32, 0xe5, 0x23, 0xb7,
+    0x99, 0xde, 0x4d, 0x55, 0x99, 0x17, 0xa9, 0xed, 0xdd, 0x74, 0x79, 0xde, 0x35, 0xfb, 0xdf, 0xb1,
+    0x22, 0x66, 0x60, 0x49, 0x52, 0x1b, 0x97, 0xc5, 0xf1, 0x92, 0xe4, 0x25, 0x94, 0xc3, 0xc0, 0x82,
+    0xd8, 0xac, 0x88, 0xf3, 0x62, 0x60, 0x41, 0xac, 0x71, 0x71, 0xe6, 0x7e, 0x84, 0x05, 0xf1, 0x2a,
+    0xf1, 0xb1, 0x05, 0xb1, 0xb6, 0x77, 0x9b, 0x3f, 0x09, 0xf0, 0xe8, 0x3a, 0x56, 0xfd, 0xde, 0x26,
+    0x65, 0x91, 0x5d, 0x3f, 0x76, 0x5b, 0xe1, 0xfa, 0x5e, 0xa3, 0xdd, 0xa7, 0x67, 0x2e, 0xff, 0xd8,
+    0xe6, 0x55, 0x3a, 0xf9, 0xe1, 0x96, 0xdf, 0x1e, 0x2f, 0xbf, 0x29, 0x32, 0xc4, 0x51, 0x3a, 0xb0,
+    0xfe, 0x15, 0x32, 0xf8, 0xa1, 0x88, 0x74, 0x69, 0x16, 0x97, 0x66, 0xc8, 0x01, 0xd2, 0x2a, 0xb6,
+    0xf9, 0x8f, 0xe0, 0x00, 0x35, 0xc8, 0xbb, 0xce, 0x9e, 0x6b, 0xdb, 0x9b, 0xeb, 0x64, 0x7c, 0xfd,
+    0xc3, 0xd9, 0x36, 0x1d, 0xb0, 0x6d, 0x5e, 0x54, 0xc7, 0xe0, 0xc5, 0x0f, 0xf0, 0x4f, 0x9c, 0xd9,
+    0x21, 0xe3, 0x16, 0xb0, 0x7a, 0x79, 0x6c, 0xdc, 0xc2, 0x55, 0x71, 0x9a, 0xfe, 0x08, 0xb6, 0x2d,
+    0x93, 0x32, 0x29, 0x6e, 0x9e, 0x69, 0xdb, 0xeb, 0x31, 0xfe, 0xfd, 0x01, 0x6d, 0xeb, 0x8e, 0x6d,
+    0x9b, 0x95, 0x80, 0xa1, 0xec, 0xd8, 0xb4, 0x65, 0x9a, 0xc6, 0x85, 0x19, 0xc2, 0x2d, 0xb8, 0xed,
+    0x10, 0x8f, 0xd8, 0xa4, 0x88, 0xab, 0xf2, 0x47, 0xb0, 0xec, 0xcd, 0xcd, 0x73, 0xcd, 0x5a, 0x5e,
+    0x97, 0x93, 0x32, 0xff, 0xe1, 0xcc, 0x9a, 0x1d, 0x9b, 0xb5, 0x30, 0x36, 0x4e, 0x07, 0x3c, 0xb6,
+    0x4a, 0x5c, 0x9c, 0x0e, 0x99, 0xd5, 0x98, 0x3c, 0xce, 0x07, 0x1c, 0xd6, 0x98, 0xb4, 0x38, 0xc2,
+    0x95, 0xff, 0x16, 0xbb, 0x12, 0x63, 0x7a, 0x76, 0x9a, 0xc0, 0x52, 0xc5, 0x33, 0x8d, 0x5b, 0xdf,
+    0xdc, 0x98, 0xba, 0x7e, 0xb2, 0x71, 0x2f, 0xcf, 0xbb, 0xf9, 0xd3, 0xe5, 0xdb, 0xce, 0x7d, 0xab,
+    0xf1, 0xf6, 0xb6, 0xd3, 0x79, 0x93, 0x9d, 0x6e, 0xfa, 0x98, 0x8b, 0x55, 0xf8, 0xda, 0x94, 0x39,
+    0xa8, 0xb2, 0x0c, 0x8b, 0x0a, 0xbe, 0x3a, 0x89, 0x0c, 0x40, 0x22, 0x8d, 0x40, 0xac, 0xb1, 0x29,
+    0x23, 0x93, 0x25, 0x71, 0x95, 0x47, 0x36, 0x29, 0xe3, 0x2a, 0xb2, 0x45, 0x1a, 0x1b, 0x17, 0xe1,
+    0xfa, 0xb8, 0xc2, 0x15, 0x2e, 0x36, 0x26, 0xb4, 0x20, 0xd9, 0xc8, 0x96, 0xb8, 0x25, 0x2c, 0x00,
+    0x15, 0x91, 0xb3, 0x71, 0x6e, 0x42, 0x03, 0xd8, 0x08, 0x4d, 0x5c, 0x99, 0xc8, 0xba, 0x38, 0xaf,
+    0xf0, 0xb2, 0x8c, 0x00, 0xec, 0x06, 0x2d, 0xc5, 0x59, 0x16, 0x15, 0x39, 0x04, 0x4a, 0x54, 0x80,
+    0xe8, 0x23, 0x97, 0xb2, 0xfd, 0x2c, 0x03, 0x65, 0x45, 0x18, 0x86, 0xc9, 0xa2, 0x0a, 0x69, 0x63,
+    0x1a, 0x95, 0x26, 0x4e, 0x6d, 0x04, 0x08, 0xcf, 0x1d, 0x47, 0x64, 0x33, 0xbe, 0x93, 0x73, 0x0c,
+    0xb1, 0xb3, 0x18, 0x9d, 0x63, 0x0b, 0x69, 0x1e, 0xdb, 0x22, 0x82, 0x32, 0xc0, 0x4f, 0x2c, 0x3c,
+    0x1a, 0x32, 0x39, 0xae, 0xb2, 0x1c, 0x50, 0x9a, 0xa2, 0xef, 0x34, 0x76, 0x79, 0x94, 0xba, 0x38,
+    0xb1, 0x51, 0x86, 0x46, 0xa2, 0x14, 0x54, 0x11, 0x19, 0xb4, 0xea, 0x4a, 0x74, 0xcf, 0xf9, 0x55,
+    0x65, 0x9c, 0x99, 0x28, 0xe3, 0x1b, 0xb8, 0xb5, 0xac, 0xe2, 0x12, 0x8d, 0x58, 0x18, 0x22, 0x0b,
+    0x71, 0x31, 0xe6, 0x8a, 0x8f, 0x5c, 0x58, 0xe2, 0x65, 0xe1, 0xe2, 0x02, 0x46, 0x8a, 0x2d, 0x5a,
+    0x00, 0xfc, 0x25, 0x59, 0x68, 0x60, 0x14, 0xf4, 0x65, 0x6d, 0xec, 0x4c, 0x88, 0x78, 0x4e, 0xd0,
+    0x06, 0xfc, 0x15, 0x1f, 0xa8, 0x47, 0x83, 0xd8, 0x37, 0x68, 0x26, 0x51, 0xa7, 0x18, 0x7e, 0x62,
+    0x42, 0xce, 0xdc, 0x70, 0x12, 0x99, 0x0b, 0x2d, 0x46, 0x8f, 0xdb, 0x31, 0xd1, 0x32, 0xe4, 0xb0,
+    0x1d, 0x8d, 0x65, 0x6d, 0x58, 0x65, 0x34, 0x6f, 0x0e, 0x2b, 0x84, 0x85, 0x46, 0x87, 0x3e, 0x8b,
+    0xd0, 0x64, 0x18, 0x04, 0x4c, 0x9a, 0x87, 0x36, 0xe5, 0x20, 0x30, 0x3c, 0x87, 0xc6, 0xa1, 0x96,
+    0xca, 0x10, 0x0c, 0x58, 0x85, 0x79, 0x16, 0x67, 0x85, 0x2c, 0x5f, 0x86, 0x98, 0x95, 0xad, 0xd4,
+    0x01, 0xd6, 0xa2, 0x4c, 0xf7, 0xad, 0x86, 0x69, 0x5e, 0xc5, 0x15, 0xba, 0xc6, 0xa0, 0xf2, 0x2c,
+    0xcc, 0x12, 0xc3, 0x35, 0x34, 0x19, 0x9c, 0x98, 0x83, 0x2e, 0xf3, 0x90, 0x78, 0xe5, 0x38, 0xe6,
+    0xa2, 0x0a, 0x33, 0xb0, 0x42, 0x15, 0x62, 0x45, 0x53, 0x18, 0x11, 0x2b, 0x94, 0x45, 0xb1, 0x91,
+    0x47, 0x14, 0xa1, 0x4d, 0x64, 0x3d, 0xda, 0x24, 0x0b, 0x61, 0xe6, 0x34, 0x83, 0x6d, 0xd9, 0x3e,
+    0xee, 0x8b, 0xd4, 0x6d, 0xc9, 0xf5, 0xc3, 0x24, 0x6c, 0x68, 0x60, 0x48, 0x58, 0x22, 0xcc, 0x65,
+    0x26, 0xdc, 0x17, 0x82, 0x6e, 0xca, 0x02, 0xa6, 0x2c, 0xd1, 0x37, 0x2e, 0x29, 0x42, 0xda, 0x33,
+    0x0f, 0x5d, 0xa6, 0x2b, 0x60, 0x8b, 0xc2, 0x86, 0xb0, 0x64, 0x82, 0xce, 0xc9, 0xee, 0x61, 0x8e,
+    0x16, 0x5c, 0x08, 0xc7, 0x80, 0x1d, 0xbc, 0x81, 0x4b, 0xb8, 0x19, 0x67, 0x4e, 0x97, 0xc4, 0xb8,
+    0x80, 0x06, 0x68, 0x04, 0xae, 0x56, 0xc2, 0xc1, 0x78, 0x29, 0x41, 0x14, 0xbd, 0x17, 0xe8, 0xc0,
+    0x19, 0xbe, 0x06, 0x90, 0xc0, 0x5c, 0x0e, 0x37, 0x71, 0x7c, 0x5c, 0x3c, 0x09, 0x47, 0x9a, 0xdc,
+    0x85, 0x06, 0x9e, 0x0f, 0x17, 0xa2, 0xf4, 0x28, 0xe4, 0x4b, 0x25, 0xa7, 0x8c, 0x25, 0x81, 0xbf,
+    0x66, 0x74, 0x34, 0x78, 0x60, 0x99, 0x46, 0xb0, 0x0d, 0xbc, 0x0a, 0x39, 0x03, 0xfd, 0x38, 0x89,
+    0xe1, 0x98, 0x46, 0xae, 0x07, 0x07, 0x83, 0x7f, 0xd2, 0xf5, 0x1c, 0x5f, 0x63, 0x7c, 0x68, 0xbb,
+    0x80, 0x6f, 0xe7, 0xb8, 0x3e, 0x24, 0x24, 0xc1, 0x6c, 0x09, 0xfc, 0x93, 0xa6, 0x36, 0x1c, 0xaf,
+    0x29, 0x6c, 0x6c, 0x61, 0x87, 0x0c, 0x43, 0x86, 0x3b, 0x80, 0x4c, 0xb1, 0xac, 0x18, 0x74, 0x52,
+    0x45, 0x55, 0xa5, 0x05, 0x00, 0x9f, 0x94, 0x70, 0x0e, 0x74, 0x99, 0x60, 0x7d, 0x73, 0xba, 0x10,
+    0x8c, 0x98, 0x85, 0x70, 0x76, 0xce, 0x06, 0x8e, 0x81, 0x19, 0x63, 0xc9, 0xd1, 0xbd, 0x05, 0xad,
+    0x67, 0xe9, 0x5f, 0xbe, 0x36, 0x99, 0xa5, 0xe4, 0x85, 0x0b, 0x28, 0x34, 0x27, 0xfc, 0x49, 0x87,
+    0x44, 0xaf, 0x15, 0x2d, 0x63, 0xe0, 0x0f, 0xf0, 0x47, 0xf4, 0x46, 0x17, 0x86, 0xab, 0x27, 0x16,
+    0xd6, 0xb4, 0x39, 0x23, 0x19, 0x21, 0x5a, 0x70, 0x8a, 0xb8, 0x24, 0x29, 0x78, 0x09, 0xcc, 0xc4,
+    0xe9, 0x96, 0x5c, 0x20, 0x78, 0x69, 0xa5, 0x95, 0x41, 0x83, 0x70, 0x6b, 0xf8, 0x59, 0x08, 0x53,
+    0x31, 0x50, 0xb4, 0x78, 0x30, 0x45, 0xc2, 0x55, 0xc2, 0x74, 0x8d, 0xae, 0x07, 0x16, 0x64, 0x44,
+    0x0f, 0xde, 0x90, 0x17, 0x6c, 0x19, 0x5e, 0x8b, 0x58, 0xc5, 0x88, 0x8d, 0xbc, 0x16, 0x6e, 0x83,
+    0x05, 0x84, 0x87, 0x1a, 0x2c, 0x4b, 0x02, 0x73, 0xa4, 0x8c, 0x0d, 0x2e, 0x75, 0xc5, 0x90, 0xcf,
+    0x72, 0xc4, 0x49, 0x94, 0xe7, 0xf4, 0x54, 0x93, 0xe0, 0x33, 0x62, 0x0e, 0x9c, 0x0e, 0x3f, 0xb0,
+    0x16, 0x19, 0x6f, 0x56, 0x67, 0x2e, 0xc2, 0x72, 0x01, 0x5d, 0x68, 0x9e, 0x9c, 0xe3, 0x82, 0xcf,
+    0x16, 0x9c, 0x50, 0x6a, 0xb8, 0xa8, 0x4e, 0xf8, 0x82, 0xcf, 0xd2, 0xd0, 0xca, 0x2b, 0xe0, 0x76,
+    0x56, 0x60, 0x05, 0x93, 0x62, 0x50, 0x29, 0x23, 0xde, 0xe2, 0x43, 0x44, 0x6b, 0x1a, 0x41, 0x5f,
+    0x96, 0xe5, 0x5f, 0xda, 0xe8, 0x78, 0xfe, 0x44, 0x48, 0x35, 0xe9, 0x31, 0xa6, 0x66, 0x58, 0x60,
+    0x57, 0xd1, 0xf9, 0xe0, 0xba, 0x1b, 0x0b, 0x13, 0x21, 0x04, 0x6d, 0xca, 0x50, 0x82, 0x67, 0x23,
+    0x14, 0x2b, 0xf9, 0xa2, 0x9d, 0x18, 0xc5, 0x7f, 0x54, 0x62, 0x09, 0x0a, 0x44, 0x33, 0x1d, 0x8e,
+    0x60, 0x14, 0xa6, 0xb0, 0x0c, 0x61, 0x10, 0x31, 0x91, 0xbb, 0x30, 0x09, 0x93, 0x28, 0x2d, 0x32,
+    0x5a, 0xc6, 0x78, 0xb8, 0xab, 0x18, 0x86, 0x88, 0x21, 0xac, 0x11, 0x3c, 0x00, 0x0b, 0x5c, 0x00,
+    0xdd, 0xac, 0x50, 0x0f, 0x77, 0x16, 0xe5, 0xc0, 0x2f, 0x6a, 0xc5, 0x0a, 0x2a, 0xe8, 0x10, 0x40,
+    0x01, 0x3a, 0x37, 0x40, 0x86, 0xde, 0xfa, 0xc2, 0xa9, 0x0f, 0xd1, 0x09, 0x73, 0x64, 0xa0, 0x4a,
+    0x91, 0x60, 0x89, 0xb3, 0x0d, 0xac, 0x0b, 0x5c, 0xc8, 0x12, 0x61, 0x78, 0x8a, 0x1e, 0x11, 0x1e,
+    0x39, 0x9c, 0xbc, 0xaa, 0x26, 0x84, 0x7a, 0xc4, 0x04, 0x5c, 0x14, 0x84, 0x63, 0xb3, 0x94, 0xce,
+    0x64, 0xc0, 0x34, 0x88, 0x02, 0x57, 0x7a, 0xd0, 0x03, 0x02, 0xe5, 0x44, 0x5e, 0xfc, 0x84, 0x89,
+    0x52, 0xe0, 0x3f, 0x1a, 0x02, 0xd8, 0xd0, 0x4a, 0x95, 0x9f, 0x38, 0x5c, 0x32, 0xc7, 0x9b, 0xf0,
+    0x18, 0x5c, 0x86, 0x50, 0xa5, 0x2d, 0x10, 0xe2, 0x24, 0xa8, 0x92, 0x30, 0x7c, 0x78, 0x49, 0x03,
+    0x00, 0x31, 0x00, 0x0b, 0x70, 0xb0, 0x42, 0xc3, 0x2a, 0x19, 0x1e, 0xf0, 0x34, 0x83, 0xb5, 0xb2,
+    0x02, 0x07, 0x0c, 0x17, 0x90, 0x85, 0x90, 0x82, 0xf5, 0x1d, 0xd7, 0x90, 0x19, 0xa6, 0x11, 0x04,
+    0x38, 0x2d, 0x44, 0x08, 0xb0, 0x48, 0xf0, 0x3b, 0x04, 0x48, 0x48, 0xfa, 0x28, 0x33, 0x46, 0x47,
+    0x31, 0x8f, 0xe8, 0x56, 0x60, 0x84, 0xec, 0x45, 0x96, 0x74, 0xff, 0xdf, 0x90, 0xff, 0x3d, 0x86,
+    0x34, 0xe6, 0xd8, 0x92, 0x29, 0x08, 0x1d, 0x58, 0x92, 0x13, 0xe8, 0xca, 0x4d, 0x84, 0x98, 0x02,
+    0xb5, 0x64, 0x20, 0x06, 0x22, 0x20, 0x66, 0x94, 0x01, 0x92, 0x38, 0x00, 0x3b, 0x51, 0x88, 0x18,
+    0x4e, 0x0c, 0xbc, 0x6e, 0xbc, 0xf4, 0x71, 0x54, 0x14, 0x85, 0x4b, 0x76, 0xc3, 0x16, 0xa0, 0x03,
+    0x94, 0x4b, 0xc1, 0x1a, 0x28, 0xb4, 0x48, 0xc3, 0x1c, 0x40, 0x94, 0xce, 0x29, 0x60, 0x72, 0xb2,
+    0x7b, 0xe1, 0x36, 0x60, 0x02, 0x20, 0x67, 0x4a, 0x8d, 0x52, 0xc1, 0x18, 0x30, 0x2c, 0x20, 0x9c,
+    0xbc, 0x9c, 0xbf, 0x6c, 0x5a, 0x43, 0x0e, 0x92, 0x11, 0xd1, 0x40, 0x8f, 0xa0, 0xcf, 0x3c, 0xdf,
+    0x00, 0xe0, 0x0b, 0xfe, 0x5a, 0x61, 0xc0, 0xf4, 0x10, 0x4c, 0x16, 0x40, 0x9d, 0x92, 0x0a, 0xb4,
+    0x5e, 0x9c, 0x48, 0x4a, 0xb2, 0xa9, 0x00, 0x2f, 0x94, 0x1a, 0x80, 0x1d, 0x0c, 0xb5, 0x9a, 0x13,
+    0xa4, 0x09, 0xd5, 0x2f, 0xc4, 0x80, 0xe4, 0x78, 0x64, 0xae, 0x24, 0x25, 0x86, 0x19, 0xdc, 0x33,
+    0xb5, 0x9b, 0xa8, 0x11, 0x1d, 0x25, 0x55, 0x26, 0xe0, 0x2b, 0x75, 0x21, 0x8c, 0x5e, 0xa6, 0x13,
+    0x6a, 0x09, 0x0c, 0x98, 0xe8, 0x88, 0xb7, 0xa8, 0x9a, 0x2a, 0x0a, 0x10, 0x28, 0x13, 0x22, 0x14,
+    0x94, 0x05, 0x25, 0x22, 0x3e, 0xce, 0x1a, 0x26, 0x86, 0xfe, 0xb2, 0x30, 0x29, 0xf4, 0x06, 0xde,
+    0x05, 0xc8, 0xc3, 0xbf, 0x81, 0xfd, 0x45, 0x28, 0x4f, 0x17, 0x89, 0x80, 0xb4, 0x32, 0x91, 0x71,
+    0x92, 0x70, 0xb2, 0x19, 0x7b, 0x4b, 0xa3, 0x82, 0x04, 0x0b, 0xaa, 0xa7, 0x44, 0x0b, 0xad, 0x11,
+    0x67, 0xa3, 0x6b, 0xc8, 0x1d, 0xff, 0x49, 0xfb, 0x97, 0x17, 0xd9, 0x60, 0x80, 0x01, 0x1c, 0xbc,
+    0x9d, 0xd4, 0x8d, 0xc0, 0x28, 0xb3, 0xb9, 0x7c, 0x29, 0x04, 0xb7, 0xa5, 0x66, 0x43, 0x92, 0x85,
+    0xae, 0xf2, 0x5e, 0x04, 0xc7, 0x81, 0x18, 0x49, 0x26, 0x88, 0x60, 0x0c, 0xd4, 0xbf, 0x67, 0x11,
+    0x18, 0xd4, 0x1f, 0x0a, 0x5a, 0x5c, 0x01, 0xca, 0x07, 0x6d, 0x59, 0x12, 0x19, 0x3c, 0x2c, 0x25,
+    0x77, 0x51, 0xc0, 0xb0, 0xb5, 0xb0, 0x22, 0xa5, 0x41, 0xa2, 0x61, 0x4a, 0xf0, 0x50, 0xf0, 0x18,
+    0xe3, 0xde, 0x65, 0xa4, 0x40, 0x88, 0x48, 0xea, 0x87, 0xd4, 0x50, 0x5e, 0x83, 0x65, 0x1d, 0xec,
+    0x9c, 0x95, 0x91, 0x54, 0x00, 0x08, 0x55, 0xbe, 0x62, 0xa5, 0xeb, 0xa1, 0x3c, 0x0c, 0x35, 0x58,
+    0x61, 0xda, 0xaf, 0x5f, 0x64, 0x89, 0x01, 0x42, 0x48, 0x2b, 0xcb, 0x25, 0x67, 0x8a, 0xec, 0x0a,
+    0x38, 0x83, 0x7c, 0x81, 0xa2, 0x38, 0x2c, 0xb9, 0x78, 0xf2, 0xbc, 0x89, 0x6c, 0x12, 0x91, 0x95,
+    0xf1, 0x21, 0x8c, 0x41, 0x60, 0xa0, 0x4c, 0xce, 0x94, 0x96, 0x40, 0x01, 0x68, 0x48, 0x8a, 0xbd,
+    0x82, 0x12, 0xd8, 0x0b, 0x4b, 0x09, 0x57, 0x67, 0xa5, 0x7a, 0x5a, 0xbf, 0xcc, 0x19, 0xda, 0x19,
+    0x35, 0x1a, 0x94, 0x0e, 0x02, 0x10, 0x19, 0x03, 0xa4, 0x12, 0x2c, 0x9f, 0x7a, 0xb6, 0xad, 0x3c,
+    0x9e, 0x51, 0x4f, 0x20, 0x63, 0x81, 0x95, 0x27, 0xcd, 0xbc, 0xe1, 0x4d, 0x19, 0x42, 0xb6, 0x54,
+    0x3e, 0x93, 0x12, 0x76, 0x61, 0x55, 0x68, 0x64, 0x28, 0x4a, 0x18, 0xfb, 0x65, 0xe1, 0x31, 0x94,
+    0x70, 0x19, 0x46, 0x25, 0x04, 0x2d, 0xb1, 0x7c, 0x22, 0x19, 0x02, 0x87, 0xce, 0x05, 0xc8, 0x29,
+    0x96, 0x18, 0xf2, 0x37, 0xb5, 0x52, 0xa2, 0x9d, 0xdf, 0xe6, 0x85, 0xa4, 0x50, 0x41, 0xb1, 0x44,
+    0xcd, 0x88, 0x14, 0x8a, 0xd9, 0xd9, 0xc4, 0x3a, 0x0a, 0xd7, 0x08, 0xfa, 0x80, 0xf2, 0x8e, 0x77,
+    0xb8, 0x1d, 0x0b, 0xd8, 0xdc, 0x8b, 0x2a, 0xe3, 0x65, 0x63, 0xa6, 0xbc, 0x04, 0xe2, 0x91, 0x8e,
+    0x42, 0xc4, 0x4b, 0x15, 0x29, 0x69, 0xef, 0xb7, 0x77, 0x14, 0x56, 0x89, 0x45, 0xc3, 0xa4, 0x80,
+    0x82, 0x89, 0x9b, 0xe0, 0x9e, 0x8a, 0xcd, 0x11, 0x43, 0xd1, 0xae, 0xa1, 0xb5, 0x79, 0x41, 0xf2,
+    0x32, 0xbb, 0xe4, 0x03, 0x8e, 0x02, 0x8b, 0x67, 0x16, 0xc0, 0x4c, 0xa1, 0xb3, 0xb1, 0x14, 0xa8,
+    0x51, 0x95, 0x53, 0x30, 0x66, 0x18, 0x3f, 0x15, 0x2c, 0xfe, 0x03, 0x34, 0x4b, 0x61, 0x37, 0xfa,
+    0x87, 0xcc, 0x96, 0xc1, 0x7f, 0x18, 0x5a, 0x19, 0x7d, 0x85, 0x80, 0x83, 0xd1, 0x15, 0x86, 0x6b,
+    0x59, 0x50, 0x73, 0xa5, 0x2c, 0x1b, 0x32, 0x75, 0x48, 0x04, 0x3a, 0x99, 0x72, 0x05, 0x2c, 0xa7,
+    0x2c, 0xe6, 0xdb, 0x29, 0x99, 0x07, 0x30, 0xa5, 0x03, 0x51, 0x15, 0x8c, 0x07, 0x47, 0xd1, 0x85,
+    0x84, 0xb3, 0x8a, 0xbd, 0x5d, 0x70, 0x93, 0xa4, 0x64, 0x42, 0x93, 0x32, 0x6d, 0x8d, 0xe8, 0xcb,
+    0x10, 0x94, 0xbc, 0x42, 0xaa, 0x8a, 0x59, 0x08, 0x65, 0x34, 0x0c, 0x5f, 0x30, 0x4e, 0x23, 0x58,
+    0xbf, 0x78, 0x19, 0x94, 0x64, 0x03, 0xfe, 0xe2, 0x9c, 0xd2, 0xa6, 0x0c, 0x39, 0x44, 0x96, 0x01,
+    0xe7, 0x2b, 0x39, 0x76, 0xc3, 0xca, 0x56, 0xea, 0x17, 0xc3, 0x77, 0x76, 0x02, 0xf5, 0xec, 0x31,
+    0x2e, 0x65, 0x9a, 0xe9, 0x90, 0x31, 0x00, 0x70, 0xe1, 0xcc, 0xae, 0xfd, 0xda, 0x73, 0x2f, 0xe5,
+    0x33, 0xf2, 0x2a, 0xa5, 0x89, 0x15, 0x11, 0x83, 0x01, 0x40, 0x22, 0x4e, 0x98, 0xc7, 0x22, 0x34,
+    0x90, 0xc3, 0x59, 0xc0, 0x03, 0xb0, 0x02, 0xd0, 0x03, 0x8a, 0x77, 0xb9, 0xcf, 0x6a, 0xa1, 0xad,
+    0xbd, 0x0a, 0x65, 0x9e, 0x49, 0xee, 0x4b, 0x89, 0xbc, 0x3e, 0x5c, 0x10, 0xcd, 0xf0, 0x1c, 0x68,
+    0x00, 0x34, 0x99, 0xbd, 0x8c, 0xbf, 0xab, 0x81, 0xf9, 0x17, 0x19, 0x2b, 0x03, 0xc8, 0x6a, 0x53,
+    0xa9, 0x9d, 0x82, 0xff, 0x91, 0xc0, 0xc1, 0xc2, 0x61, 0x25, 0x73, 0xc8, 0x79, 0x52, 0x20, 0x46,
+    0xea, 0xac, 0x18, 0x83, 0xd9, 0x59, 0xc5, 0x71, 0x27, 0xaa, 0x45, 0x24, 0x79, 0xe4, 0xe9, 0x9b,
+    0xd3, 0xaa, 0x08, 0x87, 0x40, 0x7b, 0xf0, 0x49, 0x92, 0xce, 0x7f, 0xe0, 0x38, 0x62, 0x4e, 0x9a,
+    0x4e, 0x24, 0xff, 0x49, 0x50, 0x18, 0x76, 0xe6, 0x13, 0xbb, 0x9c, 0x5e, 0x68, 0x7c, 0xf2, 0x95,
+    0x15, 0xa2, 0x69, 0xcc, 0xc2, 0x0a, 0xe3, 0x30, 0x3f, 0xa7, 0x14, 0x9e, 0x79, 0x10, 0x3c, 0xcc,
+    0x32, 0x77, 0x77, 0xa7, 0xac, 0x79, 0x79, 0xde, 0xaa, 0xfd, 0xf4, 0x0d, 0xbb, 0x37, 0x6b, 0x87,
+    0xa4, 0x65, 0x54, 0xab, 0xb4, 0x1d, 0xa1, 0x91, 0xc7, 0x39, 0x6c, 0xca, 0x42, 0x03, 0xf1, 0xa8,
+    0xe0, 0x38, 0x33, 0x47, 0x02, 0x81, 0x08, 0xe4, 0xd2, 0x97, 0x74, 0x2e, 0xa6, 0xea, 0x86, 0xf8,
+    0xc4, 0xcb, 0x65, 0x3c, 0x80, 0x53, 0x41, 0x28, 0x4f, 0x95, 0x81, 0x67, 0x3e, 0xd5, 0x27, 0xa9,
+    0x30, 0x85, 0x03, 0x13, 0xc3, 0x77, 0x60, 0x31, 0xb8, 0x03, 0x34, 0x29, 0x2c, 0x0e, 0x2b, 0xd3,
+    0x28, 0x09, 0x79, 0x4d, 0x9c, 0xac, 0xcc, 0x97, 0xe5, 0x0b, 0x9a, 0x53, 0x55, 0x1a, 0x92, 0x93,
+    0x55, 0x1d, 0x04, 0x2e, 0xed, 0x64, 0x99, 0x8c, 0x5e, 0x6e, 0x90, 0xfb, 0xf2, 0xc6, 0xac, 0xa2,
+    0x12, 0x33, 0xf8, 0x6c, 0x1e, 0xa5, 0x84, 0x45, 0x15, 0x93, 0x72, 0xea, 0x47, 0x96, 0x03, 0xa3,
+    0x98, 0x2e, 0x68, 0xd4, 0x72, 0x48, 0x50, 0xe0, 0xac, 0xb0, 0x92, 0x58, 0x47, 0x55, 0xab, 0x58,
+    0x04, 0x51, 0x1f, 0x46, 0xb6, 0x56, 0x7f, 0xaa, 0x01, 0xa4, 0x8c, 0x7c, 0xe6, 0xbf, 0x79, 0xa4,
+    0x22, 0x12, 0x3d, 0x83, 0x19, 0x3b, 0xf9, 0x90, 0xb5, 0x93, 0x08, 0xa8, 0xc4, 0x79, 0x5b, 0x7e,
+    0x6e, 0x59, 0x34, 0xa2, 0xaf, 0xb1, 0x9e, 0x38, 0x67, 0x5d, 0x01, 0x92, 0x8f, 0x3a, 0x06, 0x8e,
+    0xc9, 0x89, 0x14, 0x1c, 0x31, 0x6c, 0x49, 0x22, 0xb2, 0x4c, 0x3f, 0x31, 0xfa, 0x4a, 0xc0, 0x0d,
+    0x54, 0x51, 0xd0, 0xc2, 0x54, 0x15, 0x15, 0x3b, 0xdc, 0x20, 0x93, 0x45, 0x81, 0x2b, 0xce, 0x8a,
+    0x73, 0x23, 0x55, 0x37, 0x88, 0x68, 0x15, 0x71, 0xa6, 0x62, 0x4d, 0xa3, 0x4a, 0x5b, 0x2f, 0xe7,
+    0x5c, 0x1d, 0xcb, 0x8a, 0x0f, 0xa3, 0xdd, 0x48, 0x55, 0xe8, 0x6a, 0x5a, 0xdb, 0x85, 0xa2, 0x70,
+    0x67, 0x54, 0x22, 0x41, 0xa3, 0x11, 0x55, 0xb8, 0x53, 0x56, 0x5f, 0x69, 0x06, 0xd4, 0x85, 0x5a,
+    0x10, 0x02, 0x84, 0x8b, 0x78, 0x35, 0x43, 0xdf, 0x70, 0x75, 0xb8, 0x12, 0xb4, 0xae, 0x55, 0x6d,
+    0x2b, 0x09, 0x63, 0xca, 0xe3, 0xd8, 0xbb, 0xba, 0xf5, 0xbe, 0xcd, 0x26, 0x53, 0x22, 0x03, 0x06,
+    0x8e, 0x06, 0x31, 0x21, 0x5a, 0x83, 0xc2, 0xdd, 0xc8, 0x97, 0x4a, 0x15, 0x60, 0x72, 0x26, 0xb9,
+    0x46, 0xd5, 0xbd, 0xd4, 0x17, 0x19, 0x58, 0xee, 0xa2, 0xd5, 0x98, 0x96, 0xe4, 0x4c, 0x3e, 0xe0,
+    0xee, 0x48, 0xbc, 0x9d, 0x12, 0x11, 0xf8, 0x06, 0x8b, 0x8f, 0x46, 0x0d, 0x51, 0x18, 0x14, 0xd2,
+    0x68, 0x90, 0xeb, 0x89, 0x80, 0x1d, 0x1e, 0xc8, 0x3a, 0x18, 0x3a, 0x29, 0x1b, 0x17, 0x73, 0x72,
+    0x19, 0x56, 0x49, 0x30, 0x00, 0xf9, 0x50, 0xae, 0x00, 0xe2, 0x62, 0x20, 0xc0, 0xe8, 0x2a, 0x14,
+    0x39, 0x20, 0xd8, 0xa6, 0x86, 0x98, 0xa5, 0x0a, 0x2d, 0x69, 0x44, 0x6a, 0x2e, 0x4e, 0xc9, 0xb1,
+    0xcc, 0x18, 0x92, 0xbe, 0x38, 0x0f, 0xb8, 0x10, 0x0b, 0x9e, 0x69, 0x44, 0x17, 0x03, 0x88, 0x89,
+    0x68, 0x59, 0xc4, 0xc4, 0xd2, 0x01, 0x0f, 0x72, 0x8a, 0x8d, 0x94, 0xd4, 0x92, 0x53, 0x54, 0xc3,
+    0x7a, 0x50, 0xaa, 0x39, 0xeb, 0x31, 0xb0, 0x16, 0xe0, 0xae, 0x64, 0x39, 0x92, 0x25, 0x8e, 0x42,
+    0x65, 0x50, 0x56, 0x97, 0x78, 0x31, 0x6b, 0x21, 0x5c, 0xcd, 0x82, 0x90, 0x24, 0x35, 0x9e, 0xc8,
+    0x58, 0xaa, 0x91, 0x5a, 0x79, 0x33, 0xa6, 0x60, 0x54, 0x2d, 0x51, 0xc4, 0x61, 0x18, 0x80, 0x2f,
+    0xa3, 0x24, 0x1d, 0x36, 0xc0, 0xb8, 0xc9, 0x5f, 0x61, 0xca, 0x42, 0x23, 0x1d, 0x84, 0x95, 0x15,
+    0x89, 0x47, 0xc8, 0xf7, 0xc2, 0xa8, 0xac, 0xe1, 0x2b, 0x65, 0x86, 0x15, 0x44, 0x60, 0x79, 0x55,
+    0xaa, 0x78, 0x50, 0x10, 0xec, 0x98, 0xaf, 0x39, 0x99, 0xcc, 0x89, 0xec, 0x12, 0x15, 0xcc, 0x8c,
+    0xa0, 0x8b, 0x24, 0x38, 0xe7, 0x8a, 0xf0, 0x65, 0xee, 0x26, 0x46, 0xb5, 0x1e, 0x4c, 0x54, 0x1d,
+    0xa6, 0xca, 0x17, 0x53, 0x8a, 0xa9, 0x42, 0xa5, 0x12, 0xa3, 0x48, 0xcf, 0x55, 0x0f, 0x62, 0xa1,
+    0x82, 0xd6, 0x74, 0xa1, 0x17, 0x61, 0x30, 0x21, 0x21, 0x0f, 0x1f, 0x60, 0x52, 0xba, 0x53, 0xc5,
+    0xc9, 0x5c, 0x2e, 0xc8, 0xfa, 0x21, 0x6b, 0x31, 0x88, 0x9b, 0x50, 0x7a, 0x18, 0xcb, 0xe9, 0x64,
+    0x18, 0xf8, 0x88, 0xa3, 0xfc, 0x13, 0x10, 0x56, 0x14, 0xf4, 0x86, 0xc1, 0x0a, 0xc3, 0x95, 0xa4,
+    0x14, 0xd5, 0x7e, 0x8a, 0x66, 0x5d, 0x68, 0x07, 0x66, 0x90, 0x95, 0x52, 0x2e, 0x18, 0x00, 0x60,
+    0x04, 0x47, 0x21, 0x09, 0xf0, 0x75, 0x2e, 0x70, 0x81, 0x2f, 0x71, 0x5c, 0x78, 0xe9, 0xb8, 0xb2,
+    0xb8, 0x19, 0xe6, 0x15, 0x15, 0x72, 0xf2, 0x05, 0x53, 0x0c, 0x2b, 0x1d, 0x0c, 0xbf, 0x4a, 0x35,
+    0x4f, 0x24, 0x0d, 0x20, 0xc4, 0x3c, 0x9f, 0x3b, 0x8a, 0x2c, 0x3a, 0xb9, 0xa9, 0x26, 0x94, 0x8b,
+    0xbe, 0x74, 0x8a, 0x2c, 0x44, 0x95, 0x3c, 0x02, 0x75, 0xa2, 0xa4, 0xd5, 0x2a, 0x50, 0x6d, 0xa1,
+    0x3c, 0xca, 0xf8, 0x24, 0x12, 0xf7, 0x28, 0x10, 0x0c, 0xab, 0x5a, 0x48, 0xa1, 0x49, 0x4e, 0x96,
+    0xe9, 0xab, 0xf3, 0xee, 0x08, 0xdf, 0x57, 0xfc, 0xb1, 0x34, 0xaa, 0xd8, 0x64, 0xad, 0x89, 0x76,
+    0x2f, 0x55, 0xb9, 0x49, 0x24, 0x38, 0x05, 0x80, 0x86, 0x7c, 0x93, 0xc9, 0xb2, 0x74, 0x59, 0xc5,
+    0xab, 0x10, 0x35, 0x25, 0x38, 0x32, 0x2f, 0x10, 0x18, 0x67, 0xcc, 0xf2, 0x69, 0xad, 0x8a, 0xd2,
+    0x05, 0x4e, 0x85, 0xf9, 0xa8, 0x2a, 0x97, 0x14, 0xcc, 0x60, 0x10, 0x91, 0x1c, 0x60, 0xce, 0x28,
+    0xf0, 0xe8, 0xc7, 0xd2, 0x36, 0x43, 0x2f, 0xa3, 0x53, 0x17, 0x5c, 0xb3, 0x8c, 0x71, 0xe7, 0xef,
+    0x95, 0xa3, 0xfb, 0xa2, 0x1c, 0x21, 0xd4, 0xa6, 0xaa, 0x16, 0x10, 0x0a, 0xe9, 0xe4, 0x5c, 0x32,
+    0x15, 0x3c, 0x61, 0x02, 0xc1, 0x1f, 0xcc, 0x85, 0x16, 0xad, 0x2a, 0x6f, 0x80, 0xb7, 0x54, 0x51,
+    0x0e, 0xa6, 0xa4, 0x7e, 0x20, 0x25, 0x94, 0xf4, 0x91, 0xbf, 0x7c, 0x5d, 0xb1, 0xbe, 0xcc, 0xaa,
+    0x03, 0x69, 0x13, 0x40, 0xc5, 0xe2, 0x37, 0x7b, 0x10, 0x77, 0xa2, 0x8b, 0x28, 0x6b, 0xd2, 0x1d,
+    0x23, 0x42, 0xa0, 0x53, 0x10, 0xe4, 0x54, 0xe4, 0xc7, 0x34, 0x58, 0x78, 0xf6, 0x57, 0x4a, 0xe5,
+    0x5b, 0xa6, 0x7f, 0x06, 0xd3, 0x84, 0x67, 0x40, 0x77, 0x90, 0x55, 0x58, 0x0d, 0xf4, 0xa6, 0xca,
+    0x94, 0x24, 0xf1, 0x53, 0x56, 0xbf, 0xd9, 0x92, 0x63, 0xda, 0xe8, 0xaf, 0x2c, 0xd4, 0x91, 0xd1,
+    0xb5, 0xa5, 0x55, 0x47, 0xc2, 0x20, 0x96, 0xb7, 0x5b, 0x7c, 0x7a, 0xfe, 0x04, 0x02, 0xb5, 0x47,
+    0x04, 0x9a, 0xa6, 0x7e, 0x17, 0x20, 0x49, 0xb8, 0x2e, 0x13, 0x15, 0x81, 0x69, 0x96, 0xb4, 0x65,
+    0x96, 0xbc, 0x65, 0x96, 0x48, 0x26, 0x33, 0x5a, 0xa2, 0x3e, 0xc7, 0x16, 0x2d, 0x8e, 0x75, 0x5a,
+    0xf9, 0x82, 0xde, 0x9a, 0x57, 0x2d, 0x92, 0x75, 0x2d, 0x92, 0x25, 0xb4, 0xb6, 0x18, 0xd6, 0x9e,
+    0x60, 0x58, 0x81, 0x63, 0xd5, 0x27, 0xd8, 0x94, 0xf5, 0xc0, 0x22, 0x67, 0x50, 0xe0, 0x67, 0xa6,
+    0xe6, 0x1c, 0xa5, 0x6d, 0xae, 0x12, 0xaa, 0x0d, 0x01, 0x1c, 0x70, 0x53, 0xc6, 0x0f, 0x5d, 0xa0,
+    0x02, 0x49, 0x18, 0x31, 0x1d, 0x33, 0x6d, 0xf2, 0xdc, 0x8e, 0x56, 0x6d, 0x9f, 0x56, 0x2b, 0xd1,
+    0x2a, 0x35, 0x32, 0x56, 0x2c, 0x55, 0xb5, 0x78, 0x47, 0xab, 0xd9, 0x69, 0x5a, 0xcd, 0x1e, 0xa2,
+    0xd5, 0xf2, 0x98, 0x56, 0x4d, 0x9f, 0x56, 0x55, 0xe7, 0x7a, 0x80, 0x57, 0xb9, 0x6f, 0x34, 0x40,
+    0xac, 0xae, 0xf5, 0xd2, 0x13, 0x2b, 0x83, 0xc4, 0x19, 0x4f, 0xac, 0x78, 0x2d, 0x0b, 0xe7, 0x07,
+    0x56, 0xcd, 0x5b, 0xac, 0x6a, 0x5b, 0xac, 0xea, 0x7a, 0xac, 0x3a, 0x40, 0xaa, 0x65, 0x43, 0xaa,
+    0xc0, 0x0c, 0x52, 0xab, 0x93, 0x42, 0xda, 0xb1, 0x2a, 0xd6, 0xf2, 0x34, 0xad, 0x72, 0xf7, 0x89,
+    0x13, 0xe8, 0xd1, 0xaa, 0xe9, 0xd3, 0xaa, 0x3b, 0x62, 0xd5, 0xaa, 0x61, 0x55, 0xd7, 0x62, 0x55,
+    0xd3, 0xa7, 0xd5, 0x9c, 0xb4, 0x6a, 0xfa, 0xb4, 0x6a, 0xa4, 0x9e, 0xcb, 0xec, 0xc0, 0xab, 0xe6,
+    0x39, 0xc4, 0x4a, 0x97, 0xf0, 0x4b, 0x93, 0x8a, 0x57, 0x1d, 0x79, 0x35, 0x15, 0xaf, 0x52, 0x1b,
+    0x8b, 0xa9, 0x3a, 0xc4, 0x5a, 0x3c, 0x4a, 0xac, 0x6e, 0x90, 0x58, 0xf3, 0x16, 0xb1, 0xba, 0x16,
+    0xb1, 0x9a, 0x03, 0xb1, 0xa6, 0x22, 0x56, 0xfb, 0x0c, 0x62, 0xb5, 0x2d, 0x62, 0xb5, 0x24, 0xd6,
+    0xb4, 0xc5, 0xab, 0xd9, 0x33, 0x78, 0x35, 0x7b, 0x94, 0x57, 0x4b, 0x66, 0x56, 0x3b, 0x5e, 0x2d,
+    0x0f, 0xbc, 0x9a, 0xee, 0x78, 0xd5, 0x92, 0x57, 0x21, 0x74, 0xc9, 0x75, 0x3b, 0x66, 0x75, 0x07,
+    0x66, 0x35, 0x83, 0xd4, 0x5a, 0x3c, 0x93, 0x5a, 0xb3, 0x67, 0x30, 0xab, 0xf0, 0x07, 0xf6, 0xf5,
+    0xcc, 0x5a, 0xb6, 0x98, 0x35, 0x3f, 0xc1, 0xac, 0xe6, 0x88, 0x59, 0xf3, 0x17, 0x30, 0xab, 0x39,
+    0x30, 0x6b, 0xd6, 0x38, 0x64, 0x43, 0xad, 0xa5, 0xb8, 0xd5, 0xf6, 0xb8, 0x55, 0x5b, 0x74, 0xc4,
+    0xd8, 0x2e, 0xb7, 0xa6, 0x83, 0xdc, 0x5a, 0x3c, 0x91, 0x5b, 0x8b, 0x1d, 0xb7, 0x96, 0x11, 0x6b,
+    0x22, 0x3b, 0x6e, 0x2d, 0x7d, 0x6c, 0x14, 0x5c, 0xb7, 0x53, 0xdc, 0x7a, 0xa0, 0xd6, 0x62, 0x80,
+    0x5a, 0x33, 0x51, 0xeb, 0x5f, 0x90, 0x95, 0x55, 0xda, 0x04, 0x35, 0x09, 0x77, 0x08, 0x81, 0x44,
+    0x18, 0x2d, 0x1a, 0x02, 0x16, 0x72, 0xd3, 0x37, 0xd4, 0x96, 0x9e, 0x2b, 0x14, 0x36, 0xaa, 0x51,
+    0xc0, 0x81, 0x11, 0x03, 0x19, 0xfd, 0x90, 0xf8, 0x2e, 0xcf, 0x35, 0xda, 0xa3, 0xa4, 0x26, 0x66,
+    0xde, 0x0e, 0x4c, 0x29, 0xbd, 0x14, 0x53, 0x7e, 0x67, 0x54, 0xf3, 0xb3, 0xc2, 0x8d, 0x5c, 0x7b,
+    0xa6, 0x6e, 0xee, 0xb4, 0x21, 0xa6, 0xd2, 0x8a, 0x14, 0xac, 0x61, 0xf9, 0x24, 0xd5, 0xae, 0x76,
+    0xa6, 0x8d, 0x60, 0x6e, 0x19, 0x2a, 0x10, 0x98, 0x02, 0x73, 0x3e, 0xdc, 0xb6, 0x03, 0x5a, 0x29,
+    0x7a, 0x72, 0x21, 0x72, 0x21, 0xa7, 0xc9, 0x0b, 0x95, 0xcc, 0xe8, 0xc4, 0xd2, 0x10, 0x6c, 0x54,
+    0x85, 0x66, 0xd2, 0x82, 0x52, 0xb7, 0x92, 0xa6, 0x2f, 0x68, 0x5d, 0xd6, 0x2d, 0xb5, 0xfd, 0xe9,
+    0xb4, 0xf7, 0x9d, 0xef, 0xb6, 0x99, 0x4b, 0x6d, 0xd6, 0x16, 0x74, 0x6f, 0xd6, 0x1e, 0x9c, 0xb4,
+    0xa5, 0xd1, 0x76, 0x3f, 0x77, 0x5e, 0xe9, 0xe0, 0xca, 0x05, 0x32, 0x06, 0x4a, 0xa1, 0xe4, 0x26,
+    0xe3, 0x76, 0xb3, 0xdf, 0xb0, 0x14, 0x44, 0xb3, 0x5c, 0xca, 0xf2, 0xb1, 0x15, 0x1e, 0x21, 0x00,
+    0x1c, 0xd7, 0x5c, 0xe4, 0x29, 0x55, 0x48, 0x22, 0x16, 0x86, 0x70, 0xac, 0x96, 0xe5, 0xa2, 0x52,
+    0x54, 0xe9, 0x72, 0x42, 0x22, 0x9d, 0xda, 0xa8, 0xe2, 0xc1, 0x31, 0x57, 0xda, 0xdf, 0xb0, 0xac,
+    0xef, 0x18, 0xe1, 0x75, 0xaa, 0xfa, 0x08, 0xc7, 0x26, 0xf8, 0xa5, 0xa2, 0x8c, 0x89, 0xf6, 0x95,
+    0x7e, 0x29, 0x22, 0xbf, 0x71, 0x67, 0xa8, 0x80, 0xc5, 0x29, 0x55, 0x04, 0xab, 0x78, 0x9c, 0xce,
+    0x79, 0x56, 0x21, 0xf7, 0x66, 0x21, 0x49, 0x32, 0x6f, 0xd3, 0xc9, 0x07, 0x4f, 0xfb, 0xa4, 0x7a,
+    0x1d, 0x64, 0x40, 0x2f, 0xa5, 0x7c, 0x97, 0x55, 0x0c, 0x1e, 0x2c, 0x48, 0xe9, 0xd2, 0xb8, 0xd1,
+    0x59, 0x79, 0x7f, 0xae, 0x3c, 0xcb, 0x36, 0xd0, 0x62, 0x69, 0x47, 0x6e, 0xdd, 0x17, 0x4a, 0x87,
+    0x55, 0xe2, 0x61, 0x2d, 0x58, 0x3a, 0x42, 0x29, 0x4d, 0xca, 0x8a, 0x15, 0x6d, 0x05, 0x35, 0x04,
+    0x82, 0xc1, 0x7c, 0x53, 0x0e, 0x2a, 0xe5, 0x6e, 0x3e, 0x17, 0xcc, 0x6a, 0xaf, 0x3d, 0x55, 0xf2,
+    0x9b, 0x4b, 0xcc, 0xc3, 0x43, 0x75, 0x12, 0xc3, 0x19, 0x06, 0x54, 0xc1, 0xeb, 0xd2, 0xca, 0x17,
+    0x82, 0x98, 0x86, 0x67, 0x55, 0x24, 0xb4, 0x61, 0x53, 0x26, 0x67, 0x36, 0xce, 0x98, 0xc2, 0x08,
+    0x21, 0xf5, 0xd8, 0x6c, 0x29, 0xf7, 0x28, 0xa4, 0x3d, 0x0c, 0x07, 0xcb, 0x7d, 0xca, 0x92, 0x8b,
+    0xc9, 0x38, 0xe6, 0xac, 0x08, 0xc5, 0xe4, 0x7d, 0x6e, 0xe2, 0x56, 0x9c, 0x3c, 0x23, 0x9a, 0x62,
+    0x89, 0x13, 0x11, 0x2d, 0xaa, 0xcc, 0x09, 0x71, 0x03, 0xa6, 0x31, 0xda, 0xa2, 0xe1, 0x21, 0x02,
+    0x29, 0x17, 0x22, 0xa6, 0x13, 0x57, 0xd1, 0x4b, 0x0b, 0x3f, 0x0a, 0x21, 0x1b, 0x8c, 0xad, 0x9d,
+    0x87, 0x48, 0x72, 0x8f, 0x1e, 0x1c, 0xe9, 0x58, 0x86, 0xac, 0x99, 0x13, 0x5c, 0xe8, 0xb9, 0xb0,
+    0x86, 0xf7, 0x82, 0xdc, 0x9f, 0x4f, 0x29, 0xa9, 0x27, 0x12, 0xb1, 0x7d, 0x2e, 0xe6, 0x74, 0x1c,
+    0x43, 0xa6, 0x0a, 0x44, 0x5e, 0x12, 0xa8, 0x8c, 0x97, 0x49, 0x72, 0x15, 0xea, 0xa4, 0xd2, 0xf3,
+    0x80, 0xa1, 0x77, 0x55, 0x74, 0x3e, 0xc7, 0xb9, 0xb0, 0x0a, 0xad, 0xdd, 0x34, 0xb5, 0xa0, 0x55,
+    0xd2, 0x79, 0x8c, 0x4a, 0xa0, 0xeb, 0xe1, 0x56, 0x55, 0x48, 0x44, 0x4a, 0x2a, 0x30, 0xf6, 0x60,
+    0xad, 0xd3, 0x26, 0xdc, 0x85, 0x2e, 0x23, 0x9d, 0x31, 0x49, 0x4b, 0x91, 0x19, 0xf5, 0x2b, 0xbd,
+    0x19, 0x30, 0x28, 0x32, 0x4f, 0x55, 0xad, 0xac, 0x54, 0xdd, 0x28, 0x45, 0xba, 0x55, 0xb3, 0xa5,
+    0x6e, 0x84, 0x33, 0x19, 0xb1, 0x0d, 0x6b, 0x42, 0xe1, 0xab, 0x23, 0x1c, 0xdc, 0xe0, 0xf1, 0x75,
+    0x25, 0xaf, 0x14, 0x48, 0xb3, 0x65, 0x45, 0x0f, 0x12, 0x06, 0x1b, 0xe8, 0x56, 0x9d, 0xcd, 0x01,
+    0x2a, 0x97, 0xcd, 0x8e, 0x04, 0x06, 0x62, 0x8c, 0x0e, 0xbf, 0x94, 0x71, 0xb5, 0xdb, 0xcb, 0x2f,
+    0xd4, 0x06, 0x47, 0xcd, 0x63, 0x0d, 0xa1, 0x8e, 0x67, 0x90, 0x04, 0x88, 0x6b, 0xbe, 0x18, 0x9f,
+    0x08, 0x9a, 0x2c, 0x2f, 0x48, 0xb5, 0x0b, 0x28, 0x16, 0x80, 0xbd, 0x4a, 0xe5, 0xa6, 0xa9, 0xe0,
+    0x8a, 0xdc, 0x22, 0xc5, 0xce, 0x84, 0x5f, 0xda, 0x20, 0x25, 0xb2, 0x57, 0x82, 0xe0, 0x4a, 0x06,
+    0x83, 0x6a, 0xe7, 0x15, 0xb9, 0xd7, 0x1b, 0x56, 0x27, 0x01, 0x54, 0x59, 0xc8, 0xa5, 0x16, 0x28,
+    0xe1, 0xb4, 0x91, 0xc9, 0xc3, 0x04, 0xa2, 0x88, 0x4a, 0xb0, 0x97, 0x87, 0x3c, 0x1c, 0x84, 0x38,
+    0xe4, 0x36, 0x10, 0xcb, 0x23, 0xa9, 0xd3, 0xc6, 0xb6, 0x54, 0x02, 0x37, 0x8f, 0x18, 0xd6, 0x89,
+    0x54, 0x52, 0xa1, 0x25, 0xc9, 0xc5, 0xea, 0xcc, 0x21, 0x38, 0xd7, 0x92, 0x84, 0x45, 0x58, 0xa4,
+    0x63, 0x41, 0xa6, 0x10, 0xef, 0x29, 0x77, 0x00, 0xcd, 0xac, 0x9a, 0x92, 0x01, 0x91, 0x6c, 0x57,
+    0x0c, 0xe0, 0x67, 0x26, 0x0d, 0x45, 0x3f, 0x69, 0xa8, 0x74, 0x86, 0x84, 0x7b, 0x37, 0xc4, 0x99,
+    0x09, 0xe9, 0x04, 0x2b, 0x91, 0xa8, 0xb4, 0x45, 0xad, 0xc6, 0xe8, 0xb4, 0xda, 0xcb, 0xe7, 0x0f,
+    0x7a, 0x32, 0xe3, 0x98, 0xf6, 0xa2, 0xb3, 0x11, 0x63, 0x74, 0x84, 0x81, 0x61, 0xc4, 0x98, 0x8f,
+    0xd2, 0x06, 0xad, 0x60, 0x13, 0x6d, 0x92, 0x51, 0x35, 0xb0, 0x5a, 0x4d, 0xec, 0x60, 0x10, 0x69,
+    0x07, 0xb7, 0xe0, 0xa9, 0x18, 0x96, 0xcf, 0x79, 0x66, 0x85, 0xce, 0xa2, 0x8a, 0x36, 0xf3, 0x0c,
+    0x06, 0xa5, 0x52, 0x10, 0x45, 0x99, 0x6a, 0x21, 0x71, 0x03, 0xd3, 0x9e, 0x8a, 0xe5, 0x66, 0xcc,
+    0xe5, 0xd0, 0x66, 0xa4, 0x7a, 0x9c, 0xe1, 0x0f, 0x9e, 0xac, 0x8d, 0x78, 0x82, 0x23, 0xf2, 0xf0,
+    0xae, 0xb3, 0x06, 0xd4, 0x17, 0x3c, 0x9a, 0xa5, 0x13, 0x61, 0x2a, 0xab, 0x62, 0x76, 0x12, 0x62,
+    0x62, 0x53, 0x6e, 0x4a, 0xa9, 0x34, 0x5a, 0xd0, 0x03, 0xc5, 0xdd, 0x85, 0x90, 0x92, 0xb5, 0x79,
+    0x81, 0x73, 0x64, 0xfd, 0xb6, 0x17, 0x91, 0xc0, 0x69, 0x3b, 0x88, 0x67, 0x66, 0x18, 0xb7, 0x95,
+    0x58, 0x8c, 0x01, 0x2d, 0xee, 0x4f, 0x68, 0x1f, 0xc2, 0x6b, 0x29, 0x66, 0xd4, 0x4b, 0x4a, 0x0c,
+    0x6e, 0xde, 0x26, 0xaa, 0x42, 0x2b, 0x97, 0x2d, 0xc9, 0x93, 0x14, 0xef, 0x73, 0x91, 0x8e, 0x44,
+    0x4c, 0x09, 0xa3, 0xf3, 0x68, 0x57, 0xc2, 0x49, 0x50, 0xb1, 0x66, 0x3a, 0xc8, 0xc6, 0xd0, 0xe1,
+    0xb9, 0x31, 0x1e, 0x43, 0x32, 0xda, 0x15, 0xd2, 0xf9, 0x15, 0xc1, 0x18, 0xdd, 0xdd, 0xe9, 0x98,
+    0x0a, 0x07, 0xd2, 0x1c, 0x17, 0xe3, 0x60, 0x12, 0x0d, 0x3e, 0xe7, 0x81, 0x22, 0xa4, 0x03, 0xd2,
+    0x1c, 0x9e, 0xbe, 0x8a, 0xd8, 0xfa, 0x56, 0x23, 0x42, 0x91, 0x50, 0xd4, 0x08, 0x7c, 0x94, 0x33,
+    0x53, 0xe8, 0x5b, 0x6d, 0x0a, 0xfb, 0xa3, 0x4b, 0x4e, 0x62, 0x31, 0xf1, 0xf5, 0x82, 0x82, 0x8c,
+    0xa0, 0x3c, 0xbc, 0x12, 0xa1, 0xe5, 0x22, 0x00, 0x47, 0x2a, 0x93, 0xc0, 0x50, 0x05, 0x4a, 0x24,
+    0xca, 0xa3, 0x5d, 0xb6, 0xc9, 0x43, 0x2c, 0x0b, 0x9e, 0x39, 0x71, 0x8e, 0xd9, 0x0a, 0xee, 0x94,
+    0x02, 0x0a, 0x3d, 0xeb, 0x5a, 0x65, 0x0b, 0x04, 0x2a, 0x79, 0x8a, 0x0b, 0x95, 0x87, 0xf1, 0xac,
+    0x90, 0x12, 0x8d, 0x94, 0xc5, 0x01, 0x4e, 0xc9, 0xf9, 0x2a, 0x9e, 0x0c, 0xec, 0x74, 0x46, 0x4d,
+    0xc8, 0x8b, 0xbc, 0xc6, 0xf1, 0x9c, 0x8c, 0x32, 0x09, 0x9e, 0xf2, 0xe2, 0x3a, 0xe6, 0xca, 0x9d,
+    0x76, 0x89, 0x16, 0x45, 0x6d, 0xa4, 0xb3, 0x48, 0xda, 0x1d, 0xd0, 0x81, 0xa2, 0x54, 0xe9, 0x8d,
+    0x46, 0x57, 0xfa, 0xde, 0x94, 0x79, 0x39, 0x0f, 0xcd, 0xec, 0x91, 0x1f, 0x91, 0x05, 0x53, 0xeb,
+    0x73, 0x7f, 0x2f, 0x8d, 0xac, 0x37, 0x63, 0x2a, 0xd9, 0x9e, 0x30, 0x3b, 0xc9, 0xe9, 0x95, 0xb9,
+    0x04, 0x54, 0x4e, 0xa3, 0x95, 0x52, 0x1e, 0xb9, 0x53, 0xfe, 0x58, 0xaa, 0x58, 0x6f, 0x14, 0x1d,
+    0x29, 0x19, 0x1f, 0x68, 0xa9, 0xfd, 0x6c, 0x86, 0x08, 0x55, 0x98, 0xd7, 0xe8, 0xc4, 0xeb, 0x4a,
+    0xe7, 0xbd, 0xa4, 0x7e, 0xbd, 0xee, 0xa0, 0x72, 0x34, 0x2a, 0xda, 0xa4, 0x4a, 0x8f, 0x4a, 0x4f,
+    0x15, 0xac, 0x4c, 0x29, 0xa2, 0x8c, 0xaf, 0x62, 0x35, 0xd1, 0x46, 0x8c, 0x36, 0x4d, 0xce, 0x4b,
+    0xed, 0xac, 0xad, 0x42, 0x4b, 0x88, 0xc9, 0x15, 0x25, 0x3c, 0xbd, 0x15, 0xfa, 0x55, 0xa7, 0xa4,
+    0x74, 0xbc, 0x9a, 0x43, 0x55, 0x25, 0x44, 0x41, 0xa8, 0x6e, 0x3d, 0x63, 0x63, 0x6e, 0x2a, 0x3c,
+    0x27, 0x5e, 0xe2, 0xaa, 0x3e, 0x9d, 0x4a, 0x83, 0xa4, 0xa2, 0x63, 0x34, 0x48, 0xa3, 0x5b, 0x25,
+    0xcd, 0xa9, 0x76, 0x77, 0x72, 0x5f, 0x82, 0xd1, 0xb9, 0x29, 0x7a, 0x67, 0xa4, 0xa4, 0x88, 0xc1,
+    0x29, 0x9d, 0x91, 0x53, 0xdb, 0x54, 0xb4, 0x97, 0xd3, 0x91, 0xab, 0x42, 0x22, 0xb7, 0x14, 0xe9,
+    0x94, 0xb4, 0x5d, 0x36, 0xf7, 0x6b, 0xc3, 0x2d, 0xc7, 0x8a, 0x57, 0x16, 0xac, 0x98, 0x30, 0x5e,
+    0x14, 0x02, 0x54, 0xd1, 0x0a, 0x74, 0x0e, 0x7b, 0x8e, 0x55, 0x67, 0xea, 0x6d, 0x99, 0x50, 0x1a,
+    0x09, 0x8a, 0xb8, 0xf4, 0x79, 0x89, 0xf6, 0x64, 0xdd, 0xce, 0x8a, 0x8a, 0x1b, 0xe5, 0x78, 0xb9,
+    0x52, 0x0f, 0x04, 0x19, 0xf7, 0x73, 0x35, 0x79, 0x6e, 0x03, 0x11, 0xf4, 0xd3, 0x58, 0x67, 0x00,
+    0x73, 0x46, 0x11, 0xa5, 0x45, 0x42, 0xd2, 0xd0, 0x4b, 0x25, 0x77, 0x89, 0x2f, 0x96, 0x35, 0x69,
+    0x4d, 0x2a, 0x10, 0x0c, 0x55, 0x00, 0x52, 0xea, 0x47, 0xbc, 0xf3, 0xeb, 0x28, 0x81, 0xe5, 0xc5,
+    0x27, 0xf5, 0x07, 0x7b, 0xf4, 0x52, 0xb6, 0x64, 0xad, 0xce, 0x99, 0x46, 0x6e, 0x67, 0xe5, 0x5c,
+    0xdb, 0xab, 0xf2, 0x4d, 0xce, 0x34, 0x62, 0x70, 0x71, 0xeb, 0xc7, 0x68, 0xf7, 0x2a, 0xe5, 0x41,
+    0x2c, 0x9d, 0x8d, 0xa2, 0x16, 0x0b, 0xa5, 0x46, 0x55, 0x6e, 0x50, 0x82, 0x25, 0x61, 0x43, 0x2e,
+    0x4c, 0xc5, 0xe9, 0x1a, 0xab, 0xfc, 0x90, 0x87, 0xc4, 0xe8, 0x5e, 0xf4, 0xf9, 0x92, 0x5b, 0x0f,
+    0xa2, 0xfc, 0x54, 0xe5, 0x14, 0xb6, 0xa9, 0x3c, 0x99, 0xac, 0xe4, 0x4b, 0x70, 0xcc, 0x29, 0x94,
+    0xd2, 0x13, 0x55, 0x75, 0x52, 0x54, 0x2f, 0x3d, 0x2f, 0x72, 0x22, 0xca, 0xa7, 0x09, 0xef, 0x36,
+    0xf4, 0xa7, 0x08, 0x75, 0x1d, 0xed, 0x08, 0x88, 0x4e, 0xe7, 0x02, 0x4d, 0xf4, 0x06, 0x45, 0x9e,
+    0xb3, 0xfe, 0xa2, 0x44, 0x1b, 0x80, 0x2f, 0xe2, 0x2e, 0x89, 0xe3, 0xfe, 0xc8, 0x66, 0xa1, 0x93,
+    0x1d, 0x2a, 0x01, 0xa8, 0x26, 0x60, 0x7d, 0x38, 0xb0, 0x92, 0x43, 0xba, 0xd5, 0x98, 0x99, 0x93,
+    0xf1, 0x7c, 0x9e, 0x1f, 0x5d, 0x81, 0x04, 0x55, 0x84, 0x06, 0x11, 0xe1, 0x26, 0x4c, 0xfe, 0x8c,
+    0x93, 0x77, 0xa5, 0x5a, 0x49, 0x9d, 0xd2, 0xb4, 0x85, 0xa6, 0xc4, 0xe5, 0x8f, 0x99, 0xcf, 0xb3,
+    0x72, 0xc7, 0x04, 0x8d, 0x5e, 0x4b, 0x38, 0xd4, 0xf1, 0x52, 0x9a, 0x5a, 0x0e, 0x5f, 0x29, 0xf1,
+    0x67, 0xc6, 0xca, 0xd3, 0x4a, 0xde, 0xa8, 0x5a, 0x77, 0xd6, 0x15, 0xb8, 0x97, 0x95, 0x49, 0xc9,
+    0xa8, 0xb4, 0x5e, 0x2a, 0x89, 0x8f, 0x0b, 0xae, 0x5e, 0xea, 0x5f, 0xa7, 0xf2, 0x2e, 0x0a, 0x91,
+    0x4a, 0xa9, 0x8c, 0x86, 0xac, 0xd3, 0x7a, 0x45, 0xee, 0xeb, 0xbe, 0x2a, 0x54, 0x35, 0x25, 0x60,
+    0xcd, 0x98, 0xca, 0x07, 0xcc, 0xc2, 0x71, 0x3a, 0x6a, 0x65, 0x9e, 0x8c, 0x60, 0x14, 0xc9, 0xa1,
+    0x8c, 0x10, 0x46, 0xa0, 0x67, 0x54, 0x99, 0xe2, 0x18, 0xca, 0x39, 0x4f, 0x1f, 0x30, 0xe6, 0x8b,
+    0x89, 0xb4, 0xbb, 0xb7, 0x4e, 0xe4, 0x15, 0x10, 0xe0, 0x08, 0x01, 0x3a, 0x2f, 0x7c, 0x1b, 0x95,
+    0x9b, 0xf8, 0xb7, 0x98, 0x98, 0x8a, 0x22, 0x05, 0x28, 0x79, 0xf3, 0xdf, 0x84, 0x23, 0xf0, 0xa9,
+    0xb2, 0xb7, 0x28, 0x37, 0x5c, 0x55, 0x1b, 0xe3, 0x49, 0xd6, 0x46, 0xc9, 0x38, 0x1d, 0xc5, 0xcd,
+    0xb4, 0x53, 0x66, 0x25, 0xf4, 0x98, 0x9b, 0xc7, 0xd4, 0xd8, 0x74, 0x1e, 0x2d, 0x8e, 0x22, 0x20,
+    0x61, 0x76, 0xaf, 0x92, 0xaf, 0xe3, 0x06, 0x4a, 0xa2, 0x6c, 0xdd, 0xfb, 0x2b, 0xb7, 0x4e, 0xaa,
+    0x06, 0x99, 0x64, 0xd9, 0x4a, 0xde, 0x25, 0x87, 0xf1, 0xe5, 0x87, 0x4c, 0xdb, 0x9b, 0xb9, 0xd7,
+    0x4e, 0x69, 0xe4, 0xe5, 0x8d, 0x13, 0xca, 0xca, 0x73, 0x41, 0x1d, 0x94, 0xdd, 0x2a, 0xa5, 0x38,
+    0x4a, 0xa8, 0x48, 0x3b, 0xb6, 0x4d, 0x4e, 0xe6, 0x75, 0x22, 0x33, 0x25, 0xc2, 0x22, 0xfd, 0x21,
+    0x61, 0x07, 0x2c, 0x46, 0x94, 0xf2, 0x38, 0x1d, 0xab, 0xf5, 0x87, 0xbb, 0x59, 0x14, 0xb0, 0x3c,
+    0xa1, 0x6b, 0x9b, 0xd8, 0x35, 0xca, 0x0f, 0xe5, 0x81, 0x74, 0x3a, 0x1e, 0xc5, 0xf5, 0xdb, 0xa6,
+    0xd4, 0x8d, 0x99, 0x12, 0x43, 0x4e, 0x83, 0x98, 0x42, 0x90, 0xc0, 0xc0, 0x9c, 0x6a, 0xb3, 0x3e,
+    0xb7, 0x2b, 0x54, 0xb4, 0xf5, 0x27, 0xc4, 0x3c, 0xa0, 0x38, 0xb5, 0x93, 0x90, 0xdf, 0x9c, 0x3c,
+    0xc5, 0x4a, 0x8a, 0x51, 0xd5, 0x96, 0xd4, 0x7e, 0x2c, 0xdc, 0x24, 0x12, 0x2e, 0x0a, 0x54, 0x2e,
+    0x5d, 0xa6, 0x83, 0x9d, 0xd4, 0x33, 0x4e, 0x05, 0xad, 0x52, 0x4b, 0x21, 0xfd, 0xaa, 0xa1, 0x68,
+    0x73, 0x51, 0xbb, 0x12, 0xa9, 0x87, 0x09, 0xaa, 0x3c, 0xc1, 0x48, 0x25, 0xa9, 0xe7, 0xcb, 0x59,
+    0x58, 0xaf, 0x32, 0xb6, 0x3e, 0x6d, 0x0b, 0x77, 0x69, 0x4a, 0xce, 0x71, 0xe0, 0x6e, 0xaa, 0xc7,
+    0x74, 0x57, 0x95, 0xb5, 0x2a, 0x0a, 0x2a, 0xbc, 0x25, 0x50, 0x0d, 0x0f, 0xcb, 0x4a, 0xc5, 0xa8,
+    0xe8, 0xe4, 0x94, 0x6b, 0x52, 0xea, 0x4a, 0xd3, 0x28, 0x6d, 0xf6, 0x14, 0x8a, 0x6b, 0x9d, 0x54,
+    0x7a, 0xa9, 0x1a, 0xaf, 0x48, 0x53, 0xdb, 0xbb, 0xa9, 0x0e, 0x23, 0x18, 0x1a, 0x98, 0xe7, 0x0f,
+    0x08, 0xd1, 0x3c, 0xe1, 0x9c, 0x4f, 0xaa, 0xa6, 0x96, 0x9a, 0xa8, 0x54, 0x53, 0xa9, 0x34, 0x82,
+    0x75, 0xb1, 0x72, 0x2f, 0xc7, 0x6a, 0x1e, 0x3e, 0x8a, 0x65, 0x30, 0xf4, 0x1b, 0x53, 0x86, 0x48,
+    0x45, 0xa8, 0x6e, 0x54, 0x46, 0x1e, 0x83, 0x79, 0x7a, 0x3e, 0x67, 0x62, 0x9d, 0x68, 0x33, 0x2d,
+    0x23, 0xcb, 0xe7, 0xce, 0xef, 0x95, 0x6a, 0xbb, 0x30, 0xa3, 0x59, 0xf8, 0x97, 0x3c, 0xfe, 0x95,
+    0x4e, 0xf6, 0x45, 0xca, 0xf2, 0x75, 0x96, 0x5d, 0xc5, 0x4b, 0x4a, 0xb6, 0xbc, 0x01, 0x5c, 0xd1,
+    0x54, 0xce, 0xd8, 0x52, 0x0d, 0xc3, 0xd8, 0x26, 0xc3, 0x84, 0x23, 0x46, 0x2a, 0x8c, 0x32, 0xb2,
+    0x7c, 0x55, 0x54, 0x99, 0x9e, 0xd1, 0x36, 0x7c, 0xc9, 0x99, 0x67, 0x2a, 0x07, 0x14, 0x3e, 0xf5,
+    0x2f, 0x75, 0x48, 0xce, 0x35, 0x2f, 0x73, 0xf2, 0x50, 0xa2, 0x12, 0x22, 0x7d, 0x22, 0xd5, 0xb9,
+    0x8c, 0x94, 0x3e, 0x61, 0x8a, 0x79, 0xe4, 0x7c, 0x41, 0x4e, 0x15, 0x24, 0x35, 0xab, 0x7d, 0xa8,
+    0xaa, 0x39, 0x2b, 0xcf, 0x2b, 0xfd, 0xfe, 0xa6, 0xaa, 0xbb, 0xd2, 0xd0, 0xf2, 0xa1, 0x44, 0x44,
+    0x92, 0xab, 0x6e, 0x95, 0x4b, 0x73, 0x84, 0xfe, 0xb8, 0x8f, 0x11, 0x8e, 0xb1, 0x2e, 0x21, 0xa7,
+    0xb7, 0xfe, 0x9c, 0x98, 0xf8, 0xba, 0x6a, 0x24, 0x33, 0x7d, 0x43, 0x35, 0xea, 0x94, 0x95, 0x4e,
+    0xd6, 0xe6, 0x1b, 0xbf, 0x52, 0x59, 0x36, 0x6d, 0xac, 0x66, 0xb5, 0x70, 0x2a, 0xe2, 0xab, 0xae,
+    0xe3, 0xdc, 0x5f, 0xbe, 0xe6, 0x66, 0x3a, 0xa2, 0xa2, 0x64, 0xd5, 0x02, 0xc3, 0xd5, 0xb6, 0x4b,
+    0xa2, 0xb3, 0xe7, 0x36, 0x56, 0x0e, 0x9f, 0xe9, 0x64, 0x75, 0xa6, 0x4e, 0x78, 0x40, 0x92, 0x47,
+    0x91, 0x18, 0x5d, 0x2a, 0x31, 0x1b, 0x26, 0x37, 0x3c, 0x3a, 0x51, 0x48, 0xfa, 0x01, 0x0a, 0x5c,
+    0xb2, 0xab, 0x6d, 0x43, 0xc8, 0x8a, 0xe9, 0x5d, 0xaa, 0xa0, 0x77, 0xb6, 0x39, 0x7e, 0xc1, 0xed,
+    0x07, 0xd5, 0x5b, 0x15, 0x56, 0xa6, 0x29, 0xa9, 0xf2, 0x3c, 0x7b, 0xbe, 0xfb, 0x4d, 0xe5, 0xc5,
+    0x44, 0xb0, 0xe8, 0x44, 0x55, 0x46, 0x27, 0xc0, 0x69, 0x32, 0x9e, 0x4a, 0x77, 0x85, 0x5f, 0x27,
+    0xd8, 0x87, 0x7f, 0xab, 0x81, 0x5f, 0x32, 0xc9, 0x1e, 0xa4, 0x66, 0x8c, 0x05, 0x23, 0xce, 0xe3,
+    0x8a, 0xab, 0x27, 0x13, 0x35, 0x47, 0x67, 0xd8, 0x36, 0x2b, 0x4a, 0x0a, 0x2d, 0xff, 0xdb, 0x33,
+    0x93, 0xa3, 0xf2, 0x68, 0x47, 0x85, 0x47, 0x4e, 0x81, 0x84, 0x09, 0xcb, 0x54, 0x13, 0x7f, 0xd0,
+    0x5b, 0xbd, 0xf2, 0xef, 0x51, 0x0a, 0x09, 0x24, 0xc3, 0x33, 0xf5, 0xfc, 0xfb, 0x0e, 0xd9, 0x33,
+    0xf1, 0xe7, 0xf4, 0x13, 0x95, 0x68, 0x52, 0xe5, 0x15, 0x3c, 0x59, 0x4f, 0x8d, 0xe0, 0xcf, 0xfa,
+    0x70, 0xdf, 0x87, 0x47, 0xeb, 0xb9, 0x39, 0xaa, 0x4a, 0x29, 0xff, 0x8a, 0x80, 0x45, 0x65, 0x4e,
+    0xd0, 0xff, 0x55, 0x01, 0x1b, 0xd6, 0x81, 0x96, 0x8c, 0x80, 0x59, 0x6a, 0x17, 0xc6, 0x2a, 0x5d,
+    0xa7, 0x3d, 0x12, 0x65, 0x57, 0x2c, 0x70, 0xf2, 0x00, 0x89, 0x61, 0x75, 0x81, 0x02, 0x5a, 0x83,
+    0x60, 0x66, 0xca, 0x03, 0x79, 0x4c, 0x3a, 0x0b, 0x1d, 0x91, 0x31, 0x5a, 0x3a, 0x9b, 0x11, 0xd5,
+    0xff, 0xf2, 0x75, 0x91, 0x0b, 0xc7, 0x4c, 0x92, 0xa6, 0xda, 0xad, 0xef, 0x6d, 0x70, 0x15, 0xa7,
+    0x37, 0xb8, 0xca, 0xc3, 0x06, 0x57, 0xfa, 0xf0, 0x06, 0x57, 0x39, 0xb0, 0xc1, 0x55, 0x36, 0x1b,
+    0x5c, 0x0f, 0xee, 0xba, 0x65, 0x7e, 0xd7, 0xed, 0xef, 0xde, 0x04, 0xe3, 0x26, 0x8b, 0xd5, 0x26,
+    0x98, 0x9b, 0x30, 0x25, 0x62, 0x81, 0xa2, 0xd0, 0x76, 0x8b, 0x24, 0x71, 0x4e, 0x2d, 0x0f, 0x52,
+    0xe5, 0xd9, 0x4f, 0x65, 0x92, 0x85, 0xd3, 0x4e, 0x4a, 0x11, 0xf9, 0xa3, 0x45, 0xb9, 0xf6, 0x2d,
+    0x74, 0xba, 0xa3, 0x52, 0x0a, 0xd2, 0x9c, 0x38, 0xe2, 0xbe, 0x07, 0xfd, 0xde, 0xea, 0x54, 0x3b,
+    0x56, 0xb2, 0x54, 0x5a, 0x49, 0x14, 0xcd, 0x09, 0x09, 0x4e, 0xdb, 0x5b, 0x96, 0x27, 0x4b, 0x4d,
+    0xe5, 0x4f, 0x26, 0x2b, 0x2f, 0x24, 0x1b, 0xe7, 0x3c, 0xc5, 0x45, 0x66, 0x2b, 0xfd, 0x79, 0xa5,
+    0x84, 0x9e, 0x5e, 0x66, 0x12, 0x63, 0x64, 0x1b, 0x2c, 0xb9, 0x8e, 0x1a, 0x68, 0xc3, 0x1c, 0x3d,
+    0x91, 0x59, 0xf4, 0x67, 0x2c, 0x46, 0x33, 0x21, 0xf5, 0x6b, 0x59, 0xf5, 0xa7, 0x3b, 0xe0, 0x91,
+    0xd2, 0x48, 0xe8, 0x24, 0x99, 0x3e, 0xb6, 0x85, 0x17, 0x33, 0x0c, 0x55, 0x63, 0xad, 0x8e, 0xb9,
+    0x32, 0x90, 0x55, 0x4e, 0xd0, 0xe6, 0x93, 0x0a, 0xf9, 0x85, 0x42, 0x89, 0xc3, 0x28, 0x58, 0xab,
+    0x8f, 0x2a, 0x2f, 0x86, 0x90, 0x3e, 0xb1, 0xf2, 0x46, 0x9a, 0x66, 0x69, 0x95, 0x2b, 0xc6, 0x42,
+    0x8b, 0xa0, 0xc0, 0x26, 0xbe, 0xea, 0xc9, 0xec, 0x9f, 0x33, 0xe7, 0x46, 0x6b, 0xa5, 0xbf, 0x5b,
+    0x2a, 0x9e, 0xb7, 0xa3, 0x9a, 0x0d, 0xef, 0xa8, 0xfe, 0xe0, 0x0e, 0x37, 0xe4, 0x4c, 0x97, 0x7c,
+    0x62, 0xc9, 0xeb, 0xdd, 0x73, 0x00, 0x2e, 0x6f, 0x4d, 0xf3, 0xa5, 0x09, 0x97, 0xe7, 0x78, 0xb9,
+    0x7b, 0x77, 0xb5, 0xf7, 0xb0, 0xe6, 0x89, 0xdc, 0xa3, 0xd7, 0x5f, 0x2e, 0x17, 0x8b, 0x7a, 0xb2,
+    0x0d, 0x3e, 0x2e, 0xef, 0xd7, 0x41, 0xbd, 0x59, 0xad, 0xeb, 0xcd, 0x66, 0x19, 0xdc, 0x8d, 0x27,
+    0xb7, 0xb3, 0x45, 0xcd, 0x47, 0x5f, 0xf1, 0x4b, 0x17, 0x2e, 0xcf, 0x57, 0x87, 0xa6, 0x5b, 0x4f,
+    0x69, 0x39, 0x3c, 0x54, 0x7b, 0xd4, 0x72, 0x6a, 0x3d, 0x32, 0xfb, 0xf5, 0xaf, 0xde, 0x8d, 0x67,
+    0x73, 0x3e, 0xa2, 0x26, 0xf8, 0x83, 0x7f, 0xf2, 0xdd, 0xe6, 0xf2, 0xdc, 0x7f, 0xd2, 0x7a, 0x36,
+    0x09, 0x9a, 0xe2, 0x1f, 0x28, 0x36, 0xcf, 0xc6, 0xfb, 0xfd, 0x6c, 0xc3, 0xef, 0x89, 0xf0, 0x6d,
+    0xb7, 0x9f, 0x24, 0x39, 0xea, 0x9c, 0x69, 0x6b, 0x0d, 0xa0, 0xf5, 0xb8, 0xb5, 0x51, 0xff, 0xaf,
+    0x00, 0x5b, 0xcf, 0x8c, 0x19, 0x7a, 0x48, 0x8c, 0xc3, 0xff, 0x46, 0x03, 0x8f, 0x48, 0xe8, 0x3f,
+    0x26, 0xc6, 0xff, 0xb3, 0xd9, 0xae, 0x97, 0xdf, 0xd5, 0x57, 0xa3, 0xc9, 0xfd, 0x9a, 0x0f, 0xd9,
+    0xfa, 0x92, 0x7f, 0x4d, 0x38, 0x7c, 0x8d, 0x7f, 0xd4, 0x14, 0x1f, 0x15, 0xd3, 0x3b, 0x61, 0xf8,
+    0xba, 0x77, 0xf9, 0xf1, 0xd9, 0xbc, 0x5d, 0xb0, 0xc3, 0x29, 0xcb, 0x32, 0x60, 0x75, 0x2c, 0x2d,
+    0xc7, 0x8c, 0x86, 0x40, 0x3f, 0x30, 0x6c, 0xee, 0x1e, 0x62, 0xe4, 0xc9, 0xd7, 0x20, 0xd2, 0x24,
+    0x0f, 0x18, 0x07, 0x59, 0x8e, 0xdc, 0xa2, 0x4c, 0x98, 0xe4, 0x96, 0x49, 0x19, 0xf0, 0x5c, 0x66,
+    0xf3, 0xd2, 0x30, 0xdb, 0x2e, 0x71, 0x31, 0xf5, 0x9f, 0x0b, 0x78, 0x8a, 0xcf, 0x4d, 0x78, 0xe4,
+    0x33, 0x8b, 0xf4, 0x33, 0xd0, 0xd1, 0xac, 0xa2, 0xf9, 0x85, 0xcc, 0x9f, 0x59, 0x5e, 0x0d, 0x04,
+    0x48, 0x03, 0x9e, 0xe0, 0xb3, 0x73, 0x6a, 0x3f, 0xa6, 0xdf, 0xcd, 0xff, 0xc7, 0x54, 0x7c, 0x85,
+    0x1f, 0x09, 0x93, 0xac, 0x20, 0xf9, 0x8f, 0xbe, 0x11, 0xfa, 0x7f, 0x8c, 0xe9, 0xdd, 0xb2, 0x3b,
+    0xef, 0xd7, 0xdf, 0x8e, 0x57, 0xc1, 0xf6, 0xb6, 0x0e, 0xf8, 0x5c, 0xa4, 0x40, 0x0f, 0x63, 0x82,
+    0xa3, 0xdd, 0xcc, 0x16, 0xd3, 0x60, 0xb1, 0xf7, 0x95, 0x55, 0xf7, 0x0f, 0x34, 0xb1, 0xe8, 0x9d,
+    0xbf, 0xca, 0x3c, 0xfc, 0xda, 0xfc, 0xf2, 0xb0, 0x7b, 0xca, 0xcd, 0x56, 0x78, 0x17, 0xad, 0x4f,
+    0x7f, 0xe7, 0xdf, 0xd2, 0x73, 0x2e, 0xae, 0x46, 0x9d, 0xa7, 0xde, 0x1e, 0xfb, 0xb1, 0xbe, 0x74,
+    0xe4, 0x8f, 0xcd, 0x9d, 0xc7, 0x2e, 0xac, 0x87, 0x6a, 0xb7, 0x9f, 0x0e, 0xf7, 0x71, 0x55, 0x1f,
+    0x7a, 0x6a, 0x5b, 0xa7, 0x3d, 0x82, 0xf6, 0xfb, 0xad, 0xe7, 0x91, 0x5f, 0x8d, 0x7e, 0xc3, 0xa7,
+    0x2b, 0x05, 0x43, 0x97, 0x2d, 0x17, 0xea, 0xea, 0x6a, 0xf4, 0x6e, 0x3c, 0x9f, 0x4d, 0xe1, 0xf0,
+    0xbb, 0x31, 0x9d, 0xbd, 0x1a, 0x84, 0x83, 0x53, 0x46, 0x39, 0x3c, 0x92, 0xad, 0x3d, 0x57, 0xff,
+    0x6e, 0x6f, 0xb4, 0x5c, 0x9e, 0x2f, 0xb6, 0x8b, 0xd1, 0x31, 0x43, 0xed, 0x1e, 0x43, 0xd5, 0x1d,
+    0xe0, 0x64, 0x3e, 0x9b, 0x7c, 0xe7, 0x6f, 0xdb, 0xc5, 0x7c, 0x7b, 0x70, 0x30, 0x0e, 0x31, 0xe7,
+    0x6a, 0xf4, 0x86, 0xcb, 0x8e, 0xc5, 0xd9, 0xaf, 0xf6, 0xe1, 0x9a, 0xee, 0x93, 0x8a, 0x7a, 0x21,
+    0xfc, 0x58, 0x00, 0x9f, 0x0a, 0xdf, 0xc7, 0x83, 0xb7, 0x1b, 0xba, 0x76, 0xf0, 0x43, 0xfe, 0x89,
+    0xf0, 0x64, 0xbc, 0xba, 0x1a, 0xe9, 0x69, 0x67, 0x27, 0x2f, 0xf9, 0xdb, 0x72, 0xb6, 0x18, 0xb8,
+    0xa6, 0x1f, 0x03, 0x88, 0x7d, 0x7f, 0x16, 0x3b, 0x30, 0x76, 0x5c, 0x05, 0x95, 0xff, 0x7e, 0x90,
+    0x00, 0x04, 0x16, 0xf0, 0x2f, 0x32, 0xfc, 0x0f, 0xff, 0x1e, 0xeb, 0x4f, 0x01, 0x73, 0xd7, 0xdf,
+    0x5b, 0x13, 0x0c, 0x3c, 0x5a, 0x64, 0xdf, 0x16, 0x3e, 0x4e, 0xdf, 0x65, 0xb7, 0x51, 0xf6, 0xf0,
+    0x35, 0xed, 0x0e, 0xd9, 0x5d, 0xbf, 0x43, 0x15, 0xbc, 0x22, 0x75, 0x88, 0xd1, 0xe5, 0x0f, 0x34,
+    0x96, 0x06, 0xd6, 0xbc, 0x8b, 0xb2, 0xdb, 0xec, 0xe8, 0xef, 0xa9, 0x3b, 0x51, 0x7f, 0x79, 0xee,
+    0xdd, 0xeb, 0xc8, 0xdf, 0xe4, 0x65, 0x13, 0xcf, 0x40, 0x74, 0xb4, 0x96, 0x7b, 0x8d, 0x0e, 0xfe,
+    0xd4, 0x5c, 0xc0, 0x40, 0x84, 0x3b, 0x05, 0xbb, 0x27, 0x9f, 0x75, 0x5d, 0x65, 0x35, 0x5e, 0x1c,
+    0xfd, 0xdd, 0x7b, 0x73, 0xe3, 0x1b, 0xff, 0x50, 0xcc, 0xd1, 0xe0, 0x39, 0xe8, 0xa1, 0xcf, 0x06,
+    0x81, 0xa1, 0xbd, 0x96, 0x98, 0x1f, 0xfa, 0x3b, 0x1a, 0x40, 0xbb, 0xd3, 0x6f, 0xeb, 0x0f, 0xdb,
+    0x3d, 0xbb, 0xf6, 0xaf, 0xef, 0x1b, 0x64, 0x20, 0x5a, 0x15, 0x7f, 0x7a, 0xce, 0xf5, 0xe8, 0x20,
+    0x0b, 0xf5, 0xeb, 0xeb, 0x16, 0xfa, 0xb5, 0x6f, 0xbc, 0xdc, 0x4c, 0xd6, 0xb3, 0xd5, 0xfe, 0x6f,
+    0xd7, 0xe7, 0xf5, 0x36, 0xd8, 0x3d, 0xed, 0xf7, 0xcd, 0x9b, 0xaf, 0x7e, 0x1d, 0x5c, 0xe9, 0x1b,
+    0x5b, 0x9a, 0x4f, 0x77, 0xff, 0xbd, 0xb9, 0x5f, 0x4c, 0xf8, 0x04, 0xba, 0x60, 0x73, 0xbb, 0x7c,
+    0xff, 0x46, 0x1d, 0x9c, 0xdd, 0x41, 0x02, 0x8c, 0xdf, 0xd6, 0xa1, 0xb0, 0xec, 0x55, 0xf7, 0xab,
+    0x5f, 0x36, 0x68, 0xd4, 0x3f, 0xa2, 0xfc, 0x2a, 0x98, 0x2e, 0x27, 0xf7, 0x77, 0x88, 0xa7, 0xf8,
+    0x6d, 0xbd, 0xfd, 0xcd, 0xbc, 0xe6, 0xcb, 0x2f, 0x3e, 0x7e, 0x35, 0x3d, 0xdb, 0x0d, 0xb4, 0xf5,
+    0x90, 0xa3, 0xe6, 0x89, 0xdd, 0x7c, 0xe8, 0xea, 0x97, 0xfe, 0xc1, 0x83, 0xb8, 0xbf, 0xe9, 0xe7,
+    0xe8, 0x2a, 0x4d, 0xf7, 0x0f, 0xe3, 0xbb, 0x9a, 0x43, 0x6e, 0x7a, 0x1b, 0x05, 0xff, 0xa4, 0xe1,
+    0x1c, 0x5d, 0xac, 0xb5, 0x8a, 0x9b, 0xa5, 0xe2, 0x0d, 0x7a, 0xc0, 0xe9, 0xe8, 0xf0, 0xec, 0xbb,
+    0xfe, 0x44, 0x6f, 0x67, 0xd3, 0xba, 0x99, 0x68, 0x7b, 0x6e, 0x8f, 0x4e, 0xe6, 0xb8, 0x27, 0xb9,
+    0xc5, 0xe9, 0x8e, 0xd0, 0xd0, 0x1b, 0x3d, 0xba, 0xf6, 0x8b, 0xf1, 0x7a, 0x73, 0xc6, 0xc7, 0xfe,
+    0x1e, 0xdb, 0x52, 0x4f, 0xe9, 0xbd, 0x0a, 0xf4, 0x4c, 0xe0, 0xd7, 0x41, 0x94, 0x25, 0xc1, 0x2f,
+    0x03, 0x17, 0x5c, 0xec, 0xdf, 0xc8, 0xf9, 0x46, 0xda, 0x7a, 0xa3, 0xe0, 0x1b, 0x36, 0xe8, 0x3c,
+    0x39, 0x73, 0x5d, 0x6f, 0xef, 0xd7, 0x8b, 0xe0, 0x57, 0xeb, 0xf5, 0xf8, 0xe3, 0x99, 0x7b, 0xd5,
+    0xf2, 0xca, 0x98, 0x88, 0x78, 0x96, 0x74, 0xde, 0xba, 0x1b, 0xaf, 0xce, 0x3a, 0xde, 0x7e, 0xf6,
+    0xbf, 0xc2, 0x00, 0x43, 0xbb, 0xea, 0xeb, 0x93, 0xbf, 0xb6, 0x59, 0xe3, 0xf0, 0x10, 0xde, 0x9f,
+    0x7e, 0x7f, 0xa4, 0x59, 0x66, 0xc1, 0xa5, 0x9f, 0xc9, 0x2f, 0xb1, 0x4e, 0xfe, 0x19, 0xbd, 0xa3,
+    0x80, 0x5f, 0x10, 0xd4, 0xbb, 0xf2, 0xd3, 0x9e, 0x73, 0x9b, 0x07, 0x2b, 0xfe, 0xf4, 0xfb, 0x1c,
+    0xeb, 0x3a, 0x0b, 0xfe, 0x31, 0x48, 0x3f, 0xad, 0x3e, 0xec, 0x3c, 0xfb, 0xaf, 0xad, 0xdb, 0x3a,
+    0x43, 0x27, 0xb4, 0x9e, 0x8d, 0x46, 0xaf, 0x8e, 0x6c, 0x3e, 0xde, 0x7c, 0x5c, 0x4c, 0x5a, 0xbe,
+    0xdc, 0x21, 0xa0, 0x63, 0xa3, 0x6f, 0x17, 0x0f, 0x7a, 0x6f, 0xc3, 0x7a, 0x9d, 0x6f, 0x8f, 0xe0,
+    0x7d, 0x7a, 0x72, 0xfc, 0x03, 0x37, 0xb6, 0x55, 0xec, 0xab, 0x5f, 0x1c, 0x1e, 0xc9, 0x85, 0xfe,
+    0xe2, 0xfd, 0xe3, 0x1a, 0xaf, 0x82, 0xed, 0xfa, 0xbe, 0xfd, 0x6d, 0x13, 0xf8, 0x50, 0x36, 0xe6,
+    0x6d, 0xf1, 0x78, 0xda, 0x0c, 0x80, 0x4f, 0x8b, 0x6c, 0x8f, 0xa0, 0xed, 0xb5, 0xad, 0xa6, 0xb7,
+    0x9d, 0x2f, 0x35, 0xd8, 0x0d, 0x14, 0x1a, 0x7e, 0x85, 0x17, 0x8c, 0x9f, 0xf1, 0xfb, 0xf1, 0x6c,
+    0x1b, 0xdc, 0xd4, 0xdb, 0xc9, 0xed, 0xd9, 0xe8, 0x7c, 0xbc, 0x9a, 0x9d, 0xbf, 0x9f, 0xdd, 0xcc,
+    0xce, 0xf7, 0xc4, 0xdb, 0x79, 0x10, 0x99, 0xbf, 0x1b, 0xda, 0x62, 0xbc, 0xbf, 0x73, 0xd7, 0x54,
+    0xfc, 0xb7, 0xcd, 0x72, 0xd1, 0xe9, 0x1a, 0xcb, 0x7e, 0x13, 0x9c, 0xf1, 0xe2, 0xdd, 0xa3, 0xad,
+    0x37, 0xc1, 0xcf, 0x7e, 0x16, 0x74, 0xde, 0x88, 0xe7, 0xf5, 0xe2, 0x2d, 0xb8, 0xe2, 0x75, 0x90,
+    0xbc, 0xea, 0x3d, 0x8f, 0x8c, 0xc6, 0x8c, 0x85, 0xbd, 0xff, 0xf2, 0xed, 0xd7, 0xbf, 0x6f, 0xc0,
+    0xa9, 0x23, 0x84, 0xdb, 0x0d, 0xf5, 0x1c, 0x29, 0xde, 0x2c, 0xd7, 0xdb, 0xb3, 0xb3, 0x71, 0x18,
+    0x5c, 0xd3, 0x71, 0x83, 0xeb, 0x58, 0xf1, 0x11, 0x05, 0x63, 0xbd, 0x78, 0xd5, 0xbf, 0x1c, 0x5a,
+    0xe3, 0x37, 0xc8, 0x68, 0xce, 0xce, 0x9a, 0xf6, 0x74, 0xd3, 0xb1, 0x1f, 0xfb, 0xf9, 0xeb, 0x51,
+    0xf2, 0xad, 0x65, 0x9e, 0xac, 0x6b, 0xa8, 0xad, 0x66, 0xa5, 0xcf, 0xc0, 0x0a, 0xef, 0x46, 0xbd,
+    0xc7, 0xb7, 0xc9, 0x18, 0x7c, 0xba, 0x7a, 0x07, 0xb9, 0xda, 0xcf, 0x5d, 0x1f, 0x9d, 0xb8, 0xa1,
+    0xe1, 0x38, 0x5c, 0x7e, 0x36, 0x10, 0x81, 0x82, 0x39, 0x41, 0x78, 0xe3, 0xcd, 0xbb, 0xf1, 0xc7,
+    0x7c, 0x32, 0x79, 0x18, 0xec, 0x7f, 0xab, 0xa1, 0x6c, 0x80, 0xd7, 0x6c, 0xf2, 0xd4, 0xd0, 0xda,
+    0xa6, 0xfe, 0xeb, 0x40, 0x3f, 0xc3, 0xf9, 0x55, 0xfb, 0x49, 0xe8, 0xa3, 0xd7, 0x0f, 0xde, 0xc6,
+    0x7f, 0x7e, 0xfa, 0x7d, 0x0d, 0xe7, 0x5d, 0xd5, 0xff, 0xb2, 0xbd, 0x9b, 0x77, 0xc6, 0xfa, 0xea,
+    0xd3, 0x13, 0xee, 0x7d, 0xf4, 0x92, 0xa0, 0x37, 0xe3, 0x27, 0xdc, 0x10, 0x00, 0x93, 0x7e, 0xee,
+    0xc9, 0x79, 0xff, 0xe0, 0x50, 0xd0, 0xc3, 0xeb, 0xff, 0xfb, 0x7f, 0xfe, 0xf7, 0x7f, 0x35, 0xac,
+    0xfc, 0xf3, 0x27, 0x35, 0x33, 0x00, 0x67, 0xc7, 0xff, 0x3c, 0x3e, 0xcb, 0xce, 0x50, 0x5a, 0x8f,
+    0x6a, 0x1f, 0xbd, 0xfe, 0xe9, 0xf7, 0x5d, 0xc2, 0x78, 0x86, 0x35, 0xe8, 0xf3, 0x8f, 0x5e, 0xfe,
+    0xea, 0xd3, 0xb1, 0x6a, 0x19, 0x18, 0x5f, 0x37, 0xd1, 0x7a, 0xaa, 0x7f, 0x70, 0x04, 0x9c, 0x42,
+    0x7b, 0x44, 0x9f, 0x82, 0xe9, 0x17, 0x77, 0x8f, 0xb4, 0xf7, 0xd7, 0x63, 0x6f, 0x15, 0x30, 0x8c,
+    0x57, 0xab, 0x7a, 0x31, 0xfd, 0x92, 0xdf, 0x76, 0x70, 0x36, 0xe8, 0xd5, 0x9f, 0x7a, 0xef, 0xb4,
+    0xe4, 0xcb, 0x20, 0x02, 0xfd, 0x13, 0x98, 0x69, 0x0f, 0x53, 0x37, 0x12, 0xe7, 0x21, 0xc4, 0x85,
+    0xff, 0xbe, 0x92, 0x6e, 0x3c, 0x7f, 0x0a, 0xea, 0xf9, 0xa6, 0x7e, 0x04, 0xae, 0x7a, 0xc3, 0xf9,
+    0xf9, 0xc9, 0xa2, 0x04, 0xb2, 0xdd, 0x3f, 0x2c, 0x7b, 0x5d, 0x33, 0xb9, 0xf5, 0x86, 0xf9, 0xf9,
+    0xc9, 0x59, 0x8c, 0x8e, 0xee, 0x8a, 0x83, 0x6f, 0x81, 0xf6, 0xe3, 0xb7, 0xe3, 0xd9, 0x22, 0xe6,
+    0xe0, 0xf5, 0xa5, 0x29, 0xbd, 0xa1, 0x1f, 0x9e, 0x40, 0x1e, 0x4c, 0xc6, 0xc0, 0xfc, 0xe0, 0x4c,
+    0x57, 0x75, 0xc1, 0xb7, 0xdd, 0x8b, 0x4f, 0xc5, 0xc6, 0x33, 0x50, 0x53, 0x1c, 0xfc, 0x71, 0x5e,
+    0x8f, 0x31, 0xf3, 0xed, 0x63, 0xdd, 0x1c, 0x61, 0xf7, 0x83, 0xd3, 0x6f, 0x75, 0x31, 0x38, 0xf1,
+    0x4f, 0x27, 0x99, 0xf2, 0x66, 0x3c, 0xdf, 0x9c, 0xa4, 0xca, 0x75, 0x7d, 0xb7, 0x7c, 0x57, 0x0f,
+    0xb1, 0xe5, 0xbe, 0x41, 0x4a, 0xe0, 0xd9, 0xe6, 0x8d, 0xb0, 0xa2, 0x41, 0xd0, 0x43, 0xab, 0x7d,
+    0xb9, 0x76, 0x9c, 0x56, 0x1f, 0x09, 0x87, 0x5d, 0x5a, 0xfe, 0x95, 0xbe, 0x3b, 0xed, 0x01, 0x25,
+    0xb0, 0xcf, 0xdf, 0x8f, 0x34, 0xc4, 0x21, 0xd9, 0x79, 0xe8, 0xfe, 0x56, 0x4a, 0x74, 0xd4, 0xc2,
+    0xae, 0x6d, 0xdc, 0xdf, 0x19, 0x4f, 0x8c, 0x09, 0xdc, 0xd7, 0xf1, 0x76, 0x3d, 0xbb, 0xeb, 0xf0,
+    0x34, 0x59, 0xba, 0x67, 0x84, 0xae, 0x3b, 0x9c, 0x9f, 0x07, 0xbf, 0x45, 0x2e, 0xee, 0x21, 0x75,
+    0xef, 0x73, 0x21, 0xa8, 0xff, 0xdf, 0xef, 0x67, 0x78, 0x67, 0xdf, 0xe1, 0xd9, 0xdd, 0x6c, 0x31,
+    0xbb, 0xbb, 0xbf, 0x0b, 0x4a, 0x7d, 0xf1, 0x2b, 0x84, 0x5e, 0xbd, 0xde, 0xbc, 0xea, 0x09, 0x82,
+    0xdd, 0xd5, 0x7b, 0xea, 0xbf, 0x0a, 0xca, 0x3e, 0xf7, 0x1f, 0xa6, 0xf7, 0xc0, 0x6a, 0xfb, 0x07,
+    0xb4, 0xb7, 0x27, 0x78, 0xbc, 0xf6, 0x03, 0xbe, 0xd9, 0xbf, 0xc9, 0xab, 0x76, 0xff, 0x20, 0x72,
+    0x25, 0xfe, 0xa4, 0xe6, 0xe6, 0x41, 0xe5, 0xa3, 0x47, 0xc3, 0x7e, 0x78, 0xa4, 0x5d, 0x05, 0x77,
+    0x72, 0xe6, 0xc7, 0xa2, 0xe7, 0xf4, 0x8c, 0x24, 0xfc, 0x06, 0xa7, 0xf3, 0xb4, 0x09, 0xf9, 0x6f,
+    0x4a, 0xea, 0xc9, 0x8c, 0xc1, 0x29, 0xbd, 0xd0, 0xaa, 0x2f, 0xb6, 0x6b, 0x97, 0x15, 0xdb, 0x08,
+    0x75, 0x34, 0xb8, 0xc6, 0x13, 0x97, 0xc0, 0xfe, 0x96, 0x1f, 0x2e, 0x96, 0x07, 0x17, 0x5c, 0xd4,
+    0xf5, 0xb4, 0x9e, 0x7e, 0xf6, 0x6c, 0x57, 0x7a, 0xc1, 0x94, 0x5f, 0x34, 0xdd, 0x4f, 0x27, 0xb3,
+    0xc1, 0xae, 0x8e, 0xf3, 0xfa, 0x6d, 0xa7, 0xdb, 0x6a, 0x1f, 0xfb, 0x6d, 0x6f, 0xe9, 0x65, 0xee,
+    0xbc, 0xfe, 0xd0, 0xcb, 0x31, 0xa6, 0xf9, 0x96, 0x4e, 0x41, 0x85, 0xea, 0x9d, 0x4f, 0xc1, 0x2b,
+    0x5f, 0x18, 0x3d, 0x09, 0x39, 0x3f, 0x32, 0xee, 0x7d, 0xd6, 0x5f, 0x0a, 0x0d, 0xef, 0x28, 0x0f,
+    0x6f, 0x80, 0xeb, 0x97, 0xbb, 0xd4, 0x9f, 0x52, 0xad, 0x93, 0x9a, 0x07, 0x43, 0x40, 0xe9, 0x33,
+    0x0e, 0xba, 0xdc, 0x97, 0x73, 0x3e, 0x71, 0x7f, 0xef, 0x62, 0xef, 0x6f, 0xeb, 0xdd, 0x6a, 0xf1,
+    0x89, 0xfd, 0x8b, 0xfa, 0xfd, 0xce, 0x17, 0xbb, 0x98, 0xea, 0xbb, 0x3d, 0x82, 0xd2, 0x37, 0x1d,
+    0x18, 0x45, 0x4a, 0xd2, 0xb8, 0xe5, 0xce, 0x02, 0xc1, 0xfd, 0x62, 0x3b, 0x9b, 0x1f, 0xba, 0x9b,
+    0x6d, 0x3c, 0xf3, 0x7c, 0xf6, 0x5c, 0xd0, 0xf9, 0xd1, 0x5c, 0x7a, 0x30, 0x4e, 0xbf, 0x69, 0xc5,
+    0x28, 0x26, 0x59, 0x2f, 0x3a, 0x73, 0x9c, 0xdd, 0xdd, 0xd5, 0xd3, 0x19, 0xc8, 0x74, 0xfe, 0xf1,
+    0xb9, 0xb1, 0xda, 0x52, 0x03, 0x3b, 0x37, 0x69, 0x97, 0x00, 0xfe, 0xfd, 0xbe, 0x5e, 0x7f, 0x7c,
+    0xa3, 0xd5, 0x59, 0xae, 0x7f, 0x35, 0x9f, 0x9f, 0x8d, 0x3a, 0xdf, 0x6f, 0x35, 0xea, 0x56, 0x3f,
+    0x76, 0x69, 0x9f, 0x24, 0x24, 0x73, 0xbe, 0x43, 0x96, 0xd6, 0xd5, 0x10, 0x4d, 0xb4, 0x8d, 0x5e,
+    0xb5, 0xec, 0xd5, 0x44, 0xe5, 0x51, 0x76, 0xbe, 0xbf, 0xb6, 0xe5, 0xa1, 0x1d, 0x49, 0xd5, 0x5c,
+    0x70, 0xa1, 0xa2, 0x95, 0x8f, 0xf4, 0x11, 0xbf, 0xab, 0xee, 0xf1, 0xc2, 0x45, 0xa7, 0xd2, 0xd9,
+    0x32, 0x39, 0xfd, 0xed, 0x27, 0x6d, 0x48, 0x38, 0x2d, 0xe8, 0x1a, 0x0d, 0xe7, 0x2f, 0x0e, 0xc6,
+    0xfb, 0x35, 0xba, 0x99, 0xad, 0x37, 0xdb, 0x13, 0x7a, 0xce, 0x17, 0x90, 0x06, 0xd7, 0xe0, 0xbf,
+    0x0d, 0x00, 0x9e, 0x2b, 0x5b, 0xe0, 0x63, 0x7f, 0x6e, 0x14, 0xd9, 0xe1, 0xde, 0x9b, 0x63, 0x9d,
+    0xf2, 0x90, 0xce, 0x61, 0x3d, 0xa2, 0xcf, 0xca, 0x97, 0x7d, 0x39, 0xd2, 0x31, 0xde, 0xae, 0xa3,
+    0xbb, 0x7b, 0xd6, 0x89, 0xea, 0x60, 0xbc, 0x0d, 0x68, 0xcf, 0x6d, 0x47, 0xf2, 0x9c, 0xb0, 0xe2,
+    0x73, 0xa9, 0xfd, 0x85, 0xb4, 0xde, 0xbd, 0x4d, 0xdf, 0xe3, 0x7a, 0xf6, 0xc8, 0x6a, 0x3e, 0xab,
+    0xfc, 0xf5, 0x90, 0xf6, 0xdc, 0x7d, 0xbd, 0xd4, 0xe3, 0xb7, 0xef, 0x6a, 0xee, 0x47, 0x4d, 0xb0,
+    0x04, 0xfc, 0x84, 0xfb, 0x55, 0x3e, 0x7f, 0x72, 0x11, 0xad, 0x19, 0xd7, 0x71, 0x89, 0xb6, 0xfd,
+    0xa5, 0x57, 0xa3, 0xee, 0x37, 0x5a, 0xf6, 0x8a, 0xd1, 0xa3, 0xa6, 0x54, 0x0f, 0xcc, 0x8f, 0xe3,
+    0x78, 0xf4, 0x83, 0x55, 0xde, 0x9a, 0xf9, 0xc1, 0x87, 0xba, 0xb2, 0xec, 0xae, 0xde, 0xde, 0x2e,
+    0x89, 0x19, 0x7f, 0xfc, 0xe6, 0xcd, 0xb7, 0xa3, 0xb0, 0xf3, 0x19, 0xbf, 0x2b, 0x05, 0x7e, 0x77,
+    0x11, 0x7c, 0xaf, 0x61, 0x72, 0xc4, 0xd1, 0xb7, 0x1f, 0x57, 0xf5, 0x08, 0x97, 0x23, 0x53, 0x9e,
+    0xcf, 0x26, 0xfa, 0x16, 0x99, 0x73, 0xd6, 0xe8, 0x46, 0xc1, 0xa7, 0xee, 0xcd, 0xfc, 0x7e, 0x95,
+    0x8b, 0xe0, 0x7f, 0xbc, 0xf9, 0xe6, 0x0f, 0x30, 0xcf, 0x1a, 0xd3, 0x9b, 0xdd, 0x7c, 0x3c, 0xfb,
+    0x5e, 0xb8, 0x74, 0xd1, 0x91, 0x19, 0xe1, 0xde, 0xb5, 0x2e, 0x0e, 0x11, 0xf7, 0xa9, 0xf3, 0x2d,
+    0xf6, 0x9f, 0xba, 0x05, 0xc0, 0x17, 0xd4, 0x0b, 0xf7, 0x9f, 0x2f, 0xbf, 0xeb, 0x8b, 0xe3, 0x76,
+    0x20, 0x36, 0x8b, 0x51, 0x4f, 0x7f, 0x12, 0xfc, 0x2b, 0x98, 0x64, 0xdd, 0x90, 0xf1, 0x76, 0x19,
+    0xf8, 0x53, 0x0d, 0x5c, 0xa2, 0x53, 0xf9, 0xfb, 0x83, 0xcb, 0x8b, 0x16, 0x7b, 0xea, 0x74, 0x53,
+    0x6f, 0xbf, 0x9d, 0xdd, 0xd5, 0xcb, 0xfb, 0xed, 0xd9, 0xd9, 0x60, 0x5d, 0xf0, 0xfd, 0x6c, 0x31,
+    0x5d, 0xbe, 0xe7, 0xd7, 0x00, 0xca, 0xca, 0x31, 0xbf, 0x2f, 0x87, 0x2d, 0x36, 0xdf, 0xf8, 0x72,
+    0x8d, 0x01, 0x2d, 0x37, 0xfa, 0x78, 0xde, 0x17, 0xbe, 0x61, 0x90, 0x26, 0x49, 0xf2, 0x78, 0x75,
+    0xa1, 0x5f, 0xbd, 0xf0, 0xdf, 0x87, 0xfa, 0x9f, 0xff, 0x79, 0xf0, 0xca, 0xe5, 0x2e, 0x85, 0x3e,
+    0x01, 0x3e, 0x8f, 0xe5, 0xce, 0x0f, 0x46, 0x49, 0x4f, 0x2d, 0x3d, 0x62, 0x42, 0xae, 0x42, 0x03,
+    0xb0, 0xa3, 0xbf, 0xaf, 0xf8, 0xd0, 0x9a, 0x9c, 0xae, 0x7c, 0x7a, 0x05, 0xe2, 0xb1, 0xc9, 0x3e,
+    0x7d, 0xaa, 0xcf, 0x9e, 0xe8, 0x69, 0x89, 0xdf, 0xaa, 0x7d, 0xb2, 0xc1, 0xe3, 0xfa, 0x01, 0x8b,
+    0x24, 0x4f, 0x2e, 0x2c, 0xe3, 0xd7, 0xde, 0xb8, 0xf8, 0xdb, 0xd1, 0xae, 0x0f, 0x2f, 0xdb, 0x97,
+    0x62, 0x8e, 0xf4, 0x05, 0x58, 0xf4, 0x57, 0xf7, 0xdb, 0x65, 0xa4, 0x83, 0x16, 0x18, 0xe2, 0x7c,
+    0x39, 0xde, 0x29, 0xcd, 0xc6, 0xad, 0x97, 0x0b, 0xbe, 0xb7, 0x2b, 0x40, 0xf7, 0xb6, 0x4e, 0x7e,
+    0xb1, 0xfb, 0xe6, 0xa8, 0xfd, 0xce, 0xe2, 0xe5, 0xb9, 0xff, 0xbe, 0xa6, 0xcb, 0xf3, 0x5b, 0xcc,
+    0xf3, 0xf5, 0x67, 0x9f, 0xfd, 0x3f, 0xf6, 0x66, 0xc3, 0x2f, 0x2e, 0x86, 0x00, 0x00,
+};
+
+const size_t WIFI_SETUP_PAGE_GZ_LEN = sizeof(WIFI_SETUP_PAGE_GZ);
+
+#endif // WIFI_SETUP_PAGE_GZ_H
@@ -93,11 +93,16 @@
 /* Enable complex rectangle drawing with gradients, shadows, etc. */
 #define LV_DRAW_COMPLEX 1
 
-/* Enable shadow drawing */
-#define LV_SHADOW_CACHE_SIZE 0
-
-/* Maximum number of cached circle data */
-#define LV_CIRCLE_CACHE_SIZE 4
+/* Enable shadow drawing
+ * Cache the blurred shadow mask so card redraws don't recompute it.
+ * Sized for the theme cards: shadow_width 20 + radius 12 = 32
+ * (LVGL memory is PSRAM-backed, see LV_MEM_CUSTOM below) */
+#define LV_SHADOW_CACHE_SIZE 32
+
+/* Maximum number of cached circle data
+ * Raised from 4: the home/brewing arcs use rounded endpoints at several
+ * radii and kept evicting each other */
+#define LV_CIRCLE_CACHE_SIZE 8
 
 /*-------------
  * GPU
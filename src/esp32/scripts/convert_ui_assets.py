@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Build-time UI asset pipeline: PNG -> pre-rendered RGB565 LVGL descriptors
+
+Converts every PNG under assets/ui/ into a C file in src/ui/assets/ holding
+the pixel data in the display's native RGB565 (TRUE_COLOR, or
+TRUE_COLOR_ALPHA when the source has transparency) plus an lv_img_dsc_t that
+LVGL draws directly from memory-mapped flash - no decode on screen entry,
+no RAM copy. Data arrays are 4-byte aligned so the render path can DMA
+straight out of flash.
+
+Outputs are regenerated only when the source PNG is newer (incremental, so
+the pre-build hook adds nothing to a normal build). A ui_assets.h header
+with the extern descriptors is rewritten alongside.
+
+Replaces the one-shot png_to_rgb565.py / png_to_logo.py flow that needed a
+manual run per image (and left logo_splash.c hand-maintained in git).
+Generated C files stay committed so the firmware builds without Pillow or
+the source art; the pipeline only runs when assets/ui/ exists.
+
+Usage: convert_ui_assets.py [project_dir]   (also called from pre_build.py)
+"""
+
+import os
+import sys
+
+ASSETS_SUBDIR = os.path.join("assets", "ui")
+OUTPUT_SUBDIR = os.path.join("src", "ui", "assets")
+
+
+def rgb_to_rgb565(r, g, b):
+    """Convert RGB888 to RGB565"""
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def c_identifier(name):
+    """Asset file name -> C identifier base (splash-logo.png -> splash_logo)"""
+    base = os.path.splitext(os.path.basename(name))[0]
+    return "".join(c if c.isalnum() else "_" for c in base).lower()
+
+
+def convert_png(png_file, c_file):
+    """Convert one PNG to an RGB565 C file. Returns the descriptor name."""
+    from PIL import Image
+
+    img = Image.open(png_file)
+    has_alpha = img.mode in ("RGBA", "LA", "P") and (
+        img.mode != "P" or "transparency" in img.info
+    )
+    img = img.convert("RGBA" if has_alpha else "RGB")
+
+    width, height = img.size
+    ident = c_identifier(png_file)
+    pixels = img.load()
+
+    # TRUE_COLOR: 2 bytes/px LE. TRUE_COLOR_ALPHA: same + 1 alpha byte,
+    # matching LV_COLOR_DEPTH 16 layout so LVGL blits without conversion.
+    data = bytearray()
+    for y in range(height):
+        for x in range(width):
+            px = pixels[x, y]
+            rgb565 = rgb_to_rgb565(px[0], px[1], px[2])
+            data.append(rgb565 & 0xFF)
+            data.append((rgb565 >> 8) & 0xFF)
+            if has_alpha:
+                data.append(px[3])
+
+    cf = "LV_IMG_CF_TRUE_COLOR_ALPHA" if has_alpha else "LV_IMG_CF_TRUE_COLOR"
+    lines = [
+        "// Auto-generated by scripts/convert_ui_assets.py - do not edit",
+        "// Source: {} ({}x{}, {})".format(
+            os.path.basename(png_file), width, height,
+            "RGB565+A" if has_alpha else "RGB565"),
+        "// Size: {} bytes ({:.1f} KB), drawn direct from flash".format(
+            len(data), len(data) / 1024),
+        "#include <lvgl.h>",
+        "",
+        "// 4-byte aligned so the LCD driver can DMA from flash",
+        "static const uint8_t {}_data[] __attribute__((aligned(4))) = {{".format(ident),
+    ]
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("    " + ", ".join("0x{:02X}".format(b) for b in chunk) + ",")
+    lines += [
+        "};",
+        "",
+        "const lv_img_dsc_t {}_img = {{".format(ident),
+        "    .header = {",
+        "        .cf = {},".format(cf),
+        "        .w = {},".format(width),
+        "        .h = {},".format(height),
+        "    },",
+        "    .data_size = {},".format(len(data)),
+        "    .data = {}_data,".format(ident),
+        "};",
+        "",
+    ]
+
+    with open(c_file, "w") as f:
+        f.write("\n".join(lines))
+    print("  {} -> {} ({}x{}, {:.1f} KB, {})".format(
+        os.path.basename(png_file), os.path.basename(c_file),
+        width, height, len(data) / 1024, "alpha" if has_alpha else "opaque"))
+    return ident
+
+
+def write_header(header_file, idents):
+    lines = [
+        "// Auto-generated by scripts/convert_ui_assets.py - do not edit",
+        "// Pre-rendered RGB565 UI assets, drawn by LVGL direct from flash",
+        "#ifndef UI_ASSETS_H",
+        "#define UI_ASSETS_H",
+        "",
+        "#include <lvgl.h>",
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+    ]
+    for ident in sorted(idents):
+        lines.append("extern const lv_img_dsc_t {}_img;".format(ident))
+    lines += [
+        "",
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+        "#endif // UI_ASSETS_H",
+        "",
+    ]
+    content = "\n".join(lines)
+    # Don't touch the file (and trigger rebuilds) if nothing changed
+    if os.path.exists(header_file):
+        with open(header_file) as f:
+            if f.read() == content:
+                return
+    with open(header_file, "w") as f:
+        f.write(content)
+
+
+def convert_all(project_dir):
+    assets_dir = os.path.join(project_dir, ASSETS_SUBDIR)
+    output_dir = os.path.join(project_dir, OUTPUT_SUBDIR)
+
+    if not os.path.isdir(assets_dir):
+        return 0  # No source art checked out - committed C files are current
+
+    pngs = sorted(
+        f for f in os.listdir(assets_dir) if f.lower().endswith(".png")
+    )
+    if not pngs:
+        return 0
+
+    os.makedirs(output_dir, exist_ok=True)
+    idents = []
+    converted = 0
+    for png in pngs:
+        png_file = os.path.join(assets_dir, png)
+        c_file = os.path.join(output_dir, c_identifier(png) + ".c")
+        idents.append(c_identifier(png))
+        if (os.path.exists(c_file)
+                and os.path.getmtime(c_file) >= os.path.getmtime(png_file)):
+            continue  # Up to date
+        convert_png(png_file, c_file)
+        converted += 1
+
+    write_header(os.path.join(output_dir, "ui_assets.h"), idents)
+    return converted
+
+
+if __name__ == "__main__":
+    project = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(
+        os.path.dirname(os.path.abspath(__file__)))
+    n = convert_all(project)
+    if n:
+        print("Converted {} UI asset(s)".format(n))
@@ -72,8 +72,8 @@ def convert_png_to_rgb565(png_file, output_file, target_size=(180, 180)):
 #define LOGO_SPLASH_WIDTH {width}
 #define LOGO_SPLASH_HEIGHT {height}
 
-// RGB565 pixel data (little-endian)
-static const uint8_t logo_splash_data[] = {{
+// RGB565 pixel data (little-endian), 4-byte aligned for DMA from flash
+static const uint8_t logo_splash_data[] __attribute__((aligned(4))) = {{
 """
     
     # Write RGB565 colors as bytes (little-endian)
@@ -184,6 +184,35 @@ def sync_wifi_setup_page():
         print(f"[pre_build] Warning: WiFi setup sync failed: {e}")
         print("[pre_build] Continuing build...")
 
+def convert_ui_assets():
+    """
+    Regenerate pre-rendered RGB565 UI assets from source PNGs in assets/ui/.
+    Incremental (mtime-based) and a no-op when the asset directory isn't
+    checked out - the generated C files in src/ui/assets/ are committed.
+    """
+    project_dir = Path(env.get("PROJECT_DIR", "."))
+    if not (project_dir / "assets" / "ui").is_dir():
+        return
+
+    try:
+        result = subprocess.run(
+            [sys.executable, str(project_dir / "scripts" / "convert_ui_assets.py"),
+             str(project_dir)],
+            cwd=project_dir,
+            capture_output=True,
+            text=True,
+            timeout=60
+        )
+        if result.stdout.strip():
+            print("[pre_build] UI assets:")
+            print(result.stdout)
+        if result.returncode != 0:
+            print("[pre_build] Warning: UI asset conversion failed:")
+            print(result.stderr)
+            print("[pre_build] Continuing build with committed asset files")
+    except Exception as e:
+        print(f"[pre_build] Warning: UI asset conversion failed: {e}")
+
 def ensure_psram_config():
     """
     Ensure PSRAM is configured for Octal mode for ESP32-S3 N16R8 module.
@@ -216,3 +245,6 @@ ensure_psram_config()
 # Sync WiFi setup page (runs before compilation)
 sync_wifi_setup_page()
 
+# Regenerate pre-rendered UI assets if source art is present
+convert_ui_assets()
+
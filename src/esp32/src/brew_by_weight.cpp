@@ -17,9 +17,22 @@ BrewByWeight* brewByWeight = nullptr;
 BrewByWeight::BrewByWeight()
     : _wasBrewing(false)
     , _lastProgressCallback(0)
+    , _dripCount(0)
+    , _dripIndex(0)
+    , _stopLatencyMs(BBW_DEFAULT_STOP_LATENCY_MS)
+    , _currentFlow(0)
+    , _weightAtStop(0)
+    , _stopSignalTime(0)
+    , _lastSampleMs(0)
+    , _stopSampleAgeMs(0)
+    , _stopChainMs(0)
+    , _settling(false)
+    , _settleDeadline(0)
     , _onStop(nullptr)
     , _onTare(nullptr)
     , _onProgress(nullptr) {
+
+    memset(_dripHistory, 0, sizeof(_dripHistory));
     
     // Initialize settings with defaults
     _settings.target_weight = BBW_DEFAULT_TARGET_WEIGHT;
@@ -55,28 +68,64 @@ bool BrewByWeight::begin() {
 // Main Update Loop
 // =============================================================================
 
-void BrewByWeight::update(bool is_brewing, float scale_weight, bool scale_connected) {
+void BrewByWeight::update(bool is_brewing, float scale_weight, float flow_rate, bool scale_connected,
+                          uint32_t sample_ms) {
     uint32_t now = millis();
-    
+    _currentFlow = flow_rate;
+    _lastSampleMs = sample_ms;
+
     // Detect brew start
     if (is_brewing && !_wasBrewing) {
         LOG_I("BBW: Brew started");
+        _settling = false;  // A new shot cancels any pending drip measurement
         startSession(scale_weight);
-        
+
         // Auto-tare at brew start
         if (_settings.auto_tare && scale_connected && _onTare) {
             LOG_I("BBW: Auto-tare triggered");
             _onTare();
         }
     }
-    
+
     // Detect brew end
     if (!is_brewing && _wasBrewing) {
         LOG_I("BBW: Brew ended - final weight: %.1fg", _state.current_weight);
+
+        // Measure the valve-path stop latency (stop signal -> Pico actually
+        // ending the shot). This is what the predictor extrapolates flow over.
+        if (_state.stop_signaled && _stopSignalTime != 0) {
+            uint32_t latency = now - _stopSignalTime;
+            _stopChainMs = (latency > 65535) ? 65535 : (uint16_t)latency;
+            if (latency >= 50 && latency <= 2000) {
+                _stopLatencyMs = _stopLatencyMs * 0.7f + (float)latency * 0.3f;
+            }
+        }
+
+        // Keep watching the scale while the drip lands, then record the shot
+        _settling = true;
+        _settleDeadline = now + BBW_SETTLE_TIME_MS;
+
         endSession();
     }
-    
+
     _wasBrewing = is_brewing;
+
+    // Post-shot settling: track the final weight through the drip phase
+    if (_settling && scale_connected) {
+        float effective_weight = scale_weight;
+        if (_settings.auto_tare) {
+            effective_weight = scale_weight - _state.start_weight;
+            if (effective_weight < 0) effective_weight = 0;
+        }
+        _state.current_weight = effective_weight;
+
+        if ((int32_t)(now - _settleDeadline) >= 0) {
+            _settling = false;
+            if (_state.stop_signaled) {
+                recordShotOutcome(effective_weight);
+            }
+        }
+    }
     
     // Update state during brewing
     if (_state.active && scale_connected) {
@@ -165,16 +214,32 @@ float BrewByWeight::getCurrentRatio() const {
     return _state.current_weight / _settings.dose_weight;
 }
 
+float BrewByWeight::getPredictedDrip() const {
+    // Until enough shots are learned, fall back to the user's fixed offset
+    if (_dripCount < BBW_MIN_LEARNED_SHOTS) {
+        return _settings.stop_offset;
+    }
+
+    float sum = 0;
+    for (uint8_t i = 0; i < _dripCount; i++) {
+        sum += _dripHistory[i];
+    }
+    return sum / _dripCount;
+}
+
 // =============================================================================
 // Actions
 // =============================================================================
 
 void BrewByWeight::triggerStop() {
     if (_state.stop_signaled) return;
-    
+
     _state.stop_signaled = true;
     _state.target_reached = true;
-    
+    _weightAtStop = _state.current_weight;
+    _stopSignalTime = millis();
+    _stopSampleAgeMs = (_lastSampleMs != 0) ? (uint16_t)(_stopSignalTime - _lastSampleMs) : 0;
+
     if (_onStop) {
         LOG_I("BBW: Manual stop triggered at %.1fg", _state.current_weight);
         _onStop();
@@ -183,6 +248,7 @@ void BrewByWeight::triggerStop() {
 
 void BrewByWeight::reset() {
     memset(&_state, 0, sizeof(_state));
+    _settling = false;
     LOG_D("BBW: State reset");
 }
 
@@ -192,6 +258,8 @@ void BrewByWeight::reset() {
 
 void BrewByWeight::startSession(float initial_weight) {
     memset(&_state, 0, sizeof(_state));
+    _stopSampleAgeMs = 0;
+    _stopChainMs = 0;
     _state.active = true;
     _state.start_weight = initial_weight;
     _state.start_time = millis();
@@ -212,18 +280,27 @@ void BrewByWeight::endSession() {
 }
 
 void BrewByWeight::checkTarget() {
-    // Calculate stop threshold (target minus offset for drip)
-    float stop_threshold = _settings.target_weight - _settings.stop_offset;
-    
-    if (_state.current_weight >= stop_threshold) {
+    // Predict where the cup lands if we signal stop right now: weight keeps
+    // flowing while the stop propagates through the valve path (WEIGHT_STOP
+    // GPIO through the Pico), then the puck drips out. Extrapolate the flow
+    // estimate over the measured latency and add the learned drip mass.
+    float in_flight = _currentFlow * (_stopLatencyMs / 1000.0f);
+    float predicted_final = _state.current_weight + in_flight + getPredictedDrip();
+
+    if (predicted_final >= _settings.target_weight) {
         _state.target_reached = true;
-        
+
         if (_settings.auto_stop && _onStop) {
             _state.stop_signaled = true;
-            LOG_I("BBW: Target reached! Signaling stop at %.1fg (target: %.1fg, offset: %.1fg)",
+            _weightAtStop = _state.current_weight;
+            _stopSignalTime = millis();
+            _stopSampleAgeMs = (_lastSampleMs != 0) ? (uint16_t)(_stopSignalTime - _lastSampleMs) : 0;
+            LOG_I("BBW: Signaling stop at %.1fg (target: %.1fg, in-flight: %.1fg, drip: %.1fg, latency: %.0fms)",
                   _state.current_weight,
                   _settings.target_weight,
-                  _settings.stop_offset);
+                  in_flight,
+                  getPredictedDrip(),
+                  _stopLatencyMs);
             _onStop();
         } else {
             LOG_I("BBW: Target reached at %.1fg (auto-stop disabled)",
@@ -232,6 +309,28 @@ void BrewByWeight::checkTarget() {
     }
 }
 
+void BrewByWeight::recordShotOutcome(float settled_weight) {
+    float drip = settled_weight - _weightAtStop;
+
+    // Reject implausible samples - cup bumped, removed early, or tare mid-drip
+    if (drip < 0.0f || drip > BBW_MAX_DRIP_MASS) {
+        LOG_W("BBW: Discarding drip sample %.1fg", drip);
+        return;
+    }
+
+    _dripHistory[_dripIndex] = drip;
+    _dripIndex = (_dripIndex + 1) % BBW_DRIP_HISTORY_LEN;
+    if (_dripCount < BBW_DRIP_HISTORY_LEN) {
+        _dripCount++;
+    }
+
+    saveLearned();
+
+    LOG_I("BBW: Learned drip %.2fg (avg %.2fg over %d shots, latency %.0fms) - final %.1fg vs target %.1fg",
+          drip, getPredictedDrip(), _dripCount, _stopLatencyMs,
+          settled_weight, _settings.target_weight);
+}
+
 void BrewByWeight::loadSettings() {
     Preferences prefs;
     // After fresh flash, NVS namespace won't exist - this is expected
@@ -246,7 +345,17 @@ void BrewByWeight::loadSettings() {
     _settings.stop_offset = prefs.getFloat(NVS_BBW_OFFSET, BBW_DEFAULT_STOP_OFFSET);
     _settings.auto_stop = prefs.getBool(NVS_BBW_AUTO_STOP, BBW_DEFAULT_AUTO_STOP);
     _settings.auto_tare = prefs.getBool(NVS_BBW_AUTO_TARE, BBW_DEFAULT_AUTO_TARE);
-    
+
+    // Learned drip predictor state
+    if (prefs.getBytesLength(NVS_BBW_DRIP_HIST) == sizeof(_dripHistory)) {
+        prefs.getBytes(NVS_BBW_DRIP_HIST, _dripHistory, sizeof(_dripHistory));
+        _dripCount = prefs.getUChar(NVS_BBW_DRIP_CNT, 0);
+        _dripIndex = prefs.getUChar(NVS_BBW_DRIP_IDX, 0);
+        if (_dripCount > BBW_DRIP_HISTORY_LEN) _dripCount = 0;
+        if (_dripIndex >= BBW_DRIP_HISTORY_LEN) _dripIndex = 0;
+    }
+    _stopLatencyMs = prefs.getFloat(NVS_BBW_LATENCY, BBW_DEFAULT_STOP_LATENCY_MS);
+
     prefs.end();
 }
 
@@ -259,7 +368,20 @@ void BrewByWeight::saveSettings() {
     prefs.putFloat(NVS_BBW_OFFSET, _settings.stop_offset);
     prefs.putBool(NVS_BBW_AUTO_STOP, _settings.auto_stop);
     prefs.putBool(NVS_BBW_AUTO_TARE, _settings.auto_tare);
-    
+
+    prefs.end();
+}
+
+void BrewByWeight::saveLearned() {
+    // Separate from saveSettings() - written once per shot, not per UI change
+    Preferences prefs;
+    prefs.begin(NVS_BBW_NAMESPACE, false);
+
+    prefs.putBytes(NVS_BBW_DRIP_HIST, _dripHistory, sizeof(_dripHistory));
+    prefs.putUChar(NVS_BBW_DRIP_CNT, _dripCount);
+    prefs.putUChar(NVS_BBW_DRIP_IDX, _dripIndex);
+    prefs.putFloat(NVS_BBW_LATENCY, _stopLatencyMs);
+
     prefs.end();
 }
 
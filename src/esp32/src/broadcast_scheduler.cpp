@@ -0,0 +1,137 @@
+#include "broadcast_scheduler.h"
+
+// Per-sink pacing. These match the intervals that used to be scattered
+// across broadcastFullStatus() and loopUpdateMQTTStatus():
+//  - Local clients ride the 500ms broadcast tick, keepalive after 2s idle.
+//  - Cloud rides the tick too, heartbeat after 30s idle. That 30s is only
+//    the starting point: the broadcast policy retunes it from measured link
+//    quality via setKeepaliveInterval (15s flaky - 120s good).
+//  - MQTT is rate-limited to 1Hz (Home Assistant doesn't need 2Hz updates
+//    during a brew; changes coalesce into the next publish) with a 30s
+//    heartbeat. Its heartbeat republishes the retained full status.
+// All sinks get a full keyframe every 5 minutes.
+static const unsigned long LOCAL_KEEPALIVE_INTERVAL = 2000;
+static const unsigned long LOCAL_CONNECT_GRACE = 2000;
+static const unsigned long CLOUD_HEARTBEAT_INTERVAL = 30000;
+static const unsigned long MQTT_MIN_INTERVAL = 1000;
+static const unsigned long MQTT_HEARTBEAT_INTERVAL = 30000;
+static const unsigned long FULL_SYNC_INTERVAL = 300000;
+
+BroadcastScheduler::BroadcastScheduler() {
+    _sinks[SINK_LOCAL].keepaliveInterval = LOCAL_KEEPALIVE_INTERVAL;
+    _sinks[SINK_LOCAL].connectGrace = LOCAL_CONNECT_GRACE;
+    _sinks[SINK_LOCAL].fullSyncInterval = FULL_SYNC_INTERVAL;
+
+    _sinks[SINK_CLOUD].keepaliveInterval = CLOUD_HEARTBEAT_INTERVAL;
+    _sinks[SINK_CLOUD].fullSyncInterval = FULL_SYNC_INTERVAL;
+
+    _sinks[SINK_MQTT].minInterval = MQTT_MIN_INTERVAL;
+    _sinks[SINK_MQTT].keepaliveInterval = MQTT_HEARTBEAT_INTERVAL;
+    _sinks[SINK_MQTT].fullSyncInterval = FULL_SYNC_INTERVAL;
+}
+
+BroadcastScheduler::Decision BroadcastScheduler::evaluate(const ui_state_t& state,
+                                                          const bool connected[SINK_COUNT],
+                                                          unsigned long now) {
+    Decision decision;
+
+    for (uint8_t i = 0; i < SINK_COUNT; i++) {
+        SinkState& sink = _sinks[i];
+
+        if (!connected[i]) {
+            sink.wasConnected = false;
+            sink.pending = ChangedFields();
+            continue;
+        }
+
+        if (!sink.wasConnected) {
+            // (Re)connect: reset detection so the first frame is a keyframe
+            // with complete state, not a delta against a stale baseline
+            sink.detector.reset();
+            sink.needsFull = true;
+            sink.connectTime = now;
+            sink.lastFullSync = now;
+            sink.wasConnected = true;
+        }
+
+        // Accumulate changes even if this sink turns out to be rate-limited -
+        // that's what lets a due sink flush everything in one coalesced delta
+        ChangedFields changedNow;
+        if (sink.detector.hasChanged(state, &changedNow)) {
+            sink.pending.merge(changedNow);
+        }
+
+        bool inGrace = sink.connectGrace > 0 && (now - sink.connectTime < sink.connectGrace);
+        if (sink.needsFull || inGrace) {
+            // Keyframes after connect bypass the rate limit - a client waiting
+            // for initial state is worse than one extra frame
+            decision.send[i] = true;
+            decision.full[i] = true;
+            decision.changed[i] = sink.pending;
+            if (i == SINK_LOCAL) {
+                decision.firstLocal = true;
+            }
+            continue;
+        }
+
+        if (sink.minInterval > 0 && (now - sink.lastSend < sink.minInterval)) {
+            continue;  // Rate-limited; pending changes keep coalescing
+        }
+
+        bool fullSyncDue = sink.fullSyncInterval > 0 &&
+                           (now - sink.lastFullSync >= sink.fullSyncInterval);
+        bool keepaliveDue = sink.keepaliveInterval > 0 &&
+                            (now - sink.lastSend >= sink.keepaliveInterval);
+
+        if (sink.pending.anyChanged()) {
+            decision.send[i] = true;
+            decision.changed[i] = sink.pending;
+            // Major state transitions and periodic sync get a keyframe so
+            // consumers can't drift; everything else is a delta
+            decision.full[i] = sink.pending.machine_state || fullSyncDue;
+            decision.fullSync[i] = fullSyncDue;
+        } else if (fullSyncDue) {
+            decision.send[i] = true;
+            decision.full[i] = true;
+            decision.fullSync[i] = true;
+        } else if (keepaliveDue) {
+            decision.send[i] = true;
+            decision.keepalive[i] = true;
+        }
+    }
+
+    return decision;
+}
+
+void BroadcastScheduler::setMinInterval(Sink sink, unsigned long minInterval) {
+    if (sink < SINK_COUNT) {
+        _sinks[sink].minInterval = minInterval;
+    }
+}
+
+void BroadcastScheduler::setKeepaliveInterval(Sink sink, unsigned long keepaliveInterval) {
+    if (sink < SINK_COUNT) {
+        _sinks[sink].keepaliveInterval = keepaliveInterval;
+    }
+}
+
+void BroadcastScheduler::forceKeyframe(Sink sink) {
+    if (sink < SINK_COUNT) {
+        _sinks[sink].needsFull = true;
+    }
+}
+
+void BroadcastScheduler::markSent(const Decision& decision, unsigned long now) {
+    for (uint8_t i = 0; i < SINK_COUNT; i++) {
+        if (!decision.send[i]) {
+            continue;
+        }
+        SinkState& sink = _sinks[i];
+        sink.lastSend = now;
+        sink.pending = ChangedFields();
+        sink.needsFull = false;
+        if (decision.full[i]) {
+            sink.lastFullSync = now;
+        }
+    }
+}
@@ -0,0 +1,228 @@
+/**
+ * BrewOS Differential Config Sync Implementation
+ *
+ * See cloud_config_sync.h for the protocol. Everything here runs on the
+ * main loop task: loop() is called from there, and "config_pull" commands
+ * arrive through the CommandRouter which executes on the same task, so the
+ * state below needs no locking.
+ */
+
+#include "cloud_config_sync.h"
+#include "cloud_connection.h"
+#include "state/state_manager.h"
+#include "config.h"
+#include <Arduino.h>
+
+using BrewOS::Settings;
+
+// =============================================================================
+// Section table - mirrors the StateManager persistence granularity
+// =============================================================================
+
+typedef void (*section_to_json_fn)(const Settings& s, JsonObject obj);
+
+typedef struct {
+    const char* name;        // Matches StateManager::applySettings() names
+    section_to_json_fn toJson;
+} config_section_t;
+
+static const config_section_t SECTIONS[] = {
+    { "temperature",   [](const Settings& s, JsonObject o) { s.temperature.toJson(o); } },
+    { "brew",          [](const Settings& s, JsonObject o) { s.brew.toJson(o); } },
+    { "power",         [](const Settings& s, JsonObject o) { s.power.toJson(o); } },
+    { "network",       [](const Settings& s, JsonObject o) { s.network.toJson(o); } },
+    { "time",          [](const Settings& s, JsonObject o) { s.time.toJson(o); } },
+    { "mqtt",          [](const Settings& s, JsonObject o) { s.mqtt.toJson(o); } },
+    { "cloud",         [](const Settings& s, JsonObject o) { s.cloud.toJson(o); } },
+    { "scale",         [](const Settings& s, JsonObject o) { s.scale.toJson(o); } },
+    { "display",       [](const Settings& s, JsonObject o) { s.display.toJson(o); } },
+    { "schedule",      [](const Settings& s, JsonObject o) { s.schedule.toJson(o); } },
+    { "machineInfo",   [](const Settings& s, JsonObject o) { s.machineInfo.toJson(o); } },
+    { "notifications", [](const Settings& s, JsonObject o) { s.notifications.toJson(o); } },
+    { "system",        [](const Settings& s, JsonObject o) { s.system.toJson(o); } },
+    { "preferences",   [](const Settings& s, JsonObject o) { s.preferences.toJson(o); } },
+};
+static const uint8_t SECTION_COUNT = sizeof(SECTIONS) / sizeof(SECTIONS[0]);
+
+static const uint32_t CONFIG_SYNC_CHECK_MS = 1000;     // loop() self-throttle
+static const uint32_t CONFIG_SYNC_DEBOUNCE_MS = 3000;  // Let a settings burst settle
+
+// =============================================================================
+// State
+// =============================================================================
+
+static CloudConnection* s_cloud = nullptr;
+static uint32_t s_sentHash[16];     // Last hash the relay has per section
+static uint16_t s_validMask = 0;    // Which s_sentHash entries are meaningful
+static bool s_wasConnected = false;
+static uint32_t s_lastCheck = 0;
+static uint32_t s_lastGen = 0;      // settingsGeneration() at last sync
+static uint32_t s_pendingGen = 0;   // Generation waiting out the debounce
+static uint32_t s_pendingSince = 0;
+static bool s_pullRequested = false;
+static uint32_t s_uploads = 0;
+static uint32_t s_sectionsSent = 0;
+static uint32_t s_sectionsSkipped = 0;
+
+// =============================================================================
+// Hashing - FNV-1a streamed from the JSON serializer, no staging buffer
+// =============================================================================
+
+class HashPrint : public Print {
+public:
+    uint32_t hash = 2166136261u;
+    size_t write(uint8_t c) override {
+        hash = (hash ^ c) * 16777619u;
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ buffer[i]) * 16777619u;
+        }
+        return size;
+    }
+};
+
+static uint32_t hashSection(uint8_t index) {
+    JsonDocument doc;
+    JsonObject obj = doc.to<JsonObject>();
+    SECTIONS[index].toJson(State.settings(), obj);
+    HashPrint hp;
+    serializeJson(doc, hp);
+    return hp.hash;
+}
+
+// =============================================================================
+// Frames
+// =============================================================================
+
+// Connect-time bulk verify: every section hash in one frame. The relay
+// compares against its stored copies and pulls what it's missing, so the
+// sent-hash cache can optimistically assume the relay is current.
+static void sendBulkVerify() {
+    JsonDocument doc;
+    doc["type"] = "config_hashes";
+    doc["gen"] = State.settingsGeneration();
+    JsonObject hashes = doc["hashes"].to<JsonObject>();
+    for (uint8_t i = 0; i < SECTION_COUNT; i++) {
+        uint32_t h = hashSection(i);
+        hashes[SECTIONS[i].name] = h;
+        s_sentHash[i] = h;
+        s_validMask |= (1u << i);
+    }
+    s_cloud->send(doc);
+    LOG_D("ConfigSync: bulk-verify hashes sent");
+}
+
+static void uploadDelta(uint32_t gen) {
+    JsonDocument doc;
+    doc["type"] = "config_sync";
+    doc["gen"] = gen;
+    JsonObject sections = doc["sections"].to<JsonObject>();
+    JsonObject hashes = doc["hashes"].to<JsonObject>();
+
+    uint8_t sent = 0;
+    for (uint8_t i = 0; i < SECTION_COUNT; i++) {
+        uint32_t h = hashSection(i);
+        if ((s_validMask & (1u << i)) && s_sentHash[i] == h) {
+            s_sectionsSkipped++;
+            continue;
+        }
+        JsonObject obj = sections[SECTIONS[i].name].to<JsonObject>();
+        SECTIONS[i].toJson(State.settings(), obj);
+        hashes[SECTIONS[i].name] = h;
+        s_sentHash[i] = h;
+        s_validMask |= (1u << i);
+        sent++;
+    }
+
+    if (sent > 0) {
+        s_cloud->send(doc);
+        s_uploads++;
+        s_sectionsSent += sent;
+        LOG_D("ConfigSync: uploaded %u section(s), skipped %u", sent,
+              (unsigned)(SECTION_COUNT - sent));
+    }
+}
+
+// =============================================================================
+// Public interface
+// =============================================================================
+
+void CloudConfigSync::begin(CloudConnection* cloud) {
+    s_cloud = cloud;
+}
+
+void CloudConfigSync::loop() {
+    if (!s_cloud) return;
+
+    uint32_t now = millis();
+    if (now - s_lastCheck < CONFIG_SYNC_CHECK_MS) return;
+    s_lastCheck = now;
+
+    if (!s_cloud->isConnected()) {
+        s_wasConnected = false;
+        return;
+    }
+
+    if (!s_wasConnected) {
+        // Fresh connection - the relay's copy is unknown, so verify by hash
+        s_wasConnected = true;
+        s_validMask = 0;
+        sendBulkVerify();
+        s_lastGen = State.settingsGeneration();
+        s_pendingGen = s_lastGen;
+        return;
+    }
+
+    if (s_pullRequested) {
+        s_pullRequested = false;
+        uploadDelta(State.settingsGeneration());
+        s_lastGen = State.settingsGeneration();
+        s_pendingGen = s_lastGen;
+        return;
+    }
+
+    uint32_t gen = State.settingsGeneration();
+    if (gen == s_lastGen) return;
+
+    // Debounce: a settings burst (wizard page, schedule edit) bumps the
+    // generation several times - wait for it to hold still, then upload
+    // every changed section in one frame
+    if (gen != s_pendingGen) {
+        s_pendingGen = gen;
+        s_pendingSince = now;
+        return;
+    }
+    if (now - s_pendingSince >= CONFIG_SYNC_DEBOUNCE_MS) {
+        uploadDelta(gen);
+        s_lastGen = gen;
+    }
+}
+
+void CloudConfigSync::requestSections(JsonArrayConst sections) {
+    if (sections.isNull() || sections.size() == 0) {
+        // Relay wants everything re-verified
+        s_validMask = 0;
+    } else {
+        for (JsonVariantConst v : sections) {
+            const char* name = v.as<const char*>();
+            if (!name) continue;
+            for (uint8_t i = 0; i < SECTION_COUNT; i++) {
+                if (strcmp(name, SECTIONS[i].name) == 0) {
+                    s_validMask &= ~(1u << i);
+                    break;
+                }
+            }
+        }
+    }
+    s_pullRequested = true;
+}
+
+CloudConfigSync::Stats CloudConfigSync::getStats() {
+    Stats stats;
+    stats.uploads = s_uploads;
+    stats.sectionsSent = s_sectionsSent;
+    stats.sectionsSkipped = s_sectionsSkipped;
+    return stats;
+}
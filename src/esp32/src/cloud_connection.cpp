@@ -1,5 +1,9 @@
 #include "cloud_connection.h"
+#include "cloud_schema.h"
+#include "event_journal.h"
 #include "memory_utils.h"
+#include "psram_pool.h"
+#include "task_governor.h"
 #include <WiFi.h>
 #include <esp_heap_caps.h>  // For heap_caps_get_largest_free_block
 
@@ -21,6 +25,24 @@
 #define MIN_HEAP_TO_STAY_CONNECTED 12000  // Disconnect if heap drops below this (lowered to prevent thrashing)
 #define HEAP_THRESHOLD_FOR_PAUSE 35000   // Only disconnect for local UI if heap is below this
 #define SSL_HANDSHAKE_TIMEOUT_MS 20000  // 20s timeout
+// Fast-reconnect policy: a connection that survived this long was healthy, so
+// a drop is almost certainly transient - retry quickly instead of waiting the
+// 30s stability delay. Young connections keep the long delay (thrash guard).
+#define STABLE_CONNECTION_MS 60000
+#define FAST_RECONNECT_DELAY_MS 1500
+// Link quality probing: the task sends its own WebSocket pings (instead of
+// the library's opaque enableHeartbeat) so pong RTT and missed pongs are
+// measurable. statusHeartbeatMs() classifies the link from them and the
+// broadcast scheduler follows: good links idle at 120s status keepalives,
+// flaky ones tighten to 15s so a dead link surfaces fast.
+#define LINK_PING_INTERVAL_MS 15000
+#define LINK_PING_MAX_MISSES 2          // Same give-up point as the old enableHeartbeat
+#define LINK_RTT_GOOD_MS 250
+#define LINK_RTT_BAD_MS 1000
+#define LINK_FLAKY_HOLDOFF_MS 300000    // Stay tightened 5 min after a missed pong
+#define STATUS_HEARTBEAT_GOOD_MS 120000
+#define STATUS_HEARTBEAT_DEFAULT_MS 30000
+#define STATUS_HEARTBEAT_FLAKY_MS 15000
 #define CLOUD_TASK_STACK_SIZE 8192  // 8KB stack for SSL operations (increased for safety)
 #define CLOUD_TASK_PRIORITY 1  // Low priority - below web server
 
@@ -29,8 +51,11 @@ CloudConnection::CloudConnection() {
     // Use recursive mutex to prevent deadlock when callbacks try to disconnect
     // (e.g., if _onCommand calls forceDisconnect() while _ws.loop() holds the mutex)
     _mutex = xSemaphoreCreateRecursiveMutex();
-    // Queue holds pointers to PSRAM-allocated message buffers
+    // Queues hold pointers to PSRAM-allocated message buffers, one per
+    // priority class so events never wait behind status or log traffic
     _sendQueue = xQueueCreate(SEND_QUEUE_SIZE, sizeof(char*));
+    _eventQueue = xQueueCreate(EVENT_QUEUE_SIZE, sizeof(char*));
+    _logQueue = xQueueCreate(LOG_QUEUE_SIZE, sizeof(char*));
 }
 
 void CloudConnection::begin(const String& serverUrl, const String& deviceId, const String& deviceKey) {
@@ -61,6 +86,8 @@ void CloudConnection::begin(const String& serverUrl, const String& deviceId, con
             &_taskHandle,
             0  // Run on Core 0 (separate from Arduino loop on Core 1)
         );
+        // Demoted while a shot is in progress
+        TaskGovernor::manage(_taskHandle, GOV_BACKGROUND);
         LOG_I("Cloud task started on Core 0");
     }
     
@@ -95,6 +122,7 @@ void CloudConnection::end() {
             // If task still hasn't exited, force delete as last resort
             // This shouldn't happen normally, but prevents hanging
             LOG_W("Cloud task did not exit gracefully after %d ms, forcing delete", waited);
+            TaskGovernor::unmanage(_taskHandle);
             vTaskDelete(_taskHandle);
             _taskHandle = nullptr;
         }
@@ -115,12 +143,15 @@ void CloudConnection::end() {
         delay(100);
     }
     
-    // Clear send queue
-    // Note: Queue items are PSRAM-allocated (heap_caps_malloc), use heap_caps_free
-    if (_sendQueue) {
-        char* msg = nullptr;
-        while (xQueueReceive(_sendQueue, &msg, 0) == pdTRUE && msg) {
-            heap_caps_free(msg);
+    // Clear send queues
+    // Note: Queue items come from PsramPool - return them there
+    QueueHandle_t queues[] = { _eventQueue, _sendQueue, _logQueue };
+    for (QueueHandle_t queue : queues) {
+        if (queue) {
+            char* msg = nullptr;
+            while (xQueueReceive(queue, &msg, 0) == pdTRUE && msg) {
+                PsramPool::instance().release(msg);
+            }
         }
     }
     
@@ -314,6 +345,7 @@ void CloudConnection::taskCode(void* parameter) {
             // Process queue only if fully connected
             if (self->_connected) {
                 self->processSendQueue();
+                self->servicePing(now);
             }
             
             xSemaphoreGiveRecursive(self->_mutex);
@@ -338,10 +370,13 @@ void CloudConnection::taskCode(void* parameter) {
     
     LOG_I("Task ending");
     
+    // Leave the governor before the handle dies
+    TaskGovernor::unmanage(xTaskGetCurrentTaskHandle());
+
     // CRITICAL: Clear task handle BEFORE deleting, so end() knows we've exited
     // This must be done atomically-ish (single write) to avoid race conditions
     self->_taskHandle = nullptr;
-    
+
     vTaskDelete(NULL);
 }
 
@@ -466,8 +501,11 @@ void CloudConnection::connect() {
         return;
     }
     
-    // Build WebSocket path with auth params
+    // Build WebSocket path with auth params. Advertise the newest compact
+    // status schema we speak - the relay echoes its pick in the "connected"
+    // ack, or omits it to stay on legacy string-keyed map frames.
     String wsPath = "/ws/device?id=" + _deviceId;
+    wsPath += "&schema=" + String(CLOUD_SCHEMA_VERSION);
     if (!_deviceKey.isEmpty()) {
         wsPath += "&key=" + _deviceKey;
         LOG_I("Connecting with device key (length: %d)", _deviceKey.length());
@@ -500,11 +538,12 @@ void CloudConnection::connect() {
     LOG_I("Network: IP=%s, RSSI=%d dBm, Gateway=%s", 
           localIP.toString().c_str(), rssi, WiFi.gatewayIP().toString().c_str());
     
-    // Enable heartbeat (ping every 15s, timeout 8s, 2 failures to disconnect)
+    // Heartbeat pings are task-driven (see servicePing) rather than the
+    // library's enableHeartbeat - same liveness semantics, but pong RTT and
+    // misses feed the adaptive status heartbeat.
     // Mutex protection for all _ws calls
     if (xSemaphoreTakeRecursive(_mutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
-        _ws.enableHeartbeat(15000, 8000, 2);
-        
+
         // Configure SSL client timeout (default 5s is too short for slow networks)
         // WebSocketsClient uses WiFiClientSecure internally
         // Try to configure timeout - links2004/WebSockets@^2.4.1 should support getCClient()
@@ -621,6 +660,11 @@ void CloudConnection::handleEvent(WStype_t type, uint8_t* payload, size_t length
                 String reason = (length > 0 && payload) ? String((char*)payload, length) : "unknown";
                 unsigned long now = millis();
                 
+                // How long the dropped connection had been up - decides below
+                // whether the retry is fast (stable link, transient drop) or
+                // backed off (connection died young)
+                unsigned long connUptime = (_connected && _connectedAt > 0) ? (now - _connectedAt) : 0;
+
                 // Detect authentication failure: connected then immediately disconnected (< 5 seconds)
                 // This indicates server rejected the connection due to invalid credentials
                 bool isAuthFailure = false;
@@ -657,6 +701,9 @@ void CloudConnection::handleEvent(WStype_t type, uint8_t* payload, size_t length
                 _connecting = false;
                 _lastDisconnectTime = now;
                 _connectedAt = 0;  // Reset connection timestamp
+                _peerSchema = 0;   // Compact schema is renegotiated per connection
+                _pingOutstanding = false;  // Probe state resets; RTT EWMA carries over
+                _missedPongs = 0;
                 _pendingInitialStateBroadcast = false;  // Cancel pending broadcast
                 
                 // If auth failure detected, regenerate key and retry registration
@@ -677,6 +724,19 @@ void CloudConnection::handleEvent(WStype_t type, uint8_t* payload, size_t length
                 } else if (isAuthFailure && _authFailureCount > 3) {
                     LOG_E("Too many auth failures (%d) - giving up. Manual pairing required.", _authFailureCount);
                     _reconnectDelay = 300000;  // 5 min before retry
+                } else if (connUptime >= STABLE_CONNECTION_MS) {
+                    // A connection that had been up for a while dropped: the
+                    // link is fundamentally fine and the drop was transient
+                    // (carrier NAT rebind, server deploy, brief radio fade).
+                    // Retry fast so the telemetry gap stays short - shot
+                    // events sent during the gap are lost to cloud history.
+                    // If the fast retry fails, the failure paths above push
+                    // the delay back out to 10-120s as usual.
+                    _lastConnectAttempt = now;
+                    _failureCount = 0;
+                    _reconnectDelay = FAST_RECONNECT_DELAY_MS;
+                    LOG_I("Stable connection dropped after %lu s - fast reconnect in %lu ms",
+                          connUptime / 1000, (unsigned long)FAST_RECONNECT_DELAY_MS);
                 } else {
                     // Normal disconnect - only set quick retry if not already set to longer delay
                     if (_reconnectDelay < 30000) {
@@ -702,6 +762,9 @@ void CloudConnection::handleEvent(WStype_t type, uint8_t* payload, size_t length
             _authFailureCount = 0; // Reset auth failures on successful connection
             _reconnectDelay = RECONNECT_DELAY_MS; // Reset to default (2 min)
             _connectedAt = millis();  // Track connection time for grace period
+            _pingSentAt = millis();   // First link probe goes out one interval from now
+            _pingOutstanding = false;
+            _missedPongs = 0;
             _pendingInitialStateBroadcast = true;  // Schedule state broadcast after stabilization
             _initialStateBroadcastTime = millis() + 3000;  // Wait 3s for heap to stabilize after SSL
             break;
@@ -727,8 +790,20 @@ void CloudConnection::handleEvent(WStype_t type, uint8_t* payload, size_t length
             break;
             
         case WStype_PING:
+            // Library answers protocol pings from the server automatically
+            break;
+
         case WStype_PONG:
-            // Heartbeat handled by library
+            // Answer to our link probe - fold the RTT into the EWMA and
+            // clear the outstanding flag so the next probe isn't a miss
+            if (_pingOutstanding) {
+                unsigned long rtt = millis() - _pingSentAt;
+                _pingOutstanding = false;
+                _missedPongs = 0;
+                _linkRttEwmaMs = (_linkRttEwmaMs == 0)
+                                     ? rtt
+                                     : (_linkRttEwmaMs * 3 + rtt) / 4;
+            }
             break;
             
         default:
@@ -751,10 +826,25 @@ void CloudConnection::handleMessage(uint8_t* payload, size_t length) {
     
     // Handle cloud-specific messages
     if (strcmp(type, "connected") == 0) {
-        LOG_I("Cloud acknowledged connection");
+        // Schema negotiation: the relay echoes the compact status schema
+        // version it accepted (0/absent = legacy map frames)
+        _peerSchema = doc["schema"] | 0;
+        if (_peerSchema > CLOUD_SCHEMA_VERSION) {
+            LOG_W("Cloud ack'd unknown schema v%u - using legacy frames", _peerSchema);
+            _peerSchema = 0;
+        }
+        LOG_I("Cloud acknowledged connection (status schema v%u)", _peerSchema);
         return;
     }
     
+    // Event-journal catch-up: the cloud reports the last sequence it has and
+    // gets only the events it missed, instead of a full-status reconnect burst
+    if (strcmp(type, "sync") == 0) {
+        uint32_t haveSeq = doc["seq"] | 0;
+        streamEventsSince(haveSeq);
+        return;
+    }
+
     if (strcmp(type, "error") == 0) {
         const char* errorMsg = doc["error"] | "Unknown error";
         LOG_E("Cloud error: %s", errorMsg);
@@ -769,33 +859,99 @@ void CloudConnection::handleMessage(uint8_t* payload, size_t length) {
     }
 }
 
-void CloudConnection::send(const String& json) {
-    send(json.c_str());
+void CloudConnection::streamEventsSince(uint32_t haveSeq) {
+    uint32_t latest = EventJournal::latestSeq();
+    uint32_t oldest = EventJournal::oldestSeq();
+
+    // Ack with the journal bounds so the cloud knows what to expect
+    {
+        JsonDocument doc;
+        doc["type"] = "sync_ack";
+        doc["have"] = haveSeq;
+        doc["latest"] = latest;
+        doc["oldest"] = oldest;
+        char buf[128];
+        serializeJson(doc, buf, sizeof(buf));
+        send(buf, PRIORITY_EVENT);
+    }
+
+    // History the cloud wants already fell off the ring - replay what
+    // survives and schedule the full snapshot to fill the gap
+    if (oldest > 0 && haveSeq + 1 < oldest) {
+        _pendingInitialStateBroadcast = true;
+        _initialStateBroadcastTime = millis();
+    }
+
+    // Stream in pages, stopping when the event queue backs up. The cloud
+    // sends another "sync" with its new high-water seq after ingesting,
+    // so catch-up is incremental rather than one unbounded burst.
+    EventJournalRecord page[8];
+    uint32_t cursor = haveSeq;
+    size_t sent = 0;
+    while (cursor < latest && uxQueueSpacesAvailable(_eventQueue) > 1) {
+        size_t n = EventJournal::readSince(cursor, page, 8);
+        if (n == 0) {
+            break;
+        }
+        for (size_t i = 0; i < n && uxQueueSpacesAvailable(_eventQueue) > 1; i++) {
+            JsonDocument doc;
+            JsonObject obj = doc.to<JsonObject>();
+            obj["type"] = "event";
+            EventJournal::toJson(page[i], obj);
+            char buf[192];
+            serializeJson(doc, buf, sizeof(buf));
+            send(buf, PRIORITY_EVENT);
+            cursor = page[i].seq;
+            sent++;
+        }
+    }
+    if (sent > 0 || latest > haveSeq) {
+        LOG_I("Sync from seq %lu: sent %u events (latest %lu)",
+              (unsigned long)haveSeq, (unsigned)sent, (unsigned long)latest);
+    }
 }
 
-void CloudConnection::send(const char* json) {
-    if (!_connected || !json || !_sendQueue) {
+void CloudConnection::send(const char* json, SendPriority priority) {
+    if (!_connected || !json) {
         return;
     }
-    
+
+    // Route to the class queue - events drain first, logs drop first
+    QueueHandle_t queue = _sendQueue;
+    if (priority == PRIORITY_EVENT) {
+        queue = _eventQueue;
+    } else if (priority == PRIORITY_LOG) {
+        queue = _logQueue;
+    }
+    if (!queue) {
+        return;
+    }
+
     size_t len = strlen(json);
     if (len >= MAX_MSG_SIZE) {
         LOG_W("Message too large (%d bytes), dropping", len);
         return;
     }
-    
-    // Allocate in PSRAM and queue the pointer
-    char* msgCopy = (char*)heap_caps_malloc(len + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!msgCopy) {
-        msgCopy = (char*)malloc(len + 1);
-    }
-    
+
+    // Allocate from the PSRAM pool and queue the pointer
+    char* msgCopy = (char*)PsramPool::instance().allocate(len + 1, "cloud-tx");
+
     if (msgCopy) {
         memcpy(msgCopy, json, len + 1);
         // Non-blocking queue - drop if full
-        if (xQueueSend(_sendQueue, &msgCopy, 0) != pdTRUE) {
-            LOG_W("Send queue full, dropping message");
-            free(msgCopy);
+        if (xQueueSend(queue, &msgCopy, 0) != pdTRUE) {
+            if (priority == PRIORITY_LOG) {
+                // Over-quota log traffic is expected under a log storm:
+                // count it, warn occasionally, don't spam
+                _droppedLogs++;
+                if (_droppedLogs % 50 == 1) {
+                    LOG_W("Log queue full - %lu forwarded logs dropped so far",
+                          (unsigned long)_droppedLogs);
+                }
+            } else {
+                LOG_W("Send queue full, dropping message");
+            }
+            PsramPool::instance().release(msgCopy);
         }
     }
 }
@@ -812,17 +968,14 @@ void CloudConnection::send(const JsonDocument& doc) {
         return;
     }
     
-    char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!jsonBuffer) {
-        jsonBuffer = (char*)malloc(jsonSize);
-    }
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "cloud-tx");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
         // Non-blocking queue
         if (xQueueSend(_sendQueue, &jsonBuffer, 0) != pdTRUE) {
             LOG_W("Send queue full, dropping message");
-            free(jsonBuffer);
+            PsramPool::instance().release(jsonBuffer);
         }
     }
 }
@@ -837,12 +990,9 @@ void CloudConnection::sendBinary(const uint8_t* data, size_t len) {
         return;
     }
     
-    // Allocate in PSRAM and queue the pointer
+    // Allocate from the PSRAM pool and queue the pointer
     // Format: [4 bytes length (big-endian)] [1 byte marker 0x01] [data]
-    uint8_t* msgCopy = (uint8_t*)heap_caps_malloc(len + 5, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!msgCopy) {
-        msgCopy = (uint8_t*)malloc(len + 5);
-    }
+    uint8_t* msgCopy = (uint8_t*)PsramPool::instance().allocate(len + 5, "cloud-tx");
     
     if (msgCopy) {
         // Store length as big-endian uint32_t
@@ -856,37 +1006,152 @@ void CloudConnection::sendBinary(const uint8_t* data, size_t len) {
         // Non-blocking queue - drop if full
         if (xQueueSend(_sendQueue, &msgCopy, 0) != pdTRUE) {
             LOG_W("Send queue full, dropping binary message");
-            free(msgCopy);
+            PsramPool::instance().release(msgCopy);
         }
     }
 }
 
+void CloudConnection::sendBinary(MsgPackChain& chain) {
+    size_t len = chain.length();
+    if (!_connected || !_sendQueue || len == 0 || chain.overflowed()) {
+        return;
+    }
+
+    if (len >= MAX_MSG_SIZE - 5) {  // Reserve 5 bytes for length + marker
+        LOG_W("Binary message too large (%d bytes), dropping", len);
+        return;
+    }
+
+    // Same wire format as the flat-buffer path, but the frame is gathered
+    // from the chunk chain directly into the exact-size queue block - no
+    // contiguous staging buffer in between
+    uint8_t* msgCopy = (uint8_t*)PsramPool::instance().allocate(len + 5, "cloud-tx");
+
+    if (msgCopy) {
+        uint32_t len32 = len;
+        msgCopy[0] = (len32 >> 24) & 0xFF;
+        msgCopy[1] = (len32 >> 16) & 0xFF;
+        msgCopy[2] = (len32 >> 8) & 0xFF;
+        msgCopy[3] = len32 & 0xFF;
+        msgCopy[4] = 0x01;  // Binary format marker
+        if (chain.gather(msgCopy + 5, len) != len) {
+            PsramPool::instance().release(msgCopy);
+            return;
+        }
+        // Non-blocking queue - drop if full
+        if (xQueueSend(_sendQueue, &msgCopy, 0) != pdTRUE) {
+            LOG_W("Send queue full, dropping binary message");
+            PsramPool::instance().release(msgCopy);
+        }
+    }
+}
+
+// Batch envelope for coalesced text frames. Messages queued within one drain
+// pass share a frame so the radio+TLS overhead per small frame is paid once;
+// the cloud unwraps the array and handles each element as if it arrived alone.
+static const char BATCH_PREFIX[] = "{\"type\":\"batch\",\"messages\":[";
+static const char BATCH_SUFFIX[] = "]}";
+
 void CloudConnection::processSendQueue() {
     if (!_sendQueue || !_connected) {
         return;
     }
-    
-    char* msg = nullptr;
-    int processed = 0;
-    
-    // IMPORTANT: Do NOT sleep inside this function, it is called within a Mutex!
-    // Just process a batch and return.
-    
-    while (processed < 5 && xQueueReceive(_sendQueue, &msg, 0) == pdTRUE && msg) {
+
+    // Lazily allocate the coalesce buffer in PSRAM (kept for the lifetime of
+    // the connection object). If allocation fails we fall back to per-message
+    // frames - correctness doesn't depend on coalescing.
+    if (!_coalesceBuf) {
+        _coalesceBuf = (char*)PsramPool::instance().allocate(COALESCE_BUF_SIZE, "cloud-coalesce");
+    }
+
+    const size_t prefixLen = strlen(BATCH_PREFIX);
+    const size_t reserve = sizeof(BATCH_SUFFIX);  // "]}" + NUL
+    size_t batchLen = prefixLen;  // Messages accumulate after the prefix slot
+    int batchCount = 0;
+
+    // Send the accumulated batch as one frame. A lone message goes out
+    // unwrapped - the server only sees the envelope when it saves a frame.
+    auto flushBatch = [&]() {
+        if (batchCount == 0) {
+            return;
+        }
+        if (batchCount == 1) {
+            _coalesceBuf[batchLen] = '\0';
+            _ws.sendTXT(_coalesceBuf + prefixLen);
+        } else {
+            memcpy(_coalesceBuf, BATCH_PREFIX, prefixLen);
+            memcpy(_coalesceBuf + batchLen, BATCH_SUFFIX, sizeof(BATCH_SUFFIX));
+            _ws.sendTXT(_coalesceBuf);
+        }
+        batchLen = prefixLen;
+        batchCount = 0;
+    };
+
+    // Send one dequeued message (into the batch when it fits)
+    auto sendOne = [&](char* msg) {
         uint8_t* msgPtr = (uint8_t*)msg;
-        
+
         // Check for binary marker
         if (msgPtr[4] == 0x01) {
+            // Binary (MessagePack) frames go out as-is; flush pending text
+            // first so frame order matches queue order
+            flushBatch();
             uint32_t len = (msgPtr[0] << 24) | (msgPtr[1] << 16) | (msgPtr[2] << 8) | msgPtr[3];
             _ws.sendBIN(msgPtr + 5, len);
+        } else if (_coalesceBuf) {
+            size_t len = strlen(msg);
+            if (prefixLen + len + reserve + 1 > (size_t)COALESCE_BUF_SIZE) {
+                // Too large to ever share a frame - send alone
+                flushBatch();
+                _ws.sendTXT((char*)msg);
+            } else {
+                if (batchLen + len + reserve + 1 > (size_t)COALESCE_BUF_SIZE) {
+                    flushBatch();  // Full - start a new batch
+                }
+                if (batchCount > 0) {
+                    _coalesceBuf[batchLen++] = ',';
+                }
+                memcpy(_coalesceBuf + batchLen, msg, len);
+                batchLen += len;
+                batchCount++;
+            }
         } else {
             _ws.sendTXT((char*)msg);
         }
-        
-        // Use heap_caps_free because these were allocated with heap_caps_malloc in send()
-        heap_caps_free(msg);
-        processed++;
-    }
+
+        // Queue items were drawn from PsramPool in send()/sendBinary()
+        PsramPool::instance().release(msg);
+    };
+
+    auto drainQueue = [&](QueueHandle_t queue, int& quota) {
+        char* msg = nullptr;
+        while (quota > 0 && queue && xQueueReceive(queue, &msg, 0) == pdTRUE && msg) {
+            sendOne(msg);
+            quota--;
+        }
+    };
+
+    // IMPORTANT: Do NOT sleep inside this function, it is called within a Mutex!
+    // Just process a batch and return.
+    //
+    // Priority drain: events first (shot/brew lifecycle must never wait
+    // behind anything), then status, then logs capped at 2 per pass so a log
+    // storm can't monopolize the budget. Over-quota logs back up in their
+    // own small queue and get dropped-and-counted by send().
+    int budget = 8;
+    drainQueue(_eventQueue, budget);
+    drainQueue(_sendQueue, budget);
+    int logQuota = (budget < 2) ? budget : 2;
+    drainQueue(_logQueue, logQuota);
+
+    flushBatch();
+}
+
+bool CloudConnection::isBacklogged() const {
+    // Three-quarters full is the signal: below that the coalescer keeps up,
+    // above it the link is stalled and the scheduler should back off
+    return _sendQueue != nullptr &&
+           uxQueueMessagesWaiting(_sendQueue) >= (SEND_QUEUE_SIZE * 3) / 4;
 }
 
 void CloudConnection::onCommand(CommandCallback callback) {
@@ -905,6 +1170,43 @@ bool CloudConnection::isConnected() const {
     return _connected;
 }
 
+bool CloudConnection::compactStatusEnabled() const {
+    return _connected && _peerSchema >= 1 && _peerSchema <= CLOUD_SCHEMA_VERSION;
+}
+
+void CloudConnection::servicePing(unsigned long now) {
+    if (now - _pingSentAt < LINK_PING_INTERVAL_MS) {
+        return;
+    }
+    if (_pingOutstanding) {
+        // Previous probe went unanswered for a whole interval
+        _missedPongs++;
+        _lastPongMissAt = now;
+        if (_missedPongs >= LINK_PING_MAX_MISSES) {
+            LOG_W("Link dead - %u probes unanswered, disconnecting", _missedPongs);
+            forceDisconnect();
+            return;
+        }
+        LOG_W("Link probe pong missed (%u/%d)", _missedPongs, LINK_PING_MAX_MISSES);
+    }
+    _ws.sendPing();
+    _pingSentAt = now;
+    _pingOutstanding = true;
+}
+
+unsigned long CloudConnection::statusHeartbeatMs() const {
+    unsigned long now = millis();
+    bool recentMiss = _lastPongMissAt != 0 &&
+                      (now - _lastPongMissAt < LINK_FLAKY_HOLDOFF_MS);
+    if (recentMiss || _linkRttEwmaMs > LINK_RTT_BAD_MS) {
+        return STATUS_HEARTBEAT_FLAKY_MS;
+    }
+    if (_linkRttEwmaMs > 0 && _linkRttEwmaMs < LINK_RTT_GOOD_MS) {
+        return STATUS_HEARTBEAT_GOOD_MS;
+    }
+    return STATUS_HEARTBEAT_DEFAULT_MS;  // No sample yet, or middling RTT
+}
+
 String CloudConnection::getStatus() const {
     if (!_enabled) {
         return "disabled";
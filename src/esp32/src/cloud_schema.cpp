@@ -0,0 +1,113 @@
+#include "cloud_schema.h"
+#include "machine_features.h"
+#include "msgpack_helper.h"
+
+// =============================================================================
+// Presence mask from change bits
+// =============================================================================
+
+static inline uint32_t fieldBit(cloud_field_id_t id) {
+    return 1u << id;
+}
+
+// Map the coarse ChangedFields groups onto the schema's per-field bits.
+// A group sets every field id it covers - a superset delta is still valid.
+static uint32_t buildPresenceMask(const ChangedFields& changed) {
+    uint32_t mask = 0;
+    if (changed.machine_state)    mask |= fieldBit(CLOUD_FIELD_MACHINE_STATE);
+    if (changed.is_heating)       mask |= fieldBit(CLOUD_FIELD_IS_HEATING);
+    if (changed.is_brewing)       mask |= fieldBit(CLOUD_FIELD_IS_BREWING);
+    if (changed.heating_strategy) mask |= fieldBit(CLOUD_FIELD_HEATING_STRATEGY);
+    if (changed.temps) {
+        mask |= fieldBit(CLOUD_FIELD_BREW_TEMP) | fieldBit(CLOUD_FIELD_BREW_SETPOINT) |
+                fieldBit(CLOUD_FIELD_STEAM_TEMP) | fieldBit(CLOUD_FIELD_STEAM_SETPOINT) |
+                fieldBit(CLOUD_FIELD_GROUP_TEMP);
+    }
+    if (changed.pressure)         mask |= fieldBit(CLOUD_FIELD_PRESSURE);
+    if (changed.power)            mask |= fieldBit(CLOUD_FIELD_POWER_WATTS);
+    if (changed.scale_connected)  mask |= fieldBit(CLOUD_FIELD_SCALE_CONNECTED);
+    if (changed.scale_weight)     mask |= fieldBit(CLOUD_FIELD_BREW_WEIGHT);
+    if (changed.scale_flow_rate)  mask |= fieldBit(CLOUD_FIELD_FLOW_RATE);
+    if (changed.target_weight)    mask |= fieldBit(CLOUD_FIELD_TARGET_WEIGHT);
+    if (changed.connections) {
+        mask |= fieldBit(CLOUD_FIELD_PICO_CONNECTED) | fieldBit(CLOUD_FIELD_WIFI_CONNECTED) |
+                fieldBit(CLOUD_FIELD_MQTT_CONNECTED) | fieldBit(CLOUD_FIELD_CLOUD_CONNECTED) |
+                fieldBit(CLOUD_FIELD_SCALE_CONNECTED);
+    }
+    if (changed.water_low)        mask |= fieldBit(CLOUD_FIELD_WATER_LOW);
+    if (changed.cleaning) {
+        mask |= fieldBit(CLOUD_FIELD_BREW_COUNT) | fieldBit(CLOUD_FIELD_CLEANING_DUE);
+    }
+    if (changed.brew_time)        mask |= fieldBit(CLOUD_FIELD_BREW_TIME_MS);
+    if (changed.wifi)             mask |= fieldBit(CLOUD_FIELD_WIFI_RSSI);
+    return mask;
+}
+
+// =============================================================================
+// Encoder
+// =============================================================================
+
+static void writeField(MsgPackWriter& w, const ui_state_t& state, cloud_field_id_t id) {
+    switch (id) {
+        case CLOUD_FIELD_MACHINE_STATE:    w.writeUint(state.machine_state); break;
+        case CLOUD_FIELD_IS_HEATING:       w.writeBool(state.is_heating); break;
+        case CLOUD_FIELD_IS_BREWING:       w.writeBool(state.is_brewing); break;
+        case CLOUD_FIELD_HEATING_STRATEGY: w.writeUint(state.heating_strategy); break;
+        case CLOUD_FIELD_BREW_TEMP:        w.writeFloat(state.brew_temp); break;
+        case CLOUD_FIELD_BREW_SETPOINT:    w.writeFloat(state.brew_setpoint); break;
+        case CLOUD_FIELD_STEAM_TEMP:       w.writeFloat(state.steam_temp); break;
+        case CLOUD_FIELD_STEAM_SETPOINT:   w.writeFloat(state.steam_setpoint); break;
+        case CLOUD_FIELD_GROUP_TEMP:       w.writeFloat(state.group_temp); break;
+        case CLOUD_FIELD_PRESSURE:         w.writeFloat(state.pressure); break;
+        case CLOUD_FIELD_POWER_WATTS:      w.writeUint(state.power_watts); break;
+        case CLOUD_FIELD_SCALE_CONNECTED:  w.writeBool(state.scale_connected); break;
+        case CLOUD_FIELD_BREW_WEIGHT:      w.writeFloat(state.brew_weight); break;
+        case CLOUD_FIELD_FLOW_RATE:        w.writeFloat(state.flow_rate); break;
+        case CLOUD_FIELD_TARGET_WEIGHT:    w.writeFloat(state.target_weight); break;
+        case CLOUD_FIELD_PICO_CONNECTED:   w.writeBool(state.pico_connected); break;
+        case CLOUD_FIELD_WIFI_CONNECTED:   w.writeBool(state.wifi_connected); break;
+        case CLOUD_FIELD_MQTT_CONNECTED:   w.writeBool(state.mqtt_connected); break;
+        case CLOUD_FIELD_CLOUD_CONNECTED:  w.writeBool(state.cloud_connected); break;
+        case CLOUD_FIELD_WATER_LOW:        w.writeBool(state.water_low); break;
+        case CLOUD_FIELD_BREW_COUNT:       w.writeUint(state.brew_count); break;
+        case CLOUD_FIELD_CLEANING_DUE:     w.writeBool(state.cleaning_reminder); break;
+        case CLOUD_FIELD_BREW_TIME_MS:     w.writeUint(state.brew_time_ms); break;
+        case CLOUD_FIELD_WIFI_RSSI:        w.writeInt(state.wifi_rssi); break;
+        default:                           w.writeNil(); break;
+    }
+}
+
+static size_t encodeStatus(MsgPackWriter& w, const ui_state_t& state,
+                           const ChangedFields& changed, bool full, uint32_t seq) {
+    uint32_t mask = full ? (fieldBit(CLOUD_FIELD_COUNT) - 1)
+                         : buildPresenceMask(changed);
+
+    // Machines without a steam boiler never carry the steam fields - the
+    // presence mask already tells the decoder which fields are absent
+    if (!machine_has_steam_boiler(state.machine_type)) {
+        mask &= ~(fieldBit(CLOUD_FIELD_STEAM_TEMP) | fieldBit(CLOUD_FIELD_STEAM_SETPOINT));
+    }
+
+    w.beginArray(2 + __builtin_popcount(mask));
+    w.writeUint(seq);
+    w.writeUint(mask);
+    for (uint8_t id = 0; id < CLOUD_FIELD_COUNT; id++) {
+        if (mask & fieldBit((cloud_field_id_t)id)) {
+            writeField(w, state, (cloud_field_id_t)id);
+        }
+    }
+    return w.finish();
+}
+
+size_t cloudSchemaEncodeStatus(const ui_state_t& state, const ChangedFields& changed,
+                               bool full, uint32_t seq,
+                               uint8_t* buffer, size_t bufferSize) {
+    MsgPackWriter w(buffer, bufferSize);
+    return encodeStatus(w, state, changed, full, seq);
+}
+
+size_t cloudSchemaEncodeStatus(const ui_state_t& state, const ChangedFields& changed,
+                               bool full, uint32_t seq, MsgPackChain& chain) {
+    MsgPackWriter w(chain);
+    return encodeStatus(w, state, changed, full, seq);
+}
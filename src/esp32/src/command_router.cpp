@@ -0,0 +1,122 @@
+#include "command_router.h"
+#include "config.h"
+#include <string.h>
+
+QueueHandle_t CommandRouter::_queue = nullptr;
+CommandRouter::CommandSink CommandRouter::_sink = nullptr;
+CommandRouter::Entry CommandRouter::_batch[CMD_ROUTER_QUEUE_SIZE];
+uint32_t CommandRouter::_posted = 0;
+uint32_t CommandRouter::_dropped = 0;
+uint32_t CommandRouter::_superseded = 0;
+
+bool CommandRouter::begin(CommandSink sink) {
+    _sink = sink;
+    if (_queue == nullptr) {
+        _queue = xQueueCreate(CMD_ROUTER_QUEUE_SIZE, sizeof(Entry));
+    }
+    if (_queue == nullptr) {
+        LOG_E("CommandRouter: failed to create command queue");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Dedupe key for superseding commands
+ *
+ * Only absolute setters get a key - a newer value for the same target makes
+ * the older command moot. Anything with cumulative side effects (tare,
+ * brew_start/stop, enter/exit_eco, request_state, config writes) always
+ * executes, in order.
+ */
+uint8_t CommandRouter::dedupeKeyFor(const char* type, JsonDocument& doc) {
+    if (strcmp(type, "set_temp") == 0) {
+        // Brew and steam setpoints are independent targets
+        const char* boiler = doc["boiler"] | "brew";
+        return (strcmp(boiler, "steam") == 0) ? 2 : 1;
+    }
+    if (strcmp(type, "set_mode") == 0) return 3;
+    if (strcmp(type, "set_target_weight") == 0) return 4;
+    if (strcmp(type, "set_eco") == 0) return 5;
+    if (strcmp(type, "set_heating_strategy") == 0) return 6;
+    return 0;
+}
+
+bool CommandRouter::post(uint8_t source, const char* type, JsonDocument& doc) {
+    if (_queue == nullptr || type == nullptr || type[0] == '\0') {
+        return false;
+    }
+
+    // Oversized commands can't cross the queue - the caller falls back to
+    // its pre-router inline path (rare; only large config-style payloads)
+    if (measureJson(doc) + 1 > CMD_ROUTER_PAYLOAD_MAX) {
+        return false;
+    }
+
+    Entry entry;
+    entry.source = source;
+    entry.dedupeKey = dedupeKeyFor(type, doc);
+    strncpy(entry.type, type, sizeof(entry.type) - 1);
+    entry.type[sizeof(entry.type) - 1] = '\0';
+    serializeJson(doc, entry.payload, sizeof(entry.payload));
+
+    // Non-blocking: a full queue means Core 1 is badly stalled, and a
+    // dropped command is better than a producer task blocking on it
+    if (xQueueSend(_queue, &entry, 0) != pdTRUE) {
+        _dropped++;
+        LOG_W("CommandRouter: queue full, dropping %s (source=%u)", type, source);
+        return false;
+    }
+    _posted++;
+    return true;
+}
+
+void CommandRouter::drain() {
+    if (_queue == nullptr || _sink == nullptr) {
+        return;
+    }
+
+    // Pull everything pending into one batch so a burst is handled in a
+    // single pass instead of one command per loop iteration
+    size_t count = 0;
+    while (count < CMD_ROUTER_QUEUE_SIZE &&
+           xQueueReceive(_queue, &_batch[count], 0) == pdTRUE) {
+        count++;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        Entry& entry = _batch[i];
+
+        // Skip commands superseded by a later one with the same dedupe key
+        if (entry.dedupeKey != 0) {
+            bool superseded = false;
+            for (size_t j = i + 1; j < count; j++) {
+                if (_batch[j].dedupeKey == entry.dedupeKey) {
+                    superseded = true;
+                    break;
+                }
+            }
+            if (superseded) {
+                _superseded++;
+                LOG_D("CommandRouter: %s superseded by newer command", entry.type);
+                continue;
+            }
+        }
+
+        // Parse on Core 1, at dispatch time (stack document - no heap churn)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<1024> doc;
+        #pragma GCC diagnostic pop
+        DeserializationError error = deserializeJson(doc, entry.payload);
+        if (error) {
+            LOG_W("CommandRouter: bad payload for %s: %s", entry.type, error.c_str());
+            continue;
+        }
+
+        _sink(entry.source, entry.type, doc);
+    }
+}
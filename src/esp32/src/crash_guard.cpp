@@ -0,0 +1,229 @@
+#include "crash_guard.h"
+#include "config.h"
+#include <esp_attr.h>   // For RTC_NOINIT_ATTR
+#include <esp_system.h>
+
+// RTC noinit state - survives panics/watchdog resets, cleared by power cycle
+// (which is also the field technician's "undo everything" lever)
+#define CRASH_GUARD_NAME_LEN 19
+
+struct CrashGuardRTC {
+    uint32_t magic;                          // Verified before trusting contents
+    uint8_t crashCount;                      // Crash-type boots since last stable period
+    uint8_t sheddedMask;                     // Bit per CrashSubsystem, sticky across boots
+    uint8_t minimal;                         // 1 = minimal-boot mode latched
+    uint8_t lastSubsystem;                   // Most recently implicated subsystem
+    char context[CRASH_GUARD_NAME_LEN + 1];  // Last boot phase / loop task marker
+    char crashTask[CRASH_GUARD_NAME_LEN + 1];// Task name captured by the panic handler
+};
+
+RTC_NOINIT_ATTR static CrashGuardRTC rtcGuard;
+static const uint32_t CRASH_GUARD_MAGIC = 0x43475244;  // "CGRD"
+
+static bool s_stableMarked = false;   // Counter already cleared this boot
+static uint8_t s_bootCrashCount = 0;  // Count as evaluated at begin() (for toJson)
+static char s_bootAttribution[CRASH_GUARD_NAME_LEN + 1] = {0};  // What we blamed
+
+// =============================================================================
+// Attribution Table
+// =============================================================================
+
+// Maps crash breadcrumbs (FreeRTOS task names and boot-phase / loop-task
+// markers) to sheddable subsystems. Names not listed here attribute to
+// NONE, which escalates straight to minimal boot - better to shed broadly
+// than to keep crash-looping.
+struct SubsystemMapping {
+    const char* name;
+    CrashSubsystem subsystem;
+};
+
+static const SubsystemMapping SUBSYSTEM_MAP[] = {
+    // FreeRTOS task names (crashing task, from the panic handler)
+    { "MQTTTask",      CRASH_SUBSYS_MQTT },
+    { "CloudTask",     CRASH_SUBSYS_CLOUD },
+    { "PairPrewarm",   CRASH_SUBSYS_CLOUD },
+    { "FleetTask",     CRASH_SUBSYS_FLEET },
+    { "LVGLTask",      CRASH_SUBSYS_DISPLAY },
+    { "NotifPush",     CRASH_SUBSYS_NOTIFICATIONS },
+    { "nimble_host",   CRASH_SUBSYS_SCALE },   // NimBLE host task (BLE scale)
+    // Boot phases and loop-executor tasks (setContext markers)
+    { "mqtt_state",    CRASH_SUBSYS_MQTT },
+    { "scale_bbw",     CRASH_SUBSYS_SCALE },
+    { "brew_weight",   CRASH_SUBSYS_SCALE },
+    { "display",       CRASH_SUBSYS_DISPLAY },
+    { "ui",            CRASH_SUBSYS_DISPLAY },
+    { "ui_callbacks",  CRASH_SUBSYS_DISPLAY },
+    { "notifications", CRASH_SUBSYS_NOTIFICATIONS },
+};
+
+static const char* subsystemName(uint8_t subsystem) {
+    switch (subsystem) {
+        case CRASH_SUBSYS_MQTT:          return "mqtt";
+        case CRASH_SUBSYS_CLOUD:         return "cloud";
+        case CRASH_SUBSYS_SCALE:         return "scale";
+        case CRASH_SUBSYS_DISPLAY:       return "display";
+        case CRASH_SUBSYS_NOTIFICATIONS: return "notifications";
+        case CRASH_SUBSYS_FLEET:         return "fleet";
+        default:                         return "none";
+    }
+}
+
+static CrashSubsystem mapName(const char* name) {
+    if (!name || !name[0]) {
+        return CRASH_SUBSYS_NONE;
+    }
+    for (size_t i = 0; i < sizeof(SUBSYSTEM_MAP) / sizeof(SUBSYSTEM_MAP[0]); i++) {
+        if (strcmp(name, SUBSYSTEM_MAP[i].name) == 0) {
+            return SUBSYSTEM_MAP[i].subsystem;
+        }
+    }
+    return CRASH_SUBSYS_NONE;
+}
+
+// =============================================================================
+// Boot Evaluation
+// =============================================================================
+
+void CrashGuard::begin() {
+    esp_reset_reason_t reason = esp_reset_reason();
+
+    if (rtcGuard.magic != CRASH_GUARD_MAGIC) {
+        // Cold boot or corrupt state - start clean, everything enabled
+        memset(&rtcGuard, 0, sizeof(rtcGuard));
+        rtcGuard.magic = CRASH_GUARD_MAGIC;
+        return;
+    }
+
+    bool crashed = (reason == ESP_RST_PANIC ||
+                    reason == ESP_RST_INT_WDT ||
+                    reason == ESP_RST_TASK_WDT ||
+                    reason == ESP_RST_WDT ||
+                    reason == ESP_RST_BROWNOUT);
+    if (!crashed) {
+        // Clean software reset (OTA, user reboot) - keep shed state but
+        // don't count it as a crash
+        rtcGuard.context[0] = '\0';
+        rtcGuard.crashTask[0] = '\0';
+        s_bootCrashCount = rtcGuard.crashCount;
+        return;
+    }
+
+    if (rtcGuard.crashCount < 255) {
+        rtcGuard.crashCount++;
+    }
+    s_bootCrashCount = rtcGuard.crashCount;
+
+    // Attribute: the crashing task is the strongest signal; the last
+    // boot-phase / loop-task marker is the fallback for crashes on the
+    // main loop task
+    CrashSubsystem implicated = mapName(rtcGuard.crashTask);
+    const char* evidence = rtcGuard.crashTask;
+    if (implicated == CRASH_SUBSYS_NONE) {
+        implicated = mapName(rtcGuard.context);
+        evidence = rtcGuard.context;
+    }
+    strncpy(s_bootAttribution, evidence, CRASH_GUARD_NAME_LEN);
+    s_bootAttribution[CRASH_GUARD_NAME_LEN] = '\0';
+
+    Serial.printf("[CrashGuard] Crash #%u (reset reason %d, task '%s', context '%s')\n",
+                  rtcGuard.crashCount, (int)reason,
+                  rtcGuard.crashTask, rtcGuard.context);
+
+    if (rtcGuard.crashCount >= CRASH_GUARD_MINIMAL_THRESHOLD) {
+        rtcGuard.minimal = 1;
+        Serial.println("[CrashGuard] Crash loop persists - booting minimal "
+                       "(Pico control + local web only)");
+    } else if (rtcGuard.crashCount >= CRASH_GUARD_SHED_THRESHOLD) {
+        if (implicated != CRASH_SUBSYS_NONE) {
+            rtcGuard.sheddedMask |= (1u << implicated);
+            rtcGuard.lastSubsystem = implicated;
+            Serial.printf("[CrashGuard] Shedding '%s' (implicated by '%s')\n",
+                          subsystemName(implicated), s_bootAttribution);
+        } else {
+            // Can't tell what's crashing - shedding one thing at random
+            // would just burn boots, go minimal now
+            rtcGuard.minimal = 1;
+            Serial.println("[CrashGuard] Crash not attributable - booting minimal");
+        }
+    }
+
+    // Consume the breadcrumbs so a stale task name can't implicate an
+    // innocent subsystem after the next (possibly unrelated) crash
+    rtcGuard.context[0] = '\0';
+    rtcGuard.crashTask[0] = '\0';
+}
+
+void CrashGuard::loop() {
+    if (s_stableMarked || millis() < CRASH_GUARD_STABLE_MS) {
+        return;
+    }
+    s_stableMarked = true;
+
+    if (rtcGuard.crashCount > 0) {
+        LOG_I("CrashGuard: stable for %u min - crash counter cleared%s",
+              (unsigned)(CRASH_GUARD_STABLE_MS / 60000),
+              degraded() ? " (shed subsystems stay off until reset)" : "");
+        rtcGuard.crashCount = 0;
+    }
+}
+
+// =============================================================================
+// Queries & Control
+// =============================================================================
+
+bool CrashGuard::allows(CrashSubsystem subsystem) {
+    if (rtcGuard.magic != CRASH_GUARD_MAGIC) {
+        return true;  // begin() not run yet - fail open
+    }
+    if (rtcGuard.minimal) {
+        return false;
+    }
+    return (rtcGuard.sheddedMask & (1u << subsystem)) == 0;
+}
+
+void CrashGuard::setContext(const char* name) {
+    if (rtcGuard.magic != CRASH_GUARD_MAGIC || !name) {
+        return;
+    }
+    // A few byte stores - no locking. A torn string after a racing crash
+    // just fails the map lookup and escalates to minimal, which is safe.
+    strncpy(rtcGuard.context, name, CRASH_GUARD_NAME_LEN);
+    rtcGuard.context[CRASH_GUARD_NAME_LEN] = '\0';
+}
+
+void CrashGuard::recordCrashTask(const char* taskName) {
+    if (rtcGuard.magic != CRASH_GUARD_MAGIC || !taskName) {
+        return;
+    }
+    strncpy(rtcGuard.crashTask, taskName, CRASH_GUARD_NAME_LEN);
+    rtcGuard.crashTask[CRASH_GUARD_NAME_LEN] = '\0';
+}
+
+bool CrashGuard::degraded() {
+    return rtcGuard.magic == CRASH_GUARD_MAGIC &&
+           (rtcGuard.minimal || rtcGuard.sheddedMask != 0);
+}
+
+void CrashGuard::reset() {
+    rtcGuard.crashCount = 0;
+    rtcGuard.sheddedMask = 0;
+    rtcGuard.minimal = 0;
+    rtcGuard.lastSubsystem = 0;
+    LOG_I("CrashGuard: shed state cleared - all subsystems enabled on next boot");
+}
+
+void CrashGuard::toJson(JsonObject obj) {
+    obj["degraded"] = degraded();
+    obj["minimal"] = (bool)rtcGuard.minimal;
+    obj["crashCount"] = s_bootCrashCount;
+    if (s_bootAttribution[0]) {
+        obj["lastCrashEvidence"] = s_bootAttribution;
+    }
+
+    JsonArray shed = obj["shedded"].to<JsonArray>();
+    for (uint8_t s = 1; s < CRASH_SUBSYS_COUNT; s++) {
+        if (rtcGuard.minimal || (rtcGuard.sheddedMask & (1u << s))) {
+            shed.add(subsystemName(s));
+        }
+    }
+}
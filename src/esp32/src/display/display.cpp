@@ -11,12 +11,15 @@
 #include "display/display_config.h"
 #include "display/lv_fs_littlefs.h"
 #include "config.h"
+#include "task_governor.h"
+#include "trace.h"
 
 #include <esp_lcd_panel_ops.h>
 #include <esp_lcd_panel_rgb.h>
 #include <driver/gpio.h>
 #include <esp_heap_caps.h>
 #include <esp_rom_sys.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/semphr.h>
@@ -30,6 +33,12 @@ static esp_lcd_panel_handle_t panel_handle = NULL;
 // Semaphore for synchronizing LVGL flushes with DMA transfers
 static SemaphoreHandle_t s_flush_sem = NULL;
 
+// Flush instrumentation - counters only, updated from the LVGL task and read
+// from the web server task. Stale reads are acceptable for diagnostics, so no
+// locking around individual counter updates.
+static display_flush_stats_t s_flush_stats = {};
+static volatile uint8_t s_active_screen = 0;  // Set by UI via setActiveScreenId()
+
 // LVGL display driver for callback
 static lv_disp_drv_t* s_disp_drv = NULL;
 
@@ -256,6 +265,7 @@ Display::Display()
     , _backlightSaved(BACKLIGHT_DEFAULT)
     , _isDimmed(false)
     , _lastActivityTime(0)
+    , _pacingIdle(false)
     , _lvglTaskHandle(nullptr) {
 }
 
@@ -421,36 +431,50 @@ void Display::initLVGL() {
     // Register LittleFS driver for images (drive letter 'S')
     lv_fs_littlefs_init();
     
-    // Allocate LVGL draw buffer
-    // Use PSRAM for larger buffer - internal RAM is too precious (needed for SSL)
+    // Allocate LVGL draw buffers
+    // Use PSRAM for larger buffers - internal RAM is too precious (needed for SSL)
     // 40 lines in PSRAM = 480 * 40 * 2 = 38,400 bytes (12 flushes per full screen)
     // Note: May have slight display noise due to PSRAM bandwidth contention with RGB panel
+    //
+    // TWO buffers: LVGL renders the next chunk into one while the other is
+    // still being DMA'd to the panel. With a single buffer the flush callback
+    // had to block on the transfer-done semaphore before LVGL could reuse it,
+    // so any DMA delay (WiFi/WebSocket traffic on the PSRAM bus) stalled
+    // rendering - visible as shot-timer stutter on the brewing screen.
     size_t buf_size = DISPLAY_WIDTH * 40;
-    
+
     // Allocate in PSRAM to preserve internal heap for SSL
     _buf1 = (lv_color_t *)heap_caps_malloc(buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    
+    _buf2 = (lv_color_t *)heap_caps_malloc(buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+
     if (!_buf1) {
         LOG_W("PSRAM allocation failed, trying smaller internal RAM buffer");
-        // Fallback to small internal RAM buffer
+        // Fallback to small single internal RAM buffer (flushes block again,
+        // but this path only exists so a PSRAM failure still gets a UI)
+        if (_buf2) {
+            heap_caps_free(_buf2);
+            _buf2 = nullptr;
+        }
         buf_size = DISPLAY_WIDTH * 5;
         _buf1 = (lv_color_t *)heap_caps_malloc(buf_size * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     }
-    
-    _buf2 = nullptr;
-    
+
     if (!_buf1) {
         LOG_E("Failed to allocate LVGL buffer!");
         return;
     }
-    
+
     // Check where it ended up
     if ((uintptr_t)_buf1 >= 0x3FC00000 && (uintptr_t)_buf1 < 0x3FD00000) {
         LOG_I("LVGL buffer allocated in INTERNAL RAM (%d bytes)", buf_size * sizeof(lv_color_t));
+    } else if (_buf2) {
+        LOG_I("LVGL buffers allocated in PSRAM (2x %d bytes, double-buffered)",
+              buf_size * sizeof(lv_color_t));
     } else {
-        LOG_I("LVGL buffer allocated in PSRAM (%d bytes)", buf_size * sizeof(lv_color_t));
+        LOG_W("LVGL second buffer allocation failed - single-buffered (%d bytes)",
+              buf_size * sizeof(lv_color_t));
     }
-    
+
     lv_disp_draw_buf_init(&_drawBuf, _buf1, _buf2, buf_size);
     
     lv_disp_drv_init(&_dispDrv);
@@ -461,6 +485,7 @@ void Display::initLVGL() {
     _dispDrv.offset_x = 0;  // No horizontal offset
     _dispDrv.offset_y = 0;  // No vertical offset
     _dispDrv.flush_cb = flushCallback;
+    _dispDrv.monitor_cb = monitorCallback;  // Per-refresh dirty-area accounting
     _dispDrv.draw_buf = &_drawBuf;
     _dispDrv.user_data = this;
     
@@ -473,19 +498,37 @@ void Display::initLVGL() {
 }
 
 void Display::flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    TRACE_SCOPE(TRACE_PT_LVGL_FLUSH);
+
     if (!panel_handle) {
         LOG_E("Flush called but panel is NULL!");
         lv_disp_flush_ready(drv);
         return;
     }
     
+    // Record the dirty-rectangle area being flushed
+    uint32_t px = (uint32_t)lv_area_get_width(area) * (uint32_t)lv_area_get_height(area);
+    s_flush_stats.flushCount++;
+    s_flush_stats.flushPixels += px;
+    s_flush_stats.lastFlushPixels = px;
+    if (px > s_flush_stats.maxFlushPixels) {
+        s_flush_stats.maxFlushPixels = px;
+    }
+
     // Wait for any previous DMA transfer to complete
     // The semaphore is given by on_frame_trans_done when previous DMA completes
     // This ensures we don't overwrite a buffer that's still being transferred
+    // Time spent blocked here is the contention window with WiFi/PSRAM traffic
     if (s_flush_sem) {
+        int64_t wait_start = esp_timer_get_time();
         xSemaphoreTake(s_flush_sem, portMAX_DELAY);
+        uint32_t wait_us = (uint32_t)(esp_timer_get_time() - wait_start);
+        s_flush_stats.flushWaitUs += wait_us;
+        if (wait_us > s_flush_stats.maxFlushWaitUs) {
+            s_flush_stats.maxFlushWaitUs = wait_us;
+        }
     }
-    
+
     // Draw the buffer to the RGB panel
     // This starts an asynchronous DMA transfer
     // With double buffering, we can return immediately and let LVGL render the next frame
@@ -502,6 +545,48 @@ void Display::flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_
     // This enables asynchronous rendering and improves frame rate by ~2x
 }
 
+// LVGL calls this after every refresh cycle with the time spent and the
+// summed pixel count of all dirty areas rendered. A screen that invalidates
+// whole containers shows up here with px near the full frame even though the
+// individual flushes are small (the draw buffer is only 40 lines).
+void Display::monitorCallback(lv_disp_drv_t* drv, uint32_t time_ms, uint32_t px) {
+    (void)drv;
+    s_flush_stats.refreshCount++;
+    s_flush_stats.refreshPixels += px;
+    if (time_ms > s_flush_stats.maxRefreshTimeMs) {
+        s_flush_stats.maxRefreshTimeMs = time_ms;
+    }
+    if (s_active_screen < DISPLAY_STATS_MAX_SCREENS) {
+        s_flush_stats.screenInvalidations[s_active_screen]++;
+    }
+}
+
+void Display::getFlushStats(display_flush_stats_t* stats) const {
+    if (stats) {
+        *stats = s_flush_stats;
+    }
+}
+
+void Display::resetFlushStats() {
+    memset(&s_flush_stats, 0, sizeof(s_flush_stats));
+}
+
+void Display::setActiveScreenId(uint8_t screenId) {
+    s_active_screen = screenId;
+}
+
+void Display::setIdlePacing(bool idle) {
+    if (_pacingIdle == idle) {
+        return;
+    }
+    _pacingIdle = idle;
+    LOG_I("Frame pacing: %s", idle ? "idle (relaxed)" : "active (full rate)");
+    // Leaving idle pacing: wake the LVGL task so the rate change is immediate
+    if (!idle && _lvglTaskHandle) {
+        xTaskNotifyGive(_lvglTaskHandle);
+    }
+}
+
 void Display::update() {
     // LVGL timer handler now runs in dedicated FreeRTOS task
     // This function only handles backlight idle timeout
@@ -525,25 +610,43 @@ void Display::startLVGLTask() {
     );
     
     if (_lvglTaskHandle != nullptr) {
+        // Rendering shares core 1 with the loop task and outranks it
+        // statically - demoted during shots so it can't preempt the
+        // weight/stop chain mid-decision
+        TaskGovernor::manage(_lvglTaskHandle, GOV_BACKGROUND);
         LOG_I("LVGL task started on Core %d (priority %d)", LVGL_TASK_CORE, LVGL_TASK_PRIORITY);
     } else {
         LOG_E("Failed to create LVGL task!");
     }
 }
 
+// After user input, hold full frame rate this long even when the machine is
+// idle so menu navigation on the idle screen stays smooth
+static const uint32_t PACING_INTERACT_GRACE_MS = 3000;
+
 void Display::lvglTaskCode(void* parameter) {
     Display* self = static_cast<Display*>(parameter);
-    
+
     LOG_I("LVGL task running on Core %d", xPortGetCoreID());
-    
+
     while (true) {
         // Call LVGL timer handler - this processes animations and screen updates
         // Returns time until next call needed (in ms), but we use fixed interval for smooth updates
         uint32_t nextCall = lv_timer_handler();
-        
-        // Use fixed ~16ms interval for ~60 FPS updates
-        // This avoids wasting CPU cycles with unnecessarily high update rates
-        vTaskDelay(pdMS_TO_TICKS(LVGL_TASK_INTERVAL_MS));
+
+        // Frame-pacing governor: full ~60 FPS cadence while the machine is
+        // active or the user recently touched the knob, relaxed cadence
+        // (deep LVGL sleep) when idle
+        uint32_t interval = LVGL_TASK_INTERVAL_MS;
+        if (self->_pacingIdle &&
+            (millis() - self->_lastActivityTime) > PACING_INTERACT_GRACE_MS) {
+            interval = LVGL_TASK_IDLE_INTERVAL_MS;
+        }
+
+        // Sleep until the next frame; a task notification (user input or
+        // leaving idle pacing) wakes us immediately instead of waiting out
+        // the relaxed interval
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(interval));
     }
 }
 
@@ -594,6 +697,13 @@ void Display::sleep() {
 
 void Display::resetIdleTimer() {
     _lastActivityTime = millis();
+
+    // Wake the LVGL task right away - input must not wait out a relaxed
+    // idle-pacing interval
+    if (_lvglTaskHandle) {
+        xTaskNotifyGive(_lvglTaskHandle);
+    }
+
     if (_isDimmed) {
         // If screen was fully OFF (0 brightness), re-enable RGB signals first
         if (_backlightLevel == 0 && panel_handle) {
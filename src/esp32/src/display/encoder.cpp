@@ -17,6 +17,18 @@ Encoder encoder;
 // Static pointer for callbacks
 static Encoder* encoderInstance = nullptr;
 
+// =============================================================================
+// Adaptive acceleration
+// =============================================================================
+
+// Inter-event gaps below these thresholds scale the step size. A relaxed
+// turn is ~100ms+ between detents; a deliberate spin gets down to ~10ms.
+// Direction changes reset to fine steps so overshoot correction stays 1:1.
+static const uint32_t ACCEL_FAST_GAP_US  = 40000;  // < 40ms between detents
+static const uint32_t ACCEL_TURBO_GAP_US = 15000;  // < 15ms between detents
+static const int32_t ACCEL_FAST_MULT  = 2;
+static const int32_t ACCEL_TURBO_MULT = 4;
+
 // =============================================================================
 // Callback wrappers for ESP32_Knob library
 // =============================================================================
@@ -66,6 +78,10 @@ Encoder::Encoder()
     , _position(0)
     , _lastReportedPosition(0)
     , _lastLvglPosition(0)
+    , _knobHead(0)
+    , _knobTail(0)
+    , _lastEventUs(0)
+    , _lastEventDir(0)
     , _buttonPressed(false)
     , _buttonState(BTN_RELEASED)
     , _lastReportedButtonState(BTN_RELEASED)
@@ -145,19 +161,36 @@ void Encoder::resetPosition() {
     _position = 0;
     _lastReportedPosition = 0;
     _lastLvglPosition = 0;
+    _knobTail = _knobHead;  // Drop any queued events
+    _lastEventDir = 0;
     if (_knob) {
         _knob->clearCountValue();
     }
 }
 
+void Encoder::pushKnobEvent(int8_t dir) {
+    uint8_t head = _knobHead;
+    uint8_t next = (head + 1) & (KNOB_QUEUE_SIZE - 1);
+    if (next == _knobTail) {
+        // Queue full - drop the event. 16 slots per main-loop pass is far
+        // beyond any physical detent rate, so this should never trigger.
+        return;
+    }
+    _knobQueue[head].dir = dir;
+    _knobQueue[head].timestampUs = micros();
+    _knobHead = next;  // Publish after the slot is written
+}
+
 void Encoder::onKnobLeft(int count) {
     _position = _position - 1;
-    LOG_I("Encoder rotate: -1 (count=%d)", count);
+    pushKnobEvent(-1);
+    LOG_D("Encoder rotate: -1 (count=%d)", count);
 }
 
 void Encoder::onKnobRight(int count) {
     _position = _position + 1;
-    LOG_I("Encoder rotate: +1 (count=%d)", count);
+    pushKnobEvent(+1);
+    LOG_D("Encoder rotate: +1 (count=%d)", count);
 }
 
 void Encoder::onButtonSingleClick() {
@@ -176,24 +209,42 @@ void Encoder::onButtonLongPress() {
 }
 
 void Encoder::update() {
-    // Check for position change
-    int32_t diff = _position - _lastReportedPosition;
-    
+    // Drain the timestamped event queue, applying adaptive acceleration.
+    // The gap between detent edges is measured at event time, so the
+    // acceleration is immune to main-loop jitter.
+    int32_t diff = 0;
+    while (_knobTail != _knobHead) {
+        const KnobEvent& ev = _knobQueue[_knobTail];
+        uint32_t gap = ev.timestampUs - _lastEventUs;
+        int32_t step = 1;
+        if (ev.dir == _lastEventDir) {
+            if (gap < ACCEL_TURBO_GAP_US) {
+                step = ACCEL_TURBO_MULT;
+            } else if (gap < ACCEL_FAST_GAP_US) {
+                step = ACCEL_FAST_MULT;
+            }
+        }
+        diff += ev.dir * step;
+        _lastEventUs = ev.timestampUs;
+        _lastEventDir = ev.dir;
+        _knobTail = (_knobTail + 1) & (KNOB_QUEUE_SIZE - 1);
+    }
+
     // Check for button state change - atomically grab and clear
     button_state_t btnToReport = _buttonState;
     if (btnToReport != BTN_RELEASED) {
         _buttonState = BTN_RELEASED;  // Clear immediately to not miss next press
     }
-    
+
     // Report any events
     if (diff != 0 || btnToReport != BTN_RELEASED) {
         // Note: Don't reset idle timer here - let the callback handle it
         // This allows the callback to check if display was sleeping first
-        
+
         if (_callback) {
             _callback(diff, btnToReport);
         }
-        
+
         _lastReportedPosition = _position;
     }
 }
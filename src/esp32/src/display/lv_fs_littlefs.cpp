@@ -1,10 +1,53 @@
 #include "display/lv_fs_littlefs.h"
+#include "fs_worker.h"
 #include <LittleFS.h>
 #include <Arduino.h>
 
-// Helper to cast void* to File*
-static File* get_file(void* file_p) {
-    return (File*)file_p;
+// Read-ahead chunk for sequential reads. LVGL's image decoder reads assets
+// in small sequential chunks; prefetching the next chunk on the FS worker
+// while LVGL decodes the current one overlaps flash latency with decode
+// time instead of paying them back to back.
+#define LVFS_READAHEAD_SIZE 2048
+
+// All LittleFS access goes through FsWorker (foreground priority - the
+// LVGL task is blocked on the result, and these reads must jump ahead of
+// queued log/statistics writes). The read path additionally keeps a
+// per-file prefetch buffer filled asynchronously between read calls.
+struct LvFsFile {
+    File f;
+    uint32_t pos;                  // Logical read position
+    uint32_t size;                 // File size (for SEEK_END)
+    uint8_t buf[LVFS_READAHEAD_SIZE];
+    uint32_t bufPos;               // File offset of buf[0]
+    uint32_t bufLen;               // Valid bytes in buf (0 = empty)
+    SemaphoreHandle_t idle;        // Held by an in-flight prefetch job
+};
+
+/**
+ * Queue an asynchronous prefetch of the next chunk at fp->pos.
+ * Caller must hold fp->idle; ownership passes to the job (which gives it
+ * back when the buffer is filled). On post failure the buffer is simply
+ * left empty and idle is returned - the next read falls back to the
+ * synchronous path.
+ */
+static void lvfs_prefetch(LvFsFile* fp) {
+    fp->bufPos = fp->pos;
+    fp->bufLen = 0;
+
+    if (fp->pos >= fp->size) {
+        xSemaphoreGive(fp->idle);
+        return;  // At EOF - nothing to prefetch
+    }
+
+    bool posted = FsWorker::post(FsWorker::PRIO_FOREGROUND, [fp]() {
+        if (fp->f.seek(fp->bufPos, SeekSet)) {
+            fp->bufLen = fp->f.read(fp->buf, LVFS_READAHEAD_SIZE);
+        }
+        xSemaphoreGive(fp->idle);
+    });
+    if (!posted) {
+        xSemaphoreGive(fp->idle);
+    }
 }
 
 static void* fs_open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
@@ -17,54 +60,126 @@ static void* fs_open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
     String fpath = String(path);
     if (!fpath.startsWith("/")) fpath = "/" + fpath;
 
-    if (!LittleFS.exists(fpath) && (mode == LV_FS_MODE_RD)) {
+    File f;
+    uint32_t fsize = 0;
+    bool missing = false;
+    FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+        if (!LittleFS.exists(fpath) && (mode == LV_FS_MODE_RD)) {
+            missing = true;
+            return;
+        }
+        f = LittleFS.open(fpath, flags);
+        if (f) fsize = f.size();
+    });
+    if (missing || !f) return NULL;
+
+    LvFsFile* fp = new (std::nothrow) LvFsFile();
+    if (!fp) {
+        f.close();
+        return NULL;
+    }
+    fp->f = f;
+    fp->pos = 0;
+    fp->size = fsize;
+    fp->bufPos = 0;
+    fp->bufLen = 0;
+    fp->idle = xSemaphoreCreateBinary();
+    if (!fp->idle) {
+        f.close();
+        delete fp;
         return NULL;
     }
 
-    File f = LittleFS.open(fpath, flags);
-    if (!f) return NULL;
-
-    // Allocate File object on heap to persist
-    File* file_p = new File(f);
-    return (void*)file_p;
+    // Kick the first prefetch so the initial read (image header) is
+    // usually already in RAM by the time LVGL asks for it
+    lvfs_prefetch(fp);
+    return (void*)fp;
 }
 
 static lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p) {
-    File* fp = get_file(file_p);
+    LvFsFile* fp = (LvFsFile*)file_p;
     if (fp) {
-        fp->close();
+        xSemaphoreTake(fp->idle, portMAX_DELAY);  // Wait out any prefetch
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [fp]() {
+            fp->f.close();
+        });
+        vSemaphoreDelete(fp->idle);
         delete fp;
     }
     return LV_FS_RES_OK;
 }
 
 static lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
-    File* fp = get_file(file_p);
+    LvFsFile* fp = (LvFsFile*)file_p;
     if (!fp) return LV_FS_RES_INV_PARAM;
 
-    *br = fp->read((uint8_t*)buf, btr);
+    xSemaphoreTake(fp->idle, portMAX_DELAY);  // Wait for in-flight prefetch
+
+    uint8_t* out = (uint8_t*)buf;
+    uint32_t done = 0;
+
+    // Serve from the prefetch buffer first (sequential hit)
+    if (fp->pos >= fp->bufPos && fp->pos < fp->bufPos + fp->bufLen) {
+        uint32_t off = fp->pos - fp->bufPos;
+        uint32_t n = fp->bufLen - off;
+        if (n > btr) n = btr;
+        memcpy(out, fp->buf + off, n);
+        fp->pos += n;
+        done += n;
+    }
+
+    // Miss, or the request outran the buffer: read the rest synchronously
+    if (done < btr && fp->pos < fp->size) {
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+            if (fp->f.seek(fp->pos, SeekSet)) {
+                uint32_t n = fp->f.read(out + done, btr - done);
+                fp->pos += n;
+                done += n;
+            }
+        });
+    }
+
+    // If the buffer still has bytes ahead of pos, keep it; otherwise start
+    // prefetching the next chunk while LVGL consumes this one
+    if (fp->pos >= fp->bufPos && fp->pos < fp->bufPos + fp->bufLen) {
+        xSemaphoreGive(fp->idle);
+    } else {
+        lvfs_prefetch(fp);
+    }
+
+    *br = done;
     return LV_FS_RES_OK;
 }
 
 static lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
-    File* fp = get_file(file_p);
+    LvFsFile* fp = (LvFsFile*)file_p;
     if (!fp) return LV_FS_RES_INV_PARAM;
 
-    SeekMode mode;
-    if (whence == LV_FS_SEEK_SET) mode = SeekSet;
-    else if (whence == LV_FS_SEEK_CUR) mode = SeekCur;
-    else if (whence == LV_FS_SEEK_END) mode = SeekEnd;
-    else return LV_FS_RES_INV_PARAM;
+    xSemaphoreTake(fp->idle, portMAX_DELAY);
+
+    // Seeks only move the logical position - the buffer is kept and the
+    // next read decides by range check whether it still applies
+    if (whence == LV_FS_SEEK_SET) {
+        fp->pos = pos;
+    } else if (whence == LV_FS_SEEK_CUR) {
+        fp->pos += pos;
+    } else if (whence == LV_FS_SEEK_END) {
+        fp->pos = fp->size + pos;
+    } else {
+        xSemaphoreGive(fp->idle);
+        return LV_FS_RES_INV_PARAM;
+    }
+    if (fp->pos > fp->size) fp->pos = fp->size;
 
-    if (fp->seek(pos, mode)) return LV_FS_RES_OK;
-    return LV_FS_RES_UNKNOWN;
+    xSemaphoreGive(fp->idle);
+    return LV_FS_RES_OK;
 }
 
 static lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
-    File* fp = get_file(file_p);
+    LvFsFile* fp = (LvFsFile*)file_p;
     if (!fp) return LV_FS_RES_INV_PARAM;
 
-    *pos_p = fp->position();
+    *pos_p = fp->pos;
     return LV_FS_RES_OK;
 }
 
@@ -81,4 +196,3 @@ void lv_fs_littlefs_init(void) {
 
     lv_fs_drv_register(&fs_drv);
 }
-
@@ -12,6 +12,11 @@ static lv_style_t style_card;
 static lv_style_t style_btn_primary;
 static lv_style_t style_btn_secondary;
 static lv_style_t style_arc;
+
+// Pooled label styles (one shared lv_style_t per recurring font+color combo,
+// indexed by theme_label_style_t)
+static lv_style_t style_labels[THEME_LABEL_BIG_DIGITS + 1];
+
 static bool styles_initialized = false;
 
 // =============================================================================
@@ -60,7 +65,28 @@ void theme_init(void) {
     lv_style_init(&style_arc);
     lv_style_set_arc_width(&style_arc, 12);
     lv_style_set_arc_rounded(&style_arc, true);
-    
+
+    // Initialize the pooled label styles
+    lv_style_init(&style_labels[THEME_LABEL_CAPTION]);
+    lv_style_set_text_font(&style_labels[THEME_LABEL_CAPTION], FONT_SMALL);
+    lv_style_set_text_color(&style_labels[THEME_LABEL_CAPTION], COLOR_TEXT_MUTED);
+
+    lv_style_init(&style_labels[THEME_LABEL_FIELD]);
+    lv_style_set_text_font(&style_labels[THEME_LABEL_FIELD], FONT_NORMAL);
+    lv_style_set_text_color(&style_labels[THEME_LABEL_FIELD], COLOR_TEXT_MUTED);
+
+    lv_style_init(&style_labels[THEME_LABEL_TITLE]);
+    lv_style_set_text_font(&style_labels[THEME_LABEL_TITLE], FONT_LARGE);
+    lv_style_set_text_color(&style_labels[THEME_LABEL_TITLE], COLOR_TEXT_PRIMARY);
+
+    lv_style_init(&style_labels[THEME_LABEL_VALUE]);
+    lv_style_set_text_font(&style_labels[THEME_LABEL_VALUE], FONT_MEDIUM);
+    lv_style_set_text_color(&style_labels[THEME_LABEL_VALUE], COLOR_TEXT_PRIMARY);
+
+    lv_style_init(&style_labels[THEME_LABEL_BIG_DIGITS]);
+    lv_style_set_text_font(&style_labels[THEME_LABEL_BIG_DIGITS], FONT_TEMP);
+    lv_style_set_text_color(&style_labels[THEME_LABEL_BIG_DIGITS], COLOR_TEXT_PRIMARY);
+
     styles_initialized = true;
 }
 
@@ -78,6 +104,13 @@ void theme_apply_button_style(lv_obj_t* obj, bool is_primary) {
     lv_obj_add_style(obj, is_primary ? &style_btn_primary : &style_btn_secondary, 0);
 }
 
+void theme_apply_label_style(lv_obj_t* label, theme_label_style_t style) {
+    if (!styles_initialized) theme_init();
+    if (style <= THEME_LABEL_BIG_DIGITS) {
+        lv_obj_add_style(label, &style_labels[style], 0);
+    }
+}
+
 // =============================================================================
 // Widget Creation Functions
 // =============================================================================
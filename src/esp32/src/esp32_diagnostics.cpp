@@ -10,6 +10,8 @@
 #include "pico_uart.h"
 #include <Arduino.h>
 #include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>  // uxTaskGetSystemState for the task watermark table
 
 // =============================================================================
 // WEIGHT_STOP_PIN Output Test (GPIO19 screen / GPIO6 no-screen)
@@ -139,3 +141,102 @@ bool esp32_diagnostics_is_esp32_test(uint8_t test_id) {
     return (test_id == DIAG_TEST_WEIGHT_STOP_OUTPUT || test_id == DIAG_TEST_PICO_RUN_OUTPUT);
 }
 
+// =============================================================================
+// WEIGHT_STOP Loopback Latency Probe (Pico test 0x14)
+// =============================================================================
+
+bool esp32_diagnostics_weight_stop_latency_probe(PicoUART* picoUart) {
+    if (!picoUart || !picoUart->isConnected()) {
+        return false;
+    }
+
+    // Start from the normal state so the Pico sees a clean rising edge
+    pinMode(WEIGHT_STOP_PIN, OUTPUT);
+    digitalWrite(WEIGHT_STOP_PIN, LOW);
+    delay(5);  // Allow signal to settle
+
+    // GPIO first, command second: the Pico timestamps both arrivals and
+    // reports how far the hardware path led the message path. If the edge
+    // doesn't lead, the "fast" stop path is broken and the test warns.
+    digitalWrite(WEIGHT_STOP_PIN, HIGH);
+    uint8_t payload[1] = { DIAG_TEST_WEIGHT_STOP_LATENCY };
+    bool sent = picoUart->sendCommand(MSG_CMD_DIAGNOSTICS, payload, 1);
+
+    // Hold HIGH long enough for the Pico to process the command, then
+    // return to normal (LOW = no stop)
+    delay(50);
+    digitalWrite(WEIGHT_STOP_PIN, LOW);
+
+    if (sent) {
+        LOG_I("Diagnostics: WEIGHT_STOP latency probe sent (GPIO%d pulsed)", WEIGHT_STOP_PIN);
+    } else {
+        LOG_W("Diagnostics: WEIGHT_STOP latency probe - command send failed");
+    }
+    return sent;
+}
+
+
+// =============================================================================
+// Per-Task Watermark Table
+// =============================================================================
+
+size_t esp32_diagnostics_task_table(diag_task_info_t* out, size_t max_tasks) {
+    if (!out || max_tasks == 0) return 0;
+
+    // Previous runtime counters, keyed by task handle, for CPU share deltas.
+    // A task that died since the last call just ages out of the table.
+    static struct {
+        TaskHandle_t handle;
+        uint32_t runTime;
+    } prev[DIAG_TASK_MAX];
+    static uint32_t prevTotalRunTime = 0;
+    static bool havePrev = false;
+
+    TaskStatus_t status[DIAG_TASK_MAX];
+    uint32_t totalRunTime = 0;
+    UBaseType_t count = uxTaskGetSystemState(status, DIAG_TASK_MAX, &totalRunTime);
+    if (count == 0) return 0;  // More tasks than DIAG_TASK_MAX - table too small
+
+    uint32_t totalDelta = totalRunTime - prevTotalRunTime;
+
+    size_t written = 0;
+    for (UBaseType_t i = 0; i < count && written < max_tasks; i++) {
+        diag_task_info_t* info = &out[written++];
+        strncpy(info->name, status[i].pcTaskName, sizeof(info->name) - 1);
+        info->name[sizeof(info->name) - 1] = '\0';
+        // uxTaskGetSystemState reports the watermark in words
+        info->stack_high_water = status[i].usStackHighWaterMark * sizeof(StackType_t);
+        info->priority = (uint8_t)status[i].uxCurrentPriority;
+        info->state = (uint8_t)status[i].eCurrentState;
+
+        BaseType_t core = xTaskGetCoreID(status[i].xHandle);
+        info->core = (core == tskNO_AFFINITY) ? -1 : (int8_t)core;
+
+        // CPU share since the previous call. Counters are 32-bit microseconds
+        // and wrap after ~71 minutes - a wrapped or first sample reports 255.
+        info->cpu_percent = 255;
+        if (havePrev && totalRunTime != 0 && totalDelta > 0 &&
+            totalRunTime > prevTotalRunTime) {
+            for (size_t p = 0; p < DIAG_TASK_MAX; p++) {
+                if (prev[p].handle == status[i].xHandle) {
+                    uint32_t taskDelta = status[i].ulRunTimeCounter - prev[p].runTime;
+                    if (taskDelta <= totalDelta) {
+                        info->cpu_percent = (uint8_t)((uint64_t)taskDelta * 100 / totalDelta);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    // Save this sample as the baseline for the next call
+    memset(prev, 0, sizeof(prev));
+    for (UBaseType_t i = 0; i < count && i < DIAG_TASK_MAX; i++) {
+        prev[i].handle = status[i].xHandle;
+        prev[i].runTime = status[i].ulRunTimeCounter;
+    }
+    prevTotalRunTime = totalRunTime;
+    havePrev = true;
+
+    return written;
+}
@@ -0,0 +1,194 @@
+#include "event_journal.h"
+#include "config.h"
+#include "utils/status_strings.h"
+#include "user_fs.h"
+#include <time.h>
+
+bool EventJournal::_ready = false;
+uint32_t EventJournal::_nextSeq = 1;
+uint8_t EventJournal::_lastState = 0;
+bool EventJournal::_stateValid = false;
+bool EventJournal::_wasBrewing = false;
+uint32_t EventJournal::_brewStartMs = 0;
+float EventJournal::_peakPressure = 0.0f;
+
+static size_t slotOffset(uint32_t seq) {
+    return sizeof(EventJournalHeader) +
+           (size_t)(seq % EVENT_JOURNAL_CAPACITY) * sizeof(EventJournalRecord);
+}
+
+void EventJournal::begin() {
+    File file = userFS().open(EVENT_JOURNAL_FILE, "r");
+    bool valid = false;
+    if (file) {
+        EventJournalHeader header;
+        valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                header.magic == EVENT_JOURNAL_MAGIC &&
+                header.version == EVENT_JOURNAL_VERSION &&
+                header.recordSize == sizeof(EventJournalRecord) &&
+                header.capacity == EVENT_JOURNAL_CAPACITY;
+
+        if (valid) {
+            // Recover the sequence counter: scan the ring for the highest
+            // seq (256 records, one linear pass - cheap at boot)
+            uint32_t maxSeq = 0;
+            EventJournalRecord record;
+            while (file.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+                if (record.seq > maxSeq) {
+                    maxSeq = record.seq;
+                }
+            }
+            _nextSeq = maxSeq + 1;
+        }
+        file.close();
+    }
+
+    if (!valid) {
+        // Create (or recreate after a layout change) the preallocated ring
+        // so appends are always in-place slot writes
+        file = userFS().open(EVENT_JOURNAL_FILE, "w");
+        if (!file) {
+            LOG_W("Event journal: failed to create %s", EVENT_JOURNAL_FILE);
+            return;
+        }
+        EventJournalHeader header;
+        header.magic = EVENT_JOURNAL_MAGIC;
+        header.version = EVENT_JOURNAL_VERSION;
+        header.recordSize = sizeof(EventJournalRecord);
+        header.capacity = EVENT_JOURNAL_CAPACITY;
+        bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+        EventJournalRecord empty;
+        for (uint32_t i = 0; ok && i < EVENT_JOURNAL_CAPACITY; i++) {
+            ok = file.write((const uint8_t*)&empty, sizeof(empty)) == sizeof(empty);
+        }
+        file.close();
+        if (!ok) {
+            LOG_W("Event journal: failed to preallocate ring");
+            userFS().remove(EVENT_JOURNAL_FILE);
+            return;
+        }
+        _nextSeq = 1;
+    }
+
+    _ready = true;
+    LOG_I("Event journal ready (next seq %lu)", (unsigned long)_nextSeq);
+}
+
+void EventJournal::loop(const ui_state_t& state) {
+    if (!_ready) {
+        return;
+    }
+
+    // State transition events
+    if (!_stateValid) {
+        _lastState = state.machine_state;
+        _stateValid = true;
+    } else if (state.machine_state != _lastState) {
+        EventJournalRecord record;
+        record.type = EVENT_TYPE_STATE;
+        record.stateFrom = _lastState;
+        record.stateTo = state.machine_state;
+        append(record);
+        _lastState = state.machine_state;
+    }
+
+    // Shot events - track peak pressure while brewing, append on completion
+    if (state.is_brewing) {
+        if (!_wasBrewing) {
+            _brewStartMs = millis();
+            _peakPressure = 0.0f;
+        }
+        if (state.pressure > _peakPressure) {
+            _peakPressure = state.pressure;
+        }
+    } else if (_wasBrewing) {
+        EventJournalRecord record;
+        record.type = EVENT_TYPE_SHOT;
+        record.durationMs = state.brew_time_ms > 0 ? state.brew_time_ms
+                                                   : millis() - _brewStartMs;
+        record.yieldWeight = state.brew_weight;
+        record.peakPressure = _peakPressure;
+        append(record);
+    }
+    _wasBrewing = state.is_brewing;
+}
+
+bool EventJournal::append(EventJournalRecord& record) {
+    record.seq = _nextSeq;
+    time_t now = time(nullptr);
+    record.timestamp = (now > 1000000) ? (uint32_t)now : 0;
+
+    File file = userFS().open(EVENT_JOURNAL_FILE, "r+");
+    if (!file) {
+        return false;
+    }
+    file.seek(slotOffset(record.seq));
+    bool ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    file.close();
+
+    if (ok) {
+        _nextSeq++;
+    }
+    return ok;
+}
+
+uint32_t EventJournal::oldestSeq() {
+    uint32_t latest = latestSeq();
+    if (latest == 0) {
+        return 0;
+    }
+    return latest >= EVENT_JOURNAL_CAPACITY ? latest - EVENT_JOURNAL_CAPACITY + 1 : 1;
+}
+
+size_t EventJournal::readSince(uint32_t afterSeq, EventJournalRecord* out, size_t maxRecords) {
+    if (!_ready) {
+        return 0;
+    }
+    uint32_t latest = latestSeq();
+    uint32_t oldest = oldestSeq();
+    if (latest == 0 || afterSeq >= latest) {
+        return 0;
+    }
+
+    uint32_t first = afterSeq + 1;
+    if (first < oldest) {
+        first = oldest;  // Requested history already overwritten
+    }
+
+    File file = userFS().open(EVENT_JOURNAL_FILE, "r");
+    if (!file) {
+        return 0;
+    }
+
+    size_t read = 0;
+    for (uint32_t seq = first; seq <= latest && read < maxRecords; seq++) {
+        file.seek(slotOffset(seq));
+        if (file.read((uint8_t*)&out[read], sizeof(EventJournalRecord)) !=
+            sizeof(EventJournalRecord)) {
+            break;
+        }
+        if (out[read].seq != seq) {
+            continue;  // Slot overwritten mid-read by a newer append
+        }
+        read++;
+    }
+    file.close();
+    return read;
+}
+
+void EventJournal::toJson(const EventJournalRecord& record, JsonObject& obj) {
+    obj["seq"] = record.seq;
+    obj["ts"] = record.timestamp;
+    if (record.type == EVENT_TYPE_STATE) {
+        obj["event"] = "state";
+        obj["from"] = statusStateString(record.stateFrom);
+        obj["to"] = statusStateString(record.stateTo);
+    } else if (record.type == EVENT_TYPE_SHOT) {
+        obj["event"] = "shot";
+        obj["durationMs"] = record.durationMs;
+        obj["yieldWeight"] = record.yieldWeight;
+        obj["peakPressure"] = record.peakPressure;
+    } else {
+        obj["event"] = "unknown";
+    }
+}
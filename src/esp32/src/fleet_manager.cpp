@@ -0,0 +1,271 @@
+/**
+ * BrewOS Fleet Aggregation Implementation
+ *
+ * See fleet_manager.h. One Core 0 task owns discovery and peer polling;
+ * the /api/fleet handler only reads the cached frames under the peer lock,
+ * so serving the aggregated response never blocks on the network.
+ */
+
+#include "fleet_manager.h"
+#include "state/state_manager.h"
+#include "task_governor.h"
+#include "psram_pool.h"
+#include "config.h"
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <HTTPClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#define FLEET_TASK_STACK_SIZE  6144   // HTTPClient needs headroom
+#define FLEET_TASK_PRIORITY    1      // Below the cloud/MQTT tasks
+
+struct FleetPeer {
+    uint32_t ip;          // Network byte order, as IPAddress stores it
+    uint16_t port;
+    char host[33];        // mDNS instance name
+    uint32_t lastSeen;    // Last mDNS answer
+    uint32_t lastFetch;   // Last successful status fetch (0 = never)
+    char* status;         // Cached /api/status frame (pool block, tag "fleet")
+    bool inUse;
+};
+
+static FleetPeer s_peers[FLEET_MAX_PEERS];
+static SemaphoreHandle_t s_peerLock = nullptr;
+static TaskHandle_t s_taskHandle = nullptr;
+static bool s_enabled = false;
+static uint32_t s_lastDiscovery = 0;
+static FleetManager::Stats s_stats = {};
+
+// =============================================================================
+// Discovery
+// =============================================================================
+
+static FleetPeer* findPeer(uint32_t ip) {
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (s_peers[i].inUse && s_peers[i].ip == ip) return &s_peers[i];
+    }
+    return nullptr;
+}
+
+// Blocking mDNS query for _brewos._tcp peers; runs on the fleet task only
+static void discoverPeers() {
+    int found = MDNS.queryService("brewos", "tcp");
+    uint32_t now = millis();
+    uint32_t selfIp = (uint32_t)WiFi.localIP();
+
+    xSemaphoreTake(s_peerLock, portMAX_DELAY);
+    for (int i = 0; i < found; i++) {
+        uint32_t ip = (uint32_t)MDNS.IP(i);
+        if (ip == 0 || ip == selfIp) continue;
+
+        FleetPeer* peer = findPeer(ip);
+        if (!peer) {
+            for (int j = 0; j < FLEET_MAX_PEERS; j++) {
+                if (!s_peers[j].inUse) {
+                    peer = &s_peers[j];
+                    memset(peer, 0, sizeof(*peer));
+                    peer->inUse = true;
+                    peer->ip = ip;
+                    break;
+                }
+            }
+            if (!peer) break;  // Table full - ignore the overflow peers
+        }
+        peer->port = MDNS.port(i);
+        peer->lastSeen = now;
+        strncpy(peer->host, MDNS.hostname(i).c_str(), sizeof(peer->host) - 1);
+    }
+
+    // Evict peers that stopped answering several discovery rounds ago
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (s_peers[i].inUse && now - s_peers[i].lastSeen > FLEET_PEER_STALE_MS) {
+            if (s_peers[i].status) {
+                PsramPool::instance().release(s_peers[i].status);
+            }
+            memset(&s_peers[i], 0, sizeof(s_peers[i]));
+        }
+    }
+
+    uint32_t count = 0;
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (s_peers[i].inUse) count++;
+    }
+    s_stats.peers = count;
+    xSemaphoreGive(s_peerLock);
+
+    s_stats.discoveries++;
+}
+
+// =============================================================================
+// Peer polling (aggregator only)
+// =============================================================================
+
+// Fetch one peer's /api/status into its cached frame. The peer entry itself
+// is stable (only discoverPeers() on this same task evicts), so the HTTP
+// round trip runs without the lock; only the buffer swap takes it.
+static void fetchPeer(FleetPeer* peer) {
+    char url[48];
+    IPAddress ip(peer->ip);
+    snprintf(url, sizeof(url), "http://%s:%u/api/status",
+             ip.toString().c_str(), peer->port ? peer->port : 80);
+
+    HTTPClient http;
+    http.setConnectTimeout(1000);
+    http.setTimeout(2000);
+    http.begin(url);
+
+    int code = http.GET();
+    if (code != 200) {
+        http.end();
+        s_stats.fetchFailures++;
+        return;
+    }
+
+    String body = http.getString();
+    http.end();
+
+    if (body.length() == 0 || body.length() >= FLEET_STATUS_BUF_SIZE) {
+        s_stats.fetchFailures++;
+        return;
+    }
+
+    xSemaphoreTake(s_peerLock, portMAX_DELAY);
+    if (peer->inUse) {  // Guard against eviction racing a slow fetch
+        if (!peer->status) {
+            peer->status = (char*)PsramPool::instance().allocate(FLEET_STATUS_BUF_SIZE, "fleet");
+        }
+        if (peer->status) {
+            memcpy(peer->status, body.c_str(), body.length() + 1);
+            peer->lastFetch = millis();
+            s_stats.fetches++;
+        }
+    }
+    xSemaphoreGive(s_peerLock);
+}
+
+// Pick the peer whose cached frame is oldest and past the refresh target
+static FleetPeer* stalestPeer() {
+    FleetPeer* pick = nullptr;
+    uint32_t now = millis();
+    xSemaphoreTake(s_peerLock, portMAX_DELAY);
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (!s_peers[i].inUse) continue;
+        uint32_t age = now - s_peers[i].lastFetch;
+        if (s_peers[i].lastFetch != 0 && age < FLEET_REFRESH_MS) continue;
+        if (!pick || s_peers[i].lastFetch < pick->lastFetch) {
+            pick = &s_peers[i];
+        }
+    }
+    xSemaphoreGive(s_peerLock);
+    return pick;
+}
+
+static void fleetTaskCode(void* param) {
+    // Give WiFi and mDNS registration time to settle before the first query
+    vTaskDelay(pdMS_TO_TICKS(10000));
+
+    while (true) {
+        if (WiFi.isConnected()) {
+            uint32_t now = millis();
+            if (now - s_lastDiscovery > FLEET_DISCOVERY_INTERVAL_MS || s_lastDiscovery == 0) {
+                s_lastDiscovery = now;
+                discoverPeers();
+            }
+
+            // One fetch per pass keeps the radio load smooth; a 15-peer
+            // fleet still refreshes completely inside the staleness target
+            if (FleetManager::isAggregator()) {
+                FleetPeer* peer = stalestPeer();
+                if (peer) {
+                    fetchPeer(peer);
+                }
+            }
+        }
+        vTaskDelay(pdMS_TO_TICKS(300));
+    }
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+void FleetManager::begin() {
+    if (!State.settings().network.fleetEnabled || s_taskHandle != nullptr) {
+        return;
+    }
+
+    // Lock exists before enabled() can return true - the web handlers
+    // check enabled() and then take the lock unconditionally
+    s_peerLock = xSemaphoreCreateMutex();
+    memset(s_peers, 0, sizeof(s_peers));
+    s_enabled = true;
+
+    xTaskCreatePinnedToCore(
+        fleetTaskCode,
+        "FleetTask",
+        FLEET_TASK_STACK_SIZE,
+        nullptr,
+        FLEET_TASK_PRIORITY,
+        &s_taskHandle,
+        0  // Core 0 with the other network tasks
+    );
+    // Demoted while a shot is in progress
+    TaskGovernor::manage(s_taskHandle, GOV_BACKGROUND);
+    LOG_I("Fleet task started on Core 0");
+}
+
+bool FleetManager::enabled() {
+    return s_enabled;
+}
+
+bool FleetManager::isAggregator() {
+    // Lowest IP wins. Every machine runs the same comparison over the same
+    // mDNS answer set, so they converge without talking to each other.
+    return (uint32_t)WiFi.localIP() <= (uint32_t)aggregatorIP();
+}
+
+IPAddress FleetManager::aggregatorIP() {
+    uint32_t best = (uint32_t)WiFi.localIP();
+    xSemaphoreTake(s_peerLock, portMAX_DELAY);
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (s_peers[i].inUse && s_peers[i].ip < best) {
+            best = s_peers[i].ip;
+        }
+    }
+    xSemaphoreGive(s_peerLock);
+    return IPAddress(best);
+}
+
+void FleetManager::appendPeersJson(String& out) {
+    uint32_t now = millis();
+    out += '[';
+    bool first = true;
+    xSemaphoreTake(s_peerLock, portMAX_DELAY);
+    for (int i = 0; i < FLEET_MAX_PEERS; i++) {
+        if (!s_peers[i].inUse) continue;
+        if (!first) out += ',';
+        first = false;
+
+        out += "{\"host\":\"";
+        out += s_peers[i].host;
+        out += "\",\"ip\":\"";
+        out += IPAddress(s_peers[i].ip).toString();
+        out += "\",\"ageMs\":";
+        out += s_peers[i].lastFetch ? (now - s_peers[i].lastFetch) : 0;
+        out += ",\"status\":";
+        out += s_peers[i].status ? s_peers[i].status : "null";
+        out += '}';
+    }
+    xSemaphoreGive(s_peerLock);
+    out += ']';
+}
+
+size_t FleetManager::peersJsonEstimate() {
+    return (size_t)s_stats.peers * (FLEET_STATUS_BUF_SIZE / 2 + 96) + 16;
+}
+
+FleetManager::Stats FleetManager::getStats() {
+    return s_stats;
+}
@@ -0,0 +1,153 @@
+#include "flight_recorder.h"
+#include "memory_utils.h"
+#include <esp_attr.h>   // For RTC_NOINIT_ATTR
+#include <esp_system.h>
+
+// RTC-RAM ring - survives resets like RTCLogBuffer in log_manager.cpp
+struct FlightRecorderBuffer {
+    uint32_t magic;       // Verified on boot before trusting the contents
+    uint16_t head;        // Next write slot
+    uint16_t count;       // Valid events (saturates at FLIGHT_RECORDER_EVENTS)
+    uint32_t bootCount;   // Bumped every begin() - groups events per boot
+    FlightEvent events[FLIGHT_RECORDER_EVENTS];
+};
+
+RTC_NOINIT_ATTR static FlightRecorderBuffer rtcFlight;
+static const uint32_t FLIGHT_MAGIC = 0x464C5452;  // "FLTR"
+
+// Pre-crash snapshot, copied out of the RTC ring at begin() after a
+// crash-type reset (PSRAM - only allocated when there was a crash)
+static FlightEvent* s_crashTrail = nullptr;
+static size_t s_crashTrailCount = 0;
+static uint8_t s_crashResetReason = 0;
+
+static const char* eventTypeName(uint8_t type) {
+    switch (type) {
+        case FLIGHT_EVENT_BOOT:           return "boot";
+        case FLIGHT_EVENT_STATE_CHANGE:   return "state";
+        case FLIGHT_EVENT_PROTOCOL_ERROR: return "proto_err";
+        case FLIGHT_EVENT_HEAP_WATERMARK: return "heap_low";
+        case FLIGHT_EVENT_SHUTDOWN:       return "shutdown";
+        default:                          return "?";
+    }
+}
+
+void FlightRecorder::begin() {
+    esp_reset_reason_t reason = esp_reset_reason();
+
+    if (rtcFlight.magic == FLIGHT_MAGIC) {
+        bool crashed = (reason == ESP_RST_PANIC ||
+                        reason == ESP_RST_INT_WDT ||
+                        reason == ESP_RST_TASK_WDT ||
+                        reason == ESP_RST_WDT ||
+                        reason == ESP_RST_BROWNOUT);
+        if (crashed && rtcFlight.count > 0) {
+            // Copy the pre-crash trail out of the ring before new events
+            // start overwriting it
+            size_t count = rtcFlight.count;
+            if (count > FLIGHT_RECORDER_EVENTS) count = FLIGHT_RECORDER_EVENTS;
+
+            s_crashTrail = (FlightEvent*)psram_malloc(sizeof(FlightEvent) * count);
+            if (s_crashTrail) {
+                for (size_t i = 0; i < count; i++) {
+                    size_t idx = (rtcFlight.head - count + i + FLIGHT_RECORDER_EVENTS)
+                                 % FLIGHT_RECORDER_EVENTS;
+                    s_crashTrail[i] = rtcFlight.events[idx];
+                }
+                s_crashTrailCount = count;
+                s_crashResetReason = (uint8_t)reason;
+                Serial.printf("[Flight] Crash trail captured: %zu events (reset reason %d)\n",
+                              count, (int)reason);
+            }
+        }
+        rtcFlight.bootCount++;
+    } else {
+        // Cold boot or corrupt ring - start fresh
+        memset(&rtcFlight, 0, sizeof(rtcFlight));
+        rtcFlight.magic = FLIGHT_MAGIC;
+        rtcFlight.bootCount = 1;
+    }
+
+    record(FLIGHT_EVENT_BOOT, (uint8_t)reason, 0, rtcFlight.bootCount);
+}
+
+void FlightRecorder::record(uint8_t type, uint8_t a, uint8_t b, uint32_t value) {
+    if (rtcFlight.magic != FLIGHT_MAGIC) return;  // begin() not run yet
+
+    // A handful of stores, no locking. A racing writer can at worst clobber
+    // one slot - acceptable for a post-mortem aid, and the reason this is
+    // safe to call from hot paths.
+    FlightEvent& ev = rtcFlight.events[rtcFlight.head % FLIGHT_RECORDER_EVENTS];
+    ev.ms = millis();
+    ev.type = type;
+    ev.a = a;
+    ev.b = b;
+    ev.bootLow = (uint8_t)rtcFlight.bootCount;
+    ev.value = value;
+
+    rtcFlight.head = (rtcFlight.head + 1) % FLIGHT_RECORDER_EVENTS;
+    if (rtcFlight.count < FLIGHT_RECORDER_EVENTS) {
+        rtcFlight.count++;
+    }
+}
+
+void FlightRecorder::recordStateChange(uint8_t oldState, uint8_t newState) {
+    record(FLIGHT_EVENT_STATE_CHANGE, oldState, newState, 0);
+}
+
+void FlightRecorder::recordProtocolError(uint8_t kind, uint32_t detail) {
+    record(FLIGHT_EVENT_PROTOCOL_ERROR, kind, 0, detail);
+}
+
+void FlightRecorder::recordHeapWatermark(uint32_t freeHeap) {
+    // Only record new lows (1KB hysteresis) so periodic memory logging
+    // doesn't flood the ring
+    static uint32_t s_lowWater = UINT32_MAX;
+    if (freeHeap + 1024 >= s_lowWater) {
+        return;
+    }
+    s_lowWater = freeHeap;
+    record(FLIGHT_EVENT_HEAP_WATERMARK, 0, 0, freeHeap);
+}
+
+void FlightRecorder::recordShutdown(uint8_t resetReason, uint32_t freeHeap) {
+    record(FLIGHT_EVENT_SHUTDOWN, resetReason, 0, freeHeap);
+}
+
+void FlightRecorder::eventToJson(JsonArray& arr, const FlightEvent& ev) {
+    JsonObject obj = arr.add<JsonObject>();
+    obj["ms"] = ev.ms;
+    obj["type"] = eventTypeName(ev.type);
+    obj["a"] = ev.a;
+    obj["b"] = ev.b;
+    obj["boot"] = ev.bootLow;
+    obj["value"] = ev.value;
+}
+
+void FlightRecorder::dumpToJson(JsonObject& obj) {
+    obj["boot_count"] = rtcFlight.bootCount;
+    obj["events_stored"] = rtcFlight.count;
+
+    JsonArray arr = obj["events"].to<JsonArray>();
+    for (size_t i = 0; i < rtcFlight.count; i++) {
+        size_t idx = (rtcFlight.head - rtcFlight.count + i + FLIGHT_RECORDER_EVENTS)
+                     % FLIGHT_RECORDER_EVENTS;
+        eventToJson(arr, rtcFlight.events[idx]);
+    }
+}
+
+bool FlightRecorder::hasCrashTrail() {
+    return s_crashTrail != nullptr && s_crashTrailCount > 0;
+}
+
+void FlightRecorder::crashTrailToJson(JsonObject& obj) {
+    if (!hasCrashTrail()) return;
+
+    obj["reset_reason"] = s_crashResetReason;
+    obj["events_stored"] = s_crashTrailCount;
+
+    JsonArray arr = obj["events"].to<JsonArray>();
+    for (size_t i = 0; i < s_crashTrailCount; i++) {
+        eventToJson(arr, s_crashTrail[i]);
+    }
+}
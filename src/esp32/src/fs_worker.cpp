@@ -0,0 +1,110 @@
+#include "fs_worker.h"
+#include "config.h"
+
+TaskHandle_t FsWorker::_task = nullptr;
+QueueHandle_t FsWorker::_queue[2] = {nullptr, nullptr};
+SemaphoreHandle_t FsWorker::_pending = nullptr;
+
+bool FsWorker::begin() {
+    if (_task) {
+        return true;  // Already started
+    }
+
+    _queue[PRIO_FOREGROUND] = xQueueCreate(FS_WORKER_QUEUE_DEPTH, sizeof(Job*));
+    _queue[PRIO_BACKGROUND] = xQueueCreate(FS_WORKER_QUEUE_DEPTH, sizeof(Job*));
+    _pending = xSemaphoreCreateCounting(2 * FS_WORKER_QUEUE_DEPTH, 0);
+
+    bool taskStarted = false;
+    if (_queue[PRIO_FOREGROUND] && _queue[PRIO_BACKGROUND] && _pending) {
+        taskStarted = (xTaskCreatePinnedToCore(workerTask, "FsWorker",
+                                               FS_WORKER_STACK, nullptr,
+                                               FS_WORKER_PRIORITY,
+                                               &_task, FS_WORKER_CORE) == pdPASS);
+    }
+
+    if (!taskStarted) {
+        // Tear down and fall back to inline execution (post/runSync degrade)
+        LOG_E("FsWorker: failed to start - FS access stays synchronous");
+        if (_queue[PRIO_FOREGROUND]) { vQueueDelete(_queue[PRIO_FOREGROUND]); _queue[PRIO_FOREGROUND] = nullptr; }
+        if (_queue[PRIO_BACKGROUND]) { vQueueDelete(_queue[PRIO_BACKGROUND]); _queue[PRIO_BACKGROUND] = nullptr; }
+        if (_pending) { vSemaphoreDelete(_pending); _pending = nullptr; }
+        _task = nullptr;
+        return false;
+    }
+
+    LOG_I("FsWorker: started on Core %d (priority %d)", FS_WORKER_CORE, FS_WORKER_PRIORITY);
+    return true;
+}
+
+bool FsWorker::post(Priority prio, Job job) {
+    if (!_task || xTaskGetCurrentTaskHandle() == _task) {
+        // Not started yet (early boot) or already on the worker: run inline
+        job();
+        return true;
+    }
+
+    Job* j = new (std::nothrow) Job(std::move(job));
+    if (!j) {
+        return false;
+    }
+
+    // Foreground posters are about to block on the result anyway, so a
+    // short wait for a queue slot is fine; background posters must not
+    // stall - full queue is reported and the caller retries later.
+    TickType_t wait = (prio == PRIO_FOREGROUND) ? pdMS_TO_TICKS(1000) : 0;
+    if (xQueueSend(_queue[prio], &j, wait) != pdTRUE) {
+        delete j;
+        return false;
+    }
+    xSemaphoreGive(_pending);
+    return true;
+}
+
+bool FsWorker::runSync(Priority prio, Job job) {
+    if (!_task || xTaskGetCurrentTaskHandle() == _task) {
+        job();
+        return true;
+    }
+
+    // The wait is unbounded by design: the worker never exits, and a
+    // bounded wait would make by-reference captures unsafe (an abandoned
+    // job writing into a dead stack frame).
+    SemaphoreHandle_t done = xSemaphoreCreateBinary();
+    if (!done) {
+        job();  // Degrade to inline rather than failing the operation
+        return true;
+    }
+
+    bool posted = post(prio, [&job, done]() {
+        job();
+        xSemaphoreGive(done);
+    });
+
+    if (posted) {
+        xSemaphoreTake(done, portMAX_DELAY);
+    }
+    vSemaphoreDelete(done);
+
+    if (!posted) {
+        job();  // Queue full - inline fallback keeps the call synchronous
+    }
+    return true;
+}
+
+void FsWorker::workerTask(void* param) {
+    (void)param;
+    for (;;) {
+        xSemaphoreTake(_pending, portMAX_DELAY);
+
+        // Foreground queue is always drained first - a blocked display or
+        // web handler read jumps ahead of any queued persistence work
+        Job* job = nullptr;
+        if (xQueueReceive(_queue[PRIO_FOREGROUND], &job, 0) != pdTRUE &&
+            xQueueReceive(_queue[PRIO_BACKGROUND], &job, 0) != pdTRUE) {
+            continue;  // Shouldn't happen (give/receive are paired)
+        }
+
+        (*job)();
+        delete job;
+    }
+}
@@ -0,0 +1,181 @@
+#include "heap_telemetry.h"
+
+#if HEAP_TELEMETRY
+
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <string.h>
+
+// =============================================================================
+// Fixed Tables
+// =============================================================================
+// Sized for the firmware's own allocation paths: ~30 distinct call sites
+// exist today, and the live-pointer table covers the worst concurrent count
+// observed (cloud queue full + broadcast burst) with headroom. Overflow is
+// counted, not fatal.
+
+#define HEAP_TELEMETRY_MAX_SITES 48
+#define HEAP_TELEMETRY_MAX_LIVE  192
+
+struct Site {
+    const char* file;    // nullptr = free slot
+    uint16_t line;
+    size_t liveBytes;
+    size_t peakBytes;
+    uint32_t allocs;
+};
+
+struct LiveBlock {
+    void* ptr;           // nullptr = free slot
+    size_t size;
+    int16_t siteIdx;
+};
+
+static Site s_sites[HEAP_TELEMETRY_MAX_SITES];
+static LiveBlock s_live[HEAP_TELEMETRY_MAX_LIVE];
+static uint32_t s_untracked = 0;
+static SemaphoreHandle_t s_mutex = nullptr;
+
+// Lazy mutex creation - first calls happen during single-threaded setup(),
+// before any second task can race the check
+static SemaphoreHandle_t telemetryMutex() {
+    if (s_mutex == nullptr) {
+        s_mutex = xSemaphoreCreateMutex();
+    }
+    return s_mutex;
+}
+
+// Register or look up a (file, line) site - call with mutex held.
+// __FILE__ literals are deduplicated per translation unit, so pointer
+// comparison catches the common case before the strcmp.
+static int16_t siteIndexFor(const char* file, uint16_t line) {
+    for (int16_t i = 0; i < HEAP_TELEMETRY_MAX_SITES; i++) {
+        if (s_sites[i].file == nullptr) {
+            s_sites[i].file = file;
+            s_sites[i].line = line;
+            return i;
+        }
+        if (s_sites[i].line == line &&
+            (s_sites[i].file == file || strcmp(s_sites[i].file, file) == 0)) {
+            return i;
+        }
+    }
+    return -1;  // Site table full
+}
+
+// =============================================================================
+// Recording Allocator
+// =============================================================================
+
+void* heap_telemetry_malloc(size_t size, uint32_t caps, const char* file, int line) {
+    void* ptr = heap_caps_malloc(size, caps);
+    if (ptr == nullptr && (caps & MALLOC_CAP_SPIRAM)) {
+        ptr = malloc(size);  // psram_malloc's internal-RAM fallback
+    }
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+    SemaphoreHandle_t mutex = telemetryMutex();
+    if (mutex != nullptr && xSemaphoreTake(mutex, portMAX_DELAY) == pdTRUE) {
+        bool recorded = false;
+        int16_t si = siteIndexFor(file, (uint16_t)line);
+        if (si >= 0) {
+            for (size_t i = 0; i < HEAP_TELEMETRY_MAX_LIVE; i++) {
+                if (s_live[i].ptr == nullptr) {
+                    s_live[i].ptr = ptr;
+                    s_live[i].size = size;
+                    s_live[i].siteIdx = si;
+                    s_sites[si].liveBytes += size;
+                    if (s_sites[si].liveBytes > s_sites[si].peakBytes) {
+                        s_sites[si].peakBytes = s_sites[si].liveBytes;
+                    }
+                    s_sites[si].allocs++;
+                    recorded = true;
+                    break;
+                }
+            }
+        }
+        if (!recorded) {
+            s_untracked++;
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    return ptr;
+}
+
+void heap_telemetry_free(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    SemaphoreHandle_t mutex = telemetryMutex();
+    if (mutex != nullptr && xSemaphoreTake(mutex, portMAX_DELAY) == pdTRUE) {
+        for (size_t i = 0; i < HEAP_TELEMETRY_MAX_LIVE; i++) {
+            if (s_live[i].ptr == ptr) {
+                Site& site = s_sites[s_live[i].siteIdx];
+                if (site.liveBytes >= s_live[i].size) {
+                    site.liveBytes -= s_live[i].size;
+                }
+                s_live[i].ptr = nullptr;
+                break;
+            }
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    // Works for pool, PSRAM and internal allocations alike
+    heap_caps_free(ptr);
+}
+
+// =============================================================================
+// Reporting
+// =============================================================================
+
+size_t heap_telemetry_top_sites(HeapSiteStats* out, size_t maxSites) {
+    if (out == nullptr || maxSites == 0) {
+        return 0;
+    }
+
+    // Snapshot under the mutex, sort outside it
+    Site snapshot[HEAP_TELEMETRY_MAX_SITES];
+    size_t count = 0;
+    SemaphoreHandle_t mutex = telemetryMutex();
+    if (mutex != nullptr && xSemaphoreTake(mutex, portMAX_DELAY) == pdTRUE) {
+        for (size_t i = 0; i < HEAP_TELEMETRY_MAX_SITES && s_sites[i].file; i++) {
+            snapshot[count++] = s_sites[i];
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    // Insertion sort by live bytes descending - count is small
+    for (size_t i = 1; i < count; i++) {
+        Site key = snapshot[i];
+        size_t j = i;
+        while (j > 0 && snapshot[j - 1].liveBytes < key.liveBytes) {
+            snapshot[j] = snapshot[j - 1];
+            j--;
+        }
+        snapshot[j] = key;
+    }
+
+    if (count > maxSites) {
+        count = maxSites;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i].file = snapshot[i].file;
+        out[i].line = snapshot[i].line;
+        out[i].liveBytes = snapshot[i].liveBytes;
+        out[i].peakBytes = snapshot[i].peakBytes;
+        out[i].allocs = snapshot[i].allocs;
+    }
+    return count;
+}
+
+uint32_t heap_telemetry_untracked() {
+    return s_untracked;
+}
+
+#endif // HEAP_TELEMETRY
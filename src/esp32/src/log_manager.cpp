@@ -1,14 +1,18 @@
 #include "log_manager.h"
 #include "config.h"  // For BrewOSLogLevel enum definition
 #include "protocol_defs.h"
+#include "log_catalog.h"  // Shared compact log catalog (MSG_LOG_COMPACT)
 #include "state/state_manager.h"  // For State macro to check debug logs setting
 #include "web_server.h"  // For BrewWebServer
 #include <esp_heap_caps.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/stream_buffer.h>
 #include <stdarg.h>
-#include <LittleFS.h>
+#include "user_fs.h"
 #include <esp_attr.h>  // For RTC_NOINIT_ATTR
+#include "fs_worker.h"
+#include "utils/token_bucket.h"
 
 // Forward declaration for web server (defined in main.cpp)
 // Helper function to broadcast log via WebSocket (defined in web_server_broadcast.cpp)
@@ -20,6 +24,41 @@ extern BrewWebServer* webServer;  // Global webServer pointer from main.cpp
 RTC_NOINIT_ATTR RTCLogBuffer rtcLogs;
 const uint32_t RTC_MAGIC = 0xDEADBEEF;
 
+// Binary log record framing. Each ring entry is this fixed header followed
+// by the raw message bytes (no NUL, no rendered prefix). The
+// "[timestamp] [SOURCE] LEVEL: " text is rendered only when a client
+// fetches logs, so a log call in a hot path is a header write plus one
+// memcpy - and the ~20-byte text prefix per entry shrinks to 8 bytes,
+// which raises retention in the same buffer/flash budget.
+struct LogRecordHeader {
+    uint8_t magic;       // LOG_RECORD_MAGIC - used to resync after corruption
+    uint8_t level;       // BrewOSLogLevel
+    uint8_t source;      // LogSource
+    uint8_t msgLen;      // Message bytes following the header
+    uint32_t timestamp;  // millis() at log time
+};
+static const uint8_t LOG_RECORD_MAGIC = 0xA5;
+
+// Producer-side transport. Log calls serialize one record into the stream
+// buffer for their source; the merge drain (pumpStreams, under _mutex)
+// moves records into the ring. Producers never touch the ring or its
+// mutex, so a log call can't stall behind a flash save holding the lock -
+// that was showing up as rare 20ms+ Core 1 loop stalls.
+//
+// Stream buffers are single-reader/single-writer. The reader side is
+// serialized by _mutex. On the writer side the Pico stream has exactly one
+// producer (the UART dispatch on the loop task); the ESP32 stream is fed
+// from many tasks, so sends are wrapped in a spinlock critical section -
+// bounded to one record memcpy, a few microseconds. That wrapper is only
+// safe because the drain polls with zero timeout: a reader ever blocking
+// on the stream would make the send path notify (and maybe yield) inside
+// the critical section.
+#define LOG_STREAM_SIZE_ESP32 (4 * 1024)
+#define LOG_STREAM_SIZE_PICO (2 * 1024)
+
+static StaticStreamBuffer_t s_streamCtl[2];
+static portMUX_TYPE s_logProducerMux = portMUX_INITIALIZER_UNLOCKED;
+
 // Global instance pointer
 LogManager* g_logManager = nullptr;
 
@@ -35,12 +74,15 @@ LogManager::LogManager()
     , _head(0)
     , _tail(0)
     , _size(0)
-    , _wrapped(false)
     , _mutex(nullptr)  // Don't create mutex here - created lazily in enable()
+    , _streams{nullptr, nullptr}
+    , _streamStorage{nullptr, nullptr}
+    , _streamDrops{0, 0}
     , _picoLogForwarding(false)
     , _enabled(false)
     , _lastSaveTime(0)
     , _lastSavedHead(0)
+    , _savePending(false)
 {
     // Set global pointer
     // Note: Mutex is created in enable() to avoid static initialization order issues
@@ -84,7 +126,32 @@ bool LogManager::enable() {
         Serial.println("[LogManager] ERROR: Failed to allocate 50KB log buffer");
         return false;
     }
-    
+
+    // Producer-side stream buffers (one per source). Storage goes to PSRAM
+    // like the ring; the small control blocks are static internal RAM.
+    static const size_t streamSizes[2] = { LOG_STREAM_SIZE_ESP32, LOG_STREAM_SIZE_PICO };
+    for (int i = 0; i < 2; i++) {
+        if (_streams[i]) continue;  // Survived a previous disable/enable cycle
+        _streamStorage[i] = (uint8_t*)heap_caps_malloc(streamSizes[i] + 1,
+                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!_streamStorage[i]) {
+            _streamStorage[i] = (uint8_t*)malloc(streamSizes[i] + 1);
+        }
+        if (_streamStorage[i]) {
+            _streams[i] = xStreamBufferCreateStatic(streamSizes[i], 1,
+                                                    _streamStorage[i], &s_streamCtl[i]);
+        }
+        if (!_streams[i]) {
+            Serial.println("[LogManager] ERROR: Failed to create log stream buffer");
+            free(_streamStorage[i]);
+            _streamStorage[i] = nullptr;
+            free(_buffer);
+            _buffer = nullptr;
+            return false;
+        }
+        _streamDrops[i] = 0;
+    }
+
     // 1. Restore previous session logs from flash FIRST
     // This sets up the head/tail/buffer state from the last normal shutdown
     // CRITICAL: Must restore flash first, otherwise restoreFromFlash() will wipe out
@@ -97,7 +164,6 @@ bool LogManager::enable() {
         _head = 0;
         _tail = 0;
         _size = 0;
-        _wrapped = false;
     }
     
     // 2. NOW recover Crash Logs from RTC Memory (append them to the end)
@@ -151,17 +217,34 @@ void LogManager::disable() {
     }
     
     _enabled = false;
-    
+
+    // Take the mutex before freeing - a delta-save job on the FS worker
+    // may be mid-write from this buffer
+    bool hasMutex = (_mutex && xSemaphoreTake(_mutex, pdMS_TO_TICKS(500)) == pdTRUE);
+
     if (_buffer) {
         free(_buffer);
         _buffer = nullptr;
     }
-    
+
     _head = 0;
     _tail = 0;
     _size = 0;
-    _wrapped = false;
-    
+
+    // The streams themselves stay allocated (~6KB PSRAM) - deleting them
+    // here would race a producer mid-send on the other core. Just discard
+    // anything buffered so a later enable() starts clean.
+    for (int i = 0; i < 2; i++) {
+        if (_streams[i]) {
+            xStreamBufferReset(_streams[i]);
+        }
+        _streamDrops[i] = 0;
+    }
+
+    if (hasMutex) {
+        xSemaphoreGive(_mutex);
+    }
+
     // Also disable Pico log forwarding when buffer is disabled
     _picoLogForwarding = false;
     
@@ -187,88 +270,215 @@ const char* LogManager::sourceToString(LogSource source) {
 }
 
 void LogManager::writeToBuffer(const char* data, size_t len) {
+    // Raw ring copy at _head with wrap - freeSpace() must have made room
     if (!_buffer || len == 0) return;
-    
-    for (size_t i = 0; i < len; i++) {
-        // Check if we're about to overwrite tail (buffer full)
-        if (_wrapped && _head == _tail) {
-            // Find next newline to maintain log entry integrity
-            while (_buffer[_tail] != '\n' && _tail != _head) {
-                _tail = (_tail + 1) % LOG_BUFFER_SIZE;
-            }
-            // Skip the newline
-            if (_buffer[_tail] == '\n') {
-                _tail = (_tail + 1) % LOG_BUFFER_SIZE;
+
+    size_t firstChunk = LOG_BUFFER_SIZE - _head;
+    if (firstChunk > len) firstChunk = len;
+    memcpy(_buffer + _head, data, firstChunk);
+    if (len > firstChunk) {
+        memcpy(_buffer, data + firstChunk, len - firstChunk);
+    }
+    _head = (_head + len) % LOG_BUFFER_SIZE;
+}
+
+void LogManager::ringRead(size_t pos, void* out, size_t len) const {
+    size_t firstChunk = LOG_BUFFER_SIZE - pos;
+    if (firstChunk > len) firstChunk = len;
+    memcpy(out, _buffer + pos, firstChunk);
+    if (len > firstChunk) {
+        memcpy((uint8_t*)out + firstChunk, _buffer, len - firstChunk);
+    }
+}
+
+void LogManager::freeSpace(size_t needed) {
+    if (needed > LOG_BUFFER_SIZE) return;  // Caller caps record sizes
+
+    // Drop whole records from the tail until the new one fits
+    while (LOG_BUFFER_SIZE - _size < needed && _size >= sizeof(LogRecordHeader)) {
+        LogRecordHeader header;
+        ringRead(_tail, &header, sizeof(header));
+        size_t total = sizeof(header) + header.msgLen;
+        if (header.magic != LOG_RECORD_MAGIC || total > _size) {
+            // Corrupt tail - drop everything rather than walk garbage
+            _head = 0;
+            _tail = 0;
+            _size = 0;
+            return;
+        }
+        _tail = (_tail + total) % LOG_BUFFER_SIZE;
+        _size -= total;
+    }
+}
+
+void LogManager::writeRecord(BrewOSLogLevel level, LogSource source, const char* message) {
+    if (!_buffer || !message) return;
+
+    size_t msgLen = strlen(message);
+    if (msgLen > 255) msgLen = 255;  // Header stores the length in one byte
+
+    LogRecordHeader header;
+    header.magic = LOG_RECORD_MAGIC;
+    header.level = (uint8_t)level;
+    header.source = (uint8_t)source;
+    header.msgLen = (uint8_t)msgLen;
+    header.timestamp = millis();
+
+    size_t total = sizeof(header) + msgLen;
+    freeSpace(total);
+    writeToBuffer((const char*)&header, sizeof(header));
+    writeToBuffer(message, msgLen);
+    _size += total;
+}
+
+void LogManager::pumpStreams() {
+    // Merge drain: move whole records from the producer streams into the
+    // ring. The caller holds _mutex, which makes this the stream buffers'
+    // single reader. Always with zero timeout - see the transport comment
+    // at the top of this file.
+    if (!_buffer) return;
+
+    uint8_t record[sizeof(LogRecordHeader) + 255];
+    for (int i = 0; i < 2; i++) {
+        StreamBufferHandle_t stream = _streams[i];
+        if (!stream) continue;
+
+        while (xStreamBufferReceive(stream, record, sizeof(LogRecordHeader), 0)
+                   == sizeof(LogRecordHeader)) {
+            LogRecordHeader* header = (LogRecordHeader*)record;
+            size_t msgLen = header->msgLen;
+            if (msgLen > 0 &&
+                xStreamBufferReceive(stream, record + sizeof(LogRecordHeader),
+                                     msgLen, 0) != msgLen) {
+                break;  // Torn record - can't happen with whole-record sends
             }
+            size_t total = sizeof(LogRecordHeader) + msgLen;
+            freeSpace(total);
+            writeToBuffer((const char*)record, total);
+            _size += total;
         }
-        
-        _buffer[_head] = data[i];
-        _head = (_head + 1) % LOG_BUFFER_SIZE;
-        
-        // Detect wrap: if head wraps to 0, we've wrapped around
-        if (_head == 0) {
-            _wrapped = true;
+
+        taskENTER_CRITICAL(&s_logProducerMux);
+        uint32_t drops = _streamDrops[i];
+        _streamDrops[i] = 0;
+        taskEXIT_CRITICAL(&s_logProducerMux);
+        if (drops) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "%lu log entries dropped (stream full)",
+                     (unsigned long)drops);
+            writeRecord(BREWOS_LOG_WARN, (LogSource)i, msg);
         }
     }
-    
-    // Update size
-    if (_wrapped) {
-        _size = LOG_BUFFER_SIZE;
+}
+
+size_t LogManager::renderEntry(char* out, size_t outSize, uint32_t timestamp,
+                               uint8_t level, uint8_t source, const char* msg,
+                               size_t msgLen) {
+    int len = snprintf(out, outSize, "[%lu] [%s] %s: %.*s\n",
+                       (unsigned long)timestamp,
+                       sourceToString((LogSource)source),
+                       levelToString((BrewOSLogLevel)level),
+                       (int)msgLen, msg);
+    if (len < 0) return 0;
+    return (len < (int)outSize) ? (size_t)len : outSize - 1;
+}
+
+// Per-source token buckets for the buffer path. The burst covers boot
+// chatter; a wifi AP flap emitting hundreds of lines/sec does not get to
+// churn the ring and the flash delta at that rate. Serial output is not
+// throttled - full fidelity stays on the wire for bench debugging.
+static TokenBucket s_addLogBuckets[2] = {
+    { 40, 10, 40, 0, 0 },  // LOG_SOURCE_ESP32
+    { 40, 10, 40, 0, 0 },  // LOG_SOURCE_PICO
+};
+
+// Serialize one record (header + raw message bytes, no rendered prefix -
+// that happens on fetch) and hand it to the stream in ONE send, so
+// records arrive at the drain whole.
+//
+// A zero-timeout send writes PARTIAL records when the stream is nearly
+// full, which would corrupt the framing - check space first and drop
+// whole records instead. The space check and send must be atomic against
+// other writers, not against the drain (draining only grows the space),
+// hence the spinlock on the multi-producer ESP32 stream. Bounded to one
+// record memcpy; never held across flash I/O (see the transport comment
+// at the top of this file for why a blocked reader is forbidden).
+static void streamSendRecord(StreamBufferHandle_t stream, bool multiProducer,
+                             uint32_t* dropCounter, BrewOSLogLevel level,
+                             LogSource source, const char* message) {
+    uint8_t record[sizeof(LogRecordHeader) + 255];
+    size_t msgLen = strlen(message);
+    if (msgLen > 255) msgLen = 255;  // Header stores the length in one byte
+
+    LogRecordHeader* header = (LogRecordHeader*)record;
+    header->magic = LOG_RECORD_MAGIC;
+    header->level = (uint8_t)level;
+    header->source = (uint8_t)source;
+    header->msgLen = (uint8_t)msgLen;
+    header->timestamp = millis();
+    memcpy(record + sizeof(LogRecordHeader), message, msgLen);
+    size_t total = sizeof(LogRecordHeader) + msgLen;
+
+    if (multiProducer) {
+        taskENTER_CRITICAL(&s_logProducerMux);
+        if (xStreamBufferSpacesAvailable(stream) >= total) {
+            xStreamBufferSend(stream, record, total, 0);
+        } else {
+            (*dropCounter)++;
+        }
+        taskEXIT_CRITICAL(&s_logProducerMux);
     } else {
-        _size = _head;
+        if (xStreamBufferSpacesAvailable(stream) >= total) {
+            xStreamBufferSend(stream, record, total, 0);
+        } else {
+            (*dropCounter)++;
+        }
     }
 }
 
 void LogManager::addLog(BrewOSLogLevel level, LogSource source, const char* message) {
-    // No-op if disabled or mutex not created yet
-    // Added !_mutex check for defensive programming
-    if (!_enabled || !_buffer || !message || !_mutex) return;
-    
+    if (!_enabled || !message) return;
+
+    uint8_t streamIdx = (source == LOG_SOURCE_PICO) ? 1 : 0;
+    StreamBufferHandle_t stream = _streams[streamIdx];
+    if (!stream) return;
+
     // CRITICAL FIX: Check if we are in an ISR context
-    // Calling xSemaphoreTake from an ISR causes a panic/crash on ESP32/FreeRTOS
-    // We must check the context before attempting mutex operations
+    // Stream buffer sends have FromISR variants, but the critical-section
+    // wrapper below does not - keep the existing no-logging-from-ISR rule
     if (xPortInIsrContext()) {
-        // We cannot take a mutex or safely use snprintf/malloc in an ISR
-        // Skip logging from ISR context to avoid crashes
-        // Note: If ISR logging is needed, use a FreeRTOS queue to defer processing
         return;
     }
-    
-    // Take mutex (with timeout to avoid deadlock)
-    // Now safe to take since we've checked _mutex is not null
-    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
-        return; // Skip this log entry if can't get mutex
+
+    // Per-source token bucket. The ESP32 bucket is shared between tasks,
+    // so its accounting rides the same producer spinlock as the send; the
+    // Pico bucket has a single producer (UART dispatch on the loop task)
+    bool multiProducer = (streamIdx == 0);
+    uint32_t now = millis();
+    uint32_t reclaimed = 0;
+    bool allowed;
+    if (multiProducer) {
+        taskENTER_CRITICAL(&s_logProducerMux);
+        allowed = s_addLogBuckets[0].allow(now);
+        if (allowed) reclaimed = s_addLogBuckets[0].takeSuppressed();
+        taskEXIT_CRITICAL(&s_logProducerMux);
+    } else {
+        allowed = s_addLogBuckets[1].allow(now);
+        if (allowed) reclaimed = s_addLogBuckets[1].takeSuppressed();
     }
-    
-    // Format: [timestamp] [SOURCE] LEVEL: message\n
-    // Truncate message if too long to fit in entry buffer
-    char entry[LOG_ENTRY_MAX_SIZE];
-    unsigned long timestamp = millis();
-    
-    // Calculate available space for message (leave room for prefix and newline)
-    size_t prefixLen = snprintf(entry, sizeof(entry), "[%lu] [%s] %s: ", 
-                                 timestamp, sourceToString(source), levelToString(level));
-    size_t maxMsgLen = sizeof(entry) - prefixLen - 2; // -2 for \n and \0
-    
-    // Truncate message if needed
-    char truncatedMsg[LOG_ENTRY_MAX_SIZE];
-    strncpy(truncatedMsg, message, maxMsgLen);
-    truncatedMsg[maxMsgLen] = '\0';
-    
-    // Format complete entry
-    int len = snprintf(entry, sizeof(entry), "[%lu] [%s] %s: %s\n",
-                       timestamp,
-                       sourceToString(source),
-                       levelToString(level),
-                       truncatedMsg);
-    
-    // Write to buffer (snprintf will truncate if needed, but we ensure it fits)
-    if (len > 0) {
-        size_t writeLen = (len < (int)sizeof(entry)) ? len : sizeof(entry) - 1;
-        writeToBuffer(entry, writeLen);
+    if (!allowed) {
+        return;  // Storm in progress - counted, summarized when it ends
     }
-    
-    xSemaphoreGive(_mutex);
+
+    if (reclaimed) {
+        char summary[48];
+        snprintf(summary, sizeof(summary), "...%lu similar suppressed",
+                 (unsigned long)reclaimed);
+        streamSendRecord(stream, multiProducer, &_streamDrops[streamIdx],
+                         BREWOS_LOG_WARN, source, summary);
+    }
+    streamSendRecord(stream, multiProducer, &_streamDrops[streamIdx],
+                     level, source, message);
 }
 
 void LogManager::addLogf(BrewOSLogLevel level, LogSource source, const char* format, ...) {
@@ -295,23 +505,34 @@ void LogManager::addLogf(BrewOSLogLevel level, LogSource source, const char* for
 String LogManager::getLogsUnsafe() {
     // Internal helper - assumes mutex is already held by caller
     if (!_enabled || !_buffer) return String();
-    
+
     String result;
-    result.reserve(_size + 1);
-    
-    if (_wrapped) {
-        // Buffer has wrapped - read from tail to end, then from start to head
-        // Use concat with length to avoid O(N²) character-by-character concatenation
-        size_t len1 = LOG_BUFFER_SIZE - _tail;
-        result.concat(_buffer + _tail, len1);
-        
-        // Read start -> head
-        result.concat(_buffer, _head);
-    } else {
-        // Buffer hasn't wrapped - simple copy from start to head
-        result.concat(_buffer, _head);
+    // Rendered text is larger than the binary ring (prefix per record)
+    result.reserve(_size + (_size / 4) + 64);
+
+    size_t pos = _tail;
+    size_t remaining = _size;
+    char entry[LOG_ENTRY_MAX_SIZE];
+    char message[LOG_ENTRY_MAX_SIZE];
+
+    // Walk the record stream from the oldest entry, rendering each one
+    while (remaining >= sizeof(LogRecordHeader)) {
+        LogRecordHeader header;
+        ringRead(pos, &header, sizeof(header));
+        if (header.magic != LOG_RECORD_MAGIC ||
+            sizeof(header) + header.msgLen > remaining) {
+            break;  // Corrupt ring - stop rather than render garbage
+        }
+        ringRead((pos + sizeof(header)) % LOG_BUFFER_SIZE, message, header.msgLen);
+        size_t len = renderEntry(entry, sizeof(entry), header.timestamp,
+                                 header.level, header.source, message, header.msgLen);
+        result.concat(entry, len);
+
+        size_t total = sizeof(header) + header.msgLen;
+        pos = (pos + total) % LOG_BUFFER_SIZE;
+        remaining -= total;
     }
-    
+
     return result;
 }
 
@@ -322,9 +543,10 @@ String LogManager::getLogs() {
     if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5000)) != pdTRUE) {
         return String("ERROR: Could not acquire log mutex");
     }
-    
+
+    pumpStreams();  // Include anything still sitting in the producer streams
     String result = getLogsUnsafe();
-    
+
     xSemaphoreGive(_mutex);
     return result;
 }
@@ -340,13 +562,13 @@ void LogManager::clear() {
     if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
         return;
     }
-    
+
+    pumpStreams();  // Consume in-flight records so they don't reappear after the clear
     memset(_buffer, 0, LOG_BUFFER_SIZE);
     _head = 0;
     _tail = 0;
     _size = 0;
-    _wrapped = false;
-    
+
     xSemaphoreGive(_mutex);
     
     addLog(BREWOS_LOG_INFO, LOG_SOURCE_ESP32, "Logs cleared");
@@ -358,11 +580,16 @@ void LogManager::setPicoLogForwarding(bool enabled, std::function<bool(uint8_t*,
     // The buffer is only needed for storing logs in memory
     
     _picoLogForwarding = enabled;
-    
-    // Send command to Pico to enable/disable log forwarding
+
+    // Send command to Pico to enable/disable log forwarding.
+    // The second byte tells the Pico the maximum severity worth shipping so
+    // it filters at the source - debug-level spam used to ride the shared
+    // UART to be filtered here, measurably delaying status packets.
     if (sendCommand) {
-        uint8_t payload[1] = { enabled ? 1 : 0 };
-        if (sendCommand(payload, 1)) {
+        uint8_t maxLevel = State.settings().system.debugLogsEnabled
+                               ? BREWOS_LOG_DEBUG : BREWOS_LOG_INFO;
+        uint8_t payload[2] = { (uint8_t)(enabled ? 1 : 0), maxLevel };
+        if (sendCommand(payload, 2)) {
             addLogf(BREWOS_LOG_INFO, LOG_SOURCE_ESP32, 
                    "Pico log forwarding %s", enabled ? "enabled" : "disabled");
         } else {
@@ -445,6 +672,47 @@ void LogManager::handlePicoLog(const uint8_t* payload, size_t length) {
     }
 }
 
+void LogManager::handlePicoLogCompact(const uint8_t* payload, size_t length) {
+    // Payload format: [level][id_lo][id_hi][argc][int32 args LE x argc]
+    if (!payload || length < 4) return;
+
+    uint16_t id = (uint16_t)(payload[1] | (payload[2] << 8));
+    uint8_t argc = payload[3];
+    if (argc > LOG_COMPACT_MAX_ARGS || length < 4 + (size_t)argc * 4) return;
+
+    int32_t args[LOG_COMPACT_MAX_ARGS] = {0};
+    for (uint8_t i = 0; i < argc; i++) {
+        memcpy(&args[i], &payload[4 + i * 4], 4);
+    }
+
+    // Expand to [level][text] and hand over to the regular text path - the
+    // catalog guarantees formats consume only int32 args, and passing unused
+    // trailing arguments to snprintf is well-defined
+    uint8_t expanded[208];
+    expanded[0] = payload[0];
+    const char* format = log_catalog_format(id);
+    int len;
+    if (format) {
+        len = snprintf((char*)&expanded[1], sizeof(expanded) - 1, format,
+                       args[0], args[1], args[2], args[3]);
+    } else {
+        // Pico firmware newer than ours - record the id rather than dropping
+        len = snprintf((char*)&expanded[1], sizeof(expanded) - 1,
+                       "Unknown compact log id 0x%04X", id);
+    }
+    if (len < 0) return;
+    if (len > (int)sizeof(expanded) - 2) len = sizeof(expanded) - 2;
+
+    // Catalog formats end in '\n' for the Pico's local printf; the buffered
+    // log path adds its own line handling, so trim it here
+    while (len > 0 && expanded[len] == '\n') {
+        expanded[len] = '\0';
+        len--;
+    }
+
+    handlePicoLog(expanded, (size_t)len + 1);
+}
+
 // Helper function for LOG macros (takes int to avoid circular dependency)
 void log_manager_add_logf(int level, LogSource source, const char* format, ...) {
     if (!g_logManager || !g_logManager->isEnabled()) {
@@ -483,61 +751,60 @@ bool LogManager::saveToFlash() {
     // Try to use LittleFS - first try if already mounted, then try to mount
     bool fsMounted = false;
     // Try to open a file to check if already mounted
-    File testFile = LittleFS.open("/logs.txt", "r");
+    File testFile = userFS().open("/logs.bin", "r");
     if (testFile) {
         testFile.close();
         fsMounted = true;
     } else {
         // Try to mount (don't format in panic context)
-        fsMounted = LittleFS.begin(false);
+        fsMounted = userFsBegin(false);
     }
-    
+
     if (!fsMounted) {
         return false;  // LittleFS not available
     }
-    
+
     // Try to get mutex (with short timeout - skip in panic context if can't get it)
     bool hasMutex = false;
     if (_mutex && xSemaphoreTake(_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
         hasMutex = true;
+        pumpStreams();  // Snapshot should include records still in the streams
     }
-    // Continue even without mutex in panic context
-    
+    // Continue even without mutex in panic context (streams stay unpumped
+    // there - the crash path writes through addLogDirect anyway)
+
     bool success = false;
-    
-    // Get current RAM buffer as text (use unsafe version since we already have mutex)
-    String ramLogs;
-    if (hasMutex) {
-        ramLogs = getLogsUnsafe();  // Use unsafe version to avoid deadlock
-    } else {
-        // If we don't have mutex, try to get logs normally (will try to acquire mutex)
-        ramLogs = getLogs();
-    }
-    
-    if (ramLogs.length() == 0 && _size == 0) {
+
+    if (_size == 0) {
         if (hasMutex) {
             xSemaphoreGive(_mutex);
         }
         return false;  // Nothing to save
     }
-    
-    // --- FIX: Use "w" (Overwrite) instead of "a" (Append) ---
+
+    // --- Use "w" (Overwrite) instead of "a" (Append) ---
     // This creates a clean snapshot of the current buffer.
-    // It avoids duplication and the need to read back/truncate the file.
-    File file = LittleFS.open("/logs.txt", "w");
+    // The record stream is written raw - no text rendering in panic context.
+    File file = userFS().open("/logs.bin", "w");
     if (file) {
-        file.print(ramLogs);
+        if (_tail < _head) {
+            file.write((const uint8_t*)(_buffer + _tail), _head - _tail);
+        } else {
+            file.write((const uint8_t*)(_buffer + _tail), LOG_BUFFER_SIZE - _tail);
+            if (_head > 0) {
+                file.write((const uint8_t*)_buffer, _head);
+            }
+        }
         file.flush();
         file.close();
+        _lastSavedHead = _head;  // Snapshot replaces the file - reset delta tracking
         success = true;
     }
-    
-    // Note: logs.bin removed - we now use delta/append mode with logs.txt only
-    
+
     if (hasMutex) {
         xSemaphoreGive(_mutex);
     }
-    
+
     return success;
 }
 
@@ -555,18 +822,23 @@ bool LogManager::restoreFromFlash() {
 }
 
 void LogManager::rotateLogs() {
-    if (!LittleFS.exists("/logs.txt")) return;
+    // Drop the legacy text-format file once the binary log exists
+    if (userFS().exists("/logs.bin") && userFS().exists("/logs.txt")) {
+        userFS().remove("/logs.txt");
+    }
 
-    File f = LittleFS.open("/logs.txt", "r");
+    if (!userFS().exists("/logs.bin")) return;
+
+    File f = userFS().open("/logs.bin", "r");
     if (!f) return;
-    
+
     size_t size = f.size();
     f.close();
 
     // If file is larger than 100KB, rotate it
     if (size > 100000) {
-        LittleFS.remove("/logs.bak");        // Delete old backup
-        LittleFS.rename("/logs.txt", "/logs.bak"); // Rotate current to backup
+        userFS().remove("/logs.bak");        // Delete old backup
+        userFS().rename("/logs.bin", "/logs.bak"); // Rotate current to backup
         _lastSavedHead = _head; // Reset delta tracking for new file
     }
 }
@@ -576,33 +848,40 @@ void LogManager::saveDelta() {
     
     // Try to use LittleFS - first try if already mounted, then try to mount
     bool fsMounted = false;
-    File testFile = LittleFS.open("/logs.txt", "r");
+    File testFile = userFS().open("/logs.bin", "r");
     if (testFile) {
         testFile.close();
         fsMounted = true;
     } else {
-        fsMounted = LittleFS.begin(false);
+        fsMounted = userFsBegin(false);  // no format in panic context
     }
-    
+
     if (!fsMounted) {
         return;  // LittleFS not available
     }
-    
+
     // Nothing new to save?
     if (_head == _lastSavedHead) return;
 
-    // Try to get mutex (with short timeout)
-    bool hasMutex = false;
-    if (_mutex && xSemaphoreTake(_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-        hasMutex = true;
+    // This runs on the FS worker, concurrent with addLog() on other tasks -
+    // hold the mutex across the whole delta so _head can't move mid-write.
+    // On contention just skip; loop() posts another save next interval.
+    if (!_mutex || xSemaphoreTake(_mutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        return;
     }
-    
-    // Use "a" (append) mode - extremely fast for small updates
-    File file = LittleFS.open("/logs.txt", "a");
+    if (!_buffer) {  // Disabled while this job sat in the queue
+        xSemaphoreGive(_mutex);
+        return;
+    }
+
+    pumpStreams();  // Pull the latest records into the ring before snapshotting the delta
+
+    // Use "a" (append) mode - extremely fast for small updates. The raw
+    // record bytes are appended, so the file is the same record stream as
+    // the RAM ring and stays parseable at record boundaries.
+    File file = userFS().open("/logs.bin", "a");
     if (!file) {
-        if (hasMutex) {
-            xSemaphoreGive(_mutex);
-        }
+        xSemaphoreGive(_mutex);
         return;
     }
 
@@ -626,11 +905,9 @@ void LogManager::saveDelta() {
 
     file.close();
     _lastSavedHead = _head; // Mark as saved
-    
-    if (hasMutex) {
-        xSemaphoreGive(_mutex);
-    }
-    
+
+    xSemaphoreGive(_mutex);
+
     // Check if we need to rotate logs (don't do this every loop)
     static unsigned long lastRotationCheck = 0;
     unsigned long now = millis();
@@ -645,8 +922,16 @@ void LogManager::loop() {
         return;  // Not enabled, nothing to do
     }
     
+    // Drain the producer streams into the ring. Zero timeout on the mutex:
+    // if a save or fetch holds it right now, the streams just buffer a bit
+    // longer and the next pass catches up - the loop never blocks here
+    if (_mutex && xSemaphoreTake(_mutex, 0) == pdTRUE) {
+        pumpStreams();
+        xSemaphoreGive(_mutex);
+    }
+
     unsigned long now = millis();
-    
+
     // NOW WE CAN SAVE FREQUENTLY!
     // Since we only write ~100 bytes (delta), we can do this every 5 seconds
     // without blocking the network.
@@ -659,84 +944,256 @@ void LogManager::loop() {
     }
     
     if (now - _lastSaveTime >= DELTA_SAVE_INTERVAL_MS) {
-        saveDelta();
-        _lastSaveTime = now;
+        // Flash I/O goes to the FS worker: a rotation hiding behind this
+        // save used to stall the main loop a full flash-erase long. If the
+        // queue is full, retry on the next pass (the delta just grows).
+        if (!_savePending &&
+            FsWorker::post(FsWorker::PRIO_BACKGROUND, [this]() {
+                saveDelta();
+                _savePending = false;
+            })) {
+            _savePending = true;
+            _lastSaveTime = now;
+        }
     }
 }
 
 String LogManager::getLogsFromFlash() {
-    String result;
-    
-    // Check if LittleFS is mounted
-    bool fsMounted = false;
-    File testFile = LittleFS.open("/logs.txt", "r");
-    if (testFile) {
-        testFile.close();
-        fsMounted = true;
-    } else {
-        fsMounted = LittleFS.begin(false);
-    }
-    
-    if (!fsMounted) {
-        return String("ERROR: LittleFS not available");
-    }
-    
-    // Read from text file (delta/append mode storage)
-    File file = LittleFS.open("/logs.txt", "r");
-    if (file) {
-        result = file.readString();
+    // The flash side (mount probe, open, bulk read into PSRAM) runs as one
+    // foreground job on the FS worker - it sequences after any in-flight
+    // background save but ahead of queued ones. Rendering stays on the
+    // caller so the worker isn't tied up doing CPU work.
+    uint8_t* buffer = nullptr;
+    size_t fileSize = 0;
+    String earlyResult;
+    bool haveEarlyResult = false;
+
+    FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+        // Check if LittleFS is mounted
+        bool fsMounted = false;
+        File testFile = userFS().open("/logs.bin", "r");
+        if (testFile) {
+            testFile.close();
+            fsMounted = true;
+        } else {
+            fsMounted = userFsBegin(false);  // no format in panic context
+        }
+
+        if (!fsMounted) {
+            earlyResult = String("ERROR: LittleFS not available");
+            haveEarlyResult = true;
+            return;
+        }
+
+        File file = userFS().open("/logs.bin", "r");
+        if (!file) {
+            // Legacy installs saved rendered text - return it as-is
+            File legacy = userFS().open("/logs.txt", "r");
+            if (legacy) {
+                earlyResult = legacy.readString();
+                legacy.close();
+            } else {
+                earlyResult = String("");
+            }
+            haveEarlyResult = true;
+            return;
+        }
+
+        fileSize = file.size();
+        if (fileSize == 0) {
+            file.close();
+            earlyResult = String("");
+            haveEarlyResult = true;
+            return;
+        }
+
+        buffer = (uint8_t*)heap_caps_malloc(fileSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!buffer) {
+            buffer = (uint8_t*)malloc(fileSize);
+        }
+        if (!buffer) {
+            file.close();
+            earlyResult = String("ERROR: Out of memory");
+            haveEarlyResult = true;
+            return;
+        }
+
+        file.readBytes((char*)buffer, fileSize);
         file.close();
-        return result;
+    });
+
+    if (haveEarlyResult) {
+        return earlyResult;
     }
-    
-    // Note: logs.bin removed - we now use delta/append mode with logs.txt only
-    // If logs.txt doesn't exist, return empty string
-    return String("");
+
+    // Render the record stream - this is the only place flash logs are
+    // turned into text, so the per-log-call path stays binary
+    String result;
+    result.reserve(fileSize + fileSize / 4);
+
+    char entry[LOG_ENTRY_MAX_SIZE];
+    size_t pos = 0;
+    size_t records = 0;
+    while (pos + sizeof(LogRecordHeader) <= fileSize) {
+        LogRecordHeader header;
+        memcpy(&header, buffer + pos, sizeof(header));  // May be unaligned after resync
+        if (header.magic != LOG_RECORD_MAGIC ||
+            pos + sizeof(header) + header.msgLen > fileSize) {
+            pos++;  // Resync on the next record magic
+            continue;
+        }
+        size_t len = renderEntry(entry, sizeof(entry), header.timestamp,
+                                 header.level, header.source,
+                                 (const char*)(buffer + pos + sizeof(header)),
+                                 header.msgLen);
+        result.concat(entry, len);
+        pos += sizeof(header) + header.msgLen;
+
+        if ((++records % 200) == 0) {
+            yield();  // Rendering 100KB of records - don't starve the watchdog
+        }
+    }
+
+    free(buffer);
+    return result;
 }
 
 String LogManager::getLogsComplete() {
-    // First, flush RAM buffer to flash (using delta save to preserve history)
+    // First, flush RAM buffer to flash (using delta save to preserve
+    // history) - on the FS worker so the flush serializes with any
+    // background save already in flight
     if (_enabled && _buffer && _size > 0) {
-        saveDelta();
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [this]() {
+            saveDelta();
+        });
     }
     
     // Then get logs from flash (which has complete history)
     return getLogsFromFlash();
 }
 
+LogManager::LogStreamCursor::~LogStreamCursor() {
+    // Client disconnected mid-transfer - close the abandoned file on the
+    // FS worker like every other flash touch
+    if (file) {
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [this]() {
+            file.close();
+        });
+    }
+}
+
+bool LogManager::streamLogsOpen(LogStreamCursor& cur) {
+    // Flush the RAM delta first so the download includes the latest lines
+    if (_enabled && _buffer && _size > 0) {
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [this]() {
+            saveDelta();
+        });
+    }
+
+    bool ok = false;
+    FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+        cur.file = userFS().open("/logs.bin", "r");
+        if (!cur.file) {
+            // Legacy installs saved rendered text - stream it as-is
+            cur.file = userFS().open("/logs.txt", "r");
+            cur.rawText = true;
+        }
+        if (cur.file) {
+            cur.fileSize = cur.file.size();
+            ok = true;
+        }
+    });
+    return ok;
+}
+
+bool LogManager::streamRefill(LogStreamCursor& cur, size_t need) {
+    size_t have = (cur.rawStart + cur.rawLen > cur.filePos)
+                      ? cur.rawStart + cur.rawLen - cur.filePos : 0;
+    if (have >= need) return true;
+
+    // Slide the unparsed tail to the front and top the buffer up
+    memmove(cur.raw, cur.raw + (cur.filePos - cur.rawStart), have);
+    cur.rawStart = cur.filePos;
+    cur.rawLen = have;
+
+    size_t got = 0;
+    FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+        if (cur.file.seek(cur.rawStart + cur.rawLen)) {
+            got = cur.file.read(cur.raw + cur.rawLen, sizeof(cur.raw) - cur.rawLen);
+        }
+    });
+    cur.rawLen += got;
+    return cur.rawLen >= need;
+}
+
+size_t LogManager::streamLogsChunk(LogStreamCursor& cur, uint8_t* out, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        // Drain rendered text left over from the previous chunk first
+        if (cur.carryOff < cur.carryLen) {
+            size_t n = cur.carryLen - cur.carryOff;
+            if (n > maxLen - written) n = maxLen - written;
+            memcpy(out + written, cur.carry + cur.carryOff, n);
+            written += n;
+            cur.carryOff += n;
+            continue;
+        }
+
+        if (cur.filePos >= cur.fileSize) break;  // Done
+
+        if (cur.rawText) {
+            // Legacy rendered-text file: copy bytes straight through
+            size_t want = cur.fileSize - cur.filePos;
+            if (want > maxLen - written) want = maxLen - written;
+            size_t got = 0;
+            FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+                if (cur.file.seek(cur.filePos)) {
+                    got = cur.file.read(out + written, want);
+                }
+            });
+            if (got == 0) break;  // Read error - truncate the download
+            written += got;
+            cur.filePos += got;
+            continue;
+        }
+
+        // Render the next record into the carry buffer (the raw buffer is
+        // larger than the biggest possible record, so refill can't fail
+        // for size reasons - only at true EOF or a read error)
+        if (!streamRefill(cur, sizeof(LogRecordHeader))) break;
+        LogRecordHeader header;
+        memcpy(&header, cur.raw + (cur.filePos - cur.rawStart), sizeof(header));
+        if (header.magic != LOG_RECORD_MAGIC ||
+            cur.filePos + sizeof(header) + header.msgLen > cur.fileSize) {
+            cur.filePos++;  // Resync on the next record magic
+            continue;
+        }
+        if (!streamRefill(cur, sizeof(header) + header.msgLen)) break;
+        const char* msg = (const char*)cur.raw + (cur.filePos - cur.rawStart) + sizeof(header);
+        cur.carryLen = renderEntry(cur.carry, sizeof(cur.carry), header.timestamp,
+                                   header.level, header.source, msg, header.msgLen);
+        cur.carryOff = 0;
+        cur.filePos += sizeof(header) + header.msgLen;
+    }
+
+    if (written == 0 && cur.file) {
+        // End of stream - close eagerly instead of waiting for the cursor
+        // to be destroyed with the response
+        FsWorker::runSync(FsWorker::PRIO_FOREGROUND, [&]() {
+            cur.file.close();
+        });
+    }
+    return written;
+}
+
 void LogManager::addLogDirect(BrewOSLogLevel level, LogSource source, const char* message) {
     // No-op if disabled - but try to write even if not enabled (panic context)
     if (!message) return;
     
     // 1. Write to standard buffer (in case we don't actually crash/reset)
     if (_buffer) {
-        // Direct write without mutex - for panic handler use only
-        // Format: [timestamp] [SOURCE] LEVEL: message\n
-        char entry[LOG_ENTRY_MAX_SIZE];
-        unsigned long timestamp = millis();
-        
-        // Calculate available space for message (leave room for prefix and newline)
-        size_t prefixLen = snprintf(entry, sizeof(entry), "[%lu] [%s] %s: ", 
-                                     timestamp, sourceToString(source), levelToString(level));
-        size_t maxMsgLen = sizeof(entry) - prefixLen - 2; // -2 for \n and \0
-        
-        // Truncate message if needed
-        char truncatedMsg[LOG_ENTRY_MAX_SIZE];
-        strncpy(truncatedMsg, message, maxMsgLen);
-        truncatedMsg[maxMsgLen] = '\0';
-        
-        // Format complete entry
-        int len = snprintf(entry, sizeof(entry), "[%lu] [%s] %s: %s\n",
-                           timestamp,
-                           sourceToString(source),
-                           levelToString(level),
-                           truncatedMsg);
-        
-        // Write directly to buffer (no mutex - panic context)
-        if (len > 0) {
-            size_t writeLen = (len < (int)sizeof(entry)) ? len : sizeof(entry) - 1;
-            writeToBuffer(entry, writeLen);
-        }
+        // Direct record write without mutex - for panic handler use only
+        writeRecord(level, source, message);
     }
     
     // 2. CRITICAL: Write to RTC Buffer (The Flight Recorder)
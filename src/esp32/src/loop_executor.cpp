@@ -0,0 +1,105 @@
+#include "loop_executor.h"
+#include "crash_guard.h"
+#include "config.h"
+#include <esp_timer.h>
+
+LoopExecutor::Task LoopExecutor::_tasks[LOOP_EXECUTOR_MAX_TASKS];
+uint8_t LoopExecutor::_taskCount = 0;
+int8_t LoopExecutor::_criticalIndex = -1;
+int64_t LoopExecutor::_criticalLastServiceUs = 0;
+
+bool LoopExecutor::add(const char* name, TaskFn fn, uint32_t periodMs,
+                       uint32_t deadlineUs, bool critical) {
+    if (_taskCount >= LOOP_EXECUTOR_MAX_TASKS || !fn) {
+        LOG_W("LoopExecutor: cannot register %s", name ? name : "?");
+        return false;
+    }
+    Task& task = _tasks[_taskCount];
+    task.name = name;
+    task.fn = fn;
+    task.periodMs = periodMs;
+    task.deadlineUs = deadlineUs;
+    task.critical = critical;
+    task.lastRunMs = 0;
+    task.calls = 0;
+    task.totalUs = 0;
+    task.maxUs = 0;
+    task.overruns = 0;
+    if (critical) {
+        _criticalIndex = _taskCount;
+    }
+    _taskCount++;
+    return true;
+}
+
+void LoopExecutor::runTask(Task& task) {
+    // Crash attribution breadcrumb: if this task takes the system down,
+    // next boot knows whom to blame (and shed)
+    CrashGuard::setContext(task.name);
+
+    int64_t start = esp_timer_get_time();
+    task.fn();
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+
+    task.lastRunMs = millis();
+    task.calls++;
+    task.totalUs += elapsed;
+    if (elapsed > task.maxUs) {
+        task.maxUs = elapsed;
+    }
+    if (task.deadlineUs > 0 && elapsed > task.deadlineUs) {
+        task.overruns++;
+    }
+    if (task.critical) {
+        _criticalLastServiceUs = esp_timer_get_time();
+    }
+}
+
+void LoopExecutor::run() {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        Task& task = _tasks[i];
+
+        // A slow predecessor may have starved the critical task (UART RX
+        // buffers are finite) - service it before running anything else
+        if (_criticalIndex >= 0 && (int8_t)i != _criticalIndex) {
+            Task& critical = _tasks[_criticalIndex];
+            if (critical.deadlineUs > 0 &&
+                esp_timer_get_time() - _criticalLastServiceUs >
+                    (int64_t)critical.deadlineUs) {
+                runTask(critical);
+            }
+        }
+
+        if (task.periodMs > 0 && task.lastRunMs != 0 &&
+            now - task.lastRunMs < task.periodMs) {
+            continue;
+        }
+        runTask(task);
+        yield();  // Feed watchdog between tasks (replaces the hand-placed yields)
+    }
+}
+
+void LoopExecutor::statsToJson(JsonArray& arr) {
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        const Task& task = _tasks[i];
+        JsonObject obj = arr.add<JsonObject>();
+        obj["name"] = task.name;
+        obj["calls"] = task.calls;
+        obj["totalUs"] = (uint32_t)task.totalUs;
+        obj["avgUs"] = task.calls ? (uint32_t)(task.totalUs / task.calls) : 0;
+        obj["maxUs"] = task.maxUs;
+        obj["overruns"] = task.overruns;
+        obj["periodMs"] = task.periodMs;
+        obj["deadlineUs"] = task.deadlineUs;
+    }
+}
+
+void LoopExecutor::resetStats() {
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        _tasks[i].calls = 0;
+        _tasks[i].totalUs = 0;
+        _tasks[i].maxUs = 0;
+        _tasks[i].overruns = 0;
+    }
+}
@@ -27,7 +27,9 @@
 #include <freertos/semphr.h>  // For xSemaphoreCreateMutex
 #include <esp_wifi.h>       // For esp_wifi_set_ps, esp_wifi_get_ps
 #include <driver/gpio.h>    // For early GPIO initialization
+#include <esp_attr.h>       // For RTC_NOINIT_ATTR (boot report persistence)
 #include "config.h"
+#include "boot_report.h"
 
 // Fallback SWD pin definitions if not defined in config.h
 // Some hardware may use GPIO 16/17 instead of GPIO 21/45
@@ -41,10 +43,14 @@
 #include "wifi_manager.h"
 #include "web_server.h"
 #include "pico_uart.h"
+#include "esp32_diagnostics.h"
+#include "command_router.h"
+#include "soft_watchdog.h"
 #if SWD_SUPPORTED
 #include "pico_swd.h"  // SWD support (only available on no-screen variant where pins are wired)
 #endif
 #include "log_manager.h"
+#include "time_keeper.h"
 
 // Display and UI (conditional compilation)
 #if ENABLE_SCREEN
@@ -93,6 +99,20 @@
 
 // Panic Handler - catches crashes and writes to log buffer
 #include "panic_handler.h"
+#include "flight_recorder.h"
+#include "crash_guard.h"
+#include "radio_reserve.h"
+#include "task_governor.h"
+#include "cloud_config_sync.h"
+#include "temp_history.h"
+#include "fleet_manager.h"
+#include "trace.h"
+#include "shot_capture.h"
+#include "pump_health.h"
+#include "event_journal.h"
+#include "loop_executor.h"
+#include "fs_worker.h"
+#include "user_fs.h"
 
 // Global instances - use pointers to defer construction until setup()
 // This prevents crashes in constructors before Serial is initialized
@@ -212,6 +232,7 @@ static void setupCheckPendingOTA();
 static void setupInitializeFilesystem();
 static void setupCreateGlobalObjects();
 static void setupInitializeDisplayAndEncoder();
+static void setupCheckWiFiCredentials();
 static void setupInitializeUI();
 static void setupInitializePicoUART();
 static void setupWaitForPicoConnection();
@@ -221,19 +242,33 @@ static void setupInitializeWebServer();
 static void setupInitializeMQTT();
 static void setupInitializeScaleAndBBW();
 static void setupInitializeStateManager();
+static void setupRestoreClock();  // Restore persisted wall clock (before log capture)
 static void setupInitializeLogManager();  // Early initialization (after filesystem)
 static void setupInitializeLogManagerSettings();  // Settings configuration (after State loaded)
 static void setupInitializeCloudConnection();
 static void setupInitializeNotificationManager();
 
-// Loop helper functions
-static void loopCoreSystemUpdates();
+// Loop helper functions (registered with LoopExecutor in setup - see
+// setupRegisterLoopTasks for periods/deadlines)
+static void setupRegisterLoopTasks();
+static void loopTaskWifi();
+static void loopTaskPicoUart();
+static void loopTaskWebServer();
+static void loopTaskCommandRouter();
+
+// Soft-watchdog entry ids (registered in setupRegisterLoopTasks)
+static int8_t g_wdMainLoop = -1;
+static int8_t g_wdPicoUart = -1;
+static int8_t g_wdWebServer = -1;
+static int8_t g_wdUi = -1;
+static void loopTaskShotCapture();
+static void loopTaskEventJournal();
+static void loopTaskStateManager();
 static void loopOptionalServiceUpdates();
 static void loopUpdateConnectionStates();
 static void loopHandlePicoBootInfo();
 static void loopUpdateBrewByWeight();
 static void loopUpdateUI();
-static void loopUpdateMQTTStatus();
 static void loopPeriodicTasks();
 static void loopHandleWiFiTasks();
 static void loopMonitorMemoryAndTiming();
@@ -382,10 +417,15 @@ static void onScaleConnection(bool connected) {
 // Brew-by-Weight Callbacks - Static functions to avoid std::function PSRAM issues
 // =============================================================================
 
+// Stop decision -> WEIGHT_STOP GPIO assert, recorded into the shot's latency budget
+static uint16_t bbwStopGpioMs = 0;
+
 static void onBBWStop() {
     LOG_I("BBW: Sending WEIGHT_STOP signal to Pico");
     if (picoUart && picoUart->isConnected()) {
         picoUart->setWeightStop(true);
+        uint32_t decided = brewByWeight ? brewByWeight->getStopSignalTime() : 0;
+        bbwStopGpioMs = (decided != 0) ? (uint16_t)(millis() - decided) : 0;
         delay(100);
         picoUart->setWeightStop(false);
     } else {
@@ -427,29 +467,48 @@ static void onPowerMeterLwtMessage(const char* payload, unsigned int length) {
 // Cloud Command Callback - Static function to avoid std::function PSRAM issues
 // =============================================================================
 
+static void onRoutedCommand(uint8_t source, const char* type, JsonDocument& doc) {
+    // CommandRouter sink - runs on Core 1 during the batched drain.
+    // MQTT keeps its own command vocabulary/callback; cloud and web share
+    // the WebSocket command processor.
+    if (source == CMD_SOURCE_MQTT) {
+        if (mqttClient) {
+            mqttClient->dispatchCommand(type, doc);
+        }
+    } else if (webServer) {
+        webServer->processCommand(doc);
+    }
+}
+
 static void onCloudCommand(const char* type, JsonDocument& doc) {
-    // Commands from cloud users are processed the same as local WebSocket
-    // Using const char* instead of String to avoid heap fragmentation
-    if (webServer) {
+    // Commands from cloud users are processed the same as local WebSocket.
+    // Post to the CommandRouter so execution happens on Core 1 (this runs on
+    // the cloud WebSocket task) - inline dispatch only as fallback
+    if (!CommandRouter::post(CMD_SOURCE_CLOUD, type, doc) && webServer) {
         webServer->processCommand(doc);
     }
 }
 
-static void onCloudNotification(const Notification& notif) {
+static bool onCloudNotification(const Notification& notif) {
+    // Runs on the notification push task (not the state-change path) - the
+    // blocking HTTPS POST is fine here. Returns false to request a retry.
+
     // Check if cloud integration is enabled
     auto& cloudSettings = State.settings().cloud;
     if (!cloudSettings.enabled) {
-        return;
+        return true;  // Nothing to deliver, don't retry
     }
-    
+
     // Get device key from pairing manager (no String capture needed)
     String deviceKey = pairingManager ? pairingManager->getDeviceKey() : "";
     String cloudUrl = String(cloudSettings.serverUrl);
     String deviceId = String(cloudSettings.deviceId);
-    
-    if (!cloudUrl.isEmpty() && !deviceId.isEmpty()) {
-        sendNotificationToCloud(cloudUrl, deviceId, deviceKey, notif);
+
+    if (cloudUrl.isEmpty() || deviceId.isEmpty()) {
+        return true;  // Not configured, don't retry
     }
+
+    return sendNotificationToCloud(cloudUrl, deviceId, deviceKey, notif);
 }
 
 static void onScheduleTriggered(const BrewOS::ScheduleEntry& schedule) {
@@ -490,6 +549,26 @@ static void onScheduleTriggered(const BrewOS::ScheduleEntry& schedule) {
     }
 }
 
+// Push the compiled wake schedule (plus clock anchor) to the Pico so the
+// 6am warmup still fires if the ESP32 is down at the deadline. Called on
+// every schedule edit and periodically as a drift refresh; the reconnect
+// push lives in PicoProtocolHandler::handleBoot().
+static void pushWakeScheduleToPico() {
+    if (!picoUart || !picoUart->isConnected()) {
+        return;
+    }
+
+    uint8_t payload[4 + BrewOS::MAX_SCHEDULES * 4];
+    size_t len = State.buildWakeSchedulePayload(payload, sizeof(payload));
+    if (len == 0) {
+        return;  // No usable wall clock yet - retried by the periodic push
+    }
+
+    if (picoUart->sendCommand(MSG_CMD_SET_WAKE_SCHEDULE, payload, len)) {
+        LOG_D("Pushed wake schedule to Pico (%d entries)", payload[0]);
+    }
+}
+
 // =============================================================================
 // Pico Packet Handler - Static function to avoid std::function PSRAM issues
 // =============================================================================
@@ -501,11 +580,13 @@ static void onPicoPacket(const PicoPacket& packet) {
     
     // Delegate protocol-level messages to handler (boot, handshake, NACK, status, power meter)
     // These are handled by PicoProtocolHandler for better maintainability
-    if (packet.type == MSG_BOOT || packet.type == MSG_HANDSHAKE || packet.type == MSG_NACK || 
-        packet.type == MSG_STATUS || packet.type == MSG_POWER_METER) {
+    if (packet.type == MSG_BOOT || packet.type == MSG_HANDSHAKE || packet.type == MSG_NACK ||
+        packet.type == MSG_STATUS || packet.type == MSG_STATUS_DELTA ||
+        packet.type == MSG_POWER_METER || packet.type == MSG_CONFIG_SNAPSHOT ||
+        packet.type == MSG_WARM_STATE) {
         protocolHandler.handlePacket(packet);
-        // MSG_STATUS also needs to update connection state
-        if (packet.type == MSG_STATUS) {
+        // Status traffic (full or delta) also needs to update connection state
+        if (packet.type == MSG_STATUS || packet.type == MSG_STATUS_DELTA) {
             runtimeState().updatePicoConnection(true);
         }
         return;
@@ -540,6 +621,28 @@ static void onPicoPacket(const PicoPacket& packet) {
             }
             break;
         }
+        case MSG_LOG_COMPACT: {
+            // Catalog log record from Pico - expand via shared catalog
+            if (g_logManager && packet.length > 0) {
+                g_logManager->handlePicoLogCompact(packet.payload, packet.length);
+            }
+            break;
+        }
+        case MSG_JITTER:
+            // Control-loop jitter report - snooped and cached by PicoUART,
+            // served from /api/protocol/diagnostics
+            break;
+        case MSG_SENSOR_BURST:
+            // Raw shot-start transient frame - assembled by ShotCapture,
+            // served from /api/shot/transient
+            ShotCapture::onTransientFrame(packet.payload, packet.length);
+            break;
+#if TRACEPOINTS
+        case MSG_TRACE:
+            // Tracepoint batch from Pico - merged into the /api/trace dump
+            trace_ingest_pico(packet.payload, packet.length);
+            break;
+#endif
         default:
             // Only log unknown packet types (not every packet)
             LOG_W("Unknown packet type: 0x%02X, len=%d, seq=%d", 
@@ -890,7 +993,23 @@ static void setupEarlyInitialization() {
     
     // Register panic handler early to catch crashes
     registerPanicHandler();
-    
+
+    // Start the flight recorder early too - it snapshots the pre-crash
+    // event trail from RTC memory before anything overwrites it
+    FlightRecorder::begin();
+
+    // Crash-loop guard: evaluates the RTC crash counter and decides what
+    // (if anything) gets shed this boot - must run before any gated init
+    CrashGuard::begin();
+
+    // Hold the radio-stack internal-RAM reserve before WiFi/BLE initialize
+    RadioReserve::begin();
+
+    // Priority governor: setup() runs on the Arduino loop task, which owns
+    // the weight/stop chain - register it as the critical task now, the
+    // background tasks join as they are created
+    TaskGovernor::begin();
+
     // Print startup info (will be lost if no USB host connected)
     Serial.println();
     Serial.println("SETUP START");
@@ -1146,10 +1265,28 @@ static void setupInitializeFilesystem() {
     } else {
         Serial.println("LittleFS mounted OK");
     }
-    
+
+    // Mount the hot-data partition (logs/stats/journal churn). Falls back
+    // to the shared LittleFS on tables without a "userdata" partition.
+    if (userFsBegin()) {
+        Serial.printf("User FS mounted (%s)\n",
+                      userFsIsDedicated() ? "dedicated partition" : "shared with assets");
+    } else {
+        Serial.println("ERROR: User FS mount failed!");
+    }
+
+
     // Log Manager is initialized but NOT enabled by default
     // Buffer is only allocated when enabled via settings (dev mode feature)
     // This is done later after State is loaded, to check the setting
+
+    // Start the FS worker now that the filesystem is mounted - log,
+    // statistics and display-asset I/O route through it from here on
+    FsWorker::begin();
+
+    // Event journal needs the filesystem mounted - recover the sequence
+    // counter before anything appends
+    EventJournal::begin();
 }
 
 static void setupCreateGlobalObjects() {
@@ -1216,6 +1353,10 @@ static void setupCreateGlobalObjects() {
 
 static void setupInitializeDisplayAndEncoder() {
 #if ENABLE_SCREEN
+    if (!CrashGuard::allows(CRASH_SUBSYS_DISPLAY)) {
+        LOG_W("Display shed by crash guard - running headless this boot");
+        return;
+    }
     // Initialize display (PSRAM enabled for RGB frame buffer)
     // Now using lower PCLK (8 MHz) and bounce buffer for WiFi compatibility
     Serial.println("[4/8] Initializing display...");
@@ -1240,13 +1381,24 @@ static void setupInitializeDisplayAndEncoder() {
 #endif
 }
 
+// Checked once on the main task before the boot branches fork - both the
+// UI branch and wifiManager->begin() on the comms branch would otherwise
+// hit the same Preferences instance concurrently
+static bool g_needsWifiSetup = false;
+
+static void setupCheckWiFiCredentials() {
+    Serial.println("[4.7/8] Checking WiFi credentials...");
+    g_needsWifiSetup = !wifiManager->checkCredentials();
+}
+
 static void setupInitializeUI() {
 #if ENABLE_SCREEN
-    // Check if WiFi setup is needed BEFORE initializing UI
-    // This ensures the setup screen shows immediately if no credentials exist
-    Serial.println("[4.7/8] Checking WiFi credentials...");
-    // Serial.flush(); // Removed - can block on USB CDC
-    bool needsWifiSetup = !wifiManager->checkCredentials();
+    if (!CrashGuard::allows(CRASH_SUBSYS_DISPLAY)) {
+        return;  // Display shed - no LVGL objects to build on
+    }
+    // WiFi setup need was determined before the boot branches forked -
+    // this ensures the setup screen shows immediately if no credentials exist
+    bool needsWifiSetup = g_needsWifiSetup;
     ui_state_t& state = runtimeState().beginUpdate();
     if (needsWifiSetup) {
         Serial.println("No WiFi credentials found - setup screen will be shown");
@@ -1275,9 +1427,8 @@ static void setupInitializeUI() {
         display.update();
     }
 #else
-    // Headless mode - still need to check WiFi credentials for state
-    Serial.println("[4.7/8] Checking WiFi credentials (headless mode)...");
-    bool needsWifiSetup = !wifiManager->checkCredentials();
+    // Headless mode - still need the WiFi credential state
+    bool needsWifiSetup = g_needsWifiSetup;
     ui_state_t& state = runtimeState().beginUpdate();
     if (needsWifiSetup) {
         Serial.println("No WiFi credentials found");
@@ -1295,6 +1446,9 @@ static void setupInitializeUI() {
 
 static void setupUICallbacks() {
 #if ENABLE_SCREEN
+    if (!CrashGuard::allows(CRASH_SUBSYS_DISPLAY)) {
+        return;  // Display shed - UI was never initialized
+    }
     // UI callbacks
     extern UI ui;
     ui.onTurnOn([]() {
@@ -1582,6 +1736,11 @@ static void setupInitializeWebServer() {
     // This avoids repeated allocations in broadcastFullStatus (called every 500ms)
     initBroadcastBuffers();
     Serial.println("Broadcast buffers initialized");
+
+    // Warm the first-response path (fragment caches, status docs, one
+    // throwaway broadcast frame) so the first client after an OTA reboot
+    // doesn't pay cold-start latency
+    webServer->warmUp();
     // Serial.flush(); // Removed - can block on USB CDC
     
     // Stagger initialization
@@ -1598,26 +1757,214 @@ static void setupInitializeWebServer() {
     // Serial.flush(); // Removed - can block on USB CDC
 }
 
+// =============================================================================
+// Boot Orchestration
+//
+// setup() used to run every subsystem begin() back to back, so the 10s
+// worst-case Pico connection wait serialized behind display+LVGL init and
+// pushed both time-to-first-screen and time-to-heating out every morning.
+// The phases form a simple dependency graph: everything up to object
+// creation is strictly ordered, but the comms branch (Pico link wait + WiFi
+// bring-up) has no dependency on the display stack. It runs on Core 0 while
+// display+LVGL init continues on Core 1 (the core that renders in loop()),
+// and the branches join before the web server, which needs both. Every
+// phase's duration is recorded and logged at the end of boot so init-time
+// regressions show up in the boot log instead of in morning complaints.
+// =============================================================================
+
+struct BootPhaseTiming {
+    const char* name;
+    uint32_t ms;
+};
+
+#define BOOT_PHASE_MAX 24
+
+static BootPhaseTiming g_bootPhases[BOOT_PHASE_MAX];
+static uint8_t g_bootPhaseCount = 0;
+// Both branches record timings concurrently
+static portMUX_TYPE g_bootPhaseMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void runBootPhase(const char* name, void (*phase)()) {
+    CrashGuard::setContext(name);  // Attribution breadcrumb if this phase crashes
+    uint32_t start = millis();
+    phase();
+    uint32_t elapsed = millis() - start;
+    portENTER_CRITICAL(&g_bootPhaseMux);
+    if (g_bootPhaseCount < BOOT_PHASE_MAX) {
+        g_bootPhases[g_bootPhaseCount].name = name;
+        g_bootPhases[g_bootPhaseCount].ms = elapsed;
+        g_bootPhaseCount++;
+    }
+    portEXIT_CRITICAL(&g_bootPhaseMux);
+}
+
+// Previous boot's breakdown survives a reboot in RTC noinit memory (same
+// mechanism as the crash log buffer), so when a slow boot triggers the
+// reboot-and-retry reflex the evidence isn't lost with it.
+#define BOOT_REPORT_RTC_MAGIC 0xB007CAFE
+#define BOOT_REPORT_NAME_LEN 15
+
+struct BootReportRTC {
+    uint32_t magic;
+    uint32_t total_ms;
+    uint8_t count;
+    char names[BOOT_PHASE_MAX][BOOT_REPORT_NAME_LEN + 1];
+    uint16_t ms[BOOT_PHASE_MAX];
+};
+
+RTC_NOINIT_ATTR static BootReportRTC g_bootReportRTC;
+static BootReportRTC g_prevBootReport;   // Snapshot of RTC contents before overwrite
+static bool g_prevBootValid = false;
+static uint32_t g_bootTotalMs = 0;
+
+// Comms branch: Pico link + WiFi. Signals completion via binary semaphore
+// so setup() can join before starting phases that need both branches.
+static SemaphoreHandle_t g_commsBranchDone = nullptr;
+
+static void bootCommsBranch(void* arg) {
+    (void)arg;
+    runBootPhase("pico_uart", setupInitializePicoUART);
+    runBootPhase("pico_wait", setupWaitForPicoConnection);
+    runBootPhase("wifi", setupInitializeWiFi);
+    xSemaphoreGive(g_commsBranchDone);
+    vTaskDelete(nullptr);
+}
+
+static void logBootTiming(uint32_t totalMs) {
+    g_bootTotalMs = totalMs;
+
+    // Snapshot the previous boot's record before overwriting it, then persist
+    // this boot's breakdown for the next one
+    if (g_bootReportRTC.magic == BOOT_REPORT_RTC_MAGIC &&
+        g_bootReportRTC.count <= BOOT_PHASE_MAX) {
+        memcpy(&g_prevBootReport, &g_bootReportRTC, sizeof(BootReportRTC));
+        g_prevBootValid = true;
+    }
+    g_bootReportRTC.magic = BOOT_REPORT_RTC_MAGIC;
+    g_bootReportRTC.total_ms = totalMs;
+    g_bootReportRTC.count = g_bootPhaseCount;
+    for (uint8_t i = 0; i < g_bootPhaseCount; i++) {
+        strncpy(g_bootReportRTC.names[i], g_bootPhases[i].name, BOOT_REPORT_NAME_LEN);
+        g_bootReportRTC.names[i][BOOT_REPORT_NAME_LEN] = '\0';
+        g_bootReportRTC.ms[i] = (g_bootPhases[i].ms > UINT16_MAX)
+                                    ? UINT16_MAX : (uint16_t)g_bootPhases[i].ms;
+    }
+
+    LOG_I("Boot timing (%lu ms wall clock, branches overlap):", (unsigned long)totalMs);
+    uint8_t slowest = 0;
+    for (uint8_t i = 0; i < g_bootPhaseCount; i++) {
+        LOG_I("  %-14s %5lu ms", g_bootPhases[i].name, (unsigned long)g_bootPhases[i].ms);
+        if (g_bootPhases[i].ms > g_bootPhases[slowest].ms) {
+            slowest = i;
+        }
+    }
+
+    // One line into the persistent log so boot-time regressions show up when
+    // comparing releases, not only on a serial console that nobody had attached
+    if (g_logManager && g_bootPhaseCount > 0) {
+        if (g_prevBootValid) {
+            g_logManager->addLogf(BREWOS_LOG_INFO, LOG_SOURCE_ESP32,
+                                  "Boot: %lu ms (slowest: %s %lu ms, prev boot %lu ms)",
+                                  (unsigned long)totalMs,
+                                  g_bootPhases[slowest].name,
+                                  (unsigned long)g_bootPhases[slowest].ms,
+                                  (unsigned long)g_prevBootReport.total_ms);
+        } else {
+            g_logManager->addLogf(BREWOS_LOG_INFO, LOG_SOURCE_ESP32,
+                                  "Boot: %lu ms (slowest: %s %lu ms)",
+                                  (unsigned long)totalMs,
+                                  g_bootPhases[slowest].name,
+                                  (unsigned long)g_bootPhases[slowest].ms);
+        }
+    }
+}
+
+// Boot report accessors (see boot_report.h) - the table is frozen by the time
+// the web server serves /api/boot-report, so plain reads are fine
+uint8_t boot_report_phase_count() { return g_bootPhaseCount; }
+const char* boot_report_phase_name(uint8_t index) {
+    return (index < g_bootPhaseCount) ? g_bootPhases[index].name : "";
+}
+uint32_t boot_report_phase_ms(uint8_t index) {
+    return (index < g_bootPhaseCount) ? g_bootPhases[index].ms : 0;
+}
+uint32_t boot_report_total_ms() { return g_bootTotalMs; }
+
+bool boot_report_prev_valid() { return g_prevBootValid; }
+uint8_t boot_report_prev_phase_count() {
+    return g_prevBootValid ? g_prevBootReport.count : 0;
+}
+const char* boot_report_prev_phase_name(uint8_t index) {
+    return (g_prevBootValid && index < g_prevBootReport.count)
+               ? g_prevBootReport.names[index] : "";
+}
+uint32_t boot_report_prev_phase_ms(uint8_t index) {
+    return (g_prevBootValid && index < g_prevBootReport.count)
+               ? g_prevBootReport.ms[index] : 0;
+}
+uint32_t boot_report_prev_total_ms() {
+    return g_prevBootValid ? g_prevBootReport.total_ms : 0;
+}
+
 void setup() {
-    setupEarlyInitialization();
-    setupCheckPendingOTA();
-    setupInitializeFilesystem();
-    setupInitializeLogManager();  // Enable early to capture all boot logs
-    setupCreateGlobalObjects();
-    setupInitializeDisplayAndEncoder();
-    setupInitializeUI();
-    setupUICallbacks();
-    setupInitializePicoUART();
-    setupWaitForPicoConnection();
-    setupInitializeWiFi();
-    setupInitializeWebServer();
-    setupInitializeMQTT();
-    setupInitializeScaleAndBBW();
-    setupInitializeStateManager();
-    setupInitializeLogManagerSettings();  // Check settings and configure Pico forwarding
-    setupInitializeCloudConnection();
-    setupInitializeNotificationManager();
-    
+    uint32_t bootStart = millis();
+
+    // Strictly ordered prologue: everything below needs these
+    runBootPhase("early_init", setupEarlyInitialization);
+    runBootPhase("ota_check", setupCheckPendingOTA);
+    runBootPhase("filesystem", setupInitializeFilesystem);
+    runBootPhase("clock", setupRestoreClock);  // Before log capture so timestamps are plausible
+    runBootPhase("log_manager", setupInitializeLogManager);  // Enable early to capture all boot logs
+    runBootPhase("objects", setupCreateGlobalObjects);
+    runBootPhase("wifi_creds", setupCheckWiFiCredentials);  // Before fork (shared Preferences)
+
+    // Fork the comms branch onto Core 0
+    g_commsBranchDone = xSemaphoreCreateBinary();
+    BaseType_t forked = pdFAIL;
+    if (g_commsBranchDone) {
+        forked = xTaskCreatePinnedToCore(bootCommsBranch, "bootComms", 8192,
+                                         nullptr, 2, nullptr, 0);
+    }
+    if (forked != pdPASS) {
+        // Degraded path: run the comms phases inline (sequential boot)
+        Serial.println("WARNING: Boot comms branch failed to start - booting sequentially");
+        runBootPhase("pico_uart", setupInitializePicoUART);
+        runBootPhase("pico_wait", setupWaitForPicoConnection);
+        runBootPhase("wifi", setupInitializeWiFi);
+    }
+
+    // Display branch stays on Core 1. Note setupWaitForPicoConnection
+    // deliberately does no LVGL work, so the PSRAM bandwidth picture is the
+    // same as sequential boot - the renders just happen earlier.
+    runBootPhase("display", setupInitializeDisplayAndEncoder);
+    runBootPhase("ui", setupInitializeUI);
+
+    // Join: web server and everything after need the Pico link and WiFi
+    if (forked == pdPASS) {
+        xSemaphoreTake(g_commsBranchDone, portMAX_DELAY);
+    }
+
+    runBootPhase("ui_callbacks", setupUICallbacks);
+
+    // Unified command queue must exist before any producer (web, MQTT,
+    // cloud) can receive a command
+    CommandRouter::begin(onRoutedCommand);
+
+    runBootPhase("web_server", setupInitializeWebServer);
+    runBootPhase("mqtt_state", setupInitializeMQTT);
+    runBootPhase("scale_bbw", setupInitializeScaleAndBBW);
+    runBootPhase("state_mgr", setupInitializeStateManager);
+    runBootPhase("log_settings", setupInitializeLogManagerSettings);  // Check settings and configure Pico forwarding
+    // Cloud connection and the MQTT broker connect are NOT boot phases:
+    // loopNetworkBringup() starts them once the machine is past its
+    // heat-up-critical window
+    runBootPhase("notifications", setupInitializeNotificationManager);
+
+    logBootTiming(millis() - bootStart);
+
+    // Hand the loop phases to the cooperative executor
+    setupRegisterLoopTasks();
+
     Serial.println("========================================");
     Serial.println("SETUP COMPLETE!");
     Serial.print("Free heap: ");
@@ -1766,10 +2113,10 @@ static void setupInitializeMQTT() {
         }
     }
     
-    // Initialize MQTT (after syncing config from State Manager)
-    Serial.println("[7/8] Initializing MQTT...");
-    // Serial.flush(); // Removed - can block on USB CDC
-    mqttClient->begin();
+    // MQTT wiring only - mqttClient->begin() is deferred to the rate-shaped
+    // network bring-up in loop() so the broker connect + HA discovery burst
+    // doesn't compete with the heat-up critical path (see loopNetworkBringup)
+    Serial.println("[7/8] Configuring MQTT (bring-up deferred)...");
     // Wire MQTT power meter: subscribe to Tasmota/Shelly SENSOR + LWT topics
     mqttClient->setOnPowerMeterMessage(onPowerMeterMqttMessage);
     mqttClient->setOnPowerMeterLwt(onPowerMeterLwtMessage);
@@ -1783,13 +2130,15 @@ static void setupInitializeMQTT() {
             mqttClient->setPowerMeterLwtTopic(lwtTopic);
         }
     }
-    Serial.println("MQTT initialized OK");
+    Serial.println("MQTT configured OK (connect deferred until machine steady)");
     // Serial.flush(); // Removed - can block on USB CDC
 }
 
 static void setupInitializeScaleAndBBW() {
     // Initialize BLE Scale Manager
-    if (scaleEnabled) {
+    if (scaleEnabled && !CrashGuard::allows(CRASH_SUBSYS_SCALE)) {
+        LOG_W("Scale Manager shed by crash guard - skipping BLE init");
+    } else if (scaleEnabled) {
         LOG_I("Initializing BLE Scale Manager...");
         if (scaleManager->begin()) {
             // Set up scale callbacks using static functions to avoid PSRAM issues
@@ -1859,6 +2208,14 @@ static void setupInitializeStateManager() {
 #endif
 }
 
+static void setupRestoreClock() {
+    // Restore the persisted wall clock and hook SNTP refinement. Done before
+    // the log manager starts capturing so even the earliest boot logs carry
+    // plausible timestamps, and schedules can evaluate without waiting for
+    // WiFi + SNTP (see time_keeper.h).
+    TimeKeeper::begin();
+}
+
 static void setupInitializeLogManager() {
     // Enable Log Manager early to capture all boot logs
     // This is done right after filesystem initialization so we can restore from flash
@@ -1988,8 +2345,19 @@ static void setupInitializeCloudConnection() {
         
         // Connect cloud to WebServer for state broadcasting
         webServer->setCloudConnection(cloudConnection);
+
+        // Differential settings sync (section hashes, bulk verify on connect)
+        CloudConfigSync::begin(cloudConnection);
     }
-    
+
+    // Fleet aggregation for multi-machine site dashboards (opt-in, no-op
+    // unless network.fleetEnabled is set)
+    if (CrashGuard::allows(CRASH_SUBSYS_FLEET)) {
+        FleetManager::begin();
+    } else {
+        LOG_W("Fleet manager shed by crash guard - skipping");
+    }
+
     // Set up cloud screen callback for QR code generation
     // This is set regardless of whether cloud is enabled - the callback
     // will show appropriate error if cloud is not configured
@@ -2003,10 +2371,16 @@ static void setupInitializeCloudConnection() {
         }
         
         if (pairingManager) {
-            // Generate new token and register with cloud
-            pairingManager->generateToken();
-            bool registered = pairingManager->registerTokenWithCloud();
-            
+            // Fast path: reuse a token pre-registered at idle; only a
+            // cold cache pays for generation + registration here
+            bool registered = pairingManager->hasRegisteredToken();
+            if (!registered) {
+                if (!pairingManager->isTokenValid()) {
+                    pairingManager->generateToken();
+                }
+                registered = pairingManager->registerTokenWithCloud();
+            }
+
             if (registered || pairingManager->isTokenValid()) {
                 // Update cloud screen with real pairing data
                 String deviceId = pairingManager->getDeviceId();
@@ -2030,15 +2404,26 @@ static void setupInitializeNotificationManager() {
     // Initialize Notification Manager
     Serial.println("[8.5/8] Initializing Notification Manager...");
     // Serial.flush(); // Removed - can block on USB CDC
-    notificationManager->begin();
-    Serial.println("Notification Manager initialized OK");
-    // Serial.flush(); // Removed - can block on USB CDC
-    
-    // Set up cloud notification callback using static function to avoid PSRAM issues
-    notificationManager->onCloud(onCloudNotification);
+    if (CrashGuard::allows(CRASH_SUBSYS_NOTIFICATIONS)) {
+        notificationManager->begin();
+        Serial.println("Notification Manager initialized OK");
+        // Serial.flush(); // Removed - can block on USB CDC
+
+        // Set up cloud notification callback using static function to avoid PSRAM issues
+        notificationManager->onCloud(onCloudNotification);
+    } else {
+        LOG_W("Notification manager shed by crash guard - skipping");
+    }
     
     // Set up schedule callback using static function to avoid PSRAM issues
     State.onScheduleTriggered(onScheduleTriggered);
+
+    // Keep the Pico's autonomous wake table in sync with schedule edits
+    State.onSchedulesChanged(pushWakeScheduleToPico);
+
+    // Pump wear trending needs its NVS baseline before the first shot's
+    // transient arrives, and raises reminders through the manager above
+    PumpHealth::begin();
 }
 
 // =============================================================================
@@ -2064,18 +2449,17 @@ void loop() {
         return;
     }
     
-    loopCoreSystemUpdates();
-    loopOptionalServiceUpdates();
-    loopUpdateConnectionStates();
-    loopHandlePicoBootInfo();
-    loopUpdateBrewByWeight();
-    State.loop();
-    loopUpdateUI();
-    loopUpdateMQTTStatus();
-    loopPeriodicTasks();
-    loopHandleWiFiTasks();
-    loopMonitorMemoryAndTiming();
-    
+    // =========================================================================
+    // PHASE 2-8: Cooperative executor
+    // Tasks registered in setupRegisterLoopTasks(), executed in registration
+    // order (the phase order above still holds). The executor times every
+    // task, skips ones whose period hasn't elapsed, and re-services the
+    // Pico UART poll whenever a slow task starved it past its deadline.
+    // =========================================================================
+    SoftWatchdog::beat(g_wdMainLoop);
+    LoopExecutor::run();
+
+
     // =========================================================================
     // PHASE 9: Loop throttling - Give network stack CPU time
     // =========================================================================
@@ -2084,28 +2468,99 @@ void loop() {
     delay(2);
 }
 
-static void loopCoreSystemUpdates() {
-    // =========================================================================
-    // PHASE 2: Core system updates (always run)
-    // These are essential for basic operation
-    // =========================================================================
-    
+// =============================================================================
+// PHASE 2: Core system tasks (registered with LoopExecutor)
+// =============================================================================
+
+static void loopTaskWifi() {
     // WiFi management - handles connection state machine
     wifiManager->loop();
-    yield();  // Feed watchdog
-    
+
     // Captive portal DNS (only in AP mode)
     if (dnsServerRunning) {
         dnsServer.processNextRequest();
     }
-    
-    // Pico UART communication
+}
+
+static void loopTaskPicoUart() {
+    SoftWatchdog::beat(g_wdPicoUart);
+    TRACE_BEGIN(TRACE_PT_PICO_UART_LOOP);
     picoUart->loop();
-    yield();  // Feed watchdog
-    
-    // Web server request handling
+    TRACE_END(TRACE_PT_PICO_UART_LOOP);
+}
+
+static void loopTaskWebServer() {
+    SoftWatchdog::beat(g_wdWebServer);
     webServer->loop();
-    yield();  // Feed watchdog after web server (handles HTTP requests)
+}
+
+static void loopTaskCommandRouter() {
+    // Batched drain of MQTT/cloud/web commands posted from other tasks
+    CommandRouter::drain();
+}
+
+static void loopTaskShotCapture() {
+    // Full-rate shot telemetry capture (a few stores per tick while brewing)
+    ShotCapture::loop(runtimeState().get());
+}
+
+static void loopTaskEventJournal() {
+    // Sequence-numbered event journal for cloud catch-up sync
+    EventJournal::loop(runtimeState().get());
+}
+
+static void loopTaskStateManager() {
+    State.loop();
+}
+
+static void loopTaskTimeKeeper() {
+    TimeKeeper::loop();
+}
+
+static void loopTaskCrashGuard() {
+    CrashGuard::loop();
+}
+
+static void loopTaskWakeSchedule() {
+    // Periodic wake-table refresh: re-anchors the Pico's minute-of-week
+    // clock (it free-runs on its crystal between pushes) and delivers the
+    // first push once the wall clock becomes usable after a cold boot
+    pushWakeScheduleToPico();
+}
+
+static void setupRegisterLoopTasks() {
+    // Registration order == execution order == the old hand-wired phase
+    // order. pico_uart is the critical task: its 4ms deadline matches the
+    // UART RX buffer headroom at 921600 baud, and the executor re-services
+    // it between other tasks when a slow one overruns.
+    LoopExecutor::add("wifi",          loopTaskWifi,              0, 20000);
+    LoopExecutor::add("pico_uart",     loopTaskPicoUart,          0, 4000, true);
+    LoopExecutor::add("web_server",    loopTaskWebServer,         0, 20000);
+    LoopExecutor::add("services",      loopOptionalServiceUpdates, 0, 20000);
+    LoopExecutor::add("cmd_router",    loopTaskCommandRouter,     0, 10000);
+    LoopExecutor::add("conn_state",    loopUpdateConnectionStates, 25, 2000);
+    LoopExecutor::add("pico_bootinfo", loopHandlePicoBootInfo,    250, 2000);
+    LoopExecutor::add("brew_weight",   loopUpdateBrewByWeight,    0, 5000);
+    LoopExecutor::add("shot_capture",  loopTaskShotCapture,       0, 2000);
+    LoopExecutor::add("event_journal", loopTaskEventJournal,      0, 5000);
+    LoopExecutor::add("state_mgr",     loopTaskStateManager,      0, 10000);
+    LoopExecutor::add("time_keeper",   loopTaskTimeKeeper,        1000, 10000);
+    LoopExecutor::add("wake_sched",    loopTaskWakeSchedule,      900000, 5000);
+    LoopExecutor::add("crash_guard",   loopTaskCrashGuard,        1000, 2000);
+    LoopExecutor::add("ui",            loopUpdateUI,              0, 30000);
+    LoopExecutor::add("net_bringup",   loopNetworkBringup,        0, 10000);
+    LoopExecutor::add("periodic",      loopPeriodicTasks,         0, 10000);
+    LoopExecutor::add("wifi_tasks",    loopHandleWiFiTasks,       0, 10000);
+    LoopExecutor::add("mem_timing",    loopMonitorMemoryAndTiming, 0, 5000);
+
+    // Soft watchdog: heartbeat-gap SLOs for the latency-critical loops.
+    // LoopExecutor stats say how long a task RAN; these say how long one
+    // went WITHOUT running. pico_uart's 50ms SLO is the point where UART RX
+    // backpressure starts NACKing the Pico.
+    g_wdMainLoop  = SoftWatchdog::add("main_loop", 100);
+    g_wdPicoUart  = SoftWatchdog::add("pico_uart", 50);
+    g_wdWebServer = SoftWatchdog::add("web_server", 250);
+    g_wdUi        = SoftWatchdog::add("ui", 250);
 }
 
 static void loopOptionalServiceUpdates() {
@@ -2219,6 +2674,17 @@ static void loopHandlePicoBootInfo() {
             // Boot info was received (maybe from a spontaneous MSG_BOOT), reset counter
             bootInfoRequestCount = 0;
         }
+
+        // One-shot WEIGHT_STOP latency probe: once the link is up, pulse the
+        // stop line against a loopback command so the Pico can verify at boot
+        // that the hardware stop path actually beats the message path (test
+        // 0x14). Never while brewing - raising WEIGHT_STOP stops the shot.
+        static bool weightStopLatencyProbed = false;
+        if (!weightStopLatencyProbed && !needsBootInfo &&
+            !runtimeState().get().is_brewing) {
+            weightStopLatencyProbed = true;
+            esp32_diagnostics_weight_stop_latency_probe(picoUart);
+        }
     }
 }
 
@@ -2231,21 +2697,40 @@ static void loopUpdateBrewByWeight() {
     // =========================================================================
     
     // Only process BBW if we're actually brewing with a connected scale
-    // This prevents any callbacks from firing when not needed
+    // This prevents any callbacks from firing when not needed. The session
+    // and settling checks keep updates flowing briefly after the shot ends
+    // so BBW can see the brew-end edge and measure the drip mass.
     const ui_state_t& state = runtimeState().get();
-    bool shouldUpdateBBW = brewByWeight && 
-                           scaleEnabled && 
-                           scaleManager && 
+    bool shouldUpdateBBW = brewByWeight &&
+                           scaleEnabled &&
+                           scaleManager &&
                            scaleManager->isConnected() &&
-                           state.is_brewing;
-    
-    // Update BBW with current brewing state and scale weight
+                           (state.is_brewing ||
+                            brewByWeight->isActive() ||
+                            brewByWeight->isSettling());
+
+    // Update BBW with current brewing state and scale weight/flow
+    static bool bbwWasBrewing = false;
     if (shouldUpdateBBW) {
+        scale_state_t scaleState = scaleManager->getState();
         brewByWeight->update(
             state.is_brewing,
-            scaleManager->getState().weight,
-            true
+            scaleState.weight,
+            scaleState.flow_rate,
+            true,
+            scaleState.last_update_ms
         );
+
+        // On the brew-end edge the full stop chain latency is known - record
+        // the per-hop budget (sample age, GPIO assert, Pico brew-end) into
+        // the shot record
+        if (bbwWasBrewing && !state.is_brewing && brewByWeight->getState().stop_signaled) {
+            State.recordStopLatency(brewByWeight->getLastStopSampleAgeMs(),
+                                    bbwStopGpioMs,
+                                    brewByWeight->getLastStopChainMs());
+            bbwStopGpioMs = 0;
+        }
+        bbwWasBrewing = state.is_brewing;
     }
     
     // Sync BBW state to machine state (with null check)
@@ -2259,7 +2744,11 @@ static void loopUpdateBrewByWeight() {
 }
 
 static void loopUpdateUI() {
+    SoftWatchdog::beat(g_wdUi);
 #if ENABLE_SCREEN
+    if (!CrashGuard::allows(CRASH_SUBSYS_DISPLAY)) {
+        return;  // Display shed - nothing initialized to update
+    }
     // Update display and encoder
     extern Display display;
     extern Encoder encoder;
@@ -2305,55 +2794,69 @@ static void loopUpdateUI() {
 #endif
 }
 
-static void loopUpdateMQTTStatus() {
-    // Publish MQTT status with delta updates for efficiency
-    // Full status on major changes or periodic sync, delta for incremental changes
-    static StatusChangeDetector mqttChangeDetector;
-    static unsigned long lastMQTTHeartbeat = 0;
-    static unsigned long lastMQTTFullStatus = 0;
-    static bool lastMQTTConnected = false;
-    const unsigned long MQTT_HEARTBEAT_INTERVAL = 30000;  // 30 seconds minimum heartbeat
-    const unsigned long MQTT_FULL_STATUS_INTERVAL = 300000;  // 5 minutes for full status sync
-    
-    // Reset detector when MQTT connection is established (ensures first update is sent)
-    bool mqttConnected = mqttClient && mqttClient->isConnected();
-    if (mqttConnected && !lastMQTTConnected) {
-        mqttChangeDetector.reset();
+// =============================================================================
+// Deferred Network Bring-Up
+//
+// MQTT and the cloud connection used to begin() during boot, where their
+// connect/discovery bursts competed with the first Pico handshake (the
+// sendHandshake() retries in every boot log) and the heat-up critical path.
+// They now come up in rate-shaped stages, 2s apart, once the Pico link is
+// established and the state machine has settled (READY/IDLE/ECO) - or after
+// a 45s cap so a long heat-up or an absent Pico can't hold the features
+// hostage.
+// =============================================================================
+
+#define NETWORK_BRINGUP_STAGE_GAP_MS 2000
+#define NETWORK_BRINGUP_CAP_MS       45000
+
+static uint8_t g_networkBringupStage = 0;  // 0=gated, 1=MQTT up, 2=complete
+static uint32_t g_lastBringupStep = 0;
+
+static bool networkBringupGateOpen() {
+    if (millis() > NETWORK_BRINGUP_CAP_MS) {
+        return true;
     }
-    lastMQTTConnected = mqttConnected;
-    
-    if (mqttConnected) {
-        const ui_state_t& state = runtimeState().get();
-        bool hasChanged = mqttChangeDetector.hasChanged(state);
-        ChangedFields changedFields;
-        if (hasChanged) {
-            changedFields = mqttChangeDetector.getChangedFields(state);
+    if (!picoUart->isConnected()) {
+        return false;  // Handshake/boot-info window - keep the link quiet
+    }
+    uint8_t state = runtimeState().get().machine_state;
+    return state == UI_STATE_READY || state == UI_STATE_IDLE ||
+           state == UI_STATE_ECO;
+}
+
+static void loopNetworkBringup() {
+    if (g_networkBringupStage >= 2) {
+        return;
+    }
+    if (millis() - g_lastBringupStep < NETWORK_BRINGUP_STAGE_GAP_MS) {
+        return;
+    }
+
+    if (g_networkBringupStage == 0) {
+        if (!networkBringupGateOpen()) {
+            return;
         }
-        
-        unsigned long now = millis();
-        bool heartbeatDue = (now - lastMQTTHeartbeat >= MQTT_HEARTBEAT_INTERVAL);
-        bool fullStatusDue = (now - lastMQTTFullStatus >= MQTT_FULL_STATUS_INTERVAL);
-        
-        // Send full status on: major state change, periodic sync, or heartbeat
-        bool majorStateChange = hasChanged && changedFields.machine_state;
-        bool sendFullStatus = majorStateChange || fullStatusDue || heartbeatDue;
-        
-        if (hasChanged || heartbeatDue) {
-            if (sendFullStatus) {
-                mqttClient->publishStatus(state);
-                if (fullStatusDue) {
-                    lastMQTTFullStatus = now;
-                }
-            } else {
-                // Send delta update for incremental changes
-                mqttClient->publishStatusDelta(state, changedFields);
-            }
-            
-            if (heartbeatDue) {
-                lastMQTTHeartbeat = now;
+        if (!CrashGuard::allows(CRASH_SUBSYS_MQTT)) {
+            LOG_W("MQTT shed by crash guard - skipping bring-up");
+        } else {
+            LOG_I("Machine steady - starting deferred MQTT bring-up");
+            if (mqttClient) {
+                mqttClient->begin();  // Config was synced during boot
             }
         }
+        g_networkBringupStage = 1;
+        g_lastBringupStep = millis();
+        return;  // Cloud follows on a later pass (rate-shaped)
+    }
+
+    if (!CrashGuard::allows(CRASH_SUBSYS_CLOUD)) {
+        LOG_W("Cloud connection shed by crash guard - skipping bring-up");
+    } else {
+        LOG_I("Starting deferred cloud bring-up");
+        setupInitializeCloudConnection();
     }
+    g_networkBringupStage = 2;
+    g_lastBringupStep = millis();
 }
 
 static void loopPeriodicTasks() {
@@ -2687,13 +3190,16 @@ static void loopPeriodicTasks() {
         }
     }
     
-    // Periodic unified status broadcast to WebSocket clients (500ms for responsive UI)
-    // Only sends when something changes - WebSocket ping/pong handles keepalive
+    // Periodic unified status broadcast tick (500ms for responsive UI)
+    // The BroadcastScheduler inside broadcastFullStatus decides per sink
+    // (local WS, cloud, MQTT) whether anything is actually due
     if (millis() - lastStatusBroadcast > 500) {
         lastStatusBroadcast = millis();
-        
-        // Broadcast if we have local clients OR cloud connection
-        if (webServer->getClientCount() > 0 || cloudConnection->isConnected()) {
+
+        // Tick if any status sink is connected (MQTT status publishing is
+        // scheduled here too, not in its own loop function anymore)
+        if (webServer->getClientCount() > 0 || cloudConnection->isConnected() ||
+            mqttClient->isConnected()) {
             // Update connection status in machineState
             ui_state_t& state = runtimeState().beginUpdate();
             state.pico_connected = picoUart->isConnected();
@@ -2701,10 +3207,13 @@ static void loopPeriodicTasks() {
             state.mqtt_connected = mqttClient->isConnected();
             state.cloud_connected = cloudConnection->isConnected();
             runtimeState().endUpdate();
-            
-            // Broadcast unified status (goes to both local and cloud clients)
-            // This only sends when something changed, on first connect, or periodic sync
-            webServer->broadcastFullStatus(runtimeState().get());
+
+            // One call fans out to all due sinks with one serialized payload.
+            // Serialize from a snapshot so a Core 1 state update mid-broadcast
+            // can't tear the payload.
+            ui_state_t stateSnapshot;
+            runtimeState().snapshot(stateSnapshot);
+            webServer->broadcastFullStatus(stateSnapshot);
         }
     }
     
@@ -2719,10 +3228,14 @@ static void loopPeriodicTasks() {
     }
     
     // Periodic power meter status broadcast (5 seconds)
+    // Only when the meter accepted a new reading since the last broadcast -
+    // deadband decimation at ingestion means a steady load doesn't wake the
+    // status pipeline at meter rate (a 60s heartbeat keeps totals flowing)
     if (millis() - lastPowerMeterBroadcast > 5000) {
         lastPowerMeterBroadcast = millis();
-        
-        if (powerMeterManager->getSource() != PowerMeterSource::NONE) {
+
+        if (powerMeterManager->getSource() != PowerMeterSource::NONE &&
+            powerMeterManager->consumeReadingChange()) {
             // Broadcast to WebSocket clients
             if (webServer->getClientCount() > 0 || cloudConnection->isConnected()) {
                 webServer->broadcastPowerMeterStatus();
@@ -2779,6 +3292,11 @@ static void loopHandleWiFiTasks() {
             } else {
                 LOG_W("mDNS addService failed (hostname still works)");
             }
+            // Fleet peers find each other on a dedicated service type so
+            // discovery doesn't have to sift every HTTP device on the LAN
+            if (State.settings().network.fleetEnabled) {
+                MDNS.addService("brewos", "tcp", 80);
+            }
             // Mark as started - hostname resolution works even if service registration fails
             mDNSStarted = true;
         } else {
@@ -2817,7 +3335,20 @@ static void loopMonitorMemoryAndTiming() {
     static unsigned long loopStartTime = 0;
     static unsigned long maxLoopTime = 0;
     static unsigned long slowLoopCount = 0;
-    
+
+    // Radio reserve hysteresis (self-throttled to every 2s)
+    RadioReserve::loop();
+
+    // Shot-window priority elevation (brewing edge detection)
+    TaskGovernor::loop();
+
+    // Differential config sync (self-throttled to 1s; connect/generation
+    // edge detection only - uploads happen on actual changes)
+    CloudConfigSync::loop();
+
+    // 1Hz boiler temperature sampling for the dashboard chart ring
+    TempHistory::loop();
+
     // Track loop timing - detect blocking operations
     // This is diagnostic only - if loop takes >1 second, hardware watchdog (3-5s timeout)
     // may reset the chip before we can log the warning
@@ -2856,7 +3387,10 @@ static void loopMonitorMemoryAndTiming() {
         // Reset stats
         maxLoopTime = 0;
         slowLoopCount = 0;
-        
+
+        // Feed the flight recorder - only new heap lows are stored
+        FlightRecorder::recordHeapWatermark(freeHeap);
+
         // Warn if internal heap is dangerously low
         if (freeHeap < 10000) {
             LOG_W("Low internal heap: %zu bytes", freeHeap);
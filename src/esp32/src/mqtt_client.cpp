@@ -4,8 +4,15 @@
 
 #include "mqtt_client.h"
 #include "config.h"
+#include "command_router.h"
+#include "soft_watchdog.h"
+#include "task_governor.h"
 #include "memory_utils.h"
+#include "psram_pool.h"
 #include "ui/ui.h"  // For ui_state_t definition
+#include "runtime_state.h"
+#include "machine_features.h"
+#include "utils/status_strings.h"
 #include "power_meter/power_meter.h"
 #include <ArduinoJson.h>
 #include <initializer_list>
@@ -20,12 +27,121 @@ MQTTClient* MQTTClient::_instance = nullptr;
 // and larger option lists in select entities
 static const uint16_t MQTT_BUFFER_SIZE = 2048;
 
+// Soft-watchdog entry for the background task loop
+static int8_t s_wdMqttTask = -1;
+
+// Interning table for the fixed command set, indexed by mqtt_cmd_id_t.
+// The canonical name is handed to the command callback, so nothing in the
+// receive path copies or heap-allocates command strings.
+static const char* const MQTT_CMD_NAMES[MQTT_CMD_COUNT] = {
+    "set_temp",
+    "set_mode",
+    "tare",
+    "set_target_weight",
+    "set_eco",
+    "enter_eco",
+    "exit_eco",
+    "brew_start",
+    "brew_stop",
+    "set_heating_strategy",
+};
+
+static uint8_t internCommand(const char* cmd) {
+    for (uint8_t i = 0; i < MQTT_CMD_COUNT; i++) {
+        if (strcmp(cmd, MQTT_CMD_NAMES[i]) == 0) {
+            return i;
+        }
+    }
+    return MQTT_CMD_UNKNOWN;
+}
+
 // Total number of entities published to Home Assistant
 // Sensors: 5 temps + 7 power + 5 shot/scale + 3 stats = 20
 // Binary: 7 status sensors
 // Controls: 1 switch + 3 buttons + 3 numbers + 1 select = 8
 static const uint8_t HA_TOTAL_ENTITY_COUNT = 35;
 
+// =============================================================================
+// Per-Topic Payload Cache
+// =============================================================================
+// The periodic topics (status, status/delta, statistics, power) get
+// re-published on heartbeats whether or not anything changed, and this device
+// was dominating packet counts on site brokers because of it. Caching a hash
+// of the last payload per topic lets us drop byte-identical publishes before
+// they hit the socket - the broker's retained copy is already correct.
+
+struct TopicCacheEntry {
+    char suffix[16];    // Topic suffix (as passed to getTopic())
+    uint32_t hash;      // FNV-1a of the last published payload
+    size_t len;
+};
+
+static TopicCacheEntry s_topicCache[8];
+
+static uint32_t payload_hash(const char* data, size_t len) {
+    uint32_t h = 2166136261u;  // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Append ,"seq":N before the closing brace of an already-serialized object.
+// The sequence number is added only to payloads that actually go out, so an
+// unchanged payload hashes identically between heartbeats.
+static size_t append_seq(char* buf, size_t cap, size_t len, uint32_t seq) {
+    if (len < 2 || buf[len - 1] != '}') {
+        return len;
+    }
+    int n = snprintf(buf + len - 1, cap - len + 1, ",\"seq\":%lu}", (unsigned long)seq);
+    if (n <= 0 || (size_t)n >= cap - len + 1) {
+        return len;
+    }
+    return len - 1 + (size_t)n;
+}
+
+bool MQTTClient::payloadChanged(const char* suffix, const char* payload, size_t len) {
+    uint32_t h = payload_hash(payload, len);
+    TopicCacheEntry* entry = nullptr;
+    for (size_t i = 0; i < sizeof(s_topicCache) / sizeof(s_topicCache[0]); i++) {
+        if (s_topicCache[i].suffix[0] == '\0') {
+            entry = &s_topicCache[i];  // Free slot - first publish on this topic
+            break;
+        }
+        if (strcmp(s_topicCache[i].suffix, suffix) == 0) {
+            entry = &s_topicCache[i];
+            if (entry->len == len && entry->hash == h) {
+                return false;  // Byte-identical to the last publish
+            }
+            break;
+        }
+    }
+    if (!entry) {
+        return true;  // Cache full (shouldn't happen - fixed topic set)
+    }
+    strncpy(entry->suffix, suffix, sizeof(entry->suffix) - 1);
+    entry->suffix[sizeof(entry->suffix) - 1] = '\0';
+    entry->hash = h;
+    entry->len = len;
+    return true;
+}
+
+bool MQTTClient::publishPayload(const char* topic, const char* payload, size_t len, bool retained) {
+    bool ok = _client.publish(topic, (const uint8_t*)payload, len, retained);
+    if (ok) {
+        _publishStats.published++;
+        _publishStats.payloadBytes += len;
+    }
+    return ok;
+}
+
+void MQTTClient::getPublishStats(MQTTPublishStats* stats) const {
+    if (stats) {
+        *stats = _publishStats;
+    }
+}
+
 // =============================================================================
 // MQTT Client Implementation
 // =============================================================================
@@ -37,10 +153,12 @@ MQTTClient::MQTTClient()
     , _lastStatusPublish(0)
     , _reconnectDelay(1000)
     , _wasConnected(false)
+    , _publishStats{}
+    , _statusSequence(0)
+    , _savedDiscoveryFingerprint(0)
     , _taskHandle(nullptr)
     , _mutex(nullptr)
-    , _taskRunning(false)
-    , _commandQueue(nullptr) {
+    , _taskRunning(false) {
     
     _instance = this;
     _client.setCallback(messageCallback);
@@ -52,14 +170,29 @@ MQTTClient::MQTTClient()
     
     // Create mutex for thread-safe access
     _mutex = xSemaphoreCreateMutex();
-    
-    // Create command queue for thread-safe command passing from Core 0 to Core 1
-    _commandQueue = xQueueCreate(COMMAND_QUEUE_SIZE, sizeof(MQTTCommand));
-    if (_commandQueue == nullptr) {
-        LOG_E("Failed to create MQTT command queue");
-    }
+
     _powerMeterTopic[0] = '\0';
     _powerMeterLwtTopic[0] = '\0';
+    memset(_topicTable, 0, sizeof(_topicTable));
+}
+
+// Suffixes for the interned topic table - indexed by TopicId
+const char* const MQTTClient::TOPIC_SUFFIXES[MQTTClient::TOPIC_COUNT] = {
+    "availability",
+    "command",
+    "status",
+    "status/delta",
+    "shot",
+    "statistics",
+    "power"
+};
+
+void MQTTClient::buildTopicTable() {
+    // Rebuilt whenever topic_prefix or ha_device_id can have changed
+    // (begin() and setConfig()); everything else reads the table
+    for (uint8_t i = 0; i < TOPIC_COUNT; i++) {
+        getTopic(TOPIC_SUFFIXES[i], _topicTable[i], sizeof(_topicTable[i]));
+    }
 }
 
 bool MQTTClient::begin() {
@@ -85,10 +218,19 @@ bool MQTTClient::begin() {
     if (strlen(_config.client_id) == 0) {
         snprintf(_config.client_id, sizeof(_config.client_id), "brewos_%s", _config.ha_device_id);
     }
-    
-    LOG_I("MQTT configured: broker=%s:%d, client_id=%s", 
+
+    // Intern the fixed topics for this configuration
+    buildTopicTable();
+
+    LOG_I("MQTT configured: broker=%s:%d, client_id=%s",
           _config.broker, _config.port, _config.client_id);
-    
+
+    // Soft-watchdog heartbeat for the task loop. SLO is above the bounded
+    // 5s connect window, so only pathological stalls count as violations.
+    if (s_wdMqttTask < 0) {
+        s_wdMqttTask = SoftWatchdog::add("mqtt_task", 6000);
+    }
+
     // Start background task on Core 0
     if (_taskHandle == nullptr && _config.enabled) {
         _taskRunning = true;
@@ -101,6 +243,8 @@ bool MQTTClient::begin() {
             &_taskHandle,
             MQTT_TASK_CORE
         );
+        // Demoted while a shot is in progress
+        TaskGovernor::manage(_taskHandle, GOV_BACKGROUND);
         LOG_I("MQTT task started on Core %d", MQTT_TASK_CORE);
     }
     
@@ -118,6 +262,7 @@ void MQTTClient::taskCode(void* parameter) {
 
 void MQTTClient::taskLoop() {
     while (_taskRunning) {
+        SoftWatchdog::beat(s_wdMqttTask);
         if (!_config.enabled) {
             vTaskDelay(pdMS_TO_TICKS(1000));
             continue;
@@ -149,17 +294,33 @@ void MQTTClient::taskLoop() {
             if (!clientConnected) {
                 unsigned long now = millis();
                 if (now - _lastReconnectAttempt > (unsigned long)_reconnectDelay) {
-                    _lastReconnectAttempt = now;
                     xSemaphoreGive(_mutex);
-                    LOG_I("MQTT reconnecting to %s:%d (attempt, delay=%lums)", 
-                          _config.broker, _config.port, _reconnectDelay);
-                    if (connect()) {
-                        _reconnectDelay = 1000;  // Reset delay on success
-                        LOG_I("MQTT reconnection successful");
-                    } else {
-                        // Exponential backoff, max 60 seconds
+
+                    // Resolution is asynchronous: while DNS is in flight the
+                    // task keeps its 50ms cadence instead of sitting inside
+                    // hostByName for seconds during a DNS flap. The attempt
+                    // clock only advances when a connect (or a resolution
+                    // failure) actually happens, so backoff behaves as before.
+                    IPAddress brokerIP;
+                    if (resolveBroker(brokerIP)) {
+                        _lastReconnectAttempt = now;
+                        LOG_I("MQTT reconnecting to %s:%d (attempt, delay=%lums)",
+                              _config.broker, _config.port, _reconnectDelay);
+                        if (connectToBroker(brokerIP)) {
+                            _reconnectDelay = 1000;  // Reset delay on success
+                            LOG_I("MQTT reconnection successful");
+                        } else {
+                            // Exponential backoff, max 60 seconds
+                            _reconnectDelay = min(_reconnectDelay * 2, 60000);
+                            LOG_W("MQTT reconnection failed, next attempt in %lums", _reconnectDelay);
+                        }
+                    } else if (_resolveState == RESOLVE_FAILED) {
+                        // DNS said no (or timed out) - counts as an attempt
+                        _resolveState = RESOLVE_IDLE;
+                        _lastReconnectAttempt = now;
                         _reconnectDelay = min(_reconnectDelay * 2, 60000);
-                        LOG_W("MQTT reconnection failed, next attempt in %lums", _reconnectDelay);
+                        LOG_W("MQTT: broker DNS resolution failed, next attempt in %lums",
+                              _reconnectDelay);
                     }
                     continue;
                 }
@@ -174,7 +335,8 @@ void MQTTClient::taskLoop() {
         vTaskDelay(pdMS_TO_TICKS(50));
     }
     
-    // Task is ending
+    // Task is ending - leave the governor before the handle dies
+    TaskGovernor::unmanage(xTaskGetCurrentTaskHandle());
     vTaskDelete(nullptr);
 }
 
@@ -182,38 +344,23 @@ void MQTTClient::loop() {
     // The main loop() now provides API compatibility only
     // All MQTT work happens in the background task (taskLoop() on Core 0)
     // This prevents MQTT operations from blocking the main loop on Core 1
-    // 
+    //
     // NON-BLOCKING GUARANTEE:
     // - MQTT connection attempts run in FreeRTOS task (taskLoop)
     // - Reconnection logic uses vTaskDelay() instead of delay()
     // - PubSubClient::loop() is called from task, not main loop
     // - Main loop() never blocks waiting for MQTT operations
-    
-    // Process queued commands (called from main loop on Core 1)
-    processCommands();
+    //
+    // Commands received on the task are posted to the CommandRouter, which
+    // the main loop drains in a batched pass alongside cloud/web commands
 }
 
-void MQTTClient::processCommands() {
-    // Process all queued commands (non-blocking)
-    // This runs on Core 1 (main loop) for thread safety
-    if (_commandQueue == nullptr || _commandCallback == nullptr) {
-        return;
-    }
-    
-    MQTTCommand mqttCmd;
-    while (xQueueReceive(_commandQueue, &mqttCmd, 0) == pdTRUE) {
-        // Parse JSON payload
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, mqttCmd.payload);
-        if (error) {
-            LOG_W("Failed to parse queued MQTT command JSON: %s", error.c_str());
-            continue;
-        }
-        
-        // Execute callback on Core 1 (main loop context)
-        // This ensures thread safety: scaleManager, brewByWeight, etc. are accessed
-        // only from Core 1 where they were created
-        _commandCallback(mqttCmd.cmd, doc);
+void MQTTClient::dispatchCommand(const char* cmd, JsonDocument& doc) {
+    // Called by the CommandRouter sink on Core 1 (main loop context).
+    // This ensures thread safety: scaleManager, brewByWeight, etc. are accessed
+    // only from Core 1 where they were created.
+    if (_commandCallback) {
+        _commandCallback(cmd, doc);
     }
 }
 
@@ -242,7 +389,10 @@ bool MQTTClient::setConfig(const MQTTConfig& config) {
     if (strlen(_config.client_id) == 0) {
         snprintf(_config.client_id, sizeof(_config.client_id), "brewos_%s", _config.ha_device_id);
     }
-    
+
+    // Prefix or device ID may have changed - re-intern the fixed topics
+    buildTopicTable();
+
     // Save to NVS
     saveConfig();
     
@@ -329,49 +479,123 @@ int MQTTClient::testConnectionWithConfig(const MQTTConfig& testConfig) {
     }
 }
 
+void MQTTClient::dnsResolvedCallback(const char* name, const ip_addr_t* ipaddr, void* arg) {
+    // Runs on the lwIP tcpip task - store the raw address, then publish it
+    // by flipping the state flag the MQTT task is polling
+    MQTTClient* self = static_cast<MQTTClient*>(arg);
+    if (ipaddr != nullptr && IP_IS_V4(ipaddr)) {
+        self->_resolvedAddr = ip_addr_get_ip4_u32(ipaddr);
+        self->_resolveState = RESOLVE_DONE;
+    } else {
+        self->_resolveState = RESOLVE_FAILED;
+    }
+}
+
+bool MQTTClient::resolveBroker(IPAddress& out) {
+    // Non-blocking: returns true only when an address is ready to dial.
+    // Called every 50ms task tick while disconnected and past the backoff.
+
+    // Literal IP configured - nothing to resolve
+    if (out.fromString(_config.broker)) {
+        return true;
+    }
+
+    // Fast path: one attempt per outage against the last IP that worked,
+    // before any DNS round trip. Covers the common case where the broker
+    // bounced but DNS (or the DNS server itself) is flapping.
+    if (_lastGoodIP != IPAddress() && !_triedLastGoodIP) {
+        _triedLastGoodIP = true;
+        LOG_I("MQTT: trying cached broker IP %s", _lastGoodIP.toString().c_str());
+        out = _lastGoodIP;
+        return true;
+    }
+
+    switch (_resolveState) {
+        case RESOLVE_DONE:
+            out = IPAddress(_resolvedAddr);
+            _resolveState = RESOLVE_IDLE;
+            LOG_I("MQTT: Broker resolved to %s", out.toString().c_str());
+            return true;
+
+        case RESOLVE_PENDING:
+            // Give up on an answer that isn't coming - taskLoop converts
+            // FAILED into a backed-off attempt
+            if (millis() - _resolveStartMs > DNS_RESOLVE_TIMEOUT_MS) {
+                _resolveState = RESOLVE_FAILED;
+            }
+            return false;
+
+        case RESOLVE_IDLE:
+        case RESOLVE_FAILED:
+        default: {
+            // Kick off an async lookup. lwIP answers ERR_OK straight from
+            // its cache, ERR_INPROGRESS when it has to go to the network.
+            ip_addr_t addr;
+            err_t err = dns_gethostbyname(_config.broker, &addr,
+                                          dnsResolvedCallback, this);
+            if (err == ERR_OK) {
+                if (IP_IS_V4(&addr)) {
+                    out = IPAddress(ip_addr_get_ip4_u32(&addr));
+                    return true;
+                }
+                _resolveState = RESOLVE_FAILED;
+                return false;
+            }
+            if (err == ERR_INPROGRESS) {
+                _resolveState = RESOLVE_PENDING;
+                _resolveStartMs = millis();
+            } else {
+                _resolveState = RESOLVE_FAILED;
+            }
+            return false;
+        }
+    }
+}
+
 bool MQTTClient::connect() {
+    // Synchronous variant for explicit user actions (setConfig, the web
+    // UI's Test Connection). The reconnect path in taskLoop() goes through
+    // resolveBroker() instead, so DNS never blocks the task there.
+    IPAddress brokerIP;
+    if (!brokerIP.fromString(_config.broker)) {
+        if (!WiFi.hostByName(_config.broker, brokerIP)) {
+            LOG_W("MQTT: DNS resolution failed for %s", _config.broker);
+            return false;
+        }
+    }
+    return connectToBroker(brokerIP);
+}
+
+bool MQTTClient::connectToBroker(IPAddress brokerIP) {
     if (WiFi.status() != WL_CONNECTED) {
         LOG_W("MQTT: WiFi not connected");
         return false;
     }
-    
+
     // Log network diagnostics
     int32_t rssi = WiFi.RSSI();
     IPAddress localIP = WiFi.localIP();
     IPAddress gatewayIP = WiFi.gatewayIP();
-    LOG_I("MQTT: Network: IP=%s, RSSI=%d dBm, Gateway=%s", 
+    LOG_I("MQTT: Network: IP=%s, RSSI=%d dBm, Gateway=%s",
           localIP.toString().c_str(), rssi, gatewayIP.toString().c_str());
-    
+
     // Configure WiFi client timeout - MUST be set before connection attempt
-    // ESP32 NetworkClient has a default 3s timeout that needs to be overridden
-    // Set both socket timeout and overall client timeout
-    _wifiClient.setTimeout(15000);  // 15 second timeout for MQTT operations
-    
-    // Also set socket timeout explicitly (PubSubClient uses this)
+    // A dead broker now costs at most 5s of task time per backed-off attempt
+    // (it was 15s, and unbounded again for DNS before resolution moved out)
+    _wifiClient.setTimeout(5000);
+
+    // Socket timeout for established-connection operations (PubSubClient)
     _client.setSocketTimeout(15);  // Ensure PubSubClient uses 15s timeout
-    
-    LOG_I("Connecting to MQTT broker %s:%d...", _config.broker, _config.port);
-    
-    // Test broker connectivity first (non-blocking check)
-    // This helps diagnose if broker is unreachable vs authentication failure
-    IPAddress brokerIP;
-    if (WiFi.hostByName(_config.broker, brokerIP)) {
-        LOG_I("MQTT: Broker resolved to %s", brokerIP.toString().c_str());
-    } else {
-        LOG_W("MQTT: DNS resolution failed for %s", _config.broker);
-        // Continue anyway - PubSubClient will try DNS itself
-    }
-    
-    // Additional diagnostic: Check if broker IP is reachable
-    // This helps identify network/firewall issues
-    if (brokerIP != INADDR_NONE) {
-        LOG_D("MQTT: Broker IP resolved, attempting TCP connection...");
-    }
-    
-    // Build will topic for LWT
-    char willTopic[64];
-    getTopic("availability", willTopic, sizeof(willTopic));
-    
+
+    // Dial the resolved address - PubSubClient never sees the hostname, so
+    // it can't fall back into its own blocking DNS lookup
+    _client.setServer(brokerIP, _config.port);
+    LOG_I("Connecting to MQTT broker %s (%s):%d...",
+          _config.broker, brokerIP.toString().c_str(), _config.port);
+
+    // Will topic for LWT (interned)
+    const char* willTopic = topicFor(TOPIC_AVAILABILITY);
+
     bool connected = false;
     if (strlen(_config.username) > 0) {
         connected = _client.connect(
@@ -397,13 +621,20 @@ bool MQTTClient::connect() {
         LOG_I("MQTT connected!");
         _connected = true;
         _reconnectDelay = 1000;
-        
+
+        // Remember the address for the per-outage fast path, and re-arm it
+        _lastGoodIP = brokerIP;
+        _triedLastGoodIP = false;
+
+        // Forget cached payloads - a restarted broker may have lost the
+        // retained state we'd otherwise keep suppressing against
+        memset(s_topicCache, 0, sizeof(s_topicCache));
+
         // Publish online status
         publishAvailability(true);
         
         // Subscribe to command topic
-        char cmdTopic[64];
-        getTopic("command", cmdTopic, sizeof(cmdTopic));
+        const char* cmdTopic = topicFor(TOPIC_COMMAND);
         _client.subscribe(cmdTopic, 1);
         LOG_I("Subscribed to: %s", cmdTopic);
         
@@ -418,8 +649,16 @@ bool MQTTClient::connect() {
         }
         
         // Publish Home Assistant discovery if enabled
+        // The discovery configs are retained by the broker, so the 35-entity
+        // burst is skipped when nothing that shapes them has changed since the
+        // last complete publish - reconnect goes straight to the first status
         if (_config.ha_discovery) {
-            publishHomeAssistantDiscovery();
+            uint32_t fp = discoveryFingerprint();
+            if (fp != _savedDiscoveryFingerprint) {
+                publishHomeAssistantDiscovery();
+            } else {
+                LOG_I("HA discovery unchanged, relying on retained configs");
+            }
         }
         
         if (_onConnected) {
@@ -489,27 +728,13 @@ void MQTTClient::publishStatus(const ui_state_t& state) {
     #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
     StaticJsonDocument<1024> doc;
     #pragma GCC diagnostic pop
-    
-    // Sequence number for tracking updates
-    static uint32_t mqttStatusSequence = 0;
-    mqttStatusSequence++;
-    doc["seq"] = mqttStatusSequence;
-    
+
+    // Note: the sequence number is appended after the unchanged-payload
+    // check below, so heartbeat republishes of identical content hash equal
+
     // Machine state - convert to string for HA templates
-    const char* stateStr = "unknown";
-    const char* modeStr = "standby";
-    switch (state.machine_state) {
-        case UI_STATE_INIT: stateStr = "init"; modeStr = "standby"; break;
-        case UI_STATE_IDLE: stateStr = "standby"; modeStr = "standby"; break;
-        case UI_STATE_HEATING: stateStr = "heating"; modeStr = "on"; break;
-        case UI_STATE_READY: stateStr = "ready"; modeStr = "on"; break;
-        case UI_STATE_BREWING: stateStr = "brewing"; modeStr = "on"; break;
-        case UI_STATE_FAULT: stateStr = "fault"; modeStr = "standby"; break;
-        case UI_STATE_SAFE: stateStr = "safe"; modeStr = "standby"; break;
-        case UI_STATE_ECO: stateStr = "eco"; modeStr = "eco"; break;
-    }
-    doc["state"] = stateStr;
-    doc["mode"] = modeStr;
+    doc["state"] = statusStateStringMqtt(state.machine_state);
+    doc["mode"] = statusModeString(state.machine_state);
     doc["heating_strategy"] = state.heating_strategy;  // 0-3 for HA template
     
     // Temperature readings - use stack buffers instead of String
@@ -518,11 +743,13 @@ void MQTTClient::publishStatus(const ui_state_t& state) {
     doc["brew_temp"] = serialized(tempBuf);
     snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.brew_setpoint);
     doc["brew_setpoint"] = serialized(tempBuf);
-    snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_temp);
-    doc["steam_temp"] = serialized(tempBuf);
-    snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_setpoint);
-    doc["steam_setpoint"] = serialized(tempBuf);
-    
+    if (machine_has_steam_boiler(state.machine_type)) {
+        snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_temp);
+        doc["steam_temp"] = serialized(tempBuf);
+        snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_setpoint);
+        doc["steam_setpoint"] = serialized(tempBuf);
+    }
+
     // Pressure
     snprintf(tempBuf, sizeof(tempBuf), "%.2f", state.pressure);
     doc["pressure"] = serialized(tempBuf);
@@ -551,14 +778,29 @@ void MQTTClient::publishStatus(const ui_state_t& state) {
     doc["pico_connected"] = state.pico_connected;
     doc["wifi_connected"] = state.wifi_connected;
     
-    // Serialize to stack buffer (avoid String allocation)
-    char statusBuffer[1024];
-    size_t len = serializeJson(doc, statusBuffer, sizeof(statusBuffer));
-    
-    // Publish to status topic (retained) - use getTopic() helper to respect topic_prefix
-    char statusTopic[64];
-    getTopic("status", statusTopic, sizeof(statusTopic));
-    if (!_client.publish(statusTopic, (const uint8_t*)statusBuffer, len, true)) {
+    // Serialize to a pooled buffer (avoid String allocation and stack bulk)
+    const size_t statusBufSize = 1024;
+    char* statusBuffer = (char*)PsramPool::instance().allocate(statusBufSize, "mqtt");
+    if (!statusBuffer) {
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    size_t len = serializeJson(doc, statusBuffer, statusBufSize);
+
+    // Suppress heartbeat republishes whose content hasn't changed - the
+    // broker's retained copy is already identical
+    if (!payloadChanged("status", statusBuffer, len)) {
+        _publishStats.suppressed++;
+        PsramPool::instance().release(statusBuffer);
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    _statusSequence++;
+    len = append_seq(statusBuffer, statusBufSize, len, _statusSequence);
+
+    // Publish to status topic (retained, interned)
+    const char* statusTopic = topicFor(TOPIC_STATUS);
+    if (!publishPayload(statusTopic, statusBuffer, len, true)) {
         LOG_W("Failed to publish status");
         // Check if connection was lost during publish
         if (!_client.connected()) {
@@ -568,6 +810,7 @@ void MQTTClient::publishStatus(const ui_state_t& state) {
         LOG_D("Published status to %s (%d bytes)", statusTopic, len);
     }
     
+    PsramPool::instance().release(statusBuffer);
     xSemaphoreGive(_mutex);
 }
 
@@ -589,29 +832,15 @@ void MQTTClient::publishStatusDelta(const ui_state_t& state, const ChangedFields
     #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
     StaticJsonDocument<512> doc;  // Smaller buffer for delta
     #pragma GCC diagnostic pop
-    
-    // Sequence number (shared with full status)
-    static uint32_t mqttStatusSequence = 0;
-    mqttStatusSequence++;
-    doc["seq"] = mqttStatusSequence;
+
+    // Sequence number (shared with full status) is appended after the
+    // unchanged-payload check
     doc["type"] = "status_delta";
     
     // Machine state
     if (changed.machine_state || changed.machine_mode) {
-        const char* stateStr = "unknown";
-        const char* modeStr = "standby";
-        switch (state.machine_state) {
-            case UI_STATE_INIT: stateStr = "init"; modeStr = "standby"; break;
-            case UI_STATE_IDLE: stateStr = "standby"; modeStr = "standby"; break;
-            case UI_STATE_HEATING: stateStr = "heating"; modeStr = "on"; break;
-            case UI_STATE_READY: stateStr = "ready"; modeStr = "on"; break;
-            case UI_STATE_BREWING: stateStr = "brewing"; modeStr = "on"; break;
-            case UI_STATE_FAULT: stateStr = "fault"; modeStr = "standby"; break;
-            case UI_STATE_SAFE: stateStr = "safe"; modeStr = "standby"; break;
-            case UI_STATE_ECO: stateStr = "eco"; modeStr = "eco"; break;
-        }
-        doc["state"] = stateStr;
-        doc["mode"] = modeStr;
+        doc["state"] = statusStateStringMqtt(state.machine_state);
+        doc["mode"] = statusModeString(state.machine_state);
     }
     
     if (changed.heating_strategy) {
@@ -625,10 +854,12 @@ void MQTTClient::publishStatusDelta(const ui_state_t& state, const ChangedFields
         doc["brew_temp"] = serialized(tempBuf);
         snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.brew_setpoint);
         doc["brew_setpoint"] = serialized(tempBuf);
-        snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_temp);
-        doc["steam_temp"] = serialized(tempBuf);
-        snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_setpoint);
-        doc["steam_setpoint"] = serialized(tempBuf);
+        if (machine_has_steam_boiler(state.machine_type)) {
+            snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_temp);
+            doc["steam_temp"] = serialized(tempBuf);
+            snprintf(tempBuf, sizeof(tempBuf), "%.1f", state.steam_setpoint);
+            doc["steam_setpoint"] = serialized(tempBuf);
+        }
     }
     
     // Pressure
@@ -681,14 +912,28 @@ void MQTTClient::publishStatusDelta(const ui_state_t& state, const ChangedFields
         doc["wifi_connected"] = state.wifi_connected;
     }
     
-    // Serialize to stack buffer
-    char statusBuffer[512];
-    size_t len = serializeJson(doc, statusBuffer, sizeof(statusBuffer));
-    
-    // Publish to delta topic (non-retained)
-    char deltaTopic[64];
-    getTopic("status/delta", deltaTopic, sizeof(deltaTopic));
-    if (!_client.publish(deltaTopic, (const uint8_t*)statusBuffer, len, false)) {
+    // Serialize to a pooled buffer
+    const size_t statusBufSize = 512;
+    char* statusBuffer = (char*)PsramPool::instance().allocate(statusBufSize, "mqtt");
+    if (!statusBuffer) {
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    size_t len = serializeJson(doc, statusBuffer, statusBufSize);
+
+    // A delta identical to the previous one carries no information
+    if (!payloadChanged("status/delta", statusBuffer, len)) {
+        _publishStats.suppressed++;
+        PsramPool::instance().release(statusBuffer);
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    _statusSequence++;
+    len = append_seq(statusBuffer, statusBufSize, len, _statusSequence);
+
+    // Publish to delta topic (non-retained, interned)
+    const char* deltaTopic = topicFor(TOPIC_STATUS_DELTA);
+    if (!publishPayload(deltaTopic, statusBuffer, len, false)) {
         LOG_W("Failed to publish status delta");
         if (!_client.connected()) {
             _connected = false;
@@ -697,6 +942,7 @@ void MQTTClient::publishStatusDelta(const ui_state_t& state, const ChangedFields
         LOG_D("Published status delta to %s (%d bytes)", deltaTopic, len);
     }
     
+    PsramPool::instance().release(statusBuffer);
     xSemaphoreGive(_mutex);
 }
 
@@ -711,9 +957,8 @@ void MQTTClient::publishShot(const char* shot_json) {
         return;
     }
     
-    char shotTopic[64];
-    getTopic("shot", shotTopic, sizeof(shotTopic));
-    if (!_client.publish(shotTopic, (const uint8_t*)shot_json, strlen(shot_json), false)) {
+    const char* shotTopic = topicFor(TOPIC_SHOT);
+    if (!publishPayload(shotTopic, shot_json, strlen(shot_json), false)) {
         LOG_W("Failed to publish shot data");
         if (!_client.connected()) {
             _connected = false;
@@ -734,9 +979,14 @@ void MQTTClient::publishStatisticsJson(const char* stats_json) {
         return;
     }
     
-    char statsTopic[64];
-    getTopic("statistics", statsTopic, sizeof(statsTopic));
-    if (!_client.publish(statsTopic, (const uint8_t*)stats_json, strlen(stats_json), true)) {
+    const char* statsTopic = topicFor(TOPIC_STATISTICS);
+    size_t statsLen = strlen(stats_json);
+    if (!payloadChanged("statistics", stats_json, statsLen)) {
+        _publishStats.suppressed++;
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    if (!publishPayload(statsTopic, stats_json, statsLen, true)) {
         LOG_W("Failed to publish statistics");
         if (!_client.connected()) {
             _connected = false;
@@ -772,10 +1022,14 @@ void MQTTClient::publishStatistics(uint16_t shotsToday, uint32_t totalShots, flo
     char statsBuffer[128];
     size_t len = serializeJson(doc, statsBuffer, sizeof(statsBuffer));
     
-    // Publish to statistics topic (retained) - use getTopic() helper to respect topic_prefix
-    char statsTopic[64];
-    getTopic("statistics", statsTopic, sizeof(statsTopic));
-    if (!_client.publish(statsTopic, (const uint8_t*)statsBuffer, len, true)) {
+    // Publish to statistics topic (retained, interned)
+    const char* statsTopic = topicFor(TOPIC_STATISTICS);
+    if (!payloadChanged("statistics", statsBuffer, len)) {
+        _publishStats.suppressed++;
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    if (!publishPayload(statsTopic, statsBuffer, len, true)) {
         LOG_W("Failed to publish statistics");
         if (!_client.connected()) {
             _connected = false;
@@ -827,7 +1081,12 @@ void MQTTClient::publishPowerMeter(const PowerMeterReading& reading) {
     // Publish to power topic (retained)
     char powerTopic[64];
     snprintf(powerTopic, sizeof(powerTopic), "brewos/%s/power", _config.ha_device_id);
-    if (!_client.publish(powerTopic, (const uint8_t*)powerBuffer, len, true)) {
+    if (!payloadChanged("power", powerBuffer, len)) {
+        _publishStats.suppressed++;
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    if (!publishPayload(powerTopic, powerBuffer, len, true)) {
         LOG_W("Failed to publish power meter data");
         if (!_client.connected()) {
             _connected = false;
@@ -846,8 +1105,7 @@ void MQTTClient::publishAvailability(bool online) {
         return;
     }
     
-    char availTopic[64];
-    getTopic("availability", availTopic, sizeof(availTopic));
+    const char* availTopic = topicFor(TOPIC_AVAILABILITY);
     const char* msg = online ? "online" : "offline";
     if (!_client.publish(availTopic, (const uint8_t*)msg, strlen(msg), true)) {
         LOG_W("Failed to publish availability: %s", msg);
@@ -882,16 +1140,11 @@ void MQTTClient::publishHomeAssistantDiscovery() {
     LOG_I("Publishing Home Assistant discovery...");
     
     const char* deviceId = _config.ha_device_id;
-    char statusTopic[64];
-    getTopic("status", statusTopic, sizeof(statusTopic));
-    char availTopic[64];
-    getTopic("availability", availTopic, sizeof(availTopic));
-    char commandTopic[64];
-    getTopic("command", commandTopic, sizeof(commandTopic));
-    char powerTopic[64];
-    getTopic("power", powerTopic, sizeof(powerTopic));
-    char shotTopic[64];
-    getTopic("shot", shotTopic, sizeof(shotTopic));
+    const char* statusTopic = topicFor(TOPIC_STATUS);
+    const char* availTopic = topicFor(TOPIC_AVAILABILITY);
+    const char* commandTopic = topicFor(TOPIC_COMMAND);
+    const char* powerTopic = topicFor(TOPIC_POWER);
+    const char* shotTopic = topicFor(TOPIC_SHOT);
     
     // Counter for pacing publishes (prevents network stack saturation)
     int publishCount = 0;
@@ -1299,14 +1552,56 @@ void MQTTClient::publishHomeAssistantDiscovery() {
         delay(50);  // Prevent broker overwhelm
         publishCount++;
     };
-    
+
+    // Helper to remove an entity: HA deletes a discovered entity when its
+    // retained config topic is cleared. Used for capability-gated entities
+    // so a machine-type change (or a relearned handshake) cleans up stale
+    // steam entities instead of leaving them permanently "unavailable"
+    auto removeEntity = [&](const char* component, const char* entityId) {
+        if (connectionLost) return;
+
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+            return;
+        }
+
+        if (!_client.connected()) {
+            connectionLost = true;
+            _connected = false;
+            xSemaphoreGive(_mutex);
+            return;
+        }
+
+        char configTopic[128];
+        snprintf(configTopic, sizeof(configTopic), "homeassistant/%s/brewos_%s/%s/config",
+                 component, deviceId, entityId);
+        _client.publish(configTopic, (const uint8_t*)"", 0, true);
+
+        xSemaphoreGive(_mutex);
+
+        yield();
+        delay(50);
+    };
+
+    // Capability gating: machines without the hardware don't get the
+    // entities. Unknown (pre-handshake) reports the full surface; the
+    // machine type is part of the discovery fingerprint, so the set is
+    // republished once the Pico resolves it
+    uint8_t machineType = runtimeState().get().machine_type;
+    bool hasSteam = machine_has_steam_boiler(machineType);
+    bool hasStrategies = machine_has_separate_steam_heater(machineType);
+
     // ==========================================================================
     // TEMPERATURE SENSORS
     // ==========================================================================
     publishSensor("Brew Temperature", "brew_temp", "{{ value_json.brew_temp }}", "°C", "temperature", "measurement");
-    publishSensor("Steam Temperature", "steam_temp", "{{ value_json.steam_temp }}", "°C", "temperature", "measurement");
     publishSensor("Brew Setpoint", "brew_setpoint", "{{ value_json.brew_setpoint }}", "°C", "temperature", "measurement");
-    publishSensor("Steam Setpoint", "steam_setpoint", "{{ value_json.steam_setpoint }}", "°C", "temperature", "measurement");
+    if (hasSteam) {
+        publishSensor("Steam Temperature", "steam_temp", "{{ value_json.steam_temp }}", "°C", "temperature", "measurement");
+        publishSensor("Steam Setpoint", "steam_setpoint", "{{ value_json.steam_setpoint }}", "°C", "temperature", "measurement");
+    } else {
+        removeEntity("sensor", "steam_temp");
+        removeEntity("sensor", "steam_setpoint");
+    }
     publishSensor("Brew Pressure", "pressure", "{{ value_json.pressure }}", "bar", "pressure", "measurement");
     
     // ==========================================================================
@@ -1321,8 +1616,7 @@ void MQTTClient::publishHomeAssistantDiscovery() {
     // ==========================================================================
     // STATISTICS SENSORS (use statistics topic)
     // ==========================================================================
-    char statisticsTopic[64];
-    getTopic("statistics", statisticsTopic, sizeof(statisticsTopic));
+    const char* statisticsTopic = topicFor(TOPIC_STATISTICS);
     publishSensor("Shots Today", "shots_today", "{{ value_json.shots_today | default(0) }}", "shots", nullptr, "total_increasing", statisticsTopic, "mdi:counter");
     publishSensor("Total Shots", "total_shots", "{{ value_json.total_shots | default(0) }}", "shots", nullptr, "total_increasing", statisticsTopic, "mdi:coffee-maker");
     publishSensor("Energy Today", "energy_today", "{{ value_json.kwh_today | default(0) }}", "kWh", "energy", "total_increasing", statisticsTopic, nullptr);
@@ -1374,10 +1668,14 @@ void MQTTClient::publishHomeAssistantDiscovery() {
                   "{{ value_json.brew_setpoint }}",
                   "{\"cmd\":\"set_temp\",\"boiler\":\"brew\",\"temp\":{{ value }}}");
     
-    publishNumber("Steam Temperature Target", "steam_temp_target", "mdi:thermometer-high",
-                  120.0, 160.0, 1.0, "°C",
-                  "{{ value_json.steam_setpoint }}",
-                  "{\"cmd\":\"set_temp\",\"boiler\":\"steam\",\"temp\":{{ value }}}");
+    if (hasSteam) {
+        publishNumber("Steam Temperature Target", "steam_temp_target", "mdi:thermometer-high",
+                      120.0, 160.0, 1.0, "°C",
+                      "{{ value_json.steam_setpoint }}",
+                      "{\"cmd\":\"set_temp\",\"boiler\":\"steam\",\"temp\":{{ value }}}");
+    } else {
+        removeEntity("number", "steam_temp_target");
+    }
     
     publishNumber("Target Weight", "bbw_target", "mdi:target",
                   18.0, 100.0, 0.5, "g",
@@ -1393,12 +1691,16 @@ void MQTTClient::publishHomeAssistantDiscovery() {
                   "{\"cmd\":\"set_mode\",\"mode\":\"{{ value }}\"}");
     
     // ==========================================================================
-    // SELECT - Heating Strategy
+    // SELECT - Heating Strategy (only meaningful with two heaters to sequence)
     // ==========================================================================
-    publishSelect("Heating Strategy", "heating_strategy", "mdi:fire",
-                  {"brew_only", "sequential", "parallel", "smart_stagger"},
-                  "{% set strategies = ['brew_only', 'sequential', 'parallel', 'smart_stagger'] %}{{ strategies[value_json.heating_strategy | int] | default('sequential') }}",
-                  "{% set strategies = {'brew_only': 0, 'sequential': 1, 'parallel': 2, 'smart_stagger': 3} %}{\"cmd\":\"set_heating_strategy\",\"strategy\":{{ strategies[value] | default(1) }}}");
+    if (hasStrategies) {
+        publishSelect("Heating Strategy", "heating_strategy", "mdi:fire",
+                      {"brew_only", "sequential", "parallel", "smart_stagger"},
+                      "{% set strategies = ['brew_only', 'sequential', 'parallel', 'smart_stagger'] %}{{ strategies[value_json.heating_strategy | int] | default('sequential') }}",
+                      "{% set strategies = {'brew_only': 0, 'sequential': 1, 'parallel': 2, 'smart_stagger': 3} %}{\"cmd\":\"set_heating_strategy\",\"strategy\":{{ strategies[value] | default(1) }}}");
+    } else {
+        removeEntity("select", "heating_strategy");
+    }
     
     // Log result (mutex is released per-publish, not held at end)
     if (connectionLost) {
@@ -1406,10 +1708,38 @@ void MQTTClient::publishHomeAssistantDiscovery() {
               publishCount, HA_TOTAL_ENTITY_COUNT);
         _connected = false;
     } else {
-        LOG_I("Home Assistant discovery published (%d entities)", HA_TOTAL_ENTITY_COUNT);
+        LOG_I("Home Assistant discovery published (%d entities)", publishCount);
+        // Remember what we published so the next reconnect can skip the burst
+        // (only after a complete pass - a partial one must be retried)
+        _savedDiscoveryFingerprint = discoveryFingerprint();
+        if (_prefs.begin("mqtt", false)) {
+            _prefs.putUInt("disc_fp", _savedDiscoveryFingerprint);
+            _prefs.end();
+        }
     }
 }
 
+uint32_t MQTTClient::discoveryFingerprint() const {
+    // Everything the discovery payloads are built from: firmware version,
+    // device/topic identity, broker (a different broker has a different
+    // retained store), entity count, the machine type (it gates which
+    // entities exist, and the Pico handshake can resolve it after the
+    // first publish), and the IP baked into configuration_url
+    char buf[192];
+    int n = snprintf(buf, sizeof(buf), "%s|%s|%s|%s|%u|%u|%u|%s",
+                     ESP32_VERSION, _config.ha_device_id, _config.topic_prefix,
+                     _config.broker, _config.port, HA_TOTAL_ENTITY_COUNT,
+                     runtimeState().get().machine_type,
+                     WiFi.localIP().toString().c_str());
+    if (n < 0) {
+        return 0;
+    }
+    if ((size_t)n >= sizeof(buf)) {
+        n = sizeof(buf) - 1;
+    }
+    return payload_hash(buf, (size_t)n);
+}
+
 void MQTTClient::setPowerMeterTopic(const char* topic) {
     if (topic == nullptr || topic[0] == '\0') {
         _powerMeterTopic[0] = '\0';
@@ -1463,43 +1793,41 @@ void MQTTClient::onMessage(char* topicName, byte* payload, unsigned int length)
         return;
     }
     
-    // Parse command
-    char cmdTopicBuf[64];
-    getTopic("command", cmdTopicBuf, sizeof(cmdTopicBuf));
-    
-    if (strcmp(topicName, cmdTopicBuf) == 0) {
+    // Parse command (interned topic - no per-message assembly)
+    if (strcmp(topicName, topicFor(TOPIC_COMMAND)) == 0) {
         LOG_I("Received MQTT command: %s", message);
-        
-        // Parse JSON command to extract cmd name
-        JsonDocument doc;
+
+        // Parse JSON command to extract cmd name. Stack document only - this
+        // runs on the MQTT task (Core 0) where malloc churn has been
+        // implicated in heap fragmentation lockups, so the receive path must
+        // not touch the heap.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<512> doc;
+        #pragma GCC diagnostic pop
         DeserializationError error = deserializeJson(doc, message);
         if (error) {
             LOG_W("Failed to parse MQTT command JSON: %s", error.c_str());
             return;
         }
-        
+
         const char* cmd = doc["cmd"] | "";
-        
-        // Enqueue command for processing on Core 1 (main loop)
+        uint8_t cmdId = internCommand(cmd);
+        if (cmdId == MQTT_CMD_UNKNOWN) {
+            LOG_W("Unknown MQTT command: %s", cmd);
+            return;
+        }
+
+        // Post command for processing on Core 1 (main loop)
         // This ensures thread safety: MQTT task (Core 0) doesn't directly modify
         // state that main loop (Core 1) accesses
-        if (_commandQueue != nullptr) {
-            MQTTCommand mqttCmd;
-            strncpy(mqttCmd.cmd, cmd, sizeof(mqttCmd.cmd) - 1);
-            mqttCmd.cmd[sizeof(mqttCmd.cmd) - 1] = '\0';
-            strncpy(mqttCmd.payload, message, sizeof(mqttCmd.payload) - 1);
-            mqttCmd.payload[sizeof(mqttCmd.payload) - 1] = '\0';
-            
-            // Try to enqueue (non-blocking, drop if queue full)
-            if (xQueueSend(_commandQueue, &mqttCmd, 0) != pdTRUE) {
-                LOG_W("MQTT command queue full, dropping command: %s", cmd);
-            }
-        } else {
-            // Fallback: call callback directly if queue not initialized
+        // The canonical interned name is posted - no caller string is kept
+        if (!CommandRouter::post(CMD_SOURCE_MQTT, MQTT_CMD_NAMES[cmdId], doc)) {
+            // Fallback: call callback directly if the router is down or full
             // This should not happen in normal operation
-            LOG_W("MQTT command queue not initialized, calling callback directly");
+            LOG_W("CommandRouter rejected MQTT command, calling callback directly");
             if (_commandCallback) {
-                _commandCallback(cmd, doc);
+                _commandCallback(MQTT_CMD_NAMES[cmdId], doc);
             }
         }
     }
@@ -1577,7 +1905,8 @@ void MQTTClient::loadConfig() {
     _config.use_tls = _prefs.getBool("use_tls", false);
     _config.ha_discovery = _prefs.getBool("ha_discovery", true);
     _prefs.getString("ha_device_id", _config.ha_device_id, sizeof(_config.ha_device_id));
-    
+    _savedDiscoveryFingerprint = _prefs.getUInt("disc_fp", 0);
+
     _prefs.end();
     
     LOG_D("MQTT config loaded: enabled=%d, broker=%s, port=%d", 
@@ -1,208 +1,197 @@
 #include "msgpack_helper.h"
+#include "psram_pool.h"
 #include <ArduinoJson.h>
 
-// Helper functions (static to this file)
-static bool writeBytes(const uint8_t* data, size_t len, uint8_t* buffer, size_t bufferSize, size_t& offset);
-static bool writeByte(uint8_t byte, uint8_t* buffer, size_t bufferSize, size_t& offset);
-static size_t packValue(JsonVariantConst value, uint8_t* buffer, size_t bufferSize, size_t& offset);
-static size_t packString(const char* str, uint8_t* buffer, size_t bufferSize, size_t& offset);
-static size_t packObject(JsonObjectConst obj, uint8_t* buffer, size_t bufferSize, size_t& offset);
-static size_t packArray(JsonArrayConst arr, uint8_t* buffer, size_t bufferSize, size_t& offset);
+// Helper functions (static to this file). Everything encodes through a
+// msgpack_sink_t so the same pack logic serves both flat buffers and chunk
+// chains; multi-byte fields are emitted big-endian directly instead of
+// swapped in place (in-place fixups don't work across chunk boundaries).
+static bool writeBytes(const uint8_t* data, size_t len, msgpack_sink_t& sink);
+static bool writeByte(uint8_t byte, msgpack_sink_t& sink);
+static size_t packValue(JsonVariantConst value, msgpack_sink_t& sink);
+static size_t packString(const char* str, msgpack_sink_t& sink);
+static size_t packObject(JsonObjectConst obj, msgpack_sink_t& sink);
+static size_t packArray(JsonArrayConst arr, msgpack_sink_t& sink);
 
-static bool writeBytes(const uint8_t* data, size_t len, uint8_t* buffer, size_t bufferSize, size_t& offset) {
-    if (offset + len > bufferSize) {
+static bool writeBytes(const uint8_t* data, size_t len, msgpack_sink_t& sink) {
+    if (sink.chain) {
+        if (!sink.chain->append(data, len)) {
+            return false;
+        }
+        sink.offset += len;
+        return true;
+    }
+    if (sink.offset + len > sink.size) {
         return false;
     }
-    memcpy(buffer + offset, data, len);
-    offset += len;
+    memcpy(sink.buffer + sink.offset, data, len);
+    sink.offset += len;
     return true;
 }
 
-static bool writeByte(uint8_t byte, uint8_t* buffer, size_t bufferSize, size_t& offset) {
-    if (offset >= bufferSize) {
+static bool writeByte(uint8_t byte, msgpack_sink_t& sink) {
+    return writeBytes(&byte, 1, sink);
+}
+
+// Rewrite already-written bytes (map16 count back-patching)
+static bool patchBytes(size_t at, const uint8_t* data, size_t len, msgpack_sink_t& sink) {
+    if (sink.chain) {
+        return sink.chain->patch(at, data, len);
+    }
+    if (at + len > sink.offset) {
         return false;
     }
-    buffer[offset++] = byte;
+    memcpy(sink.buffer + at, data, len);
     return true;
 }
 
-static size_t packString(const char* str, uint8_t* buffer, size_t bufferSize, size_t& offset) {
+static bool writeBE16(uint16_t v, msgpack_sink_t& sink) {
+    uint8_t b[2] = { (uint8_t)(v >> 8), (uint8_t)(v & 0xFF) };
+    return writeBytes(b, 2, sink);
+}
+
+static bool writeBE32(uint32_t v, msgpack_sink_t& sink) {
+    uint8_t b[4] = { (uint8_t)(v >> 24), (uint8_t)(v >> 16),
+                     (uint8_t)(v >> 8), (uint8_t)(v & 0xFF) };
+    return writeBytes(b, 4, sink);
+}
+
+static bool writeBE64(uint64_t v, msgpack_sink_t& sink) {
+    uint8_t b[8];
+    for (int i = 0; i < 8; i++) {
+        b[i] = (uint8_t)(v >> (56 - i * 8));
+    }
+    return writeBytes(b, 8, sink);
+}
+
+static size_t packString(const char* str, msgpack_sink_t& sink) {
     if (!str) {
-        return writeByte(0xC0, buffer, bufferSize, offset) ? 1 : 0; // nil
+        return writeByte(0xC0, sink) ? 1 : 0; // nil
     }
-    
+
     size_t len = strlen(str);
-    size_t startOffset = offset;
-    
+    size_t startOffset = sink.offset;
+
     if (len <= 31) {
         // Fixstr: 0xA0-0xBF
-        if (!writeByte(0xA0 | len, buffer, bufferSize, offset)) return 0;
+        if (!writeByte(0xA0 | len, sink)) return 0;
     } else if (len <= 255) {
         // Str8: 0xD9
-        if (!writeByte(0xD9, buffer, bufferSize, offset)) return 0;
-        if (!writeByte(len & 0xFF, buffer, bufferSize, offset)) return 0;
+        if (!writeByte(0xD9, sink)) return 0;
+        if (!writeByte(len & 0xFF, sink)) return 0;
     } else if (len <= 65535) {
         // Str16: 0xDA
-        if (!writeByte(0xDA, buffer, bufferSize, offset)) return 0;
-        if (!writeBytes((uint8_t*)&len, 2, buffer, bufferSize, offset)) return 0;
-        // Swap bytes for big-endian (MessagePack uses big-endian)
-        uint8_t* lenPtr = buffer + offset - 2;
-        uint8_t tmp = lenPtr[0];
-        lenPtr[0] = lenPtr[1];
-        lenPtr[1] = tmp;
+        if (!writeByte(0xDA, sink)) return 0;
+        if (!writeBE16(len, sink)) return 0;
     } else {
         // Str32: 0xDB
-        if (!writeByte(0xDB, buffer, bufferSize, offset)) return 0;
-        uint32_t len32 = len;
-        if (!writeBytes((uint8_t*)&len32, 4, buffer, bufferSize, offset)) return 0;
-        // Swap bytes for big-endian
-        uint8_t* lenPtr = buffer + offset - 4;
-        for (int i = 0; i < 2; i++) {
-            uint8_t tmp = lenPtr[i];
-            lenPtr[i] = lenPtr[3-i];
-            lenPtr[3-i] = tmp;
-        }
+        if (!writeByte(0xDB, sink)) return 0;
+        if (!writeBE32(len, sink)) return 0;
     }
-    
-    if (!writeBytes((const uint8_t*)str, len, buffer, bufferSize, offset)) return 0;
-    return offset - startOffset;
+
+    if (!writeBytes((const uint8_t*)str, len, sink)) return 0;
+    return sink.offset - startOffset;
 }
 
-static size_t packValue(JsonVariantConst value, uint8_t* buffer, size_t bufferSize, size_t& offset) {
-    size_t startOffset = offset;
-    
+static size_t packValue(JsonVariantConst value, msgpack_sink_t& sink) {
+    size_t startOffset = sink.offset;
+
     if (value.isNull()) {
-        if (!writeByte(0xC0, buffer, bufferSize, offset)) return 0; // nil
+        if (!writeByte(0xC0, sink)) return 0; // nil
         return 1;
     }
-    
+
     if (value.is<bool>()) {
-        if (!writeByte(value.as<bool>() ? 0xC3 : 0xC2, buffer, bufferSize, offset)) return 0;
+        if (!writeByte(value.as<bool>() ? 0xC3 : 0xC2, sink)) return 0;
         return 1;
     }
-    
+
     if (value.is<int>()) {
         int32_t v = value.as<int32_t>();
         if (v >= 0 && v <= 127) {
             // Positive fixint: 0x00-0x7F
-            if (!writeByte(v & 0x7F, buffer, bufferSize, offset)) return 0;
+            if (!writeByte(v & 0x7F, sink)) return 0;
         } else if (v >= -32 && v < 0) {
             // Negative fixint: 0xE0-0xFF
-            if (!writeByte(0xE0 | (v & 0x1F), buffer, bufferSize, offset)) return 0;
+            if (!writeByte(0xE0 | (v & 0x1F), sink)) return 0;
         } else if (v >= -128 && v < 128) {
             // Int8: 0xD0
-            if (!writeByte(0xD0, buffer, bufferSize, offset)) return 0;
-            if (!writeByte(v & 0xFF, buffer, bufferSize, offset)) return 0;
+            if (!writeByte(0xD0, sink)) return 0;
+            if (!writeByte(v & 0xFF, sink)) return 0;
         } else if (v >= -32768 && v < 32768) {
             // Int16: 0xD1
-            if (!writeByte(0xD1, buffer, bufferSize, offset)) return 0;
-            int16_t v16 = v;
-            if (!writeBytes((uint8_t*)&v16, 2, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap
-            uint8_t* vPtr = buffer + offset - 2;
-            uint8_t tmp = vPtr[0];
-            vPtr[0] = vPtr[1];
-            vPtr[1] = tmp;
+            if (!writeByte(0xD1, sink)) return 0;
+            if (!writeBE16((uint16_t)(int16_t)v, sink)) return 0;
         } else {
             // Int32: 0xD2
-            if (!writeByte(0xD2, buffer, bufferSize, offset)) return 0;
-            if (!writeBytes((uint8_t*)&v, 4, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap
-            uint8_t* vPtr = buffer + offset - 4;
-            for (int i = 0; i < 2; i++) {
-                uint8_t tmp = vPtr[i];
-                vPtr[i] = vPtr[3-i];
-                vPtr[3-i] = tmp;
-            }
+            if (!writeByte(0xD2, sink)) return 0;
+            if (!writeBE32((uint32_t)v, sink)) return 0;
         }
-        return offset - startOffset;
+        return sink.offset - startOffset;
     }
-    
+
     if (value.is<unsigned int>() || value.is<uint32_t>()) {
         uint32_t v = value.as<uint32_t>();
         if (v <= 127) {
             // Positive fixint
-            if (!writeByte(v & 0x7F, buffer, bufferSize, offset)) return 0;
+            if (!writeByte(v & 0x7F, sink)) return 0;
         } else if (v <= 255) {
             // Uint8: 0xCC
-            if (!writeByte(0xCC, buffer, bufferSize, offset)) return 0;
-            if (!writeByte(v & 0xFF, buffer, bufferSize, offset)) return 0;
+            if (!writeByte(0xCC, sink)) return 0;
+            if (!writeByte(v & 0xFF, sink)) return 0;
         } else if (v <= 65535) {
             // Uint16: 0xCD
-            if (!writeByte(0xCD, buffer, bufferSize, offset)) return 0;
-            uint16_t v16 = v;
-            if (!writeBytes((uint8_t*)&v16, 2, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap
-            uint8_t* vPtr = buffer + offset - 2;
-            uint8_t tmp = vPtr[0];
-            vPtr[0] = vPtr[1];
-            vPtr[1] = tmp;
+            if (!writeByte(0xCD, sink)) return 0;
+            if (!writeBE16(v, sink)) return 0;
         } else {
             // Uint32: 0xCE
-            if (!writeByte(0xCE, buffer, bufferSize, offset)) return 0;
-            if (!writeBytes((uint8_t*)&v, 4, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap
-            uint8_t* vPtr = buffer + offset - 4;
-            for (int i = 0; i < 2; i++) {
-                uint8_t tmp = vPtr[i];
-                vPtr[i] = vPtr[3-i];
-                vPtr[3-i] = tmp;
-            }
+            if (!writeByte(0xCE, sink)) return 0;
+            if (!writeBE32(v, sink)) return 0;
         }
-        return offset - startOffset;
+        return sink.offset - startOffset;
     }
-    
+
     if (value.is<float>() || value.is<double>()) {
         double v = value.as<double>();
         // Use float32 if value fits, otherwise float64
         float f = (float)v;
         if (f == v && f >= -3.4028235e38 && f <= 3.4028235e38) {
             // Float32: 0xCA
-            if (!writeByte(0xCA, buffer, bufferSize, offset)) return 0;
-            if (!writeBytes((uint8_t*)&f, 4, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap for float
-            uint8_t* fPtr = buffer + offset - 4;
-            for (int i = 0; i < 2; i++) {
-                uint8_t tmp = fPtr[i];
-                fPtr[i] = fPtr[3-i];
-                fPtr[3-i] = tmp;
-            }
+            uint32_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            if (!writeByte(0xCA, sink)) return 0;
+            if (!writeBE32(bits, sink)) return 0;
         } else {
             // Float64: 0xCB
-            if (!writeByte(0xCB, buffer, bufferSize, offset)) return 0;
-            if (!writeBytes((uint8_t*)&v, 8, buffer, bufferSize, offset)) return 0;
-            // Big-endian swap for double
-            uint8_t* dPtr = buffer + offset - 8;
-            for (int i = 0; i < 4; i++) {
-                uint8_t tmp = dPtr[i];
-                dPtr[i] = dPtr[7-i];
-                dPtr[7-i] = tmp;
-            }
+            uint64_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            if (!writeByte(0xCB, sink)) return 0;
+            if (!writeBE64(bits, sink)) return 0;
         }
-        return offset - startOffset;
+        return sink.offset - startOffset;
     }
-    
+
     if (value.is<const char*>() || value.is<String>()) {
         const char* str = value.as<const char*>();
-        return packString(str, buffer, bufferSize, offset);
+        return packString(str, sink);
     }
-    
+
     if (value.is<JsonObjectConst>()) {
-        return packObject(value.as<JsonObjectConst>(), buffer, bufferSize, offset);
+        return packObject(value.as<JsonObjectConst>(), sink);
     }
-    
+
     if (value.is<JsonArrayConst>()) {
-        return packArray(value.as<JsonArrayConst>(), buffer, bufferSize, offset);
+        return packArray(value.as<JsonArrayConst>(), sink);
     }
-    
+
     // Fallback: convert to string
     String str = value.as<String>();
-    return packString(str.c_str(), buffer, bufferSize, offset);
+    return packString(str.c_str(), sink);
 }
 
-static size_t packObject(JsonObjectConst obj, uint8_t* buffer, size_t bufferSize, size_t& offset) {
-    size_t startOffset = offset;
-    
+static size_t packObject(JsonObjectConst obj, msgpack_sink_t& sink) {
+    size_t startOffset = sink.offset;
+
     // Count non-null pairs
     size_t count = 0;
     for (JsonPairConst pair : obj) {
@@ -210,117 +199,369 @@ static size_t packObject(JsonObjectConst obj, uint8_t* buffer, size_t bufferSize
             count++;
         }
     }
-    
+
     // Write map header
     if (count <= 15) {
         // Fixmap: 0x80-0x8F
-        if (!writeByte(0x80 | count, buffer, bufferSize, offset)) return 0;
+        if (!writeByte(0x80 | count, sink)) return 0;
     } else if (count <= 65535) {
         // Map16: 0xDE
-        if (!writeByte(0xDE, buffer, bufferSize, offset)) return 0;
-        uint16_t count16 = count;
-        if (!writeBytes((uint8_t*)&count16, 2, buffer, bufferSize, offset)) return 0;
-        // Big-endian swap
-        uint8_t* countPtr = buffer + offset - 2;
-        uint8_t tmp = countPtr[0];
-        countPtr[0] = countPtr[1];
-        countPtr[1] = tmp;
+        if (!writeByte(0xDE, sink)) return 0;
+        if (!writeBE16(count, sink)) return 0;
     } else {
         // Map32: 0xDF
-        if (!writeByte(0xDF, buffer, bufferSize, offset)) return 0;
-        uint32_t count32 = count;
-        if (!writeBytes((uint8_t*)&count32, 4, buffer, bufferSize, offset)) return 0;
-        // Big-endian swap
-        uint8_t* countPtr = buffer + offset - 4;
-        for (int i = 0; i < 2; i++) {
-            uint8_t tmp = countPtr[i];
-            countPtr[i] = countPtr[3-i];
-            countPtr[3-i] = tmp;
-        }
+        if (!writeByte(0xDF, sink)) return 0;
+        if (!writeBE32(count, sink)) return 0;
     }
-    
+
     // Write key-value pairs
     for (JsonPairConst pair : obj) {
         if (!pair.value().isNull()) {
             // Pack key
-            if (!packString(pair.key().c_str(), buffer, bufferSize, offset)) return 0;
+            if (!packString(pair.key().c_str(), sink)) return 0;
             // Pack value
-            if (!packValue(pair.value(), buffer, bufferSize, offset)) return 0;
+            if (!packValue(pair.value(), sink)) return 0;
         }
     }
-    
-    return offset - startOffset;
+
+    return sink.offset - startOffset;
 }
 
-static size_t packArray(JsonArrayConst arr, uint8_t* buffer, size_t bufferSize, size_t& offset) {
-    size_t startOffset = offset;
+static size_t packArray(JsonArrayConst arr, msgpack_sink_t& sink) {
+    size_t startOffset = sink.offset;
     size_t count = arr.size();
-    
+
     // Write array header
     if (count <= 15) {
         // Fixarray: 0x90-0x9F
-        if (!writeByte(0x90 | count, buffer, bufferSize, offset)) return 0;
+        if (!writeByte(0x90 | count, sink)) return 0;
     } else if (count <= 65535) {
         // Array16: 0xDC
-        if (!writeByte(0xDC, buffer, bufferSize, offset)) return 0;
-        uint16_t count16 = count;
-        if (!writeBytes((uint8_t*)&count16, 2, buffer, bufferSize, offset)) return 0;
-        // Big-endian swap
-        uint8_t* countPtr = buffer + offset - 2;
-        uint8_t tmp = countPtr[0];
-        countPtr[0] = countPtr[1];
-        countPtr[1] = tmp;
+        if (!writeByte(0xDC, sink)) return 0;
+        if (!writeBE16(count, sink)) return 0;
     } else {
         // Array32: 0xDD
-        if (!writeByte(0xDD, buffer, bufferSize, offset)) return 0;
-        uint32_t count32 = count;
-        if (!writeBytes((uint8_t*)&count32, 4, buffer, bufferSize, offset)) return 0;
-        // Big-endian swap
-        uint8_t* countPtr = buffer + offset - 4;
-        for (int i = 0; i < 2; i++) {
-            uint8_t tmp = countPtr[i];
-            countPtr[i] = countPtr[3-i];
-            countPtr[3-i] = tmp;
-        }
+        if (!writeByte(0xDD, sink)) return 0;
+        if (!writeBE32(count, sink)) return 0;
     }
-    
+
     // Write array elements
     for (JsonVariantConst value : arr) {
-        if (!packValue(value, buffer, bufferSize, offset)) return 0;
+        if (!packValue(value, sink)) return 0;
     }
-    
-    return offset - startOffset;
+
+    return sink.offset - startOffset;
 }
 
-size_t MessagePackHelper::serialize(const JsonDocument& doc, uint8_t* buffer, size_t bufferSize) {
-    if (!buffer || bufferSize == 0) {
-        return 0;
-    }
-    
-    size_t offset = 0;
-    
+static size_t serializeToSink(const JsonDocument& doc, msgpack_sink_t& sink) {
     // ArduinoJson v7: JsonDocument can be accessed as JsonVariantConst
     // We need to check the type and handle accordingly
     JsonVariantConst variant = doc.as<JsonVariantConst>();
-    
+
     if (variant.is<JsonObjectConst>()) {
         JsonObjectConst obj = variant.as<JsonObjectConst>();
-        size_t written = packObject(obj, buffer, bufferSize, offset);
-        return written > 0 ? offset : 0;
+        size_t written = packObject(obj, sink);
+        return written > 0 ? sink.offset : 0;
     } else if (variant.is<JsonArrayConst>()) {
         JsonArrayConst arr = variant.as<JsonArrayConst>();
-        size_t written = packArray(arr, buffer, bufferSize, offset);
-        return written > 0 ? offset : 0;
+        size_t written = packArray(arr, sink);
+        return written > 0 ? sink.offset : 0;
     } else {
         // Single value
-        size_t written = packValue(variant, buffer, bufferSize, offset);
-        return written > 0 ? offset : 0;
+        size_t written = packValue(variant, sink);
+        return written > 0 ? sink.offset : 0;
     }
 }
 
+size_t MessagePackHelper::serialize(const JsonDocument& doc, uint8_t* buffer, size_t bufferSize) {
+    if (!buffer || bufferSize == 0) {
+        return 0;
+    }
+
+    msgpack_sink_t sink = { buffer, bufferSize, 0, nullptr };
+    return serializeToSink(doc, sink);
+}
+
+size_t MessagePackHelper::serialize(const JsonDocument& doc, MsgPackChain& chain) {
+    chain.reset();
+    msgpack_sink_t sink = { nullptr, 0, 0, &chain };
+    size_t written = serializeToSink(doc, sink);
+    if (written == 0) {
+        chain.reset();  // Don't leave a half-encoded frame behind
+    }
+    return written;
+}
+
 size_t MessagePackHelper::estimateSize(const JsonDocument& doc) {
     // Rough estimate: MessagePack is typically 50-60% of JSON size
     size_t jsonSize = measureJson(doc);
     return (jsonSize * 55) / 100; // 55% of JSON size (conservative)
 }
 
+// =============================================================================
+// MsgPackChain - chunked output backing store
+// =============================================================================
+
+MsgPackChain::MsgPackChain()
+    : _head(nullptr)
+    , _tail(nullptr)
+    , _length(0)
+    , _error(false) {
+}
+
+MsgPackChain::~MsgPackChain() {
+    Chunk* c = _head;
+    while (c) {
+        Chunk* next = c->next;
+        PsramPool::instance().release(c);
+        c = next;
+    }
+}
+
+void MsgPackChain::reset() {
+    for (Chunk* c = _head; c; c = c->next) {
+        c->used = 0;
+    }
+    _tail = _head;
+    _length = 0;
+    _error = false;
+}
+
+MsgPackChain::Chunk* MsgPackChain::grow() {
+    // Reuse a chunk left over from an earlier, larger frame before asking
+    // the pool for a new one
+    if (_tail && _tail->next) {
+        _tail = _tail->next;
+        return _tail;
+    }
+    Chunk* c = (Chunk*)PsramPool::instance().allocate(CHUNK_SIZE, "msgpack");
+    if (!c) {
+        return nullptr;
+    }
+    c->next = nullptr;
+    c->used = 0;
+    if (_tail) {
+        _tail->next = c;
+    } else {
+        _head = c;
+    }
+    _tail = c;
+    return c;
+}
+
+bool MsgPackChain::append(const uint8_t* bytes, size_t len) {
+    if (_error) {
+        return false;
+    }
+    while (len > 0) {
+        Chunk* c = _tail;
+        if (!c || c->used == chunkCapacity()) {
+            c = grow();
+            if (!c) {
+                _error = true;
+                return false;
+            }
+        }
+        size_t n = chunkCapacity() - c->used;
+        if (n > len) n = len;
+        memcpy(c->data() + c->used, bytes, n);
+        c->used += n;
+        _length += n;
+        bytes += n;
+        len -= n;
+    }
+    return true;
+}
+
+bool MsgPackChain::patch(size_t offset, const uint8_t* bytes, size_t len) {
+    if (_error || offset + len > _length) {
+        return false;
+    }
+    Chunk* c = _head;
+    while (c && offset >= c->used) {
+        offset -= c->used;
+        c = c->next;
+    }
+    while (c && len > 0) {
+        size_t n = c->used - offset;
+        if (n > len) n = len;
+        memcpy(c->data() + offset, bytes, n);
+        bytes += n;
+        len -= n;
+        offset = 0;
+        c = c->next;
+    }
+    return len == 0;
+}
+
+size_t MsgPackChain::gather(uint8_t* out, size_t cap) const {
+    if (_error || _length == 0 || !out || cap < _length) {
+        return 0;
+    }
+    size_t off = 0;
+    for (const Chunk* c = _head; c && off < _length; c = c->next) {
+        memcpy(out + off, c->data(), c->used);
+        off += c->used;
+    }
+    return _length;
+}
+
+// =============================================================================
+// MsgPackWriter - incremental writer (no intermediate JsonDocument)
+// =============================================================================
+
+MsgPackWriter::MsgPackWriter(uint8_t* buffer, size_t bufferSize)
+    : _sink{ buffer, bufferSize, 0, nullptr }
+    , _error(buffer == nullptr || bufferSize == 0)
+    , _depth(0) {
+}
+
+MsgPackWriter::MsgPackWriter(MsgPackChain& chain)
+    : _sink{ nullptr, 0, 0, &chain }
+    , _error(false)
+    , _depth(0) {
+    chain.reset();
+}
+
+void MsgPackWriter::beginMap() {
+    if (_error || _depth >= MAX_DEPTH) {
+        _error = true;
+        return;
+    }
+    // Always map16 - 3 bytes of header lets the pair count be patched later,
+    // which is what makes skip-if-unchanged sections possible
+    if (!writeByte(0xDE, _sink)) { _error = true; return; }
+    _maps[_depth].patchOffset = _sink.offset;
+    _maps[_depth].pairs = 0;
+    _depth++;
+    if (!writeByte(0, _sink) ||
+        !writeByte(0, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::endMap() {
+    if (_error || _depth == 0) {
+        _error = true;
+        return;
+    }
+    _depth--;
+    // Patch the pair count (big-endian)
+    uint16_t pairs = _maps[_depth].pairs;
+    uint8_t be[2] = { (uint8_t)(pairs >> 8), (uint8_t)(pairs & 0xFF) };
+    if (!patchBytes(_maps[_depth].patchOffset, be, 2, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::beginArray(uint16_t count) {
+    if (_error) return;
+    // Fixed count, so no patching needed - fixarray when it fits, else array16
+    bool ok;
+    if (count <= 15) {
+        ok = writeByte(0x90 | count, _sink);
+    } else {
+        ok = writeByte(0xDC, _sink) &&
+             writeBE16(count, _sink);
+    }
+    if (!ok) _error = true;
+}
+
+void MsgPackWriter::key(const char* k) {
+    if (_error || _depth == 0) {
+        _error = true;
+        return;
+    }
+    _maps[_depth - 1].pairs++;
+    if (!packString(k, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::writeStr(const char* v) {
+    if (_error) return;
+    if (!packString(v, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::writeBool(bool v) {
+    if (_error) return;
+    if (!writeByte(v ? 0xC3 : 0xC2, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::writeNil() {
+    if (_error) return;
+    if (!writeByte(0xC0, _sink)) {
+        _error = true;
+    }
+}
+
+void MsgPackWriter::writeUint(uint32_t v) {
+    if (_error) return;
+    bool ok;
+    if (v <= 127) {
+        ok = writeByte(v & 0x7F, _sink);          // Positive fixint
+    } else if (v <= 255) {
+        ok = writeByte(0xCC, _sink) &&            // Uint8
+             writeByte(v & 0xFF, _sink);
+    } else if (v <= 65535) {
+        ok = writeByte(0xCD, _sink) &&            // Uint16
+             writeBE16(v, _sink);
+    } else {
+        ok = writeByte(0xCE, _sink) &&            // Uint32
+             writeBE32(v, _sink);
+    }
+    if (!ok) _error = true;
+}
+
+void MsgPackWriter::writeInt(int32_t v) {
+    if (_error) return;
+    if (v >= 0) {
+        writeUint((uint32_t)v);
+        return;
+    }
+    bool ok;
+    if (v >= -32) {
+        ok = writeByte(0xE0 | (v & 0x1F), _sink); // Negative fixint
+    } else if (v >= -128) {
+        ok = writeByte(0xD0, _sink) &&            // Int8
+             writeByte(v & 0xFF, _sink);
+    } else if (v >= -32768) {
+        ok = writeByte(0xD1, _sink) &&            // Int16
+             writeBE16((uint16_t)(int16_t)v, _sink);
+    } else {
+        ok = writeByte(0xD2, _sink) &&            // Int32
+             writeBE32((uint32_t)v, _sink);
+    }
+    if (!ok) _error = true;
+}
+
+void MsgPackWriter::writeFloat(float v) {
+    if (_error) return;
+    // Float32: 0xCA, big-endian
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bool ok = writeByte(0xCA, _sink) &&
+              writeBE32(bits, _sink);
+    if (!ok) _error = true;
+}
+
+void MsgPackWriter::writeDouble(double v) {
+    if (_error) return;
+    // Float64: 0xCB, big-endian
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bool ok = writeByte(0xCB, _sink) &&
+              writeBE64(bits, _sink);
+    if (!ok) _error = true;
+}
+
+size_t MsgPackWriter::finish() {
+    if (_error || _depth != 0) {
+        return 0;
+    }
+    return _sink.offset;
+}
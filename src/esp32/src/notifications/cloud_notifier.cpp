@@ -9,9 +9,9 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 
-void sendNotificationToCloud(const String& cloudUrl, const String& deviceId, const String& deviceKey, const Notification& notif) {
+bool sendNotificationToCloud(const String& cloudUrl, const String& deviceId, const String& deviceKey, const Notification& notif) {
     if (cloudUrl.isEmpty() || deviceId.isEmpty() || !WiFi.isConnected()) {
-        return;
+        return false;
     }
 
     HTTPClient http;
@@ -65,13 +65,14 @@ void sendNotificationToCloud(const String& cloudUrl, const String& deviceId, con
     serializeJson(doc, body);
     
     int httpCode = http.POST(body);
-    
+
     if (httpCode == 200) {
         Serial.printf("[Cloud] Notification sent: %s\n", typeStr);
     } else {
         Serial.printf("[Cloud] Failed to send notification: %d\n", httpCode);
     }
-    
+
     http.end();
+    return httpCode == 200;
 }
 
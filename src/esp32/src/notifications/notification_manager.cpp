@@ -10,6 +10,16 @@
 // Global instance - now a pointer, constructed in main.cpp setup()
 NotificationManager* notificationManager = nullptr;
 
+// Cloud push task tuning. Stack sized for HTTPS (TLS handshake happens on
+// this task), priority below the web server so a slow push service can't
+// starve anything interactive.
+#define PUSH_TASK_STACK_SIZE  8192
+#define PUSH_TASK_PRIORITY    1
+#define PUSH_QUEUE_SIZE       8
+#define PUSH_MAX_ATTEMPTS     3
+#define PUSH_RETRY_DELAY_MS   5000
+#define PUSH_EXPIRY_MS        600000  // 10 min - a stale push is worse than none
+
 // =============================================================================
 // Constructor
 // =============================================================================
@@ -40,6 +50,22 @@ NotificationManager::NotificationManager()
 bool NotificationManager::begin() {
     LOG_I("Initializing Notification Manager...");
     loadPreferences();
+
+    // Start the cloud push dispatcher. Core 0 with the other network tasks,
+    // so the blocking HTTPS POST never touches the Arduino loop on Core 1.
+    if (_pushQueue == nullptr) {
+        _pushQueue = xQueueCreate(PUSH_QUEUE_SIZE, sizeof(PendingPush));
+        xTaskCreatePinnedToCore(
+            pushTaskCode,
+            "NotifPush",
+            PUSH_TASK_STACK_SIZE,
+            this,
+            PUSH_TASK_PRIORITY,
+            &_pushTaskHandle,
+            0  // Core 0 (separate from Arduino loop on Core 1)
+        );
+    }
+
     LOG_I("Notifications ready (push=%s, descale=%d days, service=%lu shots)",
           _prefs.push_enabled ? "on" : "off",
           _prefs.descale_days,
@@ -152,6 +178,26 @@ void NotificationManager::backflushDue() {
     addActive(notif);
 }
 
+void NotificationManager::pumpWear(float drift_pct, uint32_t shots) {
+    if (isDuplicate(NotificationType::PUMP_WEAR, getCooldown(NotificationType::PUMP_WEAR))) {
+        return;
+    }
+
+    Notification notif;
+    notif.type = NotificationType::PUMP_WEAR;
+    snprintf(notif.message, NOTIF_MESSAGE_LEN,
+             "Pump signature drifted %+.0f%% from baseline (%lu shots)",
+             drift_pct, (unsigned long)shots);
+    notif.timestamp = time(nullptr);
+    notif.is_alert = false;
+    notif.acknowledged = false;
+    notif.sent_push = false;
+
+    LOG_I("Notification: %s", notif.message);
+    send(notif);
+    addActive(notif);
+}
+
 void NotificationManager::machineError(uint8_t error_code, const char* details) {
     // Alerts have shorter cooldown
     if (isDuplicate(NotificationType::MACHINE_ERROR, getCooldown(NotificationType::MACHINE_ERROR))) {
@@ -372,7 +418,62 @@ void NotificationManager::send(const Notification& notif) {
         }
         
         if (shouldPush) {
-            _onCloud(notif);
+            enqueuePush(notif);
+        }
+    }
+}
+
+void NotificationManager::enqueuePush(const Notification& notif) {
+    if (_pushQueue == nullptr) {
+        return;
+    }
+
+    PendingPush item;
+    item.notif = notif;
+    item.enqueuedAt = millis();
+
+    if (xQueueSend(_pushQueue, &item, 0) != pdTRUE) {
+        // Queue full - the push service has been unreachable for a while.
+        // Drop rather than block the state-change path that got us here.
+        LOG_W("Push queue full, dropping: %s", getNotificationCode(notif.type));
+    }
+}
+
+void NotificationManager::pushTaskCode(void* arg) {
+    static_cast<NotificationManager*>(arg)->runPushTask();
+}
+
+void NotificationManager::runPushTask() {
+    PendingPush item;
+
+    for (;;) {
+        if (xQueueReceive(_pushQueue, &item, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        uint8_t attempts = 0;
+        for (;;) {
+            if ((millis() - item.enqueuedAt) >= PUSH_EXPIRY_MS) {
+                LOG_W("Push expired undelivered: %s", getNotificationCode(item.notif.type));
+                break;
+            }
+
+            // Paused (OTA in progress) - hold the item without burning attempts
+            if (!_enabled) {
+                vTaskDelay(pdMS_TO_TICKS(1000));
+                continue;
+            }
+
+            if (_onCloud == nullptr || _onCloud(item.notif)) {
+                break;  // Delivered (or no cloud channel wired up)
+            }
+
+            if (++attempts >= PUSH_MAX_ATTEMPTS) {
+                LOG_W("Push failed after %d attempts: %s",
+                      attempts, getNotificationCode(item.notif.type));
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(PUSH_RETRY_DELAY_MS));
         }
     }
 }
@@ -439,6 +540,7 @@ uint32_t NotificationManager::getCooldown(NotificationType type) const {
         case NotificationType::DESCALE_DUE:
         case NotificationType::SERVICE_DUE:
         case NotificationType::BACKFLUSH_DUE:
+        case NotificationType::PUMP_WEAR:
             return 86400000;    // 24 hours
             
         // Alerts - shorter cooldown (important)
@@ -20,6 +20,8 @@ PairingManager::PairingManager()
     , _deviceKey("")
     , _currentToken("")
     , _tokenExpiry(0)
+    , _tokenRegistered(false)
+    , _prewarmActive(false)
     , _onPairingSuccess(nullptr)
 {
 }
@@ -120,7 +122,8 @@ String PairingManager::generateRandomToken(size_t length) {
 String PairingManager::generateToken() {
     _currentToken = generateRandomToken(32);
     _tokenExpiry = millis() + TOKEN_VALIDITY_MS;
-    
+    _tokenRegistered = false;  // Cloud hasn't seen this one yet
+
     Serial.printf("[Pairing] Generated new token (expires in %lu ms)\n", TOKEN_VALIDITY_MS);
     
     return _currentToken;
@@ -164,6 +167,51 @@ bool PairingManager::isTokenValid() const {
     return millis() < _tokenExpiry;
 }
 
+bool PairingManager::hasRegisteredToken() const {
+    return _tokenRegistered && isTokenValid();
+}
+
+void PairingManager::prewarmTokenAsync() {
+    if (_prewarmActive || hasRegisteredToken()) {
+        return;  // Already warm or warming
+    }
+    if (_cloudUrl.isEmpty() || !WiFi.isConnected()) {
+        return;  // Nothing to register against yet
+    }
+
+    _prewarmActive = true;
+    TaskHandle_t handle = nullptr;
+    // TLS handshake needs its own generous stack - don't borrow anyone's.
+    // One-shot task; deletes itself after registration.
+    xTaskCreatePinnedToCore(
+        prewarmTask,
+        "PairPrewarm",
+        10240,
+        this,
+        1,
+        &handle,
+        1
+    );
+    if (!handle) {
+        _prewarmActive = false;
+        Serial.println("[Pairing] Failed to create prewarm task");
+    }
+}
+
+void PairingManager::prewarmTask(void* param) {
+    PairingManager* self = (PairingManager*)param;
+
+    if (!self->isTokenValid()) {
+        self->generateToken();
+    }
+    if (self->registerTokenWithCloud()) {
+        Serial.println("[Pairing] Token pre-registered - next QR request is a lookup");
+    }
+
+    self->_prewarmActive = false;
+    vTaskDelete(NULL);
+}
+
 unsigned long PairingManager::getTokenExpiry() const {
     return _tokenExpiry;
 }
@@ -291,6 +339,7 @@ bool PairingManager::registerTokenWithCloud() {
         
         if (httpCode == 200) {
             Serial.println("[Pairing] Token and device key registered with cloud");
+            _tokenRegistered = true;
             return true;
         }
         
@@ -325,5 +374,10 @@ void PairingManager::notifyPairingSuccess(const String& userId) {
     // Clear the token
     _currentToken = "";
     _tokenExpiry = 0;
+    _tokenRegistered = false;
+
+    // Warm the next token in the background - on multi-machine
+    // commissioning days the next QR request comes right away
+    prewarmTokenAsync();
 }
 
@@ -7,6 +7,8 @@
  */
 
 #include "panic_handler.h"
+#include "flight_recorder.h"
+#include "crash_guard.h"
 #include "log_manager.h"
 #include "config.h"
 #include <Arduino.h>
@@ -23,6 +25,17 @@ extern LogManager* g_logManager;
  * This is registered via esp_register_shutdown_handler
  */
 static void panicHandler() {
+    // Mark the shutdown in the flight recorder first - a few RTC-RAM
+    // stores, safe even when the heap or filesystem is wrecked
+    FlightRecorder::recordShutdown((uint8_t)esp_reset_reason(), ESP.getFreeHeap());
+
+    // Breadcrumb for the crash-loop guard: which task was running. Next
+    // boot maps this to a subsystem if the crash counter crosses threshold
+    TaskHandle_t crashTask = xTaskGetCurrentTaskHandle();
+    if (crashTask != nullptr) {
+        CrashGuard::recordCrashTask(pcTaskGetName(crashTask));
+    }
+
     // Try to write to log buffer and save to flash
     // Use direct write (no mutex) since we're in shutdown context
     // Try even if not "enabled" - we might have a buffer allocated
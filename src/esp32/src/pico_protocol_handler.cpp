@@ -3,11 +3,13 @@
 #include "web_server.h"
 #include "state/state_manager.h"
 #include "power_meter/power_meter_manager.h"
+#include "statistics/statistics_manager.h"
 #include "runtime_state.h"
 #include "ui/ui.h"
 #include "config.h"
 #include "log_manager.h"
 #include "../shared/protocol_defs.h"
+#include <stddef.h>  // offsetof (generated delta apply table)
 #include <string.h>
 
 // External references from main.cpp
@@ -49,8 +51,25 @@ void PicoProtocolHandler::handlePacket(const PicoPacket& packet) {
             
         case MSG_STATUS:
             // Parse status packet and update RuntimeState
+            // Full frames are also the baseline for delta reconstruction
+            if (packet.length >= STATUS_PAYLOAD_SIZE) {
+                memcpy(_statusMirror, packet.payload, STATUS_PAYLOAD_SIZE);
+                _statusMirrorValid = true;
+            }
             handleStatus(packet.payload, packet.length);
             break;
+
+        case MSG_STATUS_DELTA:
+            handleStatusDelta(packet.payload, packet.length);
+            break;
+
+        case MSG_CONFIG_SNAPSHOT:
+            handleConfigSnapshot(packet);
+            break;
+
+        case MSG_WARM_STATE:
+            handleWarmState(packet);
+            break;
             
         // MSG_POWER_METER removed (v2.32 - hardware power metering removed, MQTT only)
             
@@ -60,6 +79,9 @@ void PicoProtocolHandler::handlePacket(const PicoPacket& packet) {
         case MSG_DEBUG_RESP:
         case MSG_DIAGNOSTICS:
         case MSG_LOG:
+        case MSG_LOG_COMPACT:
+        case MSG_TRACE:
+        case MSG_JITTER:
             // These are still handled in main.cpp::onPicoPacket()
             // Can be moved here in future refactoring if needed
             break;
@@ -111,18 +133,21 @@ void PicoProtocolHandler::handleHandshake(const PicoPacket& packet) {
     LOG_I("Pico protocol: v%d.%d, capabilities=0x%02X, max_retry=%d, ack_timeout=%dms",
           proto_major, proto_minor, capabilities, max_retry, ack_timeout);
     
-    // Send handshake response
-    uint8_t handshake[6] = {
+    // Send handshake response (includes requested telemetry rates -
+    // the Pico honors them when PROTOCOL_CAP_RATE_NEGOTIATION is set)
+    uint8_t handshake[8] = {
         1,  // protocol_version_major
         1,  // protocol_version_minor
-        0,  // capabilities
+        0x01,  // capabilities: PROTOCOL_CAP_RATE_NEGOTIATION
         3,  // max_retry_count
         (uint8_t)(1000 & 0xFF),      // ack_timeout_ms low byte
-        (uint8_t)((1000 >> 8) & 0xFF) // ack_timeout_ms high byte
+        (uint8_t)((1000 >> 8) & 0xFF), // ack_timeout_ms high byte
+        PICO_STATUS_RATE_IDLE_HZ,    // status rate while idle
+        PICO_STATUS_RATE_ACTIVE_HZ   // status rate while brewing
     };
-    
+
     if (_uart) {
-        if (_uart->sendPacket(MSG_HANDSHAKE, handshake, 6)) {
+        if (_uart->sendPacket(MSG_HANDSHAKE, handshake, 8)) {
             LOG_I("Protocol handshake response sent - protocol v1.1 established");
         } else {
             LOG_W("Failed to send handshake response");
@@ -227,8 +252,10 @@ void PicoProtocolHandler::handleBoot(const PicoPacket& packet) {
     // This is required for Pico to exit STATE_FAULT (0x05) if config is missing
     // But we request it first to see what Pico has stored
     if (_uart) {
-        _uart->sendCommand(MSG_CMD_GET_CONFIG, nullptr, 0);
-        LOG_I("Requested config from Pico (Pico is source of truth)");
+        // Bulk snapshot: whole machine config in one round trip instead of the
+        // chatty per-config_type exchange (matters on reconnect-after-OTA)
+        _uart->requestConfigSnapshot();
+        LOG_I("Requested config snapshot from Pico (Pico is source of truth)");
     }
     
     // Pico is the source of truth for temperature setpoints and eco mode
@@ -255,11 +282,110 @@ void PicoProtocolHandler::handleBoot(const PicoPacket& packet) {
                       enabled ? "enabled" : "disabled", onTimeMs, pauseTimeMs);
             }
         }
+
+        // Re-push the autonomous wake schedule: a rebooted Pico restored
+        // the table from flash but lost its clock anchor, so entries stay
+        // dormant until this push re-anchors the minute-of-week reference
+        uint8_t wakePayload[4 + BrewOS::MAX_SCHEDULES * 4];
+        size_t wakeLen = _state->buildWakeSchedulePayload(wakePayload, sizeof(wakePayload));
+        if (wakeLen > 0 && _uart &&
+            _uart->sendCommand(MSG_CMD_SET_WAKE_SCHEDULE, wakePayload, wakeLen)) {
+            LOG_I("Sent wake schedule to Pico (%d entries)", wakePayload[0]);
+        }
     }
-    
+
     // Hardware power meter Pico commands removed (v2.32 - MQTT only)
 }
 
+void PicoProtocolHandler::handleConfigSnapshot(const PicoPacket& packet) {
+    // config_snapshot_payload_t layout (33 bytes, see src/pico/include/protocol.h):
+    // [0] version, [1-2] brew_sp, [3-4] steam_sp, [5-6] temp_offset,
+    // [7-12] PID kp/ki/kd, [13] strategy, [14] machine_type,
+    // [15-16] voltage, [17-20] max_current (float),
+    // [21] pi_enabled, [22-23] pi_on_ms, [24-25] pi_pause_ms,
+    // [26] eco_enabled, [27-28] eco_temp, [29-30] eco_timeout_min,
+    // [31-32] cleaning_threshold
+    if (packet.length < 33) {
+        LOG_W("Config snapshot too short: %d bytes (expected 33)", packet.length);
+        return;
+    }
+
+    uint8_t version = packet.payload[0];
+    if (version != 1) {
+        LOG_W("Unknown config snapshot version %d - ignoring", version);
+        return;
+    }
+
+    // NOTE: Endianness assumption - memcpy relies on both RP2350 (Pico) and
+    // ESP32-S3 being Little Endian (see handleStatus)
+    int16_t brew_sp_raw, steam_sp_raw;
+    memcpy(&brew_sp_raw, &packet.payload[1], sizeof(int16_t));
+    memcpy(&steam_sp_raw, &packet.payload[3], sizeof(int16_t));
+
+    ui_state_t& state = runtimeState().beginUpdate();
+    state.brew_setpoint = brew_sp_raw / 10.0f;
+    state.steam_setpoint = steam_sp_raw / 10.0f;
+    state.heating_strategy = packet.payload[13];
+    state.machine_type = packet.payload[14];
+    runtimeState().endUpdate();
+
+    uint16_t voltage;
+    float max_current;
+    memcpy(&voltage, &packet.payload[15], sizeof(uint16_t));
+    memcpy(&max_current, &packet.payload[17], sizeof(float));
+
+    LOG_I("Config snapshot applied: brew=%.1fC steam=%.1fC strategy=%d %dV/%.1fA",
+          brew_sp_raw / 10.0f, steam_sp_raw / 10.0f, packet.payload[13], voltage, max_current);
+
+    if (_server) _server->broadcastLog("Config snapshot received from Pico");
+}
+
+void PicoProtocolHandler::handleWarmState(const PicoPacket& packet) {
+    // warm_state_payload_t layout (49 bytes, see src/pico/include/protocol.h):
+    // [0-2] version, [3] machine_type, [4] active_shot, [5] reserved,
+    // [6-9] pico_uptime_ms (uint32_t LE), [10..48] full status_payload_t
+    static constexpr uint8_t WARM_STATE_HEADER_SIZE = 10;
+    if (packet.length < WARM_STATE_HEADER_SIZE + STATUS_PAYLOAD_SIZE) {
+        LOG_W("Warm state too short: %d bytes (expected %d)",
+              packet.length, WARM_STATE_HEADER_SIZE + STATUS_PAYLOAD_SIZE);
+        return;
+    }
+
+    uint8_t ver_major = packet.payload[0];
+    uint8_t ver_minor = packet.payload[1];
+    uint8_t ver_patch = packet.payload[2];
+    uint8_t machineType = packet.payload[3];
+    uint8_t activeShot = packet.payload[4];
+
+    uint32_t picoUptime =
+        (static_cast<uint32_t>(packet.payload[6])      ) |
+        (static_cast<uint32_t>(packet.payload[7]) << 8 ) |
+        (static_cast<uint32_t>(packet.payload[8]) << 16) |
+        (static_cast<uint32_t>(packet.payload[9]) << 24);
+
+    runtimeState().updatePicoConnection(true);
+
+    ui_state_t& warmState = runtimeState().beginUpdate();
+    warmState.machine_type = machineType;
+    runtimeState().endUpdate();
+
+    if (_state) {
+        _state->setPicoVersion(ver_major, ver_minor, ver_patch);
+        _state->setMachineType(machineType);
+    }
+
+    // Embedded status frame is a full keyframe - apply it through the normal
+    // status path and adopt it as the delta reconstruction baseline
+    memcpy(_statusMirror, &packet.payload[WARM_STATE_HEADER_SIZE], STATUS_PAYLOAD_SIZE);
+    _statusMirrorValid = true;
+    handleStatus(&packet.payload[WARM_STATE_HEADER_SIZE], STATUS_PAYLOAD_SIZE);
+
+    LOG_I("Warm state applied: Pico v%d.%d.%d, machine=%d, uptime=%lus%s",
+          ver_major, ver_minor, ver_patch, machineType,
+          (unsigned long)(picoUptime / 1000), activeShot ? " (shot in progress)" : "");
+    if (_server) _server->broadcastLog("Warm state restored from Pico");
+}
+
 void PicoProtocolHandler::updateBackoff(uint32_t now) {
     // Initialize timing on first NACK
     if (_lastNackTime == 0) {
@@ -289,6 +415,54 @@ void PicoProtocolHandler::updateBackoff(uint32_t now) {
     _backoffUntil = now + backoff_ms;
 }
 
+void PicoProtocolHandler::handleStatusDelta(const uint8_t* payload, uint8_t length) {
+    // Payload: uint32 changed-field mask + changed fields in declaration order.
+    // The (offset, size) table is generated from STATUS_FIELD_LIST - the same
+    // schema the Pico builds status_payload_t and its delta table from, so
+    // the two sides cannot drift.
+    static const struct { uint8_t offset; uint8_t size; } fieldTable[] = {
+#define STATUS_FIELD_ENTRY(bit, ftype, name) \
+        { (uint8_t)offsetof(status_payload_t, name), (uint8_t)sizeof(ftype) },
+        STATUS_FIELD_LIST(STATUS_FIELD_ENTRY)
+#undef STATUS_FIELD_ENTRY
+    };
+    static const uint8_t FIELD_COUNT = sizeof(fieldTable) / sizeof(fieldTable[0]);
+    static_assert(sizeof(fieldTable) / sizeof(fieldTable[0]) == STATUS_FIELD_COUNT,
+                  "delta apply table must cover every schema field");
+    static_assert(STATUS_PAYLOAD_SIZE == sizeof(status_payload_t),
+                  "status mirror must match the generated wire struct");
+
+    if (length < 4) return;  // Need at least the mask
+
+    if (!_statusMirrorValid) {
+        // No baseline yet (first packets after boot) - the next keyframe
+        // arrives within the Pico's keyframe interval, just wait for it
+        LOG_D("Status delta before keyframe - dropped");
+        return;
+    }
+
+    // NOTE: Endianness assumption - memcpy relies on both sides being Little
+    // Endian (see handleStatus)
+    uint32_t mask;
+    memcpy(&mask, &payload[0], sizeof(uint32_t));
+
+    uint8_t pos = 4;
+    for (uint8_t bit = 0; bit < FIELD_COUNT; bit++) {
+        if (!(mask & (1u << bit))) continue;
+        if (pos + fieldTable[bit].size > length) {
+            // Truncated delta - don't apply a partial update, wait for keyframe
+            LOG_W("Malformed status delta (mask=0x%05lX len=%d)", (unsigned long)mask, length);
+            _statusMirrorValid = false;
+            return;
+        }
+        memcpy(&_statusMirror[fieldTable[bit].offset], &payload[pos], fieldTable[bit].size);
+        pos += fieldTable[bit].size;
+    }
+
+    // Reconstructed full frame goes through the normal status path
+    handleStatus(_statusMirror, STATUS_PAYLOAD_SIZE);
+}
+
 void PicoProtocolHandler::handleStatus(const uint8_t* payload, uint8_t length) {
     if (length < 18) return;  // Minimum status size (up to water_level)
     
@@ -375,7 +549,45 @@ void PicoProtocolHandler::handleStatus(const uint8_t* payload, uint8_t length) {
         memcpy(&brew_count_raw, &payload[30], sizeof(uint16_t));
         state.brew_count = brew_count_raw;
     }
-    
+
+    // Parse flow rate (offsets 32-33, if available - older Pico firmware
+    // sends 32-byte status frames without it)
+    // NOTE: Endianness assumption (see comment above for temperatures)
+    if (length >= 34) {
+        uint16_t flow_ml_min;
+        memcpy(&flow_ml_min, &payload[32], sizeof(uint16_t));
+        state.flow_rate = flow_ml_min / 60.0f;  // ml/min -> ml/s
+    }
+
+    // Parse shot phase (offsets 34-38, if available - older Pico firmware
+    // sends 34-byte status frames without it)
+    // NOTE: Endianness assumption (see comment above for temperatures)
+    if (length >= 39) {
+        state.brew_phase = payload[34];
+        uint32_t phase_start_raw;
+        memcpy(&phase_start_raw, &payload[35], sizeof(uint32_t));
+        state.phase_start_us = phase_start_raw;
+    }
+
+    // Parse per-boiler energy accumulators (offsets 39-46, if available -
+    // older Pico firmware sends 39-byte status frames without them)
+    // NOTE: Endianness assumption (see comment above for temperatures)
+    if (length >= 47) {
+        uint32_t brew_wh, steam_wh;
+        memcpy(&brew_wh, &payload[39], sizeof(uint32_t));
+        memcpy(&steam_wh, &payload[43], sizeof(uint32_t));
+        state.brew_energy_wh = brew_wh;
+        state.steam_energy_wh = steam_wh;
+    }
+
+    // Feed the duty-integrated power estimate into statistics. This revives
+    // kWh tracking for all machines: it used to depend on the optional
+    // hardware meter (removed v2.32), leaving updatePower() with no caller.
+    Stats.updatePower(state.power_watts,
+                      new_machine_state != UI_STATE_INIT &&
+                      new_machine_state != UI_STATE_IDLE &&
+                      new_machine_state != UI_STATE_SAFE);
+
     // End update transaction - swaps buffers atomically and releases mutex
     runtimeState().endUpdate();
 }
@@ -5,9 +5,16 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <driver/gpio.h>  // For gpio_set_pull_mode()
+#include <soc/gpio_reg.h> // Direct GPIO register access for the bit-bang loop
 
-// 20us = ~25kHz (Safe/Slow)
-#define SWD_BIT_DELAY 20
+// Bit timing. The connect/handshake sequences run at the slow delay (~25kHz)
+// where marginal wiring doesn't matter; once the target has been verified the
+// bulk transfer path (flashFirmware) switches to the fast delay, which with
+// direct register IO lands around 300-500kHz effective.
+#define SWD_BIT_DELAY_SLOW 20
+#define SWD_BIT_DELAY_FAST 1
+static uint8_t g_bit_delay_us = SWD_BIT_DELAY_SLOW;
+static inline void swdBitDelay() { delayMicroseconds(g_bit_delay_us); }
 #define SWD_IDLE_CYCLES 8
 #define SWD_TURNAROUND_CYCLES 1
 #define SWD_TURNAROUND_DELAY_US 5  // Additional delay after turnaround for target to drive line
@@ -56,10 +63,57 @@
 static int g_pin_swdio = -1;
 static int g_pin_swclk = -1;
 
+// Cached GPIO register addresses + masks for the bit-bang loop. digitalWrite/
+// digitalRead burn ~100+ cycles of lookup and safety checks per call, which
+// dominates every SWD bit once the delay is tuned down.
+static uint32_t g_swdio_mask = 0;
+static uint32_t g_swclk_mask = 0;
+static volatile uint32_t* g_swdio_set = nullptr;
+static volatile uint32_t* g_swdio_clr = nullptr;
+static volatile uint32_t* g_swdio_in = nullptr;
+static volatile uint32_t* g_swdio_en_set = nullptr;
+static volatile uint32_t* g_swdio_en_clr = nullptr;
+static volatile uint32_t* g_swclk_set = nullptr;
+static volatile uint32_t* g_swclk_clr = nullptr;
+
+static void setupFastIo() {
+    if (g_pin_swdio < 32) {
+        g_swdio_mask = 1UL << g_pin_swdio;
+        g_swdio_set = (volatile uint32_t*)GPIO_OUT_W1TS_REG;
+        g_swdio_clr = (volatile uint32_t*)GPIO_OUT_W1TC_REG;
+        g_swdio_in = (volatile uint32_t*)GPIO_IN_REG;
+        g_swdio_en_set = (volatile uint32_t*)GPIO_ENABLE_W1TS_REG;
+        g_swdio_en_clr = (volatile uint32_t*)GPIO_ENABLE_W1TC_REG;
+    } else {
+        g_swdio_mask = 1UL << (g_pin_swdio - 32);
+        g_swdio_set = (volatile uint32_t*)GPIO_OUT1_W1TS_REG;
+        g_swdio_clr = (volatile uint32_t*)GPIO_OUT1_W1TC_REG;
+        g_swdio_in = (volatile uint32_t*)GPIO_IN1_REG;
+        g_swdio_en_set = (volatile uint32_t*)GPIO_ENABLE1_W1TS_REG;
+        g_swdio_en_clr = (volatile uint32_t*)GPIO_ENABLE1_W1TC_REG;
+    }
+    if (g_pin_swclk < 32) {
+        g_swclk_mask = 1UL << g_pin_swclk;
+        g_swclk_set = (volatile uint32_t*)GPIO_OUT_W1TS_REG;
+        g_swclk_clr = (volatile uint32_t*)GPIO_OUT_W1TC_REG;
+    } else {
+        g_swclk_mask = 1UL << (g_pin_swclk - 32);
+        g_swclk_set = (volatile uint32_t*)GPIO_OUT1_W1TS_REG;
+        g_swclk_clr = (volatile uint32_t*)GPIO_OUT1_W1TC_REG;
+    }
+}
+
+// SWDIO direction switch without pinMode() - the pin stays configured as GPIO
+// with its pull-up; only the output driver is enabled/disabled. The pull-up
+// is set once in connectToTarget().
+static inline void swdioDirOutput() { *g_swdio_en_set = g_swdio_mask; }
+static inline void swdioDirInput()  { *g_swdio_en_clr = g_swdio_mask; }
+
 PicoSWD::PicoSWD(int swdio, int swclk, int reset)
     : _swdio(swdio), _swclk(swclk), _reset(reset), _connected(false), _lastErrorStr("None") {
     g_pin_swdio = swdio;
     g_pin_swclk = swclk;
+    setupFastIo();
     if (reset >= 0) {
         LOG_D("SWD: PicoSWD initialized - SWDIO=GPIO%d, SWCLK=GPIO%d, RESET=GPIO%d", 
               swdio, swclk, reset);
@@ -110,27 +164,27 @@ const char* PicoSWD::errorToString(swd_error_t error) {
 }
 
 // --- Low Level ---
-void PicoSWD::setSWDIO(bool high) { digitalWrite(g_pin_swdio, high ? HIGH : LOW); }
-void PicoSWD::setSWCLK(bool high) { digitalWrite(g_pin_swclk, high ? HIGH : LOW); }
-bool PicoSWD::readSWDIO() { return digitalRead(g_pin_swdio) == HIGH; }
+void PicoSWD::setSWDIO(bool high) { *(high ? g_swdio_set : g_swdio_clr) = g_swdio_mask; }
+void PicoSWD::setSWCLK(bool high) { *(high ? g_swclk_set : g_swclk_clr) = g_swclk_mask; }
+bool PicoSWD::readSWDIO() { return (*g_swdio_in & g_swdio_mask) != 0; }
 
 void PicoSWD::swdWrite(uint8_t data, uint8_t bits) {
     for (int i = 0; i < bits; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWDIO(data & 1); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWDIO(data & 1); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
         data >>= 1;
     }
     setSWCLK(LOW);
 }
 
 uint8_t PicoSWD::swdRead(uint8_t bits) {
-    // Enable Pull-Up (Crucial for reading ACKs correctly)
-    pinMode(g_pin_swdio, INPUT_PULLUP);
+    // Pull-up is pre-configured in connectToTarget(); just release the driver
+    swdioDirInput();
     uint8_t res = 0;
     for (int i = 0; i < bits; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
         if (readSWDIO()) res |= (1 << i);
         setSWCLK(LOW);
     }
@@ -140,8 +194,8 @@ uint8_t PicoSWD::swdRead(uint8_t bits) {
 void PicoSWD::swdTurnaround() {
     // Just clock the turnaround cycle. 
     // Direction switching is handled by the caller.
-    setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-    setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+    setSWCLK(LOW); swdBitDelay();
+    setSWCLK(HIGH); swdBitDelay();
     setSWCLK(LOW);
 }
 
@@ -149,8 +203,8 @@ void PicoSWD::swdIdle() {
     LOG_D("SWD: Sending %d idle clock cycles", SWD_IDLE_CYCLES);
     setSWDIO(LOW);
     for (int i = 0; i < SWD_IDLE_CYCLES; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
     }
     setSWCLK(LOW);
 }
@@ -161,8 +215,8 @@ void PicoSWD::swdSendIdleClocks(uint8_t count) {
     setSWDIO(LOW);
     portDISABLE_INTERRUPTS();
     for (int i = 0; i < count; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
     }
     setSWCLK(LOW);
     portENABLE_INTERRUPTS();
@@ -172,8 +226,8 @@ void PicoSWD::swdResetSeq() {
     // Helper function for reset sequence (60 clock cycles with SWDIO HIGH)
     setSWDIO(HIGH);
     for (int i = 0; i < 60; i++) { 
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
     }
     setSWCLK(LOW);
 }
@@ -239,8 +293,8 @@ void PicoSWD::sendDormantSequence() {
     LOG_D("SWD: Phase 3 - Activation Code (4 cycles LOW + 0x1A + 8 cycles HIGH)");
     setSWDIO(LOW);
     for (int i = 0; i < 4; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
     }
     setSWCLK(LOW);
     swdWrite(0x1A, 8);  // 0x1A = 00011010 binary (LSB first: 0 1 0 1 1 0 0 0)
@@ -249,8 +303,8 @@ void PicoSWD::sendDormantSequence() {
     // This is required before the line reset per OpenOCD reference
     setSWDIO(HIGH);
     for (int i = 0; i < 8; i++) {
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
+        setSWCLK(HIGH); swdBitDelay();
     }
     setSWCLK(LOW);
     
@@ -281,22 +335,22 @@ swd_error_t PicoSWD::swdWritePacket(uint8_t request, uint32_t data, bool ignoreA
     uint8_t parity = __builtin_parity(header_payload & 0x1E);
     uint8_t header = header_payload | (parity << 5) | 0x80;
 
-    pinMode(g_pin_swdio, OUTPUT);
+    swdioDirOutput();
     swdWrite(header, 8);
-    
+
     // TARGETSEL (0x0C) is special: No ACK, No Turnaround
     bool isTargetSel = (ap_dp == 0) && (addr == 0x03);
-    
+
     if (!isTargetSel) {
         // --- TURNAROUND 1: Host -> Target ---
-        pinMode(g_pin_swdio, INPUT_PULLUP);
+        swdioDirInput();
         swdTurnaround();
-        
+
         uint8_t ack = swdRead(3);
-        
+
         // --- TURNAROUND 2: Target -> Host ---
         swdTurnaround();
-        pinMode(g_pin_swdio, OUTPUT);
+        swdioDirOutput();
 
         if (ack != SWD_ACK_OK && !ignoreAck) {
             if (ack == SWD_ACK_FAULT) {
@@ -326,12 +380,12 @@ swd_error_t PicoSWD::swdReadPacket(uint8_t request, uint32_t *data) {
     uint8_t parity = __builtin_parity(header_payload & 0x1E);
     uint8_t header = header_payload | (parity << 5) | 0x80;
 
-    pinMode(g_pin_swdio, OUTPUT);
+    swdioDirOutput();
     swdWrite(header, 8);
-    
+
     // --- TURNAROUND 1: Host -> Target ---
     // CRITICAL: Switch to INPUT *before* clocking the turnaround
-    pinMode(g_pin_swdio, INPUT_PULLUP); 
+    swdioDirInput();
     swdTurnaround();
     
     // Read ACK (3 bits)
@@ -344,9 +398,9 @@ swd_error_t PicoSWD::swdReadPacket(uint8_t request, uint32_t *data) {
                   ackToString(ack), ack, request);
         
         // Ensure we leave in a known state (OUTPUT) if we bail
-        swdTurnaround(); 
-        pinMode(g_pin_swdio, OUTPUT);
-        
+        swdTurnaround();
+        swdioDirOutput();
+
         return (ack == SWD_ACK_WAIT) ? SWD_ERROR_WAIT : 
                (ack == SWD_ACK_FAULT) ? SWD_ERROR_FAULT : SWD_ERROR_PROTOCOL;
     }
@@ -357,8 +411,8 @@ swd_error_t PicoSWD::swdReadPacket(uint8_t request, uint32_t *data) {
     
     // --- TURNAROUND 2: Target -> Host ---
     swdTurnaround();
-    pinMode(g_pin_swdio, OUTPUT); // Host takes control back
-    
+    swdioDirOutput(); // Host takes control back
+
     if (data) *data = val;
     return SWD_OK;
 }
@@ -436,8 +490,11 @@ swd_error_t PicoSWD::writeAP(uint8_t addr, uint32_t data, uint8_t ap_id) {
 // --- Connection Logic ---
 
 bool PicoSWD::connectToTarget() {
-    pinMode(g_pin_swdio, OUTPUT); 
+    pinMode(g_pin_swdio, OUTPUT);
     pinMode(g_pin_swclk, OUTPUT);
+    // Configure the pull-up once up front; the fast direction switches in the
+    // bit-bang path only toggle the output driver and rely on this staying set.
+    gpio_set_pull_mode((gpio_num_t)g_pin_swdio, GPIO_PULLUP_ONLY);
     if (_reset >= 0) { pinMode(_reset, OUTPUT); digitalWrite(_reset, HIGH); }
 
     // CRITICAL: Verify SWD pins are actually working before attempting connection
@@ -564,12 +621,12 @@ uint8_t PicoSWD::readAckDiagnostic() {
     Serial.print("[DIAG] ACK bits: ");
     for (int i = 0; i < 3; i++) {
         setSWCLK(LOW); 
-        delayMicroseconds(SWD_BIT_DELAY);
+        swdBitDelay();
         bool bit = readSWDIO();
         Serial.print(bit ? "1" : "0");
         if (bit) ack |= (1 << i);
         setSWCLK(HIGH); 
-        delayMicroseconds(SWD_BIT_DELAY);
+        swdBitDelay();
         setSWCLK(LOW);
     }
     Serial.printf(" (0x%X = %s)\n", ack, ackToString(ack));
@@ -636,16 +693,16 @@ bool PicoSWD::diagnoseDevice() {
         // Try to read the IDCODE
         uint32_t idcode = 0;
         for (int i = 0; i < 32; i++) {
-            setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
+            setSWCLK(LOW); swdBitDelay();
             bool bit = readSWDIO();
             if (bit) idcode |= (1 << i);
-            setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+            setSWCLK(HIGH); swdBitDelay();
             setSWCLK(LOW);
         }
         // Read parity
-        setSWCLK(LOW); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(LOW); swdBitDelay();
         bool parity = readSWDIO();
-        setSWCLK(HIGH); delayMicroseconds(SWD_BIT_DELAY);
+        setSWCLK(HIGH); swdBitDelay();
         setSWCLK(LOW);
         
         swdTurnaround();
@@ -791,10 +848,10 @@ bool PicoSWD::diagnoseDevice() {
     uint8_t ack2 = 0;
     for (int i = 0; i < 3; i++) {
         setSWCLK(LOW);
-        delayMicroseconds(SWD_BIT_DELAY);
+        swdBitDelay();
         bool bit_before = digitalRead(g_pin_swdio);
         setSWCLK(HIGH);
-        delayMicroseconds(SWD_BIT_DELAY);
+        swdBitDelay();
         bool bit_after = digitalRead(g_pin_swdio);
         bool bit = bit_after;
         Serial.printf("bit%d=%d(before:%d,after:%d) ", i, bit, bit_before, bit_after);
@@ -1272,6 +1329,90 @@ uint32_t PicoSWD::readWord(uint32_t addr) {
     if (readAP(AP_DRW, &d) != SWD_OK) return 0;
     return d;
 }
+
+// --- Bulk Memory Transfers ---
+// writeWord()/readWord() cost four SWD packets per word (SELECT + TAR +
+// SELECT + DRW). With CSW auto-increment the TAR only needs re-seeding at
+// each 1KB boundary (the AHB-AP only increments TAR[9:0]), so bulk
+// transfers collapse to a single DRW packet per word.
+#define AP_CSW_SINGLE   0x23000002  // PROT=0x23 (required on RP2350), 32-bit, no increment
+#define AP_CSW_AUTOINC  0x23000012  // PROT=0x23, 32-bit, increment single
+
+void PicoSWD::setFastClock(bool fast) {
+    g_bit_delay_us = fast ? SWD_BIT_DELAY_FAST : SWD_BIT_DELAY_SLOW;
+}
+
+bool PicoSWD::writeMemBlock(uint32_t addr, const uint8_t* data, size_t len) {
+    if (len == 0) return true;
+    if ((addr & 0x3) || (len & 0x3)) {
+        LOG_E("SWD: writeMemBlock requires word-aligned addr/len");
+        return false;
+    }
+    // Select the ARM AP once up front - CSW/TAR/DRW all live in bank 0
+    if (writeDP(DP_SELECT, makeDPSelectRP2350(AP_ARM_CORE0, 0, true)) != SWD_OK) return false;
+    if (swdWritePacket(((AP_CSW & 0xF) << 1) | 0x01, AP_CSW_AUTOINC) != SWD_OK) return false;
+
+    bool ok = true;
+    size_t i = 0;
+    uint32_t tar = addr;
+    while (ok && i < len) {
+        // Auto-increment wraps within a 1KB region - re-seed TAR at each boundary
+        if (swdWritePacket(((AP_TAR & 0xF) << 1) | 0x01, tar) != SWD_OK) { ok = false; break; }
+        uint32_t page_end = (tar & ~0x3FFUL) + 0x400;
+        while (i < len && tar < page_end) {
+            uint32_t word = data[i] | (data[i+1] << 8) | (data[i+2] << 16) | ((uint32_t)data[i+3] << 24);
+            if (swdWritePacket(((AP_DRW & 0xF) << 1) | 0x01, word) != SWD_OK) { ok = false; break; }
+            tar += 4;
+            i += 4;
+        }
+        yield();  // Keep the watchdog fed on large transfers
+    }
+
+    // Restore single-transfer CSW so writeWord()/readWord() keep working
+    swdWritePacket(((AP_CSW & 0xF) << 1) | 0x01, AP_CSW_SINGLE);
+    return ok;
+}
+
+bool PicoSWD::readMemBlock(uint32_t addr, uint8_t* data, size_t len) {
+    if (len == 0) return true;
+    if ((addr & 0x3) || (len & 0x3)) {
+        LOG_E("SWD: readMemBlock requires word-aligned addr/len");
+        return false;
+    }
+    if (writeDP(DP_SELECT, makeDPSelectRP2350(AP_ARM_CORE0, 0, true)) != SWD_OK) return false;
+    if (swdWritePacket(((AP_CSW & 0xF) << 1) | 0x01, AP_CSW_AUTOINC) != SWD_OK) return false;
+
+    bool ok = true;
+    size_t i = 0;
+    uint32_t tar = addr;
+    uint32_t word = 0;
+    while (ok && i < len) {
+        if (swdWritePacket(((AP_TAR & 0xF) << 1) | 0x01, tar) != SWD_OK) { ok = false; break; }
+        // AP reads are posted: prime the pipeline with one DRW read, then each
+        // subsequent read returns the previous word. The last posted word is
+        // drained through RDBUFF at the end of each 1KB run.
+        if (swdReadPacket(((AP_DRW & 0xF) << 1) | 0x09, &word) != SWD_OK) { ok = false; break; }
+        uint32_t page_end = (tar & ~0x3FFUL) + 0x400;
+        while (i < len && tar < page_end) {
+            bool last = (i + 4 >= len) || (tar + 4 >= page_end);
+            if (last) {
+                if (readDP(DP_RDBUFF, &word) != SWD_OK) { ok = false; break; }
+            } else {
+                if (swdReadPacket(((AP_DRW & 0xF) << 1) | 0x09, &word) != SWD_OK) { ok = false; break; }
+            }
+            data[i]   = word & 0xFF;
+            data[i+1] = (word >> 8) & 0xFF;
+            data[i+2] = (word >> 16) & 0xFF;
+            data[i+3] = (word >> 24) & 0xFF;
+            tar += 4;
+            i += 4;
+        }
+        yield();
+    }
+
+    swdWritePacket(((AP_CSW & 0xF) << 1) | 0x01, AP_CSW_SINGLE);
+    return ok;
+}
 bool PicoSWD::haltCore() { return writeWord(DHCSR, 0xA05F0003); }
 bool PicoSWD::runCore() { return writeWord(DHCSR, 0xA05F0001); }
 // Core Register Access (ARM Cortex-M via DCRSR/DCRDR)
@@ -1409,72 +1550,126 @@ bool PicoSWD::callRomFunc(uint32_t funcAddr, uint32_t r0, uint32_t r1, uint32_t
     return false;
 }
 
+// CRC32 (polynomial 0xEDB88320) for post-program verification
+static uint32_t swdCrc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (-(int32_t)(crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
 // Flash Firmware (based on OpenOCD rp2xxx.c)
+// The BootROM's flash_range_program *is* the resident flash algorithm, so the
+// bottleneck is getting each 4KB chunk into SRAM. Bulk transfers run at the
+// fast bit clock via writeMemBlock(), and the programmed image is read back
+// through the same path and CRC-checked against the file before we report
+// success.
 bool PicoSWD::flashFirmware(File& firmwareFile, size_t size) {
     if (!_connected) {
         LOG_E("SWD: Not connected");
         return false;
     }
-    
+
     LOG_I("SWD: Flashing firmware (%d bytes)...", size);
-    
+
     // Find Boot ROM functions
     uint32_t flash_range_erase = findRomFunc('R', 'E');
     uint32_t flash_range_program = findRomFunc('R', 'P');
-    
+
     if (flash_range_erase == 0 || flash_range_program == 0) {
         LOG_E("SWD: ROM functions not found");
         return false;
     }
-    
+
     if (!haltCore()) return false;
-    
+
     uint32_t flash_addr = 0x10000000;
     uint32_t ram_addr = 0x20004000;
-    
+
+    // Connection is verified at this point - switch to the fast bit clock for
+    // the bulk transfer phase. Restored on every exit path below.
+    setFastClock(true);
+    bool ok = true;
+
     // Erase flash
     LOG_I("SWD: Erasing flash...");
     if (!callRomFunc(flash_range_erase, flash_addr, size, 0, 0)) {
         LOG_E("SWD: Erase failed");
-        return false;
+        ok = false;
     }
-    
+
     // Program in chunks
     const size_t chunk_size = 4096;
     uint8_t buffer[chunk_size];
     size_t offset = 0;
-    
-    LOG_I("SWD: Programming flash...");
-    while (offset < size) {
+    uint32_t file_crc = 0;
+
+    if (ok) LOG_I("SWD: Programming flash...");
+    while (ok && offset < size) {
         size_t chunk = (size - offset > chunk_size) ? chunk_size : (size - offset);
         size_t bytes_read = firmwareFile.read(buffer, chunk);
         if (bytes_read != chunk) {
             LOG_E("SWD: Read failed");
-            return false;
+            ok = false;
+            break;
         }
-        
+        file_crc = swdCrc32Update(file_crc, buffer, chunk);
+
+        // Pad the tail to a word boundary for the block transfer
+        size_t chunk_padded = (chunk + 3) & ~(size_t)3;
+        for (size_t i = chunk; i < chunk_padded; i++) buffer[i] = 0xFF;
+
         // Write to RAM
-        for (size_t i = 0; i < chunk; i += 4) {
-            uint32_t word = buffer[i] | (buffer[i+1] << 8) | (buffer[i+2] << 16) | (buffer[i+3] << 24);
-            if (!writeWord(ram_addr + i, word)) {
-                LOG_E("SWD: RAM write failed");
-                return false;
-            }
+        if (!writeMemBlock(ram_addr, buffer, chunk_padded)) {
+            LOG_E("SWD: RAM write failed");
+            ok = false;
+            break;
         }
-        
+
         // Program from RAM to Flash
         if (!callRomFunc(flash_range_program, flash_addr + offset, ram_addr, chunk, 0)) {
             LOG_E("SWD: Program failed");
-            return false;
+            ok = false;
+            break;
         }
-        
+
         offset += chunk;
         LOG_I("SWD: Progress: %d/%d (%.1f%%)", offset, size, (offset * 100.0f) / size);
     }
-    
-    LOG_I("SWD: Flash complete!");
-    return true;
-} 
+
+    // Verify: read the programmed image back through the XIP window and
+    // compare CRCs. Catches dropped words that a clean ACK stream wouldn't.
+    if (ok) {
+        LOG_I("SWD: Verifying flash...");
+        uint32_t flash_crc = 0;
+        size_t verified = 0;
+        while (ok && verified < size) {
+            size_t chunk = (size - verified > chunk_size) ? chunk_size : (size - verified);
+            size_t chunk_padded = (chunk + 3) & ~(size_t)3;
+            if (!readMemBlock(flash_addr + verified, buffer, chunk_padded)) {
+                LOG_E("SWD: Verify readback failed at offset %d", verified);
+                ok = false;
+                break;
+            }
+            flash_crc = swdCrc32Update(flash_crc, buffer, chunk);
+            verified += chunk;
+        }
+        if (ok && flash_crc != file_crc) {
+            LOG_E("SWD: Verify FAILED - flash CRC 0x%08X != file CRC 0x%08X", flash_crc, file_crc);
+            ok = false;
+        }
+    }
+
+    setFastClock(false);
+    if (ok) {
+        LOG_I("SWD: Flash complete and verified (CRC 0x%08X)", file_crc);
+    }
+    return ok;
+}
 bool PicoSWD::resumeFromHalt() {
     if (!_connected) {
         LOG_E("SWD: resumeFromHalt() failed - not connected");
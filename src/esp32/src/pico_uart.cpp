@@ -1,5 +1,7 @@
 #include "pico_uart.h"
 #include "config.h"
+#include "flight_recorder.h"
+#include "protocol_crc.h"
 #include <driver/gpio.h>  // For ESP-IDF GPIO functions (SWD pin stabilization)
 
 // Fallback SWD pin definitions if not defined in config.h
@@ -11,6 +13,10 @@
     #define SWD_CLK_PIN 16  // Fallback: GPIO 16 for SWCLK
 #endif
 
+// Single instance pointer for the UART event task trampoline - onReceive()
+// takes a plain callback, and there is only ever one PicoUART
+static PicoUART* s_uartInstance = nullptr;
+
 PicoUART::PicoUART(HardwareSerial& serial)
     : _serial(serial)
     , _packetCallback(nullptr)
@@ -49,10 +55,25 @@ void PicoUART::begin() {
     // Configure RX pin with pull-down to prevent floating when Pico is not connected
     // This prevents noise from being interpreted as data
     pinMode(PICO_UART_RX_PIN, INPUT_PULLDOWN);
-    
+
+    // Enlarge the driver RX ring buffer BEFORE begin() - the UART ISR lands whole
+    // frames there so loop() only does bulk reads at frame granularity instead of
+    // draining byte-by-byte while status packets pile up
+    Serial1.setRxBufferSize(PICO_UART_RX_BUFFER_SIZE);
+
     // Initialize UART
     Serial1.begin(PICO_UART_BAUD, SERIAL_8N1, PICO_UART_RX_PIN, PICO_UART_TX_PIN);
-    
+
+    // Move RX consumption off the main loop: the UART event task copies driver
+    // bytes into the SPSC ring as they arrive, so frames survive even when
+    // LVGL rendering stretches the loop() interval past the driver buffer
+    s_uartInstance = this;
+    Serial1.onReceive([]() {
+        if (s_uartInstance) {
+            s_uartInstance->onUartData();
+        }
+    }, false);
+
     // Initialize control pins
     // PICO_RUN_PIN: GPIO20 (screen variant) or GPIO4 (no-screen variant)
     // WEIGHT_STOP_PIN: GPIO19 (screen variant) or GPIO6 (no-screen variant)
@@ -78,6 +99,12 @@ void PicoUART::pause() {
     _rxState = RxState::WAIT_START;
     _rxIndex = 0;
     _rxLength = 0;
+    // Drop queued TX frames - stale protocol frames must not be injected into
+    // the bootloader byte stream when OTA starts writing raw chunks
+    for (uint8_t p = 0; p < 3; p++) {
+        _txQueues[p].head = 0;
+        _txQueues[p].count = 0;
+    }
     // Note: We do NOT drain Serial1 buffer here because OTA process
     // (waitForBootloaderAck, streamFirmwareChunk) actively reads from
     // Serial1 while PicoUART is paused. Draining would steal data from OTA.
@@ -92,7 +119,10 @@ void PicoUART::loop() {
     if (_paused) {
         return;
     }
-    
+
+    // Drain any frames that were queued while the driver TX buffer was full
+    pumpTx();
+
     // Update connection status first (safe operation)
     if (_lastPacketTime > 0) {
         _connected = (millis() - _lastPacketTime) < 2000;
@@ -100,82 +130,162 @@ void PicoUART::loop() {
         _connected = false;
     }
     
-    // WORKAROUND: Use Serial1 directly instead of _serial reference
-    // The reference seems to get corrupted on ESP32-S3
-    int avail = Serial1.available();
-    if (avail > 0) {
-        while (Serial1.available()) {
-            uint8_t byte = Serial1.read();
-            processByte(byte);
+    // Drain the SPSC ring the UART event task has been filling and assemble
+    // frames from the chunks - the driver buffer itself is only touched by
+    // the event task (onUartData), never here, so there is one consumer per
+    // buffer and byte order is preserved
+    uint8_t chunk[PROTOCOL_MAX_PACKET * 2];
+    size_t got;
+    while ((got = ringRead(chunk, sizeof(chunk))) > 0) {
+        processChunk(chunk, got);
+    }
+}
+
+void PicoUART::onUartData() {
+    // UART event task context - the single producer for the RX ring.
+    // While paused, leave bytes in the driver: the OTA path
+    // (waitForBootloaderAck, firmware streaming) reads Serial1 directly.
+    if (_paused) {
+        return;
+    }
+
+    int avail;
+    while ((avail = Serial1.available()) > 0) {
+        uint8_t tmp[128];
+        size_t take = (avail > (int)sizeof(tmp)) ? sizeof(tmp) : (size_t)avail;
+        size_t got = Serial1.read(tmp, take);
+        if (got == 0) {
+            break;
+        }
+
+        // Free-running indices: used = head - tail works across wraparound
+        uint32_t head = _rxRingHead;
+        uint32_t used = head - _rxRingTail;
+        uint32_t space = RX_RING_SIZE - used;
+        size_t accept = (got > space) ? space : got;
+
+        if (accept < got) {
+            // Ring full - loop() has been starved for over a second of
+            // traffic. Drop the excess (counted) rather than let the driver
+            // buffer overflow and shred frame sync for everything after it.
+            _rxRingOverflow += got - accept;
+        }
+
+        // Copy in up to two segments (wraparound)
+        uint32_t idx = head & (RX_RING_SIZE - 1);
+        uint32_t first = RX_RING_SIZE - idx;
+        if (first > accept) {
+            first = accept;
+        }
+        memcpy(&_rxRing[idx], tmp, first);
+        if (accept > first) {
+            memcpy(&_rxRing[0], tmp + first, accept - first);
+        }
+        _rxRingHead = head + accept;  // Publish after the data is in place
+
+        if (used + accept > _rxRingHighWater) {
+            _rxRingHighWater = used + accept;
         }
     }
 }
 
-void PicoUART::processByte(uint8_t byte) {
-    switch (_rxState) {
-        case RxState::WAIT_START:
-            if (byte == PROTOCOL_SYNC_BYTE) {
+size_t PicoUART::ringRead(uint8_t* dst, size_t maxLen) {
+    uint32_t head = _rxRingHead;  // Snapshot the producer index once
+    uint32_t tail = _rxRingTail;
+    uint32_t used = head - tail;
+    if (used == 0) {
+        return 0;
+    }
+
+    size_t take = (used > maxLen) ? maxLen : used;
+    uint32_t idx = tail & (RX_RING_SIZE - 1);
+    uint32_t first = RX_RING_SIZE - idx;
+    if (first > take) {
+        first = take;
+    }
+    memcpy(dst, &_rxRing[idx], first);
+    if (take > first) {
+        memcpy(dst + first, &_rxRing[0], take - first);
+    }
+    _rxRingTail = tail + take;  // Release the slots after the copy
+    return take;
+}
+
+int PicoUART::readRawByte() {
+    uint8_t b;
+    if (ringRead(&b, 1) == 1) {
+        return b;
+    }
+    // Paused path: the event task leaves bytes in the driver for OTA code.
+    // Ring bytes are always older than driver bytes, so order is preserved.
+    return Serial1.available() ? Serial1.read() : -1;
+}
+
+void PicoUART::processChunk(const uint8_t* data, size_t len) {
+    size_t pos = 0;
+
+    while (pos < len) {
+        switch (_rxState) {
+            case RxState::WAIT_START: {
+                // Scan for sync byte in one pass - skips noise/garbage in bulk
+                const uint8_t* sync = (const uint8_t*)memchr(data + pos, PROTOCOL_SYNC_BYTE, len - pos);
+                if (sync == nullptr) {
+                    return;  // No frame start in the rest of this chunk
+                }
+                pos = (size_t)(sync - data) + 1;
                 _rxIndex = 0;
-                _rxState = RxState::GOT_TYPE;
-            }
-            break;
-            
-        case RxState::GOT_TYPE:
-            _rxBuffer[_rxIndex++] = byte;  // type
-            _rxState = RxState::GOT_LENGTH;
-            break;
-            
-        case RxState::GOT_LENGTH:
-            _rxBuffer[_rxIndex++] = byte;  // length
-            _rxLength = byte;
-            _rxState = RxState::GOT_SEQ;
-            break;
-            
-        case RxState::GOT_SEQ:
-            _rxBuffer[_rxIndex++] = byte;  // seq
-            if (_rxLength > 0) {
-                _rxState = RxState::READING_PAYLOAD;
-            } else {
-                _rxState = RxState::READING_CRC;
+                _rxState = RxState::GOT_HEADER;
+                break;
             }
-            break;
-            
-        case RxState::READING_PAYLOAD:
-            _rxBuffer[_rxIndex++] = byte;
-            if (_rxIndex >= 3 + _rxLength) {
-                _rxState = RxState::READING_CRC;
+
+            case RxState::GOT_HEADER: {
+                // Accumulate type + length + seq (3 bytes, may span chunks)
+                size_t needed = 3 - _rxIndex;
+                size_t take = (len - pos < needed) ? (len - pos) : needed;
+                memcpy(&_rxBuffer[_rxIndex], data + pos, take);
+                _rxIndex += take;
+                pos += take;
+                if (_rxIndex >= 3) {
+                    _rxLength = _rxBuffer[1];
+                    if (_rxLength > PROTOCOL_MAX_PAYLOAD) {
+                        // Bogus length field - resync on next sync byte
+                        _packetErrors++;
+                        FlightRecorder::recordProtocolError(FLIGHT_PROTO_ERR_LENGTH, _rxLength);
+                        _rxState = RxState::WAIT_START;
+                        break;
+                    }
+                    _rxState = RxState::READING_BODY;
+                }
+                break;
             }
-            break;
-            
-        case RxState::READING_CRC:
-            _rxBuffer[_rxIndex++] = byte;
-            if (_rxIndex >= 3 + _rxLength + 2) {
-                processPacket();
-                _rxState = RxState::WAIT_START;
+
+            case RxState::READING_BODY: {
+                // Accumulate payload + CRC with a single copy per chunk
+                size_t total = 3 + (size_t)_rxLength + 2;
+                size_t needed = total - _rxIndex;
+                size_t take = (len - pos < needed) ? (len - pos) : needed;
+                memcpy(&_rxBuffer[_rxIndex], data + pos, take);
+                _rxIndex += take;
+                pos += take;
+                if (_rxIndex >= total) {
+                    processPacket();
+                    _rxState = RxState::WAIT_START;
+                }
+                break;
             }
-            break;
-    }
-    
-    // Safety: reset if buffer overflow
-    if (_rxIndex >= sizeof(_rxBuffer)) {
-        _rxState = RxState::WAIT_START;
-        _rxIndex = 0;
-        _packetErrors++;
+        }
     }
 }
 
 void PicoUART::processPacket() {
-    // Extract packet fields
+    // Extract packet fields - payload stays in the RX buffer (zero-copy view)
     PicoPacket packet;
     packet.type = _rxBuffer[0];
     packet.length = _rxBuffer[1];
     packet.seq = _rxBuffer[2];
-    
-    // Copy payload
-    if (packet.length > 0 && packet.length <= sizeof(packet.payload)) {
-        memcpy(packet.payload, &_rxBuffer[3], packet.length);
-    }
-    
+    packet.payload = &_rxBuffer[3];
+    packet.generation = ++_rxGeneration;
+
     // Extract CRC (little-endian)
     uint16_t receivedCRC = _rxBuffer[3 + packet.length] | 
                           (_rxBuffer[4 + packet.length] << 8);
@@ -188,52 +298,254 @@ void PicoUART::processPacket() {
         packet.crc = receivedCRC;
         _packetsReceived++;
         _lastPacketTime = millis();
-        
+
+        // ACK payload: [cmd_type, cmd_seq, result, reserved] - close out the
+        // RTT sample before dispatch so the histogram sees every ACK
+        if (packet.type == MSG_ACK && packet.length >= 2) {
+            recordAckLatency(packet.payload[1]);
+        }
+
+        // Control-loop jitter report - cached here so the diagnostics
+        // endpoint can serve it without a request round-trip to the Pico
+        if (packet.type == MSG_JITTER) {
+            recordJitterReport(packet.payload, packet.length);
+        }
+
         // Call callback if set
         if (_packetCallback) {
-            _packetCallback(packet);
+            if (packet.type == MSG_BATCH) {
+                // Aggregate frame: unpack [type | length | payload] sub-messages
+                // and dispatch each as if it arrived in its own frame. Sub-views
+                // point into the container's payload - still zero-copy.
+                uint8_t offset = 0;
+                while (offset + 2 <= packet.length) {
+                    PicoPacket sub;
+                    sub.type = packet.payload[offset];
+                    sub.length = packet.payload[offset + 1];
+                    sub.seq = packet.seq;
+                    sub.crc = packet.crc;
+                    sub.valid = true;
+                    sub.generation = packet.generation;
+                    offset += 2;
+                    if (sub.length > PROTOCOL_MAX_PAYLOAD || offset + sub.length > packet.length) {
+                        _packetErrors++;
+                        FlightRecorder::recordProtocolError(FLIGHT_PROTO_ERR_BATCH, sub.type);
+                        LOG_W("Malformed batch sub-message: type=0x%02X len=%d", sub.type, sub.length);
+                        break;
+                    }
+                    sub.payload = &packet.payload[offset];
+                    offset += sub.length;
+                    if (sub.type == MSG_ACK && sub.length >= 2) {
+                        recordAckLatency(sub.payload[1]);
+                    }
+                    _packetCallback(sub);
+                }
+            } else {
+                _packetCallback(packet);
+            }
         }
     } else {
         packet.valid = false;
         _packetErrors++;
-        LOG_W("Packet CRC error: received=0x%04X, expected=0x%04X", 
+        FlightRecorder::recordProtocolError(FLIGHT_PROTO_ERR_CRC, receivedCRC);
+        LOG_W("Packet CRC error: received=0x%04X, expected=0x%04X",
               receivedCRC, expectedCRC);
     }
 }
 
-bool PicoUART::sendPacket(uint8_t type, const uint8_t* payload, uint8_t length) {
-    if (length > PROTOCOL_MAX_PAYLOAD) {
-        LOG_E("Packet payload too large: %d (max: %d)", length, PROTOCOL_MAX_PAYLOAD);
-        return false;
+void PicoUART::trackCommandSent(uint8_t seq) {
+    // Reuse the slot for this seq if present (retransmit), else take a free
+    // slot, else overwrite the oldest - a lost slot just drops one sample
+    uint8_t victim = 0;
+    uint32_t oldest = 0xFFFFFFFF;
+    for (uint8_t i = 0; i < CMD_TIMESTAMP_SLOTS; i++) {
+        if (_cmdSendTimes[i].active && _cmdSendTimes[i].seq == seq) {
+            victim = i;
+            break;
+        }
+        uint32_t age = _cmdSendTimes[i].active ? _cmdSendTimes[i].sentMs : 0;
+        if (age < oldest) {
+            oldest = age;
+            victim = i;
+        }
     }
-    
+    _cmdSendTimes[victim].seq = seq;
+    _cmdSendTimes[victim].sentMs = millis();
+    _cmdSendTimes[victim].active = true;
+}
+
+void PicoUART::recordAckLatency(uint8_t cmdSeq) {
+    for (uint8_t i = 0; i < CMD_TIMESTAMP_SLOTS; i++) {
+        if (_cmdSendTimes[i].active && _cmdSendTimes[i].seq == cmdSeq) {
+            uint32_t rtt = millis() - _cmdSendTimes[i].sentMs;
+            _cmdSendTimes[i].active = false;
+            _ackLatencyBuckets[protocol_latency_bucket(rtt)]++;
+            _ackLatencySamples++;
+            if (rtt > _ackLatencyMaxMs) {
+                _ackLatencyMaxMs = rtt;
+            }
+            return;
+        }
+    }
+    // Unmatched ACK (slot overwritten or stale) - no sample
+}
+
+void PicoUART::recordJitterReport(const uint8_t* payload, uint8_t length) {
+    // jitter_payload_t: samples, late_buckets[8], max_late, then the four
+    // per-cause max fields - 14 little-endian uint32s, 56 bytes
+    static constexpr uint8_t JITTER_PAYLOAD_SIZE = (6 + CONTROL_JITTER_BUCKET_COUNT) * 4;
+    if (length < JITTER_PAYLOAD_SIZE) {
+        return;
+    }
+
+    auto u32At = [payload](size_t offset) -> uint32_t {
+        uint32_t v;
+        memcpy(&v, payload + offset, sizeof(v));
+        return v;
+    };
+
+    _jitter.samples = u32At(0);
+    for (uint8_t i = 0; i < CONTROL_JITTER_BUCKET_COUNT; i++) {
+        _jitter.lateBuckets[i] = u32At(4 + (size_t)i * 4);
+    }
+    size_t offset = 4 + CONTROL_JITTER_BUCKET_COUNT * 4;
+    _jitter.maxLateUs = u32At(offset);
+    _jitter.maxLateFlashUs = u32At(offset + 4);
+    _jitter.maxLateClassBUs = u32At(offset + 8);
+    _jitter.maxLateProtocolUs = u32At(offset + 12);
+    _jitter.maxLateOtherUs = u32At(offset + 16);
+    _jitter.valid = true;
+}
+
+TxPriority PicoUART::classifyTxPriority(uint8_t type) {
+    switch (type) {
+        // Actuation-affecting commands - must not queue behind bulk traffic
+        case MSG_CMD_BREW:
+        case MSG_CMD_MODE:
+        case MSG_CMD_CLEANING_STOP:
+        case MSG_CMD_BOOTLOADER:
+            return TxPriority::CONTROL;
+
+        // Chatty or large traffic that can tolerate queueing
+        case MSG_CMD_CONFIG:
+        case MSG_CMD_GET_CONFIG:
+        case MSG_CMD_GET_ENV_CONFIG:
+        case MSG_CMD_GET_STATISTICS:
+        case MSG_CMD_DEBUG:
+        case MSG_CMD_LOG_CONFIG:
+        case MSG_DEBUG:
+            return TxPriority::BULK;
+
+        default:
+            return TxPriority::NORMAL;
+    }
+}
+
+bool PicoUART::writeFrame(uint8_t type, const uint8_t* payload, uint8_t length) {
     // Buffer size: header (4) + max payload (64) + CRC (2) = 70 bytes
     uint8_t buffer[PROTOCOL_MAX_PACKET];
     uint8_t idx = 0;
-    
-    // Build packet
+
+    // Build packet - seq assigned here so wire order stays monotonic
     buffer[idx++] = PROTOCOL_SYNC_BYTE;
     buffer[idx++] = type;
     buffer[idx++] = length;
-    buffer[idx++] = _txSeq++;
-    
+    uint8_t seq = _txSeq++;
+    buffer[idx++] = seq;
+
+    // Commands get ACKed by the Pico - timestamp them here (at wire write,
+    // not enqueue) so the RTT histogram measures link latency, not our queue
+    if (type >= MSG_CMD_SET_TEMP && type < MSG_LOG) {
+        trackCommandSent(seq);
+    }
+
     // Copy payload
     if (length > 0 && payload != nullptr) {
         memcpy(&buffer[idx], payload, length);
         idx += length;
     }
-    
+
     // Calculate and append CRC
     uint16_t crc = calculateCRC(&buffer[1], 3 + length);
     buffer[idx++] = crc & 0xFF;
     buffer[idx++] = (crc >> 8) & 0xFF;
-    
+
     // Send
     size_t written = Serial1.write(buffer, idx);
-    
+
     return written == idx;
 }
 
+void PicoUART::pumpTx() {
+    // Drain rings in strict priority order. Stop as soon as the driver TX
+    // buffer can't take a whole frame - partial frames would corrupt framing
+    // for everything behind them.
+    for (uint8_t p = 0; p < 3; p++) {
+        TxQueue& q = _txQueues[p];
+        while (q.count > 0) {
+            TxEntry& e = q.entries[q.head];
+            size_t frameLen = PROTOCOL_HEADER_SIZE + e.length + PROTOCOL_CRC_SIZE;
+            if ((size_t)Serial1.availableForWrite() < frameLen) {
+                return;  // Driver full - retry on next loop() pass
+            }
+            writeFrame(e.type, e.payload, e.length);
+            q.head = (q.head + 1) % TX_QUEUE_DEPTH;
+            q.count--;
+        }
+    }
+}
+
+bool PicoUART::sendPacket(uint8_t type, const uint8_t* payload, uint8_t length) {
+    if (length > PROTOCOL_MAX_PAYLOAD) {
+        LOG_E("Packet payload too large: %d (max: %d)", length, PROTOCOL_MAX_PAYLOAD);
+        return false;
+    }
+
+    TxPriority prio = classifyTxPriority(type);
+    TxQueue& q = _txQueues[(uint8_t)prio];
+
+    // Fast path: nothing queued at this priority or above and the driver can
+    // take the whole frame - send synchronously, same behavior as before
+    bool queuesAhead = false;
+    for (uint8_t p = 0; p <= (uint8_t)prio; p++) {
+        if (_txQueues[p].count > 0) {
+            queuesAhead = true;
+            break;
+        }
+    }
+    size_t frameLen = PROTOCOL_HEADER_SIZE + length + PROTOCOL_CRC_SIZE;
+    if (!queuesAhead && (size_t)Serial1.availableForWrite() >= frameLen) {
+        return writeFrame(type, payload, length);
+    }
+
+    // Per-priority watermarks: BULK backs off early so config floods can never
+    // occupy the slots a brew-stop needs
+    uint8_t limit = (prio == TxPriority::BULK) ? TX_BULK_WATERMARK : TX_QUEUE_DEPTH;
+    if (q.count >= limit) {
+        _txDropped++;
+        if (prio == TxPriority::CONTROL) {
+            LOG_E("TX CONTROL queue full - dropping cmd 0x%02X", type);
+        } else {
+            LOG_W("TX queue backpressure (prio=%d) - dropping 0x%02X", (int)prio, type);
+        }
+        return false;
+    }
+
+    // Enqueue (frame is built at dequeue time)
+    uint8_t tail = (q.head + q.count) % TX_QUEUE_DEPTH;
+    TxEntry& e = q.entries[tail];
+    e.type = type;
+    e.length = length;
+    if (length > 0 && payload != nullptr) {
+        memcpy(e.payload, payload, length);
+    }
+    q.count++;
+
+    // Try to make progress immediately
+    pumpTx();
+    return true;
+}
+
 bool PicoUART::sendPing() {
     uint32_t timestamp = millis();
     return sendPacket(MSG_PING, (uint8_t*)&timestamp, sizeof(timestamp));
@@ -259,20 +571,26 @@ bool PicoUART::requestConfig() {
     return sendPacket(MSG_CMD_GET_CONFIG, nullptr, 0);
 }
 
+bool PicoUART::requestConfigSnapshot() {
+    return sendPacket(MSG_CMD_GET_SNAPSHOT, nullptr, 0);
+}
+
 bool PicoUART::requestBootInfo() {
     return sendPacket(MSG_CMD_GET_BOOT, nullptr, 0);
 }
 
 bool PicoUART::sendHandshake() {
-    uint8_t handshake[6] = {
+    uint8_t handshake[8] = {
         1,  // protocol_version_major
         1,  // protocol_version_minor
-        0,  // capabilities
+        0x01,  // capabilities: PROTOCOL_CAP_RATE_NEGOTIATION
         3,  // max_retry_count
         (uint8_t)(1000 & 0xFF),      // ack_timeout_ms low byte
-        (uint8_t)((1000 >> 8) & 0xFF) // ack_timeout_ms high byte
+        (uint8_t)((1000 >> 8) & 0xFF), // ack_timeout_ms high byte
+        PICO_STATUS_RATE_IDLE_HZ,    // status rate while idle
+        PICO_STATUS_RATE_ACTIVE_HZ   // status rate while brewing
     };
-    return sendPacket(MSG_HANDSHAKE, handshake, 6);
+    return sendPacket(MSG_HANDSHAKE, handshake, 8);
 }
 
 bool PicoUART::enterBootloader() {
@@ -352,6 +670,13 @@ void PicoUART::resetPico() {
     pinMode(PICO_UART_RX_PIN, INPUT_PULLDOWN);  // Restore RX pin configuration
     Serial1.begin(PICO_UART_BAUD, SERIAL_8N1, PICO_UART_RX_PIN, PICO_UART_TX_PIN);
     delay(10); // Allow UART to initialize
+
+    // Re-register the event task producer - Serial1.end() dropped the callback
+    Serial1.onReceive([]() {
+        if (s_uartInstance) {
+            s_uartInstance->onUartData();
+        }
+    }, false);
     
 #if SWD_SUPPORTED
     // Restore SWD pins to strong drive after reset release (only if SWD is supported)
@@ -382,21 +707,8 @@ void PicoUART::setWeightStop(bool active) {
 }
 
 uint16_t PicoUART::calculateCRC(const uint8_t* data, size_t length) {
-    // CRC-16-CCITT (polynomial 0x1021, initial value 0xFFFF)
-    uint16_t crc = 0xFFFF;
-    
-    for (size_t i = 0; i < length; i++) {
-        crc ^= (uint16_t)data[i] << 8;
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x8000) {
-                crc = (crc << 1) ^ 0x1021;
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    
-    return crc;
+    // CRC-16-CCITT, table-driven (shared with Pico via protocol_crc.h)
+    return protocol_crc16_ccitt(data, length);
 }
 
 bool PicoUART::waitForBootloaderAck(uint32_t timeoutMs) {
@@ -433,8 +745,9 @@ bool PicoUART::waitForBootloaderAck(uint32_t timeoutMs) {
     bool protocolAckComplete = false;
     
     while ((millis() - startTime) < timeoutMs) {
-        if (Serial1.available()) {
-            uint8_t byte = Serial1.read();
+        int raw = readRawByte();  // Ring first (unpaused), then driver (paused/OTA)
+        if (raw >= 0) {
+            uint8_t byte = (uint8_t)raw;
             bytesRead++;
             lastByteTime = millis();
             
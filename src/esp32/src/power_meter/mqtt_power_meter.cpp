@@ -10,6 +10,10 @@ MQTTPowerMeter::MQTTPowerMeter(const char* topic, const char* format)
     , _lastUpdateTime(0)
     , _hasData(false)
     , _deviceOnline(true)  // Assume online until LWT says otherwise
+    , _readingVersion(0)
+    , _suppressedReadings(0)
+    , _acceptedPower(0.0f)
+    , _lastAcceptTime(0)
 {
     _lastError[0] = '\0';
     memset(&_lastReading, 0, sizeof(_lastReading));
@@ -152,6 +156,23 @@ void MQTTPowerMeter::onMqttData(JsonDocument& doc) {
         if (!wasConnected) {
             LOG_I("MQTT power meter connected: topic=%s, format=%s", _topic.c_str(), getFormat());
         }
+
+        // Deadband decimation: only bump the version (what wakes the status
+        // pipeline) when power actually moved. _lastReading still carries the
+        // exact latest values either way - in particular the cumulative energy
+        // register - so suppressed readings lose nothing in kWh stats.
+        float relative = fabsf(_acceptedPower) * (DEADBAND_PERCENT / 100.0f);
+        float threshold = (relative > DEADBAND_WATTS) ? relative : DEADBAND_WATTS;
+        if (!_hasData ||
+            fabsf(_lastReading.power - _acceptedPower) >= threshold ||
+            (millis() - _lastAcceptTime) >= DEADBAND_HEARTBEAT_MS) {
+            _readingVersion++;
+            _acceptedPower = _lastReading.power;
+            _lastAcceptTime = millis();
+        } else {
+            _suppressedReadings++;
+        }
+
         _hasData = true;
         _lastError[0] = '\0';
         wasConnected = isNowConnected;
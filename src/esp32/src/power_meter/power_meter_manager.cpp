@@ -190,6 +190,19 @@ bool PowerMeterManager::getReading(PowerMeterReading& reading) {
     return _lastReading.valid && ((millis() - _lastReadTime) < 5000);
 }
 
+bool PowerMeterManager::consumeReadingChange() {
+    if (_source != PowerMeterSource::MQTT || !_mqttMeter) {
+        return false;
+    }
+
+    uint32_t version = _mqttMeter->readingVersion();
+    if (version == _lastSeenVersion) {
+        return false;
+    }
+    _lastSeenVersion = version;
+    return true;
+}
+
 bool PowerMeterManager::isConnected() const {
     if (_source == PowerMeterSource::NONE) {
         return false;
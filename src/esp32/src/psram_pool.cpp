@@ -0,0 +1,182 @@
+#include "psram_pool.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+PsramPool* PsramPool::_instance = nullptr;
+
+PsramPool& PsramPool::instance() {
+    if (_instance == nullptr) {
+        static PsramPool pool;
+        _instance = &pool;
+    }
+    return *_instance;
+}
+
+PsramPool::PsramPool() {
+    // Bin layout: sized for the observed traffic mix - many small JSON
+    // payloads, a few KB-scale broadcasts, occasional big serializations.
+    // Total carve-out when all bins are touched: 2K + 8K + 16K + 32K = 58KB.
+    static const size_t BIN_SIZES[BIN_COUNT]  = { 256, 1024, 4096, 16384 };
+    static const size_t BIN_COUNTS[BIN_COUNT] = { 8, 8, 4, 2 };
+
+    for (size_t b = 0; b < BIN_COUNT; b++) {
+        _bins[b].blockSize = BIN_SIZES[b];
+        _bins[b].blockCount = BIN_COUNTS[b];
+        _bins[b].region = nullptr;
+        _bins[b].used = 0;
+        _bins[b].highWater = 0;
+        _bins[b].allocs = 0;
+        _bins[b].exhausted = 0;
+        for (size_t i = 0; i < MAX_BLOCKS; i++) {
+            _bins[b].inUse[i] = false;
+            _bins[b].tagIdx[i] = -1;
+        }
+    }
+
+    for (size_t t = 0; t < MAX_TAGS; t++) {
+        _tags[t] = nullptr;
+        _tagLive[t] = 0;
+        _tagTotal[t] = 0;
+    }
+    _oversize = 0;
+    _heapFallbacks = 0;
+
+    // Create mutex for thread-safe access - if this fails, every request
+    // falls back to the heap and the pool is effectively disabled
+    _mutex = xSemaphoreCreateMutex();
+}
+
+int PsramPool::tagIndexFor(const char* tag) {
+    if (tag == nullptr) {
+        return -1;
+    }
+    for (size_t t = 0; t < MAX_TAGS; t++) {
+        if (_tags[t] == nullptr) {
+            _tags[t] = tag;  // First allocation with this tag - register it
+            return (int)t;
+        }
+        if (_tags[t] == tag || strcmp(_tags[t], tag) == 0) {
+            return (int)t;
+        }
+    }
+    return -1;  // Tag table full - allocation still works, just untracked
+}
+
+bool PsramPool::ensureRegion(Bin& bin) {
+    if (bin.region != nullptr) {
+        return true;
+    }
+    // One allocation per bin for its whole lifetime - this is the only time
+    // the pool touches the heap on the happy path
+    bin.region = (uint8_t*)heap_caps_malloc(bin.blockSize * bin.blockCount,
+                                            MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return bin.region != nullptr;
+}
+
+void* PsramPool::allocate(size_t size, const char* tag) {
+    // Pick the smallest bin that fits
+    int binIdx = -1;
+    for (size_t b = 0; b < BIN_COUNT; b++) {
+        if (size <= _bins[b].blockSize) {
+            binIdx = (int)b;
+            break;
+        }
+    }
+
+    if (binIdx >= 0 && _mutex != nullptr &&
+        xSemaphoreTake(_mutex, portMAX_DELAY) == pdTRUE) {
+        Bin& bin = _bins[binIdx];
+        if (ensureRegion(bin)) {
+            for (size_t i = 0; i < bin.blockCount; i++) {
+                if (!bin.inUse[i]) {
+                    bin.inUse[i] = true;
+                    int ti = tagIndexFor(tag);
+                    bin.tagIdx[i] = (int8_t)ti;
+                    if (ti >= 0) {
+                        _tagLive[ti]++;
+                        _tagTotal[ti]++;
+                    }
+                    bin.used++;
+                    if (bin.used > bin.highWater) bin.highWater = bin.used;
+                    bin.allocs++;
+                    void* ptr = bin.region + i * bin.blockSize;
+                    xSemaphoreGive(_mutex);
+                    return ptr;
+                }
+            }
+            bin.exhausted++;
+        }
+        _heapFallbacks++;
+        xSemaphoreGive(_mutex);
+    } else if (binIdx < 0) {
+        if (_mutex != nullptr && xSemaphoreTake(_mutex, portMAX_DELAY) == pdTRUE) {
+            _oversize++;
+            _heapFallbacks++;
+            xSemaphoreGive(_mutex);
+        }
+    }
+
+    // Bin full, oversize request, or no mutex - fall back to the heap
+    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ptr == nullptr) {
+        ptr = malloc(size);  // Last resort: internal RAM
+    }
+    return ptr;
+}
+
+void PsramPool::release(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    if (_mutex != nullptr && xSemaphoreTake(_mutex, portMAX_DELAY) == pdTRUE) {
+        for (size_t b = 0; b < BIN_COUNT; b++) {
+            Bin& bin = _bins[b];
+            if (bin.region == nullptr) continue;
+            uint8_t* p = (uint8_t*)ptr;
+            if (p >= bin.region && p < bin.region + bin.blockSize * bin.blockCount) {
+                size_t i = (p - bin.region) / bin.blockSize;
+                if (bin.inUse[i]) {
+                    bin.inUse[i] = false;
+                    if (bin.tagIdx[i] >= 0 && _tagLive[bin.tagIdx[i]] > 0) {
+                        _tagLive[bin.tagIdx[i]]--;
+                    }
+                    bin.tagIdx[i] = -1;
+                    bin.used--;
+                }
+                xSemaphoreGive(_mutex);
+                return;
+            }
+        }
+        xSemaphoreGive(_mutex);
+    }
+
+    // Not a pool block - it was a heap fallback
+    heap_caps_free(ptr);
+}
+
+PsramPool::Stats PsramPool::getStats() const {
+    Stats stats;
+    memset(&stats, 0, sizeof(stats));
+
+    if (_mutex != nullptr && xSemaphoreTake(_mutex, portMAX_DELAY) == pdTRUE) {
+        for (size_t b = 0; b < BIN_COUNT; b++) {
+            stats.bins[b].blockSize = _bins[b].blockSize;
+            stats.bins[b].totalBlocks = _bins[b].blockCount;
+            stats.bins[b].inUse = _bins[b].used;
+            stats.bins[b].highWater = _bins[b].highWater;
+            stats.bins[b].allocs = _bins[b].allocs;
+            stats.bins[b].exhausted = _bins[b].exhausted;
+        }
+        for (size_t t = 0; t < MAX_TAGS; t++) {
+            stats.tags[t].tag = _tags[t];
+            stats.tags[t].live = _tagLive[t];
+            stats.tags[t].total = _tagTotal[t];
+        }
+        stats.oversize = _oversize;
+        stats.heapFallbacks = _heapFallbacks;
+        xSemaphoreGive(_mutex);
+    }
+
+    return stats;
+}
@@ -0,0 +1,165 @@
+#include "pump_health.h"
+#include "config.h"
+#include "statistics/statistics_manager.h"
+#include "notifications/notification_manager.h"
+#include <Preferences.h>
+#include <math.h>
+
+// NVS namespace for the baseline (survives reboots; hundreds of shots of
+// history condensed into three numbers)
+#define NVS_PUMP_NAMESPACE  "pumphealth"
+
+// EWMA weight once the baseline is established: 1/32 per shot, so the
+// baseline tracks seasonal drift (water temp, mains voltage) but a genuine
+// mechanical change still shows up as sustained deviation
+#define PUMP_HEALTH_EWMA_ALPHA  (1.0f / 32.0f)
+
+// Skip the pump spin-up at the start of the window - the first quarter
+// second is ramp, not steady drive signature
+#define PUMP_HEALTH_SKIP_S      0.25f
+#define PUMP_HEALTH_MIN_SAMPLES 256
+
+float PumpHealth::_baselineRipple = 0.0f;
+float PumpHealth::_baselineRms = 0.0f;
+uint32_t PumpHealth::_shotsAnalyzed = 0;
+float PumpHealth::_lastRipple = 0.0f;
+float PumpHealth::_lastRms = 0.0f;
+float PumpHealth::_lastDriveHz = 0.0f;
+uint8_t PumpHealth::_driftStreak = 0;
+
+void PumpHealth::begin() {
+    Preferences prefs;
+    if (prefs.begin(NVS_PUMP_NAMESPACE, true)) {
+        _baselineRipple = prefs.getFloat("ripple", 0.0f);
+        _baselineRms = prefs.getFloat("rms", 0.0f);
+        _shotsAnalyzed = prefs.getUInt("shots", 0);
+        prefs.end();
+    }
+    if (_shotsAnalyzed > 0) {
+        LOG_I("Pump health: baseline ripple=%.4f rms=%.1f (%lu shots)",
+              _baselineRipple, _baselineRms, (unsigned long)_shotsAnalyzed);
+    }
+}
+
+float PumpHealth::goertzelMagnitude(const uint16_t* samples, uint16_t count,
+                                    float mean, float binHz, float rateHz) {
+    // Standard Goertzel with the bin snapped to an integer k so the
+    // non-windowed pass doesn't leak; 2/N scaling yields amplitude in the
+    // same units as the input
+    float k = roundf((float)count * binHz / rateHz);
+    float w = 2.0f * (float)M_PI * k / (float)count;
+    float coeff = 2.0f * cosf(w);
+
+    float s0, s1 = 0.0f, s2 = 0.0f;
+    for (uint16_t i = 0; i < count; i++) {
+        s0 = ((float)samples[i] - mean) + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    float power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+    return 2.0f * sqrtf(power > 0.0f ? power : 0.0f) / (float)count;
+}
+
+void PumpHealth::analyzeTransient(const uint16_t* samples, uint16_t count,
+                                  uint16_t rateHz) {
+    if (rateHz == 0) {
+        return;
+    }
+    uint16_t skip = (uint16_t)((float)rateHz * PUMP_HEALTH_SKIP_S);
+    if (count <= skip + PUMP_HEALTH_MIN_SAMPLES) {
+        return;  // Shot too short for a stable fingerprint
+    }
+    samples += skip;
+    count -= skip;
+
+    float mean = 0.0f;
+    for (uint16_t i = 0; i < count; i++) {
+        mean += (float)samples[i];
+    }
+    mean /= (float)count;
+
+    float sumSq = 0.0f;
+    for (uint16_t i = 0; i < count; i++) {
+        float d = (float)samples[i] - mean;
+        sumSq += d * d;
+    }
+    float rms = sqrtf(sumSq / (float)count);
+    if (rms < 1.0f) {
+        return;  // Flat trace - transducer missing or shot aborted instantly
+    }
+
+    // The pump drives at mains frequency; probe both and let the larger
+    // bin tell us which grid this machine is on
+    float amp50 = goertzelMagnitude(samples, count, 50.0f, rateHz);
+    float amp60 = goertzelMagnitude(samples, count, 60.0f, rateHz);
+    float amp = amp50 >= amp60 ? amp50 : amp60;
+    _lastDriveHz = amp50 >= amp60 ? 50.0f : 60.0f;
+
+    // Normalize by the AC RMS so transducer gain and brew pressure level
+    // cancel out - wear shows as the ripple's *share* growing
+    _lastRipple = amp / rms;
+    _lastRms = rms;
+
+    Stats.attachPumpMetrics(_lastRms, _lastRipple);
+
+    if (_shotsAnalyzed < PUMP_HEALTH_BASELINE_SHOTS) {
+        // Establishing the baseline: plain running average
+        _baselineRipple = (_baselineRipple * _shotsAnalyzed + _lastRipple) /
+                          (_shotsAnalyzed + 1);
+        _baselineRms = (_baselineRms * _shotsAnalyzed + _lastRms) /
+                       (_shotsAnalyzed + 1);
+    } else {
+        float drift = (_lastRipple - _baselineRipple) / _baselineRipple;
+        if (fabsf(drift) > PUMP_HEALTH_DRIFT_THRESHOLD) {
+            if (_driftStreak < 255) _driftStreak++;
+            if (_driftStreak >= PUMP_HEALTH_FLAG_STREAK && notificationManager) {
+                notificationManager->pumpWear(drift * 100.0f, _shotsAnalyzed);
+            }
+        } else {
+            _driftStreak = 0;
+        }
+        _baselineRipple += PUMP_HEALTH_EWMA_ALPHA * (_lastRipple - _baselineRipple);
+        _baselineRms += PUMP_HEALTH_EWMA_ALPHA * (_lastRms - _baselineRms);
+    }
+    _shotsAnalyzed++;
+    persist();
+
+    LOG_I("Pump health: ripple=%.4f @ %.0fHz rms=%.1f baseline=%.4f (shot %lu)",
+          _lastRipple, _lastDriveHz, _lastRms, _baselineRipple,
+          (unsigned long)_shotsAnalyzed);
+}
+
+void PumpHealth::persist() {
+    // One small NVS write per shot - shots are rare events, and losing the
+    // baseline to a power cut would restart the 20-shot warm-up
+    Preferences prefs;
+    if (prefs.begin(NVS_PUMP_NAMESPACE, false)) {
+        prefs.putFloat("ripple", _baselineRipple);
+        prefs.putFloat("rms", _baselineRms);
+        prefs.putUInt("shots", _shotsAnalyzed);
+        prefs.end();
+    }
+}
+
+void PumpHealth::toJson(JsonObject obj) {
+    obj["shotsAnalyzed"] = _shotsAnalyzed;
+    obj["baselineRipple"] = _baselineRipple;
+    obj["baselineRms"] = _baselineRms;
+    obj["lastRipple"] = _lastRipple;
+    obj["lastRms"] = _lastRms;
+    obj["lastDriveHz"] = _lastDriveHz;
+    obj["driftStreak"] = _driftStreak;
+    obj["baselineReady"] = (_shotsAnalyzed >= PUMP_HEALTH_BASELINE_SHOTS);
+    if (_shotsAnalyzed >= PUMP_HEALTH_BASELINE_SHOTS && _baselineRipple > 0) {
+        obj["driftPct"] = (_lastRipple - _baselineRipple) / _baselineRipple * 100.0f;
+    }
+}
+
+void PumpHealth::resetBaseline() {
+    _baselineRipple = 0.0f;
+    _baselineRms = 0.0f;
+    _shotsAnalyzed = 0;
+    _driftStreak = 0;
+    persist();
+    LOG_I("Pump health: baseline reset");
+}
@@ -0,0 +1,65 @@
+#include "radio_reserve.h"
+#include "config.h"
+#include <esp_heap_caps.h>
+#include <Arduino.h>
+
+void* RadioReserve::_slab = nullptr;
+uint32_t RadioReserve::_releases = 0;
+
+void RadioReserve::begin() {
+    if (_slab != nullptr) {
+        return;
+    }
+    // One contiguous internal-RAM block, held for the lifetime of the boot
+    // unless the heap gets into trouble. 8BIT (not DMA) caps: the point is
+    // keeping the bytes out of circulation, not using them ourselves.
+    _slab = heap_caps_malloc(RADIO_RESERVE_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (_slab != nullptr) {
+        LOG_I("Radio reserve: %d bytes of internal RAM held", RADIO_RESERVE_SIZE);
+    } else {
+        // Internal RAM is already too tight at boot - that's its own problem,
+        // and holding nothing is the correct fallback
+        LOG_W("Radio reserve: could not acquire %d bytes at boot", RADIO_RESERVE_SIZE);
+    }
+}
+
+void RadioReserve::loop() {
+    // A heap crunch develops on reconnect/handshake timescales, so the 30s
+    // memory log cadence is too slow - check every 2s instead
+    static unsigned long lastCheck = 0;
+    if (millis() - lastCheck < 2000) {
+        return;
+    }
+    lastCheck = millis();
+
+    size_t freeInternal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    if (_slab != nullptr) {
+        if (freeInternal < RADIO_RESERVE_LOW_WATER) {
+            // Hand the slab to the heap so the radio stacks inherit it.
+            // Every release is the crash this module exists to absorb -
+            // if these show up in diagnostics, go find what ate the heap.
+            heap_caps_free(_slab);
+            _slab = nullptr;
+            _releases++;
+            LOG_W("Radio reserve: released %d bytes (internal free was %zu)",
+                  RADIO_RESERVE_SIZE, freeInternal);
+        }
+    } else if (freeInternal > RADIO_RESERVE_REARM) {
+        _slab = heap_caps_malloc(RADIO_RESERVE_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (_slab != nullptr) {
+            LOG_I("Radio reserve: re-armed (internal free %zu)", freeInternal);
+        }
+    }
+}
+
+RadioReserve::Stats RadioReserve::getStats() {
+    Stats stats;
+    stats.reserveSize = RADIO_RESERVE_SIZE;
+    stats.held = (_slab != nullptr);
+    stats.releases = _releases;
+    stats.freeInternal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    stats.minFreeInternal = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    stats.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return stats;
+}
@@ -0,0 +1,188 @@
+#include "request_arena.h"
+#include "config.h"
+#include "memory_utils.h"
+#include <esp_heap_caps.h>
+#include <Preferences.h>
+#include <string.h>
+
+int RequestArenaScope::_depth = 0;
+
+RequestArena& RequestArena::instance() {
+    static RequestArena arena;
+    return arena;
+}
+
+bool RequestArena::ensureRegion() {
+    if (_region) {
+        return true;
+    }
+    // Allocated once on first use and never freed - a single long-lived PSRAM
+    // block instead of per-request churn
+    _region = (uint8_t*)heap_caps_malloc(REGION_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return _region != nullptr;
+}
+
+bool RequestArena::ownsPointer(const void* ptr) const {
+    return _region && ptr >= _region && ptr < _region + REGION_SIZE;
+}
+
+void* RequestArena::alloc(size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    // Round up to keep 8-byte alignment for the next block
+    size_t aligned = (size + 7) & ~(size_t)7;
+
+    if (!ensureRegion() || _offset + BLOCK_HEADER + aligned > REGION_SIZE) {
+        // Arena missing or full - spill to the heap (freed by release())
+        _fallbackAllocs++;
+        return psram_malloc(size);
+    }
+
+    uint8_t* block = _region + _offset;
+    *(size_t*)block = size;  // Stash size for realloc's copy
+    _offset += BLOCK_HEADER + aligned;
+    if (_offset > _highWater) {
+        _highWater = _offset;
+    }
+    return block + BLOCK_HEADER;
+}
+
+void* RequestArena::realloc(void* ptr, size_t new_size) {
+    if (!ptr) {
+        return alloc(new_size);
+    }
+    if (!ownsPointer(ptr)) {
+        // Heap fallback block - let the heap handle it
+        return heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+
+    size_t old_size = *(size_t*)((uint8_t*)ptr - BLOCK_HEADER);
+    if (new_size <= old_size) {
+        return ptr;  // Shrinking - keep the block, waste is reclaimed on reset
+    }
+
+    void* new_ptr = alloc(new_size);
+    if (new_ptr) {
+        memcpy(new_ptr, ptr, old_size);
+    }
+    return new_ptr;
+}
+
+void RequestArena::release(void* ptr) {
+    if (!ptr || ownsPointer(ptr)) {
+        return;  // Arena blocks are reclaimed wholesale by reset()
+    }
+    heap_caps_free(ptr);
+}
+
+void RequestArena::reset() {
+    _offset = 0;
+}
+
+RequestArena::Stats RequestArena::getStats() const {
+    Stats stats;
+    stats.regionSize = REGION_SIZE;
+    stats.highWater = _highWater;
+    stats.fallbackAllocs = _fallbackAllocs;
+    return stats;
+}
+
+RequestArenaScope::RequestArenaScope() {
+    _depth++;
+}
+
+RequestArenaScope::~RequestArenaScope() {
+    if (--_depth == 0) {
+        RequestArena::instance().reset();
+    }
+}
+
+// =============================================================================
+// DocSizer
+// =============================================================================
+
+#define NVS_DOCSIZER_NAMESPACE "docsizer"
+#define NVS_DOCSIZER_TABLE     "hw"
+
+DocSizer& DocSizer::instance() {
+    static DocSizer sizer;
+    return sizer;
+}
+
+void DocSizer::load() {
+    if (_loaded) {
+        return;
+    }
+    _loaded = true;
+
+    Preferences prefs;
+    if (!prefs.begin(NVS_DOCSIZER_NAMESPACE, true)) {
+        return;  // Fresh flash - seeds apply until endpoints get hit
+    }
+    // Blob length is the version check: an endpoint added or removed means
+    // the table relearns from seeds rather than misattributing entries
+    if (prefs.getBytesLength(NVS_DOCSIZER_TABLE) == sizeof(_highWater)) {
+        prefs.getBytes(NVS_DOCSIZER_TABLE, _highWater, sizeof(_highWater));
+    }
+    prefs.end();
+}
+
+void DocSizer::maybeSave() {
+    uint32_t now = millis();
+    if (!_dirty || now - _lastSaveMs < SAVE_INTERVAL_MS) {
+        return;
+    }
+    _lastSaveMs = now;
+    _dirty = false;
+
+    Preferences prefs;
+    if (prefs.begin(NVS_DOCSIZER_NAMESPACE, false)) {
+        prefs.putBytes(NVS_DOCSIZER_TABLE, _highWater, sizeof(_highWater));
+        prefs.end();
+    }
+}
+
+size_t DocSizer::capacity(ArenaDocId id, size_t seed) {
+    load();
+    if (id >= ARENA_DOC_COUNT || _highWater[id] == 0) {
+        return seed;
+    }
+    // Learned high water plus 25% headroom, rounded up so small growth in
+    // a response doesn't trigger a relearn-save every request
+    size_t cap = _highWater[id] + _highWater[id] / 4;
+    cap = (cap + 255) & ~(size_t)255;
+    if (cap < DOC_CAP_MIN) cap = DOC_CAP_MIN;
+    if (cap > DOC_CAP_MAX) cap = DOC_CAP_MAX;
+    return cap;
+}
+
+void DocSizer::note(ArenaDocId id, const JsonDocument& doc) {
+    if (id >= ARENA_DOC_COUNT) {
+        return;
+    }
+    load();
+
+    size_t usage = doc.memoryUsage();
+    if (doc.overflowed()) {
+        // Response was truncated - double so the retry gets through, and
+        // make it visible: this is a response-correctness bug until the
+        // learned size catches up
+        _overflows++;
+        usage = doc.capacity() * 2;
+        if (usage > DOC_CAP_MAX) usage = DOC_CAP_MAX;
+        LOG_W("DocSizer: endpoint %u overflowed %u bytes, learning %u",
+              (unsigned)id, (unsigned)doc.capacity(), (unsigned)usage);
+    }
+
+    if (usage > _highWater[id]) {
+        _highWater[id] = usage;
+        _dirty = true;
+    }
+    maybeSave();
+}
+
+size_t DocSizer::learned(ArenaDocId id) const {
+    return (id < ARENA_DOC_COUNT) ? _highWater[id] : 0;
+}
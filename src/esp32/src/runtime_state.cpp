@@ -38,6 +38,29 @@ const ui_state_t& RuntimeState::get() const {
     return *const_cast<ui_state_t*>(_active);
 }
 
+void RuntimeState::snapshot(ui_state_t& out) const {
+    // Seqlock read: copy the active buffer, then verify no writer touched
+    // reader-visible memory during the copy. Writers bump _seq to odd
+    // before writing and to even after publishing, so an even, unchanged
+    // value brackets a consistent copy. Retries are rare - the write side
+    // is a struct copy plus a pointer swap.
+    for (;;) {
+        uint32_t seqBefore = _seq;
+        if (seqBefore & 1) {
+            // Write in progress - yield so a same-core writer can finish
+            taskYIELD();
+            continue;
+        }
+        __sync_synchronize();
+        memcpy(&out, const_cast<const ui_state_t*>(_active), sizeof(ui_state_t));
+        __sync_synchronize();
+        if (_seq == seqBefore) {
+            return;
+        }
+        taskYIELD();
+    }
+}
+
 ui_state_t& RuntimeState::beginUpdate() {
     if (_mutex == nullptr) {
         LOG_E("RuntimeState not initialized - call begin() first");
@@ -52,6 +75,12 @@ ui_state_t& RuntimeState::beginUpdate() {
         return *const_cast<ui_state_t*>(_active);
     }
     
+    // Mark write-in-progress for snapshot() readers: the writing buffer was
+    // the active buffer one swap ago, and a slow reader may still be
+    // copying from it
+    _seq++;
+    __sync_synchronize();
+
     // Copy current state to writing buffer to preserve fields not updated in this call
     // This copy happens INSIDE the mutex, so any secondary updates that happened
     // before we took the mutex are included in this copy
@@ -71,7 +100,11 @@ void RuntimeState::endUpdate() {
     
     // Swap buffers atomically (inside mutex)
     swapBuffers();
-    
+
+    // Publish for snapshot() readers (back to even)
+    __sync_synchronize();
+    _seq++;
+
     // Release mutex
     xSemaphoreGive(_mutex);
 }
@@ -85,15 +118,23 @@ void RuntimeState::updateWiFi(bool connected, bool apMode, int rssi) {
         // Cast away volatile for field access (safe inside mutex)
         ui_state_t* activePtr = const_cast<ui_state_t*>(_active);
         ui_state_t* writingPtr = const_cast<ui_state_t*>(_writing);
-        
+
+        // These patch the active buffer in place - bracket with _seq so
+        // snapshot() readers retry instead of seeing a half-applied update
+        _seq++;
+        __sync_synchronize();
+
         activePtr->wifi_connected = connected;
         activePtr->wifi_ap_mode = apMode;
         if (rssi != 0) activePtr->wifi_rssi = rssi;
-        
+
         writingPtr->wifi_connected = connected;
         writingPtr->wifi_ap_mode = apMode;
         if (rssi != 0) writingPtr->wifi_rssi = rssi;
-        
+
+        __sync_synchronize();
+        _seq++;
+
         xSemaphoreGive(_mutex);
     } else {
         // Defensive check - should never happen with portMAX_DELAY
@@ -110,10 +151,14 @@ void RuntimeState::updatePicoConnection(bool connected) {
         // Cast away volatile for field access (safe inside mutex)
         ui_state_t* activePtr = const_cast<ui_state_t*>(_active);
         ui_state_t* writingPtr = const_cast<ui_state_t*>(_writing);
-        
+
+        _seq++;
+        __sync_synchronize();
         activePtr->pico_connected = connected;
         writingPtr->pico_connected = connected;
-        
+        __sync_synchronize();
+        _seq++;
+
         xSemaphoreGive(_mutex);
     } else {
         // Defensive check - should never happen with portMAX_DELAY
@@ -130,10 +175,14 @@ void RuntimeState::updateScaleConnection(bool connected) {
         // Cast away volatile for field access (safe inside mutex)
         ui_state_t* activePtr = const_cast<ui_state_t*>(_active);
         ui_state_t* writingPtr = const_cast<ui_state_t*>(_writing);
-        
+
+        _seq++;
+        __sync_synchronize();
         activePtr->scale_connected = connected;
         writingPtr->scale_connected = connected;
-        
+        __sync_synchronize();
+        _seq++;
+
         xSemaphoreGive(_mutex);
     } else {
         // Defensive check - should never happen with portMAX_DELAY
@@ -75,6 +75,52 @@ scale_type_t detectScaleType(const char* name) {
     return SCALE_TYPE_UNKNOWN;
 }
 
+scale_noise_params_t getScaleNoiseParams(scale_type_t type) {
+    // process_noise: how much real flow is allowed to change between updates.
+    //   Espresso flow ramps at ~1-2 g/s^2 worst case, so 4.0 (= 2^2) tracks a
+    //   channeling shot without the filter going twitchy.
+    // measurement_noise: variance of a single BLE weight sample. Driven by the
+    //   scale's resolution and how jittery its report stream is.
+    switch (type) {
+        case SCALE_TYPE_ACAIA:
+        case SCALE_TYPE_BOOKOO:
+            return {4.0f, 0.01f};   // 0.1g resolution, clean report stream
+        case SCALE_TYPE_DECENT:
+            return {4.0f, 0.04f};   // 0.1g resolution, slightly noisier stream
+        case SCALE_TYPE_FELICITA:
+        case SCALE_TYPE_TIMEMORE:
+            return {4.0f, 0.09f};   // ASCII stream, visible sample jitter
+        case SCALE_TYPE_GENERIC_WSS:
+            return {4.0f, 25.0f};   // Standard WSS is 5g resolution
+        default:
+            return {4.0f, 0.09f};
+    }
+}
+
+scale_conn_params_t getScaleConnParams(scale_type_t type) {
+    // Intervals in 1.25ms units, timeout in 10ms units. The ceiling is what
+    // matters: a 10Hz weight stream needs interval * (1 + latency) <= 100ms,
+    // so latency stays 0 everywhere and every ceiling sits well under 80
+    // units (100ms). Floors leave the scale some radio slack - pushing a
+    // battery scale to 7.5ms buys nothing over its own report rate.
+    // bondable marks models that keep bonds; the rest drop pairing state on
+    // power-off and re-pair clean each session.
+    switch (type) {
+        case SCALE_TYPE_ACAIA:
+        case SCALE_TYPE_BOOKOO:
+            return {12, 24, 0, 200, false};  // 15-30ms, clean 10Hz stream
+        case SCALE_TYPE_DECENT:
+            return {12, 24, 0, 200, false};
+        case SCALE_TYPE_FELICITA:
+        case SCALE_TYPE_TIMEMORE:
+            return {16, 32, 0, 300, false};  // 20-40ms, ASCII stream is slower anyway
+        case SCALE_TYPE_GENERIC_WSS:
+            return {24, 48, 0, 400, true};   // Standard WSS profile expects bonding
+        default:
+            return {12, 32, 0, 300, false};
+    }
+}
+
 const char* getScaleTypeName(scale_type_t type) {
     switch (type) {
         case SCALE_TYPE_ACAIA:      return "Acaia";
@@ -6,6 +6,7 @@
 
 #include "scale/scale_manager.h"
 #include "scale/scale_interface.h"
+#include "runtime_state.h"
 #include "config.h"
 #include <Preferences.h>
 
@@ -60,6 +61,40 @@ static const uint8_t ACAIA_TIMER_START[] = {0x00, 0x0D, 0x00};
 static const uint8_t ACAIA_TIMER_STOP[] = {0x00, 0x0D, 0x01};
 static const uint8_t ACAIA_TIMER_RESET[] = {0x00, 0x0D, 0x02};
 
+// =============================================================================
+// Per-Model Decoder Dispatch Table
+// =============================================================================
+// Decoders are pure functions (defined in their model's section below) and
+// are resolved from this table once, when characteristics are set up. The
+// notification path then calls straight through the cached function pointer -
+// no virtual dispatch and no switch on scale type per packet.
+
+static bool decodeAcaiaWeight(const uint8_t* data, size_t length, scale_sample_t* out);
+static bool decodeFelicitaWeight(const uint8_t* data, size_t length, scale_sample_t* out);
+static bool decodeDecentWeight(const uint8_t* data, size_t length, scale_sample_t* out);
+static bool decodeGenericWeight(const uint8_t* data, size_t length, scale_sample_t* out);
+
+static const struct {
+    scale_type_t type;
+    scale_decoder_fn decode;
+} SCALE_DECODERS[] = {
+    { SCALE_TYPE_ACAIA,       decodeAcaiaWeight },
+    { SCALE_TYPE_BOOKOO,      decodeAcaiaWeight },     // Acaia-compatible protocol
+    { SCALE_TYPE_FELICITA,    decodeFelicitaWeight },
+    { SCALE_TYPE_TIMEMORE,    decodeFelicitaWeight },  // Same ASCII stream
+    { SCALE_TYPE_DECENT,      decodeDecentWeight },
+    { SCALE_TYPE_GENERIC_WSS, decodeGenericWeight },
+};
+
+static scale_decoder_fn decoderFor(scale_type_t type) {
+    for (size_t i = 0; i < sizeof(SCALE_DECODERS) / sizeof(SCALE_DECODERS[0]); i++) {
+        if (SCALE_DECODERS[i].type == type) {
+            return SCALE_DECODERS[i].decode;
+        }
+    }
+    return nullptr;
+}
+
 // =============================================================================
 // Constructor / Destructor
 // =============================================================================
@@ -72,14 +107,37 @@ ScaleManager::ScaleManager()
     , _connected(false)
     , _connecting(false)
     , _scaleType(SCALE_TYPE_UNKNOWN)
+    , _scaleAddrType(0)
+    , _gattVariant(0)
     , _lastWeightTime(0)
     , _lastReconnectAttempt(0)
     , _autoReconnect(true)
-    , _lastWeight(0)
-    , _lastFlowTime(0)
+    , _reconnectDelayMs(SCALE_RECONNECT_IDLE_MS)
+    , _dropTime(0)
+    , _droppedMidBrew(false)
+    , _reconnectStats{}
+    , _connParams{}
+    , _connStats{}
+    , _connCheckTime(0)
+    , _connParamRetried(false)
+    , _rawWeight(0)
+    , _haveRawSample(false)
+    , _lastFilterTime(0)
+    , _noise{4.0f, 0.09f}
+    , _autoTareEnabled(true)
+    , _autoTareBaseline(0)
+    , _autoTarePending(false)
+    , _autoTareStepTime(0)
+    , _lastAutoTareTime(0)
+    , _autoTareCount(0)
+    , _scanStats{}
+    , _scanStartTime(0)
+    , _decoder(nullptr)
+    , _sampleHead(0)
+    , _sampleTail(0)
     , _weightChar(nullptr)
     , _commandChar(nullptr) {
-    
+
     _instance = this;
     memset(&_state, 0, sizeof(_state));
     memset(_scaleName, 0, sizeof(_scaleName));
@@ -103,7 +161,11 @@ bool ScaleManager::begin() {
     // Initialize NimBLE
     NimBLEDevice::init("BrewOS");
     NimBLEDevice::setPower(ESP_PWR_LVL_P9);  // Max power for range
-    NimBLEDevice::setSecurityAuth(false, false, false);  // No bonding needed
+    // Bonding on (no MITM/SC): models that keep bonds pair once and just
+    // encrypt on reconnect; models that don't simply never initiate
+    // security, so this costs them nothing. Keys persist across reboots
+    // (CONFIG_BT_NIMBLE_NVS_PERSIST in platformio.ini).
+    NimBLEDevice::setSecurityAuth(true, false, false);
     
     // Create client
     _client = NimBLEDevice::createClient();
@@ -111,12 +173,13 @@ bool ScaleManager::begin() {
     _client->setConnectionParams(12, 12, 0, 200);  // Fast connection
     _client->setConnectTimeout(10);
     
-    // Get scanner
+    // Get scanner - interval/window are set per scan in startScan() so the
+    // duty cycle can follow machine state
     _scan = NimBLEDevice::getScan();
     _scan->setAdvertisedDeviceCallbacks(this, false);
     _scan->setActiveScan(true);
-    _scan->setInterval(100);
-    _scan->setWindow(99);
+    _scan->setInterval(SCALE_SCAN_INTERVAL_MS);
+    _scan->setWindow(SCALE_SCAN_WINDOW_SETUP_MS);
     
     // Load saved scale from preferences
     loadSavedScale();
@@ -150,9 +213,12 @@ void ScaleManager::end() {
 
 void ScaleManager::loop() {
     if (!_initialized) return;
-    
+
     uint32_t now = millis();
-    
+
+    // Pull decoded samples out of the notification ring onto our thread
+    drainSampleRing();
+
     // Check for connection timeout
     if (_connected && _lastWeightTime > 0) {
         if (now - _lastWeightTime > SCALE_WEIGHT_TIMEOUT_MS) {
@@ -161,10 +227,73 @@ void ScaleManager::loop() {
         }
     }
     
-    // Auto-reconnect to saved scale
-    if (!_connected && !_connecting && !_scanning && _autoReconnect) {
-        if (strlen(_scaleAddress) > 0 && (now - _lastReconnectAttempt > SCALE_RECONNECT_DELAY_MS)) {
+    // A shot starting mid-scan wins: kill the scan so BLE doesn't fight WiFi
+    // for the radio right when UI and cloud latency matter most
+    if (_scanning && runtimeState().get().is_brewing) {
+        LOG_W("Brew started during BLE scan - aborting scan");
+        _scanStats.abortedByBrew++;
+        stopScan();
+    }
+
+    // Run the weight/flow estimator at its fixed rate. BLE samples land
+    // whenever the scale feels like it (5-10Hz, jittery); the filter ticks
+    // on our clock so dt is constant and flow estimates stay clean.
+    if (_connected && _haveRawSample && (now - _lastFilterTime) >= SCALE_FILTER_PERIOD_MS) {
+        updateFilter(now);
+    }
+
+    // Verify the negotiated connection interval once the post-connect
+    // parameter update has had time to settle
+    if (_connected && _connCheckTime != 0 && now >= _connCheckTime) {
+        verifyConnParams(now);
+    }
+
+    // Auto-reconnect to the saved scale. Cadence is a policy keyed on machine
+    // state: heating/ready means a shot is plausibly next, so probe the saved
+    // address on a fast fixed cadence; during the shot itself reconnects are
+    // suppressed - a directed connect can hold the radio for the whole connect
+    // timeout right when pump control and UI latency matter - unless the scale
+    // dropped mid-shot, where one quick retry is worth the blip to get the
+    // weight trace back; everywhere else back off exponentially so an absent
+    // scale doesn't ping forever.
+    if (!_connected && !_connecting && !_scanning && _autoReconnect &&
+        strlen(_scaleAddress) > 0) {
+        uint8_t machineState = runtimeState().get().machine_state;
+        bool suppressed = false;
+        uint32_t delay = _reconnectDelayMs;
+
+        switch (machineState) {
+            case UI_STATE_HEATING:
+            case UI_STATE_READY:
+                delay = SCALE_RECONNECT_ACTIVE_MS;
+                break;
+            case UI_STATE_BREWING:
+                if (_droppedMidBrew) {
+                    delay = SCALE_RECONNECT_DROP_FAST_MS;
+                } else {
+                    suppressed = true;
+                }
+                break;
+            case UI_STATE_ECO:
+                // Overnight standby: keep the radio quiet entirely. Probing
+                // resumes the instant the machine leaves eco - this runs
+                // every loop pass, so wake is effectively immediate.
+                suppressed = true;
+                break;
+            default:
+                // Idle/fault: delay already holds the current backoff
+                break;
+        }
+
+        if (!suppressed && (now - _lastReconnectAttempt > delay)) {
             _lastReconnectAttempt = now;
+            if (machineState == UI_STATE_BREWING) {
+                _droppedMidBrew = false;  // One mid-shot attempt only
+            } else if (machineState != UI_STATE_HEATING && machineState != UI_STATE_READY) {
+                _reconnectDelayMs = min(_reconnectDelayMs * 2,
+                                        (uint32_t)SCALE_RECONNECT_IDLE_MAX_MS);
+            }
+            _reconnectStats.attempts++;
             LOG_I("Attempting to reconnect to %s", _scaleAddress);
             connect(_scaleAddress);
         }
@@ -192,17 +321,27 @@ void ScaleManager::loop() {
 
 void ScaleManager::startScan(uint32_t duration_ms) {
     if (_scanning || _connecting) return;
-    
+
     if (duration_ms == 0) duration_ms = SCALE_SCAN_DURATION_MS;
-    
-    LOG_I("Starting BLE scan for %d ms", duration_ms);
-    
+
+    // Duty cycle follows machine state: go aggressive only when the machine
+    // is free and a shot is plausibly being set up, back off when it's busy
+    // so the scan doesn't spike WebSocket/cloud latency mid-shot
+    uint16_t window = pickScanWindow();
+    _scan->setWindow(window);
+
+    LOG_I("Starting BLE scan for %d ms (window %u/%u ms)",
+          duration_ms, window, SCALE_SCAN_INTERVAL_MS);
+
     _discoveredScales.clear();
     _scanning = true;
-    
+    _scanStartTime = millis();
+    _scanStats.scans++;
+    _scanStats.lastWindowMs = window;
+
     _scan->start(duration_ms / 1000, [](NimBLEScanResults results) {
         if (_instance) {
-            _instance->_scanning = false;
+            _instance->scanEnded();
             LOG_I("Scan complete, found %d devices", results.getCount());
         }
     }, false);
@@ -210,12 +349,28 @@ void ScaleManager::startScan(uint32_t duration_ms) {
 
 void ScaleManager::stopScan() {
     if (!_scanning) return;
-    
+
     _scan->stop();
-    _scanning = false;
+    scanEnded();
     LOG_I("Scan stopped");
 }
 
+uint16_t ScaleManager::pickScanWindow() const {
+    const ui_state_t& machine = runtimeState().get();
+    if (machine.is_brewing || machine.is_heating) {
+        return SCALE_SCAN_WINDOW_QUIET_MS;
+    }
+    return SCALE_SCAN_WINDOW_SETUP_MS;
+}
+
+void ScaleManager::scanEnded() {
+    // Called from both stopScan() and the scan-complete callback; NimBLE can
+    // fire the callback on an explicit stop, so guard against counting twice
+    if (!_scanning) return;
+    _scanning = false;
+    _scanStats.totalScanMs += millis() - _scanStartTime;
+}
+
 // =============================================================================
 // Connection
 // =============================================================================
@@ -236,9 +391,12 @@ bool ScaleManager::connect(const char* address) {
     
     LOG_I("Connecting to scale: %s", address);
     _connecting = true;
-    
-    NimBLEAddress addr(address);
-    
+
+    // Use the cached address type for the saved scale - a direct connect to a
+    // random-address scale with the wrong type burns the whole connect timeout
+    uint8_t addrType = (strcmp(address, _scaleAddress) == 0) ? _scaleAddrType : BLE_ADDR_PUBLIC;
+    NimBLEAddress addr(address, addrType);
+
     if (!_client->connect(addr)) {
         LOG_E("Failed to connect to %s", address);
         _connecting = false;
@@ -262,13 +420,24 @@ void ScaleManager::disconnect() {
     if (_client && _client->isConnected()) {
         _client->disconnect();
     }
-    
+
+    // Deliberate teardown, not a drop: don't count it, and start the next
+    // reconnect round (weight timeout lands here too) from a fresh backoff
+    _dropTime = 0;
+    _droppedMidBrew = false;
+    _reconnectDelayMs = SCALE_RECONNECT_IDLE_MS;
+
     _connected = false;
     _connecting = false;
+    _decoder = nullptr;  // Stops any straggling notification from decoding
     _weightChar = nullptr;
     _commandChar = nullptr;
+    _connCheckTime = 0;
+    _connStats.intervalUnits = 0;
+    _connStats.latency = 0;
     _state.connected = false;
-    
+    resetFilter();
+
     if (_connectionCallback) {
         _connectionCallback(false);
     }
@@ -285,8 +454,10 @@ void ScaleManager::forgetScale() {
     memset(_scaleAddress, 0, sizeof(_scaleAddress));
     memset(_scaleName, 0, sizeof(_scaleName));
     _scaleType = SCALE_TYPE_UNKNOWN;
+    _scaleAddrType = 0;
+    _gattVariant = 0;
     _autoReconnect = false;
-    
+
     LOG_I("Scale forgotten");
 }
 
@@ -321,6 +492,18 @@ void ScaleManager::tare() {
     LOG_I("Tare command sent");
 }
 
+void ScaleManager::setAutoTare(bool enabled) {
+    _autoTareEnabled = enabled;
+    _autoTarePending = false;
+
+    Preferences prefs;
+    prefs.begin(NVS_SCALE_NAMESPACE, false);
+    prefs.putBool(NVS_SCALE_AUTO_TARE, enabled);
+    prefs.end();
+
+    LOG_I("Placement auto-tare %s", enabled ? "enabled" : "disabled");
+}
+
 void ScaleManager::startTimer() {
     if (!_connected || !_commandChar) return;
     
@@ -377,7 +560,37 @@ void ScaleManager::onConnect(NimBLEClient* client) {
     _connecting = false;
     _lastWeightTime = millis();
     _state.connected = true;
-    
+
+    // Close out a pending drop: record how long the scale was gone and reset
+    // the reconnect machine for the next one
+    if (_dropTime != 0) {
+        _reconnectStats.reconnects++;
+        _reconnectStats.lastLatencyMs = millis() - _dropTime;
+        _reconnectStats.totalLatencyMs += _reconnectStats.lastLatencyMs;
+        _dropTime = 0;
+    }
+    _droppedMidBrew = false;
+    _reconnectDelayMs = SCALE_RECONNECT_IDLE_MS;
+
+    // Cache the address type for fast directed reconnects
+    _scaleAddrType = _client->getPeerAddress().getType();
+
+    // Arm the estimator with this model's noise tuning
+    _noise = getScaleNoiseParams(_scaleType);
+    resetFilter();
+
+    // Enforce this model's preferred connection parameters. The connect
+    // itself lands on whatever the peripheral asked for - sometimes a
+    // power-saving interval that caps the weight stream below the 10Hz
+    // brew-by-weight budget - so re-negotiate immediately and verify once
+    // the update has settled (updateConnParams is asynchronous).
+    _connParams = getScaleConnParams(_scaleType);
+    client->updateConnParams(_connParams.min_interval, _connParams.max_interval,
+                             _connParams.latency, _connParams.timeout);
+    _connStats.enforcements++;
+    _connCheckTime = millis() + SCALE_CONN_CHECK_DELAY_MS;
+    _connParamRetried = false;
+
     // Save to NVS for auto-reconnect
     saveScale();
     
@@ -390,18 +603,95 @@ void ScaleManager::onConnect(NimBLEClient* client) {
 
 void ScaleManager::onDisconnect(NimBLEClient* client) {
     LOG_W("BLE disconnected");
-    
+
+    // _connected still true here means the link dropped on its own -
+    // disconnect() clears it before the host task delivers this callback
+    if (_connected && _autoReconnect) {
+        _reconnectStats.drops++;
+        _dropTime = millis();
+        _reconnectDelayMs = SCALE_RECONNECT_IDLE_MS;
+        if (runtimeState().get().is_brewing) {
+            _reconnectStats.midBrewDrops++;
+            _droppedMidBrew = true;
+        }
+    }
+
     _connected = false;
     _connecting = false;
+    _decoder = nullptr;  // Stops any straggling notification from decoding
     _weightChar = nullptr;
     _commandChar = nullptr;
+    _connCheckTime = 0;
+    _connStats.intervalUnits = 0;
+    _connStats.latency = 0;
     _state.connected = false;
-    
+    resetFilter();
+
     if (_connectionCallback) {
         _connectionCallback(false);
     }
 }
 
+bool ScaleManager::onConnParamsUpdateRequest(NimBLEClient* client, const ble_gap_upd_params* params) {
+    // The scale asking to slow down. Fine in principle, but never below
+    // the weight sample budget - a granted 1-second interval mid-session
+    // is exactly the silent 2Hz stream this guards against.
+    uint32_t periodMs = (uint32_t)params->itvl_max * (1 + params->latency) * 125 / 100;
+    if (periodMs > SCALE_MAX_SAMPLE_PERIOD_MS) {
+        _connStats.peerRejects++;
+        LOG_W("Rejected scale conn param request: %ums effective period (budget %ums)",
+              (unsigned)periodMs, SCALE_MAX_SAMPLE_PERIOD_MS);
+        return false;
+    }
+    return true;
+}
+
+void ScaleManager::verifyConnParams(uint32_t now) {
+    _connCheckTime = 0;
+    if (!_client || !_client->isConnected()) {
+        return;
+    }
+
+    // Bonded models: establish (or refresh) encryption from here rather
+    // than onConnect - secureConnection() blocks, and the NimBLE host task
+    // that runs the callbacks must stay free to service it
+    if (_connParams.bondable && !NimBLEDevice::isBonded(_client->getPeerAddress())) {
+        if (_client->secureConnection()) {
+            LOG_I("Scale bonded: %s", _scaleAddress);
+        } else {
+            LOG_W("Scale bonding failed, continuing unencrypted");
+        }
+    }
+
+    NimBLEConnInfo info = _client->getConnInfo();
+    uint16_t itvl = info.getConnInterval();    // 1.25ms units
+    uint16_t latency = info.getConnLatency();
+    _connStats.intervalUnits = itvl;
+    _connStats.latency = latency;
+
+    // Worst-case gap between connection events that can carry a sample
+    uint32_t periodMs = (uint32_t)itvl * (1 + latency) * 125 / 100;
+    LOG_I("Scale conn params: interval %u.%02ums, latency %u (%s)",
+          itvl * 125 / 100, (itvl * 125) % 100, latency,
+          periodMs <= SCALE_MAX_SAMPLE_PERIOD_MS ? "meets 10Hz budget" : "too slow");
+
+    if (periodMs > SCALE_MAX_SAMPLE_PERIOD_MS) {
+        if (!_connParamRetried) {
+            // One more attempt - some peripherals reject the first update
+            // while their own post-connect work is still running
+            _connParamRetried = true;
+            _client->updateConnParams(_connParams.min_interval, _connParams.max_interval,
+                                      _connParams.latency, _connParams.timeout);
+            _connStats.enforcements++;
+            _connCheckTime = now + SCALE_CONN_CHECK_DELAY_MS;
+        } else {
+            _connStats.slowSessions++;
+            LOG_W("Scale held %ums effective period - weight stream capped below 10Hz",
+                  (unsigned)periodMs);
+        }
+    }
+}
+
 void ScaleManager::onResult(NimBLEAdvertisedDevice* device) {
     String name = device->getName().c_str();
     
@@ -455,11 +745,28 @@ void ScaleManager::onResult(NimBLEAdvertisedDevice* device) {
 // Notification Callback (static)
 // =============================================================================
 
-void ScaleManager::notifyCallback(NimBLERemoteCharacteristic* chr, uint8_t* data, 
+// Runs in the NimBLE host task. Decode through the cached per-model function
+// pointer into a fixed sample and push it onto the ring - no locks, no
+// allocation, and nothing shared with loop() beyond the ring indices, so the
+// callback returns in microseconds regardless of what the main loop is doing.
+void ScaleManager::notifyCallback(NimBLERemoteCharacteristic* chr, uint8_t* data,
                                    size_t length, bool isNotify) {
-    if (_instance) {
-        _instance->processWeightData(data, length);
+    ScaleManager* self = _instance;
+    if (!self || !self->_decoder) return;
+
+    scale_sample_t sample;
+    if (!self->_decoder(data, length, &sample)) {
+        return;  // Not a weight packet (ack, timer, key event, ...)
+    }
+    sample.rx_ms = millis();
+
+    uint8_t head = self->_sampleHead;
+    uint8_t next = (head + 1) & (SAMPLE_RING_SIZE - 1);
+    if (next == self->_sampleTail) {
+        return;  // Ring full - drop; the next report supersedes this one
     }
+    self->_sampleRing[head] = sample;
+    self->_sampleHead = next;
 }
 
 // =============================================================================
@@ -482,7 +789,10 @@ void ScaleManager::loadSavedScale() {
     prefs.getString(NVS_SCALE_ADDRESS, _scaleAddress, sizeof(_scaleAddress));
     prefs.getString(NVS_SCALE_NAME, _scaleName, sizeof(_scaleName));
     _scaleType = (scale_type_t)prefs.getUChar(NVS_SCALE_TYPE, SCALE_TYPE_UNKNOWN);
-    
+    _scaleAddrType = prefs.getUChar(NVS_SCALE_ADDR_TYPE, 0);
+    _gattVariant = prefs.getUChar(NVS_SCALE_GATT_VAR, 0);
+    _autoTareEnabled = prefs.getBool(NVS_SCALE_AUTO_TARE, true);
+
     prefs.end();
     
     if (strlen(_scaleAddress) > 0) {
@@ -497,7 +807,9 @@ void ScaleManager::saveScale() {
     prefs.putString(NVS_SCALE_ADDRESS, _scaleAddress);
     prefs.putString(NVS_SCALE_NAME, _scaleName);
     prefs.putUChar(NVS_SCALE_TYPE, (uint8_t)_scaleType);
-    
+    prefs.putUChar(NVS_SCALE_ADDR_TYPE, _scaleAddrType);
+    prefs.putUChar(NVS_SCALE_GATT_VAR, _gattVariant);
+
     prefs.end();
     
     LOG_I("Saved scale to NVS");
@@ -506,23 +818,35 @@ void ScaleManager::saveScale() {
 bool ScaleManager::setupCharacteristics() {
     // Get connected device info
     NimBLEAddress addr = _client->getPeerAddress();
+
+    // Reconnect fast path: for the saved scale we already know the name and
+    // model, so skip the GAP service discovery + name read a cold connect
+    // needs. NimBLE offers no way to seed remote handles outright, so the
+    // scale's data service still gets one (targeted) discovery pass below.
+    bool knownScale = (_scaleType != SCALE_TYPE_UNKNOWN) &&
+                      (strcmp(addr.toString().c_str(), _scaleAddress) == 0);
+
     strncpy(_scaleAddress, addr.toString().c_str(), sizeof(_scaleAddress) - 1);
-    
-    // Try to get name from remote device
-    NimBLERemoteService* gapSvc = _client->getService(NimBLEUUID((uint16_t)0x1800));
-    if (gapSvc) {
-        NimBLERemoteCharacteristic* nameChar = gapSvc->getCharacteristic(NimBLEUUID((uint16_t)0x2A00));
-        if (nameChar && nameChar->canRead()) {
-            std::string name = nameChar->readValue();
-            if (name.length() > 0) {
-                strncpy(_scaleName, name.c_str(), sizeof(_scaleName) - 1);
+
+    if (!knownScale) {
+        _gattVariant = 0;  // New device - forget any cached layout
+
+        // Try to get name from remote device
+        NimBLERemoteService* gapSvc = _client->getService(NimBLEUUID((uint16_t)0x1800));
+        if (gapSvc) {
+            NimBLERemoteCharacteristic* nameChar = gapSvc->getCharacteristic(NimBLEUUID((uint16_t)0x2A00));
+            if (nameChar && nameChar->canRead()) {
+                std::string name = nameChar->readValue();
+                if (name.length() > 0) {
+                    strncpy(_scaleName, name.c_str(), sizeof(_scaleName) - 1);
+                }
             }
         }
+
+        // Detect type from name or services
+        _scaleType = detectScaleType(_scaleName);
     }
     
-    // Detect type from name or services
-    _scaleType = detectScaleType(_scaleName);
-    
     // Setup based on type
     bool success = false;
     switch (_scaleType) {
@@ -547,62 +871,123 @@ bool ScaleManager::setupCharacteristics() {
             if (success) _scaleType = SCALE_TYPE_GENERIC_WSS;
             break;
     }
-    
+
+    if (success) {
+        // Resolve the packet decoder once; notifications dispatch through
+        // the cached pointer from here on. Reset the ring so a reconnect
+        // doesn't replay samples from the previous session.
+        _decoder = decoderFor(_scaleType);
+        _sampleHead = 0;
+        _sampleTail = 0;
+        if (!_decoder) {
+            LOG_E("No decoder for scale type %d", _scaleType);
+            success = false;
+        }
+    }
+
     return success;
 }
 
-void ScaleManager::processWeightData(const uint8_t* data, size_t length) {
-    _lastWeightTime = millis();
-    
-    switch (_scaleType) {
-        case SCALE_TYPE_ACAIA:
-            parseAcaiaWeight(data, length);
-            break;
-        case SCALE_TYPE_BOOKOO:
-            parseBookooWeight(data, length);
-            break;
-        case SCALE_TYPE_FELICITA:
-            parseFelicitaWeight(data, length);
-            break;
-        case SCALE_TYPE_DECENT:
-            parseDecentWeight(data, length);
-            break;
-        case SCALE_TYPE_TIMEMORE:
-            parseTimemoreWeight(data, length);
-            break;
-        case SCALE_TYPE_GENERIC_WSS:
-            parseGenericWeight(data, length);
-            break;
-        default:
-            break;
+void ScaleManager::drainSampleRing() {
+    // Consumer side of the notification ring (loop() only). The latest
+    // sample wins as the filter measurement; rx_ms is the BLE arrival time,
+    // kept for latency accounting. Smoothed outputs (and the weight
+    // callback) come from the fixed-rate filter tick, not from BLE arrival.
+    while (_sampleTail != _sampleHead) {
+        const scale_sample_t& sample = _sampleRing[_sampleTail];
+        _lastWeightTime = sample.rx_ms;
+        _state.last_update_ms = sample.rx_ms;
+        _state.weight = sample.weight;
+        _state.stable = sample.stable;
+        _rawWeight = sample.weight;
+        _haveRawSample = true;
+        _sampleTail = (_sampleTail + 1) & (SAMPLE_RING_SIZE - 1);
     }
-    
-    // Update flow rate
-    updateFlowRate(_state.weight);
-    
-    // Notify callback
+}
+
+void ScaleManager::resetFilter() {
+    _haveRawSample = false;
+    _lastFilterTime = millis();
+    _filter.setNoise(_noise.process_noise, _noise.measurement_noise);
+    _filter.reset(_lastFilterTime);
+    _state.flow_rate = 0;
+    _state.flow_derivative = 0;
+}
+
+void ScaleManager::updateFilter(uint32_t now) {
+    _lastFilterTime = now;
+
+    // The raw sample is re-used unchanged if the scale hasn't reported since
+    // the last tick - flow then settles toward 0
+    _filter.update(_rawWeight, now);
+
+    _state.weight = _filter.weight();
+    _state.flow_rate = _filter.flow();
+    _state.flow_derivative = _filter.flowDerivative();
+
+    updateAutoTare(now);
+
     if (_weightCallback) {
         _weightCallback(_state);
     }
 }
 
-void ScaleManager::updateFlowRate(float weight) {
-    uint32_t now = millis();
-    uint32_t dt = now - _lastFlowTime;
-    
-    if (dt >= 200) {  // Calculate every 200ms
-        float dw = weight - _lastWeight;
-        float instantFlow = (dw / (float)dt) * 1000.0f;  // g/s
-        
-        // Apply exponential smoothing
-        _state.flow_rate = instantFlow * 0.3f + _state.flow_rate * 0.7f;
-        
-        // Clamp to reasonable values
-        if (_state.flow_rate < 0) _state.flow_rate = 0;
-        if (_state.flow_rate > 20) _state.flow_rate = 20;
-        
-        _lastWeight = weight;
-        _lastFlowTime = now;
+// Vessel-placement classifier on the Kalman state. A cup landing reads as
+// a positive step of at least SCALE_AUTOTARE_STEP_G over the settled
+// baseline, with flow collapsing back to ~0 while the weight holds. Armed
+// only while the machine reports heating/ready - those states come from
+// the Pico, so the classifier is effectively gated on "a shot is plausibly
+// next". During the shot itself a step is a bumped cup, never a placement,
+// and while idle it's cleanup. The tare rides the existing command
+// characteristic (write-without-response), so there is no extra latency
+// over a manual tare.
+void ScaleManager::updateAutoTare(uint32_t now) {
+    if (!_autoTareEnabled || !_connected) {
+        _autoTarePending = false;
+        return;
+    }
+
+    uint8_t machineState = runtimeState().get().machine_state;
+    if (machineState != UI_STATE_HEATING && machineState != UI_STATE_READY) {
+        // Track the weight anyway so a state change right after a vessel
+        // lands doesn't read as a fresh step
+        _autoTarePending = false;
+        _autoTareBaseline = _state.weight;
+        return;
+    }
+
+    float step = _state.weight - _autoTareBaseline;
+    bool settled = _state.flow_rate < SCALE_AUTOTARE_SETTLE_FLOW_GS;
+
+    if (!_autoTarePending) {
+        if (step >= SCALE_AUTOTARE_STEP_G &&
+            now - _lastAutoTareTime >= SCALE_AUTOTARE_MIN_INTERVAL_MS) {
+            _autoTarePending = true;
+            _autoTareStepTime = now;
+        } else if (settled) {
+            // No step in sight - follow drift so the baseline stays honest
+            _autoTareBaseline = _state.weight;
+        }
+        return;
+    }
+
+    // Step pending: dropping back toward the baseline means the vessel was
+    // lifted off again; movement restarts the settle clock
+    if (step < SCALE_AUTOTARE_STEP_G * 0.5f) {
+        _autoTarePending = false;
+        return;
+    }
+    if (!settled) {
+        _autoTareStepTime = now;
+        return;
+    }
+    if (now - _autoTareStepTime >= SCALE_AUTOTARE_SETTLE_MS) {
+        _autoTarePending = false;
+        _lastAutoTareTime = now;
+        _autoTareCount++;
+        _autoTareBaseline = 0;  // Tare zeroes the reading
+        LOG_I("Auto-tare: vessel detected (+%.1fg settled)", step);
+        tare();
     }
 }
 
@@ -650,29 +1035,32 @@ bool ScaleManager::setupAcaia() {
     return true;
 }
 
-void ScaleManager::parseAcaiaWeight(const uint8_t* data, size_t length) {
-    if (length < 6) return;
-    
+// Also used for Bookoo Themis (Acaia-compatible protocol)
+static bool decodeAcaiaWeight(const uint8_t* data, size_t length, scale_sample_t* out) {
+    if (length < 6) return false;
+
     // Check header
-    if (data[0] != ACAIA_HEADER[0] || data[1] != ACAIA_HEADER[1]) return;
-    
+    if (data[0] != ACAIA_HEADER[0] || data[1] != ACAIA_HEADER[1]) return false;
+
     uint8_t msgType = data[2];
-    
+
     if (msgType == ACAIA_MSG_WEIGHT && length >= 7) {
         // Weight message: header(2) + type(1) + weight_lo + weight_hi + unit + stable
         int16_t raw = (data[4] << 8) | data[3];
         int8_t unit = data[5];  // 0=g, 1=oz
         bool stable = (data[6] & 0x01) != 0;
-        
+
         float weight = raw / 10.0f;
         if (unit == 1) weight *= 28.3495f;  // Convert oz to g
-        
+
         // Handle negative (Acaia uses sign bit)
         if (data[6] & 0x02) weight = -weight;
-        
-        _state.weight = weight;
-        _state.stable = stable;
+
+        out->weight = weight;
+        out->stable = stable;
+        return true;
     }
+    return false;
 }
 
 void ScaleManager::sendAcaiaTare() {
@@ -731,10 +1119,7 @@ bool ScaleManager::setupBookoo() {
     return true;
 }
 
-void ScaleManager::parseBookooWeight(const uint8_t* data, size_t length) {
-    // Bookoo uses same weight format as Acaia
-    parseAcaiaWeight(data, length);
-}
+// Bookoo weight decoding: same format as Acaia, shared table entry
 
 void ScaleManager::sendBookooTare() {
     // Bookoo uses same tare command as Acaia
@@ -771,20 +1156,20 @@ bool ScaleManager::setupFelicita() {
     return true;
 }
 
-void ScaleManager::parseFelicitaWeight(const uint8_t* data, size_t length) {
+// Also used for Timemore (same ASCII stream)
+static bool decodeFelicitaWeight(const uint8_t* data, size_t length, scale_sample_t* out) {
     // Felicita sends ASCII weight like "  123.4" or "-  12.3"
-    if (length < 2) return;
-    
+    if (length < 2) return false;
+
     char buf[32];
     size_t copyLen = min(length, sizeof(buf) - 1);
     memcpy(buf, data, copyLen);
     buf[copyLen] = '\0';
-    
+
     // Parse weight from ASCII
-    float weight = atof(buf);
-    
-    _state.weight = weight;
-    _state.stable = true;  // Felicita doesn't indicate stability
+    out->weight = atof(buf);
+    out->stable = true;  // Felicita doesn't indicate stability
+    return true;
 }
 
 void ScaleManager::sendFelicitaTare() {
@@ -831,16 +1216,17 @@ bool ScaleManager::setupDecent() {
     return true;
 }
 
-void ScaleManager::parseDecentWeight(const uint8_t* data, size_t length) {
-    if (length < 7) return;
-    
+static bool decodeDecentWeight(const uint8_t* data, size_t length, scale_sample_t* out) {
+    if (length < 7) return false;
+
     // Decent format: type(1) + weight(3 LE signed) + unknown(3) + xor
     // Weight is in 0.1g units, little-endian signed 24-bit
-    
+
     int32_t raw = data[1] | (data[2] << 8) | ((int8_t)data[3] << 16);
-    
-    _state.weight = raw / 10.0f;
-    _state.stable = (data[0] & 0x02) != 0;  // Bit 1 indicates stable
+
+    out->weight = raw / 10.0f;
+    out->stable = (data[0] & 0x02) != 0;  // Bit 1 indicates stable
+    return true;
 }
 
 void ScaleManager::sendDecentTare() {
@@ -857,13 +1243,21 @@ void ScaleManager::sendDecentTare() {
 
 bool ScaleManager::setupTimemore() {
     LOG_I("Setting up Timemore scale");
-    
-    NimBLERemoteService* service = _client->getService(TIMEMORE_SERVICE_UUID);
+
+    // Timemore firmware varies between the long and short service UUID. Try
+    // the variant that worked last time first (cached in NVS) so a reconnect
+    // doesn't burn a discovery round-trip on the wrong one.
+    NimBLERemoteService* service = nullptr;
+    if (_gattVariant != 2) {
+        service = _client->getService(TIMEMORE_SERVICE_UUID);
+        if (service) _gattVariant = 1;
+    }
     if (!service) {
         // Try short UUID
         service = _client->getService(FELICITA_SERVICE_UUID);  // Same short UUID
+        if (service) _gattVariant = 2;
     }
-    
+
     if (!service) {
         LOG_E("Timemore service not found");
         return false;
@@ -889,10 +1283,7 @@ bool ScaleManager::setupTimemore() {
     return true;
 }
 
-void ScaleManager::parseTimemoreWeight(const uint8_t* data, size_t length) {
-    // Timemore is similar to Felicita - ASCII format
-    parseFelicitaWeight(data, length);
-}
+// Timemore weight decoding: same ASCII format as Felicita, shared table entry
 
 void ScaleManager::sendTimemoreTare() {
     // Same as Felicita
@@ -930,29 +1321,27 @@ bool ScaleManager::setupGenericWSS() {
     return true;
 }
 
-void ScaleManager::parseGenericWeight(const uint8_t* data, size_t length) {
+static bool decodeGenericWeight(const uint8_t* data, size_t length, scale_sample_t* out) {
     // Bluetooth SIG Weight Measurement format
     // Flags(1) + Weight(2 or 4) + optional fields
-    
-    if (length < 3) return;
-    
+
+    if (length < 3) return false;
+
     uint8_t flags = data[0];
     bool imperial = (flags & 0x01) != 0;
     // bool timestamp = (flags & 0x02) != 0;
     // bool userId = (flags & 0x04) != 0;
     // bool bmi = (flags & 0x08) != 0;
-    
+
     // Weight is 16-bit unsigned, resolution 0.005 kg or 0.01 lb
     uint16_t raw = data[1] | (data[2] << 8);
-    
-    float weight;
+
     if (imperial) {
-        weight = raw * 0.01f * 453.592f;  // lb to g
+        out->weight = raw * 0.01f * 453.592f;  // lb to g
     } else {
-        weight = raw * 5.0f;  // 0.005 kg = 5g resolution
+        out->weight = raw * 5.0f;  // 0.005 kg = 5g resolution
     }
-    
-    _state.weight = weight;
-    _state.stable = true;
+    out->stable = true;
+    return true;
 }
 
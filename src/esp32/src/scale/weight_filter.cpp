@@ -0,0 +1,87 @@
+/**
+ * BrewOS Scale Weight/Flow Filter Implementation
+ *
+ * See weight_filter.h. The math here used to live in
+ * ScaleManager::updateFilter(); keep the two call sites (hardware loop and
+ * the simulator replay harness) on this one implementation.
+ */
+
+#include "scale/weight_filter.h"
+#include <math.h>
+
+WeightFilter::WeightFilter()
+    : _init(false)
+    , _weight(0)
+    , _flow(0)
+    , _flowOut(0)
+    , _p00(0), _p01(0), _p11(0)
+    , _prevFlow(0)
+    , _flowDerivative(0)
+    , _processNoise(4.0f)
+    , _measurementNoise(0.09f)
+    , _lastTime(0) {
+}
+
+void WeightFilter::reset(uint32_t now_ms) {
+    _init = false;
+    _weight = 0;
+    _flow = 0;
+    _flowOut = 0;
+    _prevFlow = 0;
+    _flowDerivative = 0;
+    _lastTime = now_ms;
+}
+
+void WeightFilter::setNoise(float process_noise, float measurement_noise) {
+    _processNoise = process_noise;
+    _measurementNoise = measurement_noise;
+}
+
+void WeightFilter::update(float raw_weight, uint32_t now_ms) {
+    float dt = (now_ms - _lastTime) / 1000.0f;
+    _lastTime = now_ms;
+
+    if (!_init || fabsf(raw_weight - _weight) > WEIGHT_FILTER_JUMP_G) {
+        // First sample, tare, or cup placed/removed - snap to the measurement
+        // instead of smearing a step through the flow estimate.
+        _weight = raw_weight;
+        _flow = 0.0f;
+        _prevFlow = 0.0f;
+        _p00 = _measurementNoise;
+        _p01 = 0.0f;
+        _p11 = 1.0f;
+        _init = true;
+    } else {
+        // Predict: constant-velocity model with white-acceleration process noise
+        _weight += _flow * dt;
+        float dt2 = dt * dt;
+        float q = _processNoise;
+        _p00 += dt * (2.0f * _p01 + dt * _p11) + 0.25f * dt2 * dt2 * q;
+        _p01 += dt * _p11 + 0.5f * dt * dt2 * q;
+        _p11 += dt2 * q;
+
+        // Update with the latest raw sample
+        float innovation = raw_weight - _weight;
+        float s = _p00 + _measurementNoise;
+        float k0 = _p00 / s;
+        float k1 = _p01 / s;
+        _weight += k0 * innovation;
+        _flow += k1 * innovation;
+        float p00 = _p00;
+        float p01 = _p01;
+        _p00 = (1.0f - k0) * p00;
+        _p01 = (1.0f - k0) * p01;
+        _p11 -= k1 * p01;
+    }
+
+    // Flow derivative from the already-smooth flow state; a light EMA knocks
+    // down the residual step noise without adding meaningful lag.
+    float flowDeriv = (dt > 0.0f) ? (_flow - _prevFlow) / dt : 0.0f;
+    _prevFlow = _flow;
+    _flowDerivative = _flowDerivative * 0.5f + flowDeriv * 0.5f;
+
+    float flow = _flow;
+    if (flow < 0) flow = 0;
+    if (flow > 20) flow = 20;
+    _flowOut = flow;
+}
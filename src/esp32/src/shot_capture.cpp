@@ -0,0 +1,219 @@
+#include "shot_capture.h"
+#include "config.h"
+#include "memory_utils.h"
+#include "pump_health.h"
+#include "user_fs.h"
+#include <time.h>
+
+int16_t* ShotCapture::_buffer = nullptr;
+uint32_t ShotCapture::_sampleCount = 0;
+uint32_t ShotCapture::_lastSampleMs = 0;
+uint32_t ShotCapture::_startMs = 0;
+uint32_t ShotCapture::_startTimestamp = 0;
+bool ShotCapture::_capturing = false;
+
+// Columnar layout: channel-major so flushing a channel is one linear pass
+static inline size_t slot(uint8_t channel, uint32_t sampleIndex) {
+    return (size_t)channel * SHOT_CAPTURE_MAX_SAMPLES + sampleIndex;
+}
+
+// Clamp to int16 fixed-point range (sensor glitches shouldn't wrap)
+static inline int16_t toFixed(float value, float scale) {
+    float scaled = value * scale;
+    if (scaled > 32767.0f) return 32767;
+    if (scaled < -32768.0f) return -32768;
+    return (int16_t)scaled;
+}
+
+void ShotCapture::loop(const ui_state_t& state) {
+    if (!_capturing) {
+        if (state.is_brewing) {
+            start(state);
+        }
+        return;
+    }
+
+    if (!state.is_brewing) {
+        // Shot ended - the pump is off, so the flash write is off the
+        // latency-critical path
+        flush();
+        return;
+    }
+
+    uint32_t now = millis();
+    if (now - _lastSampleMs >= (1000 / SHOT_CAPTURE_RATE_HZ)) {
+        _lastSampleMs = now;
+        sample(state);
+    }
+}
+
+void ShotCapture::start(const ui_state_t& state) {
+    // Buffer allocates once on the first shot and is kept for the life of
+    // the process (5 ch x 1200 samples x 2 bytes = 12KB of PSRAM)
+    if (!_buffer) {
+        _buffer = (int16_t*)psram_malloc(
+            sizeof(int16_t) * SHOT_CAPTURE_CHANNELS * SHOT_CAPTURE_MAX_SAMPLES);
+        if (!_buffer) {
+            LOG_W("Shot capture: buffer allocation failed - capture disabled");
+            return;
+        }
+    }
+
+    _capturing = true;
+    _sampleCount = 0;
+    _startMs = millis();
+    _lastSampleMs = 0;  // Sample immediately
+    time_t now = time(nullptr);
+    _startTimestamp = (now > 1000000) ? (uint32_t)now : 0;
+
+    sample(state);
+    LOG_I("Shot capture started (%dHz, %d channels)",
+          SHOT_CAPTURE_RATE_HZ, SHOT_CAPTURE_CHANNELS);
+}
+
+void ShotCapture::sample(const ui_state_t& state) {
+    if (_sampleCount >= SHOT_CAPTURE_MAX_SAMPLES) {
+        return;  // Capture ceiling hit - keep the first 120s, drop the rest
+    }
+
+    _buffer[slot(0, _sampleCount)] = toFixed(state.brew_temp, 10.0f);
+    _buffer[slot(1, _sampleCount)] = toFixed(state.steam_temp, 10.0f);
+    _buffer[slot(2, _sampleCount)] = toFixed(state.pressure, 100.0f);
+    _buffer[slot(3, _sampleCount)] = toFixed(state.brew_weight, 10.0f);
+    _buffer[slot(4, _sampleCount)] = toFixed(state.flow_rate, 100.0f);
+    _sampleCount++;
+}
+
+bool ShotCapture::writeChannelDeltas(File& file, uint8_t channel) {
+    // Delta-encode through a small staging buffer so the write path is a
+    // few large file.write() calls, not one per sample
+    int16_t staging[128];
+    uint32_t written = 0;
+    int16_t previous = 0;
+
+    while (written < _sampleCount) {
+        uint32_t chunk = _sampleCount - written;
+        if (chunk > 128) chunk = 128;
+        for (uint32_t i = 0; i < chunk; i++) {
+            int16_t raw = _buffer[slot(channel, written + i)];
+            staging[i] = (int16_t)(raw - previous);
+            previous = raw;
+        }
+        size_t bytes = chunk * sizeof(int16_t);
+        if (file.write((const uint8_t*)staging, bytes) != bytes) {
+            return false;
+        }
+        written += chunk;
+    }
+    return true;
+}
+
+void ShotCapture::flush() {
+    _capturing = false;
+    if (_sampleCount == 0) {
+        return;
+    }
+
+    File file = userFS().open(SHOT_CAPTURE_FILE, "w");
+    if (!file) {
+        LOG_W("Shot capture: failed to open %s for writing", SHOT_CAPTURE_FILE);
+        return;
+    }
+
+    ShotCaptureHeader header = {
+        SHOT_CAPTURE_MAGIC,
+        SHOT_CAPTURE_VERSION,
+        SHOT_CAPTURE_CHANNELS,
+        SHOT_CAPTURE_RATE_HZ,
+        _sampleCount,
+        _startTimestamp,
+        millis() - _startMs,
+    };
+
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    for (uint8_t ch = 0; ok && ch < SHOT_CAPTURE_CHANNELS; ch++) {
+        ok = writeChannelDeltas(file, ch);
+    }
+    file.close();
+
+    if (ok) {
+        LOG_I("Shot capture: %lu samples/channel written to %s (%lu ms shot)",
+              (unsigned long)_sampleCount, SHOT_CAPTURE_FILE,
+              (unsigned long)header.duration_ms);
+    } else {
+        LOG_W("Shot capture: write failed - removing partial file");
+        userFS().remove(SHOT_CAPTURE_FILE);
+    }
+}
+
+bool ShotCapture::hasCapture() {
+    return userFS().exists(SHOT_CAPTURE_FILE);
+}
+
+uint16_t ShotCapture::_transient[SHOT_TRANSIENT_MAX_SAMPLES];
+uint16_t ShotCapture::_transientCount = 0;
+uint16_t ShotCapture::_transientRateHz = 0;
+uint8_t ShotCapture::_transientChannel = 0;
+uint8_t ShotCapture::_transientFramesSeen = 0;
+uint8_t ShotCapture::_transientTotalFrames = 0;
+
+void ShotCapture::onTransientFrame(const uint8_t* payload, uint16_t length) {
+    // Frame layout (sensor_burst_payload_t, little-endian):
+    // [frame][total_frames][first_sample u16][rate_hz u16][count][channel][samples u16 x count]
+    if (length < 8) {
+        return;
+    }
+    uint8_t frame = payload[0];
+    uint8_t totalFrames = payload[1];
+    uint16_t firstSample = payload[2] | (payload[3] << 8);
+    uint16_t rateHz = payload[4] | (payload[5] << 8);
+    uint8_t count = payload[6];
+    uint8_t channel = payload[7];
+    if (length < 8 + count * 2) {
+        return;  // Truncated frame
+    }
+
+    if (frame == 0) {
+        // New capture - discard any partial previous assembly
+        _transientCount = 0;
+        _transientFramesSeen = 0;
+        _transientTotalFrames = totalFrames;
+        _transientRateHz = rateHz;
+        _transientChannel = channel;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t idx = firstSample + i;
+        if (idx >= SHOT_TRANSIENT_MAX_SAMPLES) {
+            break;
+        }
+        _transient[idx] = payload[8 + i * 2] | (payload[9 + i * 2] << 8);
+        if (idx + 1 > _transientCount) {
+            _transientCount = idx + 1;
+        }
+    }
+    _transientFramesSeen++;
+
+    if (_transientFramesSeen >= _transientTotalFrames) {
+        LOG_I("Shot transient: %u raw samples @ %uHz received from Pico",
+              _transientCount, _transientRateHz);
+        // Fold this shot's pump fingerprint into the wear trend
+        PumpHealth::analyzeTransient(_transient, _transientCount, _transientRateHz);
+    }
+}
+
+bool ShotCapture::transientToJson(JsonDocument& doc) {
+    if (_transientCount == 0) {
+        return false;
+    }
+    doc["rateHz"] = _transientRateHz;
+    doc["adcChannel"] = _transientChannel;
+    // complete=false means frames were lost in transit - unseen indices
+    // still hold the previous capture's samples (or zeros)
+    doc["complete"] = (_transientFramesSeen >= _transientTotalFrames);
+    JsonArray samples = doc["samples"].to<JsonArray>();
+    for (uint16_t i = 0; i < _transientCount; i++) {
+        samples.add(_transient[i]);
+    }
+    return true;
+}
@@ -0,0 +1,327 @@
+/**
+ * BrewOS Brew-by-Weight Replay Harness
+ *
+ * See include/simulator/bbw_replay.h for the CLI, trace format and scoring
+ * model. Runs the real WeightFilter and the real BrewByWeight controller -
+ * nothing here reimplements predictor logic, it only drives the clock and
+ * plays the machine's part (valve latency, drip landing on the scale).
+ */
+
+#include "simulator/bbw_replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "platform/platform.h"
+#include "simulator/sim_clock.h"
+#include "brew_by_weight.h"
+#include "scale/weight_filter.h"
+
+// =============================================================================
+// Budgets
+// =============================================================================
+
+// Warm-pass accuracy budgets. Scale resolution, drip variance and cup
+// placement make roughly +/-0.5g the practical floor of weight-stopped
+// shots; the budgets sit above that floor so only real predictor
+// regressions trip them.
+#define BBW_REPLAY_AVG_BUDGET_G     0.75f   // Mean |landed - target| across the library
+#define BBW_REPLAY_MAX_BUDGET_G     1.25f   // Any single trace
+
+// Fixed estimator cadence - mirrors SCALE_FILTER_PERIOD_MS in
+// scale_manager.h (not includable here, it drags in NimBLE)
+#define BBW_REPLAY_TICK_MS          100
+
+// Extra settle margin past BBW_SETTLE_TIME_MS so the controller always
+// reaches its deadline and records the shot outcome
+#define BBW_REPLAY_SETTLE_SLACK_MS  500
+
+// =============================================================================
+// State
+// =============================================================================
+
+typedef struct {
+    uint32_t t_ms;
+    float weight;       // Raw BLE sample (grams)
+    uint8_t brewing;
+} bbw_sample_t;
+
+typedef struct {
+    const char* path;
+    std::vector<bbw_sample_t> samples;
+    float target_g;     // From the "# bbw" metadata line
+    float drip_g;       // Measured drip tail of the recorded shot
+    uint32_t latency_ms; // Measured stop-signal -> valve-closed latency
+} bbw_trace_t;
+
+typedef struct {
+    bool stopped;       // Predictor signaled stop before the trace ran out
+    float stop_at_g;    // Raw trace weight when stop was signaled
+    float landed_g;     // Cut weight + drip
+    float error_g;      // landed - target
+    uint32_t stop_ms;   // Capture time of the stop signal
+} bbw_result_t;
+
+static bool s_active = false;
+static std::vector<const char*> s_tracePaths;
+
+static void noop_stop(void) {
+    // BrewByWeight only latches stop_signaled when a stop callback is
+    // registered - on hardware this is the WEIGHT_STOP GPIO path
+}
+
+// =============================================================================
+// Trace Loading
+// =============================================================================
+
+static void print_usage(void) {
+    printf("Usage: program --bbw <trace.csv> [<trace.csv> ...]\n");
+    printf("  Replays recorded shots through the weight filter and the\n");
+    printf("  brew-by-weight predictor, scoring stop accuracy.\n");
+    printf("  Traces need a '# bbw target_g=.. drip_g=.. latency_ms=..' line.\n");
+}
+
+static bool load_trace(const char* path, bbw_trace_t* trace) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        LOG_E("Cannot open trace file: %s", path);
+        return false;
+    }
+
+    trace->path = path;
+    trace->target_g = 0;
+    trace->drip_g = 0;
+    trace->latency_ms = 0;
+    bool have_meta = false;
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "# bbw ", 6) == 0) {
+            unsigned latency;
+            if (sscanf(line, "# bbw target_g=%f drip_g=%f latency_ms=%u",
+                       &trace->target_g, &trace->drip_g, &latency) == 3) {
+                trace->latency_ms = latency;
+                have_meta = true;
+            }
+            continue;
+        }
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        bbw_sample_t s;
+        unsigned t_ms, brewing;
+        float brew_temp, pressure, flow_rate;
+        if (sscanf(line, "%u,%f,%f,%f,%f,%u",
+                   &t_ms, &brew_temp, &pressure,
+                   &flow_rate, &s.weight, &brewing) != 6) {
+            LOG_W("Skipping malformed trace line: %s", line);
+            continue;
+        }
+        s.t_ms = t_ms;
+        s.brewing = (uint8_t)(brewing != 0);
+        trace->samples.push_back(s);
+    }
+    fclose(f);
+
+    if (!have_meta) {
+        LOG_E("%s: missing '# bbw target_g=.. drip_g=.. latency_ms=..' metadata", path);
+        return false;
+    }
+    if (trace->samples.empty()) {
+        LOG_E("%s: no samples", path);
+        return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// Replay
+// =============================================================================
+
+static void replay_trace(const bbw_trace_t& trace, BrewByWeight& bbw,
+                         WeightFilter& filter, bbw_result_t* out) {
+    memset(out, 0, sizeof(*out));
+
+    bbw.reset();
+    bbw.setTargetWeight(trace.target_g);
+
+    // Rewind the virtual capture clock - firmware code under replay reads
+    // time through millis(), so the whole run executes as fast as the host
+    // allows while the controller still sees real shot timing
+    sim_clock_set(0);
+    filter.reset(0);
+
+    size_t idx = 0;
+    float raw = 0.0f;
+    uint8_t trace_brewing = 0;
+    uint32_t trace_end_ms = trace.samples.back().t_ms;
+
+    bool stop_signaled = false;
+    uint32_t stop_ms = 0;
+    bool cut = false;
+    uint32_t cut_ms = 0;
+    float landed = 0.0f;
+
+    for (uint32_t tick = 0;; tick += BBW_REPLAY_TICK_MS) {
+        sim_clock_set(tick);
+
+        // Latest raw sample at or before the replay clock
+        while (idx < trace.samples.size() && trace.samples[idx].t_ms <= tick) {
+            raw = trace.samples[idx].weight;
+            trace_brewing = trace.samples[idx].brewing;
+            idx++;
+        }
+
+        if (cut) {
+            // Valve closed: the drip has landed, hold the settled weight
+            // until the controller's settle window records the outcome
+            bbw.update(false, landed, 0.0f, true, tick);
+            if (tick >= cut_ms + BBW_SETTLE_TIME_MS + BBW_REPLAY_SETTLE_SLACK_MS) {
+                break;
+            }
+            continue;
+        }
+
+        // Pre-cut: the pump runs, so weight keeps following the recorded
+        // pull - including through the stop latency window after the
+        // predictor fires (that in-flight mass is what it must anticipate)
+        filter.update(raw, tick);
+        bool is_brewing = stop_signaled ? true : (trace_brewing != 0);
+        bbw.update(is_brewing, filter.weight(), filter.flow(), true, tick);
+
+        if (!stop_signaled && bbw.getState().stop_signaled) {
+            stop_signaled = true;
+            stop_ms = tick;
+            out->stopped = true;
+            out->stop_at_g = raw;
+            out->stop_ms = tick;
+        }
+
+        if (stop_signaled && tick >= stop_ms + trace.latency_ms) {
+            cut = true;
+            cut_ms = tick;
+            landed = raw + trace.drip_g;
+        } else if (tick >= trace_end_ms) {
+            // Trace ran out before the predictor cut: either it never fired
+            // (scored as a miss against the full recorded pull) or the
+            // latency window outran the recording - land with what we have
+            cut = true;
+            cut_ms = tick;
+            landed = raw + trace.drip_g;
+        }
+    }
+
+    out->landed_g = landed;
+    out->error_g = landed - trace.target_g;
+}
+
+static void print_result(const bbw_trace_t& trace, const bbw_result_t& r) {
+    const char* name = strrchr(trace.path, '/');
+    name = name ? name + 1 : trace.path;
+    if (r.stopped) {
+        printf("    %-24s stop %5.1fg @%5.1fs  landed %5.1fg  target %5.1fg  err %+5.2fg\n",
+               name, r.stop_at_g, r.stop_ms / 1000.0f,
+               r.landed_g, trace.target_g, r.error_g);
+    } else {
+        printf("    %-24s NO STOP - pull ran out at %.1fg (target %.1fg)\n",
+               name, r.landed_g, trace.target_g);
+    }
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+bool bbw_replay_parse_args(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bbw") == 0) {
+            // Everything after --bbw is a trace path
+            for (int j = i + 1; j < argc; j++) {
+                s_tracePaths.push_back(argv[j]);
+            }
+            if (s_tracePaths.empty()) {
+                print_usage();
+                return false;
+            }
+            s_active = true;
+            return true;
+        }
+    }
+    return true;
+}
+
+bool bbw_replay_active(void) {
+    return s_active;
+}
+
+int bbw_replay_run(void) {
+    sim_clock_enable();
+
+    std::vector<bbw_trace_t> traces;
+    for (const char* path : s_tracePaths) {
+        bbw_trace_t trace;
+        if (!load_trace(path, &trace)) {
+            return 1;
+        }
+        traces.push_back(trace);
+    }
+
+    // One controller across both passes: the cold pass is also what trains
+    // the drip/latency learning that the warm pass is scored on
+    BrewByWeight bbw;
+    bbw.begin();
+    bbw.onStop(noop_stop);
+
+    WeightFilter filter;
+    // Acaia/Bookoo-class noise profile (getScaleNoiseParams) - the tuning
+    // traces are recorded from 0.1g-resolution scales
+    filter.setNoise(4.0f, 0.01f);
+
+    printf("BBW replay: %zu trace%s\n", traces.size(),
+           traces.size() == 1 ? "" : "s");
+
+    bbw_result_t r;
+    printf("  cold pass (stop_offset fallback)\n");
+    for (const bbw_trace_t& trace : traces) {
+        replay_trace(trace, bbw, filter, &r);
+        print_result(trace, r);
+    }
+
+    printf("  warm pass (learned drip %.2fg, latency %.0fms)\n",
+           bbw.getPredictedDrip(), bbw.getStopLatencyMs());
+    float err_sum = 0.0f;
+    float err_max = 0.0f;
+    bool all_stopped = true;
+    for (const bbw_trace_t& trace : traces) {
+        replay_trace(trace, bbw, filter, &r);
+        print_result(trace, r);
+        float err = fabsf(r.error_g);
+        err_sum += err;
+        if (err > err_max) err_max = err;
+        if (!r.stopped) all_stopped = false;
+    }
+    float err_avg = err_sum / traces.size();
+
+    printf("  warm avg |err| %.2fg (budget %.2fg)  max |err| %.2fg (budget %.2fg)\n",
+           err_avg, BBW_REPLAY_AVG_BUDGET_G, err_max, BBW_REPLAY_MAX_BUDGET_G);
+
+    bool pass = all_stopped;
+    if (!all_stopped) {
+        printf("  FAIL: predictor never fired on at least one trace\n");
+    }
+    if (err_avg > BBW_REPLAY_AVG_BUDGET_G) {
+        printf("  FAIL: avg error %.2fg > budget %.2fg\n",
+               err_avg, BBW_REPLAY_AVG_BUDGET_G);
+        pass = false;
+    }
+    if (err_max > BBW_REPLAY_MAX_BUDGET_G) {
+        printf("  FAIL: max error %.2fg > budget %.2fg\n",
+               err_max, BBW_REPLAY_MAX_BUDGET_G);
+        pass = false;
+    }
+    printf("  %s\n", pass ? "PASS" : "FAIL");
+
+    return pass ? 0 : 1;
+}
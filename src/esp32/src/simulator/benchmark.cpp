@@ -0,0 +1,238 @@
+/**
+ * BrewOS Simulator Benchmark Harness
+ *
+ * See include/simulator/benchmark.h for the CLI and capture format.
+ */
+
+#include "simulator/benchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+#include "platform/platform.h"
+
+// =============================================================================
+// Budgets
+// =============================================================================
+
+// Pass/fail thresholds. Desktop timings don't map 1:1 to the ESP32-S3, but
+// the simulator is far faster than the target - a replay that can't hold
+// these numbers here has no chance on hardware.
+#define BENCH_FRAME_P95_BUDGET_US   16000   // One 60fps frame
+#define BENCH_FRAME_MAX_BUDGET_US   50000   // Any single stall
+#define BENCH_UPDATE_P95_BUDGET_US   5000   // ui.update() per telemetry sample
+
+// =============================================================================
+// State
+// =============================================================================
+
+typedef struct {
+    uint32_t t_ms;      // Offset from capture start
+    float brew_temp;
+    float pressure;
+    float flow_rate;
+    float weight;
+    uint8_t brewing;
+} bench_sample_t;
+
+static const char* s_captureFile = NULL;
+static float s_speed = 1.0f;
+static bool s_active = false;
+
+static std::vector<bench_sample_t> s_samples;
+static std::vector<uint32_t> s_frameUs;
+static std::vector<uint32_t> s_updateUs;
+static size_t s_nextSample = 0;
+static uint64_t s_replayStartUs = 0;
+static uint32_t s_brewStartMs = 0;
+static bool s_brewSeen = false;
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+uint64_t benchmark_micros(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+static uint32_t percentile_us(std::vector<uint32_t>& v, int pct) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t idx = (v.size() * (size_t)pct) / 100;
+    if (idx >= v.size()) idx = v.size() - 1;
+    return v[idx];
+}
+
+static uint32_t average_us(const std::vector<uint32_t>& v) {
+    if (v.empty()) return 0;
+    uint64_t sum = 0;
+    for (uint32_t t : v) sum += t;
+    return (uint32_t)(sum / v.size());
+}
+
+static void print_usage(const char* prog) {
+    printf("Usage: %s [--bench <capture.csv>] [--speed <multiplier>]\n", prog);
+    printf("  --bench <file>   Replay a captured shot and report UI timings\n");
+    printf("  --speed <N>      Replay speed multiplier (default 1, e.g. 4)\n");
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+bool benchmark_parse_args(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            if (i + 1 >= argc) {
+                print_usage(argv[0]);
+                return false;
+            }
+            s_captureFile = argv[++i];
+            s_active = true;
+        } else if (strcmp(argv[i], "--speed") == 0) {
+            if (i + 1 >= argc) {
+                print_usage(argv[0]);
+                return false;
+            }
+            s_speed = (float)atof(argv[++i]);
+            if (s_speed <= 0.0f) {
+                LOG_E("Invalid --speed value: %s", argv[i]);
+                return false;
+            }
+        } else {
+            print_usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool benchmark_active(void) {
+    return s_active;
+}
+
+bool benchmark_init(void) {
+    FILE* f = fopen(s_captureFile, "r");
+    if (!f) {
+        LOG_E("Cannot open capture file: %s", s_captureFile);
+        return false;
+    }
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        bench_sample_t s;
+        unsigned t_ms, brewing;
+        if (sscanf(line, "%u,%f,%f,%f,%f,%u",
+                   &t_ms, &s.brew_temp, &s.pressure,
+                   &s.flow_rate, &s.weight, &brewing) != 6) {
+            LOG_W("Skipping malformed capture line: %s", line);
+            continue;
+        }
+        s.t_ms = t_ms;
+        s.brewing = (uint8_t)(brewing != 0);
+        s_samples.push_back(s);
+    }
+    fclose(f);
+
+    if (s_samples.empty()) {
+        LOG_E("Capture file has no samples: %s", s_captureFile);
+        return false;
+    }
+
+    printf("Benchmark: %s - %zu samples over %.1fs, replaying at %.1fx\n",
+           s_captureFile, s_samples.size(),
+           s_samples.back().t_ms / 1000.0f, s_speed);
+    return true;
+}
+
+bool benchmark_tick(ui_state_t* state) {
+    if (s_replayStartUs == 0) {
+        s_replayStartUs = benchmark_micros();
+    }
+
+    // Scaled replay clock: capture-time milliseconds elapsed so far
+    uint64_t replay_ms =
+        (uint64_t)((benchmark_micros() - s_replayStartUs) * s_speed) / 1000;
+
+    while (s_nextSample < s_samples.size() &&
+           s_samples[s_nextSample].t_ms <= replay_ms) {
+        const bench_sample_t& s = s_samples[s_nextSample++];
+
+        state->brew_temp = s.brew_temp;
+        state->pressure = s.pressure;
+        state->flow_rate = s.flow_rate;
+        state->brew_weight = s.weight;
+        state->is_brewing = s.brewing != 0;
+        if (s.brewing) {
+            if (!s_brewSeen) {
+                s_brewSeen = true;
+                s_brewStartMs = s.t_ms;
+            }
+            state->machine_state = UI_STATE_BREWING;
+            state->brew_time_ms = s.t_ms - s_brewStartMs;
+        } else {
+            state->machine_state = UI_STATE_READY;
+        }
+
+        uint64_t t0 = benchmark_micros();
+        ui.update(*state);
+        s_updateUs.push_back((uint32_t)(benchmark_micros() - t0));
+    }
+
+    return s_nextSample < s_samples.size();
+}
+
+void benchmark_note_frame(uint32_t frame_us) {
+    if (!s_active) {
+        return;
+    }
+    s_frameUs.push_back(frame_us);
+}
+
+int benchmark_report(void) {
+    uint32_t frameAvg = average_us(s_frameUs);
+    uint32_t frameMax = s_frameUs.empty()
+        ? 0 : *std::max_element(s_frameUs.begin(), s_frameUs.end());
+    uint32_t frameP95 = percentile_us(s_frameUs, 95);
+    uint32_t updateAvg = average_us(s_updateUs);
+    uint32_t updateMax = s_updateUs.empty()
+        ? 0 : *std::max_element(s_updateUs.begin(), s_updateUs.end());
+    uint32_t updateP95 = percentile_us(s_updateUs, 95);
+
+    printf("\n");
+    printf("Benchmark results (%zu frames, %zu telemetry samples)\n",
+           s_frameUs.size(), s_updateUs.size());
+    printf("  lv_timer_handler  avg %6u us  p95 %6u us  max %6u us\n",
+           frameAvg, frameP95, frameMax);
+    printf("  ui.update         avg %6u us  p95 %6u us  max %6u us\n",
+           updateAvg, updateP95, updateMax);
+
+    bool pass = true;
+    if (frameP95 > BENCH_FRAME_P95_BUDGET_US) {
+        printf("  FAIL: frame p95 %u us > budget %u us\n",
+               frameP95, BENCH_FRAME_P95_BUDGET_US);
+        pass = false;
+    }
+    if (frameMax > BENCH_FRAME_MAX_BUDGET_US) {
+        printf("  FAIL: frame max %u us > budget %u us\n",
+               frameMax, BENCH_FRAME_MAX_BUDGET_US);
+        pass = false;
+    }
+    if (updateP95 > BENCH_UPDATE_P95_BUDGET_US) {
+        printf("  FAIL: ui.update p95 %u us > budget %u us\n",
+               updateP95, BENCH_UPDATE_P95_BUDGET_US);
+        pass = false;
+    }
+    printf("  %s\n", pass ? "PASS" : "FAIL");
+
+    return pass ? 0 : 1;
+}
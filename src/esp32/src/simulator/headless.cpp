@@ -0,0 +1,395 @@
+/**
+ * BrewOS Simulator Headless Harness Implementation
+ *
+ * See include/simulator/headless.h for the CLI and script format. Rendering
+ * still happens (layout and draw cost are part of what scenarios exercise);
+ * the flush callback just discards the pixels instead of touching SDL.
+ */
+
+#include "simulator/headless.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include <lvgl.h>
+#include "platform/platform.h"
+#include "simulator/sim_clock.h"
+#include "display/theme.h"
+#include "display/display_config.h"
+#include "ui/ui.h"
+#include "ui/screen_idle.h"
+#include "ui/screen_settings.h"
+
+// Virtual step per loop pass - matches the ~5ms lv_timer_handler() cadence
+// the SDL loop and the hardware display task both run at
+#define HEADLESS_TICK_MS 5
+
+// =============================================================================
+// Script
+// =============================================================================
+
+typedef enum {
+    EV_STATE,
+    EV_BREW,
+    EV_TEMP,
+    EV_STEAM,
+    EV_PRESSURE,
+    EV_WEIGHT,
+    EV_FLOW,
+    EV_SCREEN,
+    EV_ROTATE,
+    EV_PRESS,
+    EV_RELEASE,
+    EV_LONGPRESS,
+    EV_END,
+} headless_event_type_t;
+
+typedef struct {
+    uint32_t t_ms;
+    headless_event_type_t type;
+    float value;        // Numeric argument (temp, weight, rotate count, ...)
+    int id;             // Enum argument (machine state, screen)
+} headless_event_t;
+
+static const char* s_scriptFile = NULL;
+static bool s_active = false;
+static std::vector<headless_event_t> s_events;
+
+// Encoder state fed to the LVGL input driver by rotate/press events
+static int16_t s_encoderDiff = 0;
+static bool s_encoderPressed = false;
+
+static void print_usage(const char* prog) {
+    printf("Usage: %s --headless <script.txt>\n", prog);
+    printf("  Runs a scripted full-system scenario with no display and a\n");
+    printf("  deterministic virtual clock. See simulator/headless.h for\n");
+    printf("  the event list.\n");
+}
+
+static const struct { const char* name; uint8_t state; } MACHINE_STATES[] = {
+    { "idle",    UI_STATE_IDLE },
+    { "heating", UI_STATE_HEATING },
+    { "ready",   UI_STATE_READY },
+    { "brewing", UI_STATE_BREWING },
+    { "fault",   UI_STATE_FAULT },
+    { "safe",    UI_STATE_SAFE },
+    { "eco",     UI_STATE_ECO },
+};
+
+static const struct { const char* name; screen_id_t screen; } SCREENS[] = {
+    { "setup",    SCREEN_SETUP },
+    { "idle",     SCREEN_IDLE },
+    { "home",     SCREEN_HOME },
+    { "brewing",  SCREEN_BREWING },
+    { "complete", SCREEN_COMPLETE },
+    { "settings", SCREEN_SETTINGS },
+    { "temp",     SCREEN_TEMP_SETTINGS },
+    { "scale",    SCREEN_SCALE },
+    { "cloud",    SCREEN_CLOUD },
+    { "alarm",    SCREEN_ALARM },
+    { "ota",      SCREEN_OTA },
+    { "splash",   SCREEN_SPLASH },
+};
+
+static bool parse_event(const char* line, int lineno, headless_event_t* ev) {
+    char name[16] = {0};
+    char arg[32] = {0};
+    unsigned long t;
+    int n = sscanf(line, "%lu %15s %31s", &t, name, arg);
+    if (n < 2) {
+        LOG_E("Script line %d: expected '<t_ms> <event> [arg]'", lineno);
+        return false;
+    }
+    ev->t_ms = (uint32_t)t;
+    ev->value = 0;
+    ev->id = -1;
+
+    if (strcmp(name, "state") == 0) {
+        ev->type = EV_STATE;
+        for (size_t i = 0; i < sizeof(MACHINE_STATES) / sizeof(MACHINE_STATES[0]); i++) {
+            if (strcmp(arg, MACHINE_STATES[i].name) == 0) {
+                ev->id = MACHINE_STATES[i].state;
+                return true;
+            }
+        }
+        LOG_E("Script line %d: unknown machine state '%s'", lineno, arg);
+        return false;
+    }
+    if (strcmp(name, "screen") == 0) {
+        ev->type = EV_SCREEN;
+        for (size_t i = 0; i < sizeof(SCREENS) / sizeof(SCREENS[0]); i++) {
+            if (strcmp(arg, SCREENS[i].name) == 0) {
+                ev->id = (int)SCREENS[i].screen;
+                return true;
+            }
+        }
+        LOG_E("Script line %d: unknown screen '%s'", lineno, arg);
+        return false;
+    }
+
+    if (strcmp(name, "brew") == 0)      { ev->type = EV_BREW; }
+    else if (strcmp(name, "temp") == 0)     { ev->type = EV_TEMP; }
+    else if (strcmp(name, "steam") == 0)    { ev->type = EV_STEAM; }
+    else if (strcmp(name, "pressure") == 0) { ev->type = EV_PRESSURE; }
+    else if (strcmp(name, "weight") == 0)   { ev->type = EV_WEIGHT; }
+    else if (strcmp(name, "flow") == 0)     { ev->type = EV_FLOW; }
+    else if (strcmp(name, "rotate") == 0)   { ev->type = EV_ROTATE; }
+    else if (strcmp(name, "press") == 0)    { ev->type = EV_PRESS; return true; }
+    else if (strcmp(name, "release") == 0)  { ev->type = EV_RELEASE; return true; }
+    else if (strcmp(name, "longpress") == 0){ ev->type = EV_LONGPRESS; return true; }
+    else if (strcmp(name, "end") == 0)      { ev->type = EV_END; return true; }
+    else {
+        LOG_E("Script line %d: unknown event '%s'", lineno, name);
+        return false;
+    }
+
+    if (n < 3) {
+        LOG_E("Script line %d: '%s' needs an argument", lineno, name);
+        return false;
+    }
+    ev->value = (float)atof(arg);
+    return true;
+}
+
+static bool load_script(void) {
+    FILE* f = fopen(s_scriptFile, "r");
+    if (!f) {
+        LOG_E("Cannot open script file: %s", s_scriptFile);
+        return false;
+    }
+
+    char line[128];
+    int lineno = 0;
+    uint32_t last_t = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        const char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '\n' || *p == '\0') continue;
+
+        headless_event_t ev;
+        if (!parse_event(p, lineno, &ev)) {
+            fclose(f);
+            return false;
+        }
+        if (ev.t_ms < last_t) {
+            LOG_E("Script line %d: timestamps must not decrease", lineno);
+            fclose(f);
+            return false;
+        }
+        last_t = ev.t_ms;
+        s_events.push_back(ev);
+    }
+    fclose(f);
+
+    if (s_events.empty()) {
+        LOG_E("Script has no events: %s", s_scriptFile);
+        return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// LVGL Setup (no SDL)
+// =============================================================================
+
+static void null_display_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    // Rendering cost is real, the pixels just go nowhere
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+static void encoder_read_cb(lv_indev_drv_t* drv, lv_indev_data_t* data) {
+    (void)drv;
+    data->enc_diff = s_encoderDiff;
+    s_encoderDiff = 0;
+    data->state = s_encoderPressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void setup_lvgl(void) {
+    lv_init();
+
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_color_t buf1[DISPLAY_WIDTH * 40];
+    lv_disp_draw_buf_init(&draw_buf, buf1, NULL, DISPLAY_WIDTH * 40);
+
+    static lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = DISPLAY_WIDTH;
+    disp_drv.ver_res = DISPLAY_HEIGHT;
+    disp_drv.flush_cb = null_display_flush;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+
+    static lv_indev_drv_t enc_drv;
+    lv_indev_drv_init(&enc_drv);
+    enc_drv.type = LV_INDEV_TYPE_ENCODER;
+    enc_drv.read_cb = encoder_read_cb;
+    lv_indev_t* enc_indev = lv_indev_drv_register(&enc_drv);
+
+    lv_group_t* group = lv_group_create();
+    lv_indev_set_group(enc_indev, group);
+    lv_group_set_default(group);
+}
+
+// =============================================================================
+// Event Application
+// =============================================================================
+
+static void apply_rotate(int dir) {
+    // Mirror the SDL path: the encoder driver feeds the LVGL group, and the
+    // screen-specific rotation handlers get the direct call they expect
+    s_encoderDiff += dir;
+    screen_id_t current = ui.getCurrentScreen();
+    if (current == SCREEN_IDLE) {
+        screen_idle_select_power_mode((int)screen_idle_get_selected_power_mode() + dir);
+    } else if (current == SCREEN_SETTINGS) {
+        screen_settings_navigate(dir);
+    }
+}
+
+// Returns true when `state` was touched and ui.update() should run
+static bool apply_event(const headless_event_t& ev, ui_state_t* state) {
+    switch (ev.type) {
+        case EV_STATE:    state->machine_state = (uint8_t)ev.id; return true;
+        case EV_BREW:     state->is_brewing = (ev.value != 0); return true;
+        case EV_TEMP:     state->brew_temp = ev.value; return true;
+        case EV_STEAM:    state->steam_temp = ev.value; return true;
+        case EV_PRESSURE: state->pressure = ev.value; return true;
+        case EV_WEIGHT:   state->brew_weight = ev.value; return true;
+        case EV_FLOW:     state->flow_rate = ev.value; return true;
+        case EV_SCREEN:
+            ui.showScreen((screen_id_t)ev.id);
+            return false;
+        case EV_ROTATE: {
+            int n = (int)ev.value;
+            int dir = (n < 0) ? -1 : 1;
+            for (int i = 0; i != n; i += dir) {
+                apply_rotate(dir);
+            }
+            return false;
+        }
+        case EV_PRESS:     s_encoderPressed = true; return false;
+        case EV_RELEASE:   s_encoderPressed = false; return false;
+        case EV_LONGPRESS: ui.handleLongPress(); return false;
+        case EV_END:       return false;
+    }
+    return false;
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+bool headless_parse_args(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--headless") == 0) {
+            if (i + 1 >= argc) {
+                print_usage(argv[0]);
+                return false;
+            }
+            s_scriptFile = argv[i + 1];
+            s_active = true;
+            return true;
+        }
+    }
+    return true;
+}
+
+bool headless_active(void) {
+    return s_active;
+}
+
+static uint64_t wall_micros(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+int headless_run(void) {
+    if (!load_script()) {
+        return 1;
+    }
+
+    sim_clock_enable();
+    setup_lvgl();
+    theme_init();
+
+    if (!ui.begin()) {
+        LOG_E("Failed to initialize UI");
+        return 1;
+    }
+
+    // Same defaults as the interactive simulator's mock state
+    ui_state_t state = {};
+    state.brew_temp = 93.5f;
+    state.brew_setpoint = 94.0f;
+    state.steam_temp = 145.0f;
+    state.steam_setpoint = 145.0f;
+    state.brew_max_temp = 105.0f;
+    state.steam_max_temp = 160.0f;
+    state.pressure = 9.0f;
+    state.machine_state = UI_STATE_READY;
+    state.heating_strategy = HEAT_SEQUENTIAL;
+    state.target_weight = 36.0f;
+    state.dose_weight = 18.0f;
+    state.pico_connected = true;
+    state.wifi_connected = true;
+    state.mqtt_connected = true;
+    strncpy(state.wifi_ssid, "HomeWiFi", sizeof(state.wifi_ssid) - 1);
+    strncpy(state.wifi_ip, "192.168.1.100", sizeof(state.wifi_ip) - 1);
+    state.wifi_rssi = -45;
+
+    ui.showScreen(SCREEN_HOME);
+    ui.update(state);
+
+    uint32_t end_ms = s_events.back().t_ms;
+    uint64_t wall_start = wall_micros();
+    uint32_t frames = 0;
+    size_t next = 0;
+    bool done = false;
+
+    LOG_I("Headless run: %s (%zu events, %u ms simulated)",
+          s_scriptFile, s_events.size(), end_ms);
+
+    while (!done) {
+        uint32_t now = sim_clock_millis();
+
+        bool dirty = false;
+        while (next < s_events.size() && s_events[next].t_ms <= now) {
+            if (s_events[next].type == EV_END) {
+                done = true;
+            } else {
+                dirty |= apply_event(s_events[next], &state);
+            }
+            next++;
+        }
+        if (dirty) {
+            ui.update(state);
+        }
+
+        lv_timer_handler();
+        frames++;
+
+        if (now >= end_ms) {
+            done = true;
+        }
+        sim_clock_advance(HEADLESS_TICK_MS);
+    }
+
+    uint64_t wall_us = wall_micros() - wall_start;
+    uint32_t sim_ms = sim_clock_millis();
+    printf("\n");
+    printf("=== Headless Run Report ===\n");
+    printf("Script:     %s\n", s_scriptFile);
+    printf("Simulated:  %u ms (%u frames @ %d ms tick)\n", sim_ms, frames, HEADLESS_TICK_MS);
+    printf("Wall time:  %llu ms\n", (unsigned long long)(wall_us / 1000));
+    printf("Speedup:    %.1fx\n", wall_us > 0 ? (sim_ms * 1000.0) / (double)wall_us : 0.0);
+    printf("\n");
+
+    return 0;
+}
@@ -1,6 +1,6 @@
 /**
  * Custom LVGL Tick Source for Simulator
- * 
+ *
  * Provides lv_tick_get() implementation for native builds
  */
 
@@ -8,13 +8,13 @@
 #define LV_TICK_CUSTOM_H
 
 #include <stdint.h>
-#include <time.h>
+#include "simulator/sim_clock.h"
 
-// Just provide millis() equivalent for the LV_TICK_CUSTOM_SYS_TIME_EXPR macro
+// millis() equivalent for the LV_TICK_CUSTOM_SYS_TIME_EXPR macro. Routed
+// through the shared simulator clock so headless/replay harnesses can run
+// LVGL timers on virtual time; wall clock when no harness is active.
 static inline uint32_t millis(void) {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint32_t)((ts.tv_sec * 1000) + (ts.tv_nsec / 1000000));
+    return sim_clock_millis();
 }
 
 #endif // LV_TICK_CUSTOM_H
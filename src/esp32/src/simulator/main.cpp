@@ -16,6 +16,9 @@
 #include "ui/screen_idle.h"
 #include "ui/screen_settings.h"
 #include "ui/screen_cloud.h"
+#include "simulator/benchmark.h"
+#include "simulator/bbw_replay.h"
+#include "simulator/headless.h"
 
 // =============================================================================
 // Configuration
@@ -316,9 +319,27 @@ static void create_round_mask(void) {
 // =============================================================================
 
 int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
-    
+    if (!bbw_replay_parse_args(argc, argv)) {
+        return 1;
+    }
+    if (bbw_replay_active()) {
+        // Headless: the predictor replay never touches SDL or LVGL, it just
+        // wants to chew through the trace library as fast as possible
+        return bbw_replay_run();
+    }
+
+    if (!headless_parse_args(argc, argv)) {
+        return 1;
+    }
+    if (headless_active()) {
+        // Scripted full-system run: no SDL, LVGL on the virtual clock
+        return headless_run();
+    }
+
+    if (!benchmark_parse_args(argc, argv)) {
+        return 1;
+    }
+
     printf("\n");
     printf("╔══════════════════════════════════════════════════════╗\n");
     printf("║           BrewOS UI Simulator                        ║\n");
@@ -409,22 +430,38 @@ int main(int argc, char* argv[]) {
     // Start at home screen
     ui.showScreen(SCREEN_HOME);
     ui.update(mock_state);
-    
+
+    if (benchmark_active() && !benchmark_init()) {
+        return 1;
+    }
+
     LOG_I("Simulator running!");
-    
+
     // Main loop
     while (handle_sdl_events()) {
-        update_mock_state();
-        lv_timer_handler();
+        if (benchmark_active()) {
+            // Replay captured telemetry instead of the random-walk mock;
+            // exit once the capture is exhausted so CI gets a result
+            bool more = benchmark_tick(&mock_state);
+            uint64_t frame_start = benchmark_micros();
+            lv_timer_handler();
+            benchmark_note_frame((uint32_t)(benchmark_micros() - frame_start));
+            if (!more) {
+                break;
+            }
+        } else {
+            update_mock_state();
+            lv_timer_handler();
+        }
         platform_delay(5);
     }
-    
+
     // Cleanup
     free(fb);
     SDL_DestroyTexture(texture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
-    
-    return 0;
+
+    return benchmark_active() ? benchmark_report() : 0;
 }
@@ -0,0 +1,54 @@
+/**
+ * BrewOS Simulator Virtual Clock Implementation
+ *
+ * See include/simulator/sim_clock.h. The Arduino millis() shim lives here
+ * too, so firmware modules compiled as-is (brew_by_weight) read the same
+ * clock as everything else.
+ */
+
+#include "simulator/sim_clock.h"
+
+#include <time.h>
+
+static bool s_virtual = false;
+static uint32_t s_nowMs = 0;
+
+extern "C" {
+
+void sim_clock_enable(void) {
+    s_virtual = true;
+    s_nowMs = 0;
+}
+
+bool sim_clock_active(void) {
+    return s_virtual;
+}
+
+void sim_clock_advance(uint32_t ms) {
+    if (s_virtual) {
+        s_nowMs += ms;
+    }
+}
+
+void sim_clock_set(uint32_t ms) {
+    if (s_virtual) {
+        s_nowMs = ms;
+    }
+}
+
+uint32_t sim_clock_millis(void) {
+    if (s_virtual) {
+        return s_nowMs;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * 1000) + (ts.tv_nsec / 1000000));
+}
+
+}  // extern "C"
+
+// Arduino shim (see include/simulator/shim/Arduino.h) - C++ linkage, the
+// shim header declares it unguarded
+uint32_t millis(void) {
+    return sim_clock_millis();
+}
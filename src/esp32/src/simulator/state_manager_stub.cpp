@@ -46,6 +46,8 @@ void StateManager::saveMachineInfoSettings() {}
 void StateManager::saveNotificationSettings() {}
 void StateManager::saveSystemSettings() {}
 void StateManager::saveUserPreferences() {}
+void StateManager::beginSettingsUpdate() {}
+void StateManager::commitSettingsUpdate() {}
 
 void StateManager::resetSettings() {}
 void StateManager::factoryReset() {}
@@ -0,0 +1,103 @@
+#include "soft_watchdog.h"
+#include "config.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// One violation log per entry per window - a stalled loop beats late once,
+// it shouldn't be able to flood the log buffer
+#define SOFT_WATCHDOG_LOG_INTERVAL_MS 5000
+
+SoftWatchdog::Entry SoftWatchdog::_entries[SOFT_WATCHDOG_MAX_ENTRIES];
+uint8_t SoftWatchdog::_count = 0;
+
+int8_t SoftWatchdog::add(const char* name, uint32_t sloGapMs) {
+    if (_count >= SOFT_WATCHDOG_MAX_ENTRIES) {
+        LOG_W("SoftWatchdog: cannot register %s", name ? name : "?");
+        return -1;
+    }
+    Entry& entry = _entries[_count];
+    entry.name = name;
+    entry.sloGapMs = sloGapMs;
+    entry.lastBeatMs = 0;
+    entry.maxGapMs = 0;
+    entry.maxGapAtMs = 0;
+    entry.violations = 0;
+    entry.lastLogMs = 0;
+    return (int8_t)_count++;
+}
+
+void SoftWatchdog::beat(int8_t id) {
+    if (id < 0 || id >= (int8_t)_count) {
+        return;
+    }
+    Entry& entry = _entries[id];
+    uint32_t now = millis();
+
+    if (entry.lastBeatMs != 0) {
+        uint32_t gap = now - entry.lastBeatMs;
+        if (gap > entry.maxGapMs) {
+            entry.maxGapMs = gap;
+            entry.maxGapAtMs = now;
+        }
+        if (gap > entry.sloGapMs) {
+            entry.violations++;
+            if (now - entry.lastLogMs > SOFT_WATCHDOG_LOG_INTERVAL_MS) {
+                entry.lastLogMs = now;
+                logViolation(entry, gap);
+            }
+        }
+    }
+    entry.lastBeatMs = now;
+}
+
+void SoftWatchdog::logViolation(Entry& entry, uint32_t gapMs) {
+    // Snapshot which tasks were runnable when the late beat arrived - the
+    // culprit that starved this subsystem is usually among them
+    char tasks[96];
+    size_t pos = 0;
+    tasks[0] = '\0';
+
+    TaskStatus_t status[16];
+    UBaseType_t count = uxTaskGetSystemState(status, 16, nullptr);
+    for (UBaseType_t i = 0; i < count && pos < sizeof(tasks) - 1; i++) {
+        if (status[i].eCurrentState != eRunning &&
+            status[i].eCurrentState != eReady) {
+            continue;
+        }
+        BaseType_t core = xTaskGetCoreID(status[i].xHandle);
+        int written = snprintf(tasks + pos, sizeof(tasks) - pos, "%s%s(%ld)",
+                               pos > 0 ? " " : "", status[i].pcTaskName,
+                               (long)core);
+        if (written <= 0) {
+            break;
+        }
+        pos += (size_t)written;
+    }
+
+    LOG_W("SoftWatchdog: %s gap %lums (SLO %lums), runnable: %s",
+          entry.name, (unsigned long)gapMs, (unsigned long)entry.sloGapMs,
+          tasks[0] != '\0' ? tasks : "n/a");
+}
+
+void SoftWatchdog::toJson(JsonArray& arr) {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < _count; i++) {
+        const Entry& entry = _entries[i];
+        JsonObject obj = arr.add<JsonObject>();
+        obj["name"] = entry.name;
+        obj["sloMs"] = entry.sloGapMs;
+        obj["maxGapMs"] = entry.maxGapMs;
+        // Ages instead of absolute millis() - readable without boot time
+        obj["maxGapAgeMs"] = entry.maxGapAtMs ? (now - entry.maxGapAtMs) : 0;
+        obj["lastBeatAgeMs"] = entry.lastBeatMs ? (now - entry.lastBeatMs) : 0;
+        obj["violations"] = entry.violations;
+    }
+}
+
+void SoftWatchdog::resetStats() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _entries[i].maxGapMs = 0;
+        _entries[i].maxGapAtMs = 0;
+        _entries[i].violations = 0;
+    }
+}
@@ -1,7 +1,8 @@
 #include "state/state_manager.h"
 #include "config.h"  // For LOG_I macro
+#include "flight_recorder.h"
 #include "memory_utils.h"
-#include <LittleFS.h>
+#include "user_fs.h"
 #include <time.h>
 
 namespace BrewOS {
@@ -102,9 +103,16 @@ void StateManager::loop() {
         }
     }
     
+    // Write-behind settings flush: sections staged by save*Settings() are
+    // committed here once the debounce window closes, so settings POSTs
+    // never pay for a flash commit in the request path
+    if (_dirtySections && (millis() - _lastDirtyMark >= SETTINGS_FLUSH_DELAY)) {
+        flushDirtySections();
+    }
+
     // Daily reset check
     checkDailyReset();
-    
+
     // Check schedules
     checkSchedules();
 }
@@ -112,11 +120,99 @@ void StateManager::loop() {
 // =============================================================================
 // SETTINGS PERSISTENCE
 // =============================================================================
+//
+// Settings persist in two forms:
+//  - Per-key entries (the historical format) - granular, human-inspectable via
+//    nvs tooling, and what older firmware wrote.
+//  - One packed blob of the whole Settings struct under "blob" - a single NVS
+//    lookup at boot instead of ~60 individual flash reads. Same trick as the
+//    Pico's config_payload_t over the wire, applied to our own flash.
+// The blob is schema-versioned AND size-checked: any struct layout change
+// bumps the effective schema (sizeof changes) and falls back to the per-key
+// path, which re-migrates. Writes keep both forms in sync (see
+// flushDirtySections()), so a downgrade still finds its per-key entries.
+
+static const uint32_t SETTINGS_BLOB_MAGIC = 0x42525753;  // "BRWS"
+static const uint16_t SETTINGS_BLOB_VERSION = 1;
+
+struct SettingsBlobHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;      // sizeof(Settings) at write time
+};
+
+bool StateManager::loadSettingsBlob(Preferences& prefs) {
+    const size_t expected = sizeof(SettingsBlobHeader) + sizeof(Settings);
+    if (prefs.getBytesLength("blob") != expected) {
+        return false;  // Missing, or written by a different schema
+    }
+
+    uint8_t* buffer = (uint8_t*)heap_caps_malloc(expected, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer) {
+        buffer = (uint8_t*)malloc(expected);
+    }
+    if (!buffer) {
+        return false;
+    }
+
+    bool ok = false;
+    if (prefs.getBytes("blob", buffer, expected) == expected) {
+        SettingsBlobHeader header;
+        memcpy(&header, buffer, sizeof(header));
+        if (header.magic == SETTINGS_BLOB_MAGIC &&
+            header.version == SETTINGS_BLOB_VERSION &&
+            header.size == sizeof(Settings)) {
+            memcpy(&_settings, buffer + sizeof(header), sizeof(Settings));
+            ok = true;
+        }
+    }
+
+    free(buffer);
+    return ok;
+}
+
+void StateManager::writeSettingsBlob() {
+    const size_t total = sizeof(SettingsBlobHeader) + sizeof(Settings);
+    uint8_t* buffer = (uint8_t*)heap_caps_malloc(total, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer) {
+        buffer = (uint8_t*)malloc(total);
+    }
+    if (!buffer) {
+        Serial.println("[State] Failed to allocate settings blob buffer");
+        return;
+    }
+
+    SettingsBlobHeader header = {SETTINGS_BLOB_MAGIC, SETTINGS_BLOB_VERSION,
+                                 (uint16_t)sizeof(Settings)};
+    memcpy(buffer, &header, sizeof(header));
+    memcpy(buffer + sizeof(header), &_settings, sizeof(Settings));
+
+    _prefs.begin(NVS_SETTINGS, false);
+    _prefs.putBytes("blob", buffer, total);
+    _prefs.end();
+    free(buffer);
+}
+
+// Derive the numeric machine type from the persisted string (shared by the
+// blob and per-key load paths)
+void StateManager::syncMachineTypeFromString() {
+    if (strcmp(_settings.machineInfo.machineType, "dual_boiler") == 0) {
+        _state.machineType = 1;
+    } else if (strcmp(_settings.machineInfo.machineType, "single_boiler") == 0) {
+        _state.machineType = 2;
+    } else if (strcmp(_settings.machineInfo.machineType, "heat_exchanger") == 0) {
+        _state.machineType = 3;
+    } else if (strcmp(_settings.machineInfo.machineType, "thermoblock") == 0) {
+        _state.machineType = 4;
+    } else {
+        _state.machineType = 0;  // unknown
+    }
+}
 
 void StateManager::loadSettings() {
     // Use a fresh Preferences object for safety
     Preferences prefs;
-    
+
     // Try read-write first to create namespace if it doesn't exist
     // This is normal after a fresh flash - will use defaults
     if (!prefs.begin(NVS_SETTINGS, false)) {
@@ -124,7 +220,17 @@ void StateManager::loadSettings() {
         return;  // Use default values
     }
     // Now we can read
-    
+
+    // Fast path: the whole settings struct in one NVS lookup
+    if (loadSettingsBlob(prefs)) {
+        syncMachineTypeFromString();
+        prefs.end();
+        Serial.println("[State] loadSettings() complete (blob)");
+        return;
+    }
+    // Blob missing or stale schema - fall through to per-key reads, then
+    // migrate by writing a fresh blob below
+
     // Temperature
     _settings.temperature.brewSetpoint = prefs.getFloat("brewSP", 93.5f);
     _settings.temperature.steamSetpoint = prefs.getFloat("steamSP", 145.0f);
@@ -214,18 +320,8 @@ void StateManager::loadSettings() {
         strcpy(_settings.machineInfo.machineType, "dual_boiler");
     }
     // Set numeric machine type from string
-    if (strcmp(_settings.machineInfo.machineType, "dual_boiler") == 0) {
-        _state.machineType = 1;
-    } else if (strcmp(_settings.machineInfo.machineType, "single_boiler") == 0) {
-        _state.machineType = 2;
-    } else if (strcmp(_settings.machineInfo.machineType, "heat_exchanger") == 0) {
-        _state.machineType = 3;
-    } else if (strcmp(_settings.machineInfo.machineType, "thermoblock") == 0) {
-        _state.machineType = 4;
-    } else {
-        _state.machineType = 0;  // unknown
-    }
-    
+    syncMachineTypeFromString();
+
     // Notification Preferences
     _settings.notifications.machineReady = prefs.getBool("notifReady", true);
     _settings.notifications.waterEmpty = prefs.getBool("notifWater", true);
@@ -258,14 +354,19 @@ void StateManager::loadSettings() {
     
     Serial.println("[State] Finished reading settings, closing NVS...");
     // Serial.flush(); // Removed - can block on USB CDC
-    
+
     prefs.end();
-    
-    Serial.println("[State] loadSettings() complete");
+
+    // Migration: persist the blob so the next boot is one read instead of
+    // dozens. One-time write per firmware/schema change, not per boot.
+    writeSettingsBlob();
+
+    Serial.println("[State] loadSettings() complete (per-key, blob migrated)");
 }
 
 void StateManager::saveSettings() {
     LOG_I("Saving all settings to NVS");
+    beginSettingsUpdate();
     saveTemperatureSettings();
     saveBrewSettings();
     savePowerSettings();
@@ -278,10 +379,80 @@ void StateManager::saveSettings() {
     saveNotificationSettings();
     saveSystemSettings();
     saveUserPreferences();
+    commitSettingsUpdate();
     LOG_I("All settings saved successfully");
 }
 
+// =============================================================================
+// Write-behind persistence
+//
+// The granular save*Settings() methods below only stage their section in a
+// dirty mask and notify listeners - the actual NVS/LittleFS writes happen in
+// loop() after a short debounce window (or in flushNow() on shutdown paths).
+// Settings POSTs used to block on flash commits inside the async_tcp task;
+// this keeps flash out of the request path entirely, and a burst of saves
+// (e.g. the settings page writing several sections) commits in one batch.
+// =============================================================================
+
+void StateManager::markDirty(uint16_t section) {
+    _dirtySections |= section;
+    _lastDirtyMark = millis();
+}
+
+void StateManager::flushDirtySections() {
+    uint16_t sections = _dirtySections;
+    _dirtySections = 0;
+    if (!sections) {
+        return;
+    }
+
+    if (sections & SECTION_TEMPERATURE)   writeTemperatureSettings();
+    if (sections & SECTION_BREW)          writeBrewSettings();
+    if (sections & SECTION_POWER)         writePowerSettings();
+    if (sections & SECTION_NETWORK)       writeNetworkSettings();
+    if (sections & SECTION_TIME)          writeTimeSettings();
+    if (sections & SECTION_MQTT)          writeMQTTSettings();
+    if (sections & SECTION_CLOUD)         writeCloudSettings();
+    if (sections & SECTION_SCALE)         writeScaleSettings();
+    if (sections & SECTION_DISPLAY)       writeDisplaySettings();
+    if (sections & SECTION_SCHEDULE)      writeScheduleSettings();
+    if (sections & SECTION_MACHINE_INFO)  writeMachineInfoSettings();
+    if (sections & SECTION_NOTIFICATIONS) writeNotificationSettings();
+    if (sections & SECTION_SYSTEM)        writeSystemSettings();
+    if (sections & SECTION_PREFERENCES)   writeUserPreferences();
+
+    // Keep the one-read boot blob in sync with the per-key entries. NVS only
+    // rewrites the entry when contents changed, and we're already in a
+    // debounced flush, so this adds one write per batch at most.
+    writeSettingsBlob();
+
+    LOG_D("Settings flushed (mask 0x%04x)", sections);
+}
+
+void StateManager::flushNow() {
+    flushDirtySections();
+}
+
+void StateManager::beginSettingsUpdate() {
+    _settingsTxnDepth++;
+}
+
+void StateManager::commitSettingsUpdate() {
+    if (_settingsTxnDepth == 0) {
+        return;  // Unbalanced commit - ignore
+    }
+    if (--_settingsTxnDepth == 0 && _settingsTxnNotifyPending) {
+        _settingsTxnNotifyPending = false;
+        notifySettingsChanged();
+    }
+}
+
 void StateManager::saveTemperatureSettings() {
+    markDirty(SECTION_TEMPERATURE);
+    notifySettingsChanged();
+}
+
+void StateManager::writeTemperatureSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putFloat("brewSP", _settings.temperature.brewSetpoint);
     _prefs.putFloat("steamSP", _settings.temperature.steamSetpoint);
@@ -290,10 +461,14 @@ void StateManager::saveTemperatureSettings() {
     _prefs.putFloat("ecoTemp", _settings.temperature.ecoBrewTemp);
     _prefs.putUShort("ecoTimeout", _settings.temperature.ecoTimeoutMinutes);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveBrewSettings() {
+    markDirty(SECTION_BREW);
+    notifySettingsChanged();
+}
+
+void StateManager::writeBrewSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("bbwEnabled", _settings.brew.bbwEnabled);
     _prefs.putFloat("doseWt", _settings.brew.doseWeight);
@@ -304,29 +479,41 @@ void StateManager::saveBrewSettings() {
     _prefs.putFloat("preinfP", _settings.brew.preinfusionPressure);
     _prefs.putUShort("preinfPause", _settings.brew.preinfusionPauseMs);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::savePowerSettings() {
+    markDirty(SECTION_POWER);
+    notifySettingsChanged();
+}
+
+void StateManager::writePowerSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putUShort("voltage", _settings.power.mainsVoltage);
     _prefs.putFloat("maxCurr", _settings.power.maxCurrent);
     _prefs.putBool("pwrBoot", _settings.power.powerOnBoot);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveNetworkSettings() {
+    markDirty(SECTION_NETWORK);
+    notifySettingsChanged();
+}
+
+void StateManager::writeNetworkSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putString("wifiSsid", _settings.network.wifiSsid);
     _prefs.putString("wifiPass", _settings.network.wifiPassword);
     _prefs.putBool("wifiCfg", _settings.network.wifiConfigured);
     _prefs.putString("hostname", _settings.network.hostname);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveTimeSettings() {
+    markDirty(SECTION_TIME);
+    notifySettingsChanged();
+}
+
+void StateManager::writeTimeSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("useNTP", _settings.time.useNTP);
     _prefs.putString("ntpSrv", _settings.time.ntpServer);
@@ -334,10 +521,14 @@ void StateManager::saveTimeSettings() {
     _prefs.putBool("dstEn", _settings.time.dstEnabled);
     _prefs.putShort("dstOff", _settings.time.dstOffsetMinutes);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveMQTTSettings() {
+    markDirty(SECTION_MQTT);
+    notifySettingsChanged();
+}
+
+void StateManager::writeMQTTSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("mqttEn", _settings.mqtt.enabled);
     _prefs.putString("mqttBrk", _settings.mqtt.broker);
@@ -347,30 +538,42 @@ void StateManager::saveMQTTSettings() {
     _prefs.putString("mqttTopic", _settings.mqtt.baseTopic);
     _prefs.putBool("mqttDisc", _settings.mqtt.discovery);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveCloudSettings() {
+    markDirty(SECTION_CLOUD);
+    notifySettingsChanged();
+}
+
+void StateManager::writeCloudSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("cloudEn", _settings.cloud.enabled);
     _prefs.putString("cloudUrl", _settings.cloud.serverUrl);
     _prefs.putString("devId", _settings.cloud.deviceId);
     _prefs.putString("devKey", _settings.cloud.deviceKey);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveScaleSettings() {
+    markDirty(SECTION_SCALE);
+    notifySettingsChanged();
+}
+
+void StateManager::writeScaleSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("scaleEn", _settings.scale.enabled);
     _prefs.putString("scaleAddr", _settings.scale.pairedAddress);
     _prefs.putString("scaleName", _settings.scale.pairedName);
     _prefs.putUChar("scaleType", _settings.scale.scaleType);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveDisplaySettings() {
+    markDirty(SECTION_DISPLAY);
+    notifySettingsChanged();
+}
+
+void StateManager::writeDisplaySettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putUChar("dispBri", _settings.display.brightness);
     _prefs.putUChar("dispTO", _settings.display.screenTimeout);
@@ -378,20 +581,28 @@ void StateManager::saveDisplaySettings() {
     _prefs.putBool("showWt", _settings.display.showWeight);
     _prefs.putBool("showPres", _settings.display.showPressure);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveMachineInfoSettings() {
+    markDirty(SECTION_MACHINE_INFO);
+    notifySettingsChanged();
+}
+
+void StateManager::writeMachineInfoSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putString("devName", _settings.machineInfo.deviceName);
     _prefs.putString("mcBrand", _settings.machineInfo.machineBrand);
     _prefs.putString("mcModel", _settings.machineInfo.machineModel);
     _prefs.putString("mcType", _settings.machineInfo.machineType);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveNotificationSettings() {
+    markDirty(SECTION_NOTIFICATIONS);
+    notifySettingsChanged();
+}
+
+void StateManager::writeNotificationSettings() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putBool("notifReady", _settings.notifications.machineReady);
     _prefs.putBool("notifWater", _settings.notifications.waterEmpty);
@@ -403,10 +614,14 @@ void StateManager::saveNotificationSettings() {
     _prefs.putBool("notifSched", _settings.notifications.scheduleTriggered);
     _prefs.putBool("notifBrew", _settings.notifications.brewComplete);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::saveSystemSettings() {
+    markDirty(SECTION_SYSTEM);
+    notifySettingsChanged();
+}
+
+void StateManager::writeSystemSettings() {
     if (!_prefs.begin(NVS_SETTINGS, false)) {
         Serial.println("[State] ERROR: Failed to open NVS for system settings save");
         return;
@@ -421,10 +636,14 @@ void StateManager::saveSystemSettings() {
           _settings.system.logBufferEnabled ? "true" : "false",
           _settings.system.debugLogsEnabled ? "true" : "false",
           _settings.system.picoLogForwardingEnabled ? "true" : "false");
-    notifySettingsChanged();
 }
 
 void StateManager::saveUserPreferences() {
+    markDirty(SECTION_PREFERENCES);
+    notifySettingsChanged();
+}
+
+void StateManager::writeUserPreferences() {
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.putUChar("prefDOW", _settings.preferences.firstDayOfWeek);
     _prefs.putBool("pref24h", _settings.preferences.use24HourTime);
@@ -434,15 +653,18 @@ void StateManager::saveUserPreferences() {
     _prefs.putUChar("prefHeatS", _settings.preferences.lastHeatingStrategy);
     _prefs.putBool("prefInit", _settings.preferences.initialized);
     _prefs.end();
-    notifySettingsChanged();
 }
 
 void StateManager::resetSettings() {
     _settings = Settings();  // Reset to defaults
     saveSettings();
+    flushNow();  // Resets should hit flash immediately
 }
 
 void StateManager::factoryReset() {
+    // Drop any staged writes - they'd resurrect settings after the clear
+    _dirtySections = 0;
+
     // Clear all settings
     _prefs.begin(NVS_SETTINGS, false);
     _prefs.clear();
@@ -462,7 +684,7 @@ void StateManager::factoryReset() {
     // which is called by the factory_reset command handler
     
     // Remove shot history file
-    LittleFS.remove(SHOT_HISTORY_FILE);
+    userFS().remove(SHOT_HISTORY_FILE);
     
     // Reset in-memory state to defaults
     _settings = Settings();
@@ -561,14 +783,14 @@ void StateManager::recordMaintenance(const char* type) {
 
 void StateManager::loadShotHistory() {
     // Missing file is normal after fresh flash
-    if (!LittleFS.exists(SHOT_HISTORY_FILE)) {
+    if (!userFS().exists(SHOT_HISTORY_FILE)) {
         Serial.println("[State] No shot history (fresh flash) - starting empty");
         _shotHistory.clear();  // Ensure clean state
         _lastSavedShotCount = 0;
         return;
     }
     
-    File file = LittleFS.open(SHOT_HISTORY_FILE, "r");
+    File file = userFS().open(SHOT_HISTORY_FILE, "r");
     if (!file) {
         Serial.println("[State] Failed to open shot history - using defaults");
         _shotHistory.clear();
@@ -647,7 +869,7 @@ bool StateManager::saveShotHistory() {
     yield();
     
     // Write to file
-    File file = LittleFS.open(SHOT_HISTORY_FILE, "w");
+    File file = userFS().open(SHOT_HISTORY_FILE, "w");
     if (!file) {
         free(buffer);
         Serial.println("[State] Failed to open shot history file for writing");
@@ -693,7 +915,7 @@ void StateManager::clearShotHistory() {
     _shotHistory.clear();
     _shotHistoryDirty = false;
     _lastSavedShotCount = 0;
-    LittleFS.remove(SHOT_HISTORY_FILE);
+    userFS().remove(SHOT_HISTORY_FILE);
 }
 
 // =============================================================================
@@ -702,6 +924,8 @@ void StateManager::clearShotHistory() {
 
 void StateManager::setMachineState(MachineState newState) {
     if (_state.state != newState) {
+        // Feed the crash-surviving flight recorder - a few stores, no lock
+        FlightRecorder::recordStateChange((uint8_t)_state.state, (uint8_t)newState);
         _state.state = newState;
         notifyStateChanged();
     }
@@ -843,6 +1067,27 @@ void StateManager::endShot() {
     notifyStateChanged();
 }
 
+void StateManager::recordStopLatency(uint16_t sampleAgeMs, uint16_t gpioMs, uint16_t chainMs) {
+    if (_state.shotActive) {
+        // Chain measured before the shot record was closed out
+        _currentShot.stopSampleAgeMs = sampleAgeMs;
+        _currentShot.stopGpioMs = gpioMs;
+        _currentShot.stopChainMs = chainMs;
+    } else if (_shotHistory.count > 0) {
+        // endShot() usually runs before the full chain latency is known -
+        // patch the record that was just added to history
+        uint8_t lastIndex = (_shotHistory.head + MAX_SHOT_HISTORY - 1) % MAX_SHOT_HISTORY;
+        _shotHistory.shots[lastIndex].stopSampleAgeMs = sampleAgeMs;
+        _shotHistory.shots[lastIndex].stopGpioMs = gpioMs;
+        _shotHistory.shots[lastIndex].stopChainMs = chainMs;
+        _shotHistoryDirty = true;
+    } else {
+        return;
+    }
+    Serial.printf("[State] Weight-stop latency: sample age %ums, gpio %ums, chain %ums\n",
+                  sampleAgeMs, gpioMs, chainMs);
+}
+
 uint32_t StateManager::getShotDuration() const {
     if (!_state.shotActive) return 0;
     return millis() - _state.shotStartTime;
@@ -869,6 +1114,12 @@ void StateManager::onShotCompleted(ShotCallback callback) {
 }
 
 void StateManager::notifySettingsChanged() {
+    if (_settingsTxnDepth > 0) {
+        // Inside a transaction - defer to a single notification at commit
+        _settingsTxnNotifyPending = true;
+        return;
+    }
+    _settingsGeneration++;
     if (_onSettingsChanged) {
         _onSettingsChanged(_settings);
     }
@@ -1000,8 +1251,13 @@ static const char* NVS_SCHEDULES = "schedules";
 static const char* SCHEDULE_FILE = "/schedules.json";
 
 void StateManager::saveScheduleSettings() {
+    markDirty(SECTION_SCHEDULE);
+    notifySettingsChanged();
+}
+
+void StateManager::writeScheduleSettings() {
     // Save to LittleFS as JSON (NVS has limited size for complex data)
-    File file = LittleFS.open(SCHEDULE_FILE, "w");
+    File file = userFS().open(SCHEDULE_FILE, "w");
     if (!file) {
         Serial.println("[State] Failed to write schedules");
         return;
@@ -1016,18 +1272,17 @@ void StateManager::saveScheduleSettings() {
     file.close();
     
     Serial.printf("[State] Schedules saved (%d active)\n", _settings.schedule.count);
-    notifySettingsChanged();
 }
 
 void StateManager::loadScheduleSettings() {
     // Missing file is normal after fresh flash
-    if (!LittleFS.exists(SCHEDULE_FILE)) {
+    if (!userFS().exists(SCHEDULE_FILE)) {
         Serial.println("[State] No schedules (fresh flash) - using defaults");
         // ScheduleSettings will use defaults from constructor
         return;
     }
     
-    File file = LittleFS.open(SCHEDULE_FILE, "r");
+    File file = userFS().open(SCHEDULE_FILE, "r");
     if (!file) {
         Serial.println("[State] Failed to open schedules - using defaults");
         return;
@@ -1082,6 +1337,8 @@ uint8_t StateManager::addSchedule(const ScheduleEntry& entry) {
     uint8_t id = _settings.schedule.addSchedule(entry);
     if (id > 0) {
         saveScheduleSettings();
+        recomputeNextSchedule();
+        if (_onSchedulesChanged) _onSchedulesChanged();
     }
     return id;
 }
@@ -1091,10 +1348,12 @@ bool StateManager::updateSchedule(uint8_t id, const ScheduleEntry& entry) {
     if (!existing) {
         return false;
     }
-    
+
     *existing = entry;
     existing->id = id;  // Preserve ID
     saveScheduleSettings();
+    recomputeNextSchedule();
+    if (_onSchedulesChanged) _onSchedulesChanged();
     return true;
 }
 
@@ -1102,6 +1361,8 @@ bool StateManager::removeSchedule(uint8_t id) {
     bool success = _settings.schedule.removeSchedule(id);
     if (success) {
         saveScheduleSettings();
+        recomputeNextSchedule();
+        if (_onSchedulesChanged) _onSchedulesChanged();
     }
     return success;
 }
@@ -1111,9 +1372,11 @@ bool StateManager::enableSchedule(uint8_t id, bool enabled) {
     if (!entry) {
         return false;
     }
-    
+
     entry->enabled = enabled;
     saveScheduleSettings();
+    recomputeNextSchedule();
+    if (_onSchedulesChanged) _onSchedulesChanged();
     return true;
 }
 
@@ -1127,51 +1390,197 @@ void StateManager::onScheduleTriggered(ScheduleCallback callback) {
     _onScheduleTriggered = callback;
 }
 
+void StateManager::onSchedulesChanged(SchedulesChangedCallback callback) {
+    _onSchedulesChanged = callback;
+}
+
+/**
+ * Compile the wake table the Pico keeps for ESP32-down mornings.
+ *
+ * Only enabled turn-on entries go over - turn-off is a comfort feature,
+ * and auto power-off already runs Pico-side via the eco timeout. The
+ * current minute-of-week rides along as the Pico's clock anchor (it has
+ * no RTC), so every push doubles as a drift correction.
+ *
+ * Layout (MSG_CMD_SET_WAKE_SCHEDULE, all multi-byte fields LE):
+ *   [count][cur_sec][cur_mow u16] + count x [minute_of_day u16][days][strategy]
+ */
+size_t StateManager::buildWakeSchedulePayload(uint8_t* payload, size_t maxLen) {
+    time_t currentTime = time(nullptr);
+    if (currentTime < 1000000) {
+        return 0;  // No usable clock yet - an anchor now would be garbage
+    }
+
+    struct tm tm_now;
+    localtime_r(&currentTime, &tm_now);
+    uint16_t nowMow = ((uint16_t)tm_now.tm_wday * 24 + tm_now.tm_hour) * 60 + tm_now.tm_min;
+
+    if (maxLen < 4 + MAX_SCHEDULES * 4) {
+        return 0;
+    }
+
+    size_t len = 4;
+    uint8_t count = 0;
+    for (size_t i = 0; i < MAX_SCHEDULES; i++) {
+        const ScheduleEntry& sched = _settings.schedule.schedules[i];
+        if (sched.id == 0 || !sched.enabled || sched.action != ACTION_TURN_ON) {
+            continue;
+        }
+        uint16_t minuteOfDay = (uint16_t)sched.hour * 60 + sched.minute;
+        payload[len++] = minuteOfDay & 0xFF;
+        payload[len++] = (minuteOfDay >> 8) & 0xFF;
+        payload[len++] = sched.days;
+        payload[len++] = sched.strategy;
+        count++;
+    }
+
+    payload[0] = count;
+    payload[1] = (uint8_t)tm_now.tm_sec;
+    payload[2] = nowMow & 0xFF;
+    payload[3] = (nowMow >> 8) & 0xFF;
+    return len;
+}
+
+/**
+ * Rebuild the next-deadline cache.
+ *
+ * Schedule entries are minute-aligned weekly events, so the whole table
+ * compiles down to one timestamp: the earliest upcoming trigger. This is
+ * recomputed on every schedule edit and after each firing; checkSchedules()
+ * then does a single epoch compare instead of scanning all entries with
+ * localtime conversions every pass.
+ *
+ * The deadline is epoch arithmetic from the current local time, which goes
+ * stale if the wall-clock mapping shifts under it (DST change, NTP step).
+ * The horizon is therefore capped at 6 hours - at worst the cache wakes a
+ * few extra times per day, re-evaluates against real local time (finding
+ * no match), and recomputes against the corrected mapping.
+ */
+void StateManager::recomputeNextSchedule() {
+    _nextScheduleEpoch = 0;
+
+    time_t currentTime = time(nullptr);
+    if (currentTime < 1000000) {
+        // No clock at all - neither SNTP nor a TimeKeeper checkpoint restore
+        // has set it yet; checkSchedules() retries until one does
+        return;
+    }
+
+    struct tm tm_now;
+    localtime_r(&currentTime, &tm_now);
+
+    constexpr uint32_t WEEK_MINUTES = 7 * 24 * 60;
+    uint32_t nowMow = ((uint32_t)tm_now.tm_wday * 24 + tm_now.tm_hour) * 60 + tm_now.tm_min;
+
+    uint32_t bestDelta = UINT32_MAX;
+    for (size_t i = 0; i < MAX_SCHEDULES; i++) {
+        const ScheduleEntry& sched = _settings.schedule.schedules[i];
+        if (sched.id == 0 || !sched.enabled) {
+            continue;
+        }
+        for (uint8_t day = 0; day < 7; day++) {
+            if (!sched.isValidForDay(day)) {
+                continue;
+            }
+            uint32_t mow = ((uint32_t)day * 24 + sched.hour) * 60 + sched.minute;
+            // Minutes until this occurrence, always in the future (the
+            // current minute has already been evaluated): 1..WEEK_MINUTES
+            uint32_t delta = (mow + WEEK_MINUTES - nowMow - 1) % WEEK_MINUTES + 1;
+            if (delta < bestDelta) {
+                bestDelta = delta;
+            }
+        }
+    }
+
+    if (bestDelta == UINT32_MAX) {
+        return;  // No enabled schedules
+    }
+    if (bestDelta > 6 * 60) {
+        bestDelta = 6 * 60;  // Horizon cap (see doc comment)
+    }
+
+    // Anchor at the start of the current minute, then step forward
+    _nextScheduleEpoch = currentTime - tm_now.tm_sec + (time_t)bestDelta * 60;
+}
+
 void StateManager::checkSchedules() {
     uint32_t now = millis();
-    
+
     // Only check every SCHEDULE_CHECK_INTERVAL
     if (now - _lastScheduleCheck < SCHEDULE_CHECK_INTERVAL) {
         return;
     }
     _lastScheduleCheck = now;
-    
+
     // Get current time
     time_t currentTime = time(nullptr);
     if (currentTime < 1000000) {
-        // Time not set yet (NTP not synced)
+        // Time not set at all (no SNTP and no TimeKeeper checkpoint yet)
         return;
     }
-    
+
+    // Next-deadline cache: the schedule table is only scanned when the
+    // precomputed trigger time has arrived. The cache is empty until NTP
+    // syncs (recompute is retried here) or when no schedule is enabled.
+    if (_nextScheduleEpoch == 0 && _settings.schedule.count > 0) {
+        recomputeNextSchedule();
+    }
+    if (_nextScheduleEpoch != 0 && currentTime >= _nextScheduleEpoch) {
+        evaluateSchedules(currentTime);
+        recomputeNextSchedule();
+    }
+
+    // Check auto power-off (millis-based idle compare, no time conversion)
+    if (_settings.schedule.autoPowerOffEnabled &&
+        _settings.schedule.autoPowerOffMinutes > 0 &&
+        isIdleTimeout()) {
+
+        // Create a virtual "off" schedule entry for the callback
+        ScheduleEntry autoPowerOff;
+        autoPowerOff.action = ACTION_TURN_OFF;
+        strncpy(autoPowerOff.name, "Auto Power-Off", sizeof(autoPowerOff.name) - 1);
+
+        Serial.println("[Schedule] Auto power-off triggered");
+
+        if (_onScheduleTriggered) {
+            _onScheduleTriggered(autoPowerOff);
+        }
+
+        // Reset idle timer to prevent repeated triggers
+        resetIdleTimer();
+    }
+}
+
+void StateManager::evaluateSchedules(time_t currentTime) {
     struct tm* tm_now = localtime(&currentTime);
     uint8_t currentHour = tm_now->tm_hour;
     uint8_t currentMinute = tm_now->tm_min;
     uint8_t currentDay = tm_now->tm_wday;  // 0 = Sunday
-    
+
     // Avoid duplicate triggers within the same minute
     uint8_t currentMinuteId = (currentHour * 60) + currentMinute;
     if (_lastScheduleMinute == currentMinuteId) {
         return;
     }
-    
+
     // Collect all matching schedules first to resolve conflicts
     const ScheduleEntry* matchingSchedules[MAX_SCHEDULES];
     size_t matchCount = 0;
-    
+
     for (size_t i = 0; i < MAX_SCHEDULES; i++) {
         const ScheduleEntry& sched = _settings.schedule.schedules[i];
-        
+
         if (sched.id == 0 || !sched.enabled) {
             continue;
         }
-        
+
         // Check if schedule matches current time and day
-        if (sched.matchesTime(currentHour, currentMinute) && 
+        if (sched.matchesTime(currentHour, currentMinute) &&
             sched.isValidForDay(currentDay)) {
             matchingSchedules[matchCount++] = &sched;
         }
     }
-    
+
     // Resolve conflicts if multiple schedules match
     if (matchCount > 0) {
         const ScheduleEntry* scheduleToTrigger = nullptr;
@@ -1230,26 +1639,6 @@ void StateManager::checkSchedules() {
     }
     
     _lastScheduleMinute = currentMinuteId;
-    
-    // Check auto power-off
-    if (_settings.schedule.autoPowerOffEnabled && 
-        _settings.schedule.autoPowerOffMinutes > 0 &&
-        isIdleTimeout()) {
-        
-        // Create a virtual "off" schedule entry for the callback
-        ScheduleEntry autoPowerOff;
-        autoPowerOff.action = ACTION_TURN_OFF;
-        strncpy(autoPowerOff.name, "Auto Power-Off", sizeof(autoPowerOff.name) - 1);
-        
-        Serial.println("[Schedule] Auto power-off triggered");
-        
-        if (_onScheduleTriggered) {
-            _onScheduleTriggered(autoPowerOff);
-        }
-        
-        // Reset idle timer to prevent repeated triggers
-        resetIdleTimer();
-    }
 }
 
 void StateManager::resetIdleTimer() {
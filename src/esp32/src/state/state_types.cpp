@@ -79,6 +79,7 @@ void NetworkSettings::toJson(JsonObject& obj) const {
     // Don't expose password
     obj["wifiConfigured"] = wifiConfigured;
     obj["hostname"] = hostname;
+    obj["fleetEnabled"] = fleetEnabled;
 }
 
 bool NetworkSettings::fromJson(JsonObjectConst obj) {
@@ -92,6 +93,9 @@ bool NetworkSettings::fromJson(JsonObjectConst obj) {
     if (obj["hostname"].is<const char*>()) {
         strncpy(hostname, obj["hostname"] | "brewos", sizeof(hostname) - 1);
     }
+    if (obj["fleetEnabled"].is<bool>()) {
+        fleetEnabled = obj["fleetEnabled"];
+    }
     return true;
 }
 
@@ -510,6 +514,9 @@ void ShotRecord::toJson(JsonObject& obj) const {
     obj["avgTemperature"] = avgTemperature;
     obj["rating"] = rating;
     obj["ratio"] = ratio();
+    obj["stopSampleAgeMs"] = stopSampleAgeMs;
+    obj["stopGpioMs"] = stopGpioMs;
+    obj["stopChainMs"] = stopChainMs;
 }
 
 bool ShotRecord::fromJson(JsonObjectConst obj) {
@@ -522,6 +529,9 @@ bool ShotRecord::fromJson(JsonObjectConst obj) {
     if (obj["peakPressure"].is<float>()) peakPressure = obj["peakPressure"];
     if (obj["avgTemperature"].is<float>()) avgTemperature = obj["avgTemperature"];
     if (obj["rating"].is<uint8_t>()) rating = obj["rating"];
+    if (obj["stopSampleAgeMs"].is<uint16_t>()) stopSampleAgeMs = obj["stopSampleAgeMs"];
+    if (obj["stopGpioMs"].is<uint16_t>()) stopGpioMs = obj["stopGpioMs"];
+    if (obj["stopChainMs"].is<uint16_t>()) stopChainMs = obj["stopChainMs"];
     return true;
 }
 
@@ -569,7 +579,7 @@ void ShotHistory::clear() {
 
 size_t ShotHistory::toBinary(uint8_t* buffer, size_t bufferSize) const {
     // Header: magic (4) + version (1) + count (1) = 6 bytes
-    // Data: count * sizeof(ShotRecord) = count * 40 bytes
+    // Data: count * sizeof(ShotRecord)
     const size_t headerSize = 6;
     const size_t recordSize = sizeof(ShotRecord);
     const size_t totalSize = headerSize + (count * recordSize);
@@ -1,6 +1,8 @@
 #include "statistics/statistics_manager.h"
 #include "notifications/notification_manager.h"
-#include <LittleFS.h>
+#include "memory_utils.h"
+#include "fs_worker.h"
+#include "user_fs.h"
 #include <time.h>
 
 namespace BrewOS {
@@ -14,9 +16,136 @@ constexpr uint32_t DESCALE_ALERT_THRESHOLD = 500;      // Red at 500 shots
 
 // File paths
 static const char* STATS_FILE = "/stats.json";
-static const char* BREW_HISTORY_FILE = "/brew_history.json";
+static const char* BREW_HISTORY_FILE = "/brew_history.json";  // Legacy, migrated to .bin on first boot
+static const char* BREW_HISTORY_BIN_FILE = "/brew_history.bin";
 static const char* POWER_HISTORY_FILE = "/power_history.json";
 static const char* DAILY_HISTORY_FILE = "/daily_history.json";
+static const char* DAILY_ARCHIVE_FILE = "/daily_archive.bin";
+
+// Sanity bound on the gap the archive will zero-fill in one append. A larger
+// jump means the clock is broken - better to drop one day than to pad the
+// file with years of garbage.
+static const uint32_t DAILY_ARCHIVE_MAX_GAP_DAYS = 400;
+
+// Brew history binary ring file
+// Format: [magic:4][version:1][recordSize:1][reserved:2][records: N * sizeof(BrewRecord)]
+// Records are appended in chronological order; once the file holds two rings'
+// worth it is compacted back down to the RAM ring contents.
+struct BrewRingHeader {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t recordSize;
+    uint16_t reserved;
+};
+constexpr uint32_t BREW_RING_MAGIC = 0x42525748;  // "BRWH"
+constexpr uint8_t BREW_RING_VERSION = 1;
+constexpr uint16_t BREW_RING_COMPACT_THRESHOLD = STATS_MAX_BREW_HISTORY * 2;
+
+// =============================================================================
+// SAVE JOURNAL
+// =============================================================================
+
+// Write-ahead journal for stats persistence. Every mutation of a stats file
+// records its intent here first, applies, then marks the entry committed.
+// Whole-file saves apply into a ".new" temp and commit via rename - LittleFS
+// renames atomically, so the target is always either the old content or the
+// new, never the truncated half-write an interrupted "w" rewrite leaves
+// behind (a power cut during auto-save is how brew history has been lost).
+// Boot recovery is O(1): read this one fixed-size record and delete a
+// leftover temp if the last write never committed - no content validation
+// pass over the history files.
+static const char* STATS_JOURNAL_FILE = "/stats_journal.bin";
+
+constexpr uint32_t STATS_JOURNAL_MAGIC = 0x4E4A5453;  // "STJN" little-endian
+
+// Journaled operations
+constexpr uint8_t STATS_JOP_REPLACE = 1;  // Whole-file rewrite via temp + rename
+constexpr uint8_t STATS_JOP_APPEND  = 2;  // Brew ring record append
+constexpr uint8_t STATS_JOP_COMPACT = 3;  // Brew ring compaction
+
+constexpr uint8_t STATS_JSTATE_PENDING   = 1;
+constexpr uint8_t STATS_JSTATE_COMMITTED = 2;
+
+struct __attribute__((packed)) StatsJournalRecord {
+    uint32_t magic = 0;
+    uint32_t seq = 0;      // Monotonic per journaled write
+    uint8_t op = 0;        // STATS_JOP_*
+    uint8_t state = 0;     // STATS_JSTATE_*
+    uint8_t fileId = 0;    // Index into statsJournalPaths[]
+    uint8_t reserved = 0;
+};
+static_assert(sizeof(StatsJournalRecord) == 12, "StatsJournalRecord is an on-flash format");
+
+// fileId -> target path (order is part of the on-flash format)
+static const char* const statsJournalPaths[] = {
+    STATS_FILE, POWER_HISTORY_FILE, DAILY_HISTORY_FILE, BREW_HISTORY_BIN_FILE,
+};
+constexpr uint8_t STATS_JFILE_STATS = 0;
+constexpr uint8_t STATS_JFILE_POWER = 1;
+constexpr uint8_t STATS_JFILE_DAILY = 2;
+constexpr uint8_t STATS_JFILE_BREW_RING = 3;
+constexpr uint8_t STATS_JFILE_COUNT = 4;
+
+static uint32_t s_statsJournalSeq = 0;
+
+static void statsJournalWrite(uint8_t op, uint8_t fileId, uint8_t state) {
+    StatsJournalRecord rec;
+    rec.magic = STATS_JOURNAL_MAGIC;
+    rec.seq = (state == STATS_JSTATE_PENDING) ? ++s_statsJournalSeq : s_statsJournalSeq;
+    rec.op = op;
+    rec.state = state;
+    rec.fileId = fileId;
+    File file = userFS().open(STATS_JOURNAL_FILE, "w");
+    if (file) {
+        file.write((const uint8_t*)&rec, sizeof(rec));
+        file.close();
+    }
+}
+
+static String statsTempPath(uint8_t fileId) {
+    return String(statsJournalPaths[fileId]) + ".new";
+}
+
+// Boot-time recovery: one fixed-size read decides everything. A committed
+// (or absent) journal means the last save finished. A pending entry means
+// power was cut mid-save; for temp+rename ops the only cleanup is deleting
+// the orphaned temp - the rename commit point guarantees the target file
+// itself is whole either way. A pending append means the brew ring may have
+// a torn tail record, which loadBrewHistoryBinary() drops via its alignment
+// check.
+static void recoverStatsJournal() {
+    if (!userFS().exists(STATS_JOURNAL_FILE)) {
+        return;
+    }
+    File file = userFS().open(STATS_JOURNAL_FILE, "r");
+    if (!file) {
+        return;
+    }
+    StatsJournalRecord rec;
+    size_t got = file.read((uint8_t*)&rec, sizeof(rec));
+    file.close();
+
+    if (got != sizeof(rec) || rec.magic != STATS_JOURNAL_MAGIC) {
+        // Torn journal write - the journal itself is the only casualty
+        userFS().remove(STATS_JOURNAL_FILE);
+        return;
+    }
+
+    s_statsJournalSeq = rec.seq;
+    if (rec.state == STATS_JSTATE_COMMITTED) {
+        return;
+    }
+
+    if (rec.fileId < STATS_JFILE_COUNT) {
+        String temp = statsTempPath(rec.fileId);
+        if (userFS().exists(temp.c_str())) {
+            userFS().remove(temp.c_str());
+        }
+    }
+    Serial.printf("[Stats] Recovered interrupted save (seq %lu, op %u) - target file intact\n",
+                  rec.seq, rec.op);
+    statsJournalWrite(rec.op, rec.fileId, STATS_JSTATE_COMMITTED);
+}
 
 // =============================================================================
 // JSON SERIALIZATION
@@ -34,6 +163,10 @@ void BrewRecord::toJson(JsonObject& obj) const {
     if (doseWeight > 0) {
         obj["ratio"] = ratio();
     }
+    if (pumpRmsCounts > 0) {
+        obj["pumpRms"] = pumpRmsCounts;
+        obj["pumpRipple"] = pumpRippleNorm;
+    }
 }
 
 bool BrewRecord::fromJson(JsonObjectConst obj) {
@@ -45,6 +178,8 @@ bool BrewRecord::fromJson(JsonObjectConst obj) {
     if (obj["avgTemperature"].is<float>()) avgTemperature = obj["avgTemperature"];
     if (obj["avgFlowRate"].is<float>()) avgFlowRate = obj["avgFlowRate"];
     if (obj["rating"].is<uint8_t>()) rating = obj["rating"];
+    if (obj["pumpRms"].is<float>()) pumpRmsCounts = obj["pumpRms"];
+    if (obj["pumpRipple"].is<float>()) pumpRippleNorm = obj["pumpRipple"];
     return timestamp > 0;
 }
 
@@ -71,6 +206,8 @@ void DailySummary::toJson(JsonObject& obj) const {
     obj["onTimeMinutes"] = onTimeMinutes;
     obj["steamCycles"] = steamCycles;
     obj["avgBrewTimeMs"] = avgBrewTimeMs;
+    obj["minBrewTimeMs"] = minBrewTimeMs;
+    obj["maxBrewTimeMs"] = maxBrewTimeMs;
 }
 
 bool DailySummary::fromJson(JsonObjectConst obj) {
@@ -81,6 +218,8 @@ bool DailySummary::fromJson(JsonObjectConst obj) {
     if (obj["onTimeMinutes"].is<uint16_t>()) onTimeMinutes = obj["onTimeMinutes"];
     if (obj["steamCycles"].is<uint8_t>()) steamCycles = obj["steamCycles"];
     if (obj["avgBrewTimeMs"].is<float>()) avgBrewTimeMs = obj["avgBrewTimeMs"];
+    if (obj["minBrewTimeMs"].is<float>()) minBrewTimeMs = obj["minBrewTimeMs"];
+    if (obj["maxBrewTimeMs"].is<float>()) maxBrewTimeMs = obj["maxBrewTimeMs"];
     return true;
 }
 
@@ -181,26 +320,101 @@ StatisticsManager& StatisticsManager::getInstance() {
 
 void StatisticsManager::begin() {
     Serial.println("[Stats] Initializing statistics manager...");
-    
-    loadFromFlash();
-    
-    // Initialize today tracking
+
+    // Allocate brew history in PSRAM - 500 records (~16KB) would bloat the
+    // singleton's internal RAM footprint if kept as an inline array
+    if (!_brewHistory) {
+        _brewHistory = (BrewRecord*)psram_malloc(sizeof(BrewRecord) * STATS_MAX_BREW_HISTORY);
+        if (_brewHistory) {
+            memset(_brewHistory, 0, sizeof(BrewRecord) * STATS_MAX_BREW_HISTORY);
+        } else {
+            Serial.println("[Stats] ERROR: Failed to allocate brew history buffer");
+        }
+    }
+
+    // Settle any save interrupted by the last power cut before reading
+    // anything - one fixed-size journal read, not a file scan
+    recoverStatsJournal();
+
+    // Only the lifetime counters load here (one small JSON file). The
+    // brew/power/daily history files hydrate lazily from loop() - boot
+    // shouldn't pay for reading a 500-shot history nobody looks at most days.
+    loadLifetimeFromFlash();
+
     _todayStartTimestamp = getTodayMidnight();
     _lastPowerSampleTime = millis();
     _lastSaveTime = millis();
-    
-    Serial.printf("[Stats] Loaded: %lu total shots, %lu steam cycles, %.2f kWh\n",
+    _beginTime = millis();
+
+    // Fixed-interval power sampler. Energy integration used to happen
+    // inline in updatePower() assuming a ~500ms call cadence, so kWh error
+    // tracked main-loop load. The timer tick is load-independent; loop()
+    // just drains the ring.
+    if (!_powerTimer) {
+        const esp_timer_create_args_t timerArgs = {
+            .callback = &StatisticsManager::powerTimerCallback,
+            .arg = this,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "stats_power",
+            .skip_unhandled_events = true,
+        };
+        if (esp_timer_create(&timerArgs, &_powerTimer) == ESP_OK) {
+            esp_timer_start_periodic(_powerTimer, (uint64_t)STATS_POWER_TICK_MS * 1000ULL);
+        } else {
+            Serial.println("[Stats] ERROR: Failed to create power sample timer");
+        }
+    }
+
+    Serial.printf("[Stats] Loaded: %lu total shots, %lu steam cycles, %.2f kWh (histories deferred)\n",
                   _lifetime.totalShots, _lifetime.totalSteamCycles, _lifetime.totalKwh);
-    Serial.printf("[Stats] Brew history: %d entries, Power samples: %d, Daily summaries: %d\n",
+}
+
+void StatisticsManager::ensureHydrated() {
+    if (_hydrated) {
+        return;
+    }
+    _hydrated = true;
+    _hydrateRequested = false;
+
+    hydrateHistories();
+
+    // Rebuild today's accumulator from the loaded history once - after this
+    // it is maintained incrementally at record time, never recomputed on query
+    calculatePeriodStats(_todayStats, _todayStartTimestamp);
+
+    // Invalidate cached REST responses built while "hydrating"
+    _generation++;
+
+    Serial.printf("[Stats] Histories hydrated: %d brews, %d power samples, %d daily summaries\n",
                   _brewHistoryCount, _powerSamplesCount, _dailySummariesCount);
 }
 
 void StatisticsManager::loop() {
     uint32_t now = millis();
-    
+
+    // Lazy hydration: on first query, or unprompted shortly after boot so
+    // day-change folding always has real history to work with
+    if (!_hydrated && (_hydrateRequested || now - _beginTime >= HYDRATE_DELAY)) {
+        ensureHydrated();
+    }
+
     // Check for day change
     checkDayChange();
-    
+
+    // Drain fixed-interval ticks from the timer-driven sampler. Each tick
+    // is exactly STATS_POWER_TICK_MS of integration time, so total kWh is
+    // independent of how often loop() runs
+    const float tickHours = (float)STATS_POWER_TICK_MS / 3600000.0f;
+    while (_powerTickTail != _powerTickHead) {
+        float watts = _powerTicks[_powerTickTail];
+        _powerTickTail = (uint16_t)((_powerTickTail + 1) % STATS_POWER_TICK_RING);
+        _powerSampleSum += watts;
+        if (watts > _powerSampleMax) _powerSampleMax = watts;
+        _powerSampleCount++;
+        _lifetime.totalKwh += (watts / 1000.0f) * tickHours;
+        _fragLifetimeDirty = true;
+    }
+
     // Power sampling every 5 minutes
     if (_machineIsOn && (now - _lastPowerSampleTime >= STATS_POWER_SAMPLE_INTERVAL)) {
         if (_powerSampleCount > 0) {
@@ -208,11 +422,11 @@ void StatisticsManager::loop() {
             sample.timestamp = time(nullptr);
             sample.avgWatts = _powerSampleSum / _powerSampleCount;
             sample.maxWatts = _powerSampleMax;
-            
-            // Calculate kWh for interval (watts * hours)
-            float hoursElapsed = (float)STATS_POWER_SAMPLE_INTERVAL / 3600000.0f;
-            sample.kwhConsumed = (sample.avgWatts / 1000.0f) * hoursElapsed;
-            
+
+            // kWh over the ticks actually accumulated - if the machine was
+            // only on for part of the interval, only that time is billed
+            sample.kwhConsumed = (_powerSampleSum / 1000.0f) * tickHours;
+
             addPowerSample(sample);
             
             // Reset accumulators
@@ -241,9 +455,13 @@ bool StatisticsManager::recordBrew(uint32_t durationMs, float yieldWeight, float
                       durationMs, STATS_MIN_BREW_TIME_MS, STATS_MAX_BREW_TIME_MS);
         return false;
     }
-    
+
+    // Histories must be in memory before we append to them - otherwise a
+    // later hydration would clobber this record
+    ensureHydrated();
+
     uint32_t now = time(nullptr);
-    
+
     // Create brew record
     BrewRecord record;
     record.timestamp = now;
@@ -275,7 +493,18 @@ bool StatisticsManager::recordBrew(uint32_t durationMs, float yieldWeight, float
     
     // Recalculate average
     _lifetime.avgBrewTimeMs = (float)_lifetime.totalBrewTimeMs / _lifetime.totalShots;
-    
+
+    // Update today's accumulator (min of 0 means no shots yet today)
+    _todayStats.shotCount++;
+    _todayStats.totalBrewTimeMs += durationMs;
+    if (_todayStats.minBrewTimeMs == 0 || durationMs < _todayStats.minBrewTimeMs) {
+        _todayStats.minBrewTimeMs = durationMs;
+    }
+    if (durationMs > _todayStats.maxBrewTimeMs) {
+        _todayStats.maxBrewTimeMs = durationMs;
+    }
+    _todayStats.avgBrewTimeMs = (float)_todayStats.totalBrewTimeMs / _todayStats.shotCount;
+
     // Update maintenance counters
     _maintenance.shotsSinceBackflush++;
     _maintenance.shotsSinceGroupClean++;
@@ -285,6 +514,9 @@ bool StatisticsManager::recordBrew(uint32_t durationMs, float yieldWeight, float
     _sessionShots++;
     
     _dirty = true;
+    _generation++;
+    _fragLifetimeDirty = true;
+    _fragMaintenanceDirty = true;
     
     Serial.printf("[Stats] Recorded brew: %lu ms, total shots: %lu\n", durationMs, _lifetime.totalShots);
     
@@ -298,6 +530,8 @@ bool StatisticsManager::recordBrew(uint32_t durationMs, float yieldWeight, float
 void StatisticsManager::recordSteamCycle() {
     _lifetime.totalSteamCycles++;
     _dirty = true;
+    _generation++;
+    _fragLifetimeDirty = true;
     notifyChange();
 }
 
@@ -305,6 +539,8 @@ void StatisticsManager::recordMaintenance(const char* type) {
     uint32_t now = time(nullptr);
     _maintenance.recordMaintenance(type, now);
     _dirty = true;
+    _generation++;
+    _fragMaintenanceDirty = true;
     save();  // Save immediately for maintenance events
     notifyChange();
     Serial.printf("[Stats] Recorded maintenance: %s\n", type);
@@ -337,7 +573,31 @@ bool StatisticsManager::rateBrew(uint8_t index, uint8_t rating) {
     // Calculate actual index (0 = most recent)
     int actualIndex = (_brewHistoryHead - 1 - index + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
     _brewHistory[actualIndex].rating = rating;
-    _dirty = true;
+    // Patch the persisted record in place (newest record is last in the file)
+    updateBrewRecordInFlash(_brewFileRecords - 1 - index, _brewHistory[actualIndex]);
+    _generation++;
+    return true;
+}
+
+bool StatisticsManager::attachPumpMetrics(float rmsCounts, float rippleNorm) {
+    if (_brewHistoryCount == 0) return false;
+
+    int actualIndex = (_brewHistoryHead - 1 + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
+    BrewRecord& record = _brewHistory[actualIndex];
+
+    // Only patch a record from the shot that just ended - the burst drain
+    // takes well under a minute, so anything older belongs to a brew that
+    // recordBrew() rejected (flush, cleaning cycle)
+    uint32_t now = time(nullptr);
+    if (record.timestamp == 0 || now < record.timestamp ||
+        now - record.timestamp > 60) {
+        return false;
+    }
+
+    record.pumpRmsCounts = rmsCounts;
+    record.pumpRippleNorm = rippleNorm;
+    updateBrewRecordInFlash(_brewFileRecords - 1, record);
+    _generation++;
     return true;
 }
 
@@ -357,18 +617,34 @@ void StatisticsManager::updatePower(float watts, bool isOn) {
         uint32_t onDurationMinutes = (millis() - _machineOnStartTime) / 60000;
         _lifetime.totalOnTimeMinutes += onDurationMinutes;
         _dirty = true;
+        _generation++;
+        _fragLifetimeDirty = true;
     }
     _machineIsOn = isOn;
-    
-    if (isOn && watts > 0) {
-        _powerSampleSum += watts;
-        if (watts > _powerSampleMax) _powerSampleMax = watts;
-        _powerSampleCount++;
-        
-        // Update total kWh (assuming this is called ~every 500ms)
-        float kwhIncrement = (watts / 1000.0f) * (0.5f / 3600.0f);  // watts * hours
-        _lifetime.totalKwh += kwhIncrement;
+
+    // No integration here - the timer tick samples _currentWatts at a fixed
+    // interval, so call cadence (and its jitter) no longer shapes the kWh sum
+}
+
+void StatisticsManager::powerTimerCallback(void* arg) {
+    StatisticsManager* self = (StatisticsManager*)arg;
+    if (!self->_machineIsOn) {
+        return;
+    }
+    float watts = self->_currentWatts;
+    if (watts <= 0) {
+        return;
     }
+
+    uint16_t head = self->_powerTickHead;
+    uint16_t next = (uint16_t)((head + 1) % STATS_POWER_TICK_RING);
+    if (next == self->_powerTickTail) {
+        // Consumer stalled for the entire ring depth - drop rather than block
+        self->_powerTickOverruns++;
+        return;
+    }
+    self->_powerTicks[head] = watts;
+    self->_powerTickHead = next;
 }
 
 // =============================================================================
@@ -386,65 +662,115 @@ void StatisticsManager::getFullStatistics(FullStatistics& stats) const {
     getMonthlyStats(stats.monthly);
 }
 
-void StatisticsManager::getDailyStats(PeriodStats& stats) const {
-    // Use cache if valid and same day
-    time_t now = time(nullptr);
-    if (now > 0) {
-        struct tm* tm_now = localtime(&now);
-        uint16_t currentDay = tm_now->tm_yday;
-        
-        if (!_statsCacheInvalid && _cachedDailyDay == currentDay && 
-            _cachedDailyTimestamp > 0 && (now - _cachedDailyTimestamp) < 3600) {
-            // Cache is valid (same day, less than 1 hour old)
-            stats = _cachedDailyStats;
-            return;
-        }
+const String& StatisticsManager::lifetimeFragment() const {
+    if (_fragLifetimeDirty || _fragLifetime.length() == 0) {
+        JsonDocument doc;
+        JsonObject obj = doc.to<JsonObject>();
+        _lifetime.toJson(obj);
+        _fragLifetime = "";
+        serializeJson(doc, _fragLifetime);
+        _fragLifetimeDirty = false;
     }
-    
-    // Recalculate and cache
-    uint32_t dayAgo = now - 86400;  // 24 hours
-    calculatePeriodStats(_cachedDailyStats, dayAgo);
-    stats = _cachedDailyStats;
-    _cachedDailyTimestamp = now;
-    if (now > 0) {
-        struct tm* tm_now = localtime(&now);
-        _cachedDailyDay = tm_now->tm_yday;
+    return _fragLifetime;
+}
+
+const String& StatisticsManager::maintenanceFragment() const {
+    if (_fragMaintenanceDirty || _fragMaintenance.length() == 0) {
+        JsonDocument doc;
+        JsonObject obj = doc.to<JsonObject>();
+        _maintenance.toJson(obj);
+        _fragMaintenance = "";
+        serializeJson(doc, _fragMaintenance);
+        _fragMaintenanceDirty = false;
     }
-    _statsCacheInvalid = false;  // Mark cache as valid
+    return _fragMaintenance;
 }
 
-void StatisticsManager::getWeeklyStats(PeriodStats& stats) const {
-    // Use cache if valid (less than 1 hour old)
-    time_t now = time(nullptr);
-    if (!_statsCacheInvalid && _cachedWeeklyTimestamp > 0 && 
-        (now - _cachedWeeklyTimestamp) < 3600) {
-        stats = _cachedWeeklyStats;
-        return;
+void StatisticsManager::fullStatsJson(String& out, bool hydrating) const {
+    // Only the rolling-window sections are serialized per call - they are
+    // O(1) folds over at most 30 daily summaries plus a handful of scalars
+    JsonDocument doc;
+    PeriodStats period;
+
+    getDailyStats(period);
+    JsonObject dailyObj = doc["daily"].to<JsonObject>();
+    period.toJson(dailyObj);
+
+    getWeeklyStats(period);
+    JsonObject weeklyObj = doc["weekly"].to<JsonObject>();
+    period.toJson(weeklyObj);
+
+    getMonthlyStats(period);
+    JsonObject monthlyObj = doc["monthly"].to<JsonObject>();
+    period.toJson(monthlyObj);
+
+    doc["sessionShots"] = _sessionShots;
+    doc["sessionStartTimestamp"] = _sessionStartTimestamp;
+    if (hydrating) {
+        doc["hydrating"] = true;
     }
-    
-    // Recalculate and cache
-    uint32_t weekAgo = now - (7 * 86400);  // 7 days
-    calculatePeriodStats(_cachedWeeklyStats, weekAgo);
-    stats = _cachedWeeklyStats;
-    _cachedWeeklyTimestamp = now;
-    _statsCacheInvalid = false;  // Mark cache as valid
+
+    String periods;
+    serializeJson(doc, periods);
+
+    // Assemble by concatenation: cached lifetime/maintenance fragments,
+    // then the period document minus its opening brace (its closing brace
+    // terminates the whole object)
+    const String& lifetime = lifetimeFragment();
+    const String& maintenance = maintenanceFragment();
+    out = "";
+    out.reserve(lifetime.length() + maintenance.length() + periods.length() + 32);
+    out += "{\"lifetime\":";
+    out += lifetime;
+    out += ",\"maintenance\":";
+    out += maintenance;
+    out += ',';
+    out.concat(periods.c_str() + 1, periods.length() - 1);
+}
+
+void StatisticsManager::getDailyStats(PeriodStats& stats) const {
+    // Incrementally maintained - no history scan, no cache needed
+    stats = _todayStats;
+}
+
+void StatisticsManager::getWeeklyStats(PeriodStats& stats) const {
+    // Today's accumulator plus the last 6 daily summaries
+    foldPeriod(stats, _todayStartTimestamp - (6 * 86400));
 }
 
 void StatisticsManager::getMonthlyStats(PeriodStats& stats) const {
-    // Use cache if valid (less than 1 hour old)
-    time_t now = time(nullptr);
-    if (!_statsCacheInvalid && _cachedMonthlyTimestamp > 0 && 
-        (now - _cachedMonthlyTimestamp) < 3600) {
-        stats = _cachedMonthlyStats;
-        return;
+    // Today's accumulator plus the last 29 daily summaries
+    foldPeriod(stats, _todayStartTimestamp - (29 * 86400));
+}
+
+// Fold today's accumulator with the daily summaries newer than
+// startTimestamp. At most 30 tiny structs - effectively O(1), independent
+// of brew history and power sample counts.
+void StatisticsManager::foldPeriod(PeriodStats& stats, uint32_t startTimestamp) const {
+    stats = _todayStats;
+
+    for (size_t i = 0; i < _dailySummariesCount; i++) {
+        int idx = (_dailySummariesHead - 1 - i + STATS_MAX_DAILY_HISTORY) % STATS_MAX_DAILY_HISTORY;
+        const DailySummary& day = _dailySummaries[idx];
+        if (day.date < startTimestamp) continue;
+
+        stats.shotCount += day.shotCount;
+        stats.totalBrewTimeMs += day.totalBrewTimeMs;
+        stats.totalKwh += day.totalKwh;
+        if (day.shotCount > 0) {
+            if (stats.minBrewTimeMs == 0 ||
+                (day.minBrewTimeMs > 0 && day.minBrewTimeMs < stats.minBrewTimeMs)) {
+                stats.minBrewTimeMs = day.minBrewTimeMs;
+            }
+            if (day.maxBrewTimeMs > stats.maxBrewTimeMs) {
+                stats.maxBrewTimeMs = day.maxBrewTimeMs;
+            }
+        }
+    }
+
+    if (stats.shotCount > 0) {
+        stats.avgBrewTimeMs = (float)stats.totalBrewTimeMs / stats.shotCount;
     }
-    
-    // Recalculate and cache
-    uint32_t monthAgo = now - (30 * 86400);  // 30 days
-    calculatePeriodStats(_cachedMonthlyStats, monthAgo);
-    stats = _cachedMonthlyStats;
-    _cachedMonthlyTimestamp = now;
-    _statsCacheInvalid = false;  // Mark cache as valid
 }
 
 void StatisticsManager::calculatePeriodStats(PeriodStats& stats, uint32_t startTimestamp) const {
@@ -493,12 +819,96 @@ void StatisticsManager::getBrewHistory(JsonArray& arr, size_t maxEntries) const
     }
 }
 
-void StatisticsManager::getPowerHistory(JsonArray& arr) const {
-    for (size_t i = 0; i < _powerSamplesCount; i++) {
+bool StatisticsManager::getBrewRecord(size_t index, BrewRecord& record) const {
+    if (!_brewHistory || index >= _brewHistoryCount) {
+        return false;
+    }
+    int idx = (_brewHistoryHead - 1 - index + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
+    record = _brewHistory[idx];
+    return true;
+}
+
+bool StatisticsManager::getPowerSample(size_t index, PowerSample& sample) const {
+    if (index >= _powerSamplesCount) {
+        return false;
+    }
+    int idx = (_powerSamplesHead - 1 - index + STATS_MAX_POWER_SAMPLES) % STATS_MAX_POWER_SAMPLES;
+    sample = _powerSamples[idx];
+    return true;
+}
+
+uint32_t StatisticsManager::getDailyArchiveCount() const {
+    File file = userFS().open(DAILY_ARCHIVE_FILE, "r");
+    if (!file) {
+        return 0;
+    }
+    size_t size = file.size();
+    file.close();
+    if (size < sizeof(DailyArchiveHeader)) {
+        return 0;
+    }
+    return (size - sizeof(DailyArchiveHeader)) / sizeof(DailyArchiveRecord);
+}
+
+size_t StatisticsManager::readDailyArchive(uint32_t startIndex, DailyArchiveRecord* out,
+                                           size_t maxRecords) const {
+    File file = userFS().open(DAILY_ARCHIVE_FILE, "r");
+    if (!file) {
+        return 0;
+    }
+
+    DailyArchiveHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != STATS_DAILY_ARCHIVE_MAGIC ||
+        header.version != STATS_DAILY_ARCHIVE_VERSION ||
+        header.recordSize != sizeof(DailyArchiveRecord)) {
+        file.close();
+        return 0;
+    }
+
+    file.seek(sizeof(header) + (size_t)startIndex * sizeof(DailyArchiveRecord));
+    size_t read = 0;
+    while (read < maxRecords &&
+           file.read((uint8_t*)&out[read], sizeof(DailyArchiveRecord)) ==
+               sizeof(DailyArchiveRecord)) {
+        read++;
+    }
+    file.close();
+    return read;
+}
+
+void StatisticsManager::getPowerHistory(JsonArray& arr, uint32_t spanHours) const {
+    uint32_t now = time(nullptr);
+    uint32_t cutoff = (now > spanHours * 3600) ? now - spanHours * 3600 : 0;
+
+    // Pick the pyramid level that covers the span with the fewest entries
+    const PowerSample* ring;
+    size_t ringSize;
+    size_t count;
+    size_t head;
+    if (spanHours <= 24) {
+        ring = _powerSamples;
+        ringSize = STATS_MAX_POWER_SAMPLES;
+        count = _powerSamplesCount;
+        head = _powerSamplesHead;
+    } else if (spanHours <= STATS_MAX_HOURLY_SAMPLES) {
+        ring = _hourlySamples;
+        ringSize = STATS_MAX_HOURLY_SAMPLES;
+        count = _hourlySamplesCount;
+        head = _hourlySamplesHead;
+    } else {
+        ring = _dailySamples;
+        ringSize = STATS_MAX_DAILY_SAMPLES;
+        count = _dailySamplesCount;
+        head = _dailySamplesHead;
+    }
+
+    for (size_t i = 0; i < count; i++) {
         // Return in chronological order (oldest first)
-        int idx = (_powerSamplesHead - _powerSamplesCount + i + STATS_MAX_POWER_SAMPLES) % STATS_MAX_POWER_SAMPLES;
+        size_t idx = (head - count + i + ringSize) % ringSize;
+        if (ring[idx].timestamp < cutoff) continue;  // Older than requested span
         JsonObject obj = arr.add<JsonObject>();
-        _powerSamples[idx].toJson(obj);
+        ring[idx].toJson(obj);
     }
 }
 
@@ -568,10 +978,10 @@ void StatisticsManager::getHourlyDistribution(JsonArray& arr) const {
 // PERSISTENCE
 // =============================================================================
 
-void StatisticsManager::loadFromFlash() {
+void StatisticsManager::loadLifetimeFromFlash() {
     // Load lifetime stats
-    if (LittleFS.exists(STATS_FILE)) {
-        File file = LittleFS.open(STATS_FILE, "r");
+    if (userFS().exists(STATS_FILE)) {
+        File file = userFS().open(STATS_FILE, "r");
         if (file) {
             JsonDocument doc;
             DeserializationError error = deserializeJson(doc, file);
@@ -587,61 +997,75 @@ void StatisticsManager::loadFromFlash() {
                 if (!maintObj.isNull()) {
                     _maintenance.fromJson(maintObj);
                 }
+                _fragLifetimeDirty = true;
+                _fragMaintenanceDirty = true;
             }
         }
     }
-    
-    // Load brew history
-    if (LittleFS.exists(BREW_HISTORY_FILE)) {
-        File file = LittleFS.open(BREW_HISTORY_FILE, "r");
-        if (file) {
-            JsonDocument doc;
-            DeserializationError error = deserializeJson(doc, file);
-            file.close();
-            
-            if (!error) {
-                JsonArray arr = doc.as<JsonArray>();
-                _brewHistoryCount = 0;
-                _brewHistoryHead = 0;
-                
-                for (JsonObject obj : arr) {
-                    if (_brewHistoryCount < STATS_MAX_BREW_HISTORY) {
-                        _brewHistory[_brewHistoryHead].fromJson(obj);
-                        _brewHistoryHead = (_brewHistoryHead + 1) % STATS_MAX_BREW_HISTORY;
-                        _brewHistoryCount++;
-                    }
-                }
-            }
+}
+
+void StatisticsManager::hydrateHistories() {
+    // Load brew history from the binary ring file (no JSON deserialization -
+    // records are read straight into the ring). Installs still on the old
+    // JSON file are migrated once.
+    if (_brewHistory) {
+        if (!loadBrewHistoryBinary() && userFS().exists(BREW_HISTORY_FILE)) {
+            migrateBrewHistoryJson();
         }
     }
     
     // Load power history
-    if (LittleFS.exists(POWER_HISTORY_FILE)) {
-        File file = LittleFS.open(POWER_HISTORY_FILE, "r");
+    if (userFS().exists(POWER_HISTORY_FILE)) {
+        File file = userFS().open(POWER_HISTORY_FILE, "r");
         if (file) {
             JsonDocument doc;
             DeserializationError error = deserializeJson(doc, file);
             file.close();
             
             if (!error) {
-                JsonArray arr = doc.as<JsonArray>();
+                // Legacy format was a flat array of raw samples; current
+                // format is {"raw": [...], "hourly": [...], "daily": [...]}
+                JsonArray rawArr = doc.is<JsonArray>() ? doc.as<JsonArray>()
+                                                        : doc["raw"].as<JsonArray>();
                 _powerSamplesCount = 0;
                 _powerSamplesHead = 0;
-                
-                for (JsonObject obj : arr) {
+
+                for (JsonObject obj : rawArr) {
                     if (_powerSamplesCount < STATS_MAX_POWER_SAMPLES) {
                         _powerSamples[_powerSamplesHead].fromJson(obj);
                         _powerSamplesHead = (_powerSamplesHead + 1) % STATS_MAX_POWER_SAMPLES;
                         _powerSamplesCount++;
                     }
                 }
+
+                JsonArray hourlyArr = doc["hourly"].as<JsonArray>();
+                _hourlySamplesCount = 0;
+                _hourlySamplesHead = 0;
+                for (JsonObject obj : hourlyArr) {
+                    if (_hourlySamplesCount < STATS_MAX_HOURLY_SAMPLES) {
+                        _hourlySamples[_hourlySamplesHead].fromJson(obj);
+                        _hourlySamplesHead = (_hourlySamplesHead + 1) % STATS_MAX_HOURLY_SAMPLES;
+                        _hourlySamplesCount++;
+                    }
+                }
+
+                JsonArray dailyArr = doc["daily"].as<JsonArray>();
+                _dailySamplesCount = 0;
+                _dailySamplesHead = 0;
+                for (JsonObject obj : dailyArr) {
+                    if (_dailySamplesCount < STATS_MAX_DAILY_SAMPLES) {
+                        _dailySamples[_dailySamplesHead].fromJson(obj);
+                        _dailySamplesHead = (_dailySamplesHead + 1) % STATS_MAX_DAILY_SAMPLES;
+                        _dailySamplesCount++;
+                    }
+                }
             }
         }
     }
     
     // Load daily summaries
-    if (LittleFS.exists(DAILY_HISTORY_FILE)) {
-        File file = LittleFS.open(DAILY_HISTORY_FILE, "r");
+    if (userFS().exists(DAILY_HISTORY_FILE)) {
+        File file = userFS().open(DAILY_HISTORY_FILE, "r");
         if (file) {
             JsonDocument doc;
             DeserializationError error = deserializeJson(doc, file);
@@ -664,77 +1088,299 @@ void StatisticsManager::loadFromFlash() {
     }
 }
 
+// Returns true if the binary ring file was present (even if corrupt - a
+// corrupt ring is dropped rather than falling back to a stale JSON file).
+// Returns false only when the file doesn't exist, so the caller can migrate.
+bool StatisticsManager::loadBrewHistoryBinary() {
+    if (!userFS().exists(BREW_HISTORY_BIN_FILE)) {
+        return false;
+    }
+
+    File file = userFS().open(BREW_HISTORY_BIN_FILE, "r");
+    if (!file) {
+        return false;
+    }
+
+    BrewRingHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != BREW_RING_MAGIC ||
+        header.version != BREW_RING_VERSION ||
+        header.recordSize != sizeof(BrewRecord)) {
+        // recordSize mismatch also catches a BrewRecord layout change after
+        // an OTA update - safer to start empty than misread raw structs
+        Serial.println("[Stats] Brew history ring invalid - starting empty");
+        file.close();
+        userFS().remove(BREW_HISTORY_BIN_FILE);
+        _brewFileRecords = 0;
+        return true;
+    }
+
+    size_t payloadBytes = file.size() - sizeof(header);
+    size_t fileRecords = payloadBytes / sizeof(BrewRecord);
+    bool tornTail = (payloadBytes % sizeof(BrewRecord)) != 0;
+    _brewFileRecords = (uint16_t)fileRecords;
+
+    // Only the newest STATS_MAX_BREW_HISTORY records fit in the RAM ring
+    size_t skip = fileRecords > STATS_MAX_BREW_HISTORY ? fileRecords - STATS_MAX_BREW_HISTORY : 0;
+    file.seek(sizeof(header) + skip * sizeof(BrewRecord));
+
+    _brewHistoryCount = 0;
+    _brewHistoryHead = 0;
+
+    BrewRecord record;
+    while (file.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+        _brewHistory[_brewHistoryHead] = record;
+        _brewHistoryHead = (_brewHistoryHead + 1) % STATS_MAX_BREW_HISTORY;
+        if (_brewHistoryCount < STATS_MAX_BREW_HISTORY) {
+            _brewHistoryCount++;
+        }
+        if ((_brewHistoryCount % 100) == 0) {
+            yield();  // Large history - don't starve the watchdog
+        }
+    }
+    file.close();
+
+    if (tornTail) {
+        // Partial record at the tail (power cut mid-append). Every full
+        // record loaded fine; rewrite the file from the ring so future
+        // appends don't land misaligned behind the fragment
+        Serial.println("[Stats] Brew history ring has a torn tail - rewriting");
+        compactBrewHistoryFile();
+    }
+
+    Serial.printf("[Stats] Loaded brew history ring: %d entries (%zu in file)\n",
+                  _brewHistoryCount, fileRecords);
+    return true;
+}
+
+// One-time migration from the legacy JSON brew history file. Parses the old
+// format, writes the binary ring, and removes the JSON file.
+void StatisticsManager::migrateBrewHistoryJson() {
+    File file = userFS().open(BREW_HISTORY_FILE, "r");
+    if (!file) {
+        return;
+    }
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+
+    if (!error) {
+        JsonArray arr = doc.as<JsonArray>();
+        _brewHistoryCount = 0;
+        _brewHistoryHead = 0;
+
+        for (JsonObject obj : arr) {
+            if (_brewHistoryCount < STATS_MAX_BREW_HISTORY) {
+                _brewHistory[_brewHistoryHead].fromJson(obj);
+                _brewHistoryHead = (_brewHistoryHead + 1) % STATS_MAX_BREW_HISTORY;
+                _brewHistoryCount++;
+            }
+        }
+
+        compactBrewHistoryFile();  // Writes the ring out as the new .bin
+        Serial.printf("[Stats] Migrated %d brew records from JSON to binary ring\n",
+                      _brewHistoryCount);
+    }
+
+    userFS().remove(BREW_HISTORY_FILE);
+}
+
+// One small append per shot - this replaces the full JSON rewrite that used
+// to happen on every periodic save
+bool StatisticsManager::appendBrewRecordToFlash(const BrewRecord& record) {
+    if (!userFS().exists(BREW_HISTORY_BIN_FILE)) {
+        File file = userFS().open(BREW_HISTORY_BIN_FILE, "w");
+        if (!file) {
+            Serial.println("[Stats] Failed to create brew history ring");
+            return false;
+        }
+        BrewRingHeader header = {BREW_RING_MAGIC, BREW_RING_VERSION, (uint8_t)sizeof(BrewRecord), 0};
+        file.write((const uint8_t*)&header, sizeof(header));
+        file.close();
+        _brewFileRecords = 0;
+    }
+
+    File file = userFS().open(BREW_HISTORY_BIN_FILE, "a");
+    if (!file) {
+        Serial.println("[Stats] Failed to open brew history ring for append");
+        return false;
+    }
+
+    // Intent before the append: if power cuts mid-record, boot sees the
+    // pending entry and the loader's tail alignment check drops the torn
+    // record instead of letting later appends land misaligned behind it
+    statsJournalWrite(STATS_JOP_APPEND, STATS_JFILE_BREW_RING, STATS_JSTATE_PENDING);
+    size_t written = file.write((const uint8_t*)&record, sizeof(record));
+    file.close();
+
+    if (written != sizeof(record)) {
+        // Short write left a torn tail in the live file - rewrite from the
+        // RAM ring (which already holds this record) before anything else
+        // appends behind the fragment
+        Serial.println("[Stats] Brew record append incomplete - rewriting ring");
+        compactBrewHistoryFile();
+        return false;
+    }
+    statsJournalWrite(STATS_JOP_APPEND, STATS_JFILE_BREW_RING, STATS_JSTATE_COMMITTED);
+    _brewFileRecords++;
+
+    // Keep the file bounded: once it holds two rings' worth, rewrite it from
+    // the RAM ring. Rare (every STATS_MAX_BREW_HISTORY shots), so the cost
+    // of the rewrite is amortized away
+    if (_brewFileRecords >= BREW_RING_COMPACT_THRESHOLD) {
+        compactBrewHistoryFile();
+    }
+    return true;
+}
+
+// In-place update of an already-persisted record (used for ratings). The
+// last _brewFileRecords records in the file mirror the RAM ring, newest last.
+bool StatisticsManager::updateBrewRecordInFlash(size_t fileIndex, const BrewRecord& record) {
+    if (fileIndex >= _brewFileRecords) {
+        return false;
+    }
+
+    File file = userFS().open(BREW_HISTORY_BIN_FILE, "r+");
+    if (!file) {
+        return false;
+    }
+    file.seek(sizeof(BrewRingHeader) + fileIndex * sizeof(BrewRecord));
+    size_t written = file.write((const uint8_t*)&record, sizeof(record));
+    file.close();
+    return written == sizeof(record);
+}
+
+void StatisticsManager::compactBrewHistoryFile() {
+    // Compaction used to rewrite the live file in place, so a power cut in
+    // the middle lost the entire history. Journal the intent, build the
+    // replacement under a temp name, and rename over the old ring as the
+    // single commit point - the old file stays whole until the new one is
+    statsJournalWrite(STATS_JOP_COMPACT, STATS_JFILE_BREW_RING, STATS_JSTATE_PENDING);
+    String temp = statsTempPath(STATS_JFILE_BREW_RING);
+    File file = userFS().open(temp.c_str(), "w");
+    if (!file) {
+        Serial.println("[Stats] Failed to open brew history ring for compaction");
+        statsJournalWrite(STATS_JOP_COMPACT, STATS_JFILE_BREW_RING, STATS_JSTATE_COMMITTED);
+        return;
+    }
+
+    BrewRingHeader header = {BREW_RING_MAGIC, BREW_RING_VERSION, (uint8_t)sizeof(BrewRecord), 0};
+    file.write((const uint8_t*)&header, sizeof(header));
+
+    for (size_t i = 0; i < _brewHistoryCount; i++) {
+        if (i > 0 && (i % 100 == 0)) {
+            yield();
+        }
+        int idx = (_brewHistoryHead - _brewHistoryCount + i + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
+        file.write((const uint8_t*)&_brewHistory[idx], sizeof(BrewRecord));
+    }
+    file.close();
+
+    userFS().rename(temp.c_str(), BREW_HISTORY_BIN_FILE);
+    statsJournalWrite(STATS_JOP_COMPACT, STATS_JFILE_BREW_RING, STATS_JSTATE_COMMITTED);
+
+    _brewFileRecords = _brewHistoryCount;
+    Serial.printf("[Stats] Brew history ring compacted (%d records)\n", _brewHistoryCount);
+}
+
+/**
+ * Journaled whole-file replace: intent, apply into a temp, rename, commit.
+ * The rename is the crash-consistency point - LittleFS renames atomically
+ * over the target, so a power cut at any instant leaves the old file or the
+ * new one, never a torn rewrite.
+ */
+static void writeFileJournaled(uint8_t fileId, const String& payload) {
+    statsJournalWrite(STATS_JOP_REPLACE, fileId, STATS_JSTATE_PENDING);
+    String temp = statsTempPath(fileId);
+    File file = userFS().open(temp.c_str(), "w");
+    if (file) {
+        file.print(payload);
+        file.close();
+        userFS().rename(temp.c_str(), statsJournalPaths[fileId]);
+    }
+    statsJournalWrite(STATS_JOP_REPLACE, fileId, STATS_JSTATE_COMMITTED);
+}
+
+/**
+ * Hand a serialized JSON payload to the FS worker for a background write.
+ * Serialization (CPU) happens on the caller; only the flash write is
+ * deferred. Background jobs run in post order, so successive saves of the
+ * same file can't land out of order. If the worker queue is full, write
+ * inline rather than dropping the save.
+ */
+static void writeFileDeferred(uint8_t fileId, String&& json) {
+    String payload = std::move(json);
+    bool posted = FsWorker::post(FsWorker::PRIO_BACKGROUND, [fileId, payload]() {
+        writeFileJournaled(fileId, payload);
+    });
+    if (!posted) {
+        writeFileJournaled(fileId, payload);
+    }
+}
+
 void StatisticsManager::saveToFlash() {
     // Yield before starting expensive file operations
     yield();
-    
+
     // Save lifetime stats
     {
         JsonDocument doc;
         JsonObject lifetimeObj = doc["lifetime"].to<JsonObject>();
         _lifetime.toJson(lifetimeObj);
-        
+
         JsonObject maintObj = doc["maintenance"].to<JsonObject>();
         _maintenance.toJson(maintObj);
-        
-        yield(); // Yield before file write
-        
-        File file = LittleFS.open(STATS_FILE, "w");
-        if (file) {
-            serializeJson(doc, file);
-            file.close();
-        }
-        yield(); // Yield after file write
-    }
-    
-    // Save brew history
-    {
-        JsonDocument doc;
-        JsonArray arr = doc.to<JsonArray>();
-        
-        // Yield periodically during large array building
-        for (size_t i = 0; i < _brewHistoryCount; i++) {
-            if (i > 0 && (i % 50 == 0)) {
-                yield(); // Yield every 50 items to prevent blocking
-            }
-            int idx = (_brewHistoryHead - _brewHistoryCount + i + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
-            JsonObject obj = arr.add<JsonObject>();
-            _brewHistory[idx].toJson(obj);
-        }
-        
-        yield(); // Yield before file write
-        
-        File file = LittleFS.open(BREW_HISTORY_FILE, "w");
-        if (file) {
-            serializeJson(doc, file);
-            file.close();
-        }
-        yield(); // Yield after file write
+
+        String json;
+        serializeJson(doc, json);
+        writeFileDeferred(STATS_JFILE_STATS, std::move(json));
+        yield();
     }
     
-    // Save power history
+    // Brew history is NOT rewritten here - records go to the binary ring
+    // file as they happen (see appendBrewRecordToFlash())
+
+    // Save power history (all pyramid levels; open hour/day buckets are not
+    // persisted - at most one partial hour of aggregation is re-folded after
+    // a reboot)
     {
         JsonDocument doc;
-        JsonArray arr = doc.to<JsonArray>();
-        
+        JsonArray rawArr = doc["raw"].to<JsonArray>();
+
         // Yield periodically during large array building
         for (size_t i = 0; i < _powerSamplesCount; i++) {
             if (i > 0 && (i % 100 == 0)) {
                 yield(); // Yield every 100 items to prevent blocking
             }
             int idx = (_powerSamplesHead - _powerSamplesCount + i + STATS_MAX_POWER_SAMPLES) % STATS_MAX_POWER_SAMPLES;
-            JsonObject obj = arr.add<JsonObject>();
+            JsonObject obj = rawArr.add<JsonObject>();
             _powerSamples[idx].toJson(obj);
         }
-        
-        yield(); // Yield before file write
-        
-        File file = LittleFS.open(POWER_HISTORY_FILE, "w");
-        if (file) {
-            serializeJson(doc, file);
-            file.close();
+
+        JsonArray hourlyArr = doc["hourly"].to<JsonArray>();
+        for (size_t i = 0; i < _hourlySamplesCount; i++) {
+            if (i > 0 && (i % 100 == 0)) {
+                yield();
+            }
+            int idx = (_hourlySamplesHead - _hourlySamplesCount + i + STATS_MAX_HOURLY_SAMPLES) % STATS_MAX_HOURLY_SAMPLES;
+            JsonObject obj = hourlyArr.add<JsonObject>();
+            _hourlySamples[idx].toJson(obj);
+        }
+
+        JsonArray dailyArr = doc["daily"].to<JsonArray>();
+        for (size_t i = 0; i < _dailySamplesCount; i++) {
+            int idx = (_dailySamplesHead - _dailySamplesCount + i + STATS_MAX_DAILY_SAMPLES) % STATS_MAX_DAILY_SAMPLES;
+            JsonObject obj = dailyArr.add<JsonObject>();
+            _dailySamples[idx].toJson(obj);
         }
-        yield(); // Yield after file write
+
+        yield(); // Yield before serializing the largest document
+
+        String json;
+        serializeJson(doc, json);
+        writeFileDeferred(STATS_JFILE_POWER, std::move(json));
+        yield();
     }
     
     // Save daily summaries
@@ -752,20 +1398,19 @@ void StatisticsManager::saveToFlash() {
             _dailySummaries[idx].toJson(obj);
         }
         
-        yield(); // Yield before file write
-        
-        File file = LittleFS.open(DAILY_HISTORY_FILE, "w");
-        if (file) {
-            serializeJson(doc, file);
-            file.close();
-        }
-        yield(); // Yield after file write
+        String json;
+        serializeJson(doc, json);
+        writeFileDeferred(STATS_JFILE_DAILY, std::move(json));
+        yield();
     }
-    
-    Serial.println("[Stats] Saved to flash");
+
+    Serial.println("[Stats] Save queued to FS worker");
 }
 
 void StatisticsManager::save() {
+    // Never persist unhydrated rings - writing empty history files over the
+    // real ones would lose everything the lazy load hadn't read yet
+    ensureHydrated();
     saveToFlash();
     _dirty = false;
     _lastSaveTime = millis();
@@ -774,20 +1419,39 @@ void StatisticsManager::save() {
 void StatisticsManager::resetAll() {
     _lifetime = LifetimeStats();
     _maintenance = MaintenanceStats();
+    _fragLifetimeDirty = true;
+    _fragMaintenanceDirty = true;
     _brewHistoryCount = 0;
     _brewHistoryHead = 0;
     _powerSamplesCount = 0;
     _powerSamplesHead = 0;
+    _hourlySamplesCount = 0;
+    _hourlySamplesHead = 0;
+    _dailySamplesCount = 0;
+    _dailySamplesHead = 0;
+    _hourBucket = PowerBucket();
+    _dayBucket = PowerBucket();
     _dailySummariesCount = 0;
     _dailySummariesHead = 0;
+    _todayStats = PeriodStats();
     _sessionShots = 0;
     
     // Delete files
-    LittleFS.remove(STATS_FILE);
-    LittleFS.remove(BREW_HISTORY_FILE);
-    LittleFS.remove(POWER_HISTORY_FILE);
-    LittleFS.remove(DAILY_HISTORY_FILE);
-    
+    userFS().remove(STATS_FILE);
+    userFS().remove(BREW_HISTORY_FILE);
+    userFS().remove(BREW_HISTORY_BIN_FILE);
+    userFS().remove(POWER_HISTORY_FILE);
+    userFS().remove(DAILY_HISTORY_FILE);
+    userFS().remove(DAILY_ARCHIVE_FILE);
+    userFS().remove(STATS_JOURNAL_FILE);
+    for (uint8_t i = 0; i < STATS_JFILE_COUNT; i++) {
+        userFS().remove(statsTempPath(i).c_str());  // Stray save temps
+    }
+    _brewFileRecords = 0;
+
+    // The (now deleted) files have nothing left to hydrate
+    _hydrated = true;
+
     Serial.println("[Stats] All statistics reset");
     notifyChange();
 }
@@ -808,6 +1472,7 @@ void StatisticsManager::endSession() {
     if (_machineIsOn) {
         uint32_t onDurationMinutes = (millis() - _machineOnStartTime) / 60000;
         _lifetime.totalOnTimeMinutes += onDurationMinutes;
+        _fragLifetimeDirty = true;
         _machineIsOn = false;
     }
     
@@ -817,8 +1482,8 @@ void StatisticsManager::endSession() {
         sample.timestamp = time(nullptr);
         sample.avgWatts = _powerSampleSum / _powerSampleCount;
         sample.maxWatts = _powerSampleMax;
-        float hoursElapsed = (float)(millis() - _lastPowerSampleTime) / 3600000.0f;
-        sample.kwhConsumed = (sample.avgWatts / 1000.0f) * hoursElapsed;
+        sample.kwhConsumed = (_powerSampleSum / 1000.0f) *
+                             ((float)STATS_POWER_TICK_MS / 3600000.0f);
         addPowerSample(sample);
     }
     
@@ -830,23 +1495,83 @@ void StatisticsManager::endSession() {
 // =============================================================================
 
 void StatisticsManager::addBrewRecord(const BrewRecord& record) {
+    if (!_brewHistory) return;  // PSRAM allocation failed in begin()
     _brewHistory[_brewHistoryHead] = record;
     _brewHistoryHead = (_brewHistoryHead + 1) % STATS_MAX_BREW_HISTORY;
     if (_brewHistoryCount < STATS_MAX_BREW_HISTORY) {
         _brewHistoryCount++;
     }
-    // Invalidate stats cache when new brew is recorded
-    _statsCacheInvalid = true;
+    // Persist immediately - one small append, not a history rewrite
+    appendBrewRecordToFlash(record);
 }
 
 void StatisticsManager::addPowerSample(const PowerSample& sample) {
+    ensureHydrated();  // See recordBrew() - don't append to rings pre-hydration
     _powerSamples[_powerSamplesHead] = sample;
     _powerSamplesHead = (_powerSamplesHead + 1) % STATS_MAX_POWER_SAMPLES;
     if (_powerSamplesCount < STATS_MAX_POWER_SAMPLES) {
         _powerSamplesCount++;
     }
-    // Invalidate stats cache when new power sample is added
-    _statsCacheInvalid = true;
+    foldIntoPowerPyramid(sample);
+    _todayStats.totalKwh += sample.kwhConsumed;
+}
+
+// Fold a closed raw sample into the hourly and daily pyramid levels. Each
+// level accumulates into an open bucket and pushes the aggregate into its
+// ring when a sample crosses the bucket boundary - O(1) per sample, so
+// month-long charts never iterate the raw ring.
+void StatisticsManager::foldIntoPowerPyramid(const PowerSample& sample) {
+    if (sample.timestamp == 0) {
+        return;  // No NTP time yet - can't bucket by wall clock
+    }
+
+    // Hourly level
+    uint32_t hourStart = sample.timestamp - (sample.timestamp % 3600);
+    if (_hourBucket.start != 0 && hourStart != _hourBucket.start && _hourBucket.samples > 0) {
+        PowerSample hourly;
+        hourly.timestamp = _hourBucket.start;
+        hourly.avgWatts = _hourBucket.wattSum / _hourBucket.samples;
+        hourly.maxWatts = _hourBucket.maxWatts;
+        hourly.kwhConsumed = _hourBucket.kwh;
+        _hourlySamples[_hourlySamplesHead] = hourly;
+        _hourlySamplesHead = (_hourlySamplesHead + 1) % STATS_MAX_HOURLY_SAMPLES;
+        if (_hourlySamplesCount < STATS_MAX_HOURLY_SAMPLES) {
+            _hourlySamplesCount++;
+        }
+        _hourBucket = PowerBucket();
+    }
+    if (_hourBucket.start != hourStart) {
+        _hourBucket = PowerBucket();
+        _hourBucket.start = hourStart;
+    }
+    _hourBucket.wattSum += sample.avgWatts;
+    if (sample.maxWatts > _hourBucket.maxWatts) _hourBucket.maxWatts = sample.maxWatts;
+    _hourBucket.kwh += sample.kwhConsumed;
+    _hourBucket.samples++;
+
+    // Daily level - same fold with 24h buckets
+    uint32_t dayStart = sample.timestamp - (sample.timestamp % 86400);
+    if (_dayBucket.start != 0 && dayStart != _dayBucket.start && _dayBucket.samples > 0) {
+        PowerSample daily;
+        daily.timestamp = _dayBucket.start;
+        daily.avgWatts = _dayBucket.wattSum / _dayBucket.samples;
+        daily.maxWatts = _dayBucket.maxWatts;
+        daily.kwhConsumed = _dayBucket.kwh;
+        _dailySamples[_dailySamplesHead] = daily;
+        _dailySamplesHead = (_dailySamplesHead + 1) % STATS_MAX_DAILY_SAMPLES;
+        if (_dailySamplesCount < STATS_MAX_DAILY_SAMPLES) {
+            _dailySamplesCount++;
+        }
+        _dayBucket = PowerBucket();
+    }
+    if (_dayBucket.start != dayStart) {
+        _dayBucket = PowerBucket();
+        _dayBucket.start = dayStart;
+    }
+    _dayBucket.wattSum += sample.avgWatts;
+    if (sample.maxWatts > _dayBucket.maxWatts) _dayBucket.maxWatts = sample.maxWatts;
+    _dayBucket.kwh += sample.kwhConsumed;
+    _dayBucket.samples++;
 }
 
 void StatisticsManager::addDailySummary(const DailySummary& summary) {
@@ -870,48 +1595,182 @@ void StatisticsManager::checkDayChange() {
     uint32_t todayMidnight = getTodayMidnight();
     
     if (todayMidnight > _todayStartTimestamp && _todayStartTimestamp > 0) {
-        // Day has changed - save yesterday's summary
+        // Day has changed - fold today's accumulator into the daily ring
+        // and start a fresh one
         saveDailySummary();
         _todayStartTimestamp = todayMidnight;
-        // Invalidate stats cache when day changes
-        _statsCacheInvalid = true;
+        _todayStats = PeriodStats();
     }
 }
 
 void StatisticsManager::saveDailySummary() {
-    // Calculate yesterday's stats from brew history
-    uint32_t yesterdayStart = _todayStartTimestamp;
-    uint32_t yesterdayEnd = yesterdayStart + 86400;
-    
+    // The day's numbers were accumulated as shots/samples came in - just
+    // copy the accumulator into the ring, no history scan needed
     DailySummary summary;
-    summary.date = yesterdayStart;
-    
-    for (size_t i = 0; i < _brewHistoryCount; i++) {
-        int idx = (_brewHistoryHead - 1 - i + STATS_MAX_BREW_HISTORY) % STATS_MAX_BREW_HISTORY;
-        const BrewRecord& record = _brewHistory[idx];
-        
-        if (record.timestamp >= yesterdayStart && record.timestamp < yesterdayEnd) {
-            summary.shotCount++;
-            summary.totalBrewTimeMs += record.durationMs;
+    summary.date = _todayStartTimestamp;
+    summary.shotCount = _todayStats.shotCount;
+    summary.totalBrewTimeMs = _todayStats.totalBrewTimeMs;
+    summary.avgBrewTimeMs = _todayStats.avgBrewTimeMs;
+    summary.totalKwh = _todayStats.totalKwh;
+    summary.minBrewTimeMs = _todayStats.minBrewTimeMs;
+    summary.maxBrewTimeMs = _todayStats.maxBrewTimeMs;
+
+    addDailySummary(summary);
+
+    // Also append to the packed multi-year archive - the RAM ring only
+    // keeps 30 days
+    appendDailyArchive(summary);
+
+    _dirty = true;
+    _generation++;
+}
+
+// Map a local-midnight date to its archive record index. Midnights are
+// 86400s apart except across DST shifts, so round instead of truncating.
+static uint32_t archiveIndexFor(uint32_t date, uint32_t epochDate) {
+    return (date - epochDate + 43200) / 86400;
+}
+
+bool StatisticsManager::appendDailyArchive(const DailySummary& summary) {
+    if (summary.date == 0) {
+        return false;  // No NTP sync that day - no stable index to file under
+    }
+
+    DailyArchiveHeader header;
+    File file;
+    if (userFS().exists(DAILY_ARCHIVE_FILE)) {
+        file = userFS().open(DAILY_ARCHIVE_FILE, "r+");
+        if (!file) {
+            return false;
+        }
+        if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+            header.magic != STATS_DAILY_ARCHIVE_MAGIC ||
+            header.version != STATS_DAILY_ARCHIVE_VERSION ||
+            header.recordSize != sizeof(DailyArchiveRecord)) {
+            // Unknown layout - leave years of accumulated data untouched
+            // rather than risk corrupting it
+            Serial.println("[Stats] Daily archive header mismatch - skipping append");
+            file.close();
+            return false;
+        }
+    } else {
+        file = userFS().open(DAILY_ARCHIVE_FILE, "w+");
+        if (!file) {
+            return false;
+        }
+        header.magic = STATS_DAILY_ARCHIVE_MAGIC;
+        header.version = STATS_DAILY_ARCHIVE_VERSION;
+        header.recordSize = sizeof(DailyArchiveRecord);
+        header.epochDate = summary.date;
+        if (file.write((const uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+            file.close();
+            return false;
         }
     }
-    
-    if (summary.shotCount > 0) {
-        summary.avgBrewTimeMs = (float)summary.totalBrewTimeMs / summary.shotCount;
+
+    if (summary.date + 43200 < header.epochDate) {
+        file.close();
+        return false;  // Before the archive epoch - clock went backwards
     }
-    
-    // Get kWh from power samples
-    for (size_t i = 0; i < _powerSamplesCount; i++) {
-        int idx = (_powerSamplesHead - 1 - i + STATS_MAX_POWER_SAMPLES) % STATS_MAX_POWER_SAMPLES;
-        const PowerSample& sample = _powerSamples[idx];
-        
-        if (sample.timestamp >= yesterdayStart && sample.timestamp < yesterdayEnd) {
-            summary.totalKwh += sample.kwhConsumed;
+
+    uint32_t index = archiveIndexFor(summary.date, header.epochDate);
+    uint32_t count = (file.size() - sizeof(header)) / sizeof(DailyArchiveRecord);
+    if (index > count + DAILY_ARCHIVE_MAX_GAP_DAYS) {
+        Serial.printf("[Stats] Daily archive gap too large (%lu days) - skipping append\n",
+                      (unsigned long)(index - count));
+        file.close();
+        return false;
+    }
+
+    // Zero-fill any days the machine sat unplugged so index == f(date) holds
+    if (index > count) {
+        file.seek(sizeof(header) + (size_t)count * sizeof(DailyArchiveRecord));
+        for (uint32_t i = count; i < index; i++) {
+            DailyArchiveRecord gap;
+            gap.date = header.epochDate + i * 86400;  // Nominal midnight (DST drift is fine for gaps)
+            if (file.write((const uint8_t*)&gap, sizeof(gap)) != sizeof(gap)) {
+                file.close();
+                return false;
+            }
         }
     }
-    
-    addDailySummary(summary);
-    _dirty = true;
+
+    DailyArchiveRecord record;
+    record.date = summary.date;
+    record.shotCount = summary.shotCount;
+    record.onTimeMinutes = summary.onTimeMinutes;
+    record.totalBrewTimeMs = summary.totalBrewTimeMs;
+    record.totalKwh = summary.totalKwh;
+    record.avgBrewTimeMs = summary.avgBrewTimeMs;
+    record.minBrewTimeMs = summary.minBrewTimeMs;
+    record.maxBrewTimeMs = summary.maxBrewTimeMs;
+    record.steamCycles = summary.steamCycles;
+    record.hasData = 1;
+
+    // index < count overwrites in place (same day folded twice, e.g. after
+    // a mid-day reboot); index == count is the normal append
+    file.seek(sizeof(header) + (size_t)index * sizeof(DailyArchiveRecord));
+    bool ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    file.close();
+    return ok;
+}
+
+size_t StatisticsManager::getDailyArchiveRange(uint32_t startDate, uint32_t endDate,
+                                               JsonArray& arr) const {
+    File file = userFS().open(DAILY_ARCHIVE_FILE, "r");
+    if (!file) {
+        return 0;
+    }
+
+    DailyArchiveHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != STATS_DAILY_ARCHIVE_MAGIC ||
+        header.version != STATS_DAILY_ARCHIVE_VERSION ||
+        header.recordSize != sizeof(DailyArchiveRecord)) {
+        file.close();
+        return 0;
+    }
+
+    uint32_t count = (file.size() - sizeof(header)) / sizeof(DailyArchiveRecord);
+    if (count == 0 || endDate + 43200 < header.epochDate) {
+        file.close();
+        return 0;
+    }
+
+    uint32_t first = (startDate <= header.epochDate)
+                         ? 0
+                         : archiveIndexFor(startDate, header.epochDate);
+    uint32_t last = archiveIndexFor(endDate, header.epochDate);
+    if (last >= count) last = count - 1;
+    if (first > last) {
+        file.close();
+        return 0;
+    }
+
+    file.seek(sizeof(header) + (size_t)first * sizeof(DailyArchiveRecord));
+    size_t added = 0;
+    for (uint32_t i = first; i <= last; i++) {
+        DailyArchiveRecord record;
+        if (file.read((uint8_t*)&record, sizeof(record)) != sizeof(record)) {
+            break;
+        }
+        if (!record.hasData) {
+            continue;  // Gap day - clients want trends, not zero rows
+        }
+        JsonObject obj = arr.add<JsonObject>();
+        obj["date"] = record.date;
+        obj["shotCount"] = record.shotCount;
+        obj["totalBrewTimeMs"] = record.totalBrewTimeMs;
+        obj["totalKwh"] = record.totalKwh;
+        obj["onTimeMinutes"] = record.onTimeMinutes;
+        obj["steamCycles"] = record.steamCycles;
+        obj["avgBrewTimeMs"] = record.avgBrewTimeMs;
+        obj["minBrewTimeMs"] = record.minBrewTimeMs;
+        obj["maxBrewTimeMs"] = record.maxBrewTimeMs;
+        added++;
+    }
+    file.close();
+    return added;
 }
 
 void StatisticsManager::onStatsChanged(StatsCallback callback) {
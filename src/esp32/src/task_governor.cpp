@@ -0,0 +1,132 @@
+/**
+ * BrewOS Task Priority Governor Implementation
+ *
+ * See task_governor.h for the model. The table is touched from multiple
+ * tasks (owners manage/unmanage from their own context, the main loop
+ * drives elevation), so a mutex guards it - everything here runs in task
+ * context, never from ISRs.
+ */
+
+#include "task_governor.h"
+#include "runtime_state.h"
+#include "config.h"
+#include <Arduino.h>
+#include <freertos/semphr.h>
+
+typedef struct {
+    TaskHandle_t task;
+    governor_role_t role;
+    UBaseType_t normalPriority;
+} governed_task_t;
+
+static governed_task_t s_tasks[GOVERNOR_MAX_TASKS];
+static uint8_t s_taskCount = 0;
+static bool s_elevated = false;
+static uint32_t s_elevations = 0;
+static uint32_t s_brewEndMs = 0;
+static SemaphoreHandle_t s_mutex = nullptr;
+
+static UBaseType_t brewPriority(governor_role_t role) {
+    return (role == GOV_CRITICAL) ? GOVERNOR_CRITICAL_BREW_PRIORITY
+                                  : GOVERNOR_BACKGROUND_BREW_PRIORITY;
+}
+
+// Caller holds s_mutex
+static void applyElevation(bool elevate) {
+    for (uint8_t i = 0; i < s_taskCount; i++) {
+        UBaseType_t prio = elevate ? brewPriority(s_tasks[i].role)
+                                   : s_tasks[i].normalPriority;
+        if (prio != uxTaskPriorityGet(s_tasks[i].task)) {
+            vTaskPrioritySet(s_tasks[i].task, prio);
+        }
+    }
+}
+
+void TaskGovernor::begin() {
+    s_mutex = xSemaphoreCreateMutex();
+
+    // The Arduino loop task runs scale draining, brew-by-weight and the
+    // Pico UART - the whole stop chain lives here
+    manage(xTaskGetCurrentTaskHandle(), GOV_CRITICAL);
+}
+
+void TaskGovernor::manage(TaskHandle_t task, governor_role_t role) {
+    if (task == nullptr || s_mutex == nullptr) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_taskCount >= GOVERNOR_MAX_TASKS) {
+        xSemaphoreGive(s_mutex);
+        LOG_W("TaskGovernor: table full, task not governed");
+        return;
+    }
+    governed_task_t& entry = s_tasks[s_taskCount++];
+    entry.task = task;
+    entry.role = role;
+    entry.normalPriority = uxTaskPriorityGet(task);
+    if (s_elevated) {
+        vTaskPrioritySet(task, brewPriority(role));
+    }
+    xSemaphoreGive(s_mutex);
+}
+
+void TaskGovernor::unmanage(TaskHandle_t task) {
+    if (s_mutex == nullptr) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    for (uint8_t i = 0; i < s_taskCount; i++) {
+        if (s_tasks[i].task != task) continue;
+        if (s_elevated) {
+            vTaskPrioritySet(task, s_tasks[i].normalPriority);
+        }
+        s_tasks[i] = s_tasks[--s_taskCount];
+        break;
+    }
+    xSemaphoreGive(s_mutex);
+}
+
+void TaskGovernor::loop() {
+    if (s_mutex == nullptr) return;
+
+    bool brewing = runtimeState().get().is_brewing;
+    uint32_t now = millis();
+
+    if (brewing) {
+        s_brewEndMs = 0;
+        if (!s_elevated) {
+            xSemaphoreTake(s_mutex, portMAX_DELAY);
+            s_elevated = true;
+            s_elevations++;
+            applyElevation(true);
+            xSemaphoreGive(s_mutex);
+            LOG_D("TaskGovernor: elevated for shot");
+        }
+        return;
+    }
+
+    if (s_elevated) {
+        // Hold the elevation past brew end so the stop chain latency
+        // measurement and the drip settle window stay protected
+        if (s_brewEndMs == 0) {
+            s_brewEndMs = now;
+        } else if (now - s_brewEndMs >= GOVERNOR_HOLD_MS) {
+            xSemaphoreTake(s_mutex, portMAX_DELAY);
+            s_elevated = false;
+            applyElevation(false);
+            xSemaphoreGive(s_mutex);
+            s_brewEndMs = 0;
+            LOG_D("TaskGovernor: restored after shot");
+        }
+    }
+}
+
+TaskGovernor::Stats TaskGovernor::getStats() {
+    Stats stats = {};
+    if (s_mutex == nullptr) return stats;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    stats.elevated = s_elevated;
+    stats.managed = s_taskCount;
+    stats.elevations = s_elevations;
+    xSemaphoreGive(s_mutex);
+    return stats;
+}
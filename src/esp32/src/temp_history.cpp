@@ -0,0 +1,75 @@
+/**
+ * BrewOS Temperature History Ring Implementation
+ *
+ * See temp_history.h. The ring lives in static RAM (2.4KB) and is only
+ * touched from the main loop task - sampling in loop(), serialization from
+ * the bootstrap handler, which runs on the async TCP task but only ever
+ * reads; a sample landing mid-serialize can at worst duplicate or drop the
+ * newest point of a 10-minute chart, which isn't worth a lock.
+ */
+
+#include "temp_history.h"
+#include "runtime_state.h"
+#include <Arduino.h>
+#include <math.h>
+
+static int16_t s_brew[TEMP_HISTORY_SAMPLES];
+static int16_t s_steam[TEMP_HISTORY_SAMPLES];
+static uint16_t s_head = 0;    // Next write slot
+static uint16_t s_count = 0;
+static uint32_t s_lastSample = 0;
+
+static int16_t toCentideg(float celsius) {
+    if (celsius > 327.0f) celsius = 327.0f;
+    if (celsius < -327.0f) celsius = -327.0f;
+    return (int16_t)lroundf(celsius * 100.0f);
+}
+
+void TempHistory::loop() {
+    uint32_t now = millis();
+    if (now - s_lastSample < TEMP_HISTORY_INTERVAL_MS) return;
+    s_lastSample = now;
+
+    const ui_state_t& state = runtimeState().get();
+    s_brew[s_head] = toCentideg(state.brew_temp);
+    s_steam[s_head] = toCentideg(state.steam_temp);
+    s_head = (s_head + 1) % TEMP_HISTORY_SAMPLES;
+    if (s_count < TEMP_HISTORY_SAMPLES) {
+        s_count++;
+    }
+}
+
+// One channel, oldest to newest: absolute first sample, then deltas
+static void appendChannel(String& out, const int16_t* ring) {
+    out += '[';
+    int16_t prev = 0;
+    for (uint16_t i = 0; i < s_count; i++) {
+        uint16_t idx = (uint16_t)((s_head + TEMP_HISTORY_SAMPLES - s_count + i) % TEMP_HISTORY_SAMPLES);
+        int16_t v = ring[idx];
+        if (i == 0) {
+            out += (int)v;
+        } else {
+            out += ',';
+            out += (int)(v - prev);
+        }
+        prev = v;
+    }
+    out += ']';
+}
+
+void TempHistory::appendJson(String& out) {
+    out += "{\"intervalMs\":";
+    out += TEMP_HISTORY_INTERVAL_MS;
+    out += ",\"unit\":\"centideg\",\"count\":";
+    out += (int)s_count;
+    out += ",\"brew\":";
+    appendChannel(out, s_brew);
+    out += ",\"steam\":";
+    appendChannel(out, s_steam);
+    out += '}';
+}
+
+size_t TempHistory::jsonSizeEstimate() {
+    // Worst case ~8 chars per delta sample ("-NNNNN,") across both channels
+    return (size_t)s_count * 8 * 2 + 80;
+}
@@ -0,0 +1,151 @@
+#include "time_keeper.h"
+#include <Preferences.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+// Logging macros (match project convention)
+#define LOG_I(fmt, ...) Serial.printf("[Time] " fmt "\n", ##__VA_ARGS__)
+#define LOG_W(fmt, ...) Serial.printf("[Time] WARN: " fmt "\n", ##__VA_ARGS__)
+
+// Anything before this is an unset clock (same threshold WiFiManager uses)
+static const time_t VALID_EPOCH = 1577836800;  // Jan 1, 2020
+
+static const unsigned long CHECKPOINT_INTERVAL_MS = 5 * 60 * 1000;
+// Start drift slews only after SNTP has been quiet this long - while syncs
+// arrive on schedule they correct the clock themselves
+static const int64_t DRIFT_SLEW_AFTER_US = 2LL * 60 * 60 * 1000000;
+// Crystals are tens of ppm off; a measurement outside this is a time step
+// or a bad baseline, not drift
+static const int32_t DRIFT_SANE_PPM = 500;
+// Minimum baseline between syncs for a drift sample (short gaps measure
+// mostly network jitter)
+static const int64_t DRIFT_MIN_BASELINE_US = 10LL * 60 * 1000000;
+
+static bool s_provisional = false;
+static bool s_synced = false;
+static int32_t s_driftPpm = 0;
+static unsigned long s_lastCheckpoint = 0;
+static unsigned long s_lastSlew = 0;
+static volatile bool s_syncArrived = false;  // Set by the SNTP callback, consumed in loop()
+
+// Drift measurement anchors: NTP epoch and local microsecond clock at the
+// previous sync. The local clock runs on the same crystal as system time,
+// so (local elapsed - NTP elapsed) over the baseline is the crystal error.
+static time_t s_lastSyncEpoch = 0;
+static int64_t s_lastSyncUs = 0;
+
+static void checkpoint(time_t epoch) {
+    Preferences prefs;
+    if (!prefs.begin("clock", false)) {
+        return;
+    }
+    prefs.putULong("epoch", (uint32_t)epoch);
+    prefs.putInt("drift", s_driftPpm);
+    prefs.end();
+}
+
+// Runs on the SNTP task after the time step - keep it short, no NVS I/O
+// here (loop() writes the checkpoint when it sees s_syncArrived)
+static void onSntpSync(struct timeval* tv) {
+    int64_t nowUs = esp_timer_get_time();
+    time_t ntpNow = tv->tv_sec;
+
+    if (s_lastSyncEpoch != 0) {
+        int64_t ntpElapsedUs = (int64_t)(ntpNow - s_lastSyncEpoch) * 1000000;
+        if (ntpElapsedUs >= DRIFT_MIN_BASELINE_US) {
+            int64_t localElapsedUs = nowUs - s_lastSyncUs;
+            int32_t ppm = (int32_t)(((localElapsedUs - ntpElapsedUs) * 1000000) / ntpElapsedUs);
+            if (ppm > -DRIFT_SANE_PPM && ppm < DRIFT_SANE_PPM) {
+                s_driftPpm = (s_driftPpm == 0) ? ppm : (s_driftPpm * 3 + ppm) / 4;
+            }
+        }
+    }
+
+    s_lastSyncEpoch = ntpNow;
+    s_lastSyncUs = nowUs;
+    s_synced = true;
+    s_provisional = false;
+    s_syncArrived = true;
+}
+
+void TimeKeeper::begin() {
+    sntp_set_time_sync_notification_cb(onSntpSync);
+
+    time_t now = time(nullptr);
+    if (now >= VALID_EPOCH) {
+        // Warm reset: the RTC domain kept ticking through the reboot, which
+        // is more accurate than any checkpoint - keep it
+        s_provisional = true;
+        LOG_I("Clock survived reset (warm boot) - provisional until SNTP");
+        return;
+    }
+
+    // Cold boot: restore the last checkpoint so time is plausible and
+    // monotonic from here on (stale by the powered-off duration at worst)
+    Preferences prefs;
+    if (!prefs.begin("clock", true)) {
+        return;  // First boot - no checkpoint namespace yet
+    }
+    uint32_t saved = prefs.getULong("epoch", 0);
+    s_driftPpm = prefs.getInt("drift", 0);
+    prefs.end();
+
+    if (saved >= (uint32_t)VALID_EPOCH) {
+        struct timeval tv = { (time_t)saved, 0 };
+        settimeofday(&tv, nullptr);
+        s_provisional = true;
+        LOG_I("Restored clock checkpoint (%lu) - provisional until SNTP, drift %+ld ppm",
+              (unsigned long)saved, (long)s_driftPpm);
+    }
+}
+
+void TimeKeeper::loop() {
+    unsigned long now = millis();
+    time_t epoch = time(nullptr);
+    if (epoch < VALID_EPOCH) {
+        return;  // No clock at all yet - nothing worth checkpointing
+    }
+
+    if (s_syncArrived) {
+        s_syncArrived = false;
+        s_lastCheckpoint = now;
+        checkpoint(time(nullptr));
+        LOG_I("SNTP sync - clock authoritative, drift %+ld ppm", (long)s_driftPpm);
+    }
+
+    if (now - s_lastCheckpoint >= CHECKPOINT_INTERVAL_MS) {
+        s_lastCheckpoint = now;
+        checkpoint(epoch);
+    }
+
+    // SNTP quiet for hours: counter the learned crystal drift with a gentle
+    // slew per checkpoint interval so the clock doesn't wander unbounded
+    if (s_driftPpm != 0 && s_synced &&
+        (esp_timer_get_time() - s_lastSyncUs) > DRIFT_SLEW_AFTER_US &&
+        (now - s_lastSlew) >= CHECKPOINT_INTERVAL_MS) {
+        s_lastSlew = now;
+        // drift ppm over S seconds = drift*S microseconds of error
+        int64_t errorUs = -(int64_t)s_driftPpm * (CHECKPOINT_INTERVAL_MS / 1000);
+        time_t sec = (time_t)(errorUs / 1000000);
+        long usec = (long)(errorUs % 1000000);
+        if (usec < 0) {
+            sec -= 1;
+            usec += 1000000;
+        }
+        struct timeval delta = { sec, (suseconds_t)usec };
+        adjtime(&delta, nullptr);
+    }
+}
+
+bool TimeKeeper::isTrusted() {
+    return s_synced || s_provisional;
+}
+
+bool TimeKeeper::isProvisional() {
+    return s_provisional;
+}
+
+int32_t TimeKeeper::driftPpm() {
+    return s_driftPpm;
+}
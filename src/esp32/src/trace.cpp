@@ -0,0 +1,128 @@
+/**
+ * Hot-Path Tracepoints (ESP32 side)
+ *
+ * Implementation of the rings declared in trace.h. Compiled into the image
+ * only when built with -DTRACEPOINTS=1.
+ */
+
+#include "trace.h"
+
+#if TRACEPOINTS
+
+#include <Arduino.h>
+#include <esp_cpu.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+
+// =============================================================================
+// Rings
+// =============================================================================
+// Unlike the Pico's drop-newest rings (which have a consumer draining them
+// continuously), these rings only ever feed the on-demand /api/trace dump,
+// so they overwrite the oldest record and always hold the most recent window.
+// Instrumented sites run from different tasks that can share a core, so a
+// short critical section guards the head/count update.
+
+typedef struct {
+    trace_record_t records[TRACE_RING_RECORDS];
+    size_t head;    // Next slot to write
+    size_t count;   // Valid records (caps at TRACE_RING_RECORDS)
+} trace_ring_t;
+
+static trace_ring_t s_rings[TRACE_RING_COUNT];
+static portMUX_TYPE s_traceMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_paused = false;
+static uint32_t s_picoCpuHz = 0;  // clk_sys from the last MSG_TRACE batch
+
+static void ringPush(trace_ring_t* ring, const trace_record_t* rec) {
+    ring->records[ring->head] = *rec;
+    ring->head = (ring->head + 1) % TRACE_RING_RECORDS;
+    if (ring->count < TRACE_RING_RECORDS) {
+        ring->count++;
+    }
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void trace_record_event(uint16_t id, uint8_t phase) {
+    if (s_paused) {
+        return;
+    }
+
+    trace_record_t rec;
+    rec.cycles = esp_cpu_get_cycle_count();
+    rec.id = id;
+    rec.core = (uint8_t)xPortGetCoreID();
+    rec.phase = phase;
+
+    portENTER_CRITICAL(&s_traceMux);
+    ringPush(&s_rings[rec.core], &rec);
+    portEXIT_CRITICAL(&s_traceMux);
+}
+
+void trace_ingest_pico(const uint8_t* payload, size_t length) {
+    if (s_paused || !payload || length < 5) {
+        return;
+    }
+
+    uint32_t cpuHz = (uint32_t)payload[0] | ((uint32_t)payload[1] << 8) |
+                     ((uint32_t)payload[2] << 16) | ((uint32_t)payload[3] << 24);
+    uint8_t count = payload[4];
+    if (count == 0 || count > TRACE_BATCH_MAX_RECORDS ||
+        length < 5 + (size_t)count * sizeof(trace_record_t)) {
+        return;
+    }
+    s_picoCpuHz = cpuHz;
+
+    portENTER_CRITICAL(&s_traceMux);
+    for (uint8_t i = 0; i < count; i++) {
+        trace_record_t rec;
+        memcpy(&rec, payload + 5 + (size_t)i * sizeof(trace_record_t), sizeof(rec));
+        ringPush(&s_rings[TRACE_RING_PICO], &rec);
+    }
+    portEXIT_CRITICAL(&s_traceMux);
+}
+
+// =============================================================================
+// Dump Accessors
+// =============================================================================
+
+void trace_pause(void) {
+    s_paused = true;
+}
+
+void trace_resume(void) {
+    s_paused = false;
+}
+
+size_t trace_ring_count(uint8_t ring) {
+    if (ring >= TRACE_RING_COUNT) {
+        return 0;
+    }
+    return s_rings[ring].count;
+}
+
+bool trace_ring_get(uint8_t ring, size_t index, trace_record_t* out) {
+    if (ring >= TRACE_RING_COUNT || !out) {
+        return false;
+    }
+    const trace_ring_t* r = &s_rings[ring];
+    if (index >= r->count) {
+        return false;
+    }
+    // Oldest record sits at head when the ring has wrapped, else at 0
+    size_t start = (r->count == TRACE_RING_RECORDS) ? r->head : 0;
+    *out = r->records[(start + index) % TRACE_RING_RECORDS];
+    return true;
+}
+
+uint32_t trace_ring_cpu_hz(uint8_t ring) {
+    if (ring == TRACE_RING_PICO) {
+        return s_picoCpuHz;
+    }
+    return (uint32_t)getCpuFrequencyMhz() * 1000000UL;
+}
+
+#endif // TRACEPOINTS
@@ -7,8 +7,8 @@
 #define LOGO_SPLASH_WIDTH 180
 #define LOGO_SPLASH_HEIGHT 180
 
-// RGB565 pixel data (little-endian)
-static const uint8_t logo_splash_data[] = {
+// RGB565 pixel data (little-endian), 4-byte aligned for DMA from flash
+static const uint8_t logo_splash_data[] __attribute__((aligned(4))) = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
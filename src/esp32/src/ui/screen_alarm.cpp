@@ -8,6 +8,7 @@
 #include "ui/screen_alarm.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -31,14 +32,14 @@ lv_obj_t* screen_alarm_create(void) {
     lv_label_set_text(title, "ALARM");
     lv_obj_set_style_text_font(title, FONT_HUGE, 0);
     lv_obj_set_style_text_color(title, COLOR_ERROR, 0);
-    lv_obj_align(title, LV_ALIGN_CENTER, 0, -80);
+    lv_obj_align(title, LV_ALIGN_CENTER, 0, GEO_Y(-80));
     
     // Alarm code label (will be updated when alarm is set)
     lv_obj_t* code_label = lv_label_create(screen);
     lv_label_set_text(code_label, "");
     lv_obj_set_style_text_font(code_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(code_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(code_label, LV_ALIGN_CENTER, 0, -20);
+    lv_obj_align(code_label, LV_ALIGN_CENTER, 0, GEO_Y(-20));
     
     // Alarm message label (will be updated when alarm is set)
     lv_obj_t* msg_label = lv_label_create(screen);
@@ -47,7 +48,7 @@ lv_obj_t* screen_alarm_create(void) {
     lv_obj_set_style_text_color(msg_label, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_align(msg_label, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_set_width(msg_label, DISPLAY_WIDTH - 80);
-    lv_obj_align(msg_label, LV_ALIGN_CENTER, 0, 40);
+    lv_obj_align(msg_label, LV_ALIGN_CENTER, 0, GEO_Y(40));
     
     // Store label pointers for updates (using user_data)
     lv_obj_set_user_data(code_label, (void*)1);  // Mark as code label
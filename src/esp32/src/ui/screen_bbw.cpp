@@ -6,6 +6,7 @@
 #include "ui/screen_bbw.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Field indices
 enum {
@@ -62,14 +63,13 @@ lv_obj_t* screen_bbw_create(void) {
     // Title
     title_label = lv_label_create(container);
     lv_label_set_text(title_label, LV_SYMBOL_DOWNLOAD " Brew by Weight");
-    lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
-    lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 40);
+    theme_apply_label_style(title_label, THEME_LABEL_TITLE);
+    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, GEO_Y(40));
     
     // Settings card
     lv_obj_t* card = lv_obj_create(container);
-    lv_obj_set_size(card, 360, 280);
-    lv_obj_align(card, LV_ALIGN_CENTER, 0, 20);
+    lv_obj_set_size(card, GEO_X(360), GEO_Y(280));
+    lv_obj_align(card, LV_ALIGN_CENTER, 0, GEO_Y(20));
     lv_obj_set_style_bg_color(card, COLOR_BG_CARD, 0);
     lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
     lv_obj_set_style_radius(card, RADIUS_NORMAL, 0);
@@ -89,19 +89,18 @@ lv_obj_t* screen_bbw_create(void) {
     lv_obj_set_flex_align(target_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     field_indicators[FIELD_TARGET_WEIGHT] = lv_obj_create(target_row);
-    lv_obj_set_size(field_indicators[FIELD_TARGET_WEIGHT], 4, 30);
+    lv_obj_set_size(field_indicators[FIELD_TARGET_WEIGHT], GEO_X(4), GEO_Y(30));
     lv_obj_set_style_bg_color(field_indicators[FIELD_TARGET_WEIGHT], COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(field_indicators[FIELD_TARGET_WEIGHT], 2, 0);
     lv_obj_set_style_bg_opa(field_indicators[FIELD_TARGET_WEIGHT], LV_OPA_TRANSP, 0);
     
     lv_obj_t* target_label = lv_label_create(target_row);
     lv_label_set_text(target_label, "Target Weight");
-    lv_obj_set_style_text_font(target_label, FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(target_label, COLOR_TEXT_MUTED, 0);
-    
+    theme_apply_label_style(target_label, THEME_LABEL_FIELD);
+
     target_value = lv_label_create(target_row);
     lv_label_set_text(target_value, "36.0g");
-    lv_obj_set_style_text_font(target_value, FONT_MEDIUM, 0);
+    theme_apply_label_style(target_value, THEME_LABEL_VALUE);
     lv_obj_set_style_text_color(target_value, COLOR_ACCENT_AMBER, 0);
     
     y_pos += row_height;
@@ -115,29 +114,26 @@ lv_obj_t* screen_bbw_create(void) {
     lv_obj_set_flex_align(dose_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     field_indicators[FIELD_DOSE_WEIGHT] = lv_obj_create(dose_row);
-    lv_obj_set_size(field_indicators[FIELD_DOSE_WEIGHT], 4, 30);
+    lv_obj_set_size(field_indicators[FIELD_DOSE_WEIGHT], GEO_X(4), GEO_Y(30));
     lv_obj_set_style_bg_color(field_indicators[FIELD_DOSE_WEIGHT], COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(field_indicators[FIELD_DOSE_WEIGHT], 2, 0);
     lv_obj_set_style_bg_opa(field_indicators[FIELD_DOSE_WEIGHT], LV_OPA_TRANSP, 0);
     
     lv_obj_t* dose_label = lv_label_create(dose_row);
     lv_label_set_text(dose_label, "Dose Weight");
-    lv_obj_set_style_text_font(dose_label, FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(dose_label, COLOR_TEXT_MUTED, 0);
-    
+    theme_apply_label_style(dose_label, THEME_LABEL_FIELD);
+
     dose_value = lv_label_create(dose_row);
     lv_label_set_text(dose_value, "18.0g");
-    lv_obj_set_style_text_font(dose_value, FONT_MEDIUM, 0);
-    lv_obj_set_style_text_color(dose_value, COLOR_TEXT_PRIMARY, 0);
+    theme_apply_label_style(dose_value, THEME_LABEL_VALUE);
     
     y_pos += row_height;
     
     // Ratio display
     ratio_label = lv_label_create(card);
     lv_label_set_text(ratio_label, "Ratio: 1:2.0");
-    lv_obj_set_style_text_font(ratio_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(ratio_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(ratio_label, LV_ALIGN_TOP_RIGHT, -10, y_pos - 35);
+    theme_apply_label_style(ratio_label, THEME_LABEL_CAPTION);
+    lv_obj_align(ratio_label, LV_ALIGN_TOP_RIGHT, GEO_X(-10), y_pos - 35);
     
     // Stop Offset row
     lv_obj_t* offset_row = lv_obj_create(card);
@@ -148,20 +144,18 @@ lv_obj_t* screen_bbw_create(void) {
     lv_obj_set_flex_align(offset_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     field_indicators[FIELD_STOP_OFFSET] = lv_obj_create(offset_row);
-    lv_obj_set_size(field_indicators[FIELD_STOP_OFFSET], 4, 30);
+    lv_obj_set_size(field_indicators[FIELD_STOP_OFFSET], GEO_X(4), GEO_Y(30));
     lv_obj_set_style_bg_color(field_indicators[FIELD_STOP_OFFSET], COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(field_indicators[FIELD_STOP_OFFSET], 2, 0);
     lv_obj_set_style_bg_opa(field_indicators[FIELD_STOP_OFFSET], LV_OPA_TRANSP, 0);
     
     lv_obj_t* offset_label = lv_label_create(offset_row);
     lv_label_set_text(offset_label, "Stop Offset");
-    lv_obj_set_style_text_font(offset_label, FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(offset_label, COLOR_TEXT_MUTED, 0);
-    
+    theme_apply_label_style(offset_label, THEME_LABEL_FIELD);
+
     offset_value = lv_label_create(offset_row);
     lv_label_set_text(offset_value, "2.0g");
-    lv_obj_set_style_text_font(offset_value, FONT_MEDIUM, 0);
-    lv_obj_set_style_text_color(offset_value, COLOR_TEXT_PRIMARY, 0);
+    theme_apply_label_style(offset_value, THEME_LABEL_VALUE);
     
     y_pos += row_height;
     
@@ -174,18 +168,17 @@ lv_obj_t* screen_bbw_create(void) {
     lv_obj_set_flex_align(auto_stop_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     field_indicators[FIELD_AUTO_STOP] = lv_obj_create(auto_stop_row);
-    lv_obj_set_size(field_indicators[FIELD_AUTO_STOP], 4, 30);
+    lv_obj_set_size(field_indicators[FIELD_AUTO_STOP], GEO_X(4), GEO_Y(30));
     lv_obj_set_style_bg_color(field_indicators[FIELD_AUTO_STOP], COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(field_indicators[FIELD_AUTO_STOP], 2, 0);
     lv_obj_set_style_bg_opa(field_indicators[FIELD_AUTO_STOP], LV_OPA_TRANSP, 0);
     
     lv_obj_t* auto_stop_label = lv_label_create(auto_stop_row);
     lv_label_set_text(auto_stop_label, "Auto-Stop");
-    lv_obj_set_style_text_font(auto_stop_label, FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(auto_stop_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(auto_stop_label, THEME_LABEL_FIELD);
     
     auto_stop_switch = lv_switch_create(auto_stop_row);
-    lv_obj_set_size(auto_stop_switch, 50, 26);
+    lv_obj_set_size(auto_stop_switch, GEO_X(50), GEO_Y(26));
     lv_obj_add_state(auto_stop_switch, LV_STATE_CHECKED);
     
     y_pos += row_height;
@@ -199,24 +192,23 @@ lv_obj_t* screen_bbw_create(void) {
     lv_obj_set_flex_align(auto_tare_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     field_indicators[FIELD_AUTO_TARE] = lv_obj_create(auto_tare_row);
-    lv_obj_set_size(field_indicators[FIELD_AUTO_TARE], 4, 30);
+    lv_obj_set_size(field_indicators[FIELD_AUTO_TARE], GEO_X(4), GEO_Y(30));
     lv_obj_set_style_bg_color(field_indicators[FIELD_AUTO_TARE], COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(field_indicators[FIELD_AUTO_TARE], 2, 0);
     lv_obj_set_style_bg_opa(field_indicators[FIELD_AUTO_TARE], LV_OPA_TRANSP, 0);
     
     lv_obj_t* auto_tare_label = lv_label_create(auto_tare_row);
     lv_label_set_text(auto_tare_label, "Auto-Tare");
-    lv_obj_set_style_text_font(auto_tare_label, FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(auto_tare_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(auto_tare_label, THEME_LABEL_FIELD);
     
     auto_tare_switch = lv_switch_create(auto_tare_row);
-    lv_obj_set_size(auto_tare_switch, 50, 26);
+    lv_obj_set_size(auto_tare_switch, GEO_X(50), GEO_Y(26));
     lv_obj_add_state(auto_tare_switch, LV_STATE_CHECKED);
     
     // Save button
     save_btn = lv_btn_create(container);
-    lv_obj_set_size(save_btn, 120, 40);
-    lv_obj_align(save_btn, LV_ALIGN_BOTTOM_MID, 0, -50);
+    lv_obj_set_size(save_btn, GEO_X(120), GEO_Y(40));
+    lv_obj_align(save_btn, LV_ALIGN_BOTTOM_MID, 0, GEO_Y(-50));
     lv_obj_set_style_bg_color(save_btn, COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_radius(save_btn, RADIUS_NORMAL, 0);
     
@@ -231,9 +223,8 @@ lv_obj_t* screen_bbw_create(void) {
     // Hint
     lv_obj_t* hint = lv_label_create(container);
     lv_label_set_text(hint, "Rotate to navigate • Press to edit • Long press to exit");
-    lv_obj_set_style_text_font(hint, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(hint, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -20);
+    theme_apply_label_style(hint, THEME_LABEL_CAPTION);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, GEO_Y(-20));
     
     // Initial highlight
     highlight_field(selected_field, true);
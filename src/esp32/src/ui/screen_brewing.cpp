@@ -9,6 +9,8 @@
 #include "ui/screen_brewing.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
+#include "protocol_defs.h"  // For BREW_PHASE_*
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -19,6 +21,28 @@ static lv_obj_t* flow_label = nullptr;
 static lv_obj_t* progress_arc = nullptr;
 static lv_obj_t* status_label = nullptr;
 
+// Last displayed values, quantized to label resolution - lv_label_set_text()
+// invalidates the widget even when the text is unchanged, so setting every
+// label on every state tick forced needless redraws of their areas. Only the
+// widget whose displayed value actually changed gets touched.
+static uint32_t cached_secs = UINT32_MAX;
+static int32_t cached_weight_dg = INT32_MIN;     // Weight in 0.1g (INT32_MIN = "--.-g")
+static int32_t cached_target_dg = INT32_MIN;
+static int32_t cached_flow_dml = INT32_MIN;      // Flow in 0.1 ml/s
+static int32_t cached_pct = INT32_MIN;
+static int8_t cached_scale_connected = -1;
+static int16_t cached_phase = -1;
+
+static void reset_cached_values(void) {
+    cached_secs = UINT32_MAX;
+    cached_weight_dg = INT32_MIN;
+    cached_target_dg = INT32_MIN;
+    cached_flow_dml = INT32_MIN;
+    cached_pct = INT32_MIN;
+    cached_scale_connected = -1;
+    cached_phase = -1;
+}
+
 // =============================================================================
 // Screen Creation
 // =============================================================================
@@ -33,7 +57,7 @@ lv_obj_t* screen_brewing_create(void) {
     
     // === Progress Arc (fits within round display) ===
     progress_arc = lv_arc_create(screen);
-    lv_obj_set_size(progress_arc, 340, 340);
+    lv_obj_set_size(progress_arc, GEO_X(340), GEO_Y(340));
     lv_obj_center(progress_arc);
     lv_arc_set_range(progress_arc, 0, 100);
     lv_arc_set_value(progress_arc, 0);
@@ -59,36 +83,38 @@ lv_obj_t* screen_brewing_create(void) {
     lv_obj_set_style_text_font(status_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(status_label, COLOR_ACCENT_ORANGE, 0);
     lv_obj_set_style_text_letter_space(status_label, 2, 0);
-    lv_obj_align(status_label, LV_ALIGN_CENTER, 0, -120);
+    lv_obj_align(status_label, LV_ALIGN_CENTER, 0, GEO_Y(-120));
     
     // === Timer (large, central) ===
     timer_label = lv_label_create(screen);
     lv_label_set_text(timer_label, "00:00");
-    lv_obj_set_style_text_font(timer_label, FONT_TEMP, 0);
-    lv_obj_set_style_text_color(timer_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(timer_label, LV_ALIGN_CENTER, 0, -50);
+    theme_apply_label_style(timer_label, THEME_LABEL_BIG_DIGITS);
+    lv_obj_align(timer_label, LV_ALIGN_CENTER, 0, GEO_Y(-50));
     
     // === Current Weight ===
     weight_label = lv_label_create(screen);
     lv_label_set_text(weight_label, "--.-g");
     lv_obj_set_style_text_font(weight_label, FONT_XLARGE, 0);
     lv_obj_set_style_text_color(weight_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(weight_label, LV_ALIGN_CENTER, 0, 15);
+    lv_obj_align(weight_label, LV_ALIGN_CENTER, 0, GEO_Y(15));
     
     // === Target Weight ===
     weight_target_label = lv_label_create(screen);
     lv_label_set_text(weight_target_label, "/ 36.0g");
     lv_obj_set_style_text_font(weight_target_label, FONT_NORMAL, 0);
     lv_obj_set_style_text_color(weight_target_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(weight_target_label, LV_ALIGN_CENTER, 0, 55);
+    lv_obj_align(weight_target_label, LV_ALIGN_CENTER, 0, GEO_Y(55));
     
     // === Flow Rate ===
     flow_label = lv_label_create(screen);
     lv_label_set_text(flow_label, "0.0 ml/s");
-    lv_obj_set_style_text_font(flow_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(flow_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(flow_label, LV_ALIGN_CENTER, 0, 85);
+    theme_apply_label_style(flow_label, THEME_LABEL_CAPTION);
+    lv_obj_align(flow_label, LV_ALIGN_CENTER, 0, GEO_Y(85));
     
+    // Screens are destroyed and re-created on switches - invalidate the
+    // cached values so the first update repaints every widget
+    reset_cached_values();
+
     LOG_I("Brewing screen created");
     return screen;
 }
@@ -99,65 +125,96 @@ lv_obj_t* screen_brewing_create(void) {
 
 void screen_brewing_update(const ui_state_t* state) {
     if (!screen || !state) return;
-    
-    // Update timer
+
+    // Update timer (only when the displayed second ticks over)
     uint32_t secs = state->brew_time_ms / 1000;
-    uint32_t mins = secs / 60;
-    secs = secs % 60;
-    
-    char timer_str[16];
-    snprintf(timer_str, sizeof(timer_str), "%02lu:%02lu", (unsigned long)mins, (unsigned long)secs);
-    lv_label_set_text(timer_label, timer_str);
-    
-    // Update weight
-    char weight_str[16];
-    if (state->scale_connected) {
-        snprintf(weight_str, sizeof(weight_str), "%.1fg", state->brew_weight);
-    } else {
-        snprintf(weight_str, sizeof(weight_str), "--.-g");
+    if (secs != cached_secs) {
+        cached_secs = secs;
+        char timer_str[16];
+        snprintf(timer_str, sizeof(timer_str), "%02lu:%02lu",
+                (unsigned long)(secs / 60), (unsigned long)(secs % 60));
+        lv_label_set_text(timer_label, timer_str);
     }
-    lv_label_set_text(weight_label, weight_str);
-    
+
+    // Update weight (0.1g display resolution)
+    int32_t weight_dg = state->scale_connected
+        ? (int32_t)(state->brew_weight * 10.0f) : INT32_MIN;
+    if (weight_dg != cached_weight_dg) {
+        cached_weight_dg = weight_dg;
+        char weight_str[16];
+        if (state->scale_connected) {
+            snprintf(weight_str, sizeof(weight_str), "%.1fg", state->brew_weight);
+        } else {
+            snprintf(weight_str, sizeof(weight_str), "--.-g");
+        }
+        lv_label_set_text(weight_label, weight_str);
+    }
+
     // Update target weight
-    char target_str[16];
-    snprintf(target_str, sizeof(target_str), "/ %.1fg", state->target_weight);
-    lv_label_set_text(weight_target_label, target_str);
-    
-    // Update flow rate
-    char flow_str[16];
-    snprintf(flow_str, sizeof(flow_str), "%.1f ml/s", state->flow_rate);
-    lv_label_set_text(flow_label, flow_str);
-    
+    int32_t target_dg = (int32_t)(state->target_weight * 10.0f);
+    if (target_dg != cached_target_dg) {
+        cached_target_dg = target_dg;
+        char target_str[16];
+        snprintf(target_str, sizeof(target_str), "/ %.1fg", state->target_weight);
+        lv_label_set_text(weight_target_label, target_str);
+    }
+
+    // Update flow rate (0.1 ml/s display resolution)
+    int32_t flow_dml = (int32_t)(state->flow_rate * 10.0f);
+    if (flow_dml != cached_flow_dml) {
+        cached_flow_dml = flow_dml;
+        char flow_str[16];
+        snprintf(flow_str, sizeof(flow_str), "%.1f ml/s", state->flow_rate);
+        lv_label_set_text(flow_label, flow_str);
+    }
+
     // Update progress arc (based on weight target)
     if (state->target_weight > 0 && state->scale_connected) {
         int pct = (int)((state->brew_weight / state->target_weight) * 100);
         pct = LV_CLAMP(0, pct, 100);
-        lv_arc_set_value(progress_arc, pct);
-        
-        // Change arc color when approaching target
-        if (pct >= 90) {
-            lv_obj_set_style_arc_color(progress_arc, COLOR_SUCCESS, LV_PART_INDICATOR);
-        } else if (pct >= 75) {
-            lv_obj_set_style_arc_color(progress_arc, COLOR_WARNING, LV_PART_INDICATOR);
-        } else {
-            lv_obj_set_style_arc_color(progress_arc, COLOR_ACCENT_ORANGE, LV_PART_INDICATOR);
+        if (pct != cached_pct) {
+            cached_pct = pct;
+            lv_arc_set_value(progress_arc, pct);
+
+            // Change arc color when approaching target
+            if (pct >= 90) {
+                lv_obj_set_style_arc_color(progress_arc, COLOR_SUCCESS, LV_PART_INDICATOR);
+            } else if (pct >= 75) {
+                lv_obj_set_style_arc_color(progress_arc, COLOR_WARNING, LV_PART_INDICATOR);
+            } else {
+                lv_obj_set_style_arc_color(progress_arc, COLOR_ACCENT_ORANGE, LV_PART_INDICATOR);
+            }
         }
     }
-    
-    // Update status text based on scale connection
-    if (!state->scale_connected) {
-        lv_label_set_text(status_label, "NO SCALE");
-    } else {
-        lv_label_set_text(status_label, "BREWING");
+
+    // Update status text based on shot phase and scale connection. Phases are
+    // reported by the Pico state machine (BREW_PHASE_* in the status payload),
+    // so pre-infusion/soak no longer have to be guessed from pressure.
+    if ((int8_t)state->scale_connected != cached_scale_connected ||
+        (int16_t)state->brew_phase != cached_phase) {
+        cached_scale_connected = (int8_t)state->scale_connected;
+        cached_phase = (int16_t)state->brew_phase;
+        switch (state->brew_phase) {
+            case BREW_PHASE_PREINFUSION:
+                lv_label_set_text(status_label, "PRE-INFUSION");
+                break;
+            case BREW_PHASE_PAUSE:
+                lv_label_set_text(status_label, "SOAK");
+                break;
+            default:
+                lv_label_set_text(status_label, state->scale_connected ? "BREWING" : "NO SCALE");
+                break;
+        }
     }
 }
 
 void screen_brewing_reset(void) {
     if (!screen) return;
-    
+
     lv_label_set_text(timer_label, "00:00");
     lv_label_set_text(weight_label, "0.0g");
     lv_arc_set_value(progress_arc, 0);
     lv_obj_set_style_arc_color(progress_arc, COLOR_ACCENT_ORANGE, LV_PART_INDICATOR);
+    reset_cached_values();
 }
 
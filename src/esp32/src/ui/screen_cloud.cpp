@@ -9,6 +9,7 @@
 #include "ui/screen_cloud.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Check if QR code support is available
 #if LV_USE_QRCODE
@@ -53,12 +54,12 @@ lv_obj_t* screen_cloud_create(void) {
     lv_label_set_text(title_label, "Cloud Pairing");
     lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, -150);
+    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, GEO_Y(-150));
     
     // === QR Code container ===
     qr_container = lv_obj_create(screen);
-    lv_obj_set_size(qr_container, 140, 140);
-    lv_obj_align(qr_container, LV_ALIGN_CENTER, 0, -50);
+    lv_obj_set_size(qr_container, GEO_X(140), GEO_Y(140));
+    lv_obj_align(qr_container, LV_ALIGN_CENTER, 0, GEO_Y(-50));
     lv_obj_set_style_bg_color(qr_container, lv_color_white(), 0);
     lv_obj_set_style_radius(qr_container, 8, 0);
     lv_obj_set_style_border_width(qr_container, 0, 0);
@@ -82,8 +83,8 @@ lv_obj_t* screen_cloud_create(void) {
     
     // === Loading spinner (hidden by default) ===
     spinner = lv_spinner_create(screen, 1000, 60);
-    lv_obj_set_size(spinner, 80, 80);
-    lv_obj_align(spinner, LV_ALIGN_CENTER, 0, -50);
+    lv_obj_set_size(spinner, GEO_X(80), GEO_Y(80));
+    lv_obj_align(spinner, LV_ALIGN_CENTER, 0, GEO_Y(-50));
     lv_obj_set_style_arc_color(spinner, COLOR_ACCENT_AMBER, LV_PART_INDICATOR);
     lv_obj_set_style_arc_color(spinner, COLOR_BG_ELEVATED, LV_PART_MAIN);
     lv_obj_set_style_arc_width(spinner, 8, 0);
@@ -95,7 +96,7 @@ lv_obj_t* screen_cloud_create(void) {
     lv_obj_set_style_text_font(error_label, FONT_NORMAL, 0);
     lv_obj_set_style_text_color(error_label, COLOR_ERROR, 0);
     lv_obj_set_style_text_align(error_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, -50);
+    lv_obj_align(error_label, LV_ALIGN_CENTER, 0, GEO_Y(-50));
     lv_obj_add_flag(error_label, LV_OBJ_FLAG_HIDDEN);
     
     // === Device ID ===
@@ -103,7 +104,7 @@ lv_obj_t* screen_cloud_create(void) {
     lv_label_set_text(device_id_label, "Device: BRW-XXXXXXXX");
     lv_obj_set_style_text_font(device_id_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(device_id_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(device_id_label, LV_ALIGN_CENTER, 0, 40);
+    lv_obj_align(device_id_label, LV_ALIGN_CENTER, 0, GEO_Y(40));
     
     // === Pairing Code (large, prominent) ===
     code_label = lv_label_create(screen);
@@ -111,19 +112,19 @@ lv_obj_t* screen_cloud_create(void) {
     lv_obj_set_style_text_font(code_label, FONT_MEDIUM, 0);
     lv_obj_set_style_text_color(code_label, COLOR_ACCENT_AMBER, 0);
     lv_obj_set_style_text_letter_space(code_label, 2, 0);
-    lv_obj_align(code_label, LV_ALIGN_CENTER, 0, 70);
+    lv_obj_align(code_label, LV_ALIGN_CENTER, 0, GEO_Y(70));
     
     // === Expires label ===
     expires_label = lv_label_create(screen);
     lv_label_set_text(expires_label, "Scan QR or enter code");
     lv_obj_set_style_text_font(expires_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(expires_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(expires_label, LV_ALIGN_CENTER, 0, 100);
+    lv_obj_align(expires_label, LV_ALIGN_CENTER, 0, GEO_Y(100));
     
     // === Refresh button ===
     refresh_btn = lv_btn_create(screen);
-    lv_obj_set_size(refresh_btn, 120, 36);
-    lv_obj_align(refresh_btn, LV_ALIGN_CENTER, 0, 145);
+    lv_obj_set_size(refresh_btn, GEO_X(120), GEO_Y(36));
+    lv_obj_align(refresh_btn, LV_ALIGN_CENTER, 0, GEO_Y(145));
     lv_obj_set_style_bg_color(refresh_btn, COLOR_BG_CARD, 0);
     lv_obj_set_style_radius(refresh_btn, 18, 0);
     lv_obj_set_style_border_width(refresh_btn, 1, 0);
@@ -9,6 +9,7 @@
 #include "ui/screen_complete.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -39,19 +40,19 @@ lv_obj_t* screen_complete_create(void) {
     lv_label_set_text(checkmark, LV_SYMBOL_OK);
     lv_obj_set_style_text_font(checkmark, FONT_XLARGE, 0);
     lv_obj_set_style_text_color(checkmark, COLOR_SUCCESS, 0);
-    lv_obj_align(checkmark, LV_ALIGN_CENTER, 0, -130);
+    lv_obj_align(checkmark, LV_ALIGN_CENTER, 0, GEO_Y(-130));
     
     // === Title ===
     title_label = lv_label_create(screen);
     lv_label_set_text(title_label, "Shot Complete");
     lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, -80);
+    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, GEO_Y(-80));
     
     // === Compact Stats Card ===
     lv_obj_t* card = lv_obj_create(screen);
-    lv_obj_set_size(card, 260, 155);
-    lv_obj_align(card, LV_ALIGN_CENTER, 0, 20);
+    lv_obj_set_size(card, GEO_X(260), GEO_Y(155));
+    lv_obj_align(card, LV_ALIGN_CENTER, 0, GEO_Y(20));
     lv_obj_set_style_bg_color(card, COLOR_BG_CARD, 0);
     lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
     lv_obj_set_style_radius(card, RADIUS_NORMAL, 0);
@@ -81,7 +82,7 @@ lv_obj_t* screen_complete_create(void) {
     lv_obj_t* weight_row = lv_obj_create(card);
     lv_obj_remove_style_all(weight_row);
     lv_obj_set_size(weight_row, lv_pct(100), 32);
-    lv_obj_align(weight_row, LV_ALIGN_TOP_MID, 0, 35);
+    lv_obj_align(weight_row, LV_ALIGN_TOP_MID, 0, GEO_Y(35));
     lv_obj_set_flex_flow(weight_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(weight_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -99,7 +100,7 @@ lv_obj_t* screen_complete_create(void) {
     lv_obj_t* ratio_row = lv_obj_create(card);
     lv_obj_remove_style_all(ratio_row);
     lv_obj_set_size(ratio_row, lv_pct(100), 32);
-    lv_obj_align(ratio_row, LV_ALIGN_TOP_MID, 0, 70);
+    lv_obj_align(ratio_row, LV_ALIGN_TOP_MID, 0, GEO_Y(70));
     lv_obj_set_flex_flow(ratio_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ratio_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -117,7 +118,7 @@ lv_obj_t* screen_complete_create(void) {
     lv_obj_t* flow_row = lv_obj_create(card);
     lv_obj_remove_style_all(flow_row);
     lv_obj_set_size(flow_row, lv_pct(100), 32);
-    lv_obj_align(flow_row, LV_ALIGN_TOP_MID, 0, 105);
+    lv_obj_align(flow_row, LV_ALIGN_TOP_MID, 0, GEO_Y(105));
     lv_obj_set_flex_flow(flow_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(flow_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -136,7 +137,7 @@ lv_obj_t* screen_complete_create(void) {
     lv_label_set_text(hint_label, "Press to continue");
     lv_obj_set_style_text_font(hint_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(hint_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(hint_label, LV_ALIGN_CENTER, 0, 135);
+    lv_obj_align(hint_label, LV_ALIGN_CENTER, 0, GEO_Y(135));
     
     LOG_I("Complete screen created");
     return screen;
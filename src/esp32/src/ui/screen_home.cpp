@@ -13,6 +13,8 @@
 #include "ui/screen_home.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
+#include "machine_features.h"
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -33,6 +35,28 @@ static lv_obj_t* cloud_icon = nullptr;
 // Cached machine type for dynamic updates
 static uint8_t cached_machine_type = 0;
 
+// Last displayed values, quantized to label resolution - lv_label_set_text()
+// and style setters invalidate their widget even when nothing changed, so
+// unconditionally setting every label on every state tick redrew most of the
+// screen. Only widgets whose displayed value changed get touched.
+static int32_t cached_main_temp_d = INT32_MIN;      // Main temp in 0.1°C
+static int32_t cached_setpoint = INT32_MIN;         // Setpoint in whole °C
+static int32_t cached_steam_temp = INT32_MIN;       // Steam temp in whole °C
+static int32_t cached_pressure_d = INT32_MIN;       // Pressure in 0.1 bar
+static int32_t cached_arc_pct = INT32_MIN;
+static const char* cached_status_text = nullptr;
+static uint8_t cached_conn_flags = 0xFF;            // wifi/scale/cloud bits
+
+static void reset_cached_values(void) {
+    cached_main_temp_d = INT32_MIN;
+    cached_setpoint = INT32_MIN;
+    cached_steam_temp = INT32_MIN;
+    cached_pressure_d = INT32_MIN;
+    cached_arc_pct = INT32_MIN;
+    cached_status_text = nullptr;
+    cached_conn_flags = 0xFF;
+}
+
 // =============================================================================
 // Screen Creation
 // =============================================================================
@@ -53,7 +77,7 @@ lv_obj_t* screen_home_create(void) {
     
     // === Main temperature arc (at the edge of display) ===
     brew_temp_arc = lv_arc_create(container);
-    lv_obj_set_size(brew_temp_arc, 460, 460);
+    lv_obj_set_size(brew_temp_arc, GEO_EDGE_ARC_SIZE, GEO_EDGE_ARC_SIZE);
     lv_obj_center(brew_temp_arc);
     lv_arc_set_range(brew_temp_arc, 0, 100);
     lv_arc_set_value(brew_temp_arc, 0);
@@ -62,11 +86,11 @@ lv_obj_t* screen_home_create(void) {
     
     // Arc background - subtle
     lv_obj_set_style_arc_color(brew_temp_arc, COLOR_BG_ELEVATED, LV_PART_MAIN);
-    lv_obj_set_style_arc_width(brew_temp_arc, 10, LV_PART_MAIN);
+    lv_obj_set_style_arc_width(brew_temp_arc, GEO_EDGE_ARC_WIDTH, LV_PART_MAIN);
     
     // Arc indicator - prominent with rounded ends
     lv_obj_set_style_arc_color(brew_temp_arc, COLOR_ACCENT_PRIMARY, LV_PART_INDICATOR);
-    lv_obj_set_style_arc_width(brew_temp_arc, 10, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_width(brew_temp_arc, GEO_EDGE_ARC_WIDTH, LV_PART_INDICATOR);
     lv_obj_set_style_arc_rounded(brew_temp_arc, true, LV_PART_INDICATOR);
     
     // Hide knob
@@ -76,13 +100,13 @@ lv_obj_t* screen_home_create(void) {
     // === Status at top (centered with dot) ===
     lv_obj_t* status_row = lv_obj_create(container);
     lv_obj_remove_style_all(status_row);
-    lv_obj_set_size(status_row, 160, 24);
-    lv_obj_align(status_row, LV_ALIGN_TOP_MID, 0, 60);
+    lv_obj_set_size(status_row, GEO_X(160), GEO_Y(24));
+    lv_obj_align(status_row, LV_ALIGN_TOP_MID, 0, GEO_TOP_BAND_Y);
     lv_obj_set_flex_flow(status_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(status_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     status_dot = lv_obj_create(status_row);
-    lv_obj_set_size(status_dot, 10, 10);
+    lv_obj_set_size(status_dot, GEO_X(10), GEO_Y(10));
     lv_obj_set_style_radius(status_dot, LV_RADIUS_CIRCLE, 0);
     lv_obj_set_style_bg_color(status_dot, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_border_width(status_dot, 0, 0);
@@ -98,7 +122,7 @@ lv_obj_t* screen_home_create(void) {
     lv_label_set_text(brew_temp_label, "--°");
     lv_obj_set_style_text_font(brew_temp_label, FONT_TEMP, 0);
     lv_obj_set_style_text_color(brew_temp_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(brew_temp_label, LV_ALIGN_CENTER, 0, -25);
+    lv_obj_align(brew_temp_label, LV_ALIGN_CENTER, 0, GEO_Y(-25));
     
     // Brew label
     brew_label_text = lv_label_create(container);
@@ -106,14 +130,14 @@ lv_obj_t* screen_home_create(void) {
     lv_obj_set_style_text_font(brew_label_text, FONT_SMALL, 0);
     lv_obj_set_style_text_color(brew_label_text, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_letter_space(brew_label_text, 3, 0);
-    lv_obj_align(brew_label_text, LV_ALIGN_CENTER, 0, 15);
+    lv_obj_align(brew_label_text, LV_ALIGN_CENTER, 0, GEO_Y(15));
     
     // Setpoint (smaller, below label)
     brew_setpoint_label = lv_label_create(container);
     lv_label_set_text(brew_setpoint_label, "→ --°C");
     lv_obj_set_style_text_font(brew_setpoint_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(brew_setpoint_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(brew_setpoint_label, LV_ALIGN_CENTER, 0, 35);
+    lv_obj_align(brew_setpoint_label, LV_ALIGN_CENTER, 0, GEO_Y(35));
     
     // === Bottom info row (steam temp and pressure - no boxes) ===
     // Steam temperature (left side)
@@ -122,13 +146,13 @@ lv_obj_t* screen_home_create(void) {
     lv_obj_set_style_text_font(steam_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(steam_label, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_letter_space(steam_label, 2, 0);
-    lv_obj_align(steam_label, LV_ALIGN_CENTER, -80, 85);
+    lv_obj_align(steam_label, LV_ALIGN_CENTER, GEO_COL_LEFT_X, GEO_Y(85));
     
     steam_temp_label = lv_label_create(container);
     lv_label_set_text(steam_temp_label, "--°");
     lv_obj_set_style_text_font(steam_temp_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(steam_temp_label, COLOR_TEXT_SECONDARY, 0);
-    lv_obj_align(steam_temp_label, LV_ALIGN_CENTER, -80, 110);
+    lv_obj_align(steam_temp_label, LV_ALIGN_CENTER, GEO_COL_LEFT_X, GEO_Y(110));
     
     // Pressure (right side)
     lv_obj_t* pressure_title = lv_label_create(container);
@@ -136,25 +160,25 @@ lv_obj_t* screen_home_create(void) {
     lv_obj_set_style_text_font(pressure_title, FONT_SMALL, 0);
     lv_obj_set_style_text_color(pressure_title, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_letter_space(pressure_title, 2, 0);
-    lv_obj_align(pressure_title, LV_ALIGN_CENTER, 80, 85);
+    lv_obj_align(pressure_title, LV_ALIGN_CENTER, GEO_COL_RIGHT_X, GEO_Y(85));
     
     pressure_label = lv_label_create(container);
     lv_label_set_text(pressure_label, "--");
     lv_obj_set_style_text_font(pressure_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(pressure_label, COLOR_TEXT_SECONDARY, 0);
-    lv_obj_align(pressure_label, LV_ALIGN_CENTER, 70, 110);
+    lv_obj_align(pressure_label, LV_ALIGN_CENTER, GEO_X(70), GEO_Y(110));
     
     pressure_unit_label = lv_label_create(container);
     lv_label_set_text(pressure_unit_label, "bar");
     lv_obj_set_style_text_font(pressure_unit_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(pressure_unit_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(pressure_unit_label, LV_ALIGN_CENTER, 105, 114);
+    lv_obj_align(pressure_unit_label, LV_ALIGN_CENTER, GEO_X(105), GEO_Y(114));
     
     // === Connection icons (bottom center) ===
     lv_obj_t* conn_row = lv_obj_create(container);
     lv_obj_remove_style_all(conn_row);
-    lv_obj_set_size(conn_row, 100, 20);
-    lv_obj_align(conn_row, LV_ALIGN_BOTTOM_MID, 0, -60);
+    lv_obj_set_size(conn_row, GEO_X(100), GEO_Y(20));
+    lv_obj_align(conn_row, LV_ALIGN_BOTTOM_MID, 0, GEO_BOTTOM_BAND_Y);
     lv_obj_set_flex_flow(conn_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(conn_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -178,6 +202,10 @@ lv_obj_t* screen_home_create(void) {
     lv_obj_set_style_text_font(cloud_icon, FONT_SMALL, 0);
     lv_obj_set_style_text_color(cloud_icon, COLOR_TEXT_MUTED, 0);
     
+    // Screens are destroyed and re-created on switches - invalidate the
+    // cached values so the first update repaints every widget
+    reset_cached_values();
+
     LOG_I("Home screen created");
     return screen;
 }
@@ -189,18 +217,17 @@ lv_obj_t* screen_home_create(void) {
 void screen_home_update(lv_obj_t* scr, const ui_state_t* state) {
     if (!state || !screen) return;
     
-    // Update labels if machine type changed
-    // machine_type: 0=unknown, 1=dual_boiler, 2=single_boiler, 3=heat_exchanger
+    // Update labels if machine type changed (predicates from machine_features.h)
     if (cached_machine_type != state->machine_type) {
         cached_machine_type = state->machine_type;
-        
+
         // Update main temperature label based on machine type
-        if (state->machine_type == 2) {  // Single boiler
+        if (machine_needs_mode_switching(state->machine_type)) {  // Single boiler
             lv_label_set_text(brew_label_text, "BOILER");
             // Hide steam for single boiler
             lv_obj_add_flag(steam_label, LV_OBJ_FLAG_HIDDEN);
             lv_obj_add_flag(steam_temp_label, LV_OBJ_FLAG_HIDDEN);
-        } else if (state->machine_type == 3) {  // Heat exchanger
+        } else if (machine_steam_provides_brew_heat(state->machine_type)) {  // Heat exchanger
             // HX: Only steam boiler with NTC (no brew NTC, no group temp sensor)
             lv_label_set_text(brew_label_text, "BOILER");
             // Hide secondary display - HX has only one temperature sensor
@@ -220,43 +247,63 @@ void screen_home_update(lv_obj_t* scr, const ui_state_t* state) {
     float main_setpoint = state->brew_setpoint;
     
     // For HX machines, main display shows steam boiler temp (only sensor available)
-    if (state->machine_type == 3) {
+    if (machine_steam_provides_brew_heat(state->machine_type)) {
         main_temp = state->steam_temp;
         main_setpoint = state->steam_setpoint;
     }
     
-    snprintf(temp_str, sizeof(temp_str), "%.1f°", main_temp);
-    lv_label_set_text(brew_temp_label, temp_str);
-    
+    // Main temperature (0.1° display resolution)
+    int32_t main_temp_d = (int32_t)(main_temp * 10.0f);
+    if (main_temp_d != cached_main_temp_d) {
+        cached_main_temp_d = main_temp_d;
+        snprintf(temp_str, sizeof(temp_str), "%.1f°", main_temp);
+        lv_label_set_text(brew_temp_label, temp_str);
+
+        // Arc color follows the measured temperature
+        lv_color_t temp_color = theme_get_temp_color(main_temp, main_setpoint);
+        lv_obj_set_style_arc_color(brew_temp_arc, temp_color, LV_PART_INDICATOR);
+    }
+
     // Update setpoint
-    snprintf(temp_str, sizeof(temp_str), "→ %.0f°C", main_setpoint);
-    lv_label_set_text(brew_setpoint_label, temp_str);
-    
+    int32_t setpoint_whole = (int32_t)main_setpoint;
+    if (setpoint_whole != cached_setpoint) {
+        cached_setpoint = setpoint_whole;
+        snprintf(temp_str, sizeof(temp_str), "→ %.0f°C", main_setpoint);
+        lv_label_set_text(brew_setpoint_label, temp_str);
+    }
+
     // Update brew arc (percentage of setpoint)
     if (main_setpoint > 0) {
         int pct = (int)((main_temp / main_setpoint) * 100);
         pct = LV_CLAMP(0, pct, 100);
-        lv_arc_set_value(brew_temp_arc, pct);
-        
-        // Update arc color based on temperature state
-        lv_color_t temp_color = theme_get_temp_color(main_temp, main_setpoint);
-        lv_obj_set_style_arc_color(brew_temp_arc, temp_color, LV_PART_INDICATOR);
+        if (pct != cached_arc_pct) {
+            cached_arc_pct = pct;
+            lv_arc_set_value(brew_temp_arc, pct);
+        }
     }
-    
+
     // Update secondary temperature (steam)
-    if (state->machine_type != 2) {  // Not single boiler
-        snprintf(temp_str, sizeof(temp_str), "%.0f°", state->steam_temp);
-        lv_label_set_text(steam_temp_label, temp_str);
+    if (!machine_needs_mode_switching(state->machine_type)) {  // Not single boiler
+        int32_t steam_whole = (int32_t)state->steam_temp;
+        if (steam_whole != cached_steam_temp) {
+            cached_steam_temp = steam_whole;
+            snprintf(temp_str, sizeof(temp_str), "%.0f°", state->steam_temp);
+            lv_label_set_text(steam_temp_label, temp_str);
+        }
     }
-    
-    // Update pressure
-    snprintf(temp_str, sizeof(temp_str), "%.1f", state->pressure);
-    lv_label_set_text(pressure_label, temp_str);
-    
-    // Pressure color
-    lv_color_t pressure_color = theme_get_pressure_color(state->pressure);
-    lv_obj_set_style_text_color(pressure_label, pressure_color, 0);
-    
+
+    // Update pressure (0.1 bar display resolution; color derives from the
+    // same value, so one cache covers both)
+    int32_t pressure_d = (int32_t)(state->pressure * 10.0f);
+    if (pressure_d != cached_pressure_d) {
+        cached_pressure_d = pressure_d;
+        snprintf(temp_str, sizeof(temp_str), "%.1f", state->pressure);
+        lv_label_set_text(pressure_label, temp_str);
+
+        lv_color_t pressure_color = theme_get_pressure_color(state->pressure);
+        lv_obj_set_style_text_color(pressure_label, pressure_color, 0);
+    }
+
     // Update status
     const char* status_text = "READY";
     lv_color_t status_color = COLOR_SUCCESS;
@@ -281,21 +328,31 @@ void screen_home_update(lv_obj_t* scr, const ui_state_t* state) {
         status_color = COLOR_TEXT_MUTED;
     }
     
-    lv_label_set_text(status_label, status_text);
-    lv_obj_set_style_bg_color(status_dot, status_color, 0);
-    
-    // Update connection icons
-    if (wifi_icon) {
-        lv_obj_set_style_text_color(wifi_icon, 
-            state->wifi_connected ? COLOR_SUCCESS : COLOR_TEXT_MUTED, 0);
-    }
-    if (scale_icon) {
-        lv_obj_set_style_text_color(scale_icon,
-            state->scale_connected ? COLOR_INFO : COLOR_TEXT_MUTED, 0);
+    // Status texts are string literals, so pointer comparison is enough
+    if (status_text != cached_status_text) {
+        cached_status_text = status_text;
+        lv_label_set_text(status_label, status_text);
+        lv_obj_set_style_bg_color(status_dot, status_color, 0);
     }
-    if (cloud_icon) {
-        lv_obj_set_style_text_color(cloud_icon,
-            state->cloud_connected ? COLOR_SUCCESS : COLOR_TEXT_MUTED, 0);
+
+    // Update connection icons (only on connect/disconnect transitions)
+    uint8_t conn_flags = (state->wifi_connected ? 0x01 : 0)
+                       | (state->scale_connected ? 0x02 : 0)
+                       | (state->cloud_connected ? 0x04 : 0);
+    if (conn_flags != cached_conn_flags) {
+        cached_conn_flags = conn_flags;
+        if (wifi_icon) {
+            lv_obj_set_style_text_color(wifi_icon,
+                state->wifi_connected ? COLOR_SUCCESS : COLOR_TEXT_MUTED, 0);
+        }
+        if (scale_icon) {
+            lv_obj_set_style_text_color(scale_icon,
+                state->scale_connected ? COLOR_INFO : COLOR_TEXT_MUTED, 0);
+        }
+        if (cloud_icon) {
+            lv_obj_set_style_text_color(cloud_icon,
+                state->cloud_connected ? COLOR_SUCCESS : COLOR_TEXT_MUTED, 0);
+        }
     }
 }
 
@@ -13,6 +13,9 @@
 #include "ui/screen_idle.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
+#include "machine_features.h"
+#include <time.h>
 
 // Power mode names (user-facing)
 static const char* power_mode_names[] = {
@@ -48,6 +51,13 @@ static lv_obj_t* wifi_icon = nullptr;
 static lv_obj_t* bt_icon = nullptr;
 static lv_obj_t* cloud_icon = nullptr;
 
+// Live status line - the only region of this screen that refreshes in deep
+// idle. One small label (clock + brew temp); everything else is rendered
+// once at create and only changes on events (encoder, connection edges),
+// so an idle machine invalidates a few dozen pixels a minute and the
+// display task mostly sleeps at the relaxed idle pacing rate.
+static lv_obj_t* status_line_label = nullptr;
+
 // State
 static int selected_index = 0;
 static idle_turn_on_callback_t turn_on_callback = nullptr;
@@ -58,6 +68,15 @@ static bool cached_wifi_connected = false;
 static bool cached_scale_connected = false;
 static bool cached_cloud_connected = false;
 
+// Cached status line state - clock in minutes since midnight (-1 until NTP
+// sync), temperature quantized to 0.1°C so sensor noise below the display
+// resolution doesn't redraw the label
+static int cached_clock_minute = -1;
+static int32_t cached_status_temp_d = INT32_MIN;
+
+// time() values before this are "not yet synced" (2021-01-01)
+#define CLOCK_VALID_EPOCH 1609459200
+
 // =============================================================================
 // Helper Functions  
 // =============================================================================
@@ -77,6 +96,35 @@ static void update_connection_indicators() {
     }
 }
 
+static void update_status_line(const ui_state_t* state) {
+    if (!status_line_label) return;
+
+    time_t now = time(nullptr);
+    struct tm timeinfo;
+    bool have_time = (now > CLOCK_VALID_EPOCH) && localtime_r(&now, &timeinfo);
+    int minute = have_time ? (timeinfo.tm_hour * 60 + timeinfo.tm_min) : -1;
+    int32_t temp_d = (int32_t)(state->brew_temp * 10.0f);
+
+    if (minute == cached_clock_minute && temp_d == cached_status_temp_d) {
+        return;  // Nothing visible changed - no label rewrite, no invalidate
+    }
+    cached_clock_minute = minute;
+    cached_status_temp_d = temp_d;
+
+    char buf[32];
+    if (have_time && state->brew_temp > 0.0f) {
+        snprintf(buf, sizeof(buf), "%02d:%02d  •  %.1f°",
+                 timeinfo.tm_hour, timeinfo.tm_min, state->brew_temp);
+    } else if (have_time) {
+        snprintf(buf, sizeof(buf), "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+    } else if (state->brew_temp > 0.0f) {
+        snprintf(buf, sizeof(buf), "%.1f°", state->brew_temp);
+    } else {
+        buf[0] = '\0';
+    }
+    lv_label_set_text(status_line_label, buf);
+}
+
 // =============================================================================
 // Screen Creation
 // =============================================================================
@@ -98,8 +146,8 @@ lv_obj_t* screen_idle_create(void) {
     // === Connection status indicators at top ===
     status_container = lv_obj_create(container);
     lv_obj_remove_style_all(status_container);
-    lv_obj_set_size(status_container, 120, 24);
-    lv_obj_align(status_container, LV_ALIGN_TOP_MID, 0, 55);
+    lv_obj_set_size(status_container, GEO_X(120), GEO_Y(24));
+    lv_obj_align(status_container, LV_ALIGN_TOP_MID, 0, GEO_Y(55));
     lv_obj_set_flex_flow(status_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(status_container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -125,7 +173,7 @@ lv_obj_t* screen_idle_create(void) {
     
     // === Decorative arc ring ===
     lv_obj_t* arc_ring = lv_arc_create(container);
-    lv_obj_set_size(arc_ring, 300, 300);
+    lv_obj_set_size(arc_ring, GEO_X(300), GEO_Y(300));
     lv_obj_center(arc_ring);
     lv_arc_set_range(arc_ring, 0, 100);
     lv_arc_set_value(arc_ring, 100);
@@ -142,7 +190,7 @@ lv_obj_t* screen_idle_create(void) {
     lv_label_set_text(power_icon, LV_SYMBOL_POWER);
     lv_obj_set_style_text_font(power_icon, FONT_XLARGE, 0);
     lv_obj_set_style_text_color(power_icon, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(power_icon, LV_ALIGN_CENTER, 0, -60);
+    lv_obj_align(power_icon, LV_ALIGN_CENTER, 0, GEO_Y(-60));
     
     // Subtle pulse animation
     lv_anim_t anim;
@@ -162,26 +210,26 @@ lv_obj_t* screen_idle_create(void) {
     lv_label_set_text(mode_name_label, power_mode_names[selected_index]);
     lv_obj_set_style_text_font(mode_name_label, FONT_HUGE, 0);
     lv_obj_set_style_text_color(mode_name_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(mode_name_label, LV_ALIGN_CENTER, 0, 10);
+    lv_obj_align(mode_name_label, LV_ALIGN_CENTER, 0, GEO_Y(10));
     
     // === Power Mode Description ===
     mode_desc_label = lv_label_create(container);
     lv_label_set_text(mode_desc_label, power_mode_descriptions[selected_index]);
     lv_obj_set_style_text_font(mode_desc_label, FONT_NORMAL, 0);
     lv_obj_set_style_text_color(mode_desc_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(mode_desc_label, LV_ALIGN_CENTER, 0, 50);
+    lv_obj_align(mode_desc_label, LV_ALIGN_CENTER, 0, GEO_Y(50));
     
     // === Dots indicator ===
     dots_container = lv_obj_create(container);
     lv_obj_remove_style_all(dots_container);
-    lv_obj_set_size(dots_container, POWER_MODE_COUNT * 28, 16);
-    lv_obj_align(dots_container, LV_ALIGN_CENTER, 0, 90);
+    lv_obj_set_size(dots_container, POWER_MODE_COUNT * 28, GEO_Y(16));
+    lv_obj_align(dots_container, LV_ALIGN_CENTER, 0, GEO_Y(90));
     lv_obj_set_flex_flow(dots_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(dots_container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     for (int i = 0; i < POWER_MODE_COUNT; i++) {
         mode_dots[i] = lv_obj_create(dots_container);
-        lv_obj_set_size(mode_dots[i], 10, 10);
+        lv_obj_set_size(mode_dots[i], GEO_X(10), GEO_Y(10));
         lv_obj_set_style_radius(mode_dots[i], LV_RADIUS_CIRCLE, 0);
         lv_obj_set_style_border_width(mode_dots[i], 0, 0);
         lv_obj_set_style_pad_left(mode_dots[i], 5, 0);
@@ -199,8 +247,18 @@ lv_obj_t* screen_idle_create(void) {
     lv_label_set_text(hint_label, "Press to start  •  Rotate to select");
     lv_obj_set_style_text_font(hint_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(hint_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, -60);
-    
+    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, GEO_BOTTOM_BAND_Y);
+
+    // === Live status line (clock + brew temp) ===
+    // The single updating region in deep idle; see update_status_line()
+    status_line_label = lv_label_create(container);
+    lv_label_set_text(status_line_label, "");
+    lv_obj_set_style_text_font(status_line_label, FONT_SMALL, 0);
+    lv_obj_set_style_text_color(status_line_label, COLOR_TEXT_MUTED, 0);
+    lv_obj_align(status_line_label, LV_ALIGN_BOTTOM_MID, 0, GEO_Y(-30));
+    cached_clock_minute = -1;
+    cached_status_temp_d = INT32_MIN;
+
     // === Make screen focusable for encoder input ===
     lv_group_t* group = lv_group_get_default();
     if (group) {
@@ -234,11 +292,12 @@ lv_obj_t* screen_idle_create(void) {
 void screen_idle_update(const ui_state_t* state) {
     if (!screen || !state) return;
     
-    // Update power mode visibility based on machine type
-    bool is_dual_boiler = (state->machine_type == 0 || state->machine_type == 1);
-    
-    if (show_power_modes != is_dual_boiler) {
-        screen_idle_set_show_strategies(is_dual_boiler);
+    // Update power mode visibility based on machine type: strategy
+    // selection only makes sense with two heaters to sequence
+    bool has_strategies = machine_has_separate_steam_heater(state->machine_type);
+
+    if (show_power_modes != has_strategies) {
+        screen_idle_set_show_strategies(has_strategies);
     }
     
     // Update connection indicators
@@ -252,6 +311,20 @@ void screen_idle_update(const ui_state_t* state) {
         cached_cloud_connected = state->cloud_connected;
         update_connection_indicators();
     }
+
+    // The only periodic refresh on this screen
+    update_status_line(state);
+}
+
+bool screen_idle_clock_due(void) {
+    if (!screen || !status_line_label) return false;
+
+    time_t now = time(nullptr);
+    if (now <= CLOCK_VALID_EPOCH) return false;
+
+    struct tm timeinfo;
+    if (!localtime_r(&now, &timeinfo)) return false;
+    return (timeinfo.tm_hour * 60 + timeinfo.tm_min) != cached_clock_minute;
 }
 
 void screen_idle_select_power_mode(int index) {
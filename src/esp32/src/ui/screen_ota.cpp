@@ -8,6 +8,7 @@
 #include "ui/screen_ota.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -31,7 +32,7 @@ lv_obj_t* screen_ota_create(void) {
     lv_label_set_text(title, "UPDATING");
     lv_obj_set_style_text_font(title, FONT_HUGE, 0);
     lv_obj_set_style_text_color(title, COLOR_ACCENT_PRIMARY, 0);
-    lv_obj_align(title, LV_ALIGN_CENTER, 0, -80);
+    lv_obj_align(title, LV_ALIGN_CENTER, 0, GEO_Y(-80));
     
     // OTA message label (will be updated when OTA is set)
     lv_obj_t* msg_label = lv_label_create(screen);
@@ -40,14 +41,14 @@ lv_obj_t* screen_ota_create(void) {
     lv_obj_set_style_text_color(msg_label, COLOR_TEXT_PRIMARY, 0);
     lv_obj_set_style_text_align(msg_label, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_set_width(msg_label, DISPLAY_WIDTH - 80);
-    lv_obj_align(msg_label, LV_ALIGN_CENTER, 0, -20);
+    lv_obj_align(msg_label, LV_ALIGN_CENTER, 0, GEO_Y(-20));
     
     // Progress indicator (animated dots)
     lv_obj_t* progress_label = lv_label_create(screen);
     lv_label_set_text(progress_label, "...");
     lv_obj_set_style_text_font(progress_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(progress_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(progress_label, LV_ALIGN_CENTER, 0, 40);
+    lv_obj_align(progress_label, LV_ALIGN_CENTER, 0, GEO_Y(40));
     
     // Store label pointers for updates (using user_data)
     lv_obj_set_user_data(msg_label, (void*)1);      // Mark as message label
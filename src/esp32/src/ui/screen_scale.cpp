@@ -8,6 +8,7 @@
 #include "ui/screen_scale.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 #include "scale/scale_manager.h"
 
 // Static elements
@@ -47,33 +48,33 @@ lv_obj_t* screen_scale_create(void) {
     lv_label_set_text(title_label, "Bluetooth Scale");
     lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 60);
+    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, GEO_TOP_BAND_Y);
     
     // Status icon (Bluetooth symbol)
     status_icon = lv_label_create(screen);
     lv_label_set_text(status_icon, LV_SYMBOL_BLUETOOTH);
     lv_obj_set_style_text_font(status_icon, &lv_font_montserrat_48, 0);
     lv_obj_set_style_text_color(status_icon, COLOR_INFO, 0);
-    lv_obj_align(status_icon, LV_ALIGN_TOP_MID, 0, 100);
+    lv_obj_align(status_icon, LV_ALIGN_TOP_MID, 0, GEO_Y(100));
     
     // Status label
     status_label = lv_label_create(screen);
     lv_label_set_text(status_label, "No scale connected");
     lv_obj_set_style_text_font(status_label, FONT_NORMAL, 0);
     lv_obj_set_style_text_color(status_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(status_label, LV_ALIGN_TOP_MID, 0, 160);
+    lv_obj_align(status_label, LV_ALIGN_TOP_MID, 0, GEO_Y(160));
     
     // Weight display (shown when connected)
     weight_label = lv_label_create(screen);
     lv_label_set_text(weight_label, "0.0g");
     lv_obj_set_style_text_font(weight_label, &lv_font_montserrat_48, 0);
     lv_obj_set_style_text_color(weight_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(weight_label, LV_ALIGN_CENTER, 0, -20);
+    lv_obj_align(weight_label, LV_ALIGN_CENTER, 0, GEO_Y(-20));
     lv_obj_add_flag(weight_label, LV_OBJ_FLAG_HIDDEN);
     
     // Spinner (shown during scan/connect)
     spinner = lv_spinner_create(screen, 1000, 60);
-    lv_obj_set_size(spinner, 50, 50);
+    lv_obj_set_size(spinner, GEO_X(50), GEO_Y(50));
     lv_obj_align(spinner, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_arc_color(spinner, COLOR_INFO, LV_PART_INDICATOR);
     lv_obj_set_style_arc_color(spinner, COLOR_BG_ELEVATED, LV_PART_MAIN);
@@ -81,8 +82,8 @@ lv_obj_t* screen_scale_create(void) {
     
     // Scale list (for discovered devices)
     scale_list = lv_obj_create(screen);
-    lv_obj_set_size(scale_list, 280, 180);
-    lv_obj_align(scale_list, LV_ALIGN_CENTER, 0, 20);
+    lv_obj_set_size(scale_list, GEO_X(280), GEO_Y(180));
+    lv_obj_align(scale_list, LV_ALIGN_CENTER, 0, GEO_Y(20));
     lv_obj_set_style_bg_color(scale_list, COLOR_BG_CARD, 0);
     lv_obj_set_style_radius(scale_list, 12, 0);
     lv_obj_set_style_border_width(scale_list, 0, 0);
@@ -93,8 +94,8 @@ lv_obj_t* screen_scale_create(void) {
     
     // Action button
     action_btn = lv_btn_create(screen);
-    lv_obj_set_size(action_btn, 160, 44);
-    lv_obj_align(action_btn, LV_ALIGN_CENTER, 0, 60);
+    lv_obj_set_size(action_btn, GEO_X(160), GEO_Y(44));
+    lv_obj_align(action_btn, LV_ALIGN_CENTER, 0, GEO_Y(60));
     lv_obj_set_style_bg_color(action_btn, COLOR_INFO, 0);
     lv_obj_set_style_radius(action_btn, 22, 0);
     
@@ -109,7 +110,7 @@ lv_obj_t* screen_scale_create(void) {
     lv_obj_set_style_text_font(hint_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(hint_label, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_align(hint_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, -60);
+    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, GEO_BOTTOM_BAND_Y);
     
     // Initialize state
     current_state = SCALE_SCREEN_IDLE;
@@ -235,7 +236,7 @@ static void update_list(void) {
 
 static void create_list_item(const scale_info_t& info, int index) {
     lv_obj_t* item = lv_obj_create(scale_list);
-    lv_obj_set_size(item, 260, 40);
+    lv_obj_set_size(item, GEO_X(260), GEO_Y(40));
     lv_obj_set_style_bg_color(item, index == selected_index ? COLOR_BG_ELEVATED : COLOR_BG_CARD, 0);
     lv_obj_set_style_radius(item, 8, 0);
     lv_obj_set_style_border_width(item, index == selected_index ? 1 : 0, 0);
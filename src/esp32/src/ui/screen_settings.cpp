@@ -10,6 +10,7 @@
 #include "ui/screen_settings.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 // Menu items with icons, names, and descriptions
 static const char* item_icons[] = {
@@ -235,11 +236,11 @@ lv_obj_t* screen_settings_create(void) {
     lv_label_set_text(title_label, "Settings");
     lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 50);
+    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, GEO_Y(50));
     
     // === Selection Arc (outer ring showing position) ===
     selector_arc = lv_arc_create(container);
-    lv_obj_set_size(selector_arc, 420, 420);
+    lv_obj_set_size(selector_arc, GEO_X(420), GEO_Y(420));
     lv_obj_center(selector_arc);
     lv_arc_set_range(selector_arc, 0, SETTINGS_COUNT);
     lv_arc_set_value(selector_arc, 1);
@@ -263,40 +264,40 @@ lv_obj_t* screen_settings_create(void) {
     lv_label_set_text(icon_label, item_icons[selected_index]);
     lv_obj_set_style_text_font(icon_label, FONT_TEMP, 0);
     lv_obj_set_style_text_color(icon_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(icon_label, LV_ALIGN_CENTER, 0, -50);
+    lv_obj_align(icon_label, LV_ALIGN_CENTER, 0, GEO_Y(-50));
     
     // === Item Name ===
     name_label = lv_label_create(container);
     lv_label_set_text(name_label, item_names[selected_index]);
     lv_obj_set_style_text_font(name_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(name_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(name_label, LV_ALIGN_CENTER, 0, 10);
+    lv_obj_align(name_label, LV_ALIGN_CENTER, 0, GEO_Y(10));
     
     // === Current Value (for temps and BBW) ===
     value_label = lv_label_create(container);
     lv_label_set_text(value_label, "");
     lv_obj_set_style_text_font(value_label, FONT_LARGE, 0);  // Larger font for better visibility
     lv_obj_set_style_text_color(value_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(value_label, LV_ALIGN_CENTER, 0, 40);
+    lv_obj_align(value_label, LV_ALIGN_CENTER, 0, GEO_Y(40));
     
     // === Description ===
     desc_label = lv_label_create(container);
     lv_label_set_text(desc_label, item_descriptions[selected_index]);
     lv_obj_set_style_text_font(desc_label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(desc_label, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(desc_label, LV_ALIGN_CENTER, 0, 75);
+    lv_obj_align(desc_label, LV_ALIGN_CENTER, 0, GEO_Y(75));
     
     // === Page dots at bottom ===
     lv_obj_t* dots_container = lv_obj_create(container);
     lv_obj_remove_style_all(dots_container);
-    lv_obj_set_size(dots_container, SETTINGS_COUNT * 18, 12);
-    lv_obj_align(dots_container, LV_ALIGN_BOTTOM_MID, 0, -60);
+    lv_obj_set_size(dots_container, SETTINGS_COUNT * 18, GEO_Y(12));
+    lv_obj_align(dots_container, LV_ALIGN_BOTTOM_MID, 0, GEO_BOTTOM_BAND_Y);
     lv_obj_set_flex_flow(dots_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(dots_container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     for (int i = 0; i < SETTINGS_COUNT; i++) {
         status_icons[i] = lv_obj_create(dots_container);
-        lv_obj_set_size(status_icons[i], 6, 6);
+        lv_obj_set_size(status_icons[i], GEO_X(6), GEO_Y(6));
         lv_obj_set_style_radius(status_icons[i], LV_RADIUS_CIRCLE, 0);
         lv_obj_set_style_border_width(status_icons[i], 0, 0);
         lv_obj_set_style_pad_left(status_icons[i], 3, 0);
@@ -314,7 +315,7 @@ lv_obj_t* screen_settings_create(void) {
     lv_label_set_text(hint, "Rotate to browse • Press to select");
     lv_obj_set_style_text_font(hint, FONT_SMALL, 0);
     lv_obj_set_style_text_color(hint, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -80);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, GEO_Y(-80));
     
     // Update initial value display
     update_value_display();
@@ -9,6 +9,7 @@
 #include "ui/screen_setup.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 #include "config.h"
 
 // Static elements
@@ -37,19 +38,19 @@ lv_obj_t* screen_setup_create(void) {
     lv_label_set_text(wifi_icon, LV_SYMBOL_WIFI);
     lv_obj_set_style_text_font(wifi_icon, FONT_XLARGE, 0);
     lv_obj_set_style_text_color(wifi_icon, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(wifi_icon, LV_ALIGN_CENTER, 0, -140);
+    lv_obj_align(wifi_icon, LV_ALIGN_CENTER, 0, GEO_Y(-140));
     
     // === Title ===
     title_label = lv_label_create(screen);
     lv_label_set_text(title_label, "WiFi Setup");
     lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
     lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, -90);
+    lv_obj_align(title_label, LV_ALIGN_CENTER, 0, GEO_Y(-90));
     
     // === Compact Card for credentials ===
     lv_obj_t* card = lv_obj_create(screen);
-    lv_obj_set_size(card, 280, 130);
-    lv_obj_align(card, LV_ALIGN_CENTER, 0, 10);
+    lv_obj_set_size(card, GEO_X(280), GEO_Y(130));
+    lv_obj_align(card, LV_ALIGN_CENTER, 0, GEO_Y(10));
     lv_obj_set_style_bg_color(card, COLOR_BG_CARD, 0);
     lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
     lv_obj_set_style_radius(card, RADIUS_NORMAL, 0);
@@ -79,7 +80,7 @@ lv_obj_t* screen_setup_create(void) {
     lv_obj_t* pass_row = lv_obj_create(card);
     lv_obj_remove_style_all(pass_row);
     lv_obj_set_size(pass_row, lv_pct(100), 32);
-    lv_obj_align(pass_row, LV_ALIGN_TOP_MID, 0, 36);
+    lv_obj_align(pass_row, LV_ALIGN_TOP_MID, 0, GEO_Y(36));
     lv_obj_set_flex_flow(pass_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(pass_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -97,7 +98,7 @@ lv_obj_t* screen_setup_create(void) {
     lv_obj_t* ip_row = lv_obj_create(card);
     lv_obj_remove_style_all(ip_row);
     lv_obj_set_size(ip_row, lv_pct(100), 32);
-    lv_obj_align(ip_row, LV_ALIGN_TOP_MID, 0, 72);
+    lv_obj_align(ip_row, LV_ALIGN_TOP_MID, 0, GEO_Y(72));
     lv_obj_set_flex_flow(ip_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(ip_row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -114,14 +115,14 @@ lv_obj_t* screen_setup_create(void) {
     // === Status at bottom ===
     lv_obj_t* status_container = lv_obj_create(screen);
     lv_obj_remove_style_all(status_container);
-    lv_obj_set_size(status_container, 240, 30);
-    lv_obj_align(status_container, LV_ALIGN_CENTER, 0, 120);
+    lv_obj_set_size(status_container, GEO_X(240), GEO_Y(30));
+    lv_obj_align(status_container, LV_ALIGN_CENTER, 0, GEO_Y(120));
     lv_obj_set_flex_flow(status_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(status_container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
     // Spinner
     spinner = lv_spinner_create(status_container, 1000, 60);
-    lv_obj_set_size(spinner, 20, 20);
+    lv_obj_set_size(spinner, GEO_X(20), GEO_Y(20));
     lv_obj_set_style_arc_color(spinner, COLOR_ACCENT_AMBER, LV_PART_INDICATOR);
     lv_obj_set_style_arc_color(spinner, COLOR_BG_ELEVATED, LV_PART_MAIN);
     lv_obj_set_style_arc_width(spinner, 3, 0);
@@ -9,6 +9,7 @@
 #include "ui/logo_splash.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 
 static lv_obj_t* screen = nullptr;
 
@@ -30,7 +31,7 @@ lv_obj_t* screen_splash_create(void) {
     // Display embedded logo image (converted to C array)
     lv_obj_t* logo = lv_img_create(container);
     lv_img_set_src(logo, &logo_splash_img);
-    lv_obj_align(logo, LV_ALIGN_CENTER, 0, -20); // Slightly above center
+    lv_obj_align(logo, LV_ALIGN_CENTER, 0, GEO_Y(-20)); // Slightly above center
     
     // Loading text
     lv_obj_t* label = lv_label_create(container);
@@ -38,7 +39,7 @@ lv_obj_t* screen_splash_create(void) {
     lv_obj_set_style_text_font(label, FONT_SMALL, 0);
     lv_obj_set_style_text_color(label, COLOR_TEXT_MUTED, 0);
     lv_obj_set_style_text_letter_space(label, 2, 0);
-    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -30);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, GEO_Y(-30));
     
     return screen;
 }
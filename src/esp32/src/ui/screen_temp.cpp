@@ -8,6 +8,8 @@
 #include "ui/screen_temp.h"
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
+#include "machine_features.h"
 
 // Static elements
 static lv_obj_t* screen = nullptr;
@@ -114,14 +116,13 @@ lv_obj_t* screen_temp_create(void) {
     // Title
     title_label = lv_label_create(screen);
     lv_label_set_text(title_label, "Temperature");
-    lv_obj_set_style_text_font(title_label, FONT_LARGE, 0);
-    lv_obj_set_style_text_color(title_label, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 60);
+    theme_apply_label_style(title_label, THEME_LABEL_TITLE);
+    lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, GEO_TOP_BAND_Y);
     
     // Brew temperature card
     brew_card = lv_obj_create(screen);
-    lv_obj_set_size(brew_card, 160, 100);
-    lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, -30);
+    lv_obj_set_size(brew_card, GEO_X(160), GEO_Y(100));
+    lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, GEO_Y(-30));
     lv_obj_set_style_bg_color(brew_card, COLOR_BG_CARD, 0);
     lv_obj_set_style_radius(brew_card, 16, 0);
     lv_obj_set_style_border_color(brew_card, COLOR_BG_ELEVATED, 0);
@@ -131,27 +132,25 @@ lv_obj_t* screen_temp_create(void) {
     
     brew_title_label = lv_label_create(brew_card);
     lv_label_set_text(brew_title_label, "BREW");
-    lv_obj_set_style_text_font(brew_title_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(brew_title_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(brew_title_label, THEME_LABEL_CAPTION);
     lv_obj_set_style_text_letter_space(brew_title_label, 2, 0);
     lv_obj_align(brew_title_label, LV_ALIGN_TOP_MID, 0, 0);
     
     brew_sp_label = lv_label_create(brew_card);
     lv_label_set_text(brew_sp_label, "93.0°C");
-    lv_obj_set_style_text_font(brew_sp_label, &lv_font_montserrat_48, 0);
+    theme_apply_label_style(brew_sp_label, THEME_LABEL_BIG_DIGITS);
     lv_obj_set_style_text_color(brew_sp_label, COLOR_ACCENT_AMBER, 0);
-    lv_obj_align(brew_sp_label, LV_ALIGN_CENTER, 0, 8);
+    lv_obj_align(brew_sp_label, LV_ALIGN_CENTER, 0, GEO_Y(8));
     
     brew_temp_label = lv_label_create(brew_card);
     lv_label_set_text(brew_temp_label, "Current: --.-°C");
-    lv_obj_set_style_text_font(brew_temp_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(brew_temp_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(brew_temp_label, THEME_LABEL_CAPTION);
     lv_obj_align(brew_temp_label, LV_ALIGN_BOTTOM_MID, 0, 0);
     
     // Steam temperature card
     steam_card = lv_obj_create(screen);
-    lv_obj_set_size(steam_card, 160, 100);
-    lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, 90);
+    lv_obj_set_size(steam_card, GEO_X(160), GEO_Y(100));
+    lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, GEO_Y(90));
     lv_obj_set_style_bg_color(steam_card, COLOR_BG_CARD, 0);
     lv_obj_set_style_radius(steam_card, 16, 0);
     lv_obj_set_style_border_color(steam_card, COLOR_BG_ELEVATED, 0);
@@ -161,30 +160,27 @@ lv_obj_t* screen_temp_create(void) {
     
     steam_title_label = lv_label_create(steam_card);
     lv_label_set_text(steam_title_label, "STEAM");
-    lv_obj_set_style_text_font(steam_title_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(steam_title_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(steam_title_label, THEME_LABEL_CAPTION);
     lv_obj_set_style_text_letter_space(steam_title_label, 2, 0);
     lv_obj_align(steam_title_label, LV_ALIGN_TOP_MID, 0, 0);
     
     steam_sp_label = lv_label_create(steam_card);
     lv_label_set_text(steam_sp_label, "145.0°C");
-    lv_obj_set_style_text_font(steam_sp_label, &lv_font_montserrat_48, 0);
+    theme_apply_label_style(steam_sp_label, THEME_LABEL_BIG_DIGITS);
     lv_obj_set_style_text_color(steam_sp_label, COLOR_ACCENT_ORANGE, 0);
-    lv_obj_align(steam_sp_label, LV_ALIGN_CENTER, 0, 8);
+    lv_obj_align(steam_sp_label, LV_ALIGN_CENTER, 0, GEO_Y(8));
     
     steam_temp_label = lv_label_create(steam_card);
     lv_label_set_text(steam_temp_label, "Current: --.-°C");
-    lv_obj_set_style_text_font(steam_temp_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(steam_temp_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(steam_temp_label, THEME_LABEL_CAPTION);
     lv_obj_align(steam_temp_label, LV_ALIGN_BOTTOM_MID, 0, 0);
     
     // Hint label
     hint_label = lv_label_create(screen);
     lv_label_set_text(hint_label, "Rotate to select • Press to edit\nLong press to exit");
-    lv_obj_set_style_text_font(hint_label, FONT_SMALL, 0);
-    lv_obj_set_style_text_color(hint_label, COLOR_TEXT_MUTED, 0);
+    theme_apply_label_style(hint_label, THEME_LABEL_CAPTION);
     lv_obj_set_style_text_align(hint_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, -60);
+    lv_obj_align(hint_label, LV_ALIGN_BOTTOM_MID, 0, GEO_BOTTOM_BAND_Y);
     
     // Initialize state
     current_mode = TEMP_EDIT_NONE;
@@ -201,31 +197,30 @@ lv_obj_t* screen_temp_create(void) {
 void screen_temp_update(const ui_state_t* state) {
     if (!state || !screen) return;
     
-    // Update labels if machine type changed
-    // machine_type: 0=unknown, 1=dual_boiler, 2=single_boiler, 3=heat_exchanger
+    // Update labels if machine type changed (predicates from machine_features.h)
     if (cached_machine_type != state->machine_type) {
         cached_machine_type = state->machine_type;
-        
-        if (state->machine_type == 2) {  // Single boiler
+
+        if (machine_needs_mode_switching(state->machine_type)) {  // Single boiler
             lv_label_set_text(brew_title_label, "BOILER");
             // Hide steam card for single boiler
             lv_obj_add_flag(steam_card, LV_OBJ_FLAG_HIDDEN);
             // Reposition brew card to center
-            lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, 30);
-        } else if (state->machine_type == 3) {  // Heat exchanger
+            lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, GEO_Y(30));
+        } else if (machine_steam_provides_brew_heat(state->machine_type)) {  // Heat exchanger
             // HX: show only steam boiler (controls HX)
             lv_obj_add_flag(brew_card, LV_OBJ_FLAG_HIDDEN);
             lv_label_set_text(steam_title_label, "BOILER");
             // Reposition steam card to center
-            lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, 30);
+            lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, GEO_Y(30));
         } else {  // Dual boiler or unknown - show both
             lv_label_set_text(brew_title_label, "BREW");
             lv_label_set_text(steam_title_label, "STEAM");
             lv_obj_clear_flag(brew_card, LV_OBJ_FLAG_HIDDEN);
             lv_obj_clear_flag(steam_card, LV_OBJ_FLAG_HIDDEN);
             // Reset positions
-            lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, -30);
-            lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, 90);
+            lv_obj_align(brew_card, LV_ALIGN_CENTER, 0, GEO_Y(-30));
+            lv_obj_align(steam_card, LV_ALIGN_CENTER, 0, GEO_Y(90));
         }
     }
     
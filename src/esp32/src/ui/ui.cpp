@@ -24,10 +24,12 @@
 #endif
 #include "display/theme.h"
 #include "display/display_config.h"
+#include "display/display_geometry.h"
 #ifndef SIMULATOR
 #include "display/display.h"
 #endif
 #include "state/state_manager.h"
+#include "utils/status_change_detector.h"
 
 // Global UI instance
 UI ui;
@@ -39,6 +41,69 @@ static float last_brew_weight = 0;
 static bool last_alarm_state = false;  // Track previous alarm state for debouncing
 static uint32_t last_alarm_change_time = 0;  // Timestamp of last alarm state change
 
+// Change detector gating the per-screen widget updates. The UI runs on the
+// same core as the network stack, so skipping update passes where nothing
+// the active screen renders has changed saves real CPU.
+static StatusChangeDetector change_detector;
+static bool force_screen_refresh = true;  // Repopulate after screen create/switch
+
+/**
+ * Which ChangedFields bits the given screen renders
+ *
+ * Screens not listed here (complete, cloud, alarm, OTA, splash) are
+ * event-driven - their content is set when shown, so the periodic
+ * update pass has nothing to do for them.
+ */
+static bool screen_fields_changed(screen_id_t screen, const ChangedFields& f) {
+    switch (screen) {
+        case SCREEN_SETUP:
+            return f.wifi || f.connections;
+        case SCREEN_IDLE:
+            // Deliberately minimal: the idle screen renders one live status
+            // line (clock + brew temp) and the connection icons; everything
+            // else is drawn once at create or on encoder events. Clock
+            // minute ticks are handled separately via screen_idle_clock_due()
+            return f.machine_state || f.temps || f.connections;
+        case SCREEN_HOME:
+            return f.machine_state || f.machine_mode || f.heating_strategy ||
+                   f.is_heating || f.is_brewing || f.temps || f.pressure ||
+                   f.connections || f.water_low || f.cleaning;
+        case SCREEN_BREWING:
+            return f.brew_time || f.scale_weight || f.scale_flow_rate ||
+                   f.target_weight || f.scale_connected || f.pressure ||
+                   f.connections;
+        case SCREEN_SETTINGS:
+        case SCREEN_TEMP_SETTINGS:
+            return f.temps || f.machine_state;
+        case SCREEN_SCALE:
+            return f.scale_weight || f.scale_flow_rate || f.scale_connected ||
+                   f.connections;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Predicted next screen, for ahead-of-time preloading
+ *
+ * Building a widget tree on demand takes 100ms+ for the heavier screens,
+ * which hitches visibly - worst when entering settings mid-shot. Screens
+ * the user is most likely to hop to from the current one are built early
+ * (they live in PSRAM via LVGL's custom allocator) so the eventual switch
+ * is just a pointer swap. SCREEN_COUNT means no prediction.
+ */
+static screen_id_t predicted_next_screen(screen_id_t current) {
+    switch (current) {
+        case SCREEN_SPLASH:   return SCREEN_IDLE;      // Boot path
+        case SCREEN_IDLE:     return SCREEN_HOME;      // Turn-on
+        case SCREEN_HOME:     return SCREEN_SETTINGS;  // Button press
+        case SCREEN_BREWING:  return SCREEN_SETTINGS;  // Long press mid-shot
+        case SCREEN_COMPLETE: return SCREEN_HOME;      // Dismiss
+        case SCREEN_SETTINGS: return SCREEN_HOME;      // Exit
+        default:              return SCREEN_COUNT;
+    }
+}
+
 // =============================================================================
 // UI Manager Implementation
 // =============================================================================
@@ -92,8 +157,14 @@ bool UI::begin() {
 #endif
     }
     LOG_I("Initial screen (SPLASH) loaded");
-    
-    LOG_I("UI initialized - screens will be loaded on demand");
+
+    // Build the home screen while the splash dwells - the boot path to home
+    // then pays a pointer swap instead of a full widget build. (LVGL widget
+    // trees are live object graphs and can't be snapshotted to disk; moving
+    // the build under the splash buys the same first-switch latency win.)
+    ensureScreenExists(SCREEN_HOME);
+
+    LOG_I("UI initialized - remaining screens load on demand");
     return true;
 }
 
@@ -111,7 +182,20 @@ void UI::update(const ui_state_t& state) {
     
     // Store new state
     _state = state;
-    
+
+#if ENABLE_SCREEN
+    // Frame-pacing governor: relax the LVGL cadence while the machine sits
+    // idle or in eco setback; heating/brewing/alarms (and any user input,
+    // handled in the display driver) get the full frame rate. Eco is part
+    // of the coordinated standby set - see the matching machine-state
+    // checks in scale_manager.cpp and web_server_broadcast.cpp.
+    bool machine_idle = (_state.machine_state == UI_STATE_IDLE ||
+                         _state.machine_state == UI_STATE_INIT ||
+                         _state.machine_state == UI_STATE_ECO) &&
+                        !_state.is_brewing && !_state.alarm_active;
+    display.setIdlePacing(machine_idle);
+#endif
+
     // Auto screen switching based on machine state
     checkAutoScreenSwitch();
     
@@ -142,8 +226,37 @@ void UI::update(const ui_state_t& state) {
     if (_screens[_currentScreen] == nullptr) {
         // Screen doesn't exist - ensure it's created
         ensureScreenExists(_currentScreen);
+        force_screen_refresh = true;
     }
-    
+
+    // Keep the predicted next screen warm so switching to it is a pointer
+    // swap instead of an on-demand widget build
+    screen_id_t predicted = predicted_next_screen(_currentScreen);
+    if (predicted < SCREEN_COUNT && _screens[predicted] == nullptr) {
+        ensureScreenExists(predicted);
+    }
+
+    // Event-driven gating: only run the widget update when a field the
+    // active screen renders has changed since the last pass
+    if (force_screen_refresh) {
+        // Fresh widgets - force every field "changed" so they all populate
+        change_detector.reset();
+        force_screen_refresh = false;
+    }
+    ChangedFields changed;
+    change_detector.hasChanged(state, &changed);
+    bool update_due = screen_fields_changed(_currentScreen, changed);
+
+    // Idle clock: tick once a minute even when no state field moves. The
+    // actual render is still slaved to the frame-pacing governor's relaxed
+    // idle cadence, so deep idle costs one small label redraw a minute
+    if (!update_due && _currentScreen == SCREEN_IDLE) {
+        update_due = screen_idle_clock_due();
+    }
+    if (!update_due) {
+        return;
+    }
+
     // Update current screen
     switch (_currentScreen) {
         case SCREEN_SETUP:
@@ -615,13 +728,13 @@ void UI::createScaleScreen() {
     lv_label_set_text(icon, LV_SYMBOL_BLUETOOTH);
     lv_obj_set_style_text_font(icon, &lv_font_montserrat_48, 0);
     lv_obj_set_style_text_color(icon, COLOR_INFO, 0);
-    lv_obj_align(icon, LV_ALIGN_CENTER, 0, -30);
+    lv_obj_align(icon, LV_ALIGN_CENTER, 0, GEO_Y(-30));
     
     lv_obj_t* label = lv_label_create(_screens[SCREEN_SCALE]);
     lv_label_set_text(label, "Scale Pairing\n(Simulator)");
     lv_obj_set_style_text_color(label, COLOR_TEXT_PRIMARY, 0);
     lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(label, LV_ALIGN_CENTER, 0, 30);
+    lv_obj_align(label, LV_ALIGN_CENTER, 0, GEO_Y(30));
 #endif
 }
 
@@ -713,8 +826,9 @@ bool UI::ensureScreenExists(screen_id_t screen) {
         return true;
     }
     
-    // Create the screen
-    LOG_I("Creating screen: %d", screen);
+    // Create the screen (timed - widget builds are the dominant UI latency,
+    // so construction cost per screen belongs in the boot/runtime log)
+    uint32_t buildStart = millis();
     switch (screen) {
         case SCREEN_SETUP:
             createSetupScreen();
@@ -762,7 +876,8 @@ bool UI::ensureScreenExists(screen_id_t screen) {
         LOG_E("Screen creation failed: %d", screen);
         return false;
     }
-    
+    LOG_I("Screen %d built in %lu ms", screen, (unsigned long)(millis() - buildStart));
+
     // Yield after screen creation to allow network operations
     yield();
     
@@ -802,11 +917,18 @@ void UI::switchToScreen(screen_id_t screen) {
     
     // Save old screen info before switching
     screen_id_t oldScreen = _currentScreen;
-    lv_obj_t* oldScreenObj = _screens[oldScreen];
-    
+
     // Update screen tracking
     _previousScreen = _currentScreen;
     _currentScreen = screen;
+
+    // New screen starts with empty widgets - next update must populate them
+    force_screen_refresh = true;
+
+#if ENABLE_SCREEN
+    // Attribute refresh cycles to the new screen (flush instrumentation)
+    display.setActiveScreenId((uint8_t)screen);
+#endif
     
     // Reset settings screen state when entering it
     // This ensures editing modes are cleared from previous visits
@@ -818,9 +940,14 @@ void UI::switchToScreen(screen_id_t screen) {
     // LVGL crashes if you delete the active screen without loading another first
     lv_scr_load(_screens[screen]);
     
-    // Destroy the old screen to free memory (unless it's the same as new screen)
-    if (oldScreen != screen && oldScreenObj != nullptr) {
-        destroyScreen(oldScreen);
+    // Free screens we no longer expect to need. The old screen survives
+    // when it's the predicted next hop from here (settings <-> home
+    // bouncing), and stale preloads from earlier predictions are dropped.
+    screen_id_t keep = predicted_next_screen(screen);
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        if (i != screen && i != keep && _screens[i] != nullptr) {
+            destroyScreen((screen_id_t)i);
+        }
     }
     
     // Focus an object on the new screen (for encoder navigation)
@@ -841,7 +968,7 @@ void UI::switchToScreen(screen_id_t screen) {
         }
     }
     
-    LOG_I("Switched to screen: %d (destroyed previous: %d)", screen, oldScreen);
+    LOG_I("Switched to screen: %d (from: %d)", screen, oldScreen);
 }
 
 // =============================================================================
@@ -1033,7 +1160,8 @@ void UI::rebuildScreens() {
         }
     }
     
-    // 3. Refresh data on the new screen
+    // 3. Refresh data on the new screen (force: widgets were rebuilt)
+    force_screen_refresh = true;
     update(_state);
     
     LOG_I("Screens rebuilt");
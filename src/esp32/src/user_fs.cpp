@@ -0,0 +1,37 @@
+#include "user_fs.h"
+#include <esp_partition.h>
+
+// Partition label in partitions_*.csv. Older tables don't have it - see
+// the fallback notes in user_fs.h.
+static const char* USERDATA_LABEL = "userdata";
+
+static fs::LittleFSFS g_userFs;
+static bool g_dedicated = false;
+
+bool userFsBegin(bool formatOnFail) {
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, USERDATA_LABEL);
+
+    if (part) {
+        // 6 max open files: log stream + stats + journal + headroom
+        g_dedicated = g_userFs.begin(formatOnFail, "/userdata", 6, USERDATA_LABEL);
+        if (g_dedicated) {
+            return true;
+        }
+        // Mount failed and we may not format (panic context) - fall through
+        // to the shared FS so the data still lands somewhere
+    }
+
+    // Legacy table (or failed dedicated mount): hot files share the asset
+    // partition like they always did. begin() on an already-mounted FS is
+    // a no-op returning true, so this is safe from any context.
+    return LittleFS.begin(formatOnFail, "/littlefs", 10);
+}
+
+fs::LittleFSFS& userFS() {
+    return g_dedicated ? g_userFs : LittleFS;
+}
+
+bool userFsIsDedicated() {
+    return g_dedicated;
+}
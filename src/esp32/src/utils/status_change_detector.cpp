@@ -4,6 +4,7 @@
 
 #include "utils/status_change_detector.h"
 #include "log_manager.h"
+#include "machine_features.h"
 #include <string.h>
 #include <math.h>
 
@@ -72,11 +73,14 @@ ChangedFields StatusChangeDetector::getChangedFields(const ui_state_t& current)
         fields.is_brewing = true;
     }
     
-    // Temperatures - check if any changed
+    // Temperatures - check if any changed. Steam only exists as a separate
+    // reading on machines with a steam boiler; on the rest the field is
+    // dead and shouldn't wake the temps group
+    bool hasSteam = machine_has_steam_boiler(current.machine_type);
     if (floatChanged(current.brew_temp, _previous.brew_temp, STATUS_TEMP_THRESHOLD) ||
         floatChanged(current.brew_setpoint, _previous.brew_setpoint, STATUS_TEMP_THRESHOLD) ||
-        floatChanged(current.steam_temp, _previous.steam_temp, STATUS_TEMP_THRESHOLD) ||
-        floatChanged(current.steam_setpoint, _previous.steam_setpoint, STATUS_TEMP_THRESHOLD) ||
+        (hasSteam && floatChanged(current.steam_temp, _previous.steam_temp, STATUS_TEMP_THRESHOLD)) ||
+        (hasSteam && floatChanged(current.steam_setpoint, _previous.steam_setpoint, STATUS_TEMP_THRESHOLD)) ||
         floatChanged(current.group_temp, _previous.group_temp, STATUS_TEMP_THRESHOLD)) {
         fields.temps = true;
     }
@@ -90,7 +94,13 @@ ChangedFields StatusChangeDetector::getChangedFields(const ui_state_t& current)
     if (abs((int)current.power_watts - (int)_previous.power_watts) >= (int)STATUS_POWER_THRESHOLD) {
         fields.power = true;
     }
-    
+
+    // Per-boiler energy (Wh resolution - ticks every few seconds of heating)
+    if (current.brew_energy_wh != _previous.brew_energy_wh ||
+        (hasSteam && current.steam_energy_wh != _previous.steam_energy_wh)) {
+        fields.power = true;
+    }
+
     // Scale weight
     if (floatChanged(current.brew_weight, _previous.brew_weight, STATUS_WEIGHT_THRESHOLD)) {
         fields.scale_weight = true;
@@ -226,11 +236,13 @@ bool StatusChangeDetector::hasChanged(const ui_state_t& current, ChangedFields*
         if (changedFields) changedFields->is_brewing = true;
     }
     
-    // Temperatures - with threshold (grouped as "temps")
+    // Temperatures - with threshold (grouped as "temps"). Steam compares
+    // are skipped on machines without a steam boiler - the field is dead
+    bool hasSteam = machine_has_steam_boiler(current.machine_type);
     if (floatChanged(current.brew_temp, _previous.brew_temp, STATUS_TEMP_THRESHOLD) ||
         floatChanged(current.brew_setpoint, _previous.brew_setpoint, STATUS_TEMP_THRESHOLD) ||
-        floatChanged(current.steam_temp, _previous.steam_temp, STATUS_TEMP_THRESHOLD) ||
-        floatChanged(current.steam_setpoint, _previous.steam_setpoint, STATUS_TEMP_THRESHOLD) ||
+        (hasSteam && floatChanged(current.steam_temp, _previous.steam_temp, STATUS_TEMP_THRESHOLD)) ||
+        (hasSteam && floatChanged(current.steam_setpoint, _previous.steam_setpoint, STATUS_TEMP_THRESHOLD)) ||
         floatChanged(current.group_temp, _previous.group_temp, STATUS_TEMP_THRESHOLD)) {
         changed = true;
         changedField = "temps";
@@ -250,6 +262,14 @@ bool StatusChangeDetector::hasChanged(const ui_state_t& current, ChangedFields*
         changedField = "power";
         if (changedFields) changedFields->power = true;
     }
+
+    // Per-boiler energy (Wh resolution - ticks every few seconds of heating)
+    if (current.brew_energy_wh != _previous.brew_energy_wh ||
+        (hasSteam && current.steam_energy_wh != _previous.steam_energy_wh)) {
+        changed = true;
+        changedField = "power";
+        if (changedFields) changedFields->power = true;
+    }
     
     // Brewing info - always check when brewing
     if (current.is_brewing) {
@@ -0,0 +1,39 @@
+/**
+ * Status String Mappings Implementation
+ */
+
+#include "utils/status_strings.h"
+#include "ui/ui.h"
+
+const char* statusStateString(uint8_t machine_state) {
+    switch (machine_state) {
+        case UI_STATE_INIT:    return "init";
+        case UI_STATE_IDLE:    return "idle";
+        case UI_STATE_HEATING: return "heating";
+        case UI_STATE_READY:   return "ready";
+        case UI_STATE_BREWING: return "brewing";
+        case UI_STATE_FAULT:   return "fault";
+        case UI_STATE_SAFE:    return "safe";
+        case UI_STATE_ECO:     return "eco";
+    }
+    return "unknown";
+}
+
+const char* statusStateStringMqtt(uint8_t machine_state) {
+    // HA templates were written against "standby"; everything else matches
+    // the web contract
+    if (machine_state == UI_STATE_IDLE) {
+        return "standby";
+    }
+    return statusStateString(machine_state);
+}
+
+const char* statusModeString(uint8_t machine_state) {
+    if (machine_state >= UI_STATE_HEATING && machine_state <= UI_STATE_BREWING) {
+        return "on";
+    }
+    if (machine_state == UI_STATE_ECO) {
+        return "eco";
+    }
+    return "standby";
+}
@@ -1,28 +1,55 @@
 #include "web_server.h"
 #include "config.h"
 #include "memory_utils.h"
+#include "request_arena.h"
+#include "psram_pool.h"
+#include "radio_reserve.h"
+#include "trace.h"
+#include "flight_recorder.h"
 #include "pico_uart.h"
 #include "mqtt_client.h"
 #include "brew_by_weight.h"
 #include "scale/scale_manager.h"
 #include "pairing_manager.h"
 #include "cloud_connection.h"
+#include "command_router.h"
 #include "state/state_manager.h"
 #include "statistics/statistics_manager.h"
 #include "power_meter/power_meter_manager.h"
 #include "log_manager.h"
 #include "ui/ui.h"
+#include "display/display.h"
 #include "esp32_diagnostics.h"
+#include "msgpack_helper.h"
+#include "protocol_crc.h"
+#include "boot_report.h"
+#include "shot_capture.h"
+#include "pump_health.h"
+#include "loop_executor.h"
+#include "soft_watchdog.h"
+#include "task_governor.h"
+#include "cloud_config_sync.h"
+#include "temp_history.h"
+#include "fleet_manager.h"
+#include "crash_guard.h"
 #include "wifi_setup_page.h"
+#include "wifi_setup_page_gz.h"
 #include <WiFi.h>
 #include <LittleFS.h>
+#include "user_fs.h"
 #include <HTTPClient.h>
 #include <Update.h>
+#include <esp_cpu.h>
 #include <esp_heap_caps.h>
+#include <mbedtls/gcm.h>
+#include <mbedtls/sha256.h>
+#include <sdkconfig.h>
 #include <esp_partition.h>
+#include <Preferences.h>
 #include <pgmspace.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <memory>
 
 // Deferred WiFi connection state (allows HTTP response to be sent before disconnecting AP)
 static bool _pendingWiFiConnect = false;
@@ -38,12 +65,168 @@ static const unsigned long WIFI_READY_DELAY_MS = 1000;  // Reduced from 5s to 1s
 // Static WebServer pointer for WebSocket callback
 static BrewWebServer* _wsInstance = nullptr;
 
+// =============================================================================
+// Admission control - connection-storm protection
+// When the site network flaps back up, every client (Home Assistant,
+// dashboards, cloud relay) reconnects at once and the resulting burst of
+// JSON handlers can saturate the async TCP task - occasionally tripping the
+// task watchdog. The AdmissionGate is registered ahead of every route: past
+// the per-second admission budget (or under heap pressure) it answers with
+// an immediate 503 + Retry-After instead of letting requests queue behind
+// work the server can't finish. WebSocket/SSE attaches and /api/bootstrap
+// are never shed - one admitted bootstrap replaces the 4-5 REST calls a
+// rejected dashboard would otherwise retry into the same storm.
+// =============================================================================
+
+static const unsigned long ADMIT_WINDOW_MS = 1000;   // Admission budget window
+static const uint16_t ADMIT_MAX_PER_WINDOW = 12;     // Requests admitted per window
+static const size_t ADMIT_MIN_FREE_HEAP = 40 * 1024; // Shed below this regardless of rate
+static const unsigned long STORM_LOG_INTERVAL_MS = 10000;  // Storm log rate limit
+
+class AdmissionGate : public AsyncWebHandler {
+public:
+    explicit AdmissionGate(BrewWebServer& owner) : _owner(owner) {}
+
+    bool canHandle(AsyncWebServerRequest* request) const override {
+        return _owner.shouldShedRequest(request);
+    }
+
+    void handleRequest(AsyncWebServerRequest* request) override {
+        AsyncWebServerResponse* response = request->beginResponse(
+            503, "application/json", "{\"error\":\"Server busy, retry shortly\"}");
+        response->addHeader("Retry-After", "2");
+        request->send(response);
+    }
+
+private:
+    BrewWebServer& _owner;
+};
+
+// =============================================================================
+// Cached responses for hot read-only endpoints
+// Home Assistant polls the stats/schedules endpoints every few seconds per
+// machine, and rebuilding identical JSON on every GET shows up as loop
+// latency. Responses are serialized once per change generation (from
+// StateManager / StatisticsManager) and served from a PSRAM buffer until the
+// generation moves. The generation doubles as the ETag, so pollers sending
+// If-None-Match get a bodyless 304.
+// =============================================================================
+struct CachedJsonResponse {
+    char* buffer = nullptr;   // PSRAM-backed serialized JSON
+    size_t capacity = 0;
+    uint32_t generation = 0;
+    bool valid = false;
+};
+
+static CachedJsonResponse g_statsCache;
+static CachedJsonResponse g_statsExtendedCache;
+static CachedJsonResponse g_schedulesCache;
+
+// Serve the cached copy (or a 304) if it matches the current generation.
+// Returns false if the handler must rebuild the response.
+static bool serveCachedJson(AsyncWebServerRequest* request, CachedJsonResponse& cache,
+                            uint32_t generation) {
+    if (!cache.valid || cache.generation != generation) {
+        return false;
+    }
+
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)cache.generation);
+
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        request->send(response);
+        return true;
+    }
+
+    AsyncWebServerResponse* response = request->beginResponse(200, "application/json", cache.buffer);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return true;
+}
+
+// Store a freshly serialized response for the given generation
+static void storeCachedJson(CachedJsonResponse& cache, uint32_t generation,
+                            const char* json, size_t length) {
+    if (cache.capacity < length + 1) {
+        if (cache.buffer) {
+            free(cache.buffer);
+        }
+        cache.buffer = (char*)heap_caps_malloc(length + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        cache.capacity = cache.buffer ? length + 1 : 0;
+    }
+    if (!cache.buffer) {
+        cache.valid = false;  // No PSRAM - handler keeps serving uncached
+        return;
+    }
+    memcpy(cache.buffer, json, length);
+    cache.buffer[length] = '\0';
+    cache.generation = generation;
+    cache.valid = true;
+}
+
+// Rebuild the cached /api/stats fragment if the stats generation moved.
+// Shared by the /api/stats handler and the /api/bootstrap bundle; returns
+// true when the cache holds a current serialized copy.
+static bool refreshStatsCache() {
+    uint32_t generation = Stats.generation();
+    if (g_statsCache.valid && g_statsCache.generation == generation) {
+        return true;
+    }
+
+    // Fragment-cached rebuild: lifetime/maintenance come from their
+    // cached serialized fragments, only the O(1) period folds are
+    // serialized fresh (see StatisticsManager::fullStatsJson)
+
+    // Histories load lazily after boot; flag partial data and ask the
+    // main task to hydrate (generation bumps when it finishes, so the
+    // cached partial response is replaced on the next query)
+    bool hydrating = !Stats.isHydrated();
+    if (hydrating) {
+        Stats.requestHydration();
+    }
+
+    String json;
+    Stats.fullStatsJson(json, hydrating);
+    if (json.length() == 0) {
+        return false;
+    }
+    storeCachedJson(g_statsCache, generation, json.c_str(), json.length());
+    return g_statsCache.valid;
+}
+
+// Same for the /api/schedules fragment (invalidated by any settings change)
+static bool refreshSchedulesCache() {
+    uint32_t generation = State.settingsGeneration();
+    if (g_schedulesCache.valid && g_schedulesCache.generation == generation) {
+        return true;
+    }
+
+    // Arena-backed rebuild (see /api/stats), learned capacity
+    RequestArenaScope arena;
+    ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_SCHEDULES, 2048));
+    JsonObject obj = doc.to<JsonObject>();
+    State.settings().schedule.toJson(obj);
+
+    size_t jsonSize = measureJson(doc) + 1;
+    char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+    if (!jsonBuffer) {
+        return false;
+    }
+    serializeJson(doc, jsonBuffer, jsonSize);
+    DocSizer::instance().note(ARENA_DOC_SCHEDULES, doc);
+    storeCachedJson(g_schedulesCache, generation, jsonBuffer, jsonSize - 1);
+    return g_schedulesCache.valid;
+}
+
 // Note: All JsonDocument instances should use StaticJsonDocument with stack allocation
 // to avoid PSRAM crashes. Use the pragma pattern from handleGetWiFiNetworks.
 
 BrewWebServer::BrewWebServer(WiFiManager& wifiManager, PicoUART& picoUart, MQTTClient& mqttClient, PairingManager* pairingManager)
     : _server(WEB_SERVER_PORT)
     , _ws("/ws")  // WebSocket on same port 80, endpoint /ws
+    , _events("/api/events")  // SSE fallback, same port
     , _wifiManager(wifiManager)
     , _picoUart(picoUart)
     , _mqttClient(mqttClient)
@@ -73,7 +256,27 @@ void BrewWebServer::begin() {
         }
     });
     _server.addHandler(&_ws);
-    
+
+    // SSE fallback for networks where corporate proxies break WebSocket
+    // upgrades. Fed from the same broadcast scheduler and serialized frames
+    // as the WS path: status frames arrive as base64 MessagePack ("status"
+    // events, SSE id = status sequence), log/event frames as the JSON text
+    // every other local client gets. Nothing is serialized per client.
+    _events.onConnect([this](AsyncEventSourceClient* client) {
+        // Same concurrency cap as WebSocket clients (~4KB queue each)
+        if (_events.count() > 3) {
+            LOG_W("Too many SSE clients (%u), rejecting new client", (unsigned)_events.count());
+            client->close();
+            return;
+        }
+        LOG_I("SSE client connected (lastId %u)", (unsigned)client->lastId());
+        // The local sink may already be "connected" via WS clients, so the
+        // scheduler's reconnect detection won't fire - request a keyframe
+        // explicitly so this client doesn't start from deltas it can't apply
+        _broadcastScheduler.forceKeyframe(BroadcastScheduler::SINK_LOCAL);
+    });
+    _server.addHandler(&_events);
+
     // Start HTTP server
     _server.begin();
     LOG_I("HTTP server started on port %d", WEB_SERVER_PORT);
@@ -113,7 +316,9 @@ void BrewWebServer::setCloudConnection(CloudConnection* cloudConnection) {
 // Static callback wrapper for cloud commands - avoids lambda capture issues
 // Note: Uses const char* instead of String to match CloudConnection::CommandCallback
 static void cloudCommandCallback(const char* type, JsonDocument& doc) {
-    if (_wsInstance) {
+    // Route through the CommandRouter so execution happens on Core 1 (this
+    // runs on the cloud WebSocket task) - inline dispatch only as fallback
+    if (!CommandRouter::post(CMD_SOURCE_CLOUD, type, doc) && _wsInstance) {
         _wsInstance->processCommand(doc);
     }
 }
@@ -163,6 +368,49 @@ bool BrewWebServer::isWiFiReady() {
     return (millis() - _wifiReadyTime) >= WIFI_READY_DELAY_MS;
 }
 
+bool BrewWebServer::shouldShedRequest(AsyncWebServerRequest* request) {
+    unsigned long now = millis();
+
+    // Roll the admission window
+    if (now - _admitWindowStart >= ADMIT_WINDOW_MS) {
+        _admitWindowStart = now;
+        _admitWindowCount = 0;
+    }
+
+    // Priority traffic is never shed: WS/SSE upgrades move the client onto
+    // the broadcast scheduler (one connection instead of polling), and one
+    // bootstrap round trip replaces the REST calls a rejected dashboard
+    // would otherwise retry straight back into the storm
+    const String& url = request->url();
+    bool priority = url == "/ws" || url == "/api/events" || url == "/api/bootstrap";
+
+    bool overloaded = _admitWindowCount >= ADMIT_MAX_PER_WINDOW ||
+                      ESP.getFreeHeap() < ADMIT_MIN_FREE_HEAP;
+
+    if (priority || !overloaded) {
+        _admitWindowCount++;
+        if (_shedding && !overloaded) {
+            _shedding = false;
+            LOG_I("Request storm over - admitting normally (%lu shed total)",
+                  (unsigned long)_requestsShed);
+        }
+        return false;
+    }
+
+    _requestsShed++;
+    if (!_shedding) {
+        _shedding = true;
+        _stormEvents++;
+    }
+    if (now - _lastStormLogMs >= STORM_LOG_INTERVAL_MS) {
+        _lastStormLogMs = now;
+        LOG_W("Request storm: shedding %s (%u admitted this window, heap %u, %lu shed total)",
+              url.c_str(), _admitWindowCount, (unsigned)ESP.getFreeHeap(),
+              (unsigned long)_requestsShed);
+    }
+    return true;
+}
+
 // The React app is served from LittleFS via serveStatic()
 // Users can access it at http://brewos.local after WiFi connects
 
@@ -198,7 +446,9 @@ void BrewWebServer::loop() {
         if (freeHeap >= MIN_HEAP_FOR_STATE_BROADCAST) {
             LOG_I("Cloud: Sending deferred state broadcast (heap=%zu)", freeHeap);
             _pendingCloudStateBroadcast = false;
-            broadcastFullStatus(runtimeState().get());
+            ui_state_t stateSnapshot;
+            runtimeState().snapshot(stateSnapshot);
+            broadcastFullStatus(stateSnapshot);
             broadcastDeviceInfo();
         } else {
             // Still not enough heap, try again in 2 seconds
@@ -209,6 +459,11 @@ void BrewWebServer::loop() {
 }
 
 void BrewWebServer::setupRoutes() {
+    // Admission gate first: handlers match in registration order, so every
+    // route below (and serveStatic) sits behind the storm protection
+    static AdmissionGate admissionGate(*this);
+    _server.addHandler(&admissionGate);
+
     // Simple test endpoint - no LittleFS needed - for diagnosing web server performance
     _server.on("/test", HTTP_GET, [this](AsyncWebServerRequest* request) {
         unsigned long startTime = millis();
@@ -228,9 +483,25 @@ void BrewWebServer::setupRoutes() {
     // HTML is defined in wifi_setup_page.h
     // Uses callback-based chunked streaming to avoid allocating 34KB in RAM
     _server.on("/setup", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        // Serve the build-time gzipped copy when the client accepts it - the
+        // transfer drops from ~34KB to ~11KB, which is the difference between
+        // seconds and sub-second first load on a congested AP channel.
+        // beginResponse_P streams straight from flash with no RAM-side copy.
+        if (request->hasHeader("Accept-Encoding") &&
+            request->header("Accept-Encoding").indexOf("gzip") >= 0) {
+            AsyncWebServerResponse* response = request->beginResponse_P(
+                200, "text/html", WIFI_SETUP_PAGE_GZ, WIFI_SETUP_PAGE_GZ_LEN);
+            if (response) {
+                response->addHeader("Content-Encoding", "gzip");
+                request->send(response);
+                return;
+            }
+            // Fall through to uncompressed path on allocation failure
+        }
+
         size_t htmlLen = strlen_P(WIFI_SETUP_PAGE_HTML);
         size_t freeHeap = ESP.getFreeHeap();
-        
+
         size_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
         LOG_D("Serving WiFi setup page (%zu bytes, free heap: %zu bytes, largest block: %zu bytes)", 
               htmlLen, freeHeap, largestBlock);
@@ -409,93 +680,8 @@ void BrewWebServer::setupRoutes() {
         StaticJsonDocument<1024> doc;
         #pragma GCC diagnostic pop
         
-        // API version - increment ONLY for breaking changes to REST/WebSocket APIs
-        // Web UI checks this to determine compatibility
-        doc["apiVersion"] = 1;
-        
-        // Component versions
-        doc["firmwareVersion"] = ESP32_VERSION;
-        doc["webVersion"] = ESP32_VERSION;  // Web UI bundled with this firmware
-        doc["protocolVersion"] = PROTOCOL_VERSION;
-        
-        // ESP32 build timestamp (for dev builds)
-        char esp32Build[24];
-        snprintf(esp32Build, sizeof(esp32Build), "%s %s", BUILD_DATE, BUILD_TIME);
-        doc["buildDate"] = esp32Build;
-        
-        // Pico version (if connected) - with safety check
-        if (_picoUart.isConnected()) {
-            doc["picoConnected"] = true;
-            // Safely get Pico version - State might not be fully initialized
-            const char* picoVer = State.getPicoVersion();
-            if (picoVer && picoVer[0] != '\0') {
-                doc["picoVersion"] = picoVer;
-            }
-            // Pico build timestamp
-            const char* picoBuild = State.getPicoBuildDate();
-            if (picoBuild && picoBuild[0] != '\0') {
-                doc["picoBuildDate"] = picoBuild;
-            }
-        } else {
-            doc["picoConnected"] = false;
-        }
-        
-        // Mode detection
-        doc["mode"] = "local";
-        doc["apMode"] = _wifiManager.isAPMode();
-        
-        // Feature flags - granular capability detection
-        // Web UI uses these to conditionally show/hide features
-        JsonArray features = doc["features"].to<JsonArray>();
-        
-        // Core features (always available)
-        features.add("temperature_control");
-        features.add("pressure_monitoring");
-        features.add("power_monitoring");
-        
-        // Advanced features
-        features.add("bbw");              // Brew-by-weight
-        features.add("scale");            // BLE scale support
-        features.add("mqtt");             // MQTT integration
-        features.add("eco_mode");         // Eco mode
-        features.add("statistics");       // Statistics tracking
-        features.add("schedules");        // Schedule management
-        
-        // OTA features
-        features.add("pico_ota");         // Pico firmware updates
-        features.add("esp32_ota");        // ESP32 firmware updates
-        
-        // Debug features
-        features.add("debug_console");    // Debug console
-        features.add("protocol_debug");   // Protocol debugging
-        
-        // Device info - get MAC and hostname directly to avoid String allocations
-        // WiFi.macAddress() and WiFi.getHostname() return String, but we copy immediately
-        // to minimize PSRAM exposure
-        uint8_t mac[6];
-        WiFi.macAddress(mac);
-        char macBuf[18];  // MAC address format: "XX:XX:XX:XX:XX:XX" + null
-        snprintf(macBuf, sizeof(macBuf), "%02X:%02X:%02X:%02X:%02X:%02X",
-                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-        
-        // Get hostname - must use String but copy immediately to minimize PSRAM exposure
-        // Use a local scope to ensure String is destroyed before any other operations
-        char hostnameBuf[64];
-        {
-            String hostnameStr = WiFi.getHostname();
-            if (hostnameStr.length() > 0) {
-                strncpy(hostnameBuf, hostnameStr.c_str(), sizeof(hostnameBuf) - 1);
-                hostnameBuf[sizeof(hostnameBuf) - 1] = '\0';
-            } else {
-                strncpy(hostnameBuf, "brewos", sizeof(hostnameBuf) - 1);
-                hostnameBuf[sizeof(hostnameBuf) - 1] = '\0';
-            }
-            // String destructor runs here at end of scope, before any other operations
-        }
-        
-        doc["deviceId"] = macBuf;
-        doc["hostname"] = hostnameBuf;
-        
+        fillInfoDoc(doc);
+
         // Serialize JSON to buffer in internal RAM (not PSRAM)
         size_t jsonSize = measureJson(doc) + 1;
         char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
@@ -515,14 +701,54 @@ void BrewWebServer::setupRoutes() {
     _server.on("/api/status", HTTP_GET, [this](AsyncWebServerRequest* request) {
         handleGetStatus(request);
     });
-    
+
+    // One-round-trip dashboard bootstrap - see handleBootstrap
+    _server.on("/api/bootstrap", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        handleBootstrap(request);
+    });
+
+    // Aggregated site view - one request for a whole wall of machines.
+    // Peer frames are cached strings (see fleet_manager.h), so the response
+    // is assembled by appending, same as /api/bootstrap.
+    _server.on("/api/fleet", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!FleetManager::enabled()) {
+            request->send(404, "application/json", "{\"error\":\"Fleet mode disabled\"}");
+            return;
+        }
+        if (!FleetManager::isAggregator()) {
+            // Point the display at the elected aggregator instead
+            char buf[64];
+            snprintf(buf, sizeof(buf), "{\"aggregator\":false,\"aggregatorIp\":\"%s\"}",
+                     FleetManager::aggregatorIP().toString().c_str());
+            request->send(200, "application/json", buf);
+            return;
+        }
+
+        String out;
+        out.reserve(2048 + FleetManager::peersJsonEstimate());
+        out += "{\"aggregator\":true,\"self\":";
+        {
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+            StaticJsonDocument<2560> doc;
+            #pragma GCC diagnostic pop
+            fillStatusDoc(doc);
+            serializeJson(doc, out);
+        }
+        out += ",\"peers\":";
+        FleetManager::appendPeersJson(out);
+        out += "}";
+
+        request->send(200, "application/json", out);
+    });
+
     // Protocol diagnostics endpoint - exposes protocol v1.1 health metrics
     _server.on("/api/protocol/diagnostics", HTTP_GET, [this](AsyncWebServerRequest* request) {
         #pragma GCC diagnostic push
         #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-        StaticJsonDocument<512> doc;
+        StaticJsonDocument<4096> doc;  // Sized for pool bin/tag + reserve + jitter stats below
         #pragma GCC diagnostic pop
-        
+
         // Get protocol statistics from PicoUART
         uint32_t packetsReceived = _picoUart.getPacketsReceived();
         uint32_t packetErrors = _picoUart.getPacketErrors();
@@ -552,54 +778,683 @@ void BrewWebServer::setupRoutes() {
             doc["health"] = connected ? "initializing" : "disconnected";
         }
         
+        // RX ring health - overflow means loop() was starved (UI load) long
+        // enough to drop bytes; high water shows how close we get under load
+        doc["rx_ring"]["overflow_bytes"] = _picoUart.getRxRingOverflow();
+        doc["rx_ring"]["high_water"] = _picoUart.getRxRingHighWater();
+
+        // Command->ACK round-trip latency (for PROTOCOL_ACK_TIMEOUT_MS tuning)
+        doc["ack_latency_ms"]["p50"] = _picoUart.getAckLatencyPercentile(50);
+        doc["ack_latency_ms"]["p95"] = _picoUart.getAckLatencyPercentile(95);
+        doc["ack_latency_ms"]["max"] = _picoUart.getAckLatencyMax();
+        doc["ack_latency_ms"]["samples"] = _picoUart.getAckLatencySamples();
+
+        // Pico control-loop tick jitter (MSG_JITTER report, pushed every
+        // 60s) - the ground truth for how steady the 100ms PID period
+        // actually is, with the worst lateness attributed per cause
+        const PicoUART::PicoJitterStats& jitter = _picoUart.getControlJitter();
+        if (jitter.valid) {
+            JsonObject jit = doc["control_jitter"].to<JsonObject>();
+            jit["samples"] = jitter.samples;
+            JsonArray bounds = jit["bucket_bounds_us"].to<JsonArray>();
+            for (uint8_t i = 0; i < CONTROL_JITTER_BUCKET_COUNT - 1; i++) {
+                bounds.add(control_jitter_bounds_us[i]);
+            }
+            JsonArray lateBuckets = jit["late_buckets"].to<JsonArray>();
+            for (uint8_t i = 0; i < CONTROL_JITTER_BUCKET_COUNT; i++) {
+                lateBuckets.add(jitter.lateBuckets[i]);
+            }
+            jit["max_late_us"] = jitter.maxLateUs;
+            jit["max_late_flash_us"] = jitter.maxLateFlashUs;
+            jit["max_late_class_b_us"] = jitter.maxLateClassBUs;
+            jit["max_late_protocol_us"] = jitter.maxLateProtocolUs;
+            jit["max_late_other_us"] = jitter.maxLateOtherUs;
+        }
+
+        // WebSocket broadcast health - dropped frames mean a client's send
+        // queue was full; evictions mean it stayed full and we closed it
+        doc["websocket"]["clients"] = getClientCount();
+        doc["websocket"]["frames_dropped"] = getWsFramesDropped();
+        doc["websocket"]["clients_evicted"] = getWsClientsEvicted();
+
+        // Degraded broadcast policy (many-client mode)
+        doc["websocket"]["degraded"] = isDegradedBroadcastMode();
+        doc["websocket"]["degraded_threshold"] = getDegradedClientThreshold();
+        doc["websocket"]["primary_client"] = getPrimaryClientId();
+
+        // Admission control - shed requests mean reconnect storms hit the
+        // budget; storm events count distinct episodes since boot
+        doc["admission"]["requests_shed"] = getRequestsShed();
+        doc["admission"]["storm_events"] = getStormEvents();
+
+        // Shot-window priority governor
+        TaskGovernor::Stats govStats = TaskGovernor::getStats();
+        doc["governor"]["elevated"] = govStats.elevated;
+        doc["governor"]["managed_tasks"] = govStats.managed;
+        doc["governor"]["elevations"] = govStats.elevations;
+
+        // WiFi link health: per-window RSSI vs worst WS fanout time.
+        // Fanout rising with RSSI falling is "WiFi bad"; rising on steady
+        // RSSI points back at the firmware
+        doc["wifi_link"]["shot_phy_active"] = _wifiManager.isShotPhyActive();
+        doc["wifi_link"]["shot_phy_applies"] = _wifiManager.getShotPhyApplies();
+        WiFiManager::LinkSample linkHist[WIFI_LINK_HISTORY_LEN];
+        uint8_t linkCount = _wifiManager.getLinkHistory(linkHist, WIFI_LINK_HISTORY_LEN);
+        JsonArray linkArr = doc["wifi_link"]["history"].to<JsonArray>();
+        for (uint8_t i = 0; i < linkCount; i++) {
+            JsonObject s = linkArr.add<JsonObject>();
+            s["rssi"] = linkHist[i].rssi;
+            s["shot"] = linkHist[i].shotPhy;
+            s["max_broadcast_ms"] = linkHist[i].maxBroadcastMs;
+        }
+
+        // Differential config sync - skipped counts growing while sent stays
+        // flat is the healthy steady state
+        CloudConfigSync::Stats cfgStats = CloudConfigSync::getStats();
+        doc["configSync"]["uploads"] = cfgStats.uploads;
+        doc["configSync"]["sections_sent"] = cfgStats.sectionsSent;
+        doc["configSync"]["sections_skipped"] = cfgStats.sectionsSkipped;
+
+        // Fleet discovery/aggregation (only populated when fleet mode is on)
+        if (FleetManager::enabled()) {
+            FleetManager::Stats fleetStats = FleetManager::getStats();
+            doc["fleet"]["aggregator"] = FleetManager::isAggregator();
+            doc["fleet"]["peers"] = fleetStats.peers;
+            doc["fleet"]["discoveries"] = fleetStats.discoveries;
+            doc["fleet"]["fetches"] = fleetStats.fetches;
+            doc["fleet"]["fetch_failures"] = fleetStats.fetchFailures;
+        }
+
+        // Crash-loop guard - "degraded" true means subsystems were shed
+        // after repeated crashes (machine still brews, remote recovery via
+        // /api/crash-guard/reset or a power cycle)
+        JsonObject crashGuard = doc["crashGuard"].to<JsonObject>();
+        CrashGuard::toJson(crashGuard);
+
+        // Request arena usage - high_water near region_size or non-zero
+        // fallbacks mean REGION_SIZE needs a bump
+        RequestArena::Stats arenaStats = RequestArena::instance().getStats();
+        doc["request_arena"]["region_size"] = arenaStats.regionSize;
+        doc["request_arena"]["high_water"] = arenaStats.highWater;
+        doc["request_arena"]["fallback_allocs"] = arenaStats.fallbackAllocs;
+
+        // Learned per-endpoint document sizes (indexed by ArenaDocId) -
+        // non-zero overflows mean a seed was too small and a truncated
+        // response went out before the size was relearned
+        doc["request_arena"]["doc_overflows"] = DocSizer::instance().overflows();
+        JsonArray docSizes = doc["request_arena"]["doc_high_water"].to<JsonArray>();
+        for (uint8_t d = 0; d < ARENA_DOC_COUNT; d++) {
+            docSizes.add((uint32_t)DocSizer::instance().learned((ArenaDocId)d));
+        }
+
+        // PSRAM pool usage - a bin with exhaustions needs more blocks; a tag
+        // whose live count only ever grows is leaking
+        PsramPool::Stats poolStats = PsramPool::instance().getStats();
+        JsonArray poolBins = doc["psram_pool"]["bins"].to<JsonArray>();
+        for (size_t b = 0; b < PsramPool::BIN_COUNT; b++) {
+            JsonObject bin = poolBins.add<JsonObject>();
+            bin["block_size"] = poolStats.bins[b].blockSize;
+            bin["total"] = poolStats.bins[b].totalBlocks;
+            bin["in_use"] = poolStats.bins[b].inUse;
+            bin["high_water"] = poolStats.bins[b].highWater;
+            bin["allocs"] = poolStats.bins[b].allocs;
+            bin["exhausted"] = poolStats.bins[b].exhausted;
+        }
+        JsonArray poolTags = doc["psram_pool"]["tags"].to<JsonArray>();
+        for (size_t t = 0; t < PsramPool::MAX_TAGS && poolStats.tags[t].tag; t++) {
+            JsonObject tag = poolTags.add<JsonObject>();
+            tag["tag"] = poolStats.tags[t].tag;
+            tag["live"] = poolStats.tags[t].live;
+            tag["total"] = poolStats.tags[t].total;
+        }
+        doc["psram_pool"]["oversize"] = poolStats.oversize;
+        doc["psram_pool"]["heap_fallbacks"] = poolStats.heapFallbacks;
+
+        // Radio-stack internal-RAM reserve - a non-zero release count means
+        // the internal heap got low enough that the slab was handed over
+        RadioReserve::Stats reserveStats = RadioReserve::getStats();
+        doc["internal_reserve"]["size"] = reserveStats.reserveSize;
+        doc["internal_reserve"]["held"] = reserveStats.held;
+        doc["internal_reserve"]["releases"] = reserveStats.releases;
+        doc["internal_reserve"]["free_internal"] = reserveStats.freeInternal;
+        doc["internal_reserve"]["min_free_internal"] = reserveStats.minFreeInternal;
+        doc["internal_reserve"]["largest_block"] = reserveStats.largestBlock;
+
         // Protocol version
         doc["protocol_version"] = "1.1";
-        doc["features"] = "timeout,retry,handshake,backpressure,diagnostics";
+        doc["features"] = "timeout,retry,handshake,backpressure,diagnostics,latency";
         
         String response;
         serializeJson(doc, response);
         request->send(200, "application/json", response);
     });
     
-    // ==========================================================================
-    // Statistics API endpoints
-    // ==========================================================================
-    
-    // Get full statistics
-    _server.on("/api/stats", HTTP_GET, [](AsyncWebServerRequest* request) {
-        // Use heap-allocated document to avoid stack overflow in AsyncTCP task
-        // AsyncTCP task has limited stack (4-8KB), allocating 2KB on stack is dangerous
-        // Allocate JsonDocument on heap (ArduinoJson 7.x requires explicit allocation)
-        SpiRamJsonDocument doc(2048);
-        BrewOS::FullStatistics stats;
-        Stats.getFullStatistics(stats);
-        
-        JsonObject obj = doc.to<JsonObject>();
-        stats.toJson(obj);
-        
-        
-        // Allocate JSON buffer in internal RAM (not PSRAM)
+#if HEAP_TELEMETRY
+    // Allocation-site accounting (opt-in build, see heap_telemetry.h) -
+    // top sites by live bytes, for pinning fragmentation on a call site
+    _server.on("/api/memory/sites", HTTP_GET, [](AsyncWebServerRequest* request) {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<2048> doc;
+        #pragma GCC diagnostic pop
+
+        HeapSiteStats sites[16];
+        size_t count = heap_telemetry_top_sites(sites, 16);
+        JsonArray arr = doc["sites"].to<JsonArray>();
+        for (size_t i = 0; i < count; i++) {
+            JsonObject site = arr.add<JsonObject>();
+            site["file"] = sites[i].file;
+            site["line"] = sites[i].line;
+            site["live_bytes"] = sites[i].liveBytes;
+            site["peak_bytes"] = sites[i].peakBytes;
+            site["allocs"] = sites[i].allocs;
+        }
+        doc["untracked"] = heap_telemetry_untracked();
+
+        String response;
+        serializeJson(doc, response);
+        request->send(200, "application/json", response);
+    });
+#endif // HEAP_TELEMETRY
+
+    // Per-task stack watermarks and CPU share - for right-sizing the
+    // guessed stack sizes at the task creation sites. A large
+    // stack_high_water means the task never came close to its allocation.
+    _server.on("/api/diagnostics/tasks", HTTP_GET, [](AsyncWebServerRequest* request) {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<3072> doc;
+        #pragma GCC diagnostic pop
+
+        static const char* const TASK_STATES[] = {
+            "running", "ready", "blocked", "suspended", "deleted", "invalid"
+        };
+
+        diag_task_info_t tasks[DIAG_TASK_MAX];
+        size_t count = esp32_diagnostics_task_table(tasks, DIAG_TASK_MAX);
+        JsonArray arr = doc["tasks"].to<JsonArray>();
+        for (size_t i = 0; i < count; i++) {
+            JsonObject task = arr.add<JsonObject>();
+            task["name"] = tasks[i].name;
+            task["stack_high_water"] = tasks[i].stack_high_water;
+            task["priority"] = tasks[i].priority;
+            task["core"] = tasks[i].core;
+            task["state"] = TASK_STATES[tasks[i].state < 6 ? tasks[i].state : 5];
+            if (tasks[i].cpu_percent != 255) {
+                task["cpu_percent"] = tasks[i].cpu_percent;
+            }
+        }
+        doc["count"] = count;
+
+        String response;
+        serializeJson(doc, response);
+        request->send(200, "application/json", response);
+    });
+
+#if TRACEPOINTS
+    // Hot-path tracepoint dump in Chrome Trace Event format - load the
+    // result into chrome://tracing or Perfetto for a flamegraph of the
+    // instrumented regions (see trace_format.h for the catalog). pid 0 is
+    // the ESP32, pid 1 the Pico; tid is the core. Recording pauses while
+    // the dump streams so the rings stay stable, and resumes when the
+    // response is torn down - even on a mid-transfer client disconnect.
+    _server.on("/api/trace", HTTP_GET, [](AsyncWebServerRequest* request) {
+        struct TraceCursor {
+            uint8_t ring = 0;
+            size_t index = 0;
+            bool first = true;
+            bool closed = false;
+            ~TraceCursor() { trace_resume(); }
+        };
+        trace_pause();
+        auto cursor = std::make_shared<TraceCursor>();
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t written = 0;
+                if (index == 0) {
+                    buffer[written++] = '[';
+                }
+
+                while (cursor->ring < TRACE_RING_COUNT) {
+                    trace_record_t rec;
+                    if (!trace_ring_get(cursor->ring, cursor->index, &rec)) {
+                        cursor->ring++;   // Ring drained - move to the next one
+                        cursor->index = 0;
+                        continue;
+                    }
+
+                    uint32_t cpuHz = trace_ring_cpu_hz(cursor->ring);
+                    if (cpuHz == 0) {
+                        // Pico ring before any MSG_TRACE batch arrived -
+                        // no clock to convert cycles with, skip the ring
+                        cursor->ring++;
+                        cursor->index = 0;
+                        continue;
+                    }
+
+                    // Cycle count -> microseconds with ns sub-digits (the
+                    // regions under trace are often only a few us wide)
+                    uint64_t ns = (uint64_t)rec.cycles * 1000000000ULL / cpuHz;
+                    const char* name = trace_point_name(rec.id);
+
+                    // Whole events only; one that doesn't fit waits for the
+                    // next chunk (same policy as the brew history stream)
+                    char line[144];
+                    int len = snprintf(line, sizeof(line),
+                        "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":%d,\"tid\":%u}",
+                        cursor->first ? "" : ",",
+                        name ? name : "unknown",
+                        rec.phase == TRACE_PHASE_BEGIN ? 'B' : 'E',
+                        (unsigned long long)(ns / 1000),
+                        (unsigned long long)(ns % 1000),
+                        cursor->ring == TRACE_RING_PICO ? 1 : 0,
+                        rec.core);
+                    if (len < 0 || written + (size_t)len + 1 > maxLen) {
+                        break;  // Room for the record and the eventual ']'
+                    }
+                    memcpy(buffer + written, line, (size_t)len);
+                    written += (size_t)len;
+                    cursor->first = false;
+                    cursor->index++;
+                }
+
+                if (cursor->ring >= TRACE_RING_COUNT && !cursor->closed && written < maxLen) {
+                    buffer[written++] = ']';
+                    cursor->closed = true;
+                }
+                if (written == 0 && !cursor->closed) {
+                    return RESPONSE_TRY_AGAIN;  // Window too small for a record
+                }
+                return written;  // 0 after closing ']' ends the response
+            });
+
+        if (response) {
+            request->send(response);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+#endif // TRACEPOINTS
+
+    // Per-subsystem main-loop CPU attribution from the cooperative executor.
+    // ?reset=1 clears the accumulators for a fresh measurement window.
+    _server.on("/api/loop-stats", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (request->hasParam("reset")) {
+            LoopExecutor::resetStats();
+            request->send(200, "application/json", "{\"status\":\"ok\"}");
+            return;
+        }
+
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_LOOP_STATS, 4096));
+        JsonArray arr = doc["tasks"].to<JsonArray>();
+        LoopExecutor::statsToJson(arr);
+
         size_t jsonSize = measureJson(doc) + 1;
-        char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-        if (!jsonBuffer) {
-            jsonBuffer = (char*)malloc(jsonSize);
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_LOOP_STATS, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
         }
-        
+    });
+
+    // Per-command dispatch counters from the WS/cloud/MQTT command registry
+    // (?reset=1 clears the accumulators)
+    _server.on("/api/command-stats", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (request->hasParam("reset")) {
+            BrewWebServer::resetCommandStats();
+            request->send(200, "application/json", "{\"status\":\"ok\"}");
+            return;
+        }
+
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_COMMAND_STATS, 4096));
+        JsonArray arr = doc["commands"].to<JsonArray>();
+        BrewWebServer::commandStatsToJson(arr);
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_COMMAND_STATS, doc);
+
         if (jsonBuffer) {
             serializeJson(doc, jsonBuffer, jsonSize);
             request->send(200, "application/json", jsonBuffer);
-            free(jsonBuffer);
         } else {
             request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
         }
     });
+
+    // Soft-watchdog table: worst heartbeat gap and SLO violations per
+    // registered subsystem loop (?reset=1 clears the stats)
+    _server.on("/api/diagnostics/watchdog", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (request->hasParam("reset")) {
+            SoftWatchdog::resetStats();
+            request->send(200, "application/json", "{\"status\":\"ok\"}");
+            return;
+        }
+
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_WATCHDOG, 4096));
+        JsonArray arr = doc["subsystems"].to<JsonArray>();
+        SoftWatchdog::toJson(arr);
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_WATCHDOG, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // On-demand microbenchmark suite - quantitative A/B comparison of
+    // firmware builds on fleet machines without a bench rig. Each bench
+    // reports iterations, bytes processed and CPU cycles (plus derived
+    // microseconds). Runs inline in the handler (~30ms total, one 4-byte
+    // NVS write and an 8KB scratch file per call); hit it while idle.
+    _server.on("/api/bench", HTTP_GET, [](AsyncWebServerRequest* request) {
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_BENCH, 2048));
+        uint32_t cpuMhz = getCpuFrequencyMhz();
+        doc["cpu_mhz"] = cpuMhz;
+        JsonArray benches = doc["benches"].to<JsonArray>();
+
+        auto addResult = [&benches, cpuMhz](const char* name, uint32_t iters,
+                                            uint32_t bytes, uint32_t cycles) {
+            JsonObject b = benches.add<JsonObject>();
+            b["name"] = name;
+            b["iters"] = iters;
+            b["bytes"] = bytes;
+            b["cycles"] = cycles;
+            b["us"] = cycles / cpuMhz;
+            return b;
+        };
+
+        // CRC16 throughput over the shared protocol table (4KB x 64 passes)
+        uint8_t* pattern = (uint8_t*)RequestArena::instance().alloc(4096);
+        if (pattern) {
+            for (size_t i = 0; i < 4096; i++) {
+                pattern[i] = (uint8_t)(i * 31 + 7);
+            }
+            uint16_t crc = 0xFFFF;
+            uint32_t start = esp_cpu_get_cycle_count();
+            for (int i = 0; i < 64; i++) {
+                crc = protocol_crc16_update(crc, pattern, 4096);
+            }
+            uint32_t cycles = esp_cpu_get_cycle_count() - start;
+            JsonObject b = addResult("crc16", 64, 64 * 4096, cycles);
+            b["crc"] = crc;  // Also defeats dead-code elimination
+        }
+
+        // Full-status JSON build + serialize (shape of broadcastFullStatus),
+        // then MessagePack encode of the same document (WS binary path)
+        {
+            ArenaJsonDocument sdoc(1024);
+            char* out = (char*)RequestArena::instance().alloc(1024);
+            uint8_t* packed = (uint8_t*)RequestArena::instance().alloc(1024);
+            auto buildStatus = [&sdoc]() {
+                sdoc.clear();
+                sdoc["type"] = "status";
+                sdoc["seq"] = 12345;
+                JsonObject machine = sdoc["machine"].to<JsonObject>();
+                machine["state"] = "ready";
+                machine["brewing"] = false;
+                machine["heating"] = true;
+                JsonObject temps = sdoc["temps"].to<JsonObject>();
+                temps["brew"] = 93.4f;
+                temps["brewSetpoint"] = 94.0f;
+                temps["steam"] = 144.8f;
+                temps["steamSetpoint"] = 145.0f;
+                sdoc["pressure"] = 9.1f;
+                JsonObject power = sdoc["power"].to<JsonObject>();
+                power["watts"] = 1450;
+                power["mode"] = 1;
+                JsonObject scale = sdoc["scale"].to<JsonObject>();
+                scale["connected"] = true;
+                scale["weight"] = 18.2f;
+                JsonObject connections = sdoc["connections"].to<JsonObject>();
+                connections["pico"] = true;
+                connections["wifi"] = true;
+                connections["mqtt"] = false;
+                JsonObject wifi = sdoc["wifi"].to<JsonObject>();
+                wifi["ssid"] = "bench-ssid";
+                wifi["rssi"] = -52;
+                wifi["ip"] = "192.168.1.42";
+            };
+
+            if (out && packed) {
+                size_t jsonBytes = 0;
+                uint32_t start = esp_cpu_get_cycle_count();
+                for (int i = 0; i < 16; i++) {
+                    buildStatus();
+                    jsonBytes += serializeJson(sdoc, out, 1024);
+                }
+                uint32_t cycles = esp_cpu_get_cycle_count() - start;
+                addResult("json_status_build", 16, jsonBytes, cycles);
+
+                size_t packedBytes = 0;
+                start = esp_cpu_get_cycle_count();
+                for (int i = 0; i < 16; i++) {
+                    packedBytes += MessagePackHelper::serialize(sdoc, packed, 1024);
+                }
+                cycles = esp_cpu_get_cycle_count() - start;
+                addResult("msgpack_encode", 16, packedBytes, cycles);
+            }
+        }
+
+        // TLS record-path crypto: AES-128-GCM (bulk cipher for cloud WSS and
+        // MQTTS) and SHA-256 over an 8KB record-shaped buffer. The S3
+        // hardware engines should keep a record in the low hundreds of us -
+        // a software fallback here is what shows up as WS latency blips
+        // when a large TLS record lands on a network task. crypto_hw
+        // reports which mbedTLS hardware paths this build actually enables
+        // (MPI covers the RSA/ECC bignum ops in the handshake; RSA itself
+        // is too slow to run in a GET handler, so it's flag-only).
+        {
+            JsonObject hw = doc["crypto_hw"].to<JsonObject>();
+#ifdef CONFIG_MBEDTLS_HARDWARE_AES
+            hw["aes"] = true;
+#else
+            hw["aes"] = false;
+#endif
+#ifdef CONFIG_MBEDTLS_HARDWARE_SHA
+            hw["sha"] = true;
+#else
+            hw["sha"] = false;
+#endif
+#ifdef CONFIG_MBEDTLS_HARDWARE_MPI
+            hw["mpi"] = true;
+#else
+            hw["mpi"] = false;
+#endif
+
+            uint8_t* record = (uint8_t*)RequestArena::instance().alloc(8192);
+            if (record) {
+                for (size_t i = 0; i < 8192; i++) {
+                    record[i] = (uint8_t)(i * 13 + 5);
+                }
+
+                static const uint8_t key[16] = { 'b','r','e','w','o','s','-',
+                                                 'b','e','n','c','h','-','k','e','y' };
+                uint8_t iv[12] = {0};
+                uint8_t tag[16];
+                mbedtls_gcm_context gcm;
+                mbedtls_gcm_init(&gcm);
+                if (mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, 128) == 0) {
+                    uint32_t start = esp_cpu_get_cycle_count();
+                    for (int i = 0; i < 8; i++) {
+                        iv[0] = (uint8_t)i;  // Fresh nonce per record, TLS-style
+                        mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, 8192,
+                                                  iv, sizeof(iv), nullptr, 0,
+                                                  record, record, sizeof(tag), tag);
+                    }
+                    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+                    JsonObject b = addResult("aes128_gcm_record", 8, 8 * 8192, cycles);
+                    b["t0"] = tag[0];  // Also defeats dead-code elimination
+                }
+                mbedtls_gcm_free(&gcm);
+
+                uint8_t digest[32];
+                uint32_t start = esp_cpu_get_cycle_count();
+                for (int i = 0; i < 8; i++) {
+                    mbedtls_sha256(record, 8192, digest, 0);
+                }
+                uint32_t cycles = esp_cpu_get_cycle_count() - start;
+                JsonObject b = addResult("sha256_record", 8, 8 * 8192, cycles);
+                b["d0"] = digest[0];
+            }
+        }
+
+        // NVS commit latency - one real write+commit to a scratch namespace
+        // (kept to a single 4-byte key per call to limit flash wear)
+        {
+            Preferences prefs;
+            uint32_t start = esp_cpu_get_cycle_count();
+            prefs.begin("bench", false);
+            prefs.putUInt("seq", millis());
+            prefs.end();
+            uint32_t cycles = esp_cpu_get_cycle_count() - start;
+            addResult("nvs_commit", 1, sizeof(uint32_t), cycles);
+        }
+
+        // LittleFS append throughput - 8 x 1KB to a scratch file
+        uint8_t* chunk = (uint8_t*)RequestArena::instance().alloc(1024);
+        if (chunk) {
+            memset(chunk, 'b', 1024);
+            File f = LittleFS.open("/bench.tmp", "w");
+            if (f) {
+                size_t written = 0;
+                uint32_t start = esp_cpu_get_cycle_count();
+                for (int i = 0; i < 8; i++) {
+                    written += f.write(chunk, 1024);
+                }
+                f.flush();
+                uint32_t cycles = esp_cpu_get_cycle_count() - start;
+                f.close();
+                LittleFS.remove("/bench.tmp");
+                addResult("littlefs_append", 8, written, cycles);
+            }
+        }
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_BENCH, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // Boot report - per-phase breakdown of the last two boots. Current boot
+    // comes from the phase table setup() filled; the previous boot survives
+    // in RTC noinit memory so a slow boot is attributable even after the
+    // reboot that usually follows it.
+    _server.on("/api/boot-report", HTTP_GET, [](AsyncWebServerRequest* request) {
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_BOOT_REPORT, 2048));
+
+        doc["total_ms"] = boot_report_total_ms();
+        JsonArray phases = doc["phases"].to<JsonArray>();
+        for (uint8_t i = 0; i < boot_report_phase_count(); i++) {
+            JsonObject p = phases.add<JsonObject>();
+            p["name"] = boot_report_phase_name(i);
+            p["ms"] = boot_report_phase_ms(i);
+        }
+
+        if (boot_report_prev_valid()) {
+            JsonObject prev = doc["previous"].to<JsonObject>();
+            prev["total_ms"] = boot_report_prev_total_ms();
+            JsonArray prevPhases = prev["phases"].to<JsonArray>();
+            for (uint8_t i = 0; i < boot_report_prev_phase_count(); i++) {
+                JsonObject p = prevPhases.add<JsonObject>();
+                p["name"] = boot_report_prev_phase_name(i);
+                p["ms"] = boot_report_prev_phase_ms(i);
+            }
+        }
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_BOOT_REPORT, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // Flight recorder - crash-surviving event trail from RTC memory.
+    // "trail" holds the events leading up to the last crash (if any), so
+    // field lockups can be diagnosed without a serial cable.
+    _server.on("/api/diagnostics/flight", HTTP_GET, [](AsyncWebServerRequest* request) {
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_FLIGHT, 4096));
+
+        JsonObject live = doc["live"].to<JsonObject>();
+        FlightRecorder::dumpToJson(live);
+
+        doc["crashed"] = FlightRecorder::hasCrashTrail();
+        if (FlightRecorder::hasCrashTrail()) {
+            JsonObject trail = doc["trail"].to<JsonObject>();
+            FlightRecorder::crashTrailToJson(trail);
+        }
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_FLIGHT, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // ==========================================================================
+    // Statistics API endpoints
+    // ==========================================================================
+    
+    // Get full statistics
+    _server.on("/api/stats", HTTP_GET, [](AsyncWebServerRequest* request) {
+        // Serve from cache until the stats generation moves
+        if (serveCachedJson(request, g_statsCache, Stats.generation())) {
+            return;
+        }
+
+        // Rebuild shared with /api/bootstrap (see refreshStatsCache)
+        if (refreshStatsCache() &&
+            serveCachedJson(request, g_statsCache, g_statsCache.generation)) {
+            return;
+        }
+        request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+    });
     
     // Get extended statistics with history data
     _server.on("/api/stats/extended", HTTP_GET, [](AsyncWebServerRequest* request) {
-        // Use heap-allocated document to avoid stack overflow in AsyncTCP task
-        // AsyncTCP task has limited stack (4-8KB), allocating 2KB on stack is dangerous
-        SpiRamJsonDocument doc(2048);
-        
+        // Serve from cache until the stats generation moves - this is the most
+        // expensive endpoint to rebuild (five history arrays)
+        uint32_t generation = Stats.generation();
+        if (serveCachedJson(request, g_statsExtendedCache, generation)) {
+            return;
+        }
+
+        // Arena-backed rebuild (see /api/stats)
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_STATS_EXTENDED, 2048));
+
         // Get full statistics
         BrewOS::FullStatistics stats;
         Stats.getFullStatistics(stats);
@@ -626,75 +1481,396 @@ void BrewWebServer::setupRoutes() {
         // Daily history (last 30 days)
         JsonArray dailyArr = doc["dailyHistory"].to<JsonArray>();
         Stats.getDailyHistory(dailyArr);
-        
-        
-        // Allocate JSON buffer in internal RAM (not PSRAM)
+
+        // Flag partial data until lazy hydration completes (see /api/stats)
+        if (!Stats.isHydrated()) {
+            Stats.requestHydration();
+            doc["hydrating"] = true;
+        }
+
+
         size_t jsonSize = measureJson(doc) + 1;
-        char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-        if (!jsonBuffer) {
-            jsonBuffer = (char*)malloc(jsonSize);
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_STATS_EXTENDED, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            storeCachedJson(g_statsExtendedCache, generation, jsonBuffer, jsonSize - 1);
+            if (!serveCachedJson(request, g_statsExtendedCache, generation)) {
+                request->send(200, "application/json", jsonBuffer);
+            }
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+    
+    // Get brew history - use PSRAM for large array
+    _server.on("/api/stats/brews", HTTP_GET, [](AsyncWebServerRequest* request) {
+        // Chunked streaming: serializing hundreds of records into one
+        // document stalls the async_tcp task and starves the WebSocket
+        // broadcasts. Instead each chunk callback serializes only the
+        // records that fit in the TCP window, so the task yields between
+        // pages and the full history (500 shots) is queryable without a
+        // large per-request buffer.
+        // Before hydration the ring is empty - kick off the lazy load so a
+        // retry sees real data (can't flag it in a streamed array response)
+        if (!Stats.isHydrated()) {
+            Stats.requestHydration();
+        }
+
+        size_t limit = Stats.getBrewHistoryCount();
+        if (request->hasParam("limit")) {
+            size_t requested = request->getParam("limit")->value().toInt();
+            if (requested < limit) limit = requested;
+        }
+
+        // Cursor shared across chunk callbacks; freed with the response
+        // even if the client disconnects mid-transfer
+        struct BrewCursor {
+            size_t next = 0;   // Next record index (0 = most recent)
+            size_t total = 0;
+            bool closed = false;
+        };
+        auto cursor = std::make_shared<BrewCursor>();
+        cursor->total = limit;
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t written = 0;
+                if (index == 0) {
+                    buffer[written++] = '[';
+                }
+
+                // Serialize whole records only; one that doesn't fit waits
+                // for the next chunk (and the next TCP window)
+                BrewRecord record;
+                while (cursor->next < cursor->total && Stats.getBrewRecord(cursor->next, record)) {
+                    #pragma GCC diagnostic push
+                    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+                    StaticJsonDocument<256> doc;
+                    #pragma GCC diagnostic pop
+                    JsonObject obj = doc.to<JsonObject>();
+                    record.toJson(obj);
+
+                    // Room for separator, record, and the eventual ']'
+                    size_t need = measureJson(doc) + 2;
+                    if (written + need > maxLen) {
+                        break;
+                    }
+                    if (cursor->next > 0) {
+                        buffer[written++] = ',';
+                    }
+                    written += serializeJson(doc, (char*)buffer + written, maxLen - written);
+                    cursor->next++;
+                }
+
+                if (cursor->next >= cursor->total && !cursor->closed && written < maxLen) {
+                    buffer[written++] = ']';
+                    cursor->closed = true;
+                }
+                if (written == 0 && !cursor->closed) {
+                    return RESPONSE_TRY_AGAIN;  // Window too small for a record
+                }
+                return written;  // 0 after closing ']' ends the response
+            });
+
+        if (response) {
+            request->send(response);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // Get power history
+    _server.on("/api/stats/power", HTTP_GET, [](AsyncWebServerRequest* request) {
+        // Arena-backed heap-free handler; document lives in the per-request
+        // arena instead of the AsyncTCP task's limited stack
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_STATS_POWER, 2048));
+        JsonArray arr = doc.to<JsonArray>();
+
+        // Kick off the lazy history load if a query beat it (array response,
+        // so no room for a "hydrating" flag - retry sees the data)
+        if (!Stats.isHydrated()) {
+            Stats.requestHydration();
+        }
+
+        // ?hours= picks the downsampling level (raw/hourly/daily) so a
+        // month-long chart ships ~30 entries instead of the raw ring
+        uint32_t spanHours = 24;
+        if (request->hasParam("hours")) {
+            uint32_t requested = request->getParam("hours")->value().toInt();
+            if (requested > 0) spanHours = requested;
+        }
+        Stats.getPowerHistory(arr, spanHours);
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_STATS_POWER, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+    
+    // Date-range query against the packed multi-year daily archive.
+    // ?start=&end= are unix timestamps (default: last 365 days) - reads are
+    // direct-offset, so a year-over-year query costs the same on a 5-year
+    // archive as on a fresh one.
+    _server.on("/api/stats/daily-archive", HTTP_GET, [](AsyncWebServerRequest* request) {
+        uint32_t endDate = (uint32_t)time(nullptr);
+        uint32_t startDate = (endDate > 365UL * 86400UL) ? endDate - 365UL * 86400UL : 0;
+        if (request->hasParam("start")) {
+            startDate = (uint32_t)request->getParam("start")->value().toInt();
+        }
+        if (request->hasParam("end")) {
+            endDate = (uint32_t)request->getParam("end")->value().toInt();
+        }
+        // Cap one response at a year of days; longer spans paginate
+        if (endDate > startDate + 366UL * 86400UL) {
+            endDate = startDate + 366UL * 86400UL;
+        }
+
+        // Arena-backed: up to ~366 records at ~120B of JSON each, but the
+        // typical dashboard query is far smaller - learn it per install
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_ARCHIVE, 49152));
+        JsonArray arr = doc.to<JsonArray>();
+        Stats.getDailyArchiveRange(startDate, endDate, arr);
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_ARCHIVE, doc);
+
+        if (jsonBuffer) {
+            serializeJson(doc, jsonBuffer, jsonSize);
+            request->send(200, "application/json", jsonBuffer);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
+    });
+
+    // CSV exports - chunked row-by-row generation straight from the history
+    // stores, so memory use is constant regardless of export size (a year of
+    // daily records streams through one 16-record page buffer). JSON exports
+    // of the same data would need the whole document in RAM.
+    _server.on("/api/export/brews.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (!Stats.isHydrated()) {
+            Stats.requestHydration();
+        }
+
+        struct CsvCursor {
+            size_t next = 0;
+            size_t total = 0;
+        };
+        auto cursor = std::make_shared<CsvCursor>();
+        cursor->total = Stats.getBrewHistoryCount();
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("text/csv",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t written = 0;
+                if (index == 0) {
+                    written += snprintf((char*)buffer, maxLen,
+                        "timestamp,duration_ms,yield_g,dose_g,peak_bar,avg_temp_c,avg_flow,rating\n");
+                }
+
+                // Whole rows only; one that doesn't fit waits for the next chunk
+                BrewRecord record;
+                char row[128];
+                while (cursor->next < cursor->total && Stats.getBrewRecord(cursor->next, record)) {
+                    int len = snprintf(row, sizeof(row), "%lu,%u,%.1f,%.1f,%.2f,%.1f,%.2f,%u\n",
+                                       (unsigned long)record.timestamp, record.durationMs,
+                                       record.yieldWeight, record.doseWeight, record.peakPressure,
+                                       record.avgTemperature, record.avgFlowRate, record.rating);
+                    if (written + len > maxLen) {
+                        break;
+                    }
+                    memcpy(buffer + written, row, len);
+                    written += len;
+                    cursor->next++;
+                }
+                return written;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"brews.csv\"");
+        request->send(response);
+    });
+
+    _server.on("/api/export/power.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (!Stats.isHydrated()) {
+            Stats.requestHydration();
+        }
+
+        struct CsvCursor {
+            size_t next = 0;
+            size_t total = 0;
+        };
+        auto cursor = std::make_shared<CsvCursor>();
+        cursor->total = Stats.getPowerSampleCount();
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("text/csv",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t written = 0;
+                if (index == 0) {
+                    written += snprintf((char*)buffer, maxLen,
+                                        "timestamp,avg_watts,max_watts,kwh\n");
+                }
+
+                PowerSample sample;
+                char row[80];
+                while (cursor->next < cursor->total && Stats.getPowerSample(cursor->next, sample)) {
+                    int len = snprintf(row, sizeof(row), "%lu,%.1f,%.1f,%.4f\n",
+                                       (unsigned long)sample.timestamp, sample.avgWatts,
+                                       sample.maxWatts, sample.kwhConsumed);
+                    if (written + len > maxLen) {
+                        break;
+                    }
+                    memcpy(buffer + written, row, len);
+                    written += len;
+                    cursor->next++;
+                }
+                return written;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"power.csv\"");
+        request->send(response);
+    });
+
+    _server.on("/api/export/daily.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+        // Streams the full multi-year archive oldest-first through a small
+        // page buffer held by the cursor - one file open per page, not per row
+        struct DailyCursor {
+            uint32_t next = 0;
+            uint32_t total = 0;
+            BrewOS::DailyArchiveRecord page[16];
+            size_t pageStart = 0;
+            size_t pageLen = 0;
+        };
+        auto cursor = std::make_shared<DailyCursor>();
+        cursor->total = Stats.getDailyArchiveCount();
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("text/csv",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t written = 0;
+                if (index == 0) {
+                    written += snprintf((char*)buffer, maxLen,
+                        "date,shot_count,total_brew_ms,total_kwh,on_time_min,steam_cycles,"
+                        "avg_brew_ms,min_brew_ms,max_brew_ms\n");
+                }
+
+                char row[160];
+                while (cursor->next < cursor->total) {
+                    // Refill the page when the cursor walks off its end
+                    if (cursor->next < cursor->pageStart ||
+                        cursor->next >= cursor->pageStart + cursor->pageLen) {
+                        cursor->pageStart = cursor->next;
+                        cursor->pageLen = Stats.readDailyArchive(
+                            cursor->next, cursor->page,
+                            sizeof(cursor->page) / sizeof(cursor->page[0]));
+                        if (cursor->pageLen == 0) {
+                            cursor->next = cursor->total;  // Short read - end the export
+                            break;
+                        }
+                    }
+
+                    const BrewOS::DailyArchiveRecord& rec =
+                        cursor->page[cursor->next - cursor->pageStart];
+                    if (!rec.hasData) {
+                        cursor->next++;  // Gap day
+                        continue;
+                    }
+                    int len = snprintf(row, sizeof(row), "%lu,%u,%lu,%.3f,%u,%u,%.0f,%.0f,%.0f\n",
+                                       (unsigned long)rec.date, rec.shotCount,
+                                       (unsigned long)rec.totalBrewTimeMs, rec.totalKwh,
+                                       rec.onTimeMinutes, rec.steamCycles, rec.avgBrewTimeMs,
+                                       rec.minBrewTimeMs, rec.maxBrewTimeMs);
+                    if (written + len > maxLen) {
+                        break;
+                    }
+                    memcpy(buffer + written, row, len);
+                    written += len;
+                    cursor->next++;
+                }
+                return written;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"daily.csv\"");
+        request->send(response);
+    });
+
+    // Download the last shot's full-rate telemetry capture (binary columnar
+    // format, see shot_capture.h). The async framework streams the file in
+    // TCP-window-sized chunks, so no request buffer is needed.
+    _server.on("/api/shot/capture", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (ShotCapture::isCapturing()) {
+            request->send(409, "application/json", "{\"error\":\"Shot in progress\"}");
+            return;
         }
-        
-        if (jsonBuffer) {
-            serializeJson(doc, jsonBuffer, jsonSize);
-            request->send(200, "application/json", jsonBuffer);
-            free(jsonBuffer);
-        } else {
-            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        if (!ShotCapture::hasCapture()) {
+            request->send(404, "application/json", "{\"error\":\"No capture available\"}");
+            return;
         }
+        request->send(userFS(), SHOT_CAPTURE_FILE, "application/octet-stream");
     });
-    
-    // Get brew history - use PSRAM for large array
-    _server.on("/api/stats/brews", HTTP_GET, [](AsyncWebServerRequest* request) {
-        SpiRamJsonDocument doc(8192);  // 8KB in PSRAM for brew history
-        JsonArray arr = doc.to<JsonArray>();
-        
-        // Check for limit parameter
-        size_t limit = 50;
-        if (request->hasParam("limit")) {
-            limit = request->getParam("limit")->value().toInt();
-            if (limit > 200) limit = 200;
+
+    // Raw shot-start pressure transient captured on the Pico at the full
+    // ADC rate (pre-filter) and shipped over after the shot - see
+    // burst_capture.c. RAM only, so each shot replaces the previous one.
+    _server.on("/api/shot/transient", HTTP_GET, [](AsyncWebServerRequest* request) {
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_SHOT_TRANSIENT, 12288));
+        if (!ShotCapture::transientToJson(doc)) {
+            request->send(404, "application/json", "{\"error\":\"No transient captured\"}");
+            return;
         }
-        
-        Stats.getBrewHistory(arr, limit);
-        
-        // Serialize to PSRAM buffer
+
         size_t jsonSize = measureJson(doc) + 1;
-        char* jsonBuffer = (char*)psram_malloc(jsonSize);
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_SHOT_TRANSIENT, doc);
+
         if (jsonBuffer) {
             serializeJson(doc, jsonBuffer, jsonSize);
             request->send(200, "application/json", jsonBuffer);
-            safe_free(jsonBuffer);
         } else {
             request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
         }
     });
-    
-    // Get power history
-    _server.on("/api/stats/power", HTTP_GET, [](AsyncWebServerRequest* request) {
-        // Use heap-allocated document to avoid stack overflow in AsyncTCP task
-        // AsyncTCP task has limited stack (4-8KB), allocating 2KB on stack is dangerous
-        SpiRamJsonDocument doc(2048);
-        JsonArray arr = doc.to<JsonArray>();
-        Stats.getPowerHistory(arr);
-        
-        
-        // Allocate JSON buffer in internal RAM (not PSRAM)
-        size_t jsonSize = measureJson(doc) + 1;
-        char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-        if (!jsonBuffer) {
-            jsonBuffer = (char*)malloc(jsonSize);
+
+    // Pump wear trend from transient fingerprints (see pump_health.h).
+    // ?reset=1 drops the baseline - use after a pump service/replacement,
+    // otherwise the new pump reads as a huge "improvement" forever.
+    _server.on("/api/maintenance/pump", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (request->hasParam("reset")) {
+            PumpHealth::resetBaseline();
+            request->send(200, "application/json", "{\"status\":\"ok\"}");
+            return;
         }
-        
+
+        RequestArenaScope arena;
+        ArenaJsonDocument doc(DocSizer::instance().capacity(ARENA_DOC_PUMP_HEALTH, 1024));
+        JsonObject obj = doc.to<JsonObject>();
+        PumpHealth::toJson(obj);
+
+        size_t jsonSize = measureJson(doc) + 1;
+        char* jsonBuffer = (char*)RequestArena::instance().alloc(jsonSize);
+        DocSizer::instance().note(ARENA_DOC_PUMP_HEALTH, doc);
+
         if (jsonBuffer) {
             serializeJson(doc, jsonBuffer, jsonSize);
             request->send(200, "application/json", jsonBuffer);
-            free(jsonBuffer);
         } else {
             request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
         }
     });
-    
+
+    // Re-enable crash-guard-shed subsystems (takes effect next boot)
+    _server.on("/api/crash-guard/reset", HTTP_POST, [this](AsyncWebServerRequest* request) {
+        CrashGuard::reset();
+        broadcastLog("Crash guard reset - reboot to re-enable shed subsystems",
+                     static_cast<const char*>("warn"));
+        request->send(200, "application/json", "{\"status\":\"ok\"}");
+    });
+
     // Reset statistics (with confirmation)
     _server.on("/api/stats/reset", HTTP_POST, [this](AsyncWebServerRequest* request) {
         Stats.resetAll();
@@ -753,16 +1929,24 @@ void BrewWebServer::setupRoutes() {
         }
     );
     
-    // Filesystem space check endpoint
+    // Filesystem space check endpoint. Top-level fields are the asset
+    // partition (what web OTA uploads into); "user" is the hot-data FS
+    // (logs/stats/journal) - same numbers when running on a legacy
+    // partition table without the dedicated "userdata" partition.
     _server.on("/api/filesystem/space", HTTP_GET, [](AsyncWebServerRequest* request) {
         size_t used = LittleFS.usedBytes();
         size_t total = LittleFS.totalBytes();
         size_t free = total - used;
-        
-        char response[128];
-        snprintf(response, sizeof(response), 
-            "{\"used\":%u,\"total\":%u,\"free\":%u,\"usedPercent\":%.1f}", 
-            (unsigned)used, (unsigned)total, (unsigned)free, (used * 100.0f / total));
+        size_t userUsed = userFS().usedBytes();
+        size_t userTotal = userFS().totalBytes();
+
+        char response[256];
+        snprintf(response, sizeof(response),
+            "{\"used\":%u,\"total\":%u,\"free\":%u,\"usedPercent\":%.1f,"
+            "\"user\":{\"used\":%u,\"total\":%u,\"free\":%u,\"dedicated\":%s}}",
+            (unsigned)used, (unsigned)total, (unsigned)free, (used * 100.0f / total),
+            (unsigned)userUsed, (unsigned)userTotal, (unsigned)(userTotal - userUsed),
+            userFsIsDedicated() ? "true" : "false");
         request->send(200, "application/json", response);
     });
     
@@ -851,30 +2035,55 @@ void BrewWebServer::setupRoutes() {
         // Persist the setting to NVS
         State.settings().system.debugLogsEnabled = enable;
         State.saveSystemSettings();
-        
+
+        // Re-push the forward level so the Pico's source-side severity
+        // filter tracks the new setting (it reads debugLogsEnabled)
+        if (g_logManager && g_logManager->isPicoLogForwardingEnabled()) {
+            g_logManager->setPicoLogForwarding(true, [this](uint8_t* payload, size_t len) {
+                return _picoUart.sendCommand(MSG_CMD_LOG_CONFIG, payload, len);
+            });
+        }
+
         char response[64];
-        snprintf(response, sizeof(response), 
-            "{\"status\":\"ok\",\"enabled\":%s}", 
+        snprintf(response, sizeof(response),
+            "{\"status\":\"ok\",\"enabled\":%s}",
             enable ? "true" : "false");
         request->send(200, "application/json", response);
     });
     
     // GET /api/logs - Download system logs as text file
-    // Flushes RAM to flash and returns complete log history from flash
+    // Flushes RAM to flash, then streams the flash record file to the
+    // socket chunk by chunk - records are rendered into each TCP window
+    // as it opens, so pulling the full 100KB log costs a ~1.5KB cursor
+    // instead of a 100KB+ String (which used to spike heap mid-brew)
     _server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest* request) {
         if (!g_logManager || !g_logManager->isEnabled()) {
             request->send(503, "application/json", "{\"error\":\"Log buffer not enabled\"}");
             return;
         }
-        
-        // Flush RAM to flash and get complete logs (from flash, which has full history)
-        String logs = g_logManager->getLogsComplete();
-        
-        // Set headers for file download
-        AsyncWebServerResponse* response = request->beginResponse(200, "text/plain", logs);
-        response->addHeader("Content-Disposition", "attachment; filename=\"brewos_logs.txt\"");
-        response->addHeader("Cache-Control", "no-cache");
-        request->send(response);
+
+        // Cursor shared across chunk callbacks; freed with the response
+        // even if the client disconnects mid-transfer
+        auto cursor = std::make_shared<LogManager::LogStreamCursor>();
+        if (!g_logManager->streamLogsOpen(*cursor)) {
+            // No flash history yet - nothing saved since enabling
+            AsyncWebServerResponse* empty = request->beginResponse(200, "text/plain", "");
+            empty->addHeader("Content-Disposition", "attachment; filename=\"brewos_logs.txt\"");
+            request->send(empty);
+            return;
+        }
+
+        AsyncWebServerResponse* response = request->beginChunkedResponse("text/plain",
+            [cursor](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                return g_logManager->streamLogsChunk(*cursor, buffer, maxLen);
+            });
+        if (response) {
+            response->addHeader("Content-Disposition", "attachment; filename=\"brewos_logs.txt\"");
+            response->addHeader("Cache-Control", "no-cache");
+            request->send(response);
+        } else {
+            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        }
     });
     
     // DELETE /api/logs - Clear all logs
@@ -981,7 +2190,8 @@ void BrewWebServer::setupRoutes() {
         doc["stop_offset"] = settings.stop_offset;
         doc["auto_stop"] = settings.auto_stop;
         doc["auto_tare"] = settings.auto_tare;
-        
+        doc["place_auto_tare"] = scaleManager ? scaleManager->isAutoTareEnabled() : false;
+
         char response[256];
         serializeJson(doc, response, sizeof(response));
         request->send(200, "application/json", response);
@@ -1015,7 +2225,10 @@ void BrewWebServer::setupRoutes() {
             if (!doc["auto_tare"].isNull()) {
                 brewByWeight->setAutoTare(doc["auto_tare"].as<bool>());
             }
-            
+            if (!doc["place_auto_tare"].isNull() && scaleManager) {
+                scaleManager->setAutoTare(doc["place_auto_tare"].as<bool>());
+            }
+
             request->send(200, "application/json", "{\"status\":\"ok\"}");
         }
     );
@@ -1050,7 +2263,7 @@ void BrewWebServer::setupRoutes() {
     _server.on("/api/scale/status", HTTP_GET, [](AsyncWebServerRequest* request) {
         #pragma GCC diagnostic push
         #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-        StaticJsonDocument<384> doc;
+        StaticJsonDocument<1024> doc;
         #pragma GCC diagnostic pop
         scale_state_t state = scaleManager ? scaleManager->getState() : scale_state_t{};
         
@@ -1063,8 +2276,37 @@ void BrewWebServer::setupRoutes() {
         doc["stable"] = state.stable;
         doc["flow_rate"] = state.flow_rate;
         doc["battery"] = state.battery_percent;
-        
-        char response[384];
+        doc["place_auto_tare"] = scaleManager ? scaleManager->isAutoTareEnabled() : false;
+        doc["auto_tares"] = scaleManager ? scaleManager->getAutoTareCount() : 0;
+
+        // WiFi/BLE coexistence stats - how much radio time scans have taken
+        if (scaleManager) {
+            ScaleScanStats scanStats = scaleManager->getScanStats();
+            doc["scan"]["count"] = scanStats.scans;
+            doc["scan"]["total_ms"] = scanStats.totalScanMs;
+            doc["scan"]["aborted_by_brew"] = scanStats.abortedByBrew;
+            doc["scan"]["window_ms"] = scanStats.lastWindowMs;
+
+            // Reconnect state machine - drop frequency and recovery latency
+            ScaleReconnectStats rc = scaleManager->getReconnectStats();
+            doc["reconnect"]["drops"] = rc.drops;
+            doc["reconnect"]["mid_brew_drops"] = rc.midBrewDrops;
+            doc["reconnect"]["attempts"] = rc.attempts;
+            doc["reconnect"]["reconnects"] = rc.reconnects;
+            doc["reconnect"]["last_latency_ms"] = rc.lastLatencyMs;
+            doc["reconnect"]["total_latency_ms"] = rc.totalLatencyMs;
+
+            // Negotiated connection parameters - whether this session can
+            // actually carry the 10Hz weight stream
+            ScaleConnStats cs = scaleManager->getConnStats();
+            doc["conn"]["interval_ms"] = cs.intervalUnits * 1.25f;
+            doc["conn"]["latency"] = cs.latency;
+            doc["conn"]["enforcements"] = cs.enforcements;
+            doc["conn"]["slow_sessions"] = cs.slowSessions;
+            doc["conn"]["peer_rejects"] = cs.peerRejects;
+        }
+
+        char response[768];
         serializeJson(doc, response, sizeof(response));
         request->send(200, "application/json", response);
     });
@@ -1197,27 +2439,17 @@ void BrewWebServer::setupRoutes() {
     
     // Get all schedules
     _server.on("/api/schedules", HTTP_GET, [](AsyncWebServerRequest* request) {
-        // Use heap-allocated document to avoid stack overflow in AsyncTCP task
-        // AsyncTCP task has limited stack (4-8KB), allocating 2KB on stack is dangerous
-        SpiRamJsonDocument doc(2048);
-        JsonObject obj = doc.to<JsonObject>();
-        State.settings().schedule.toJson(obj);
-        
-        
-        // Allocate JSON buffer in internal RAM (not PSRAM)
-        size_t jsonSize = measureJson(doc) + 1;
-        char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-        if (!jsonBuffer) {
-            jsonBuffer = (char*)malloc(jsonSize);
+        // Serve from cache until any settings change
+        if (serveCachedJson(request, g_schedulesCache, State.settingsGeneration())) {
+            return;
         }
-        
-        if (jsonBuffer) {
-            serializeJson(doc, jsonBuffer, jsonSize);
-            request->send(200, "application/json", jsonBuffer);
-            free(jsonBuffer);
-        } else {
-            request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+
+        // Rebuild shared with /api/bootstrap (see refreshSchedulesCache)
+        if (refreshSchedulesCache() &&
+            serveCachedJson(request, g_schedulesCache, g_schedulesCache.generation)) {
+            return;
         }
+        request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
     });
     
     // Add a new schedule
@@ -1773,20 +3005,23 @@ void BrewWebServer::setupRoutes() {
             return;
         }
         
-        // Generate a new token if needed
-        bool tokenGenerated = false;
-        if (!_pairingManager->isTokenValid()) {
-            _pairingManager->generateToken();
-            tokenGenerated = true;
-        }
-        
-        // Register token with cloud if newly generated (or not yet registered)
-        // This ensures the token is valid in the cloud before user scans QR
-        if (tokenGenerated && WiFi.isConnected()) {
-            bool registered = _pairingManager->registerTokenWithCloud();
-            if (!registered) {
-                LOG_W("Failed to register pairing token with cloud");
-                // Continue anyway - user can retry
+        // Fast path: a token pre-registered at idle (cloud connect, or
+        // right after the previous pairing) is served as a pure lookup -
+        // no TLS handshake on the async_tcp task. Only a cold cache pays
+        // for generation + registration inline.
+        if (!_pairingManager->hasRegisteredToken()) {
+            if (!_pairingManager->isTokenValid()) {
+                _pairingManager->generateToken();
+            }
+
+            // Register token with cloud so it is valid before the user
+            // scans the QR
+            if (WiFi.isConnected()) {
+                bool registered = _pairingManager->registerTokenWithCloud();
+                if (!registered) {
+                    LOG_W("Failed to register pairing token with cloud");
+                    // Continue anyway - user can retry
+                }
             }
         }
         
@@ -2101,11 +3336,31 @@ void BrewWebServer::handleGetStatus(AsyncWebServerRequest* request) {
     }
     
     // Use stack allocation to avoid PSRAM crashes
+    // (2560: the display flush stats block pushed the payload past 2048)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-    StaticJsonDocument<2048> doc;
+    StaticJsonDocument<2560> doc;
     #pragma GCC diagnostic pop
-    
+
+    fillStatusDoc(doc);
+
+    // Serialize JSON to buffer in internal RAM (not PSRAM)
+    size_t jsonSize = measureJson(doc) + 1;
+    char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!jsonBuffer) {
+        jsonBuffer = (char*)malloc(jsonSize);
+    }
+
+    if (jsonBuffer) {
+        serializeJson(doc, jsonBuffer, jsonSize);
+        request->send(200, "application/json", jsonBuffer);
+        free(jsonBuffer);  // request->send() creates a copy, so we must free the original buffer
+    } else {
+        request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+    }
+}
+
+void BrewWebServer::fillStatusDoc(JsonDocument& doc) {
     // WiFi status
     // CRITICAL: Copy WiFiStatus Strings to stack buffers immediately to avoid PSRAM pointer issues
     // WiFiStatus contains String fields that might be allocated in PSRAM
@@ -2152,7 +3407,27 @@ void BrewWebServer::handleGetStatus(AsyncWebServerRequest* request) {
     doc["esp32"]["uptime"] = millis();
     doc["esp32"]["freeHeap"] = ESP.getFreeHeap();
     doc["esp32"]["version"] = ESP32_VERSION;
-    
+
+#if ENABLE_SCREEN
+    // Display flush instrumentation (dirty-rectangle areas, DMA wait times)
+    // avgRefreshPx near the full frame (230400) means a screen is doing
+    // full-screen redraws instead of per-widget invalidation
+    display_flush_stats_t flushStats;
+    display.getFlushStats(&flushStats);
+    doc["display"]["flushes"] = flushStats.flushCount;
+    doc["display"]["flushPx"] = flushStats.flushPixels;
+    doc["display"]["maxFlushPx"] = flushStats.maxFlushPixels;
+    doc["display"]["avgRefreshPx"] = flushStats.refreshCount
+        ? (uint32_t)(flushStats.refreshPixels / flushStats.refreshCount) : 0;
+    doc["display"]["maxRefreshMs"] = flushStats.maxRefreshTimeMs;
+    doc["display"]["dmaWaitUs"] = flushStats.flushWaitUs;
+    doc["display"]["maxDmaWaitUs"] = flushStats.maxFlushWaitUs;
+    JsonArray invalidations = doc["display"].createNestedArray("screenInvalidations");
+    for (int i = 0; i < SCREEN_COUNT && i < DISPLAY_STATS_MAX_SCREENS; i++) {
+        invalidations.add(flushStats.screenInvalidations[i]);
+    }
+#endif
+
     // MQTT status
     doc["mqtt"]["enabled"] = _mqttClient.getConfig().enabled;
     doc["mqtt"]["connected"] = _mqttClient.isConnected();
@@ -2162,7 +3437,12 @@ void BrewWebServer::handleGetStatus(AsyncWebServerRequest* request) {
     strncpy(mqttStatusBuf, mqttStatusStr.c_str(), sizeof(mqttStatusBuf) - 1);
     mqttStatusBuf[sizeof(mqttStatusBuf) - 1] = '\0';
     doc["mqtt"]["status"] = mqttStatusBuf;
-    
+    MQTTPublishStats mqttPubStats;
+    _mqttClient.getPublishStats(&mqttPubStats);
+    doc["mqtt"]["published"] = mqttPubStats.published;
+    doc["mqtt"]["suppressed"] = mqttPubStats.suppressed;
+    doc["mqtt"]["tx_bytes"] = mqttPubStats.payloadBytes;
+
     // Scale status
     doc["scale"]["connected"] = scaleManager ? scaleManager->isConnected() : false;
     doc["scale"]["scanning"] = scaleManager ? scaleManager->isScanning() : false;
@@ -2184,21 +3464,179 @@ void BrewWebServer::handleGetStatus(AsyncWebServerRequest* request) {
     
     // Setup status
     doc["setupComplete"] = State.settings().system.setupComplete;
+}
+
+void BrewWebServer::fillInfoDoc(JsonDocument& doc) {
+    // API version - increment ONLY for breaking changes to REST/WebSocket APIs
+    // Web UI checks this to determine compatibility
+    doc["apiVersion"] = 1;
+    
+    // Component versions
+    doc["firmwareVersion"] = ESP32_VERSION;
+    doc["webVersion"] = ESP32_VERSION;  // Web UI bundled with this firmware
+    doc["protocolVersion"] = PROTOCOL_VERSION;
+    
+    // ESP32 build timestamp (for dev builds)
+    char esp32Build[24];
+    snprintf(esp32Build, sizeof(esp32Build), "%s %s", BUILD_DATE, BUILD_TIME);
+    doc["buildDate"] = esp32Build;
+    
+    // Pico version (if connected) - with safety check
+    if (_picoUart.isConnected()) {
+        doc["picoConnected"] = true;
+        // Safely get Pico version - State might not be fully initialized
+        const char* picoVer = State.getPicoVersion();
+        if (picoVer && picoVer[0] != '\0') {
+            doc["picoVersion"] = picoVer;
+        }
+        // Pico build timestamp
+        const char* picoBuild = State.getPicoBuildDate();
+        if (picoBuild && picoBuild[0] != '\0') {
+            doc["picoBuildDate"] = picoBuild;
+        }
+    } else {
+        doc["picoConnected"] = false;
+    }
     
-    // Serialize JSON to buffer in internal RAM (not PSRAM)
-    size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = (char*)heap_caps_malloc(jsonSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!jsonBuffer) {
-        jsonBuffer = (char*)malloc(jsonSize);
+    // Mode detection
+    doc["mode"] = "local";
+    doc["apMode"] = _wifiManager.isAPMode();
+    
+    // Feature flags - granular capability detection
+    // Web UI uses these to conditionally show/hide features
+    JsonArray features = doc["features"].to<JsonArray>();
+    
+    // Core features (always available)
+    features.add("temperature_control");
+    features.add("pressure_monitoring");
+    features.add("power_monitoring");
+    
+    // Advanced features
+    features.add("bbw");              // Brew-by-weight
+    features.add("scale");            // BLE scale support
+    features.add("mqtt");             // MQTT integration
+    features.add("eco_mode");         // Eco mode
+    features.add("statistics");       // Statistics tracking
+    features.add("schedules");        // Schedule management
+    
+    // OTA features
+    features.add("pico_ota");         // Pico firmware updates
+    features.add("esp32_ota");        // ESP32 firmware updates
+    
+    // Debug features
+    features.add("debug_console");    // Debug console
+    features.add("protocol_debug");   // Protocol debugging
+    
+    // Device info - get MAC and hostname directly to avoid String allocations
+    // WiFi.macAddress() and WiFi.getHostname() return String, but we copy immediately
+    // to minimize PSRAM exposure
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    char macBuf[18];  // MAC address format: "XX:XX:XX:XX:XX:XX" + null
+    snprintf(macBuf, sizeof(macBuf), "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    
+    // Get hostname - must use String but copy immediately to minimize PSRAM exposure
+    // Use a local scope to ensure String is destroyed before any other operations
+    char hostnameBuf[64];
+    {
+        String hostnameStr = WiFi.getHostname();
+        if (hostnameStr.length() > 0) {
+            strncpy(hostnameBuf, hostnameStr.c_str(), sizeof(hostnameBuf) - 1);
+            hostnameBuf[sizeof(hostnameBuf) - 1] = '\0';
+        } else {
+            strncpy(hostnameBuf, "brewos", sizeof(hostnameBuf) - 1);
+            hostnameBuf[sizeof(hostnameBuf) - 1] = '\0';
+        }
+        // String destructor runs here at end of scope, before any other operations
     }
     
-    if (jsonBuffer) {
-        serializeJson(doc, jsonBuffer, jsonSize);
-        request->send(200, "application/json", jsonBuffer);
-        free(jsonBuffer);  // request->send() creates a copy, so we must free the original buffer
-    } else {
-        request->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+    doc["deviceId"] = macBuf;
+    doc["hostname"] = hostnameBuf;
+}
+
+void BrewWebServer::warmUp() {
+    // Everything a fresh dashboard load (or /api/bootstrap) touches, run
+    // once at boot while nobody is connected. After a fleet OTA every
+    // machine reboots at once and monitoring flags the cold first response
+    // as a latency regression - this moves that cost into setup.
+
+    // Serialized fragment caches: stats also kicks off history hydration
+    // early instead of on the first /api/stats hit
+    refreshStatsCache();
+    refreshSchedulesCache();
+
+    // Status and info docs - same stack builds handleBootstrap does; the
+    // values are discarded but the code paths and State reads go warm
+    {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<2560> doc;
+        #pragma GCC diagnostic pop
+        fillStatusDoc(doc);
+    }
+    {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<1024> doc;
+        #pragma GCC diagnostic pop
+        fillInfoDoc(doc);
+    }
+
+    // Broadcast side: page faults, doc pool growth, msgpack chain chunks
+    warmBroadcastBuffers();
+
+    // MQTT topics need no warming - buildTopicTable() interned them when
+    // the client was configured
+}
+
+void BrewWebServer::handleBootstrap(AsyncWebServerRequest* request) {
+    // One response with everything a fresh dashboard load needs, replacing
+    // the status -> info -> stats -> schedules request waterfall. Stats and
+    // schedules are lifted straight from their cached serialized fragments
+    // (refreshed only when their generation moved); status and info are
+    // cheap stack-doc builds. Config isn't bundled - it arrives over the
+    // WebSocket keyframe right after connect - and logs stay a file stream.
+    if (!_wifiManager.isAPMode() && !isWiFiReady()) {
+        const char* error = "{\"error\":\"WiFi initializing, please wait\"}";
+        request->send(503, "application/json", error);
+        return;
+    }
+
+    bool statsOk = refreshStatsCache();
+    bool schedulesOk = refreshSchedulesCache();
+
+    String out;
+    out.reserve(3072 + TempHistory::jsonSizeEstimate());
+    out += "{\"status\":";
+    {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<2560> doc;
+        #pragma GCC diagnostic pop
+        fillStatusDoc(doc);
+        serializeJson(doc, out);  // serializeJson appends to String
+    }
+    out += ",\"info\":";
+    {
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        StaticJsonDocument<1024> doc;
+        #pragma GCC diagnostic pop
+        fillInfoDoc(doc);
+        serializeJson(doc, out);
     }
+    out += ",\"stats\":";
+    out += statsOk ? g_statsCache.buffer : "null";
+    out += ",\"schedules\":";
+    out += schedulesOk ? g_schedulesCache.buffer : "null";
+    out += ",\"tempHistory\":";
+    // Delta-encoded 10-minute boiler temperature ring - seeds the dashboard
+    // chart so it no longer starts empty and fills from WS deltas alone
+    TempHistory::appendJson(out);
+    out += "}";
+
+    request->send(200, "application/json", out);
 }
 
 // Static cache for async WiFi scan results
@@ -2414,16 +3852,70 @@ void BrewWebServer::handleCommand(AsyncWebServerRequest* request, uint8_t* data,
     }
 }
 
+// ---------------------------------------------------------------------------
+// Streaming upload verification
+//
+// Clients may send the expected SHA-256 of the firmware image in an
+// X-Firmware-SHA256 header (64 hex chars). The digest state is updated per
+// chunk as data arrives, so the final check is a single constant-time
+// compare - no re-read pass over the file or the flashed partition. Without
+// the header the computed digest is still logged so it can be checked
+// against the release manifest by hand.
+// ---------------------------------------------------------------------------
+
+static bool parseSha256Hex(const String& hex, uint8_t out[32]) {
+    if (hex.length() != 64) return false;
+    for (int i = 0; i < 64; i++) {
+        if (!isxdigit((unsigned char)hex[i])) return false;
+    }
+    for (int i = 0; i < 32; i++) {
+        char buf[3] = {hex[i * 2], hex[i * 2 + 1], 0};
+        out[i] = (uint8_t)strtol(buf, nullptr, 16);
+    }
+    return true;
+}
+
+static void sha256ToHex(const uint8_t digest[32], char out[65]) {
+    for (int i = 0; i < 32; i++) {
+        snprintf(out + i * 2, 3, "%02x", digest[i]);
+    }
+}
+
+// Compare without early exit so timing doesn't reveal how many leading
+// bytes of the digest matched
+static bool digestsEqual(const uint8_t* a, const uint8_t* b, size_t n) {
+    uint8_t diff = 0;
+    for (size_t i = 0; i < n; i++) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
+
 void BrewWebServer::handleOTAUpload(AsyncWebServerRequest* request, const String& filename,
                                 size_t index, uint8_t* data, size_t len, bool final) {
     static File otaFile;
     static size_t totalSize = 0;
     static size_t uploadedSize = 0;
-    
+    static mbedtls_sha256_context shaCtx;
+    static bool shaActive = false;
+    static bool haveExpectedSha = false;
+    static uint8_t expectedSha[32];
+
     if (index == 0) {
         LOG_I("OTA upload started: %s", filename.c_str());
         totalSize = request->contentLength();
         uploadedSize = 0;
+
+        shaActive = false;
+        haveExpectedSha = false;
+        if (request->hasHeader("X-Firmware-SHA256")) {
+            if (!parseSha256Hex(request->header("X-Firmware-SHA256"), expectedSha)) {
+                LOG_E("OTA upload: malformed X-Firmware-SHA256 header");
+                request->send(400, "application/json", "{\"error\":\"Malformed X-Firmware-SHA256 header\"}");
+                return;
+            }
+            haveExpectedSha = true;
+        }
         
         // Check available space before starting upload
         size_t freeSpace = LittleFS.totalBytes() - LittleFS.usedBytes();
@@ -2456,15 +3948,22 @@ void BrewWebServer::handleOTAUpload(AsyncWebServerRequest* request, const String
             request->send(500, "application/json", "{\"error\":\"Failed to open file\"}");
             return;
         }
+
+        mbedtls_sha256_init(&shaCtx);
+        mbedtls_sha256_starts(&shaCtx, 0);
+        shaActive = true;
     }
-    
-    if (otaFile && len > 0) {
+
+    if (otaFile && len > 0 && shaActive) {
+        mbedtls_sha256_update(&shaCtx, data, len);
         size_t written = otaFile.write(data, len);
         if (written != len) {
             LOG_E("Failed to write all data: %d/%d (filesystem may be full)", written, len);
             // Close file and abort upload if write fails
             otaFile.close();
             LittleFS.remove(OTA_FILE_PATH);  // Clean up partial file
+            mbedtls_sha256_free(&shaCtx);
+            shaActive = false;
             broadcastLogLevel("error", "Upload failed: Filesystem full or write error");
             request->send(507, "application/json", "{\"error\":\"Filesystem full\"}");
             return;
@@ -2504,14 +4003,24 @@ void BrewWebServer::handleOTAUpload(AsyncWebServerRequest* request, const String
             otaFile.close();
         }
         LOG_I("OTA upload complete: %d bytes", uploadedSize);
-        
+
+        uint8_t digest[32] = {0};
+        char digestHex[65] = {0};
+        bool haveDigest = shaActive;
+        if (shaActive) {
+            mbedtls_sha256_finish(&shaCtx, digest);
+            mbedtls_sha256_free(&shaCtx);
+            shaActive = false;
+            sha256ToHex(digest, digestHex);
+        }
+
         // Verify file size
         File verifyFile = LittleFS.open(OTA_FILE_PATH, "r");
         bool uploadSuccess = true;
         if (verifyFile) {
             size_t fileSize = verifyFile.size();
             verifyFile.close();
-            
+
             if (fileSize != uploadedSize) {
                 LOG_E("File size mismatch: expected %d, got %d", uploadedSize, fileSize);
                 broadcastLogLevel("error", "Upload failed: file size mismatch");
@@ -2522,7 +4031,19 @@ void BrewWebServer::handleOTAUpload(AsyncWebServerRequest* request, const String
             broadcastLogLevel("error", "Upload failed: file verification error");
             uploadSuccess = false;
         }
-        
+
+        if (uploadSuccess && haveDigest) {
+            if (haveExpectedSha && !digestsEqual(digest, expectedSha, sizeof(digest))) {
+                LOG_E("OTA upload SHA-256 mismatch: computed %s", digestHex);
+                broadcastLogLevel("error", "Upload failed: SHA-256 mismatch");
+                LittleFS.remove(OTA_FILE_PATH);
+                uploadSuccess = false;
+            } else {
+                LOG_I("OTA upload SHA-256: %s%s", digestHex,
+                      haveExpectedSha ? " (verified)" : " (no expected digest supplied)");
+            }
+        }
+
         // Notify clients using stack allocation
         #pragma GCC diagnostic push
         #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -2555,21 +4076,47 @@ void BrewWebServer::handleESP32OTAUpload(AsyncWebServerRequest* request, const S
     static size_t uploadedSize = 0;
     static bool updateStarted = false;
     static bool updateFailed = false;
-    
+    static mbedtls_sha256_context shaCtx;
+    static bool haveExpectedSha = false;
+    static uint8_t expectedSha[32];
+
     if (index == 0) {
         // First chunk - initialize update
         LOG_I("ESP32 OTA upload started: %s", filename.c_str());
         uploadedSize = 0;
         updateStarted = false;
         updateFailed = false;
-        
+
         // Check if OTA is already in progress
         if (_otaInProgress) {
             LOG_E("ESP32 OTA: Another OTA already in progress");
             updateFailed = true;
             return;
         }
-        
+
+        haveExpectedSha = false;
+        if (request->hasHeader("X-Firmware-SHA256")) {
+            if (!parseSha256Hex(request->header("X-Firmware-SHA256"), expectedSha)) {
+                LOG_E("ESP32 OTA: malformed X-Firmware-SHA256 header");
+                updateFailed = true;
+                request->send(400, "application/json", "{\"error\":\"Malformed X-Firmware-SHA256 header\"}");
+                return;
+            }
+            haveExpectedSha = true;
+        }
+
+        // Structural check on the very first byte: every ESP32 app image
+        // starts with the 0xE9 magic. Rejecting here means a wrong file
+        // (e.g. a Pico image or a zip) fails on block one instead of after
+        // the whole transfer has been flashed.
+        if (len > 0 && data[0] != 0xE9) {
+            LOG_E("ESP32 OTA: bad image magic 0x%02X (expected 0xE9)", data[0]);
+            broadcastLogLevel("error", "ESP32 OTA rejected: not an ESP32 firmware image");
+            updateFailed = true;
+            request->send(400, "application/json", "{\"error\":\"Not an ESP32 firmware image\"}");
+            return;
+        }
+
         _otaInProgress = true;
         
         // Broadcast start (content-length includes multipart overhead, so it's approximate)
@@ -2586,23 +4133,28 @@ void BrewWebServer::handleESP32OTAUpload(AsyncWebServerRequest* request, const S
             return;
         }
         
+        mbedtls_sha256_init(&shaCtx);
+        mbedtls_sha256_starts(&shaCtx, 0);
+
         updateStarted = true;
         LOG_I("ESP32 OTA: Update.begin() successful, ready to receive firmware");
     }
-    
+
     // Skip processing if update failed during init
     if (updateFailed || !updateStarted) {
         return;
     }
-    
+
     // Write data chunk to flash
     if (len > 0) {
+        mbedtls_sha256_update(&shaCtx, data, len);
         size_t written = Update.write(data, len);
         if (written != len) {
-            LOG_E("ESP32 OTA: Write failed at %zu bytes. Expected %zu, wrote %zu. Error: %s", 
+            LOG_E("ESP32 OTA: Write failed at %zu bytes. Expected %zu, wrote %zu. Error: %s",
                   uploadedSize, len, written, Update.errorString());
             broadcastLogLevel("error", "ESP32 OTA write failed: %s", Update.errorString());
             Update.abort();
+            mbedtls_sha256_free(&shaCtx);
             updateFailed = true;
             _otaInProgress = false;
             return;
@@ -2634,7 +4186,13 @@ void BrewWebServer::handleESP32OTAUpload(AsyncWebServerRequest* request, const S
     if (final) {
         size_t expectedSize = index + len;  // actual file size from the upload callback
         LOG_I("ESP32 OTA upload complete: %zu bytes received (expected %zu)", uploadedSize, expectedSize);
-        
+
+        uint8_t digest[32];
+        mbedtls_sha256_finish(&shaCtx, digest);
+        mbedtls_sha256_free(&shaCtx);
+        char digestHex[65];
+        sha256ToHex(digest, digestHex);
+
         if (uploadedSize != expectedSize) {
             LOG_E("ESP32 OTA: Size mismatch. Expected %zu, got %zu", expectedSize, uploadedSize);
             broadcastLogLevel("error", "ESP32 OTA failed: Incomplete upload");
@@ -2643,7 +4201,20 @@ void BrewWebServer::handleESP32OTAUpload(AsyncWebServerRequest* request, const S
             request->send(400, "application/json", "{\"error\":\"Incomplete upload\"}");
             return;
         }
-        
+
+        // Digest was accumulated per chunk above, so this is a straight
+        // constant-time compare - nothing gets read back from the partition
+        if (haveExpectedSha && !digestsEqual(digest, expectedSha, sizeof(digest))) {
+            LOG_E("ESP32 OTA: SHA-256 mismatch. Computed %s", digestHex);
+            broadcastLogLevel("error", "ESP32 OTA failed: SHA-256 mismatch");
+            Update.abort();
+            _otaInProgress = false;
+            request->send(400, "application/json", "{\"error\":\"Firmware SHA-256 mismatch\"}");
+            return;
+        }
+        LOG_I("ESP32 OTA SHA-256: %s%s", digestHex,
+              haveExpectedSha ? " (verified)" : " (no expected digest supplied)");
+
         // Finalize the update
         if (!Update.end(true)) {
             LOG_E("ESP32 OTA: Update.end() failed: %s", Update.errorString());
@@ -2679,6 +4250,7 @@ void BrewWebServer::handleESP32OTAUpload(AsyncWebServerRequest* request, const S
         // can finish sending the HTTP 200 response before we restart.
         // Using delay() here would block the async event loop and prevent
         // the response from being sent, causing curl to see only "100 Continue".
+        State.flushNow();  // Commit any staged settings before reboot
         xTaskCreate([](void*) {
             vTaskDelay(pdMS_TO_TICKS(2000));
             ESP.restart();
@@ -1,17 +1,23 @@
 #include "web_server.h"
 #include "config.h"
 #include "memory_utils.h"
-#include "json_buffer_pool.h"
+#include "psram_pool.h"
 #include "cloud_connection.h"
+#include "cloud_schema.h"
 #include "mqtt_client.h"
 #include "state/state_manager.h"
 #include "statistics/statistics_manager.h"
 #include "power_meter/power_meter_manager.h"
 #include "brew_by_weight.h"
 #include "msgpack_helper.h"
+#include "machine_features.h"
 #include "utils/status_change_detector.h"
+#include "utils/status_strings.h"
+#include "utils/token_bucket.h"
+#include "trace.h"
 #include <ArduinoJson.h>
 #include <esp_heap_caps.h>
+#include <mbedtls/base64.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <sys/time.h>
@@ -29,6 +35,12 @@ static uint8_t* g_statusBuffer = nullptr;  // Changed to uint8_t for binary Mess
 static const size_t STATUS_BUFFER_SIZE = 2048;  // Reduced - MessagePack is smaller
 static const size_t STATUS_DOC_SIZE = 8192;  // Increased to 8KB to prevent heap overflow
 
+// Reusable chunk chain for one-shot MessagePack encodes (broadcastJson, the
+// compact cloud frame). Grows to the largest frame ever seen and keeps its
+// chunks, so steady-state encoding causes no pool traffic. Like
+// g_statusBuffer, only ever touched from the main loop task.
+static MsgPackChain g_msgpackChain;
+
 void initBroadcastBuffers() {
     if (!g_statusDoc) {
         g_statusDoc = new SpiRamJsonDocument(STATUS_DOC_SIZE);  // 8KB to prevent heap overflow
@@ -38,15 +50,163 @@ void initBroadcastBuffers() {
     }
 }
 
+// Post-boot warming pass. initBroadcastBuffers() only allocates; the first
+// real broadcast still paid for PSRAM page faults, the JsonDocument's
+// internal pool growth, and the msgpack chain's first chunk allocations -
+// a multi-hundred-ms first response right after every fleet OTA reboot.
+// Build and serialize one throwaway keyframe-sized frame now, while nobody
+// is connected, so the first client gets steady-state latency.
+void warmBroadcastBuffers() {
+    initBroadcastBuffers();
+    if (!g_statusDoc || !g_statusBuffer) {
+        return;
+    }
+
+    // Touch every page of the serialization buffer
+    memset(g_statusBuffer, 0, STATUS_BUFFER_SIZE);
+
+    // Grow the document's pool to roughly a full status keyframe's footprint
+    g_statusDoc->clear();
+    JsonDocument& doc = *g_statusDoc;
+    doc["type"] = "status";
+    JsonObject warm = doc["warm"].to<JsonObject>();
+    char key[8];
+    for (int i = 0; i < 80; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        warm[key] = 1234567 + i;
+    }
+
+    // One encode through each serialization path: the flat buffer
+    // (delta/keepalive/full status) and the chunk chain (broadcastJson,
+    // compact cloud frames) - the chain keeps its chunks after reset()
+    MessagePackHelper::serialize(doc, g_statusBuffer, STATUS_BUFFER_SIZE);
+    MessagePackHelper::serialize(doc, g_msgpackChain);
+
+    g_statusDoc->clear();
+}
+
+// Degraded broadcast policy: with a room full of browser sessions every
+// fan-out multiplies, and the shot timer lags on all of them. Past the
+// client threshold we stretch the local delta interval (changes keep
+// coalescing in the scheduler) and route log broadcasts only to the primary
+// client - the oldest connection, which is the session that set up the shot.
+void BrewWebServer::setDegradedPolicy(uint8_t clientThreshold, unsigned long statusIntervalMs) {
+    _degradedClientThreshold = clientThreshold;
+    _degradedStatusInterval = statusIntervalMs;
+    // Re-applied on the next broadcast tick by updateBroadcastPolicy()
+    _degradedMode = false;
+    _broadcastScheduler.setMinInterval(BroadcastScheduler::SINK_LOCAL, 0);
+}
+
+void BrewWebServer::updateBroadcastPolicy() {
+    size_t clients = _ws.count() + _events.count();
+    bool degraded = _degradedClientThreshold > 0 && clients >= _degradedClientThreshold;
+    if (degraded != _degradedMode) {
+        _degradedMode = degraded;
+        _broadcastScheduler.setMinInterval(BroadcastScheduler::SINK_LOCAL,
+                                           degraded ? _degradedStatusInterval : 0);
+        if (degraded) {
+            LOG_W("Degraded broadcast mode: %zu clients (threshold %u), deltas every %lums",
+                  clients, _degradedClientThreshold, _degradedStatusInterval);
+        } else {
+            LOG_I("Degraded broadcast mode off (%zu clients)", clients);
+        }
+    }
+
+    // Primary = oldest surviving connection (IDs are assigned monotonically)
+    uint32_t primary = 0;
+    for (auto& client : _ws.getClients()) {
+        if (client.status() == WS_CONNECTED && (primary == 0 || client.id() < primary)) {
+            primary = client.id();
+        }
+    }
+    _primaryClientId = primary;
+}
+
+// Send a broadcast frame to local clients. Clients that negotiated MessagePack
+// at upgrade time (?proto=msgpack) get binary frames (~60% smaller than the
+// JSON text); everyone else gets the JSON text unchanged. The MessagePack
+// serialization only runs when at least one opted-in client is connected.
+// primaryOnly restricts the frame to the primary client (degraded mode).
+void BrewWebServer::sendFrameToLocalClients(const JsonDocument& doc, const char* jsonBuffer,
+                                            bool primaryOnly) {
+    if (!jsonBuffer || (_ws.count() == 0 && _events.count() == 0)) {
+        return;
+    }
+
+    // SSE fallback clients get the identical JSON text (SSE is text-only,
+    // so there is no MessagePack opt-in). The event source queues the one
+    // buffer per client - nothing is re-serialized. Degraded mode routes
+    // log-class frames to the primary WS client only, and SSE clients are
+    // never primary, so primaryOnly frames skip them entirely.
+    if (!primaryOnly && _events.count() > 0) {
+        _events.send(jsonBuffer);
+    }
+
+    if (_ws.count() == 0) {
+        return;
+    }
+
+    bool haveMsgPackClient = false;
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_msgpackClients[i] != 0) {
+            haveMsgPackClient = true;
+            break;
+        }
+    }
+    if (!haveMsgPackClient && !primaryOnly) {
+        _ws.textAll(jsonBuffer);
+        return;
+    }
+
+    // Serialize lazily, once - encode into the chunk chain first so the
+    // contiguous frame block is allocated at the exact frame size instead of
+    // a worst-case guess from the JSON text length
+    uint8_t* packed = nullptr;
+    size_t packedSize = 0;
+
+    for (auto& client : _ws.getClients()) {
+        if (client.status() != WS_CONNECTED || !client.canSend()) {
+            continue;
+        }
+        if (primaryOnly && client.id() != _primaryClientId) {
+            continue;
+        }
+        if (isClientMsgPack(client.id())) {
+            if (!packed) {
+                size_t frameSize = MessagePackHelper::serialize(doc, g_msgpackChain);
+                if (frameSize > 0) {
+                    packed = (uint8_t*)PsramPool::instance().allocate(frameSize, "broadcast");
+                    if (packed) {
+                        packedSize = g_msgpackChain.gather(packed, frameSize);
+                    }
+                }
+            }
+            if (packed && packedSize > 0) {
+                client.binary(packed, packedSize);
+            } else {
+                client.text(jsonBuffer);  // Fall back to text if serialization failed
+            }
+        } else {
+            client.text(jsonBuffer);
+        }
+        yield();
+    }
+
+    if (packed) {
+        PsramPool::instance().release(packed);
+    }
+}
+
 // Internal helper to broadcast a formatted log message
 // CRITICAL: During OTA, the WebSocket queue can fill up quickly.
 // Check availableForWriteAll() before sending to prevent queue overflow
 // which causes "Too many messages queued" and disconnects the client.
-static void broadcastLogInternal(AsyncWebSocket* ws, CloudConnection* cloudConnection, 
-                                 const char* level, const char* message, const char* source = "esp32") {
+static void broadcastLogRaw(BrewWebServer* self, AsyncWebSocket* ws, CloudConnection* cloudConnection,
+                            const char* level, const char* message, const char* source) {
     // Defensive checks: ensure all required pointers are valid
-    if (!message || !ws) return;
-    
+    if (!message || !self || !ws) return;
+
     // CRITICAL FIX: Don't cleanup clients on every log message - it's too expensive
     // Rely on periodic cleanup in sendPingToClients() (every 5s) or loop() (every 1s)
     // This prevents performance issues and race conditions during high-frequency logging
@@ -67,45 +227,75 @@ static void broadcastLogInternal(AsyncWebSocket* ws, CloudConnection* cloudConne
     
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
         
         // Only send to WebSocket if clients can receive (prevents queue overflow)
-        // Iterate clients individually to avoid blocking on slow clients
-        // This prevents one slow client from blocking all clients
-        if (ws->count() > 0) {
-            // FIX: Iterate over clients list directly instead of using index
-            // ws->client(i) expects an ID, not an index!
-            // getClients() returns references, so use auto& and access with . not ->
-            for (auto& client : ws->getClients()) {
-                if (client.status() == WS_CONNECTED && client.canSend()) {
-                    client.text(jsonBuffer);
-                }
-            }
-        }
-        
-        // Always try to send to cloud - it has its own queue management
+        // sendFrameToLocalClients iterates clients individually to avoid
+        // blocking on slow clients and honors per-client MessagePack opt-in.
+        // In degraded mode (many clients) logs go only to the primary client.
+        self->sendFrameToLocalClients(doc, jsonBuffer, self->isDegradedBroadcastMode());
+
+        // Always try to send to cloud - it has its own queue management.
+        // Log class: quota'd and dropped under pressure, never ahead of events
         if (cloudConnection) {
-            cloudConnection->send(jsonBuffer);
+            cloudConnection->send(jsonBuffer, CloudConnection::PRIORITY_LOG);
         }
         
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
+    }
+}
+
+// Per-source token buckets in front of the fan-out above. A log storm
+// (wifi_manager during AP flaps is the classic) can hit hundreds of
+// lines/sec, and the JSON serialize + per-client sends + cloud enqueue is
+// exactly the CPU that should stay available while things are going
+// wrong. Serial and the log buffer have their own budgets - this gate
+// only protects the broadcast path.
+static TokenBucket s_logBroadcastBuckets[2] = {
+    { 20, 5, 20, 0, 0 },  // esp32
+    { 20, 5, 20, 0, 0 },  // pico
+};
+static portMUX_TYPE s_logBroadcastMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void broadcastLogInternal(BrewWebServer* self, AsyncWebSocket* ws, CloudConnection* cloudConnection,
+                                 const char* level, const char* message, const char* source = "esp32") {
+    if (!message || !self || !ws) return;
+
+    // Bucket accounting under a spinlock - log calls arrive from many
+    // tasks on both cores
+    int idx = (source && strcmp(source, "pico") == 0) ? 1 : 0;
+    uint32_t now = millis();
+    taskENTER_CRITICAL(&s_logBroadcastMux);
+    bool allowed = s_logBroadcastBuckets[idx].allow(now);
+    uint32_t reclaimed = allowed ? s_logBroadcastBuckets[idx].takeSuppressed() : 0;
+    taskEXIT_CRITICAL(&s_logBroadcastMux);
+    if (!allowed) {
+        return;  // Storm in progress - counted, summarized when it ends
     }
+
+    if (reclaimed) {
+        char summary[48];
+        snprintf(summary, sizeof(summary), "...%lu similar suppressed",
+                 (unsigned long)reclaimed);
+        broadcastLogRaw(self, ws, cloudConnection, "warn", summary, source);
+    }
+    broadcastLogRaw(self, ws, cloudConnection, level, message, source);
 }
 
 // Direct message broadcast (no formatting) - for platform_log
 void BrewWebServer::broadcastLogMessage(const char* level, const char* message) {
     if (!message) return;
-    broadcastLogInternal(&_ws, _cloudConnection, level, message, "esp32");
+    broadcastLogInternal(this, &_ws, _cloudConnection, level, message, "esp32");
 }
 
 // Broadcast log message with explicit source (for Pico logs)
 void BrewWebServer::broadcastLogMessageWithSource(const char* level, const char* message, const char* source) {
     if (!message) return;
-    broadcastLogInternal(&_ws, _cloudConnection, level, message, source ? source : "esp32");
+    broadcastLogInternal(this, &_ws, _cloudConnection, level, message, source ? source : "esp32");
 }
 
 // C wrapper for platform_log to broadcast via WebSocket
@@ -134,7 +324,7 @@ void BrewWebServer::broadcastLog(const char* format, ...) {
     vsnprintf(message, sizeof(message), format, args);
     va_end(args);
     
-    broadcastLogInternal(&_ws, _cloudConnection, "info", message, "esp32");
+    broadcastLogInternal(this, &_ws, _cloudConnection, "info", message, "esp32");
 }
 
 // Variadic version with explicit level (level, format, ...args)
@@ -148,7 +338,7 @@ void BrewWebServer::broadcastLogLevel(const char* level, const char* format, ...
     vsnprintf(message, sizeof(message), format, args);
     va_end(args);
     
-    broadcastLogInternal(&_ws, _cloudConnection, level, message, "esp32");
+    broadcastLogInternal(this, &_ws, _cloudConnection, level, message, "esp32");
 }
 
 
@@ -173,28 +363,20 @@ void BrewWebServer::broadcastPicoMessage(uint8_t type, const uint8_t* payload, s
     
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        _ws.textAll(jsonBuffer);
-        
+        sendFrameToLocalClients(doc, jsonBuffer);
+
         // Also send to cloud - use jsonBuffer directly to avoid String allocation
+        // Pico debug traffic rides the log class (high volume, low urgency)
         if (_cloudConnection) {
-            _cloudConnection->send(jsonBuffer);
+            _cloudConnection->send(jsonBuffer, CloudConnection::PRIORITY_LOG);
         }
-        
-        // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
-    }
-}
 
-void BrewWebServer::broadcastRaw(const String& json) {
-    _ws.textAll(json.c_str(), json.length());
-    
-    // Also send to cloud
-    if (_cloudConnection) {
-        _cloudConnection->send(json);
+        // Release buffer back to pool (or free if dynamically allocated)
+        PsramPool::instance().release(jsonBuffer);
     }
 }
 
@@ -210,15 +392,22 @@ void BrewWebServer::broadcastRaw(const char* json) {
 
 // =============================================================================
 // Build Delta Status - Only changed fields
-// Returns true if delta was built, false if no changes
+// Streams MessagePack directly into the output buffer with MsgPackWriter -
+// no intermediate JsonDocument build/walk on the 500ms tick. Sections whose
+// change bits are clear cost nothing.
+// Returns bytes written, or 0 if nothing changed (or the buffer overflowed)
 // =============================================================================
-bool BrewWebServer::buildDeltaStatus(const ui_state_t& state, const ChangedFields& changed, 
-                                      uint32_t sequence, JsonDocument& doc) {
-    // Clear document and set type
-    doc.clear();
-    doc["type"] = "status_delta";
-    doc["seq"] = sequence;
-    
+size_t BrewWebServer::buildDeltaStatus(const ui_state_t& state, const ChangedFields& changed,
+                                       uint32_t sequence, uint8_t* buffer, size_t bufferSize) {
+    if (!changed.anyChanged()) {
+        return 0;
+    }
+
+    MsgPackWriter w(buffer, bufferSize);
+    w.beginMap();
+    w.key("type"); w.writeStr("status_delta");
+    w.key("seq");  w.writeUint(sequence);
+
     // Track timestamps (same logic as full status)
     static uint64_t machineOnTimestamp = 0;
     static uint64_t lastShotTimestamp = 0;
@@ -250,147 +439,136 @@ bool BrewWebServer::buildDeltaStatus(const ui_state_t& state, const ChangedField
     wasBrewing = state.is_brewing;
     
     // Machine section
-    if (changed.machine_state || changed.machine_mode || changed.heating_strategy || 
+    if (changed.machine_state || changed.machine_mode || changed.heating_strategy ||
         changed.is_heating || changed.is_brewing) {
-        JsonObject machine = doc["machine"].to<JsonObject>();
-        
+        w.key("machine");
+        w.beginMap();
+
         if (changed.machine_state || changed.machine_mode) {
-            const char* stateStr = "unknown";
-            switch (state.machine_state) {
-                case UI_STATE_INIT: stateStr = "init"; break;
-                case UI_STATE_IDLE: stateStr = "idle"; break;
-                case UI_STATE_HEATING: stateStr = "heating"; break;
-                case UI_STATE_READY: stateStr = "ready"; break;
-                case UI_STATE_BREWING: stateStr = "brewing"; break;
-                case UI_STATE_FAULT: stateStr = "fault"; break;
-                case UI_STATE_SAFE: stateStr = "safe"; break;
-                case UI_STATE_ECO: stateStr = "eco"; break;
-            }
-            machine["state"] = stateStr;
-            
-            const char* modeStr = "standby";
-            if (state.machine_state >= UI_STATE_HEATING && state.machine_state <= UI_STATE_BREWING) {
-                modeStr = "on";
-            } else if (state.machine_state == UI_STATE_ECO) {
-                modeStr = "eco";
-            }
-            machine["mode"] = modeStr;
+            w.key("state"); w.writeStr(statusStateString(state.machine_state));
+            w.key("mode");  w.writeStr(statusModeString(state.machine_state));
         }
-        
-        if (changed.is_heating) machine["isHeating"] = state.is_heating;
-        if (changed.is_brewing) machine["isBrewing"] = state.is_brewing;
-        if (changed.heating_strategy) machine["heatingStrategy"] = state.heating_strategy;
-        
+
+        if (changed.is_heating) { w.key("isHeating"); w.writeBool(state.is_heating); }
+        if (changed.is_brewing) { w.key("isBrewing"); w.writeBool(state.is_brewing); }
+        if (changed.heating_strategy) { w.key("heatingStrategy"); w.writeUint(state.heating_strategy); }
+
         // Timestamps (include if machine state changed)
         if (changed.machine_state) {
             if (machineOnTimestamp > 0) {
-                machine["machineOnTimestamp"] = (double)machineOnTimestamp;
+                w.key("machineOnTimestamp"); w.writeDouble((double)machineOnTimestamp);
             }
             if (lastShotTimestamp > 0) {
-                machine["lastShotTimestamp"] = (double)lastShotTimestamp;
+                w.key("lastShotTimestamp"); w.writeDouble((double)lastShotTimestamp);
             }
         }
+        w.endMap();
     }
-    
-    // Temperatures
+
+    // Temperatures (steam group only for machines that have a steam boiler)
     if (changed.temps) {
-        JsonObject temps = doc["temps"].to<JsonObject>();
-        JsonObject brew = temps["brew"].to<JsonObject>();
-        brew["current"] = state.brew_temp;
-        brew["setpoint"] = state.brew_setpoint;
-        
-        JsonObject steam = temps["steam"].to<JsonObject>();
-        steam["current"] = state.steam_temp;
-        steam["setpoint"] = state.steam_setpoint;
-        
-        temps["group"] = state.group_temp;
+        w.key("temps");
+        w.beginMap();
+        w.key("brew");
+        w.beginMap();
+        w.key("current");  w.writeFloat(state.brew_temp);
+        w.key("setpoint"); w.writeFloat(state.brew_setpoint);
+        w.endMap();
+        if (machine_has_steam_boiler(state.machine_type)) {
+            w.key("steam");
+            w.beginMap();
+            w.key("current");  w.writeFloat(state.steam_temp);
+            w.key("setpoint"); w.writeFloat(state.steam_setpoint);
+            w.endMap();
+        }
+        w.key("group"); w.writeFloat(state.group_temp);
+        w.endMap();
     }
-    
+
     // Pressure
     if (changed.pressure) {
-        doc["pressure"] = state.pressure;
+        w.key("pressure"); w.writeFloat(state.pressure);
     }
-    
+
     // Power
     if (changed.power) {
-        JsonObject power = doc["power"].to<JsonObject>();
-        power["current"] = state.power_watts;
-        
+        w.key("power");
+        w.beginMap();
+        w.key("current"); w.writeFloat(state.power_watts);
+        w.key("brewWh"); w.writeUint(state.brew_energy_wh);
+        if (machine_has_steam_boiler(state.machine_type)) {
+            w.key("steamWh"); w.writeUint(state.steam_energy_wh);
+        }
+
         // Include power meter if available (simplified for delta)
         PowerMeterReading meterReading;
         if (powerMeterManager && powerMeterManager->getReading(meterReading)) {
-            power["voltage"] = meterReading.voltage;
+            w.key("voltage"); w.writeFloat(meterReading.voltage);
         } else {
-            power["voltage"] = State.settings().power.mainsVoltage;
+            w.key("voltage"); w.writeFloat(State.settings().power.mainsVoltage);
         }
+        w.endMap();
     }
-    
+
     // Scale
-    if (changed.scale_weight || changed.scale_flow_rate || changed.scale_connected || 
+    if (changed.scale_weight || changed.scale_flow_rate || changed.scale_connected ||
         changed.target_weight) {
-        JsonObject scale = doc["scale"].to<JsonObject>();
-        if (changed.scale_connected) scale["connected"] = state.scale_connected;
-        if (changed.scale_weight) scale["weight"] = state.brew_weight;
-        if (changed.scale_flow_rate) scale["flowRate"] = state.flow_rate;
-        
+        w.key("scale");
+        w.beginMap();
+        if (changed.scale_connected) { w.key("connected"); w.writeBool(state.scale_connected); }
+        if (changed.scale_weight) { w.key("weight"); w.writeFloat(state.brew_weight); }
+        if (changed.scale_flow_rate) { w.key("flowRate"); w.writeFloat(state.flow_rate); }
+
         if (changed.target_weight && brewByWeight) {
-            JsonObject bbw = scale["bbw"].to<JsonObject>();
-            bbw["targetWeight"] = brewByWeight->getTargetWeight();
-        }
-    }
-    
-    // Brew time (when brewing)
-    if (changed.brew_time && state.is_brewing) {
-        // Include in machine section for delta
-        if (!doc["machine"].is<JsonObject>()) {
-            doc["machine"].to<JsonObject>();
+            w.key("bbw");
+            w.beginMap();
+            w.key("targetWeight"); w.writeFloat(brewByWeight->getTargetWeight());
+            w.endMap();
         }
-        // Note: brew_time_ms is typically tracked separately, but for simplicity
-        // we'll include it in the delta when brewing
+        w.endMap();
     }
-    
+
     // Connections
     if (changed.connections) {
-        JsonObject connections = doc["connections"].to<JsonObject>();
-        connections["pico"] = state.pico_connected;
-        connections["wifi"] = state.wifi_connected;
-        connections["mqtt"] = state.mqtt_connected;
-        connections["scale"] = state.scale_connected;
-        connections["cloud"] = state.cloud_connected;
+        w.key("connections");
+        w.beginMap();
+        w.key("pico");  w.writeBool(state.pico_connected);
+        w.key("wifi");  w.writeBool(state.wifi_connected);
+        w.key("mqtt");  w.writeBool(state.mqtt_connected);
+        w.key("scale"); w.writeBool(state.scale_connected);
+        w.key("cloud"); w.writeBool(state.cloud_connected);
+        w.endMap();
     }
-    
+
     // Water
     if (changed.water_low) {
-        JsonObject water = doc["water"].to<JsonObject>();
-        water["tankLevel"] = state.water_low ? "low" : "ok";
+        w.key("water");
+        w.beginMap();
+        w.key("tankLevel"); w.writeStr(state.water_low ? "low" : "ok");
+        w.endMap();
     }
-    
-    // Alarm
-    if (changed.alarm) {
-        if (!doc["machine"].is<JsonObject>()) {
-            doc["machine"].to<JsonObject>();
-        }
-        // Note: alarm fields would go in machine section
-    }
-    
+
     // Cleaning
     if (changed.cleaning) {
-        JsonObject cleaning = doc["cleaning"].to<JsonObject>();
-        cleaning["brewCount"] = state.brew_count;
-        cleaning["reminderDue"] = state.cleaning_reminder;
+        w.key("cleaning");
+        w.beginMap();
+        w.key("brewCount");   w.writeUint(state.brew_count);
+        w.key("reminderDue"); w.writeBool(state.cleaning_reminder);
+        w.endMap();
     }
-    
+
     // WiFi (only if changed)
     if (changed.wifi) {
-        JsonObject wifi = doc["wifi"].to<JsonObject>();
-        wifi["connected"] = state.wifi_connected;
-        wifi["apMode"] = state.wifi_ap_mode;
-        wifi["ip"] = state.wifi_ip;
-        wifi["rssi"] = state.wifi_rssi;
-        
+        w.key("wifi");
+        w.beginMap();
+        w.key("connected"); w.writeBool(state.wifi_connected);
+        w.key("apMode");    w.writeBool(state.wifi_ap_mode);
+        w.key("ip");        w.writeStr(state.wifi_ip);
+        w.key("rssi");      w.writeInt(state.wifi_rssi);
+
         WiFiStatus wifiStatus = _wifiManager.getStatus();
-        wifi["staticIp"] = wifiStatus.staticIp;
-        
+        w.key("staticIp"); w.writeBool(wifiStatus.staticIp);
+
         char gatewayBuf[16], subnetBuf[16], dns1Buf[16], dns2Buf[16];
         strncpy(gatewayBuf, wifiStatus.gateway.c_str(), sizeof(gatewayBuf) - 1);
         gatewayBuf[sizeof(gatewayBuf) - 1] = '\0';
@@ -400,61 +578,73 @@ bool BrewWebServer::buildDeltaStatus(const ui_state_t& state, const ChangedField
         dns1Buf[sizeof(dns1Buf) - 1] = '\0';
         strncpy(dns2Buf, wifiStatus.dns2.c_str(), sizeof(dns2Buf) - 1);
         dns2Buf[sizeof(dns2Buf) - 1] = '\0';
-        
-        wifi["gateway"] = gatewayBuf;
-        wifi["subnet"] = subnetBuf;
-        wifi["dns1"] = dns1Buf;
-        wifi["dns2"] = dns2Buf;
+
+        w.key("gateway"); w.writeStr(gatewayBuf);
+        w.key("subnet");  w.writeStr(subnetBuf);
+        w.key("dns1");    w.writeStr(dns1Buf);
+        w.key("dns2");    w.writeStr(dns2Buf);
+        w.endMap();
     }
-    
+
     // MQTT (only if changed)
     if (changed.mqtt) {
-        JsonObject mqtt = doc["mqtt"].to<JsonObject>();
+        w.key("mqtt");
+        w.beginMap();
         MQTTConfig mqttConfig = _mqttClient.getConfig();
-        mqtt["enabled"] = mqttConfig.enabled;
-        mqtt["connected"] = _mqttClient.isConnected();
-        
+        w.key("enabled");   w.writeBool(mqttConfig.enabled);
+        w.key("connected"); w.writeBool(_mqttClient.isConnected());
+
         char brokerBuf[64], topicBuf[32];
         strncpy(brokerBuf, mqttConfig.broker, sizeof(brokerBuf) - 1);
         brokerBuf[sizeof(brokerBuf) - 1] = '\0';
         strncpy(topicBuf, mqttConfig.topic_prefix, sizeof(topicBuf) - 1);
         topicBuf[sizeof(topicBuf) - 1] = '\0';
-        
-        mqtt["broker"] = brokerBuf;
-        mqtt["topic"] = topicBuf;
+
+        w.key("broker"); w.writeStr(brokerBuf);
+        w.key("topic");  w.writeStr(topicBuf);
+        w.endMap();
     }
-    
+
     // Stats (only if changed - expensive to compute)
     if (changed.stats) {
-        JsonObject stats = doc["stats"].to<JsonObject>();
+        w.key("stats");
+        w.beginMap();
         BrewOS::FullStatistics fullStats;
         Stats.getFullStatistics(fullStats);
-        
-        JsonObject daily = stats["daily"].to<JsonObject>();
+
         BrewOS::PeriodStats dailyStats;
         Stats.getDailyStats(dailyStats);
-        daily["shotCount"] = dailyStats.shotCount;
-        daily["avgBrewTimeMs"] = dailyStats.avgBrewTimeMs;
-        daily["totalKwh"] = dailyStats.totalKwh;
-        
-        JsonObject lifetime = stats["lifetime"].to<JsonObject>();
-        lifetime["totalShots"] = fullStats.lifetime.totalShots;
-        lifetime["avgBrewTimeMs"] = fullStats.lifetime.avgBrewTimeMs;
-        lifetime["totalKwh"] = fullStats.lifetime.totalKwh;
-        
-        stats["sessionShots"] = fullStats.sessionShots;
-        stats["shotsToday"] = dailyStats.shotCount;
+        w.key("daily");
+        w.beginMap();
+        w.key("shotCount");     w.writeUint(dailyStats.shotCount);
+        w.key("avgBrewTimeMs"); w.writeUint(dailyStats.avgBrewTimeMs);
+        w.key("totalKwh");      w.writeFloat(dailyStats.totalKwh);
+        w.endMap();
+
+        w.key("lifetime");
+        w.beginMap();
+        w.key("totalShots");    w.writeUint(fullStats.lifetime.totalShots);
+        w.key("avgBrewTimeMs"); w.writeUint(fullStats.lifetime.avgBrewTimeMs);
+        w.key("totalKwh");      w.writeFloat(fullStats.lifetime.totalKwh);
+        w.endMap();
+
+        w.key("sessionShots"); w.writeUint(fullStats.sessionShots);
+        w.key("shotsToday");   w.writeUint(dailyStats.shotCount);
+        w.endMap();
     }
-    
+
     // ESP32 (only if changed)
     if (changed.esp32) {
-        JsonObject esp32 = doc["esp32"].to<JsonObject>();
-        esp32["version"] = ESP32_VERSION;
-        esp32["freeHeap"] = ESP.getFreeHeap();
-        esp32["uptime"] = millis();
+        w.key("esp32");
+        w.beginMap();
+        w.key("version");  w.writeStr(ESP32_VERSION);
+        w.key("freeHeap"); w.writeUint(ESP.getFreeHeap());
+        w.key("uptime");   w.writeUint(millis());
+        w.endMap();
     }
-    
-    return changed.anyChanged();
+
+    w.endMap();
+    return w.finish();
 }
 
 // =============================================================================
@@ -463,6 +653,8 @@ bool BrewWebServer::buildDeltaStatus(const ui_state_t& state, const ChangedField
 // Optimized to only build JSON/MessagePack when actually needed
 // =============================================================================
 void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
+    TRACE_SCOPE(TRACE_PT_BROADCAST_FULL_STATUS);
+
     // Skip status broadcasts during OTA to prevent WebSocket queue overflow
     if (_otaInProgress) {
         return;
@@ -477,222 +669,137 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
         }
     }
     
-    // Check if we have local WebSocket clients (always send to them every 500ms)
-    bool hasLocalClients = (_ws.count() > 0);
-    
-    // Check cloud connection and change detection BEFORE building expensive JSON
-    static StatusChangeDetector cloudChangeDetector;
-    static StatusChangeDetector localChangeDetector;  // Separate detector for local clients
-    static unsigned long lastCloudHeartbeat = 0;
-    static unsigned long lastFullStatusSync = 0;  // Periodic full status sync
-    static bool lastCloudConnected = false;
-    static bool isKeepaliveForced = false;  // Track if this send is a keepalive (function scope)
-    const unsigned long CLOUD_HEARTBEAT_INTERVAL = 30000;  // 30 seconds minimum heartbeat
-    const unsigned long FULL_STATUS_SYNC_INTERVAL = 300000;  // 5 minutes for full status sync
-    
+    // Re-evaluate the degraded policy (stretches the local rate limit and
+    // picks the primary client when many sessions are connected)
+    updateBroadcastPolicy();
+
+    // Ask the scheduler who is due this tick. It owns the per-sink change
+    // detectors, heartbeat timers and rate limits that used to live here
+    // (and in loopUpdateMQTTStatus) as a pile of ad-hoc statics.
+    bool hasLocalClients = (_ws.count() > 0) || (_events.count() > 0);
     bool cloudConnected = _cloudConnection && _cloudConnection->isConnected();
-    bool cloudChanged = false;
-    bool cloudHeartbeatDue = false;
-    ChangedFields cloudChangedFields;
-    
-    if (cloudConnected) {
-        // Reset detector when cloud connection is established (ensures first update is sent)
-        if (!lastCloudConnected) {
-            cloudChangeDetector.reset();
-        }
-        lastCloudConnected = true;
-        
-        cloudChanged = cloudChangeDetector.hasChanged(state, &cloudChangedFields);
-        unsigned long now = millis();
-        cloudHeartbeatDue = (now - lastCloudHeartbeat >= CLOUD_HEARTBEAT_INTERVAL);
-    } else {
-        lastCloudConnected = false;
-    }
-    
-    bool shouldSendToCloud = cloudConnected && (cloudChanged || cloudHeartbeatDue);
-    
-    // Check local client changes
-    bool localChanged = false;
-    ChangedFields localChangedFields;
-    bool isFirstLocalMessage = false;
-    static bool lastHasLocalClients = false;
-    static unsigned long lastClientConnectTime = 0;
-    if (hasLocalClients) {
-        // Reset detector when local client connects (ensures first update is sent)
-        if (!lastHasLocalClients && hasLocalClients) {
-            localChangeDetector.reset();
-            isFirstLocalMessage = true;
-            lastClientConnectTime = millis();
-            LOG_I("New local client connected, will send initial status");
-        }
-        lastHasLocalClients = hasLocalClients;
-        
-        // Always send status for first 2 seconds after client connects
-        // This ensures client receives initial state even if canSend() was false initially
-        unsigned long now = millis();
-        if (now - lastClientConnectTime < 2000) {
-            isFirstLocalMessage = true;
-        }
-        
-        localChanged = localChangeDetector.hasChanged(state);
-        
-        // For local clients: Send status every 2 seconds as keepalive even when idle
-        // This ensures client receives regular updates and doesn't mark connection as stale
-        static unsigned long lastLocalKeepalive = 0;
-        const unsigned long LOCAL_KEEPALIVE_INTERVAL = 2000;  // 2 seconds
-        
-        // Initialize keepalive timer on first client connection
-        if (!lastHasLocalClients && hasLocalClients) {
-            lastLocalKeepalive = now;  // Initialize to current time
-        }
-        
-        isKeepaliveForced = false;  // Reset flag (declared at function scope above)
-        
-        // Only set keepalive if we actually have local clients
-        if (hasLocalClients && !localChanged && !isFirstLocalMessage) {
-            unsigned long timeSinceLastKeepalive = now - lastLocalKeepalive;
-            if (timeSinceLastKeepalive >= LOCAL_KEEPALIVE_INTERVAL) {
-                // Force send status as keepalive for local clients
-                localChanged = true;
-                isKeepaliveForced = true;
-                lastLocalKeepalive = now;
-            }
-        } else if (localChanged) {
-            // Reset keepalive timer when we send due to actual changes
-            lastLocalKeepalive = now;
+
+    // Backpressure from the cloud send pipeline: when its queue backs up
+    // (TLS stall, radio dropout), stretch the cloud delta interval instead of
+    // piling more PSRAM buffers onto the queue. Pending changes keep
+    // coalescing in the scheduler and flush as one delta once it drains.
+    static bool cloudThrottled = false;
+    bool cloudBacklogged = cloudConnected && _cloudConnection->isBacklogged();
+    if (cloudBacklogged != cloudThrottled) {
+        cloudThrottled = cloudBacklogged;
+        _broadcastScheduler.setMinInterval(BroadcastScheduler::SINK_CLOUD,
+                                           cloudBacklogged ? 2000 : 0);
+        if (cloudBacklogged) {
+            LOG_W("Cloud send queue backing up - throttling cloud deltas to 2s");
+        } else {
+            LOG_I("Cloud send queue drained - cloud deltas back to full rate");
         }
-        
-        if (localChanged && !isKeepaliveForced) {
-            localChangedFields = localChangeDetector.getChangedFields(state);
+    }
+
+    // Eco standby: stretch MQTT to a once-a-minute heartbeat. Temperatures
+    // barely move during setback and overnight sites care about standby
+    // power, not dashboard latency. Recomputed from machine state every
+    // tick, so the stretch lifts within one broadcast pass of waking (the
+    // same edge that restores frame pacing and BLE probing).
+    static bool ecoStretched = false;
+    bool ecoMode = (state.machine_state == UI_STATE_ECO);
+    if (ecoMode != ecoStretched) {
+        ecoStretched = ecoMode;
+        _broadcastScheduler.setMinInterval(BroadcastScheduler::SINK_MQTT,
+                                           ecoMode ? 60000 : 0);
+        LOG_I("Eco standby: MQTT status %s", ecoMode ? "stretched to 60s" : "back to full rate");
+    }
+
+    // Cloud heartbeat cadence follows measured link quality: CloudConnection
+    // probes the relay with pings and classifies the link from pong RTT and
+    // misses. Good links idle at 120s keepalives (a fraction of the fixed-30s
+    // steady-state traffic), flaky ones tighten to 15s so dead links surface
+    // fast. Only poke the scheduler when the recommendation changes.
+    if (cloudConnected) {
+        static unsigned long cloudHeartbeat = 0;
+        unsigned long heartbeat = _cloudConnection->statusHeartbeatMs();
+        if (heartbeat != cloudHeartbeat) {
+            cloudHeartbeat = heartbeat;
+            _broadcastScheduler.setKeepaliveInterval(BroadcastScheduler::SINK_CLOUD, heartbeat);
+            LOG_I("Cloud heartbeat interval -> %lus (link quality)", heartbeat / 1000);
         }
-    } else {
-        lastHasLocalClients = false;
+    }
+
+    const bool connected[BroadcastScheduler::SINK_COUNT] = {
+        hasLocalClients,              // SINK_LOCAL
+        cloudConnected,               // SINK_CLOUD
+        _mqttClient.isConnected()     // SINK_MQTT
+    };
+    unsigned long now = millis();
+    BroadcastScheduler::Decision decision = _broadcastScheduler.evaluate(state, connected, now);
+    
+    if (!decision.anySend()) {
+        return;  // Nothing due anywhere - skip all JSON/MessagePack building
     }
     
-    // Early exit: only build JSON/MessagePack if we have local clients OR need to send to cloud
-    // If keepalive was forced but there are no local clients, skip everything (keepalive is only for local clients)
-    if (isKeepaliveForced && !hasLocalClients) {
-        return;  // Keepalive is only for local clients, skip if none connected
+    // MQTT publishes its own Home-Assistant-shaped JSON on its own topics, so
+    // it shares the schedule (coalescing, rate limit, heartbeat) but not the
+    // payload. Heartbeats republish the retained full status.
+    if (decision.send[BroadcastScheduler::SINK_MQTT]) {
+        if (decision.full[BroadcastScheduler::SINK_MQTT] ||
+            decision.keepalive[BroadcastScheduler::SINK_MQTT]) {
+            _mqttClient.publishStatus(state);
+        } else {
+            _mqttClient.publishStatusDelta(state, decision.changed[BroadcastScheduler::SINK_MQTT]);
+        }
+        yield();
     }
     
-    if (!hasLocalClients && !shouldSendToCloud) {
-        return;  // No one to send to, skip expensive JSON building
+    bool wsDue = decision.send[BroadcastScheduler::SINK_LOCAL];
+    bool cloudDue = decision.send[BroadcastScheduler::SINK_CLOUD];
+    if (!wsDue && !cloudDue) {
+        _broadcastScheduler.markSent(decision, now);
+        return;
     }
     
     // Sequence number for tracking updates and detecting missed messages
     // Only increment when we're actually going to send a message
     static uint32_t statusSequence = 0;
+    statusSequence++;
     
-    // Decide: delta or full status?
-    // Send full status on:
-    // 1. Major state changes (machine_state changed)
-    // 2. Periodic sync (every 5 minutes)
-    // 3. First connection (client just connected) - ALWAYS send full status for new clients
-    // Note: Cloud heartbeat uses delta status to avoid expensive full status builds every 30s
-    unsigned long now = millis();
-    bool fullStatusSyncDue = (now - lastFullStatusSync >= FULL_STATUS_SYNC_INTERVAL);
-    bool majorStateChange = (cloudChanged && cloudChangedFields.machine_state) || 
-                           (localChanged && localChangedFields.machine_state);
-    // Always send full status for newly connected clients to ensure they get complete state
-    // This prevents stale connection errors
-    // Don't force full status for cloud heartbeat - use delta instead to avoid blocking
-    bool sendFullStatus = majorStateChange || fullStatusSyncDue || isFirstLocalMessage;
-    
-    // For newly connected clients, always send status even if nothing changed
-    // This ensures client gets complete initial state
-    if (isFirstLocalMessage) {
-        localChanged = true;  // Force send even if no changes detected
-    }
+    // Local WS and cloud share one serialized payload: the delta is built from
+    // the union of both sinks' pending changes (a superset delta is still a
+    // valid delta), so a brewing session serializes once per tick, not once
+    // per sink.
+    ChangedFields shared = decision.changed[BroadcastScheduler::SINK_LOCAL];
+    shared.merge(decision.changed[BroadcastScheduler::SINK_CLOUD]);
     
-    // For local clients: Always send status updates periodically (every 2s) as keepalive
-    // This ensures client receives regular updates and doesn't mark connection as stale
-    // Cloud clients use change detection to save bandwidth, but local clients need keepalive
-    // The keepalive logic above forces localChanged=true every 2 seconds when idle
+    bool sendFullStatus = (wsDue && decision.full[BroadcastScheduler::SINK_LOCAL]) ||
+                          (cloudDue && decision.full[BroadcastScheduler::SINK_CLOUD]);
+    bool isFirstLocalMessage = decision.firstLocal;
     
     // Clear the pre-allocated document for reuse
     g_statusDoc->clear();
     JsonDocument& doc = *g_statusDoc;
-    
-    // Increment sequence number only when we're actually sending
-    statusSequence++;
-    
-    // Build delta or full status
-    // For newly connected clients, always send full status to ensure complete state
-    // For local clients with keepalive, send full status (simpler and ensures client gets complete state)
-    // Note: isKeepaliveForced is declared as static at function scope above
-    
-    // Build delta status if we have changes OR cloud heartbeat (use lightweight delta for heartbeat)
-    if (!sendFullStatus && (cloudChanged || localChanged || cloudHeartbeatDue) && !isFirstLocalMessage) {
-        // Check if this is a keepalive send - if keepalive was forced, send lightweight keepalive
-        // Otherwise, try to build delta status
-        if (isKeepaliveForced && hasLocalClients) {
-            // This is a keepalive - send lightweight message instead of expensive full status
-            // This prevents blocking the main loop with expensive operations when idle
-            // Only send if we actually have local clients
-            doc.clear();
-            doc["type"] = "keepalive";
-            doc["seq"] = statusSequence;
-            doc["uptime"] = millis();
-            
-            // Yield before serialization
-            yield();
-            
-            // Serialize lightweight keepalive to MessagePack
-            size_t msgpackSize = MessagePackHelper::serialize(doc, g_statusBuffer, STATUS_BUFFER_SIZE);
-            
-            // Yield after serialization
-            yield();
-            
-            if (msgpackSize > 0 && hasLocalClients) {
-                // Send lightweight keepalive to local clients
-                size_t clientIndex = 0;
-                for (auto& client : _ws.getClients()) {
-                    // Yield every 2 clients to prevent blocking
-                    if (clientIndex > 0 && (clientIndex % 2 == 0)) {
-                        yield();
-                    }
-                    clientIndex++;
-                    
-                    if (client.status() == WS_CONNECTED && client.canSend()) {
-                        client.binary(g_statusBuffer, msgpackSize);
-                        yield(); // Yield after each send
-                    }
-                }
+
+    // Delta/keepalive paths stream MessagePack straight into g_statusBuffer
+    // (no JsonDocument build); non-zero means the buffer is already serialized
+    size_t prebuiltSize = 0;
+    
+    if (!sendFullStatus) {
+        if (shared.anyChanged()) {
+            prebuiltSize = buildDeltaStatus(state, shared, statusSequence, g_statusBuffer, STATUS_BUFFER_SIZE);
+            if (prebuiltSize == 0) {
+                // Delta overflowed the buffer - fall back to a keyframe
+                sendFullStatus = true;
             }
-            // Skip expensive full status building for keepalive
-            return;
-        } else if (isKeepaliveForced && !hasLocalClients) {
-            // Keepalive was forced but no clients - just return early to avoid expensive operations
-            return;
         } else {
-            // Build delta status - use the changed fields from the appropriate detector
-            ChangedFields changed = hasLocalClients ? localChangedFields : cloudChangedFields;
-            // Always include stats in delta if explicitly marked as changed
-            // (Stats changes are tracked externally when brews are recorded)
-            if (buildDeltaStatus(state, changed, statusSequence, doc)) {
-                // Delta built successfully - stats included if changed.stats is true
-            } else {
-                // No changes detected
-                // If this is a cloud heartbeat with no changes, always send lightweight keepalive
-                // Cloud heartbeat is just a keepalive - doesn't need full status
-                if (cloudHeartbeatDue && cloudConnected) {
-                    // Cloud heartbeat with no changes - send lightweight keepalive
-                    doc.clear();
-                    doc["type"] = "keepalive";
-                    doc["seq"] = statusSequence;
-                    doc["uptime"] = millis();
-                } else if (localChanged && !hasLocalClients) {
-                    // Local changed but no local clients - skip (nothing to send)
-                    return;
-                } else {
-                    // Fall back to full status for other cases (should be rare)
-                    sendFullStatus = true;
-                }
-            }
+            // Idle keepalive - lightweight frame instead of a status rebuild.
+            // This prevents clients from marking the connection as stale
+            // without blocking the main loop on expensive operations.
+            MsgPackWriter keepalive(g_statusBuffer, STATUS_BUFFER_SIZE);
+            keepalive.beginMap();
+            keepalive.key("type");   keepalive.writeStr("keepalive");
+            keepalive.key("seq");    keepalive.writeUint(statusSequence);
+            keepalive.key("uptime"); keepalive.writeUint(millis());
+            keepalive.endMap();
+            prebuiltSize = keepalive.finish();
         }
-    } else {
-        // Build full status (for new clients, major changes, or periodic sync)
-        sendFullStatus = true;
     }
     
     // If we decided to send full status, build it now
@@ -703,9 +810,11 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
         
         // Include stats in full status only for:
         // 1. First connection (isFirstLocalMessage)
-        // 2. Periodic sync (fullStatusSyncDue)
+        // 2. Periodic sync (fullSync)
         // This avoids expensive stats calculation on every full status broadcast
-        bool includeStats = isFirstLocalMessage || fullStatusSyncDue;
+        bool includeStats = isFirstLocalMessage ||
+                            decision.fullSync[BroadcastScheduler::SINK_LOCAL] ||
+                            decision.fullSync[BroadcastScheduler::SINK_CLOUD];
     
     // Timestamps - track machine on time and last shot
     // Use Unix timestamps (milliseconds) for client compatibility
@@ -752,27 +861,8 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
     
     // Machine state - convert to string for web client
     // MUST match Pico state values exactly!
-    const char* stateStr = "unknown";
-    switch (state.machine_state) {
-        case UI_STATE_INIT: stateStr = "init"; break;
-        case UI_STATE_IDLE: stateStr = "idle"; break;
-        case UI_STATE_HEATING: stateStr = "heating"; break;
-        case UI_STATE_READY: stateStr = "ready"; break;
-        case UI_STATE_BREWING: stateStr = "brewing"; break;
-        case UI_STATE_FAULT: stateStr = "fault"; break;
-        case UI_STATE_SAFE: stateStr = "safe"; break;
-        case UI_STATE_ECO: stateStr = "eco"; break;
-    }
-    machine["state"] = stateStr;
-    
-    // Machine mode - derive from state
-    const char* modeStr = "standby";
-    if (state.machine_state >= UI_STATE_HEATING && state.machine_state <= UI_STATE_BREWING) {
-        modeStr = "on";
-    } else if (state.machine_state == UI_STATE_ECO) {
-        modeStr = "eco";
-    }
-    machine["mode"] = modeStr;
+    machine["state"] = statusStateString(state.machine_state);
+    machine["mode"] = statusModeString(state.machine_state);
     machine["isHeating"] = state.is_heating;
     machine["isBrewing"] = state.is_brewing;
     machine["heatingStrategy"] = state.heating_strategy;
@@ -797,10 +887,14 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
     brew["current"] = state.brew_temp;
     brew["setpoint"] = state.brew_setpoint;
     
-    JsonObject steam = temps["steam"].to<JsonObject>();
-    steam["current"] = state.steam_temp;
-    steam["setpoint"] = state.steam_setpoint;
-    
+    // Steam group exists only on machines with a steam boiler - single
+    // boiler and thermoblock clients never see the dead fields
+    if (machine_has_steam_boiler(state.machine_type)) {
+        JsonObject steam = temps["steam"].to<JsonObject>();
+        steam["current"] = state.steam_temp;
+        steam["setpoint"] = state.steam_setpoint;
+    }
+
     temps["group"] = state.group_temp;
     
     // =========================================================================
@@ -813,6 +907,12 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
     // =========================================================================
     JsonObject power = doc["power"].to<JsonObject>();
     power["current"] = state.power_watts;
+    // Duty-integrated per-boiler energy since Pico boot (zero-hardware
+    // estimate - cross-check for the external meter where one exists)
+    power["brewWh"] = state.brew_energy_wh;
+    if (machine_has_steam_boiler(state.machine_type)) {
+        power["steamWh"] = state.steam_energy_wh;
+    }
     
     // Get power meter reading if available
     PowerMeterReading meterReading;
@@ -1031,63 +1131,53 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
         esp32["version"] = ESP32_VERSION;
         esp32["freeHeap"] = ESP.getFreeHeap();
         esp32["uptime"] = millis();
-        
-        // Update full status sync timer
-        if (fullStatusSyncDue) {
-            lastFullStatusSync = now;
-        }
+        // Full sync timers are restarted by the scheduler in markSent()
     }
     
     // Yield after building large JSON document to prevent blocking
     yield();
-    
-    // Check for JSON overflow before serialization
-    size_t jsonSize = measureJson(doc);
-    size_t memoryUsed = doc.memoryUsage();
-    if (memoryUsed > STATUS_DOC_SIZE * 0.9) {  // Warn if using >90% of capacity
-        LOG_W("JSON document near capacity: %zu/%zu bytes (%.1f%%)", 
-              memoryUsed, (size_t)STATUS_DOC_SIZE, (memoryUsed * 100.0f) / STATUS_DOC_SIZE);
-    }
-    if (memoryUsed > STATUS_DOC_SIZE) {
-        LOG_E("JSON document overflow: %zu > %zu bytes - heap allocation likely!", 
-              memoryUsed, (size_t)STATUS_DOC_SIZE);
+
+    size_t msgpackSize = prebuiltSize;
+    if (msgpackSize == 0) {
+        // Full status path: check for JSON overflow before serialization
+        size_t memoryUsed = doc.memoryUsage();
+        if (memoryUsed > STATUS_DOC_SIZE * 0.9) {  // Warn if using >90% of capacity
+            LOG_W("JSON document near capacity: %zu/%zu bytes (%.1f%%)",
+                  memoryUsed, (size_t)STATUS_DOC_SIZE, (memoryUsed * 100.0f) / STATUS_DOC_SIZE);
+        }
+        if (memoryUsed > STATUS_DOC_SIZE) {
+            LOG_E("JSON document overflow: %zu > %zu bytes - heap allocation likely!",
+                  memoryUsed, (size_t)STATUS_DOC_SIZE);
+        }
+
+        // Serialize to MessagePack binary format (much smaller than JSON)
+        // Only do this expensive operation if we actually need to send
+        // Yield before expensive serialization
+        yield();
+        msgpackSize = MessagePackHelper::serialize(doc, g_statusBuffer, STATUS_BUFFER_SIZE);
     }
-    
-    // Serialize to MessagePack binary format (much smaller than JSON)
-    // Only do this expensive operation if we actually need to send
-    // Yield before expensive serialization
-    yield();
-    size_t msgpackSize = MessagePackHelper::serialize(doc, g_statusBuffer, STATUS_BUFFER_SIZE);
-    
+
     // Yield after expensive serialization to prevent blocking main loop
     yield();
     
     if (msgpackSize > 0) {
-        // Send to WebSocket clients as binary (MessagePack format)
+        // Fan the one serialized payload out to every due sink.
         // Status updates are only sent when something changes, on first connect,
         // or during periodic sync. Application-level keepalive messages prevent stale connections.
-        if (hasLocalClients) {
+        if (wsDue) {
+            // Time the whole local fanout for the WiFi link health ring -
+            // a slow fanout here is TCP backpressure, i.e. the radio
+            unsigned long fanoutStart = millis();
+
             // Only cleanup clients periodically, not before every send
-            // CRITICAL FIX: Don't cleanup right before sending keepalive
+            // CRITICAL FIX: Don't cleanup right before sending
             // Cleanup can remove clients, making them null when we try to send
             // Instead, cleanup AFTER sending messages to avoid race conditions
             static unsigned long lastCleanup = 0;
             const unsigned long CLEANUP_INTERVAL = 5000;  // Clean up every 5 seconds
             
-            // Get client count FIRST (before any cleanup)
-            // This prevents race conditions where cleanup removes clients while we're iterating
-            size_t clientCount = _ws.count();
-            // CRITICAL DEBUG: Log if we have clients but loop doesn't execute
-            if (clientCount == 0 && isKeepaliveForced) {
-                LOG_W("WARNING: No clients found but keepalive was forced! hasLocalClients=%d, _ws.count()=%zu", 
-                      hasLocalClients ? 1 : 0, _ws.count());
-            }
-            
             // CRITICAL FIX: Use getClients() iterator instead of index-based loop
             // _ws.client(i) expects a Client ID (like 3, 4, 5...), NOT an array index (0, 1, 2...)
-            // This is why _ws.client(0) returns null even when count() returns 1
-            
-            // Direct iteration over client list using getClients()
             // getClients() returns references, so use auto& and access with . not ->
             size_t clientIndex = 0;
             for (auto& client : _ws.getClients()) {
@@ -1098,56 +1188,34 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
                     yield();
                 }
                 clientIndex++;
-                // Check connection status - always try to send if connected
-                // This ensures clients receive regular updates and don't mark connection as stale
-                if (client.status() == WS_CONNECTED) {
-                    // CRITICAL: Always send application-level keepalive messages (not protocol pings)
-                    // WebSocket protocol-level pings don't trigger browser's onmessage event,
-                    // so the client's lastMessageTime never updates and it marks connection as stale.
-                    // We must send actual messages (binary MessagePack or text JSON) that trigger onmessage.
-                    // Check queue status before sending to avoid blocking
-                    bool queueAvailable = client.canSend();
-                    
-                    if (isKeepaliveForced) {
-                        // Force send keepalive - but only if queue has space to avoid blocking
-                        // If queue is full, skip this keepalive rather than blocking for 3+ seconds
-                        if (queueAvailable && g_statusBuffer && msgpackSize > 0 && msgpackSize <= STATUS_BUFFER_SIZE) {
-                            client.binary(g_statusBuffer, msgpackSize);
-                            // Yield after each send to prevent blocking main loop
-                            yield();
-                        } else if (!queueAvailable) {
-                            // Queue full - skip keepalive to avoid blocking (client will get next update)
-                            LOG_D("Client %u queue full, skipping keepalive to avoid blocking", client.id());
-                        } else {
-                            LOG_E("Invalid buffer or size: g_statusBuffer=%p, msgpackSize=%zu, STATUS_BUFFER_SIZE=%d", 
-                                  g_statusBuffer, msgpackSize, STATUS_BUFFER_SIZE);
-                        }
-                    } else if (queueAvailable) {
-                        // Normal status update - only send if queue has space
-                        client.binary(g_statusBuffer, msgpackSize);
-                        // Yield after each send to prevent blocking main loop
-                        yield();
-                    } else {
-                        // Queue full for normal update - skip unless it's initial status
-                        if (isFirstLocalMessage) {
-                            // For first message, try to send even if queue appears full
-                            // But add timeout protection - if it takes too long, skip it
-                            unsigned long sendStart = millis();
-                            if (g_statusBuffer && msgpackSize > 0 && msgpackSize <= STATUS_BUFFER_SIZE) {
-                                client.binary(g_statusBuffer, msgpackSize);
-                                // Yield after send to prevent blocking
-                                yield();
-                                unsigned long sendTime = millis() - sendStart;
-                                if (sendTime > 100) {
-                                    LOG_W("Client %u initial send took %lu ms (queue may be blocking)", client.id(), sendTime);
-                                }
-                            }
-                        } else {
-                            LOG_D("Client %u send queue full, skipping this update", client.id());
-                            // Don't send protocol ping - it won't help with client's stale detection
-                            // The client will receive keepalive from sendPingToClients() or next status update
-                        }
+                if (client.status() != WS_CONNECTED) {
+                    continue;
+                }
+                // CRITICAL: These are application-level messages (not protocol pings).
+                // WebSocket protocol-level pings don't trigger browser's onmessage event,
+                // so the client's lastMessageTime never updates and it marks connection as stale.
+                // Check queue status before sending to avoid blocking
+                if (client.canSend()) {
+                    client.binary(g_statusBuffer, msgpackSize);
+                    noteClientSendOk(client.id());
+                    // Yield after each send to prevent blocking main loop
+                    yield();
+                } else if (isFirstLocalMessage) {
+                    // For the initial keyframe, try to send even if the queue
+                    // appears full - a client stuck with no state is worse.
+                    // Track how long it takes in case the queue is blocking.
+                    unsigned long sendStart = millis();
+                    client.binary(g_statusBuffer, msgpackSize);
+                    yield();
+                    unsigned long sendTime = millis() - sendStart;
+                    if (sendTime > 100) {
+                        LOG_W("Client %u initial send took %lu ms (queue may be blocking)", client.id(), sendTime);
                     }
+                } else {
+                    // Queue full - skip this update rather than blocking; the
+                    // scheduler keeps the changes pending until markSent()
+                    LOG_D("Client %u send queue full, skipping this update", client.id());
+                    noteClientQueueFull(client);
                 }
             }
             
@@ -1157,27 +1225,59 @@ void BrewWebServer::broadcastFullStatus(const ui_state_t& state) {
                 _ws.cleanupClients();
                 lastCleanup = millis();
             }
-        } else {
-            if (isKeepaliveForced) {
-                LOG_W("No local clients but keepalive was forced - this shouldn't happen!");
+
+            // SSE fallback clients share the local sink's schedule and the
+            // already-serialized frame. SSE is text-only, so the MessagePack
+            // buffer is base64-encoded - once per tick, fanned out to every
+            // SSE client by the event source. The status sequence rides as
+            // the SSE event id, so clients see gaps via Last-Event-ID.
+            if (_events.count() > 0) {
+                size_t b64Cap = ((msgpackSize + 2) / 3) * 4 + 1;
+                unsigned char* b64 = (unsigned char*)PsramPool::instance().allocate(b64Cap, "broadcast");
+                if (b64) {
+                    size_t b64Len = 0;
+                    if (mbedtls_base64_encode(b64, b64Cap, &b64Len, g_statusBuffer, msgpackSize) == 0) {
+                        _events.send((const char*)b64, "status", statusSequence);
+                    }
+                    PsramPool::instance().release(b64);
+                    yield();
+                }
             }
+
+            _wifiManager.noteBroadcastLatency(millis() - fanoutStart);
         }
-        
-        // Send to cloud if status changed or heartbeat due
-        if (shouldSendToCloud) {
+
+        if (cloudDue) {
             // Yield before cloud send to prevent blocking
             yield();
-            _cloudConnection->sendBinary(g_statusBuffer, msgpackSize);
-            if (cloudHeartbeatDue) {
-                lastCloudHeartbeat = millis();
+            // When the relay negotiated the compact schema, re-encode the
+            // cloud sink's own pending changes as a positional field-id array
+            // (see cloud_schema.h) - a fraction of the shared map frame's TLS
+            // bytes, and built from this sink's changes rather than the local
+            // union. Falls back to the shared frame if encoding fails.
+            bool sentCompact = false;
+            if (_cloudConnection->compactStatusEnabled()) {
+                size_t compactSize = cloudSchemaEncodeStatus(
+                    state, decision.changed[BroadcastScheduler::SINK_CLOUD],
+                    sendFullStatus, statusSequence, g_msgpackChain);
+                if (compactSize > 0) {
+                    _cloudConnection->sendBinary(g_msgpackChain);
+                    sentCompact = true;
+                }
+            }
+            if (!sentCompact) {
+                _cloudConnection->sendBinary(g_statusBuffer, msgpackSize);
             }
         }
+        
+        _broadcastScheduler.markSent(decision, now);
     } else {
-        LOG_E("MessagePack serialization failed or buffer too small (keepalive=%d)", isKeepaliveForced);
-        // If keepalive failed to serialize, this is critical - connection will go stale
-        if (isKeepaliveForced) {
-            LOG_E("CRITICAL: Keepalive serialization failed - client will mark connection as stale!");
-        }
+        LOG_E("MessagePack serialization failed or buffer too small");
+        // Leave WS/cloud marked unsent so their pending changes retry next
+        // tick (MQTT already published on its own payload path above)
+        decision.send[BroadcastScheduler::SINK_LOCAL] = false;
+        decision.send[BroadcastScheduler::SINK_CLOUD] = false;
+        _broadcastScheduler.markSent(decision, now);
     }
     
     // Note: No cleanup needed - we're using pre-allocated reusable buffers
@@ -1218,7 +1318,9 @@ void BrewWebServer::broadcastDeviceInfo() {
     // These come from Pico's status messages, which reflect what Pico has persisted
     const ui_state_t& state = runtimeState().get();
     doc["brewSetpoint"] = state.brew_setpoint;
-    doc["steamSetpoint"] = state.steam_setpoint;
+    if (machine_has_steam_boiler(state.machine_type)) {
+        doc["steamSetpoint"] = state.steam_setpoint;
+    }
     
     // Include eco mode settings (from Pico - Pico is source of truth)
     // Note: These are cached from last set_eco command until Pico reports them back
@@ -1257,34 +1359,23 @@ void BrewWebServer::broadcastDeviceInfo() {
         return;
     }
     
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        
-    // FIX: Iterate over clients list directly instead of using index
-    // ws->client(i) expects an ID, not an index!
-    if (_ws.count() > 0) {
-        _ws.cleanupClients();  // Clean up stale clients first
-        
-        // getClients() returns references, so use auto& and access with . not ->
-        for (auto& client : _ws.getClients()) {
-            // Defensive: Check client is connected and ready before sending
-            if (client.status() == WS_CONNECTED && client.canSend() && jsonBuffer) {
-                client.text(jsonBuffer);
-                // Yield after each send to prevent blocking main loop
-                yield();
-            }
+
+        if (_ws.count() > 0) {
+            _ws.cleanupClients();  // Clean up stale clients first
+            sendFrameToLocalClients(doc, jsonBuffer);
         }
-    }
-        
+
         // Also send to cloud - use jsonBuffer directly to avoid String allocation
         if (_cloudConnection) {
             _cloudConnection->send(jsonBuffer);
         }
-        
+
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
     }
 }
 
@@ -1313,11 +1404,11 @@ void BrewWebServer::broadcastBBWSettings() {
     
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        _ws.textAll(jsonBuffer);
+        sendFrameToLocalClients(doc, jsonBuffer);
         
         // Also send to cloud - use jsonBuffer directly to avoid String allocation
         if (_cloudConnection) {
@@ -1325,7 +1416,7 @@ void BrewWebServer::broadcastBBWSettings() {
         }
         
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
     }
 }
 
@@ -1362,11 +1453,11 @@ void BrewWebServer::broadcastMqttStatus() {
     
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        _ws.textAll(jsonBuffer);
+        sendFrameToLocalClients(doc, jsonBuffer);
         
         // Also send to cloud
         if (_cloudConnection) {
@@ -1374,7 +1465,7 @@ void BrewWebServer::broadcastMqttStatus() {
         }
         
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
     }
 }
 
@@ -1396,11 +1487,11 @@ void BrewWebServer::broadcastPowerMeterStatus() {
     
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
     
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        _ws.textAll(jsonBuffer);
+        sendFrameToLocalClients(doc, jsonBuffer);
         
         // Also send to cloud - use jsonBuffer directly to avoid String allocation
         if (_cloudConnection) {
@@ -1408,11 +1499,12 @@ void BrewWebServer::broadcastPowerMeterStatus() {
         }
         
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
     }
 }
 
-void BrewWebServer::broadcastEvent(const String& event, const JsonDocument* data) {
+void BrewWebServer::broadcastEvent(const char* event, const JsonDocument* data) {
+    if (!event) return;
     // Use stack allocation to avoid PSRAM crashes
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -1421,7 +1513,7 @@ void BrewWebServer::broadcastEvent(const String& event, const JsonDocument* data
     doc["type"] = "event";
     // Copy event string to avoid PSRAM pointer issues
     char eventBuf[64];
-    strncpy(eventBuf, event.c_str(), sizeof(eventBuf) - 1);
+    strncpy(eventBuf, event, sizeof(eventBuf) - 1);
     eventBuf[sizeof(eventBuf) - 1] = '\0';
     doc["event"] = eventBuf;
     doc["timestamp"] = millis();
@@ -1429,21 +1521,22 @@ void BrewWebServer::broadcastEvent(const String& event, const JsonDocument* data
     if (data) {
         doc["data"] = *data;
     }
-    
+
     // Use buffer pool to avoid heap fragmentation
     size_t jsonSize = measureJson(doc) + 1;
-    char* jsonBuffer = JsonBufferPool::instance().allocate(jsonSize);
-    
+    char* jsonBuffer = (char*)PsramPool::instance().allocate(jsonSize, "broadcast");
+
     if (jsonBuffer) {
         serializeJson(doc, jsonBuffer, jsonSize);
-        _ws.textAll(jsonBuffer);
-        
-        // Also send to cloud - use jsonBuffer directly to avoid String allocation
+        sendFrameToLocalClients(doc, jsonBuffer);
+
+        // Also send to cloud - event class, drained ahead of status and logs
+        // so shot lifecycle reaches the cloud timeline on time
         if (_cloudConnection) {
-            _cloudConnection->send(jsonBuffer);
+            _cloudConnection->send(jsonBuffer, CloudConnection::PRIORITY_EVENT);
         }
         
         // Release buffer back to pool (or free if dynamically allocated)
-        JsonBufferPool::instance().release(jsonBuffer);
+        PsramPool::instance().release(jsonBuffer);
     }
 }
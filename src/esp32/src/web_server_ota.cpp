@@ -28,6 +28,7 @@
 #include <freertos/portmacro.h>  // For portTICK_PERIOD_MS
 #include <ArduinoJson.h>
 #include <esp_ota_ops.h>
+#include <rom/miniz.h>  // ROM copy of tinfl - streaming gunzip at no flash cost
 #include <FS.h>
 #include <AsyncTCP.h>
 #include <AsyncWebSocket.h>
@@ -325,7 +326,7 @@ static void pauseServicesForOTA(CloudConnection* cloudConnection, AsyncWebSocket
     }
     
     // 5.5. Disable LogManager file logging during OTA
-    // LogManager's loop() periodically calls saveToFlash() which writes to /littlefs/logs.txt
+    // LogManager's loop() periodically calls saveToFlash() which writes to /littlefs/logs.bin
     // This conflicts with LittleFS partition erase/update operations
     // We'll disable it temporarily - logs will still go to Serial and RAM buffer
     // Note: Pico log forwarding doesn't work during OTA anyway, so disabling is safe
@@ -397,6 +398,14 @@ constexpr unsigned long OTA_WATCHDOG_FEED_INTERVAL_MS = 20;// Feed watchdog ever
 // Buffer sizes
 constexpr size_t OTA_BUFFER_SIZE = 512;                    // Smaller buffer for stack safety
 
+// Pipelined ESP32 flash path - double-buffered slots handed to a writer task
+// so the flash erase/program of one chunk overlaps the network read (and TLS
+// decrypt) of the next, instead of alternating network-wait and flash-wait
+constexpr size_t OTA_PIPE_SLOT_SIZE = 8192;                // Per-slot buffer (2 slots)
+constexpr size_t OTA_PIPE_MIN_READ = 1024;                 // Adaptive read size floor
+constexpr uint32_t OTA_PIPE_WRITER_STACK = 4096;           // Update.write() + logging
+constexpr UBaseType_t OTA_PIPE_WRITER_PRIORITY = 2;        // Above loop, below networking
+
 // Retry configuration
 constexpr int OTA_MAX_RETRIES = 3;
 constexpr unsigned long OTA_RETRY_DELAY_MS = 3000;
@@ -621,16 +630,319 @@ static void broadcastOtaProgress(AsyncWebSocket* ws, const char* stage, int /* p
     feedWatchdog();
 }
 
+// =============================================================================
+// Streaming gzip decompression - compressed OTA assets
+// =============================================================================
+//
+// Release assets may be gzip-compressed (~50% smaller transfers, which also
+// halves the cloud-relay time for remote updates). Compressed images are
+// detected by the gzip magic bytes at the start of the stream, so plain
+// binaries keep working unchanged. Decompression uses the ROM copy of miniz
+// (tinfl): no flash cost, just the 32KB LZ77 window plus decompressor state
+// on the heap while an update runs.
+//
+// The gzip trailer (CRC32/ISIZE) is consumed but not verified - transfer
+// integrity is already covered by the wire CRC32 the OTA paths compute.
+
+class GzipStreamInflater {
+public:
+    // Sink receives decompressed bytes; return false to abort the stream
+    typedef bool (*sink_fn_t)(const uint8_t* data, size_t len, void* ctx);
+
+    /**
+     * @brief Allocate decompressor state and arm the sink
+     * @return false on allocation failure (state is freed)
+     */
+    bool begin(sink_fn_t sink, void* ctx) {
+        _sink = sink;
+        _ctx = ctx;
+        _inflator = new (std::nothrow) tinfl_decompressor;
+        _window = new (std::nothrow) uint8_t[TINFL_LZ_DICT_SIZE];
+        if (!_inflator || !_window) {
+            end();
+            return false;
+        }
+        tinfl_init(_inflator);
+        _windowPos = 0;
+        _totalOut = 0;
+        _flags = 0;
+        _fieldRemaining = 0;
+        _headerState = HDR_MAGIC0;
+        _done = false;
+        return true;
+    }
+
+    void end() {
+        delete _inflator;
+        _inflator = nullptr;
+        delete[] _window;
+        _window = nullptr;
+    }
+
+    size_t bytesOut() const { return _totalOut; }
+    bool isDone() const { return _done; }
+
+    /**
+     * @brief Feed compressed bytes from the wire
+     * @return false on corrupt stream or sink failure
+     */
+    bool feed(const uint8_t* data, size_t len) {
+        size_t pos = 0;
+
+        // Consume the gzip header byte-by-byte - optional fields (FNAME etc.)
+        // can span chunk boundaries
+        while (pos < len && _headerState != HDR_BODY) {
+            if (!headerByte(data[pos++])) {
+                LOG_E("gzip: bad header");
+                return false;
+            }
+        }
+
+        while (pos < len && !_done) {
+            size_t inBytes = len - pos;
+            size_t outBytes = TINFL_LZ_DICT_SIZE - _windowPos;
+            tinfl_status status = tinfl_decompress(_inflator,
+                                                   data + pos, &inBytes,
+                                                   _window, _window + _windowPos, &outBytes,
+                                                   TINFL_FLAG_HAS_MORE_INPUT);
+            pos += inBytes;
+
+            if (outBytes > 0) {
+                if (!_sink(_window + _windowPos, outBytes, _ctx)) {
+                    return false;
+                }
+                _totalOut += outBytes;
+                _windowPos = (_windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+            }
+
+            if (status == TINFL_STATUS_DONE) {
+                _done = true;  // Remaining input is the trailer - ignored
+            } else if (status < TINFL_STATUS_DONE) {
+                LOG_E("gzip: corrupt deflate stream (%d)", (int)status);
+                return false;
+            } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && pos >= len) {
+                break;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Quick check for the gzip magic at the start of a stream
+     */
+    static bool looksCompressed(const uint8_t* data, size_t len) {
+        return len >= 2 && data[0] == 0x1F && data[1] == 0x8B;
+    }
+
+private:
+    enum HeaderState : uint8_t {
+        HDR_MAGIC0, HDR_MAGIC1, HDR_METHOD, HDR_FLAGS, HDR_SKIP6,
+        HDR_EXTRA_LEN0, HDR_EXTRA_LEN1, HDR_EXTRA,
+        HDR_NAME, HDR_COMMENT, HDR_CRC16, HDR_BODY
+    };
+
+    bool headerByte(uint8_t b) {
+        switch (_headerState) {
+            case HDR_MAGIC0:
+                if (b != 0x1F) return false;
+                _headerState = HDR_MAGIC1;
+                break;
+            case HDR_MAGIC1:
+                if (b != 0x8B) return false;
+                _headerState = HDR_METHOD;
+                break;
+            case HDR_METHOD:
+                if (b != 8) return false;  // Only deflate
+                _headerState = HDR_FLAGS;
+                break;
+            case HDR_FLAGS:
+                _flags = b;
+                _fieldRemaining = 6;  // MTIME(4) + XFL + OS
+                _headerState = HDR_SKIP6;
+                break;
+            case HDR_SKIP6:
+                if (--_fieldRemaining == 0) _headerState = nextOptional(0);
+                break;
+            case HDR_EXTRA_LEN0:
+                _fieldRemaining = b;
+                _headerState = HDR_EXTRA_LEN1;
+                break;
+            case HDR_EXTRA_LEN1:
+                _fieldRemaining |= (uint16_t)b << 8;
+                _headerState = (_fieldRemaining > 0) ? HDR_EXTRA : nextOptional(1);
+                break;
+            case HDR_EXTRA:
+                if (--_fieldRemaining == 0) _headerState = nextOptional(1);
+                break;
+            case HDR_NAME:
+                if (b == 0) _headerState = nextOptional(2);
+                break;
+            case HDR_COMMENT:
+                if (b == 0) _headerState = nextOptional(3);
+                break;
+            case HDR_CRC16:
+                if (--_fieldRemaining == 0) _headerState = HDR_BODY;
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    // Pick the next header section based on FLG bits, starting after `from`
+    // (0 = fixed header, 1 = FEXTRA, 2 = FNAME, 3 = FCOMMENT)
+    HeaderState nextOptional(uint8_t from) {
+        if (from < 1 && (_flags & 0x04)) return HDR_EXTRA_LEN0;  // FEXTRA
+        if (from < 2 && (_flags & 0x08)) return HDR_NAME;        // FNAME
+        if (from < 3 && (_flags & 0x10)) return HDR_COMMENT;     // FCOMMENT
+        if (_flags & 0x02) {                                     // FHCRC
+            _fieldRemaining = 2;
+            return HDR_CRC16;
+        }
+        return HDR_BODY;
+    }
+
+    sink_fn_t _sink = nullptr;
+    void* _ctx = nullptr;
+    tinfl_decompressor* _inflator = nullptr;
+    uint8_t* _window = nullptr;   // 32KB LZ77 dictionary (power of two)
+    size_t _windowPos = 0;
+    size_t _totalOut = 0;
+    uint8_t _flags = 0;
+    uint16_t _fieldRemaining = 0;
+    HeaderState _headerState = HDR_MAGIC0;
+    bool _done = false;
+};
+
 /**
- * Download a file from URL to LittleFS with proper error handling
+ * @brief GzipStreamInflater sink that appends to a LittleFS file
+ */
+static bool gzipFileSink(const uint8_t* data, size_t len, void* ctx) {
+    File* file = (File*)ctx;
+    return file->write(data, len) == len;
+}
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    const uint32_t crc32Polynomial = 0xEDB88320;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ crc32Polynomial : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+// =============================================================================
+// Resumable downloads
+//
+// Download progress (byte offset + rolling CRC32 state) is persisted to NVS
+// every OTA_RESUME_SAVE_INTERVAL bytes, keyed by a tag derived from the
+// requested URL and target path. If a transfer dies - WiFi drop, stall, even
+// a soft reset - the next attempt for the same asset validates the partial
+// file against the saved CRC state and continues with an HTTP Range request
+// instead of starting over. Compressed assets are exempt: the inflater state
+// can't be persisted across resets, so gzip downloads always restart from
+// zero.
+// =============================================================================
+
+#define OTA_RESUME_NAMESPACE "ota-resume"
+#define OTA_RESUME_SAVE_INTERVAL 65536  // Persist progress every 64KB
+
+struct OtaResumeState {
+    uint32_t tag = 0;     // Identifies the URL + target path this state belongs to
+    uint32_t total = 0;   // Expected wire size of the full asset
+    uint32_t offset = 0;  // Wire bytes persisted and safely on disk
+    uint32_t crc = 0;     // Rolling CRC32 state (pre-inversion) at 'offset'
+};
+
+static uint32_t otaResumeTag(const char* url, const char* filePath) {
+    uint32_t tag = 0xFFFFFFFF;
+    tag = crc32Update(tag, (const uint8_t*)url, strlen(url));
+    tag = crc32Update(tag, (const uint8_t*)filePath, strlen(filePath));
+    return ~tag;
+}
+
+static void otaResumeSave(const OtaResumeState& st) {
+    Preferences prefs;
+    prefs.begin(OTA_RESUME_NAMESPACE, false);
+    prefs.putUInt("tag", st.tag);
+    prefs.putUInt("total", st.total);
+    prefs.putUInt("off", st.offset);
+    prefs.putUInt("crc", st.crc);
+    prefs.end();
+}
+
+static void otaResumeClear() {
+    Preferences prefs;
+    prefs.begin(OTA_RESUME_NAMESPACE, false);
+    prefs.clear();
+    prefs.end();
+}
+
+/**
+ * @brief Load and validate saved resume state for a URL/path pair
+ *
+ * Returns true only if saved state exists for this tag AND the partial file
+ * on disk re-hashes to the persisted rolling CRC state. Extra bytes past the
+ * persisted offset (written after the last save before a crash) are allowed;
+ * the caller seeks back to the validated offset and overwrites them.
+ */
+static bool otaResumeLoad(uint32_t tag, const char* filePath, OtaResumeState* out) {
+    Preferences prefs;
+    prefs.begin(OTA_RESUME_NAMESPACE, true);  // Read-only
+    out->tag = prefs.getUInt("tag", 0);
+    out->total = prefs.getUInt("total", 0);
+    out->offset = prefs.getUInt("off", 0);
+    out->crc = prefs.getUInt("crc", 0);
+    prefs.end();
+
+    if (out->tag != tag || out->offset == 0 || out->offset >= out->total) return false;
+
+    File file = LittleFS.open(filePath, "r");
+    if (!file) return false;
+    if (file.size() < out->offset || file.size() > out->total) {
+        file.close();
+        return false;
+    }
+
+    // Re-hash the partial file against the persisted rolling state - catches
+    // truncated flushes and stale partials left over from other downloads
+    uint32_t crc = 0xFFFFFFFF;
+    uint8_t buffer[512];
+    size_t remaining = out->offset;
+    while (remaining > 0) {
+        size_t chunk = remaining > sizeof(buffer) ? sizeof(buffer) : remaining;
+        if (file.read(buffer, chunk) != chunk) {
+            file.close();
+            return false;
+        }
+        crc = crc32Update(crc, buffer, chunk);
+        remaining -= chunk;
+        feedWatchdog();
+    }
+    file.close();
+    return crc == out->crc;
+}
+
+/**
+ * Single download attempt with Range-based resume (see downloadToFile)
  * Returns true on success, false on failure
  */
-static bool downloadToFile(const char* url, const char* filePath, 
-                           size_t* outFileSize = nullptr) {
+static bool downloadToFileAttempt(const char* url, const char* filePath,
+                                  size_t* outFileSize) {
     LOG_I("Downloading: %s", url);
-    
+
     String currentUrl = String(url);
-    
+
+    // Check for a resumable partial from a previous attempt
+    uint32_t resumeTag = otaResumeTag(url, filePath);
+    OtaResumeState resume;
+    bool resuming = otaResumeLoad(resumeTag, filePath, &resume);
+    if (resuming) {
+        LOG_I("Resuming download at %u/%u bytes", resume.offset, resume.total);
+    }
+
     // We need to handle up to 3 redirects (GitHub -> AWS S3 usually takes 1)
     for (int redirect = 0; redirect < 3; redirect++) {
         
@@ -668,7 +980,13 @@ static bool downloadToFile(const char* url, const char* filePath,
         }
         
         http.addHeader("User-Agent", "BrewOS-ESP32/" ESP32_VERSION);
-        
+
+            if (resuming) {
+                char rangeHeader[48];
+                snprintf(rangeHeader, sizeof(rangeHeader), "bytes=%u-", resume.offset);
+                http.addHeader("Range", rangeHeader);
+            }
+
             // CRITICAL: Check WiFi status before attempting GET
             if (WiFi.status() != WL_CONNECTED) {
                 LOG_E("WiFi disconnected before HTTP GET (attempt %d/%d)", retry + 1, OTA_MAX_RETRIES);
@@ -713,7 +1031,8 @@ static bool downloadToFile(const char* url, const char* filePath,
                 return false;
             }
             
-            if (httpCode == HTTP_CODE_OK || httpCode == 301 || httpCode == 302 || httpCode == 307) {
+            if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_PARTIAL_CONTENT ||
+                httpCode == 301 || httpCode == 302 || httpCode == 307) {
             break;
         }
         
@@ -870,20 +1189,38 @@ static bool downloadToFile(const char* url, const char* filePath,
             continue; 
         }
         
-        // 5. Handle Success (200 OK)
-        if (httpCode == HTTP_CODE_OK) {
+        // 5. Handle Success (200 OK / 206 Partial Content)
+        if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_PARTIAL_CONTENT) {
+            if (resuming && httpCode == HTTP_CODE_OK) {
+                // Server ignored the Range header - take the full body instead
+                LOG_W("Server ignored Range request, restarting from zero");
+                resuming = false;
+            }
+
             // Check Content Length
     int contentLength = http.getSize();
             LOG_I("Content Length: %d", contentLength);
-            
+
     if (contentLength <= 0 || contentLength > OTA_MAX_SIZE) {
                 LOG_E("Invalid size");
         http.end();
         return false;
     }
-    
-    if (outFileSize) *outFileSize = contentLength;
-    
+
+            if (resuming && (uint32_t)contentLength != resume.total - resume.offset) {
+                // Asset changed on the server since the partial was saved
+                LOG_E("Range size mismatch: got %d, expected %u remaining - discarding partial",
+                      contentLength, resume.total - resume.offset);
+                otaResumeClear();
+                http.end();
+                return false;
+            }
+
+            const uint32_t baseOffset = resuming ? resume.offset : 0;
+            const uint32_t wireTotal = resuming ? resume.total : (uint32_t)contentLength;
+
+            if (outFileSize) *outFileSize = wireTotal;
+
     // Check available space
     size_t freeSpace = LittleFS.totalBytes() - LittleFS.usedBytes();
     if ((size_t)contentLength > freeSpace) {
@@ -891,16 +1228,25 @@ static bool downloadToFile(const char* url, const char* filePath,
         http.end();
         return false;
     }
-    
-            // Prepare File
+
+            // Prepare File (seek back to the validated offset when resuming)
+            File file;
+            if (resuming) {
+                file = LittleFS.open(filePath, "r+");
+                if (file && !file.seek(baseOffset)) {
+                    file.close();
+                    file = File();
+                }
+            } else {
             if (LittleFS.exists(filePath)) LittleFS.remove(filePath);
-    File file = LittleFS.open(filePath, "w");
+                file = LittleFS.open(filePath, "w");
+            }
     if (!file) {
                 LOG_E("Failed to open file: %s", filePath);
         http.end();
         return false;
     }
-    
+
             // 6. Download Loop
     WiFiClient* stream = http.getStreamPtr();
     std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[OTA_BUFFER_SIZE]);
@@ -915,7 +1261,15 @@ static bool downloadToFile(const char* url, const char* filePath,
     size_t written = 0;
             unsigned long lastData = millis();
             unsigned long downloadStart = millis();
-            
+            // Mid-file data from a Range request must not be gzip-sniffed;
+            // gzip state is never persisted, so a resumed asset is plain
+            bool firstChunk = !resuming;
+            bool isGzip = false;
+            bool inflateError = false;
+            GzipStreamInflater inflater;
+            uint32_t rollingCrc = resuming ? resume.crc : 0xFFFFFFFF;
+            size_t lastPersist = 0;
+
             while (http.connected() && written < (size_t)contentLength) {
                 // Check overall timeout
         if (millis() - downloadStart > OTA_DOWNLOAD_TIMEOUT_MS) {
@@ -931,9 +1285,45 @@ static bool downloadToFile(const char* url, const char* filePath,
                     int bytesRead = stream->readBytes(buffer.get(), readSize);
                     
                     if (bytesRead > 0) {
+                        // Compressed asset? Decompress on the fly so the file
+                        // on LittleFS is always a plain image
+                        if (firstChunk) {
+                            firstChunk = false;
+                            isGzip = GzipStreamInflater::looksCompressed(buffer.get(), bytesRead);
+                            if (isGzip) {
+                                LOG_I("Compressed image detected, streaming gunzip");
+                                if (!inflater.begin(gzipFileSink, &file)) {
+                                    LOG_E("OOM: gzip window alloc failed");
+                                    inflateError = true;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (isGzip) {
+                            if (!inflater.feed(buffer.get(), bytesRead)) {
+                                inflateError = true;
+                                break;
+                            }
+                        } else {
                         file.write(buffer.get(), bytesRead);
+                            rollingCrc = crc32Update(rollingCrc, buffer.get(), bytesRead);
+                        }
                         written += bytesRead;
-                        
+
+                        // Persist resume state periodically so a drop or
+                        // reset can pick up near here instead of at zero
+                        if (!isGzip && written - lastPersist >= OTA_RESUME_SAVE_INTERVAL) {
+                            file.flush();
+                            OtaResumeState st;
+                            st.tag = resumeTag;
+                            st.total = wireTotal;
+                            st.offset = baseOffset + written;
+                            st.crc = rollingCrc;
+                            otaResumeSave(st);
+                            lastPersist = written;
+                        }
+
                         // Feed watchdog occasionally
                         if (written % 4096 == 0) feedWatchdog();
                     }
@@ -948,13 +1338,33 @@ static bool downloadToFile(const char* url, const char* filePath,
             }
             
             file.close();
-            
-            if (written != contentLength) {
+
+            if (written != contentLength || inflateError || (isGzip && !inflater.isDone())) {
+                if (inflateError || (isGzip && !inflater.isDone())) {
+                    LOG_E("Decompression failed (%d/%d wire bytes)", written, contentLength);
+                } else {
                 LOG_E("Download truncated: %d/%d", written, contentLength);
+                    // Persist final progress so the next attempt resumes here
+                    if (written > 0) {
+                        OtaResumeState st;
+                        st.tag = resumeTag;
+                        st.total = wireTotal;
+                        st.offset = baseOffset + written;
+                        st.crc = rollingCrc;
+                        otaResumeSave(st);
+                    }
+                }
+                inflater.end();
             http.end();
             return false;
         }
-        
+
+            if (isGzip) {
+                LOG_I("Decompressed %u -> %u bytes", (unsigned)written, (unsigned)inflater.bytesOut());
+                if (outFileSize) *outFileSize = inflater.bytesOut();
+            }
+            inflater.end();
+
             // Calculate CRC32 for integrity verification
             LOG_I("Calculating CRC32 for downloaded file...");
             File verifyFile = LittleFS.open(filePath, "r");
@@ -998,6 +1408,7 @@ static bool downloadToFile(const char* url, const char* filePath,
             }
             
             LOG_I("Download complete: %d bytes, CRC32=0x%08X", written, fileCRC32);
+            otaResumeClear();
             http.end();
             return true;
         }
@@ -1016,10 +1427,213 @@ static bool downloadToFile(const char* url, const char* filePath,
         return false;
 }
 
+/**
+ * Download a file from URL to LittleFS with proper error handling
+ *
+ * Wraps downloadToFileAttempt() with resume-aware retries: a mid-stream drop
+ * leaves persisted resume state behind, so the transfer is retried as long as
+ * each attempt makes forward progress. Returns true on success.
+ */
+static bool downloadToFile(const char* url, const char* filePath,
+                           size_t* outFileSize = nullptr) {
+    uint32_t lastOffset = 0;
+    int stalls = 0;
+    while (true) {
+        if (downloadToFileAttempt(url, filePath, outFileSize)) return true;
+
+        // Retry immediately only while the resume state shows progress
+        OtaResumeState st;
+        if (!otaResumeLoad(otaResumeTag(url, filePath), filePath, &st)) {
+            return false;  // Nothing resumable (gzip asset, early failure, or bad partial)
+        }
+        if (st.offset > lastOffset) {
+            lastOffset = st.offset;
+            stalls = 0;
+        } else if (++stalls >= 2) {
+            LOG_E("Download not progressing at %u/%u - giving up", st.offset, st.total);
+            return false;
+        }
+
+        LOG_W("Download interrupted at %u/%u bytes - resuming", st.offset, st.total);
+        for (int i = 0; i < 20; i++) { delay(100); feedWatchdog(); }
+    }
+}
+
 // =============================================================================
 // Pico OTA - Download and flash Pico firmware
 // =============================================================================
 
+/**
+ * @brief Copy the just-flashed image into the known-good cache
+ *
+ * Called only after the new image passed its boot health check, so the cache
+ * always holds a rollback target that is known to boot on this machine.
+ */
+static bool cachePicoKnownGood() {
+    File src = LittleFS.open(OTA_FILE_PATH, "r");
+    if (!src) {
+        LOG_W("Cannot cache known-good image: %s missing", OTA_FILE_PATH);
+        return false;
+    }
+
+    // The cache replaces any previous known-good image
+    if (LittleFS.exists(PICO_KNOWN_GOOD_PATH)) LittleFS.remove(PICO_KNOWN_GOOD_PATH);
+
+    size_t freeSpace = LittleFS.totalBytes() - LittleFS.usedBytes();
+    if (src.size() > freeSpace) {
+        LOG_W("Not enough space to cache known-good image (need %u, have %u)",
+              (unsigned)src.size(), (unsigned)freeSpace);
+        src.close();
+        return false;
+    }
+
+    File dst = LittleFS.open(PICO_KNOWN_GOOD_PATH, "w");
+    if (!dst) {
+        LOG_W("Failed to create known-good cache file");
+        src.close();
+        return false;
+    }
+
+    uint8_t buffer[512];
+    size_t copied = 0;
+    size_t n;
+    while ((n = src.read(buffer, sizeof(buffer))) > 0) {
+        if (dst.write(buffer, n) != n) break;
+        copied += n;
+        if (copied % 4096 == 0) feedWatchdog();
+    }
+    bool ok = (copied == src.size());
+    src.close();
+    dst.close();
+
+    if (ok) {
+        LOG_I("Cached known-good Pico image (%u bytes)", (unsigned)copied);
+    } else {
+        LOG_W("Known-good cache copy failed, removing partial file");
+        LittleFS.remove(PICO_KNOWN_GOOD_PATH);
+    }
+    return ok;
+}
+
+/**
+ * @brief Verify the Pico comes up healthy after a flash
+ *
+ * Health = protocol connection re-established AND a boot info round trip
+ * (version + machine type report) answered, all within the deadline. One
+ * forced hardware reset is attempted mid-deadline if the Pico hasn't
+ * reconnected on its own. The caller must have resumed UART processing and
+ * cleared the connection state before calling.
+ */
+bool BrewWebServer::verifyPicoBootHealth(uint32_t deadlineMs) {
+    unsigned long start = millis();
+    unsigned long lastBootInfoRequest = 0;
+    bool resetTried = false;
+    bool wasConnected = false;
+
+    while (millis() - start < deadlineMs) {
+        delay(100);
+        feedWatchdog();
+        _picoUart.loop();
+
+        if (!_picoUart.isConnected()) {
+            // Halfway through the deadline with no connection: force a reset
+            if (!resetTried && millis() - start > deadlineMs / 2) {
+                LOG_W("Pico not reconnecting, forcing manual reset...");
+                _picoUart.resetPico();
+                resetTried = true;
+            }
+            continue;
+        }
+
+        if (!wasConnected) {
+            LOG_I("Pico reconnected after %lu ms, requesting boot info...", millis() - start);
+            wasConnected = true;
+        }
+
+        // Connected - ask for the boot report (re-request every 2 seconds
+        // in case the first request raced the Pico's boot sequence)
+        if (millis() - lastBootInfoRequest > 2000) {
+            _picoUart.requestBootInfo();
+            lastBootInfoRequest = millis();
+            continue;
+        }
+
+        const char* picoVersion = State.getPicoVersion();
+        if (picoVersion && picoVersion[0] != '\0' && State.getMachineType() != 0) {
+            LOG_I("Pico boot health check passed in %lu ms (version %s, machine type %u)",
+                  millis() - start, picoVersion, State.getMachineType());
+            return true;
+        }
+    }
+
+    LOG_E("Pico boot health check failed after %lu ms (connected=%d)",
+          millis() - start, _picoUart.isConnected());
+    return false;
+}
+
+/**
+ * @brief Reflash the cached known-good Pico image over SWD
+ *
+ * Last-resort recovery after a freshly flashed image fails its boot health
+ * check. Assumes the SWD pins were already configured by the OTA path that
+ * just ran.
+ */
+bool BrewWebServer::rollbackPicoViaSWD() {
+#if SWD_SUPPORTED
+    if (!LittleFS.exists(PICO_KNOWN_GOOD_PATH)) {
+        LOG_E("No known-good Pico image cached - cannot roll back");
+        return false;
+    }
+    File rollbackFile = LittleFS.open(PICO_KNOWN_GOOD_PATH, "r");
+    if (!rollbackFile) {
+        LOG_E("Failed to open known-good image");
+        return false;
+    }
+    size_t rollbackSize = rollbackFile.size();
+    LOG_W("Rolling back Pico to cached known-good image (%u bytes)...", (unsigned)rollbackSize);
+
+    // Quiesce UART while SWD owns the wires again
+    _picoUart.pause();
+    Serial1.end();
+    delay(10);
+
+    PicoSWD swd(SWD_DIO_PIN, SWD_CLK_PIN, SWD_RESET_PIN);
+    bool flashed = false;
+    if (swd.begin()) {
+        flashed = swd.flashFirmware(rollbackFile, rollbackSize);
+    } else {
+        LOG_E("SWD connection failed during rollback");
+    }
+    rollbackFile.close();
+    swd.end();
+    swd.resetTarget();
+
+    // Hand the wires back to the protocol UART
+    Serial1.begin(PICO_UART_BAUD, SERIAL_8N1, PICO_UART_RX_PIN, PICO_UART_TX_PIN);
+    delay(10);
+    _picoUart.resume();
+    _picoUart.clearConnectionState();
+
+    if (!flashed) {
+        LOG_E("Rollback flash failed");
+        return false;
+    }
+
+    if (!verifyPicoBootHealth(PICO_HEALTH_DEADLINE_MS)) {
+        LOG_E("Pico still unhealthy after rollback");
+        return false;
+    }
+
+    LOG_W("Pico rolled back to previous known-good firmware");
+    return true;
+#else
+    // Rollback reflash needs direct flash access - not available over the
+    // UART bootloader once the new image is already in the main slot
+    LOG_E("Rollback requires SWD support");
+    return false;
+#endif
+}
+
 bool BrewWebServer::startPicoGitHubOTA(const String& version) {
     LOG_I("Starting Pico GitHub OTA for version: %s", version.c_str());
     
@@ -1204,15 +1818,16 @@ bool BrewWebServer::startPicoGitHubOTA(const String& version) {
     
     // Flash firmware via SWD
     bool success = swd.flashFirmware(flashFile, firmwareSize);
-    
+
     // Clean up SWD connection
     swd.end();
-    
+
     flashFile.close();
-    
-    // Clean up temp file regardless of success
-    cleanupOtaFiles();
-    
+
+    // NOTE: the downloaded file is kept until the health check verdict - on
+    // success it becomes the known-good cache, on fallback the UART
+    // bootloader path re-reads it
+
     if (!success) {
             LOG_E("SWD firmware flashing failed, falling back to UART bootloader");
             broadcastLogLevel("warning", "SWD flash failed, trying UART bootloader");
@@ -1243,58 +1858,43 @@ bool BrewWebServer::startPicoGitHubOTA(const String& version) {
     LOG_I("Resetting Pico after successful SWD flash...");
     swd.end();  // Clean up SWD connection first
     swd.resetTarget();  // Then reset
-    
+
     broadcastOtaProgress(&_ws, "flash", 55, "Waiting for device restart...");
-    
+
     // Reinitialize Serial1 UART after SWD is done
     Serial1.begin(PICO_UART_BAUD, SERIAL_8N1, PICO_UART_RX_PIN, PICO_UART_TX_PIN);
             delay(10);
-    
+
     // Resume packet processing to detect when Pico comes back
     _picoUart.resume();
     LOG_I("Resumed UART packet processing");
-    
+
     // Clear connection state so we can detect when Pico actually reconnects
     _picoUart.clearConnectionState();
-    
-            // Wait for Pico to reconnect (same logic as UART bootloader)
-            bool picoReconnected = false;
-            for (int i = 0; i < 350; i++) {
-                delay(100);
-                feedWatchdog();
-                _picoUart.loop();
-                
-                if (_picoUart.isConnected()) {
-                    LOG_I("Pico reconnected after SWD flash (%d ms)", i * 100);
-                    picoReconnected = true;
-                    break;
-                }
-            }
-            
-            if (!picoReconnected) {
-                LOG_W("Pico did not reconnect after SWD flash, forcing manual reset...");
-                _picoUart.resetPico();
-                
-                for (int i = 0; i < 100; i++) {
-                    delay(100);
-                    feedWatchdog();
-                    _picoUart.loop();
-                    
-                    if (_picoUart.isConnected()) {
-                        LOG_I("Pico connected after manual reset (%d ms)", i * 100);
-                        picoReconnected = true;
-                        break;
-                    }
-                }
-                
-                if (!picoReconnected) {
-                    LOG_E("Pico failed to connect after SWD flash and manual reset");
-                    return false;
-                }
+
+            // Health check: the new image must reconnect AND answer a boot
+            // info round trip within the deadline before we trust it
+            if (verifyPicoBootHealth(PICO_HEALTH_DEADLINE_MS)) {
+                // This image is now the rollback target for the next update
+                cachePicoKnownGood();
+                cleanupOtaFiles();
+                LOG_I("Pico OTA complete!");
+                return true;
             }
-            
-            LOG_I("Pico OTA complete!");
-            return true;
+
+            // New image failed its boot health check - reflash the previous
+            // known-good image instead of leaving the machine bricked
+            LOG_E("New Pico firmware failed boot health check");
+            broadcastLogLevel("warning", "New controller firmware unhealthy, rolling back...");
+            broadcastOtaProgress(&_ws, "flash", 55, "Rolling back controller firmware...");
+
+            if (rollbackPicoViaSWD()) {
+                broadcastLogLevel("warning", "Controller rolled back to previous firmware");
+            } else {
+                broadcastLogLevel("error", "Controller rollback failed - manual recovery may be needed");
+            }
+            cleanupOtaFiles();
+            return false;
         }
     }
     
@@ -1947,6 +2547,509 @@ bool BrewWebServer::startPicoGitHubOTA(const String& version) {
     return true;
 }
 
+// =============================================================================
+// Pipelined firmware streaming - network read overlaps flash write
+// =============================================================================
+
+struct OtaPipeSlot {
+    uint8_t* data;
+    size_t len;
+};
+
+static QueueHandle_t s_otaPipeFreeQ = nullptr;   // Slots ready to be filled from the network
+static QueueHandle_t s_otaPipeReadyQ = nullptr;  // Slots waiting for flash write
+static volatile bool s_otaPipeWriteError = false;
+static volatile bool s_otaPipeWriterDone = false;
+static volatile size_t s_otaPipeFlashed = 0;     // Wire bytes the writer task has consumed
+static bool s_otaPipeGzip = false;               // Image is gzip-compressed on the wire
+static GzipStreamInflater s_otaInflater;         // Only armed when s_otaPipeGzip
+
+/**
+ * @brief GzipStreamInflater sink for the ESP32 OTA partition
+ */
+static bool gzipFlashSink(const uint8_t* data, size_t len, void* ctx) {
+    (void)ctx;
+    return Update.write((uint8_t*)data, len) == len;
+}
+
+/**
+ * @brief Flash writer task - drains ready slots into Update.write()
+ *
+ * Runs while the download loop keeps reading the next chunk, so flash
+ * erase/program time is hidden behind network/TLS time. A slot with
+ * data == nullptr is the shutdown sentinel.
+ */
+static void otaFlashWriterTask(void* param) {
+    (void)param;
+    OtaPipeSlot slot;
+    for (;;) {
+        if (xQueueReceive(s_otaPipeReadyQ, &slot, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (slot.data == nullptr) {
+            break;  // Sentinel - download finished or aborted
+        }
+        if (!s_otaPipeWriteError) {
+            bool ok;
+            if (s_otaPipeGzip) {
+                // Decompress in the writer so inflate CPU time also overlaps
+                // the network read on the other side of the pipe
+                ok = s_otaInflater.feed(slot.data, slot.len);
+            } else {
+                ok = (Update.write(slot.data, slot.len) == slot.len);
+            }
+            if (ok) {
+                s_otaPipeFlashed += slot.len;
+            } else {
+                LOG_E("Pipelined flash write failed at %u", (unsigned)s_otaPipeFlashed);
+                s_otaPipeWriteError = true;
+            }
+        }
+        xQueueSend(s_otaPipeFreeQ, &slot, portMAX_DELAY);
+    }
+    s_otaPipeWriterDone = true;
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Stream the firmware image from an HTTP stream into the OTA partition
+ *
+ * Double-buffered: while the writer task flashes one slot, this function
+ * reads (and CRCs) the next one from the network. Read size adapts between
+ * OTA_PIPE_MIN_READ and OTA_PIPE_SLOT_SIZE - it grows while the socket keeps
+ * the buffer full and shrinks when reads come up short, so slow links still
+ * get frequent watchdog feeds and fast links get full-size flash writes.
+ *
+ * Update.begin() is called here, not by the caller: the first bytes off the
+ * wire decide whether the image is gzip-compressed, and compressed images
+ * have to run Update with UPDATE_SIZE_UNKNOWN (the raw size isn't known up
+ * front). On failure the caller must still Update.abort() and http.end();
+ * all pipe resources (task, queues, slot buffers, inflater) are torn down
+ * here.
+ *
+ * @param http Active HTTP connection (status already checked)
+ * @param contentLength Expected wire size in bytes (compressed size for .gz)
+ * @param crcOut Receives the CRC32 of the streamed data
+ * @param errMsg Receives a short user-facing reason on failure
+ * @return true if the full image was written to flash
+ */
+static bool streamFirmwareToFlash(HTTPClient& http, size_t contentLength,
+                                  uint32_t* crcOut, const char** errMsg) {
+    WiFiClient* stream = http.getStreamPtr();
+    *errMsg = "";
+
+    uint8_t* slotMem[2] = {nullptr, nullptr};
+    slotMem[0] = new (std::nothrow) uint8_t[OTA_PIPE_SLOT_SIZE];
+    slotMem[1] = new (std::nothrow) uint8_t[OTA_PIPE_SLOT_SIZE];
+    s_otaPipeFreeQ = xQueueCreate(2, sizeof(OtaPipeSlot));
+    s_otaPipeReadyQ = xQueueCreate(2, sizeof(OtaPipeSlot));
+
+    TaskHandle_t writerTask = nullptr;
+    bool taskStarted = false;
+    if (slotMem[0] && slotMem[1] && s_otaPipeFreeQ && s_otaPipeReadyQ) {
+        s_otaPipeWriteError = false;
+        s_otaPipeWriterDone = false;
+        s_otaPipeFlashed = 0;
+        s_otaPipeGzip = false;
+        for (int i = 0; i < 2; i++) {
+            OtaPipeSlot slot = { slotMem[i], 0 };
+            xQueueSend(s_otaPipeFreeQ, &slot, 0);
+        }
+        // Core 0 with the rest of the network-adjacent tasks; Update.write()
+        // stalls the flash cache regardless of which core it runs on
+        taskStarted = (xTaskCreatePinnedToCore(otaFlashWriterTask, "OtaFlash",
+                                               OTA_PIPE_WRITER_STACK, nullptr,
+                                               OTA_PIPE_WRITER_PRIORITY,
+                                               &writerTask, 0) == pdPASS);
+    }
+
+    bool success = false;
+    if (!taskStarted) {
+        LOG_E("Failed to set up pipelined flash writer");
+        *errMsg = "Out of memory";
+    } else {
+        size_t readTotal = 0;
+        size_t readSize = OTA_PIPE_MIN_READ;  // Adaptive - grows while link keeps up
+        bool firstChunk = true;
+        unsigned long lastYield = millis();
+        unsigned long downloadStart = millis();
+        unsigned long lastProgressLog = 0;
+        unsigned long lastDataReceived = millis();
+        constexpr unsigned long STALL_TIMEOUT_MS = 30000;
+
+        // CRC32 is computed here, before data is handed to the writer, so the
+        // value always covers exactly what went to flash
+        uint32_t crc = 0xFFFFFFFF;
+        const uint32_t crc32Polynomial = 0xEDB88320;
+
+        while (readTotal < contentLength) {
+            if (!http.connected()) {
+                LOG_E("Connection lost (read %u/%u bytes)", (unsigned)readTotal, (unsigned)contentLength);
+                *errMsg = "Connection lost";
+                break;
+            }
+            if (s_otaPipeWriteError) {
+                *errMsg = "Write failed";
+                break;
+            }
+            if (millis() - downloadStart > OTA_DOWNLOAD_TIMEOUT_MS) {
+                LOG_E("Download timeout after %lu ms (read %u/%u bytes)",
+                      millis() - downloadStart, (unsigned)readTotal, (unsigned)contentLength);
+                *errMsg = "Timeout";
+                break;
+            }
+            if (millis() - lastDataReceived > STALL_TIMEOUT_MS) {
+                LOG_E("Download stalled - no data for %lu ms (read %u/%u bytes)",
+                      STALL_TIMEOUT_MS, (unsigned)readTotal, (unsigned)contentLength);
+                *errMsg = "Connection stalled";
+                break;
+            }
+            if (millis() - lastYield >= OTA_WATCHDOG_FEED_INTERVAL_MS) {
+                feedWatchdog();
+                yield();
+                lastYield = millis();
+            }
+
+            size_t available = stream->available();
+            if (available == 0) {
+                yield();
+                feedWatchdog();
+                continue;
+            }
+            lastDataReceived = millis();
+
+            // Grab a free slot - the writer returns them as it finishes. A
+            // short wait here means both slots are in flight, i.e. flash is
+            // the bottleneck and the network gets a breather.
+            OtaPipeSlot slot;
+            if (xQueueReceive(s_otaPipeFreeQ, &slot, pdMS_TO_TICKS(1000)) != pdTRUE) {
+                feedWatchdog();
+                continue;
+            }
+
+            size_t toRead = min(min(available, readSize), contentLength - readTotal);
+            size_t bytesRead = stream->readBytes(slot.data, toRead);
+            if (bytesRead == 0) {
+                xQueueSend(s_otaPipeFreeQ, &slot, 0);
+                yield();
+                continue;
+            }
+
+            if (firstChunk) {
+                firstChunk = false;
+                s_otaPipeGzip = GzipStreamInflater::looksCompressed(slot.data, bytesRead);
+                if (s_otaPipeGzip && !s_otaInflater.begin(gzipFlashSink, nullptr)) {
+                    LOG_E("OOM: gzip window alloc failed");
+                    *errMsg = "Out of memory";
+                    xQueueSend(s_otaPipeFreeQ, &slot, 0);
+                    break;
+                }
+                // Compressed images don't carry the uncompressed size up
+                // front, so let Update run open-ended in that case
+                if (!Update.begin(s_otaPipeGzip ? UPDATE_SIZE_UNKNOWN : contentLength)) {
+                    LOG_E("Not enough space for OTA");
+                    *errMsg = "Not enough space";
+                    xQueueSend(s_otaPipeFreeQ, &slot, 0);
+                    break;
+                }
+                if (s_otaPipeGzip) {
+                    LOG_I("Compressed image detected, streaming gunzip");
+                }
+            }
+
+            // Adapt the chunk size: full reads mean the socket has more
+            // buffered than we asked for, short reads mean we're ahead of it
+            if (bytesRead == readSize && readSize < OTA_PIPE_SLOT_SIZE) {
+                readSize = min(readSize * 2, OTA_PIPE_SLOT_SIZE);
+            } else if (bytesRead < readSize / 2 && readSize > OTA_PIPE_MIN_READ) {
+                readSize = max(readSize / 2, OTA_PIPE_MIN_READ);
+            }
+
+            for (size_t i = 0; i < bytesRead; i++) {
+                crc ^= slot.data[i];
+                for (int j = 0; j < 8; j++) {
+                    if (crc & 1) {
+                        crc = (crc >> 1) ^ crc32Polynomial;
+                    } else {
+                        crc >>= 1;
+                    }
+                }
+            }
+
+            slot.len = bytesRead;
+            xQueueSend(s_otaPipeReadyQ, &slot, portMAX_DELAY);
+            readTotal += bytesRead;
+
+            if (millis() - lastProgressLog > 2000) {
+                int pct = (readTotal * 100) / contentLength;
+                LOG_I("ESP32 OTA: %d%% (%u/%u bytes, %u flashed, chunk %u)",
+                      pct, (unsigned)readTotal, (unsigned)contentLength,
+                      (unsigned)s_otaPipeFlashed, (unsigned)readSize);
+                lastProgressLog = millis();
+            }
+        }
+
+        // Drain: wait for the writer to finish the in-flight slots
+        unsigned long drainStart = millis();
+        while (s_otaPipeFlashed < readTotal && !s_otaPipeWriteError &&
+               millis() - drainStart < 30000) {
+            feedWatchdog();
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+
+        bool inflateClean = !s_otaPipeGzip || s_otaInflater.isDone();
+        if (readTotal == contentLength && s_otaPipeFlashed == contentLength &&
+            !s_otaPipeWriteError && inflateClean) {
+            if (s_otaPipeGzip) {
+                LOG_I("Decompressed %u -> %u bytes", (unsigned)contentLength,
+                      (unsigned)s_otaInflater.bytesOut());
+            }
+            *crcOut = ~crc;
+            success = true;
+        } else if (**errMsg == '\0') {
+            if (s_otaPipeWriteError) {
+                *errMsg = "Write failed";
+            } else if (!inflateClean) {
+                LOG_E("Compressed stream ended mid-image");
+                *errMsg = "Corrupt compressed image";
+            } else {
+                LOG_E("Download incomplete: %u/%u", (unsigned)s_otaPipeFlashed, (unsigned)contentLength);
+                *errMsg = "Incomplete download";
+            }
+        }
+    }
+
+    // Teardown - stop the writer (sentinel), then free queues and buffers
+    if (taskStarted) {
+        OtaPipeSlot sentinel = { nullptr, 0 };
+        xQueueSend(s_otaPipeReadyQ, &sentinel, portMAX_DELAY);
+        // Give the task time to exit before its queues disappear
+        for (int i = 0; i < 100 && !s_otaPipeWriterDone; i++) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+    if (s_otaPipeGzip) {
+        s_otaInflater.end();
+    }
+    if (s_otaPipeFreeQ) { vQueueDelete(s_otaPipeFreeQ); s_otaPipeFreeQ = nullptr; }
+    if (s_otaPipeReadyQ) { vQueueDelete(s_otaPipeReadyQ); s_otaPipeReadyQ = nullptr; }
+    delete[] slotMem[0];
+    delete[] slotMem[1];
+
+    return success;
+}
+
+// =============================================================================
+// Delta OTA - block-level binary patches against the running image
+// =============================================================================
+//
+// Most releases change a small fraction of the image, so release tooling can
+// publish a per-hop patch asset ("delta-<from>-<full asset name>") next to
+// the full binary. The patch is a flat stream of block ops applied against
+// the RUNNING partition into the inactive OTA partition:
+//
+//   Header (24 bytes, little-endian):
+//     u32 magic "BDLT"   u8 version   u8[3] reserved
+//     u32 baseSize       u32 baseCrc32     - prefix of the running image
+//     u32 targetSize     u32 targetCrc32   - the new image
+//   Ops until targetSize bytes are produced:
+//     0x01 COPY  { u32 srcOffset, u32 len }  - blocks reused from base
+//     0x02 DATA  { u32 len, len bytes }      - literal new data
+//
+// The base CRC in the header pins the patch to one exact source image, which
+// replaces a device-side hash manifest: a device that skipped a release just
+// fails the base check and takes the full-image path.
+
+constexpr uint32_t DELTA_MAGIC = 0x42444C54;  // "BDLT"
+constexpr uint8_t DELTA_FORMAT_VERSION = 1;
+constexpr uint8_t DELTA_OP_COPY = 0x01;
+constexpr uint8_t DELTA_OP_DATA = 0x02;
+constexpr size_t DELTA_IO_CHUNK = 4096;
+constexpr size_t DELTA_HEADER_SIZE = 24;
+
+/**
+ * @brief Apply a downloaded delta patch to the inactive OTA partition
+ *
+ * Verifies the running image against the patch's base CRC before touching
+ * flash, and the produced image against the target CRC before Update.end().
+ * On failure Update has been aborted and errMsg holds a short reason.
+ */
+static bool applyDeltaPatch(const char* patchPath, const char** errMsg) {
+    *errMsg = "";
+    File patch = LittleFS.open(patchPath, "r");
+    if (!patch) {
+        *errMsg = "Patch missing";
+        return false;
+    }
+
+    uint8_t header[DELTA_HEADER_SIZE];
+    if (patch.read(header, sizeof(header)) != sizeof(header)) {
+        *errMsg = "Corrupt patch";
+        patch.close();
+        return false;
+    }
+
+    uint32_t magic, baseSize, baseCrc32, targetSize, targetCrc32;
+    memcpy(&magic, header, 4);
+    memcpy(&baseSize, header + 8, 4);
+    memcpy(&baseCrc32, header + 12, 4);
+    memcpy(&targetSize, header + 16, 4);
+    memcpy(&targetCrc32, header + 20, 4);
+
+    if (magic != DELTA_MAGIC || header[4] != DELTA_FORMAT_VERSION) {
+        LOG_E("Delta: bad magic/version");
+        *errMsg = "Corrupt patch";
+        patch.close();
+        return false;
+    }
+
+    const esp_partition_t* base = esp_ota_get_running_partition();
+    if (!base || baseSize > base->size || targetSize == 0) {
+        *errMsg = "Patch base mismatch";
+        patch.close();
+        return false;
+    }
+
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[DELTA_IO_CHUNK]);
+    if (!buffer) {
+        *errMsg = "Out of memory";
+        patch.close();
+        return false;
+    }
+
+    // Pin the patch to this exact running image before touching flash
+    uint32_t runningCrc = 0xFFFFFFFF;
+    for (size_t offset = 0; offset < baseSize; offset += DELTA_IO_CHUNK) {
+        size_t len = min((size_t)(baseSize - offset), DELTA_IO_CHUNK);
+        if (esp_partition_read(base, offset, buffer.get(), len) != ESP_OK) {
+            *errMsg = "Flash read failed";
+            patch.close();
+            return false;
+        }
+        runningCrc = crc32Update(runningCrc, buffer.get(), len);
+        feedWatchdog();
+    }
+    runningCrc = ~runningCrc;
+    if (runningCrc != baseCrc32) {
+        // Expected when the device skipped a release - not an error
+        LOG_I("Delta: running image CRC 0x%08X != patch base 0x%08X", runningCrc, baseCrc32);
+        *errMsg = "Patch base mismatch";
+        patch.close();
+        return false;
+    }
+
+    if (!Update.begin(targetSize)) {
+        LOG_E("Not enough space for OTA");
+        *errMsg = "Not enough space";
+        patch.close();
+        return false;
+    }
+
+    uint32_t outCrc = 0xFFFFFFFF;
+    size_t outWritten = 0;
+    bool corrupt = false;
+
+    while (outWritten < targetSize && !corrupt) {
+        uint8_t op[9];
+        if (patch.read(op, 1) != 1) { corrupt = true; break; }
+
+        if (op[0] == DELTA_OP_COPY) {
+            if (patch.read(op + 1, 8) != 8) { corrupt = true; break; }
+            uint32_t srcOffset, len;
+            memcpy(&srcOffset, op + 1, 4);
+            memcpy(&len, op + 5, 4);
+            if ((uint64_t)srcOffset + len > base->size || outWritten + len > targetSize) {
+                corrupt = true;
+                break;
+            }
+            for (uint32_t done = 0; done < len; done += DELTA_IO_CHUNK) {
+                size_t chunk = min((size_t)(len - done), DELTA_IO_CHUNK);
+                if (esp_partition_read(base, srcOffset + done, buffer.get(), chunk) != ESP_OK ||
+                    Update.write(buffer.get(), chunk) != chunk) {
+                    corrupt = true;
+                    break;
+                }
+                outCrc = crc32Update(outCrc, buffer.get(), chunk);
+                outWritten += chunk;
+                feedWatchdog();
+            }
+        } else if (op[0] == DELTA_OP_DATA) {
+            if (patch.read(op + 1, 4) != 4) { corrupt = true; break; }
+            uint32_t len;
+            memcpy(&len, op + 1, 4);
+            if (outWritten + len > targetSize) { corrupt = true; break; }
+            for (uint32_t done = 0; done < len; done += DELTA_IO_CHUNK) {
+                size_t chunk = min((size_t)(len - done), DELTA_IO_CHUNK);
+                if (patch.read(buffer.get(), chunk) != chunk ||
+                    Update.write(buffer.get(), chunk) != chunk) {
+                    corrupt = true;
+                    break;
+                }
+                outCrc = crc32Update(outCrc, buffer.get(), chunk);
+                outWritten += chunk;
+                feedWatchdog();
+            }
+        } else {
+            corrupt = true;
+        }
+    }
+
+    patch.close();
+    outCrc = ~outCrc;
+
+    if (corrupt || outWritten != targetSize || outCrc != targetCrc32) {
+        LOG_E("Delta: verify failed (wrote %u/%u, CRC 0x%08X vs 0x%08X)",
+              (unsigned)outWritten, (unsigned)targetSize, outCrc, targetCrc32);
+        Update.abort();
+        *errMsg = "Patch verify failed";
+        return false;
+    }
+
+    if (!Update.end(true)) {
+        LOG_E("Update failed: %s", Update.errorString());
+        *errMsg = "Installation failed";
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Try a block-level delta update for this release hop
+ *
+ * Downloads "delta-<running version>-<asset>" from the release and applies
+ * it against the running partition. Returns true only with the new image
+ * fully written and verified; any miss leaves the caller on the full-image
+ * path.
+ */
+static bool tryDeltaOTA(const char* tag, const String& fullAssetName) {
+    String deltaAsset = String("delta-") + ESP32_VERSION + "-" + fullAssetName;
+    char url[256];
+    snprintf(url, sizeof(url),
+             "https://github.com/" GITHUB_OWNER "/" GITHUB_REPO "/releases/download/%s/%s",
+             tag, deltaAsset.c_str());
+    LOG_I("Trying delta update: %s", deltaAsset.c_str());
+
+    const char* patchPath = "/esp32_delta.bin";
+    size_t patchSize = 0;
+    if (!downloadToFile(url, patchPath, &patchSize)) {
+        LOG_I("No delta for this hop - using full image");
+        return false;
+    }
+
+    const char* errMsg = nullptr;
+    bool ok = applyDeltaPatch(patchPath, &errMsg);
+    LittleFS.remove(patchPath);
+
+    if (!ok) {
+        LOG_W("Delta apply failed (%s) - falling back to full image", errMsg);
+        return false;
+    }
+
+    LOG_I("Delta update applied: %u byte patch", (unsigned)patchSize);
+    return true;
+}
+
 // =============================================================================
 // ESP32 OTA - Download and flash ESP32 firmware + LittleFS
 // =============================================================================
@@ -1973,7 +3076,17 @@ void BrewWebServer::startGitHubOTA(const String& version) {
              "https://github.com/" GITHUB_OWNER "/" GITHUB_REPO "/releases/download/%s/%s", 
              tag, esp32AssetName.c_str());
     LOG_I("ESP32 download URL: %s", downloadUrl);
-    
+
+    // Block-level delta first: routine releases change only a small fraction
+    // of the image, so fetching just the changed blocks turns a multi-minute
+    // transfer into seconds. Any miss (no patch published for this hop, base
+    // image mismatch, corrupt patch) falls through to the full image below.
+    broadcastOtaProgress(&_ws, "download", 65, "Checking for delta update...");
+    if (tryDeltaOTA(tag, esp32AssetName)) {
+        finishEsp32OTA(tag);
+        return;  // Not reached - finishEsp32OTA restarts
+    }
+
     broadcastOtaProgress(&_ws, "download", 65, "Downloading ESP32 firmware...");
     
     String currentUrl = String(downloadUrl);
@@ -2163,149 +3276,25 @@ void BrewWebServer::startGitHubOTA(const String& version) {
     }
     
     LOG_I("ESP32 firmware size: %d bytes", contentLength);
-    
-    // Begin OTA update
-    if (!Update.begin(contentLength)) {
-        LOG_E("Not enough space for OTA");
-        broadcastLogLevel("error", "Update error: Not enough space");
-        broadcastOtaProgress(&_ws, "error", 0, "Not enough space");
-        http.end();
-        return;
-    }
-    
+
     broadcastOtaProgress(&_ws, "download", 70, "Installing ESP32 firmware...");
     
-    // Stream firmware to flash
-    WiFiClient* stream = http.getStreamPtr();
-    const size_t HEAP_BUFFER_SIZE = 4096;
-    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[HEAP_BUFFER_SIZE]);
-    if (!buffer) {
-        LOG_E("Failed to allocate buffer");
+    // Stream firmware to flash - pipelined path, see streamFirmwareToFlash()
+    LOG_I("Starting ESP32 firmware download with CRC32 verification...");
+    uint32_t streamCRC32 = 0;
+    const char* streamError = nullptr;
+    if (!streamFirmwareToFlash(http, (size_t)contentLength, &streamCRC32, &streamError)) {
         Update.abort();
         http.end();
-        broadcastLogLevel("error", "Update error: Out of memory");
-        broadcastOtaProgress(&_ws, "error", 0, "Out of memory");
+        broadcastLogLevel("error", "Update error: %s", streamError);
+        broadcastOtaProgress(&_ws, "error", 0, streamError);
         return;
     }
-    size_t written = 0;
-    unsigned long lastYield = millis();
-    unsigned long downloadStart = millis();
-    unsigned long lastProgressLog = 0;  // For console progress logging
-    unsigned long lastDataReceived = millis();  // Track stalls
-    constexpr unsigned long STALL_TIMEOUT_MS = 30000;  // 30 second stall timeout
-    
-    // Calculate CRC32 during download for integrity verification
-    uint32_t streamCRC32 = 0xFFFFFFFF;
-    const uint32_t crc32Polynomial = 0xEDB88320;
-    
-    LOG_I("Starting ESP32 firmware download with CRC32 verification...");
-    
-    while (http.connected() && written < (size_t)contentLength) {
-        // Check overall timeout
-        if (millis() - downloadStart > OTA_DOWNLOAD_TIMEOUT_MS) {
-            LOG_E("Download timeout after %lu ms (wrote %d/%d bytes)", 
-                  millis() - downloadStart, written, contentLength);
-            Update.abort();
-            http.end();
-            broadcastLogLevel("error", "Update error: Timeout");
-            broadcastOtaProgress(&_ws, "error", 0, "Timeout");
-            return;
-        }
-        
-        // Check for stall (no data for 30 seconds)
-        if (millis() - lastDataReceived > STALL_TIMEOUT_MS) {
-            LOG_E("Download stalled - no data for %lu ms (wrote %d/%d bytes)", 
-                  STALL_TIMEOUT_MS, written, contentLength);
-            Update.abort();
-            http.end();
-            broadcastLogLevel("error", "Update error: Connection stalled");
-            broadcastOtaProgress(&_ws, "error", 0, "Connection stalled");
-            return;
-        }
-        
-        // Feed watchdog
-        if (millis() - lastYield >= OTA_WATCHDOG_FEED_INTERVAL_MS) {
-            feedWatchdog();
-            yield();
-            lastYield = millis();
-        }
-        
-        size_t available = stream->available();
-        if (available > 0) {
-            lastDataReceived = millis();  // Reset stall timer
-            
-            // Limit read size to prevent blocking main loop for too long
-            size_t maxChunkSize = min(available, (size_t)4096);  // Max 4KB per chunk
-            size_t toRead = min(maxChunkSize, HEAP_BUFFER_SIZE);
-            
-            // Yield before potentially blocking read operation
-            feedWatchdog();
-            yield();
-            
-            size_t bytesRead = stream->readBytes(buffer.get(), toRead);
-            
-            if (bytesRead > 0) {
-                // Calculate CRC32 for this chunk BEFORE writing to flash
-                // This verifies data integrity during download
-                for (size_t i = 0; i < bytesRead; i++) {
-                    streamCRC32 ^= buffer[i];
-                    for (int j = 0; j < 8; j++) {
-                        if (streamCRC32 & 1) {
-                            streamCRC32 = (streamCRC32 >> 1) ^ crc32Polynomial;
-                        } else {
-                            streamCRC32 >>= 1;
-                        }
-                    }
-                }
-                
-                // Yield before potentially blocking write operation
-                feedWatchdog();
-                yield();
-                
-                size_t bytesWritten = Update.write(buffer.get(), bytesRead);
-                if (bytesWritten != bytesRead) {
-                    LOG_E("Write error at %d", written);
-                    Update.abort();
-                    http.end();
-                    broadcastLogLevel("error", "Update error: Write failed");
-                    broadcastOtaProgress(&_ws, "error", 0, "Write failed");
-                    return;
-                }
-                
-                // Yield after write to allow main loop to run
-                // This prevents blocking the main loop for >1 second
-                feedWatchdog();
-                yield();
-                vTaskDelay(pdMS_TO_TICKS(1));  // 1ms delay using FreeRTOS for better task scheduling
-                written += bytesWritten;
-                
-                // Log to console every 2 seconds (UI uses animation, not progress bar)
-                if (millis() - lastProgressLog > 2000) {
-                    int pct = (written * 100) / contentLength;
-                    LOG_I("ESP32 OTA: %d%% (%d/%d bytes)", pct, written, contentLength);
-                    lastProgressLog = millis();
-                }
-            }
-        } else {
-            yield();  // Yield to other tasks while waiting for data
-            feedWatchdog();
-        }
-    }
-    
+
     http.end();
     feedWatchdog();
-    
-    if (written != (size_t)contentLength) {
-        LOG_E("Download incomplete: %d/%d", written, contentLength);
-        Update.abort();
-        broadcastLogLevel("error", "Update error: Incomplete download");
-        broadcastOtaProgress(&_ws, "error", 0, "Incomplete download");
-        return;
-    }
-    
-    // Finalize CRC32 calculation
-    streamCRC32 = ~streamCRC32;
-    LOG_I("ESP32 firmware download complete: %d bytes, CRC32=0x%08X", written, streamCRC32);
+
+    LOG_I("ESP32 firmware download complete: %d bytes, CRC32=0x%08X", contentLength, streamCRC32);
     
     // Check if we have an expected CRC32 to verify against
     // (This could come from release metadata or a previous successful download)
@@ -2345,6 +3334,18 @@ void BrewWebServer::startGitHubOTA(const String& version) {
     }
     
     LOG_I("ESP32 firmware update successful! CRC32 verified: 0x%08X", streamCRC32);
+
+    finishEsp32OTA(tag);
+}
+
+/**
+ * @brief Shared tail of a successful ESP32 firmware flash
+ *
+ * Runs the LittleFS update and restarts the device. Used by both the
+ * full-image and delta OTA paths once the new image is in the inactive
+ * partition.
+ */
+void BrewWebServer::finishEsp32OTA(const char* tag) {
     
     // Update LittleFS (optional - continue even if fails)
     // CRITICAL: LittleFS update is non-critical - firmware is already flashed
@@ -2405,6 +3406,7 @@ void BrewWebServer::startGitHubOTA(const String& version) {
     }
 }
 
+
 /**
  * Update LittleFS filesystem (called after ESP32 firmware update)
  * Non-critical - continues even if fails
@@ -1,6 +1,7 @@
 #include "web_server.h"
 #include "config.h"
 #include "../shared/protocol_defs.h"  // For CONFIG_MACHINE_INFO
+#include "../shared/config_limits.h"  // Pre-transmit bounds, same table the Pico enforces
 #include "memory_utils.h"
 #include "pico_uart.h"
 #include "mqtt_client.h"
@@ -8,6 +9,8 @@
 #include "scale/scale_manager.h"
 #include "pairing_manager.h"
 #include "cloud_connection.h"
+#include "cloud_config_sync.h"
+#include "command_router.h"
 #include "state/state_manager.h"
 #include "power_meter/power_meter_manager.h"
 #include "ui/ui.h"
@@ -15,6 +18,7 @@
 #include "log_manager.h"
 #include <ArduinoJson.h>
 #include <stdarg.h>
+#include <esp_timer.h>
 
 // External reference to machine state defined in main.cpp
 // Use getter function for thread-safe access to machine state
@@ -46,7 +50,8 @@ void BrewWebServer::handleWsEvent(AsyncWebSocket* server, AsyncWebSocketClient*
             break;
             
         case WS_EVT_CONNECT:
-            handleWsConnect(server, client);
+            // For WS_EVT_CONNECT, arg is the upgrade AsyncWebServerRequest
+            handleWsConnect(server, client, (AsyncWebServerRequest*)arg);
             break;
             
         case WS_EVT_DATA:
@@ -69,7 +74,7 @@ void BrewWebServer::handleWsEvent(AsyncWebSocket* server, AsyncWebSocketClient*
     }
 }
 
-void BrewWebServer::handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient* client) {
+void BrewWebServer::handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient* client, AsyncWebServerRequest* request) {
     // Limit concurrent clients to save RAM (each WS client uses ~4KB)
     // Allow 2-3 clients to handle page refreshes where old connection overlaps with new one
     // Note: count() includes the connecting client, so > 3 means there are already 3+ clients
@@ -82,7 +87,17 @@ void BrewWebServer::handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient
     }
     
     LOG_I("WebSocket client %u connected from %s", client->id(), client->remoteIP().toString().c_str());
-    
+
+    // MessagePack opt-in is negotiated via a query parameter on the upgrade
+    // request (ws://host/ws?proto=msgpack) rather than Sec-WebSocket-Protocol:
+    // AsyncWebSocket doesn't echo subprotocols back in the 101 response and
+    // browsers abort the connection when a requested subprotocol isn't confirmed
+    if (request && request->hasParam("proto") &&
+        request->getParam("proto")->value() == "msgpack") {
+        markClientMsgPack(client->id());
+        LOG_I("Client %u negotiated MessagePack frames", client->id());
+    }
+
     // Note: Local and cloud WebSocket connections can work simultaneously
     // Cloud connection is no longer paused when local clients connect
     
@@ -125,10 +140,98 @@ void BrewWebServer::handleWsConnect(AsyncWebSocket* server, AsyncWebSocketClient
 
 void BrewWebServer::handleWsDisconnect(AsyncWebSocket* server, AsyncWebSocketClient* client) {
     LOG_I("WebSocket client %u disconnected", client->id());
+    clearClientHealth(client->id());
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_msgpackClients[i] == client->id()) {
+            _msgpackClients[i] = 0;
+        }
+    }
     // Note: Cloud connection continues to work independently of local WebSocket clients
     // No need to pause/resume cloud when local clients connect/disconnect
 }
 
+// =============================================================================
+// Slow-client tracking
+// One stalled client (phone on weak WiFi) used to exhaust AsyncTCP buffers and
+// delay broadcasts to everyone, including the wall-tablet dashboard. The
+// broadcast loop already skips clients whose queue is full (status frames are
+// superseded by the next tick anyway); these helpers count those drops and
+// evict clients whose queue stays full for WS_EVICT_STREAK consecutive ticks.
+// =============================================================================
+
+void BrewWebServer::noteClientSendOk(uint32_t clientId) {
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_wsHealth[i].inUse && _wsHealth[i].clientId == clientId) {
+            _wsHealth[i].fullStreak = 0;
+            return;
+        }
+    }
+}
+
+void BrewWebServer::noteClientQueueFull(AsyncWebSocketClient& client) {
+    _wsFramesDropped++;
+
+    // Find or allocate this client's slot
+    int slot = -1;
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_wsHealth[i].inUse && _wsHealth[i].clientId == client.id()) {
+            slot = i;
+            break;
+        }
+        if (slot < 0 && !_wsHealth[i].inUse) {
+            slot = i;
+        }
+    }
+    if (slot < 0) {
+        return;  // Table full (shouldn't happen - more slots than the client cap)
+    }
+    if (!_wsHealth[slot].inUse) {
+        _wsHealth[slot].inUse = true;
+        _wsHealth[slot].clientId = client.id();
+        _wsHealth[slot].fullStreak = 0;
+    }
+
+    if (++_wsHealth[slot].fullStreak >= WS_EVICT_STREAK) {
+        LOG_W("WebSocket client %u queue full for %u consecutive updates, evicting slow client",
+              client.id(), _wsHealth[slot].fullStreak);
+        _wsClientsEvicted++;
+        _wsHealth[slot].inUse = false;
+        // close() triggers WS_EVT_DISCONNECT which frees the queued buffers
+        client.close();
+    }
+}
+
+void BrewWebServer::clearClientHealth(uint32_t clientId) {
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_wsHealth[i].inUse && _wsHealth[i].clientId == clientId) {
+            _wsHealth[i].inUse = false;
+            return;
+        }
+    }
+}
+
+// =============================================================================
+// Per-client MessagePack opt-in
+// =============================================================================
+
+void BrewWebServer::markClientMsgPack(uint32_t clientId) {
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_msgpackClients[i] == 0 || _msgpackClients[i] == clientId) {
+            _msgpackClients[i] = clientId;
+            return;
+        }
+    }
+}
+
+bool BrewWebServer::isClientMsgPack(uint32_t clientId) const {
+    for (uint8_t i = 0; i < WS_HEALTH_SLOTS; i++) {
+        if (_msgpackClients[i] == clientId) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void BrewWebServer::handleWsError(AsyncWebSocketClient* client, uint8_t* data, size_t len) {
     // Log error with available details
     // Note: 'data' may contain error information, 'len' is the length
@@ -162,8 +265,13 @@ void BrewWebServer::handleWsMessage(uint32_t clientNum, uint8_t* payload, size_t
         return;
     }
     
-    // Use shared command processor
-    processCommand(doc);
+    // Post to the CommandRouter so the command executes on Core 1 with the
+    // MQTT/cloud sources (this runs on the async_tcp task). Oversized
+    // payloads (e.g. config writes) fall back to the inline processor.
+    const char* type = doc["type"] | "";
+    if (!CommandRouter::post(CMD_SOURCE_WEB, type, doc)) {
+        processCommand(doc);
+    }
 }
 
 /**
@@ -206,7 +314,9 @@ void BrewWebServer::processCommand(JsonDocument& doc) {
         // Send full status and device info
         // Note: broadcastFullStatus will send full status (not delta) on next call
         // because the change detector will be reset or this is an explicit request
-        broadcastFullStatus(runtimeState().get());
+        ui_state_t stateSnapshot;
+        runtimeState().snapshot(stateSnapshot);
+        broadcastFullStatus(stateSnapshot);
         broadcastDeviceInfo();
     }
     else if (type == "getConfig") {
@@ -233,79 +343,153 @@ void BrewWebServer::processCommand(JsonDocument& doc) {
         broadcastLog("Log level set to: %s", logLevelToString(level));
     }
     else if (type == "command") {
-        // Handle commands from web UI
-        String cmd = doc["cmd"] | "";
-        LOG_I("Command: %s", cmd.c_str());
-        
-        // Route to category-specific handlers
-        if (cmd == "set_eco" || cmd == "enter_eco" || cmd == "exit_eco" || cmd == "set_temp") {
-            handleTemperatureCommand(doc, cmd);
-        }
-        else if (cmd == "set_mode") {
-            handleModeCommand(doc, cmd);
-        }
-        else if (cmd == "mqtt_test" || cmd == "mqtt_config") {
-            handleMqttCommand(doc, cmd);
-        }
-        else if (cmd == "set_cloud_config") {
-            handleCloudCommand(doc, cmd);
-        }
-        else if (cmd == "add_schedule" || cmd == "update_schedule" || cmd == "delete_schedule" || 
-                 cmd == "toggle_schedule" || cmd == "set_auto_off" || cmd == "get_schedules") {
-            handleScheduleCommand(doc, cmd);
-        }
-        else if (cmd == "scale_scan" || cmd == "scale_scan_stop" || cmd == "scale_connect" || 
-                 cmd == "scale_disconnect" || cmd == "tare" || cmd == "scale_tare" || cmd == "scale_reset") {
-            handleScaleCommand(doc, cmd);
-        }
-        else if (cmd == "set_bbw") {
-            handleBrewByWeightCommand(doc, cmd);
-        }
-        else if (cmd == "set_preinfusion") {
-            handlePreinfusionCommand(doc, cmd);
-        }
-        else if (cmd == "set_power" || cmd == "set_power_config") {
-            handlePowerCommand(doc, cmd);
-        }
-        else if (cmd == "configure_power_meter" || cmd == "start_power_meter_discovery" || cmd == "test_power_meter") {
-            handlePowerMeterCommand(doc, cmd);
-        }
-        else if (cmd == "wifi_forget" || cmd == "wifi_config") {
-            handleWiFiCommand(doc, cmd);
-        }
-        else if (cmd == "restart" || cmd == "factory_reset") {
-            handleSystemCommand(doc, cmd);
-        }
-        else if (cmd == "check_update" || cmd == "ota_start" || cmd == "esp32_ota_start" || 
-                 cmd == "pico_ota_start" || cmd == "check_version_mismatch") {
-            handleOtaCommand(doc, cmd);
-        }
-        else if (cmd == "set_machine_info" || cmd == "set_device_info") {
-            handleMachineInfoCommand(doc, cmd);
-        }
-        else if (cmd == "set_preferences") {
-            handlePreferencesCommand(doc, cmd);
-        }
-        else if (cmd == "set_time_config" || cmd == "get_time_status" || cmd == "sync_time") {
-            handleTimeCommand(doc, cmd);
+        // Handle commands from web UI - non-owning view, no String allocation
+        // on the per-command hot path (the document owns the bytes)
+        std::string_view cmd = doc["cmd"] | "";
+        LOG_I("Command: %s", cmd.data());
+
+        if (!dispatchCommand(doc, cmd)) {
+            LOG_W("Unknown command: %s", cmd.data());
         }
-        else if (cmd == "record_maintenance") {
-            handleMaintenanceCommand(doc, cmd);
+    }
+}
+
+// =============================================================================
+// Command Registry
+// =============================================================================
+// One flat table maps every "cmd" string to its category handler. Dispatch
+// is a binary search over the sorted names (HA command bursts used to walk
+// a ~20-arm strcmp cascade per message), and each entry accumulates
+// call/latency stats, surfaced via /api/command-stats.
+
+BrewWebServer::CommandEntry BrewWebServer::_commandTable[] = {
+    // MUST stay sorted by name (ASCII) - verified once at first dispatch
+    { "add_schedule",                &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "check_update",                &BrewWebServer::handleOtaCommand,         0, 0, 0 },
+    { "check_version_mismatch",      &BrewWebServer::handleOtaCommand,         0, 0, 0 },
+    { "clear_logs",                  &BrewWebServer::handleLogCommand,         0, 0, 0 },
+    { "config_pull",                 &BrewWebServer::handleCloudCommand,       0, 0, 0 },
+    { "configure_power_meter",       &BrewWebServer::handlePowerMeterCommand,  0, 0, 0 },
+    { "delete_schedule",             &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "enter_eco",                   &BrewWebServer::handleTemperatureCommand, 0, 0, 0 },
+    { "esp32_ota_start",             &BrewWebServer::handleOtaCommand,         0, 0, 0 },
+    { "exit_eco",                    &BrewWebServer::handleTemperatureCommand, 0, 0, 0 },
+    { "factory_reset",               &BrewWebServer::handleSystemCommand,      0, 0, 0 },
+    { "get_log_config",              &BrewWebServer::handleLogCommand,         0, 0, 0 },
+    { "get_schedules",               &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "get_time_status",             &BrewWebServer::handleTimeCommand,        0, 0, 0 },
+    { "mqtt_config",                 &BrewWebServer::handleMqttCommand,        0, 0, 0 },
+    { "mqtt_test",                   &BrewWebServer::handleMqttCommand,        0, 0, 0 },
+    { "ota_start",                   &BrewWebServer::handleOtaCommand,         0, 0, 0 },
+    { "pico_ota_start",              &BrewWebServer::handleOtaCommand,         0, 0, 0 },
+    { "record_maintenance",          &BrewWebServer::handleMaintenanceCommand, 0, 0, 0 },
+    { "restart",                     &BrewWebServer::handleSystemCommand,      0, 0, 0 },
+    { "run_diagnostic_test",         &BrewWebServer::handleDiagnosticsCommand, 0, 0, 0 },
+    { "run_diagnostics",             &BrewWebServer::handleDiagnosticsCommand, 0, 0, 0 },
+    { "scale_connect",               &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "scale_disconnect",            &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "scale_reset",                 &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "scale_scan",                  &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "scale_scan_stop",             &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "scale_tare",                  &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "set_auto_off",                &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "set_bbw",                     &BrewWebServer::handleBrewByWeightCommand, 0, 0, 0 },
+    { "set_cloud_config",            &BrewWebServer::handleCloudCommand,       0, 0, 0 },
+    { "set_device_info",             &BrewWebServer::handleMachineInfoCommand, 0, 0, 0 },
+    { "set_eco",                     &BrewWebServer::handleTemperatureCommand, 0, 0, 0 },
+    { "set_log_config",              &BrewWebServer::handleLogCommand,         0, 0, 0 },
+    { "set_machine_info",            &BrewWebServer::handleMachineInfoCommand, 0, 0, 0 },
+    { "set_mode",                    &BrewWebServer::handleModeCommand,        0, 0, 0 },
+    { "set_power",                   &BrewWebServer::handlePowerCommand,       0, 0, 0 },
+    { "set_power_config",            &BrewWebServer::handlePowerCommand,       0, 0, 0 },
+    { "set_preferences",             &BrewWebServer::handlePreferencesCommand, 0, 0, 0 },
+    { "set_preinfusion",             &BrewWebServer::handlePreinfusionCommand, 0, 0, 0 },
+    { "set_temp",                    &BrewWebServer::handleTemperatureCommand, 0, 0, 0 },
+    { "set_time_config",             &BrewWebServer::handleTimeCommand,        0, 0, 0 },
+    { "start_power_meter_discovery", &BrewWebServer::handlePowerMeterCommand,  0, 0, 0 },
+    { "sync_time",                   &BrewWebServer::handleTimeCommand,        0, 0, 0 },
+    { "tare",                        &BrewWebServer::handleScaleCommand,       0, 0, 0 },
+    { "test_power_meter",            &BrewWebServer::handlePowerMeterCommand,  0, 0, 0 },
+    { "toggle_schedule",             &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "update_schedule",             &BrewWebServer::handleScheduleCommand,    0, 0, 0 },
+    { "wifi_config",                 &BrewWebServer::handleWiFiCommand,        0, 0, 0 },
+    { "wifi_forget",                 &BrewWebServer::handleWiFiCommand,        0, 0, 0 },
+};
+
+const size_t BrewWebServer::_commandTableSize =
+    sizeof(BrewWebServer::_commandTable) / sizeof(BrewWebServer::_commandTable[0]);
+
+bool BrewWebServer::dispatchCommand(JsonDocument& doc, std::string_view cmd) {
+    // Sort-order sanity check on first dispatch: a misplaced entry silently
+    // breaks binary search, so verify neighbours once and scream if someone
+    // inserted out of order
+    static bool s_tableVerified = []() {
+        bool ok = true;
+        for (size_t i = 1; i < _commandTableSize; i++) {
+            if (strcmp(_commandTable[i - 1].name, _commandTable[i].name) >= 0) {
+                LOG_E("Command table unsorted at '%s' - dispatch will miss entries",
+                      _commandTable[i].name);
+                ok = false;
+            }
         }
-        else if (cmd == "run_diagnostics" || cmd == "run_diagnostic_test") {
-            handleDiagnosticsCommand(doc, cmd);
+        return ok;
+    }();
+    (void)s_tableVerified;
+
+    int lo = 0;
+    int hi = (int)_commandTableSize - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int c = cmd.compare(_commandTable[mid].name);
+        if (c == 0) {
+            CommandEntry& entry = _commandTable[mid];
+            int64_t start = esp_timer_get_time();
+            (this->*entry.handler)(doc, cmd);
+            uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+            entry.calls++;
+            entry.totalUs += elapsed;
+            if (elapsed > entry.maxUs) {
+                entry.maxUs = elapsed;
+            }
+            return true;
         }
-        else if (cmd == "set_log_config" || cmd == "clear_logs" || cmd == "get_log_config") {
-            handleLogCommand(doc, cmd);
+        if (c < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
         }
     }
+    return false;
+}
+
+void BrewWebServer::commandStatsToJson(JsonArray& arr) {
+    for (size_t i = 0; i < _commandTableSize; i++) {
+        const CommandEntry& entry = _commandTable[i];
+        if (entry.calls == 0) {
+            continue;  // Only report commands that were actually used
+        }
+        JsonObject obj = arr.add<JsonObject>();
+        obj["cmd"] = entry.name;
+        obj["calls"] = entry.calls;
+        obj["totalUs"] = (uint32_t)entry.totalUs;
+        obj["avgUs"] = (uint32_t)(entry.totalUs / entry.calls);
+        obj["maxUs"] = entry.maxUs;
+    }
+}
+
+void BrewWebServer::resetCommandStats() {
+    for (size_t i = 0; i < _commandTableSize; i++) {
+        _commandTable[i].calls = 0;
+        _commandTable[i].totalUs = 0;
+        _commandTable[i].maxUs = 0;
+    }
 }
 
 // =============================================================================
 // Command Handlers - Organized by Category
 // =============================================================================
 
-void BrewWebServer::handleTemperatureCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleTemperatureCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "set_eco") {
         // Set eco mode configuration
         // Pico is the source of truth, but we persist on ESP32 as backup/cache
@@ -416,7 +600,7 @@ void BrewWebServer::handleTemperatureCommand(JsonDocument& doc, const String& cm
     }
 }
 
-void BrewWebServer::handleModeCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleModeCommand(JsonDocument& doc, std::string_view cmd) {
     // Set machine mode
     String mode = doc["mode"] | "";
     uint8_t modeCmd = 0;
@@ -491,7 +675,7 @@ void BrewWebServer::handleModeCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleMqttCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleMqttCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "mqtt_test") {
         // Test MQTT connection with temporary config (doesn't modify permanent config)
         MQTTConfig testConfig;
@@ -591,7 +775,14 @@ void BrewWebServer::handleMqttCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleCloudCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleCloudCommand(JsonDocument& doc, std::string_view cmd) {
+    if (cmd == "config_pull") {
+        // Relay compared our bulk-verify hashes against its stored sections
+        // and wants the named ones re-uploaded (empty = all)
+        CloudConfigSync::requestSections(doc["sections"].as<JsonArrayConst>());
+        return;
+    }
+
     // Update cloud config
     auto& cloudSettings = State.settings().cloud;
     bool wasEnabled = cloudSettings.enabled;
@@ -646,7 +837,7 @@ void BrewWebServer::handleCloudCommand(JsonDocument& doc, const String& cmd) {
     broadcastLog("Cloud configuration updated: %s", cloudSettings.enabled ? "enabled" : "disabled");
 }
 
-void BrewWebServer::handleScheduleCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleScheduleCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "add_schedule") {
         // Add a new schedule
         BrewOS::ScheduleEntry entry;
@@ -700,7 +891,7 @@ void BrewWebServer::handleScheduleCommand(JsonDocument& doc, const String& cmd)
     }
 }
 
-void BrewWebServer::handleScaleCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleScaleCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "scale_scan") {
         if (!scaleManager || !scaleManager->isScanning()) {
             if (scaleManager && scaleManager->isConnected()) {
@@ -740,7 +931,7 @@ void BrewWebServer::handleScaleCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleBrewByWeightCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleBrewByWeightCommand(JsonDocument& doc, std::string_view cmd) {
     // Accept both camelCase (from web client) and snake_case field names
     // Target weight
     if (!doc["targetWeight"].isNull()) {
@@ -783,15 +974,16 @@ void BrewWebServer::handleBrewByWeightCommand(JsonDocument& doc, const String& c
     broadcastBBWSettings();
 }
 
-void BrewWebServer::handlePreinfusionCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handlePreinfusionCommand(JsonDocument& doc, std::string_view cmd) {
     bool enabled = doc["enabled"] | false;
     uint16_t onTimeMs = doc["onTimeMs"] | 3000;
     uint16_t pauseTimeMs = doc["pauseTimeMs"] | 5000;
     
-    // Validate timing parameters
-    if (onTimeMs > 10000) {
+    // Validate against the shared constraint table - same bounds the Pico
+    // enforces, so a bad value never costs a command/NACK round trip
+    if (!config_limit_check(CFG_LIMIT_PREINFUSION_ON, onTimeMs)) {
         broadcastLogLevel("error", "Pre-infusion on_time too long (max 10000ms)");
-    } else if (pauseTimeMs > 30000) {
+    } else if (!config_limit_check(CFG_LIMIT_PREINFUSION_PAUSE, pauseTimeMs)) {
         broadcastLogLevel("error", "Pre-infusion pause_time too long (max 30000ms)");
     } else {
         // Build payload for Pico: [config_type, enabled, on_time_ms(2), pause_time_ms(2)]
@@ -821,18 +1013,20 @@ void BrewWebServer::handlePreinfusionCommand(JsonDocument& doc, const String& cm
     }
 }
 
-void BrewWebServer::handlePowerCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handlePowerCommand(JsonDocument& doc, std::string_view cmd) {
     // Pico is the source of truth, but we persist on ESP32 as backup/cache
     uint16_t voltage = doc["voltage"] | 230;
     uint8_t maxCurrent = doc["maxCurrent"] | 15;
     
-    // Validate inputs
-    if (voltage < 100 || voltage > 240) {
-        broadcastLogLevel("error", "Invalid voltage: %dV (range: 100-240V)", voltage);
+    // Validate against the shared constraint table - previously these
+    // bounds were hand-duplicated here (and had drifted tighter than what
+    // the Pico accepts), now both sides read the same limits
+    if (!config_limit_check(CFG_LIMIT_VOLTAGE, voltage)) {
+        broadcastLogLevel("error", "Invalid voltage: %dV (range: 100-250V)", voltage);
         return;
     }
-    if (maxCurrent < 1 || maxCurrent > 30) {
-        broadcastLogLevel("error", "Invalid max current: %dA (range: 1-30A)", maxCurrent);
+    if (!config_limit_check(CFG_LIMIT_CURRENT, maxCurrent)) {
+        broadcastLogLevel("error", "Invalid max current: %dA (range: 1-50A)", maxCurrent);
         return;
     }
     
@@ -856,7 +1050,7 @@ void BrewWebServer::handlePowerCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handlePowerMeterCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handlePowerMeterCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "configure_power_meter") {
         String source = doc["source"] | "none";
         
@@ -998,7 +1192,7 @@ void BrewWebServer::handlePowerMeterCommand(JsonDocument& doc, const String& cmd
     }
 }
 
-void BrewWebServer::handleWiFiCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleWiFiCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "wifi_forget") {
         _wifiManager.clearCredentials();
         broadcastLogLevel("warn", "WiFi credentials cleared. Device will restart.");
@@ -1031,9 +1225,10 @@ void BrewWebServer::handleWiFiCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleSystemCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleSystemCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "restart") {
         broadcastLogLevel("warn", "Device restarting...");
+        State.flushNow();  // Commit any staged settings before reboot
         delay(500);
         ESP.restart();
     }
@@ -1046,7 +1241,7 @@ void BrewWebServer::handleSystemCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleOtaCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleOtaCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "check_update") {
         // Check for OTA updates from GitHub releases
         checkForUpdates();
@@ -1084,7 +1279,7 @@ void BrewWebServer::handleOtaCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleMachineInfoCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleMachineInfoCommand(JsonDocument& doc, std::string_view cmd) {
     auto& machineInfo = State.settings().machineInfo;
     auto& networkSettings = State.settings().network;
     
@@ -1178,7 +1373,7 @@ void BrewWebServer::handleMachineInfoCommand(JsonDocument& doc, const String& cm
     broadcastLog("Device info updated: %s", machineInfo.deviceName);
 }
 
-void BrewWebServer::handlePreferencesCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handlePreferencesCommand(JsonDocument& doc, std::string_view cmd) {
     auto& prefs = State.settings().preferences;
     
     if (!doc["firstDayOfWeek"].isNull()) {
@@ -1211,7 +1406,7 @@ void BrewWebServer::handlePreferencesCommand(JsonDocument& doc, const String& cm
     broadcastLogLevel("info", "User preferences updated");
 }
 
-void BrewWebServer::handleTimeCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleTimeCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "set_time_config") {
         auto& timeSettings = State.settings().time;
         
@@ -1272,7 +1467,7 @@ void BrewWebServer::handleTimeCommand(JsonDocument& doc, const String& cmd) {
     }
 }
 
-void BrewWebServer::handleMaintenanceCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleMaintenanceCommand(JsonDocument& doc, std::string_view cmd) {
     String type = doc["type"] | "";
     if (!type.isEmpty()) {
         State.recordMaintenance(type.c_str());
@@ -1283,7 +1478,7 @@ void BrewWebServer::handleMaintenanceCommand(JsonDocument& doc, const String& cm
     }
 }
 
-void BrewWebServer::handleDiagnosticsCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleDiagnosticsCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "run_diagnostics") {
         broadcastLogLevel("info", "Running hardware diagnostics...");
         
@@ -1354,7 +1549,7 @@ void BrewWebServer::handleDiagnosticsCommand(JsonDocument& doc, const String& cm
     }
 }
 
-void BrewWebServer::handleLogCommand(JsonDocument& doc, const String& cmd) {
+void BrewWebServer::handleLogCommand(JsonDocument& doc, std::string_view cmd) {
     if (cmd == "set_log_config") {
         // Enable/disable log features
         if (!doc["enabled"].isNull()) {
@@ -1381,6 +1576,14 @@ void BrewWebServer::handleLogCommand(JsonDocument& doc, const String& cmd) {
             bool enabled = doc["debugEnabled"].as<bool>();
             setLogLevel(enabled ? BREWOS_LOG_DEBUG : BREWOS_LOG_INFO);
             State.settings().system.debugLogsEnabled = enabled;
+
+            // Re-push the forward level so the Pico's source-side severity
+            // filter tracks the new setting
+            if (g_logManager && g_logManager->isPicoLogForwardingEnabled()) {
+                g_logManager->setPicoLogForwarding(true, [this](uint8_t* payload, size_t len) {
+                    return _picoUart.sendCommand(MSG_CMD_LOG_CONFIG, payload, len);
+                });
+            }
         }
         
         State.saveSystemSettings();
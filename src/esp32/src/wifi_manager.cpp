@@ -1,8 +1,14 @@
 #include "wifi_manager.h"
 #include "config.h"
+#include "runtime_state.h"  // Brewing edge for shot-window PHY tuning
 #include "lwip/dns.h"  // For direct DNS server configuration
 #include "esp_wifi.h"  // For esp_wifi_set_ps()
 
+// esp_wifi_config_80211_tx_rate() is set-only; the disable flag lives on the
+// internal call it wraps. The header (esp_private/wifi.h) isn't part of the
+// Arduino surface, so declare the symbol directly.
+extern "C" esp_err_t esp_wifi_internal_set_fix_rate(wifi_interface_t ifx, bool en, wifi_phy_rate_t rate);
+
 // Note: SNTP status API is not available in Arduino ESP32 framework
 // Using time-based detection instead
 
@@ -59,9 +65,10 @@ WiFiManager::WiFiManager()
 void WiFiManager::begin() {
     LOG_I("WiFi Manager starting...");
     
-    // Load stored credentials and static IP config
+    // Load stored credentials, static IP config and last good AP
     loadCredentials();
     loadStaticIPConfig();
+    loadLastAP();
     
     // Start background task on Core 0
     if (_taskHandle == nullptr) {
@@ -149,23 +156,37 @@ void WiFiManager::taskLoop() {
                         dns_setserver(1, &dns2);
                         LOG_I("DNS set to Cloudflare: 1.1.1.1, 1.0.0.1");
                         
+                        noteAssociated();
                         safeCallback(_onConnected);
-                    } 
-                    else if (millis() - _connectStartTime > WIFI_CONNECT_TIMEOUT_MS) {
+                    }
+                    else if (millis() - _connectStartTime >
+                             (_fastRejoinPending ? WIFI_FAST_REJOIN_TIMEOUT_MS
+                                                 : WIFI_CONNECT_TIMEOUT_MS)) {
+                        if (_fastRejoinPending) {
+                            // The persisted-BSSID fast path missed (AP moved
+                            // channel, powered off, ...) - fall back to the
+                            // full scan path instead of dropping to AP mode
+                            LOG_W("Fast rejoin timed out, falling back to scan connect");
+                            _fastRejoinPending = false;
+                            clearLastAP();
+                            xSemaphoreGive(_mutex);
+                            doConnectToWiFi();
+                            continue;  // Skip the semaphore give below
+                        }
                         LOG_W("WiFi connection timeout, starting AP mode");
                         xSemaphoreGive(_mutex);
                         doStartAP();
                         continue;  // Skip the semaphore give below
                     }
                     break;
-                    
+
                 case WiFiManagerMode::STA_MODE:
                     // Check if still connected
                     if (WiFi.status() != WL_CONNECTED) {
                         LOG_W("WiFi disconnected from %s", _storedSSID);
                         _mode = WiFiManagerMode::DISCONNECTED;
                         safeCallback(_onDisconnected);
-                        
+
                         // Try to reconnect after interval
                         if (millis() - _lastConnectAttempt > WIFI_RECONNECT_INTERVAL) {
                             LOG_I("Attempting WiFi reconnection to %s...", _storedSSID);
@@ -173,6 +194,17 @@ void WiFiManager::taskLoop() {
                             doConnectToWiFi();
                             continue;  // Skip the semaphore give below
                         }
+                    } else {
+                        // Healthy association: track the signal trend and
+                        // roam proactively before a degrading AP rides down
+                        // to the association timeout
+                        sampleRoamSignal();
+                        if (_roamScanActive) {
+                            evaluateRoamScan();
+                        }
+                        // Shot-window PHY tuning and the link health ring
+                        updateShotPhy();
+                        sampleLinkHealth();
                     }
                     break;
                     
@@ -221,6 +253,7 @@ void WiFiManager::processCommand(WiFiCommand cmd) {
                 _prefs.putString("password", _storedPassword);
                 _prefs.end();
                 LOG_I("Credentials saved for: %s", _storedSSID);
+                clearLastAP();  // Different network - stale BSSID would misdirect fast rejoin
                 xSemaphoreGive(_mutex);
             }
             break;
@@ -231,6 +264,9 @@ void WiFiManager::processCommand(WiFiCommand cmd) {
                 _prefs.end();
                 _storedSSID[0] = '\0';
                 _storedPassword[0] = '\0';
+                // _prefs.clear() above wiped the persisted AP too
+                _haveLastAP = false;
+                _lastChannel = 0;
                 LOG_I("Credentials cleared");
                 xSemaphoreGive(_mutex);
             }
@@ -335,6 +371,12 @@ void WiFiManager::doConnectToWiFi() {
     // Moderate TX power - EMI now controlled via GPIO drive strength
     // 17dBm provides good range without excessive power draw
     WiFi.setTxPower(WIFI_POWER_17dBm);
+
+    // A reconnect renegotiates from defaults - clear any shot-window fixed
+    // rate left over from a drop mid-shot
+    esp_wifi_internal_set_fix_rate(WIFI_IF_STA, false, WIFI_SHOT_FIX_RATE);
+    _shotPhyActive = false;
+    _brewEndTime = 0;
     
     // Disable power save for responsive network
     WiFi.setSleep(false);
@@ -349,6 +391,26 @@ void WiFiManager::doConnectToWiFi() {
         }
     }
     
+    // Fast rejoin: skip the blocking scan and go straight back to the last
+    // good AP on its known channel. A roam/outage rejoin completes in well
+    // under a second instead of scan (2-3s) + association. Falls back to the
+    // scan path via the STA_CONNECTING timeout if the AP is gone.
+    if (_haveLastAP) {
+        char bssidStr[18];
+        snprintf(bssidStr, sizeof(bssidStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 _lastBSSID[0], _lastBSSID[1], _lastBSSID[2],
+                 _lastBSSID[3], _lastBSSID[4], _lastBSSID[5]);
+        LOG_I("Fast rejoin to %s (BSSID %s, channel %d)", _storedSSID, bssidStr, _lastChannel);
+        WiFi.begin(_storedSSID, _storedPassword, _lastChannel, _lastBSSID);
+        _fastRejoinPending = true;
+        _mode = WiFiManagerMode::STA_CONNECTING;
+        _connectStartTime = millis();
+        _lastConnectAttempt = millis();
+        xSemaphoreGive(_mutex);
+        return;
+    }
+    _fastRejoinPending = false;
+
     // Scan for APs with the same SSID and connect to the strongest one
     // This ensures we connect to the best AP when multiple APs broadcast the same SSID
     LOG_I("Scanning for APs with SSID: %s", _storedSSID);
@@ -468,6 +530,294 @@ void WiFiManager::doStartAP() {
     safeCallback(_onAPStarted);
 }
 
+// =============================================================================
+// Shot-Window PHY Tuning + Link Health
+//
+// The frames in flight during a shot are small status/weight updates that
+// need bounded latency, not throughput - and one bad probe is all rate
+// control needs to downshift them onto long-preamble DSSS (1-2 Mbps, ~10x
+// the airtime and a much longer retry tail). While brewing, the data rate
+// is pinned at 24M OFDM with full TX power as SNR headroom; defaults come
+// back after a short hold past brew end, mirroring the task governor's
+// brewing-edge/hold-down shape. Aggregation needs no bounding here: the
+// association is already forced to legacy 802.11b/g (see doConnectToWiFi),
+// which has no A-MPDU.
+//
+// Alongside, a short ring of link samples pairs RSSI with the worst WS
+// broadcast fanout time per window. Fanout time rising with RSSI falling
+// is "WiFi bad"; rising on steady RSSI points back at the firmware.
+// =============================================================================
+
+void WiFiManager::updateShotPhy() {
+    bool brewing = runtimeState().get().is_brewing;
+    unsigned long now = millis();
+
+    if (brewing) {
+        _brewEndTime = 0;
+        if (!_shotPhyActive) {
+            applyShotPhy(true);
+        }
+        return;
+    }
+
+    if (_shotPhyActive) {
+        if (_brewEndTime == 0) {
+            _brewEndTime = now;  // Falling edge - start the hold-down
+        } else if (now - _brewEndTime >= WIFI_SHOT_HOLD_MS) {
+            applyShotPhy(false);
+        }
+    }
+}
+
+void WiFiManager::applyShotPhy(bool enable) {
+    if (enable) {
+        esp_err_t err = esp_wifi_config_80211_tx_rate(WIFI_IF_STA, WIFI_SHOT_FIX_RATE);
+        if (err != ESP_OK) {
+            // Leave defaults - never trade association stability for latency
+            LOG_W("Shot PHY tuning failed to pin rate: %d", err);
+            return;
+        }
+        WiFi.setTxPower(WIFI_POWER_19_5dBm);
+        _shotPhyActive = true;
+        _shotPhyApplies++;
+        LOG_I("Shot PHY tuning on (fixed 24M OFDM, 19.5dBm)");
+    } else {
+        esp_wifi_internal_set_fix_rate(WIFI_IF_STA, false, WIFI_SHOT_FIX_RATE);
+        WiFi.setTxPower(WIFI_POWER_17dBm);
+        _shotPhyActive = false;
+        _brewEndTime = 0;
+        LOG_I("Shot PHY tuning off (auto rate, 17dBm)");
+    }
+}
+
+void WiFiManager::sampleLinkHealth() {
+    unsigned long now = millis();
+    if (now - _lastLinkSample < WIFI_LINK_SAMPLE_INTERVAL_MS) {
+        return;
+    }
+    _lastLinkSample = now;
+
+    LinkSample& s = _linkSamples[_linkSampleIndex];
+    s.rssi = (int8_t)WiFi.RSSI();
+    s.shotPhy = _shotPhyActive;
+
+    // Consume-and-reset the window's worst fanout time
+    uint32_t worst = _broadcastMaxMs;
+    _broadcastMaxMs = 0;
+    s.maxBroadcastMs = (worst > 0xFFFF) ? 0xFFFF : (uint16_t)worst;
+
+    _linkSampleIndex = (_linkSampleIndex + 1) % WIFI_LINK_HISTORY_LEN;
+    if (_linkSampleCount < WIFI_LINK_HISTORY_LEN) {
+        _linkSampleCount++;
+    }
+}
+
+void WiFiManager::noteBroadcastLatency(uint32_t ms) {
+    // Relaxed max cell: written from the broadcast path, consumed by the
+    // WiFi task's sampler. A lost update under a race costs one sample,
+    // not correctness.
+    if (ms > _broadcastMaxMs) {
+        _broadcastMaxMs = ms;
+    }
+}
+
+uint8_t WiFiManager::getLinkHistory(LinkSample* out, uint8_t maxSamples) {
+    if (!out || maxSamples == 0) {
+        return 0;
+    }
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return 0;
+    }
+
+    uint8_t n = (_linkSampleCount < maxSamples) ? _linkSampleCount : maxSamples;
+    // Once the ring is full the write index is the oldest sample
+    uint8_t start = (_linkSampleCount < WIFI_LINK_HISTORY_LEN) ? 0 : _linkSampleIndex;
+    for (uint8_t i = 0; i < n; i++) {
+        out[i] = _linkSamples[(start + i) % WIFI_LINK_HISTORY_LEN];
+    }
+
+    xSemaphoreGive(_mutex);
+    return n;
+}
+
+// =============================================================================
+// WiFi Roaming Fast-Path
+//
+// Café-edge machines degrade slowly: the association limps along at the edge
+// of range until it finally times out, freezing cloud and WebSocket traffic
+// for 10+ seconds before the reconnect logic even starts. Instead we sample
+// the RSSI trend while associated, run an async background scan once the
+// signal is both weak and falling, and reassociate to a meaningfully better
+// same-SSID AP before the old one collapses. The last good BSSID/channel is
+// persisted so a rejoin skips the blocking scan entirely.
+//
+// The framework doesn't expose 802.11k neighbor reports or 11v BTM, so the
+// candidate list comes from our own scan - same decision, different source.
+// =============================================================================
+
+void WiFiManager::sampleRoamSignal() {
+    unsigned long now = millis();
+    if (now - _lastRssiSample < WIFI_ROAM_SAMPLE_INTERVAL_MS) {
+        return;
+    }
+    _lastRssiSample = now;
+
+    _rssiSamples[_rssiSampleIndex] = (int8_t)WiFi.RSSI();
+    _rssiSampleIndex = (_rssiSampleIndex + 1) % WIFI_ROAM_TREND_WINDOW;
+    if (_rssiSampleCount < WIFI_ROAM_TREND_WINDOW) {
+        _rssiSampleCount++;
+        return;  // Need a full window before judging the trend
+    }
+
+    // Average of the older half vs the newer half of the ring: weak AND
+    // falling triggers a candidate scan; weak-but-stable does not (no point
+    // roaming off the only AP in range)
+    int olderSum = 0;
+    int newerSum = 0;
+    const int half = WIFI_ROAM_TREND_WINDOW / 2;
+    for (int i = 0; i < WIFI_ROAM_TREND_WINDOW; i++) {
+        // _rssiSampleIndex is the oldest sample now that the ring is full
+        int8_t s = _rssiSamples[(_rssiSampleIndex + i) % WIFI_ROAM_TREND_WINDOW];
+        if (i < half) {
+            olderSum += s;
+        } else {
+            newerSum += s;
+        }
+    }
+    int olderAvg = olderSum / half;
+    int newerAvg = newerSum / half;
+
+    if (newerAvg >= WIFI_ROAM_RSSI_FLOOR || newerAvg >= olderAvg) {
+        return;  // Healthy or not degrading
+    }
+    if (_roamScanActive ||
+        now - _lastRoamScan < WIFI_ROAM_SCAN_INTERVAL_MS ||
+        now - _lastRoam < WIFI_ROAM_HOLDOFF_MS) {
+        return;
+    }
+
+    LOG_I("Signal degrading (%d -> %d dBm avg), scanning for roam candidates",
+          olderAvg, newerAvg);
+    WiFi.scanNetworks(true, true);  // async=true - brief off-channel only
+    _roamScanActive = true;
+    _lastRoamScan = now;
+}
+
+void WiFiManager::evaluateRoamScan() {
+    int n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING) {
+        return;
+    }
+    _roamScanActive = false;
+    if (n <= 0) {
+        return;  // Failed or empty scan
+    }
+
+    const uint8_t* currentBSSID = WiFi.BSSID();
+    int currentRSSI = WiFi.RSSI();
+    int bestRSSI = -200;
+    int bestIndex = -1;
+
+    for (int i = 0; i < n; i++) {
+        if (WiFi.SSID(i) != _storedSSID) {
+            continue;
+        }
+        uint8_t* bssid = WiFi.BSSID(i);
+        if (currentBSSID && memcmp(bssid, currentBSSID, 6) == 0) {
+            continue;  // That's the AP we're trying to leave
+        }
+        if (WiFi.RSSI(i) > bestRSSI) {
+            bestRSSI = WiFi.RSSI(i);
+            bestIndex = i;
+        }
+    }
+
+    // Roam only for a meaningful improvement - ping-ponging between two
+    // borderline APs is worse than staying put
+    if (bestIndex < 0 || bestRSSI < currentRSSI + WIFI_ROAM_MIN_IMPROVEMENT_DB) {
+        WiFi.scanDelete();
+        return;
+    }
+
+    uint8_t targetBSSID[6];
+    memcpy(targetBSSID, WiFi.BSSID(bestIndex), 6);
+    uint8_t targetChannel = (uint8_t)WiFi.channel(bestIndex);
+    LOG_I("Proactive roam: %d dBm -> %d dBm (BSSID %s, channel %d)",
+          currentRSSI, bestRSSI, WiFi.BSSIDstr(bestIndex).c_str(), targetChannel);
+    WiFi.scanDelete();
+
+    // Reassociate to the target directly on its known channel. This drops
+    // the current association for ~1s - far better than riding the old AP
+    // down to the 15s timeout mid-shot
+    WiFi.begin(_storedSSID, _storedPassword, targetChannel, targetBSSID);
+    _mode = WiFiManagerMode::STA_CONNECTING;
+    _connectStartTime = millis();
+    _lastConnectAttempt = millis();
+    _lastRoam = millis();
+    // A roam that misses is handled like a missed fast rejoin: fall back to
+    // the full scan connect (which will find the old AP again) - never to
+    // AP mode, since we just left a working association by choice
+    _fastRejoinPending = true;
+}
+
+void WiFiManager::noteAssociated() {
+    // Reset the trend window so pre-roam samples don't immediately retrigger
+    _rssiSampleCount = 0;
+    _rssiSampleIndex = 0;
+    _lastRssiSample = millis();
+    _roamScanActive = false;
+    _fastRejoinPending = false;
+
+    // Persist this AP for sub-second rejoin after the next drop/reboot
+    const uint8_t* bssid = WiFi.BSSID();
+    uint8_t channel = (uint8_t)WiFi.channel();
+    if (bssid && channel > 0) {
+        bool changed = !_haveLastAP ||
+                       channel != _lastChannel ||
+                       memcmp(bssid, _lastBSSID, 6) != 0;
+        memcpy(_lastBSSID, bssid, 6);
+        _lastChannel = channel;
+        _haveLastAP = true;
+        if (changed) {
+            saveLastAP();  // Only hit NVS when the AP actually moved
+        }
+    }
+}
+
+void WiFiManager::saveLastAP() {
+    _prefs.begin("wifi", false);
+    _prefs.putBytes("ap_bssid", _lastBSSID, 6);
+    _prefs.putUChar("ap_chan", _lastChannel);
+    _prefs.putString("ap_ssid", _storedSSID);  // Invalidates on SSID change
+    _prefs.end();
+}
+
+void WiFiManager::loadLastAP() {
+    _haveLastAP = false;
+    if (!_prefs.begin("wifi", true)) {
+        return;
+    }
+    String apSSID = _prefs.getString("ap_ssid", "");
+    if (apSSID == _storedSSID && apSSID.length() > 0 &&
+        _prefs.getBytesLength("ap_bssid") == 6) {
+        _prefs.getBytes("ap_bssid", _lastBSSID, 6);
+        _lastChannel = _prefs.getUChar("ap_chan", 0);
+        _haveLastAP = (_lastChannel > 0);
+    }
+    _prefs.end();
+}
+
+void WiFiManager::clearLastAP() {
+    _haveLastAP = false;
+    _lastChannel = 0;
+    memset(_lastBSSID, 0, sizeof(_lastBSSID));
+    _prefs.begin("wifi", false);
+    _prefs.remove("ap_bssid");
+    _prefs.remove("ap_chan");
+    _prefs.remove("ap_ssid");
+    _prefs.end();
+}
+
 WiFiStatus WiFiManager::getStatus() {
     WiFiStatus status;
     status.mode = _mode;
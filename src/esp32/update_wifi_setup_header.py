@@ -4,12 +4,14 @@ Update wifi_setup_page.h from wifi_setup_page_dev.html
 This keeps the HTML file as the single source of truth.
 """
 
+import gzip
 import os
 import re
 from pathlib import Path
 
 SCRIPT_DIR = Path(__file__).parent
 HEADER_FILE = SCRIPT_DIR / "include" / "wifi_setup_page.h"
+GZ_HEADER_FILE = SCRIPT_DIR / "include" / "wifi_setup_page_gz.h"
 HTML_FILE = SCRIPT_DIR / "wifi_setup_page_dev.html"
 
 if not HTML_FILE.exists():
@@ -59,5 +61,49 @@ with open(HEADER_FILE, 'w', encoding='utf-8') as f:
     f.write(header_content)
 
 print(f"✓ Updated {HEADER_FILE} from {HTML_FILE}")
+
+# Also emit a pre-compressed copy. The /setup route serves this straight from
+# flash with Content-Encoding: gzip (no RAM-side copy, ~75% smaller transfer),
+# which matters on a congested AP channel during first-time setup.
+# The literal must match what goes into the rawliteral above, including the
+# surrounding newlines the header template adds around the HTML.
+literal_content = '\n' + html_content + '\n'
+# mtime=0 keeps the output deterministic so the header only changes when the HTML does
+gz_data = gzip.compress(literal_content.encode('utf-8'), compresslevel=9, mtime=0)
+
+gz_lines = []
+for i in range(0, len(gz_data), 16):
+    gz_lines.append('    ' + ', '.join(f'0x{b:02x}' for b in gz_data[i:i + 16]) + ',')
+
+gz_header_content = '''#ifndef WIFI_SETUP_PAGE_GZ_H
+#define WIFI_SETUP_PAGE_GZ_H
+
+#include <Arduino.h>
+
+/**
+ * WiFi Setup Page HTML - gzip pre-compressed at build time
+ *
+ * Same content as WIFI_SETUP_PAGE_HTML (wifi_setup_page.h), compressed with
+ * gzip -9 so /setup can stream it straight from flash with
+ * Content-Encoding: gzip. Clients that don't accept gzip fall back to the
+ * uncompressed PROGMEM copy.
+ *
+ * GENERATED FILE - do not edit. Regenerate with:
+ *   python3 update_wifi_setup_header.py
+ */
+const uint8_t WIFI_SETUP_PAGE_GZ[] PROGMEM = {
+''' + '\n'.join(gz_lines) + '''
+};
+
+const size_t WIFI_SETUP_PAGE_GZ_LEN = sizeof(WIFI_SETUP_PAGE_GZ);
+
+#endif // WIFI_SETUP_PAGE_GZ_H
+'''
+
+print(f"Writing {GZ_HEADER_FILE}...")
+with open(GZ_HEADER_FILE, 'w', encoding='utf-8') as f:
+    f.write(gz_header_content)
+
+print(f"✓ Wrote {GZ_HEADER_FILE} ({len(gz_data)} bytes compressed from {len(literal_content)})")
 print("\nNote: Verify that mock API code was properly removed from the header file")
 
@@ -0,0 +1,89 @@
+/**
+ * Pico Firmware - Shot-Start Sensor Burst Capture
+ *
+ * The pressure transient in the first seconds of a shot carries the pump
+ * and solenoid fingerprint, but the median/moving-average chain in
+ * sensors.c (correctly) filters it away before anything leaves the Pico.
+ * This module taps the raw DMA-captured ADC samples for the pressure
+ * channel before any filtering: armed on brew start, it records at the
+ * full per-channel ADC rate into a RAM ring for a few seconds, then
+ * drains the buffer to the ESP32 in MSG_SENSOR_BURST frames after the
+ * shot ends - transient fingerprints for maintenance trending with zero
+ * steady-state cost (one compare per sensor read while idle).
+ *
+ * Core split: start/stop are called by the state machine on Core 0 and
+ * only flip a volatile state flag; push (from sensors_read) and the frame
+ * drain both run on Core 1, so the buffer itself is single-core.
+ */
+
+#ifndef BURST_CAPTURE_H
+#define BURST_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+// Capture window from brew start. 3s covers pre-infusion ramp plus the
+// pump's initial pressure overshoot; at 200Hz that is 600 samples (1.2KB).
+#define BURST_CAPTURE_SECONDS       3
+
+// Pacing for the post-shot drain - one frame per interval keeps the burst
+// traffic well below the brewing status rate on the shared UART
+#define BURST_CAPTURE_SEND_MS       20
+
+// =============================================================================
+// Functions
+// =============================================================================
+
+/**
+ * Initialize burst capture
+ *
+ * Called from sensors_init() once the ADC channels are resolved. The module
+ * stays dormant when the PCB has no pressure transducer (adc_channel = -1).
+ *
+ * @param adc_channel ADC channel to capture (-1 = none)
+ * @param sample_rate_hz Per-channel DMA sample rate (sizes the buffer window)
+ */
+void burst_capture_init(int8_t adc_channel, uint16_t sample_rate_hz);
+
+/**
+ * Arm capture (Core 0, state machine brew-start transition)
+ *
+ * Discards any undrained previous capture - a new shot always wins.
+ */
+void burst_capture_start(void);
+
+/**
+ * Stop capturing and begin draining (Core 0, brew-end transition)
+ *
+ * No-op unless a capture is in progress.
+ */
+void burst_capture_stop(void);
+
+/**
+ * Feed raw ADC samples (Core 1, called from the sensors.c read path)
+ *
+ * Samples for channels other than the configured one are ignored, so the
+ * caller can hook this once in its generic ADC read helper.
+ */
+void burst_capture_push(uint8_t adc_channel, const uint16_t* samples, uint8_t count);
+
+/**
+ * Drain pending frames (Core 1, call from the communication loop)
+ *
+ * Sends at most one MSG_SENSOR_BURST frame per BURST_CAPTURE_SEND_MS.
+ */
+void burst_capture_task(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BURST_CAPTURE_H
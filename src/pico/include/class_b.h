@@ -40,6 +40,7 @@ typedef enum {
     CLASS_B_FAIL_CLOCK,         // Clock frequency out of tolerance
     CLASS_B_FAIL_STACK,         // Stack overflow detected
     CLASS_B_FAIL_PC,            // Program counter test failed
+    CLASS_B_FAIL_DEADLINE,      // Deferred test missed completion deadline
     CLASS_B_NOT_INITIALIZED     // Class B not initialized
 } class_b_result_t;
 
@@ -84,6 +85,17 @@ typedef struct {
 #define CLASS_B_IO_TEST_INTERVAL        10      // Every 1 second
 #define CLASS_B_CLOCK_TEST_INTERVAL     100     // Every 10 seconds
 
+// Time budget per idle-gap slice (see class_b_run_slice)
+#define CLASS_B_SLICE_BUDGET_US         200
+
+// Completion deadlines for deferred (sliced) tests. The 10Hz scheduler marks
+// tests pending on the intervals above; idle-gap slices execute them. If a
+// test class has not completed within its deadline, the slice scheduler is
+// starved and safety coverage has lapsed - reported as CLASS_B_FAIL_DEADLINE.
+#define CLASS_B_FAST_TEST_DEADLINE_MS   5000    // RAM/CPU/IO (nominal 1s cadence)
+#define CLASS_B_CLOCK_TEST_DEADLINE_MS  30000   // Clock (nominal 10s cadence)
+#define CLASS_B_FLASH_TEST_DEADLINE_MS  180000  // Full flash pass (nominal 60s cadence)
+
 // Stack canary configuration
 #define CLASS_B_STACK_CANARY_VALUE      0xDEADBEEF
 
@@ -123,14 +135,28 @@ class_b_result_t class_b_startup_test(void);
 
 /**
  * Run periodic Class B tests
- * 
- * Call this from the main control loop. Tests are staggered across
- * multiple calls to minimize impact on real-time performance.
- * 
+ *
+ * Call this from the main control loop. Only the stack canary check runs
+ * inline; the remaining tests are marked pending on their staggered
+ * intervals and executed by class_b_run_slice() in idle gaps. Also acts
+ * as the completion-deadline watchdog: if a deferred test has not
+ * completed within its deadline, returns CLASS_B_FAIL_DEADLINE.
+ *
  * @return CLASS_B_PASS if tests pass, error code on failure
  */
 class_b_result_t class_b_periodic_test(void);
 
+/**
+ * Run a time-budgeted slice of deferred Class B tests
+ *
+ * Call from main-loop idle gaps (outside the control tick). Executes at
+ * most one fast test plus flash CRC chunks, bounded by
+ * CLASS_B_SLICE_BUDGET_US, so it cannot delay the next control tick.
+ *
+ * @return CLASS_B_PASS if executed work passed, error code on failure
+ */
+class_b_result_t class_b_run_slice(void);
+
 // =============================================================================
 // Individual Tests
 // =============================================================================
@@ -9,10 +9,16 @@
  * Cleaning Process:
  * 1. User inserts blind filter with cleaning tablet
  * 2. User activates cleaning mode (via ESP32 or brew lever)
- * 3. Pump runs for ~10 seconds (backflushing)
- * 4. User can stop manually or let it auto-stop
- * 5. Repeat multiple times as needed
- * 6. Rinse with clean water
+ * 3. Backflush program runs automatically: pump pressurizes against the
+ *    blind filter for ~10s, releases for ~10s, repeated for
+ *    CLEANING_BACKFLUSH_CYCLES cycles
+ * 4. User can stop at any point; otherwise the program completes itself
+ * 5. Rinse with clean water
+ *
+ * The program is driven as deadline-stepped phases from cleaning_update()
+ * (called every Core 0 loop pass) - no blocking waits, so control and
+ * safety keep running at full rate mid-cleaning and valve actuations land
+ * on their deadlines with loop-pass precision.
  */
 
 #ifndef CLEANING_H
@@ -29,7 +35,9 @@
 #define CLEANING_MIN_THRESHOLD        10      // Minimum threshold
 #define CLEANING_MAX_THRESHOLD        1000    // Maximum threshold
 #define CLEANING_CYCLE_MIN_TIME_MS    15000   // Minimum brew time to count as cycle (15s)
-#define CLEANING_CYCLE_DURATION_MS    10000   // Cleaning cycle pump duration (10s)
+#define CLEANING_CYCLE_DURATION_MS    10000   // Pressure phase: pump against blind filter (10s)
+#define CLEANING_PAUSE_DURATION_MS    10000   // Release phase: pump off, puck pressure vents (10s)
+#define CLEANING_BACKFLUSH_CYCLES     5       // Pressure/release cycles per backflush program
 
 // Flash wear reduction: save every N brews instead of every brew
 #define CLEANING_FLASH_SAVE_INTERVAL  10      // Save to flash every 10 brews
@@ -40,8 +48,8 @@
 
 typedef enum {
     CLEANING_IDLE = 0,           // Not in cleaning mode
-    CLEANING_ACTIVE,             // Cleaning cycle active (pump running)
-    CLEANING_PAUSED              // Cleaning cycle paused (between cycles)
+    CLEANING_ACTIVE,             // Pressure phase (pump running against blind filter)
+    CLEANING_PAUSED              // Release phase (pump off, between cycles)
 } cleaning_state_t;
 
 // =============================================================================
@@ -80,10 +80,61 @@
 // At 25Hz PWM (40ms period), 5% duty = 2ms - below this, ZC SSRs may skip cycles
 #define SSR_MIN_DUTY_PERCENT    5.0f
 
+// Default SSR output mode: 1 = burst-fire (duty quantized into mains
+// half-cycles and spread evenly - less thermal ripple), 0 = 25Hz hardware PWM
+// Runtime switchable via control_set_burst_fire()
+#ifndef SSR_BURST_FIRE_DEFAULT
+    #define SSR_BURST_FIRE_DEFAULT 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Predictive Heat-Up
+// -----------------------------------------------------------------------------
+// From a cold start the heater runs at full power and switches off early by a
+// model-predicted margin (rise rate x learned thermal lag) instead of letting
+// PID ride the setpoint up with a wound-up integral. The lag is learned per
+// boiler from the observed post-cutoff coast and persisted across reboots
+// (see heatup_shape_demand in control_common.c).
+#ifndef HEATUP_PREDICTIVE_DEFAULT
+    #define HEATUP_PREDICTIVE_DEFAULT 1  // 1 = predictive heat-up, 0 = plain PID
+#endif
+#define HEATUP_LAG_DEFAULT_S    15.0f   // Conservative lag before first learn (cuts early)
+#define HEATUP_LAG_MIN_S        2.0f    // Plausible learned-lag range - values outside
+#define HEATUP_LAG_MAX_S        60.0f   // are rejected as garbage (see config_persistence)
+
 // PID Derivative filter time constant (seconds)
 // Lower = more responsive but noisier, higher = smoother but slower
 #define PID_DERIVATIVE_FILTER_TAU   0.5f
 
+// -----------------------------------------------------------------------------
+// PID Gain Scheduling
+// -----------------------------------------------------------------------------
+// One gain set cannot serve every operating regime: steady-state tuning is
+// visibly sluggish pulling the boiler back up after a shot, and a recovery
+// tuning oscillates once settled at the setpoint. The configured Kp/Ki/Kd
+// stay the steady-state set; the heat-up and recovery sets are derived from
+// it by fixed multipliers, and the effective gains blend exponentially
+// between sets so a regime switch never steps the output (see
+// pid_schedule_gains in control_common.c).
+#ifndef PID_SCHEDULING_DEFAULT
+    #define PID_SCHEDULING_DEFAULT 1    // 1 = gain scheduling, 0 = single gain set
+#endif
+#define PID_REGIME_HEATUP_ERROR_C    8.0f   // Error beyond this = heat-up regime
+#define PID_REGIME_RECOVER_ENTER_C   1.5f   // Error to enter recovery...
+#define PID_REGIME_RECOVER_EXIT_C    0.5f   // ...and to fall back to steady-state
+#define PID_REGIME_RECOVER_SLOPE_C_S 0.05f  // Falling faster than this enters recovery early
+#define PID_REGIME_BLEND_TAU_S       2.0f   // Exponential blend between gain sets
+// Heat-up set: lean on P, starve I - the approach runs near saturation and an
+// accumulating integral only turns into overshoot at the top
+#define PID_HEATUP_KP_MULT           1.5f
+#define PID_HEATUP_KI_MULT           0.2f
+#define PID_HEATUP_KD_MULT           1.0f
+// Recovery set: stronger P and I to pull the boiler back after the shot's
+// cold slug, lighter D so the rebound slope doesn't fight the recovery
+#define PID_RECOVER_KP_MULT          1.6f
+#define PID_RECOVER_KI_MULT          1.4f
+#define PID_RECOVER_KD_MULT          0.7f
+
 // -----------------------------------------------------------------------------
 // Hardware Simulation Mode
 // -----------------------------------------------------------------------------
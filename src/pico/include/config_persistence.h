@@ -22,6 +22,7 @@
 #include <stddef.h>  // For size_t
 #include "environmental_config.h"
 #include "protocol_defs.h"
+#include "wake_schedule.h"    // wake_schedule_entry_t (persisted wake table)
 // power_meter.h removed (v2.32 - hardware power metering removed)
 
 // =============================================================================
@@ -29,7 +30,9 @@
 // =============================================================================
 
 #define CONFIG_MAGIC          0x45434D43  // "ECMC" - ECM Coffee Machine Config
-#define CONFIG_VERSION        1           // Configuration format version
+#define CONFIG_VERSION        2           // Configuration format version
+                                          // v2: appended wake schedule table (v1
+                                          // records migrate in-place on load)
 
 typedef struct __attribute__((packed)) {
     // Magic number and version for validation
@@ -68,8 +71,13 @@ typedef struct __attribute__((packed)) {
     int16_t eco_brew_temp;                // Reduced brew temp in eco mode (Celsius * 10)
     uint16_t eco_timeout_minutes;         // Minutes of idle before entering eco mode (0=disabled)
     
-    // Power meter settings removed (v2.32 - MQTT only)
-    uint8_t _reserved_power_meter[8];     // Reserved for backwards compatibility
+    // Learned heat-up model (predictive heat-up, see control_common.c)
+    // Occupies the 8 bytes formerly reserved for the removed power meter so
+    // the config layout and version stay unchanged. Stale power-meter bytes
+    // from older saves fail the range check in config_persistence_get_heatup()
+    // and read back as "not yet learned".
+    float heatup_brew_lag_s;              // Brew boiler thermal lag (seconds)
+    float heatup_steam_lag_s;             // Steam boiler thermal lag (seconds)
     
     // Log forwarding to ESP32 (dev mode feature)
     bool log_forwarding_enabled;          // Whether to forward logs to ESP32
@@ -83,7 +91,15 @@ typedef struct __attribute__((packed)) {
     
     // Reserved for future use
     uint8_t reserved[1];
-    
+
+    // Autonomous wake schedule pushed by the ESP32 (v2, see wake_schedule.c).
+    // Appended after the v1 layout so v1 records migrate in-place: their CRC
+    // sits exactly where wake_count now lives, which is how the loader
+    // recognizes and upgrades them (see journal_read_record()).
+    uint8_t wake_count;                   // Valid entries in wake_schedule[]
+    uint8_t wake_reserved[3];
+    wake_schedule_entry_t wake_schedule[WAKE_SCHEDULE_MAX];
+
     // CRC32 for integrity check
     uint32_t crc32;
 } persisted_config_t;
@@ -176,6 +192,36 @@ void config_persistence_get_eco(bool* enabled, int16_t* brew_temp, uint16_t* tim
 
 // Power meter persistence functions removed (v2.32 - MQTT only)
 
+/**
+ * Save learned heat-up model lags to flash (predictive heat-up)
+ * @return true on success, false on failure
+ */
+bool config_persistence_save_heatup(float brew_lag_s, float steam_lag_s);
+
+/**
+ * Get learned heat-up model lags from persisted config
+ * Values outside the plausible range (including stale bytes from configs
+ * written before this field existed) are returned as 0 = not yet learned.
+ */
+void config_persistence_get_heatup(float* brew_lag_s, float* steam_lag_s);
+
+/**
+ * Save the autonomous wake schedule table to flash (see wake_schedule.c)
+ * @param count Number of valid entries (0 clears the table)
+ * @param entries Entry array (may be NULL when count is 0)
+ * @return true on success, false on failure
+ */
+bool config_persistence_save_wake_schedule(uint8_t count,
+                                           const wake_schedule_entry_t* entries);
+
+/**
+ * Get the persisted wake schedule table
+ * @param count Output: number of valid entries (clamped to WAKE_SCHEDULE_MAX)
+ * @param entries Output buffer for WAKE_SCHEDULE_MAX entries
+ */
+void config_persistence_get_wake_schedule(uint8_t* count,
+                                          wake_schedule_entry_t* entries);
+
 /**
  * Save log forwarding setting to flash
  * @return true on success, false on failure
@@ -37,10 +37,19 @@ int16_t control_get_setpoint(uint8_t target);
 void control_set_pid(uint8_t target, float kp, float ki, float kd);
 void control_get_pid(uint8_t target, float* kp, float* ki, float* kd);
 
+// Current gain-scheduling regime (PID_REGIME_* in control_impl.h) - the
+// configured gains are the steady-state set; heat-up and recovery sets are
+// derived and blended in per regime
+uint8_t control_get_pid_regime(uint8_t target);  // target: 0=brew, 1=steam
+
 // Output control
 void control_set_output(uint8_t output, uint8_t value, uint8_t mode);
 void control_get_outputs(control_outputs_t* outputs);
 
+// Per-boiler energy since boot in Wh (SSR duty x element wattage,
+// integrated every control tick - zero-hardware estimate)
+uint32_t control_get_energy_wh(uint8_t target);  // target: 0=brew, 1=steam
+
 // Pump control
 void control_set_pump(uint8_t value);
 
@@ -48,6 +57,10 @@ void control_set_pump(uint8_t value);
 void control_get_config(config_payload_t* config);
 void control_set_config(const config_payload_t* config);
 
+// Burst-fire SSR output mode (half-cycle distribution instead of 25Hz PWM)
+void control_set_burst_fire(bool enable);
+bool control_get_burst_fire(void);
+
 // Heating strategy control
 bool control_set_heating_strategy(uint8_t strategy);  // Returns false if strategy not allowed
 uint8_t control_get_heating_strategy(void);
@@ -32,10 +32,19 @@ typedef enum {
 // PID State (shared structure)
 // =============================================================================
 
+// Operating regimes for gain scheduling (see pid_schedule_gains in
+// control_common.c). Detected from setpoint error and temperature slope.
+typedef enum {
+    PID_REGIME_STEADY = 0,     // Settled at the setpoint
+    PID_REGIME_HEATUP = 1,     // Large error, climbing to the setpoint
+    PID_REGIME_RECOVERY = 2    // Pulling back after a disturbance (shot)
+} pid_regime_t;
+
 // Optimized member order (largest to smallest) to minimize padding:
 // float (4 bytes) -> bool (1 byte, but may be padded to 4 bytes)
 typedef struct {
-    float kp, ki, kd;           // PID gains (4 bytes each)
+    float kp, ki, kd;           // Configured gains (the steady-state set)
+    float eff_kp, eff_ki, eff_kd;  // Blended effective gains used by pid_compute
     float setpoint;             // Current setpoint
     float setpoint_target;      // Target for ramping
     float integral;             // Integral term accumulator
@@ -44,9 +53,10 @@ typedef struct {
     float last_derivative;      // For derivative filtering
     float output;               // PID output value
     float ramp_rate;            // Degrees per second
+    uint8_t regime;             // PID_REGIME_* (current detected regime)
     bool setpoint_ramping;      // Enable setpoint ramping
     bool first_run;             // True on first call (skips derivative to avoid spike)
-    // 2 bytes padding may be added by compiler for alignment
+    // 1 byte padding may be added by compiler for alignment
 } pid_state_t;
 
 // =============================================================================
@@ -71,6 +81,16 @@ void pid_init(pid_state_t* pid, float setpoint);
  */
 float pid_compute(pid_state_t* pid, float process_value, float dt);
 
+/**
+ * Shape PID demand with the predictive heat-up model
+ * During a cold start drives full power with a model-predicted switch-off,
+ * then learns the boiler's thermal lag from the post-cutoff coast.
+ * Call after pid_compute() and before apply_heating_strategy().
+ * @param target 0 = brew boiler, 1 = steam boiler
+ * @return Shaped demand (0-100), or pid_demand unchanged when inactive
+ */
+float heatup_shape_demand(uint8_t target, float temp, float dt, float pid_demand);
+
 /**
  * Apply heating strategy to get final duty cycles (dual boiler only)
  */
@@ -155,6 +155,31 @@ uint8_t diag_test_led(diag_result_t* result);
  */
 uint8_t diag_test_weight_stop_input(diag_result_t* result);
 
+/**
+ * Arm the WEIGHT_STOP edge-capture IRQ (GPIO21)
+ * Installs a raw rising-edge handler that timestamps every assertion of the
+ * stop line. Always-on so the latency test (and any future stop-path audit)
+ * has a capture ready the moment the ESP32 drives the pin.
+ * Call once at boot, after gpio_init_all().
+ */
+void diagnostics_weight_stop_capture_init(void);
+
+/**
+ * Record the arrival time of a WEIGHT_STOP latency loopback command
+ * Called from packet_handlers.c when MSG_CMD_DIAGNOSTICS carries test 0x14,
+ * before the test runs, so the timestamp excludes ACK/dispatch overhead.
+ */
+void diagnostics_note_weight_stop_cmd(void);
+
+/**
+ * Test WEIGHT_STOP path latency (GPIO21 vs loopback command)
+ * The ESP32 raises WEIGHT_STOP and immediately sends this test's command;
+ * raw_value reports how many microseconds the GPIO edge beat the UART
+ * command - the margin the hardware stop path has over the message path.
+ * Note: Requires the ESP32 loopback pulse (sent automatically at boot)
+ */
+uint8_t diag_test_weight_stop_latency(diag_result_t* result);
+
 // =============================================================================
 // Class B Safety Tests (IEC 60730/60335 Annex R)
 // =============================================================================
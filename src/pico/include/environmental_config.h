@@ -125,5 +125,11 @@ void environmental_config_set(const environmental_electrical_t* config);
  */
 void environmental_config_get(environmental_electrical_t* config);
 
+/**
+ * Generation counter, bumped once per environmental_config_set().
+ * Lets diagnostics confirm a runtime recalibration was adopted.
+ */
+uint32_t environmental_config_generation(void);
+
 #endif // ENVIRONMENTAL_CONFIG_H
 
@@ -66,6 +66,14 @@ bool flash_safe_erase(uint32_t offset, size_t size);
  */
 bool flash_safe_program(uint32_t offset, const uint8_t* data, size_t size);
 
+/**
+ * Number of lockout-based flash operations completed since boot (either core).
+ * The control-loop jitter tracker compares this across ticks - a change means
+ * both cores were frozen for a flash erase/program since the prior tick.
+ * Bootloader staging writes are excluded (they don't pause the other core).
+ */
+uint32_t flash_safe_op_count(void);
+
 // =============================================================================
 // Bootloader-specific Flash Functions (NO multicore lockout)
 // =============================================================================
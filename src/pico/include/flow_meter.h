@@ -0,0 +1,90 @@
+/**
+ * Pico Firmware - Flow Meter Pulse Capture
+ *
+ * Interrupt-driven edge capture for a volumetric flow meter on the
+ * input_flow_pulse pin (see pcb_config.h). Each falling edge is
+ * timestamped in the IRQ handler with the microsecond timer, so the
+ * rate estimate has millisecond resolution without any polling cost
+ * in the control loop.
+ *
+ * The module is dormant when the PCB has no flow meter pin configured
+ * (input_flow_pulse = -1) - all getters return zero.
+ */
+
+#ifndef FLOW_METER_H
+#define FLOW_METER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+// Meter calibration: pulses per liter. Default matches the Digmesa FHKSC
+// 3/8" used by most espresso machine OEMs. Override per PCB/machine with
+// a compile definition if a different meter is fitted.
+#ifndef FLOW_METER_PULSES_PER_LITER
+    #define FLOW_METER_PULSES_PER_LITER 1925
+#endif
+
+// Edges closer together than this are electrical noise, not water
+// (2000µs = 500Hz = ~15 L/min at the default calibration, far beyond
+// anything an espresso machine pump can deliver)
+#define FLOW_METER_MIN_PERIOD_US    2000
+
+// No pulse for this long means flow has stopped - rate reads as zero
+#define FLOW_METER_TIMEOUT_MS       2000
+
+// =============================================================================
+// Functions
+// =============================================================================
+
+/**
+ * Initialize flow meter capture
+ *
+ * Attaches the edge interrupt to the PCB's flow pulse pin (the pin itself
+ * is configured as a pulled-up input by gpio_init). Safe to call when the
+ * pin is not configured - the module stays dormant.
+ */
+void flow_meter_init(void);
+
+/**
+ * Check if a flow meter is configured on this PCB
+ */
+bool flow_meter_is_available(void);
+
+/**
+ * Get current flow rate estimate
+ *
+ * Derived from the period between the two most recent pulses; decays
+ * toward zero when pulses stop arriving and reads 0 after
+ * FLOW_METER_TIMEOUT_MS without a pulse.
+ *
+ * @return Flow rate in ml/min (0 if no meter or no flow)
+ */
+uint16_t flow_meter_get_rate_ml_min(void);
+
+/**
+ * Get total pulse count since boot (or last reset)
+ *
+ * Volume in ml = count * 1000 / FLOW_METER_PULSES_PER_LITER.
+ *
+ * @return Number of pulses captured
+ */
+uint32_t flow_meter_get_pulse_count(void);
+
+/**
+ * Reset the pulse counter (e.g. at shot start for per-shot volume)
+ */
+void flow_meter_reset_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLOW_METER_H
@@ -90,12 +90,46 @@ float hw_adc_to_voltage(uint16_t adc_value);
 
 /**
  * Read ADC channel and return voltage directly
- * 
+ *
  * @param channel ADC channel (0-3)
  * @return Voltage in volts, or 0.0 on error
  */
 float hw_read_adc_voltage(uint8_t channel);
 
+/**
+ * Start free-running round-robin ADC capture with DMA
+ *
+ * The ADC cycles through the enabled channels continuously and DMA writes
+ * conversions into an internal ring buffer. hw_read_adc() then returns the
+ * newest captured sample with zero conversion latency, and
+ * hw_adc_read_burst() exposes the recent history for oversampling.
+ * Channels outside the mask fall back to blocking single conversions.
+ *
+ * No-op in simulation mode or if capture is already running.
+ *
+ * @param channel_mask Bitmask of ADC channels to capture (bit 0 = GPIO26)
+ * @param per_channel_hz Target sample rate per channel (Hz)
+ * @return true if capture started, false otherwise
+ */
+bool hw_adc_dma_start(uint32_t channel_mask, uint32_t per_channel_hz);
+
+/**
+ * Check if DMA ADC capture is running
+ *
+ * @return true if hw_adc_dma_start() succeeded, false otherwise
+ */
+bool hw_adc_dma_is_active(void);
+
+/**
+ * Copy the most recent DMA-captured samples for a channel, newest first
+ *
+ * @param channel ADC channel (0-3)
+ * @param samples Output array for raw ADC values
+ * @param max_samples Capacity of the output array
+ * @return Number of samples copied, 0 if the channel is not being captured
+ */
+uint8_t hw_adc_read_burst(uint8_t channel, uint16_t* samples, uint8_t max_samples);
+
 // =============================================================================
 // SPI (Serial Peripheral Interface)
 // =============================================================================
@@ -254,11 +288,47 @@ bool hw_read_gpio(uint8_t pin);
 
 /**
  * Toggle GPIO output
- * 
+ *
  * @param pin GPIO pin number
  */
 void hw_toggle_gpio(uint8_t pin);
 
+// =============================================================================
+// Output Image (batched GPIO commit)
+// =============================================================================
+// Actuation relays (pump, solenoids, water LED) are driven through a shadow
+// image instead of individual gpio_put calls: hw_set_gpio on a claimed pin
+// updates the image, and hw_gpio_out_commit() applies the whole image in one
+// SIO set/clr register pair at a fixed point in the main loop. Related
+// outputs therefore switch in the same clock cycle instead of microseconds
+// apart, and the commit is the single place safety interlock masking is
+// enforced. Pins driven from IRQ timers (LED, buzzer, phase-sync SSRs) are
+// NOT claimed - they keep immediate gpio_put semantics.
+
+/**
+ * Route a configured output pin through the output image
+ * Call after hw_gpio_init_output(); the current pin state seeds the image.
+ *
+ * @param pin GPIO pin number
+ */
+void hw_gpio_out_claim(uint8_t pin);
+
+/**
+ * Apply the pending output image in one atomic SIO set/clr commit
+ * Interlocked pins are forced low regardless of the image. No-op when
+ * nothing changed. Call once per main loop pass (Core 0).
+ */
+void hw_gpio_out_commit(void);
+
+/**
+ * Force the given output pins low, immediately and at every commit
+ * The safety module owns this: the mask stays in force (pending image
+ * writes are masked off) until cleared with 0 on safety reset.
+ *
+ * @param force_low_mask Bitmask of GPIO pins to hold low (0 = release)
+ */
+void hw_gpio_out_interlock(uint32_t force_low_mask);
+
 // =============================================================================
 // Simulation Mode Helpers
 // =============================================================================
@@ -29,6 +29,22 @@ void log_forward_set_enabled(bool enabled);
  */
 bool log_forward_is_enabled(void);
 
+/**
+ * Set the maximum severity forwarded to the ESP32
+ * Messages with level > threshold are dropped before they touch the UART,
+ * so verbose local logging doesn't steal bandwidth from control traffic.
+ * Not persisted - the ESP32 re-pushes its level with every enable command,
+ * and a Pico-only reboot falls back to the INFO default.
+ * @param level Maximum level to forward (LOG_FWD_ERROR..LOG_FWD_DEBUG)
+ */
+void log_forward_set_level(uint8_t level);
+
+/**
+ * Get the maximum severity forwarded to the ESP32
+ * @return Current forward level threshold
+ */
+uint8_t log_forward_get_level(void);
+
 /**
  * Forward a log message to ESP32 (if enabled)
  * @param level Log level (LOG_FWD_ERROR, LOG_FWD_WARN, LOG_FWD_INFO, LOG_FWD_DEBUG)
@@ -44,10 +60,20 @@ void log_forward_send(uint8_t level, const char* message);
  */
 void log_forward_sendf(uint8_t level, const char* format, ...);
 
+/**
+ * Forward a compact catalog log record to ESP32 (if enabled)
+ * No formatting happens here - the ESP32 expands the id via log_catalog.h
+ * @param level Log level
+ * @param id Catalog id (log_catalog_id_t)
+ * @param argc Number of packed arguments (max LOG_COMPACT_MAX_ARGS)
+ * @param args Packed int32 arguments
+ */
+void log_forward_send_compact(uint8_t level, uint16_t id, uint8_t argc, const int32_t* args);
+
 /**
  * Process log forwarding command from ESP32
- * @param payload Command payload (1 byte: enabled flag)
- * @param length Payload length
+ * @param payload Command payload: [enabled flag][forward level (optional)]
+ * @param length Payload length (1 or 2 bytes; older ESP32 builds send 1)
  */
 void log_forward_handle_command(const uint8_t* payload, uint8_t length);
 
@@ -76,6 +76,17 @@ void log_message(log_level_t level, const char* format, ...) __attribute__((form
  */
 void log_message_va(log_level_t level, const char* format, va_list args);
 
+/**
+ * Log a compact catalog record (no runtime formatting)
+ * The call site pays only for queueing (id, argc, int32 args); text is
+ * expanded from the shared log_catalog.h table in logging_process_pending()
+ * and on the ESP32. Use for hot-path logging where vsnprintf cost matters.
+ * @param level Log level
+ * @param id Catalog id (log_catalog_id_t from log_catalog.h)
+ * @param argc Number of int32 arguments (max LOG_COMPACT_MAX_ARGS)
+ */
+void log_message_id(log_level_t level, uint16_t id, uint8_t argc, ...);
+
 // =============================================================================
 // Convenience Macros
 // =============================================================================
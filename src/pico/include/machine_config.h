@@ -172,6 +172,47 @@ typedef struct {
     bool     pressurestat_has_feedback; // True if we can read pressurestat state
 } heat_exchanger_config_t;
 
+// =============================================================================
+// Temperature Estimator Configuration
+// =============================================================================
+
+/**
+ * Per-sensor selection of the second filter stage (see sensor_utils.h).
+ * When enabled, the boiler temperature goes through an alpha-beta estimator
+ * with heater-duty feedforward instead of the moving average - same ADC
+ * data, lower latency, which is what drives brew-temp recovery between
+ * shots. Gains are per machine type because they encode boiler thermal
+ * mass and heater power.
+ */
+typedef struct {
+    bool     enabled;               // Estimator instead of moving average
+    float    alpha;                 // Temperature correction gain (0..1)
+    float    beta;                  // Rate correction gain (0..1)
+    float    heater_gain_c_per_s;   // Heating rate at 100% duty (°C/s)
+} temp_estimator_config_t;
+
+// =============================================================================
+// Group Temperature Model Configuration
+// =============================================================================
+
+/**
+ * First-order conduction model estimating group-head temperature from the
+ * boiler temperature. The group thermocouple (MAX31855) was removed in
+ * v2.24.3, but shot quality still tracks group metal temperature - this
+ * fills sensor_data_t.group_temp with a model estimate instead of leaving
+ * the field dead. The group is treated as a thermal mass fed through a
+ * conduction path from the boiler: it settles toward
+ * gain * boiler + offset_c with time constant tau_s. Coefficients are per
+ * machine type because they encode the path (bolted block vs E61
+ * thermosyphon) and the group's metal mass.
+ */
+typedef struct {
+    bool     enabled;               // Estimate group temp from boiler temp
+    float    gain;                  // Steady-state group/boiler temperature ratio
+    float    offset_c;              // Steady-state offset after gain (°C)
+    float    tau_s;                 // Conduction time constant (s)
+} group_temp_model_t;
+
 // =============================================================================
 // Complete Machine Configuration
 // =============================================================================
@@ -179,13 +220,22 @@ typedef struct {
 typedef struct {
     machine_features_t features;
     machine_electrical_t electrical;
-    
+
+    // Second filter stage selection per temperature sensor
+    struct {
+        temp_estimator_config_t brew;
+        temp_estimator_config_t steam;
+    } estimator;
+
+    // Group-head temperature conduction model (no physical sensor)
+    group_temp_model_t group_model;
+
     // Mode-specific configuration (only one applies based on machine type)
     union {
         single_boiler_config_t single_boiler;
         heat_exchanger_config_t heat_exchanger;
     } mode_config;
-    
+
 } machine_config_t;
 
 // =============================================================================
@@ -220,6 +270,19 @@ static const machine_config_t MACHINE_CONFIG_DUAL_BOILER = {
         .brew_heater_power      = 1500,  // Typical dual boiler brew heater (ECM Synchronika)
         .steam_heater_power     = 1000,  // Typical dual boiler steam heater (ECM Synchronika)
     },
+    .estimator = {
+        // Brew boiler: estimator on - shot recovery time is the target.
+        // heater_gain ~0.5°C/s: 1500W into a ~0.75L brew boiler + metal mass
+        .brew  = { .enabled = true,  .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.5f },
+        // Steam boiler: moving average is fine (no tight recovery requirement)
+        .steam = { .enabled = false, .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.4f },
+    },
+    .group_model = {
+        // Saturated group bolted to the brew boiler: 93°C boiler -> ~85°C
+        // group at equilibrium. tau ~3min for the group casting to follow
+        // a boiler setpoint change.
+        .enabled = true, .gain = 0.92f, .offset_c = 0.0f, .tau_s = 180.0f,
+    },
     .mode_config = { 0 },  // Not used for dual boiler
 };
 
@@ -251,6 +314,17 @@ static const machine_config_t MACHINE_CONFIG_SINGLE_BOILER = {
         .brew_heater_power      = 1200,   // Typical single boiler heater (Rancilio Silvia)
         .steam_heater_power     = 0,      // Same heater used for both (accounted in brew)
     },
+    .estimator = {
+        // Small boiler heats fast - the feedforward pays off most here.
+        // heater_gain ~0.8°C/s: 1200W into a ~0.3L boiler (Rancilio Silvia)
+        .brew  = { .enabled = true,  .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.8f },
+        .steam = { .enabled = false, .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.0f },  // No steam NTC
+    },
+    .group_model = {
+        // Small group screwed directly to the boiler (Rancilio Silvia):
+        // tight coupling, short path, so high gain and a fast tau.
+        .enabled = true, .gain = 0.90f, .offset_c = 0.0f, .tau_s = 90.0f,
+    },
     .mode_config.single_boiler = {
         .brew_setpoint          = 93.0f,
         .steam_setpoint         = 140.0f,
@@ -288,6 +362,17 @@ static const machine_config_t MACHINE_CONFIG_HEAT_EXCHANGER = {
         .brew_heater_power      = 0,      // No separate brew heater (passive HX)
         .steam_heater_power     = 1400,   // Typical HX steam boiler heater (Bezzera BZ10)
     },
+    .estimator = {
+        .brew  = { .enabled = false, .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.0f },  // No brew NTC
+        // Disabled by default: in HX_CONTROL_PRESSURESTAT mode the SSR duty
+        // does not reflect the actual heater drive, so feedforward would lie
+        .steam = { .enabled = false, .alpha = 0.25f, .beta = 0.05f, .heater_gain_c_per_s = 0.3f },
+    },
+    .group_model = {
+        // E61 thermosyphon from the steam boiler (the only NTC): 125°C
+        // boiler -> ~90°C group. The massive E61 casting gives the long tau.
+        .enabled = true, .gain = 0.72f, .offset_c = 0.0f, .tau_s = 240.0f,
+    },
     .mode_config.heat_exchanger = {
         // Control mode - default to temperature PID (modern retrofit)
         .control_mode           = HX_CONTROL_TEMPERATURE,
@@ -325,51 +410,112 @@ static const machine_config_t MACHINE_CONFIG_HEAT_EXCHANGER = {
 // =============================================================================
 // API Functions
 // =============================================================================
+// The machine type is fixed at compile time, so these are static inline
+// reads of the selected const config - the optimizer constant-folds them
+// and collapses feature branches (e.g. `if (machine_has_steam_boiler())`)
+// out of the control and sensor loops entirely. Each firmware image is
+// fully specialized; the BUILD_ALL_MACHINES CMake option produces every
+// variant when field flexibility is needed.
 
 /**
  * Get the active machine configuration
  */
-const machine_config_t* machine_config_get(void);
+static inline const machine_config_t* machine_config_get(void) {
+    return MACHINE_CONFIG_GET();
+}
 
 /**
  * Get machine type
  */
-machine_type_t machine_get_type(void);
+static inline machine_type_t machine_get_type(void) {
+    return MACHINE_CONFIG_GET()->features.type;
+}
 
 /**
  * Get machine features
  */
-const machine_features_t* machine_get_features(void);
+static inline const machine_features_t* machine_get_features(void) {
+    return &MACHINE_CONFIG_GET()->features;
+}
 
 /**
  * Check if machine has a specific feature
  */
-bool machine_has_brew_boiler(void);
-bool machine_has_steam_boiler(void);
-bool machine_is_heat_exchanger(void);
-bool machine_needs_mode_switching(void);
-bool machine_has_brew_ntc(void);
-bool machine_has_steam_ntc(void);
+static inline bool machine_has_brew_boiler(void) {
+    return MACHINE_CONFIG_GET()->features.has_brew_boiler;
+}
+
+static inline bool machine_has_steam_boiler(void) {
+    return MACHINE_CONFIG_GET()->features.has_steam_boiler;
+}
+
+static inline bool machine_is_heat_exchanger(void) {
+    return MACHINE_CONFIG_GET()->features.is_heat_exchanger;
+}
+
+static inline bool machine_needs_mode_switching(void) {
+    return MACHINE_CONFIG_GET()->features.needs_mode_switching;
+}
+
+static inline bool machine_has_brew_ntc(void) {
+    return MACHINE_CONFIG_GET()->features.has_brew_ntc;
+}
+
+static inline bool machine_has_steam_ntc(void) {
+    return MACHINE_CONFIG_GET()->features.has_steam_ntc;
+}
 
 /**
  * Get machine name string
  */
-const char* machine_get_name(void);
+static inline const char* machine_get_name(void) {
+    return MACHINE_CONFIG_GET()->features.name;
+}
 
 /**
  * Get single boiler config (only valid for MACHINE_TYPE_SINGLE_BOILER)
  */
-const single_boiler_config_t* machine_get_single_boiler_config(void);
+static inline const single_boiler_config_t* machine_get_single_boiler_config(void) {
+    if (MACHINE_CONFIG_GET()->features.type == MACHINE_TYPE_SINGLE_BOILER) {
+        return &MACHINE_CONFIG_GET()->mode_config.single_boiler;
+    }
+    return (const single_boiler_config_t*)0;
+}
 
 /**
  * Get heat exchanger config (only valid for MACHINE_TYPE_HEAT_EXCHANGER)
  */
-const heat_exchanger_config_t* machine_get_hx_config(void);
+static inline const heat_exchanger_config_t* machine_get_hx_config(void) {
+    if (MACHINE_CONFIG_GET()->features.type == MACHINE_TYPE_HEAT_EXCHANGER) {
+        return &MACHINE_CONFIG_GET()->mode_config.heat_exchanger;
+    }
+    return (const heat_exchanger_config_t*)0;
+}
 
 /**
  * Get machine electrical specifications
  */
-const machine_electrical_t* machine_get_electrical(void);
+static inline const machine_electrical_t* machine_get_electrical(void) {
+    return &MACHINE_CONFIG_GET()->electrical;
+}
+
+/**
+ * Get temperature estimator configs (second filter stage selection)
+ */
+static inline const temp_estimator_config_t* machine_get_brew_estimator(void) {
+    return &MACHINE_CONFIG_GET()->estimator.brew;
+}
+
+static inline const temp_estimator_config_t* machine_get_steam_estimator(void) {
+    return &MACHINE_CONFIG_GET()->estimator.steam;
+}
+
+/**
+ * Get group temperature conduction model coefficients
+ */
+static inline const group_temp_model_t* machine_get_group_model(void) {
+    return &MACHINE_CONFIG_GET()->group_model;
+}
 
 #endif // MACHINE_CONFIG_H
 
@@ -17,6 +17,27 @@
  */
 extern void core1_signal_alive(void);
 
+// =============================================================================
+// Dispatch Table
+// =============================================================================
+
+/**
+ * Dispatch a received command packet through the const handler table.
+ * One bounds check and one indirect call; each entry carries the minimum
+ * valid payload length (taken from the protocol_defs.h command structs),
+ * so short payloads are rejected with ACK_ERROR_INVALID before the
+ * handler runs. Unknown types are logged and dropped.
+ * @param packet Received packet
+ */
+void packet_dispatch(const packet_t* packet);
+
+/**
+ * Per-type received-command counters, maintained by packet_dispatch().
+ * @param count Out: number of table entries (indexed by message type)
+ * @return Counter array, indexed by message type
+ */
+const uint32_t* packet_dispatch_counts(size_t* count);
+
 // =============================================================================
 // Individual Packet Handlers
 // =============================================================================
@@ -57,6 +78,13 @@ void handle_cmd_mode(const packet_t* packet);
  */
 void handle_cmd_get_config(const packet_t* packet);
 
+/**
+ * Handle GET_SNAPSHOT command
+ * Sends the whole machine config as one MSG_CONFIG_SNAPSHOT frame
+ * @param packet Received packet
+ */
+void handle_cmd_get_snapshot(const packet_t* packet);
+
 /**
  * Handle CONFIG command
  * @param packet Received packet
@@ -93,6 +121,12 @@ void handle_cmd_debug(const packet_t* packet);
  */
 void handle_cmd_set_eco(const packet_t* packet);
 
+/**
+ * Handle SET_WAKE_SCHEDULE command
+ * @param packet Received packet
+ */
+void handle_cmd_set_wake_schedule(const packet_t* packet);
+
 /**
  * Handle BOOTLOADER command
  * @param packet Received packet
@@ -5,6 +5,8 @@
 #include <stdbool.h>
 #include <stddef.h>  // For size_t
 #include "config.h"  // Includes protocol_defs.h
+#include "protocol_latency.h"  // Shared command->ACK latency histogram buckets
+#include "trace_format.h"      // Shared tracepoint record layout (MSG_TRACE)
 // power_meter.h removed (v2.32 - hardware power metering removed)
 
 // -----------------------------------------------------------------------------
@@ -19,6 +21,7 @@
 #define PROTOCOL_MAX_PENDING_CMDS   4     // Maximum pending commands awaiting ACK
 #define PROTOCOL_BACKPRESSURE_THRESHOLD 3 // Send NACK when pending >= threshold
 #define PROTOCOL_UART_WRITE_TIMEOUT_MS 100 // Max time to wait for UART to become writable
+#define PROTOCOL_BATCH_SUBHDR_SIZE  2     // Per-sub-message overhead in MSG_BATCH: type + length
 
 // -----------------------------------------------------------------------------
 // Packet Structure
@@ -62,6 +65,9 @@ typedef struct {
     uint32_t bytes_received;        // Total bytes received
     uint32_t bytes_sent;            // Total bytes sent
     uint32_t packets_dropped;        // Packets dropped due to UART unavailability
+    uint32_t ack_latency_buckets[PROTOCOL_LATENCY_BUCKET_COUNT];  // Command->ACK RTT histogram
+    uint32_t ack_latency_samples;   // Total RTT samples recorded
+    uint32_t ack_latency_max_ms;    // Worst observed command->ACK round-trip
     uint8_t last_seq_received;      // Last sequence number received
     uint8_t last_seq_sent;          // Last sequence number sent
     uint8_t pending_cmd_count;      // Current pending commands
@@ -71,26 +77,21 @@ typedef struct {
 // -----------------------------------------------------------------------------
 // Status Payload (MSG_STATUS = 0x01)
 // -----------------------------------------------------------------------------
-typedef struct __attribute__((packed)) {
-    int16_t brew_temp;          // Celsius * 10 (0.1C resolution)
-    int16_t steam_temp;         // Celsius * 10
-    int16_t group_temp;         // Celsius * 10 (if available)
-    uint16_t pressure;          // Bar * 100 (0.01 bar resolution)
-    int16_t brew_setpoint;      // Celsius * 10
-    int16_t steam_setpoint;     // Celsius * 10
-    uint8_t brew_output;        // 0-100%
-    uint8_t steam_output;       // 0-100%
-    uint8_t pump_output;        // 0-100%
-    uint8_t state;              // Machine state (see STATE_* in protocol_defs.h)
-    uint8_t flags;              // Status flags (see STATUS_FLAG_* in protocol_defs.h)
-    uint8_t water_level;        // 0-100%
-    uint16_t power_watts;       // Current power draw
-    uint32_t uptime_ms;         // Milliseconds since boot
-    uint32_t shot_start_timestamp_ms;  // Brew start timestamp (milliseconds since boot, 0 if not brewing)
-    uint8_t heating_strategy;   // Current heating strategy (see HEAT_STRATEGY_* in protocol_defs.h)
-    uint8_t cleaning_reminder;  // 1 if cleaning reminder is due (brew_count >= threshold), 0 otherwise
-    uint16_t brew_count;        // Number of brews since last cleaning (for cleaning reminder)
-} status_payload_t;
+// status_payload_t is generated from STATUS_FIELD_LIST in protocol_defs.h -
+// the same schema also generates the delta-builder table below and the
+// ESP32's delta-apply table, so the three can no longer drift apart.
+
+// -----------------------------------------------------------------------------
+// Delta Status (MSG_STATUS_DELTA = 0x27)
+// -----------------------------------------------------------------------------
+// Payload: uint32_t changed-field mask, then only the changed fields packed in
+// status_payload_t declaration order (bit 0 = brew_temp ... bit 18 = flow_ml_min).
+// A full MSG_STATUS keyframe goes out every STATUS_DELTA_KEYFRAME_INTERVAL
+// frames so a receiver that missed deltas resynchronizes within one interval.
+// Mirrors what the ESP32's buildDeltaStatus() already does for WebSocket clients.
+#define STATUS_DELTA_FIELD_COUNT        STATUS_FIELD_COUNT
+#define STATUS_DELTA_MASK_SIZE          4   // uint32_t mask prefix
+#define STATUS_DELTA_KEYFRAME_INTERVAL  20  // Full keyframe every N status frames
 
 // -----------------------------------------------------------------------------
 // Alarm Payload (MSG_ALARM = 0x02)
@@ -122,12 +123,24 @@ typedef struct __attribute__((packed)) {
 // -----------------------------------------------------------------------------
 // Protocol Handshake Payload (MSG_HANDSHAKE = 0x0C)
 // -----------------------------------------------------------------------------
+
+// Capability bits (handshake_payload_t.capabilities)
+#define PROTOCOL_CAP_RATE_NEGOTIATION  0x01  // Peer honors per-class telemetry rates
+
+// Negotiated rate bounds (Hz)
+#define PROTOCOL_STATUS_RATE_MIN_HZ    1
+#define PROTOCOL_STATUS_RATE_MAX_HZ    50
+
 typedef struct __attribute__((packed)) {
     uint8_t protocol_version_major;
     uint8_t protocol_version_minor;
-    uint8_t capabilities;       // Bit flags for optional features
+    uint8_t capabilities;       // Bit flags for optional features (PROTOCOL_CAP_*)
     uint8_t max_retry_count;    // Maximum retry attempts
     uint16_t ack_timeout_ms;    // ACK timeout in milliseconds
+    // Telemetry rate negotiation (valid when PROTOCOL_CAP_RATE_NEGOTIATION set;
+    // older peers send the 6-byte payload and these fields default)
+    uint8_t status_rate_idle_hz;    // Requested status rate while idle (0 = default)
+    uint8_t status_rate_active_hz;  // Requested status rate while brewing (0 = default)
 } handshake_payload_t;
 
 // -----------------------------------------------------------------------------
@@ -144,6 +157,39 @@ typedef struct __attribute__((packed)) {
     uint8_t machine_type;       // See MACHINE_TYPE_* in protocol_defs.h
 } config_payload_t;
 
+// -----------------------------------------------------------------------------
+// Config Snapshot Payload (MSG_CONFIG_SNAPSHOT = 0x0F)
+// -----------------------------------------------------------------------------
+// Whole machine config in a single frame, replacing the per-config_type
+// round trips on reconnect-after-OTA. Bump the version when the layout changes.
+#define CONFIG_SNAPSHOT_VERSION  1
+
+typedef struct __attribute__((packed)) {
+    uint8_t snapshot_version;    // CONFIG_SNAPSHOT_VERSION (layout compatibility)
+    // Control config (mirrors config_payload_t)
+    int16_t brew_setpoint;       // Celsius * 10
+    int16_t steam_setpoint;      // Celsius * 10
+    int16_t temp_offset;         // Celsius * 10
+    uint16_t pid_kp;             // * 100
+    uint16_t pid_ki;             // * 100
+    uint16_t pid_kd;             // * 100
+    uint8_t heating_strategy;    // See HEAT_STRATEGY_* in protocol_defs.h
+    uint8_t machine_type;        // See MACHINE_TYPE_* in protocol_defs.h
+    // Environmental electrical config
+    uint16_t nominal_voltage;    // 120, 230, 240, etc. (V)
+    float max_current_draw;      // 10.0, 16.0, etc. (A)
+    // Pre-infusion
+    uint8_t preinfusion_enabled;
+    uint16_t preinfusion_on_ms;
+    uint16_t preinfusion_pause_ms;
+    // Eco mode
+    uint8_t eco_enabled;
+    int16_t eco_brew_temp;       // Celsius * 10
+    uint16_t eco_timeout_minutes;
+    // Cleaning
+    uint16_t cleaning_threshold; // Brews before cleaning reminder
+} config_snapshot_payload_t;  // 33 bytes
+
 // -----------------------------------------------------------------------------
 // Command Payloads
 // -----------------------------------------------------------------------------
@@ -252,6 +298,63 @@ typedef struct __attribute__((packed)) {
     uint16_t duration_ms;          // Total test duration
 } diag_header_payload_t;  // 8 bytes
 
+// -----------------------------------------------------------------------------
+// Control-Loop Jitter Payload (MSG_JITTER = 0x2A)
+// -----------------------------------------------------------------------------
+// Timing quality of the Core 0 control tick. Lateness is the actual tick
+// period minus CONTROL_LOOP_PERIOD_MS; bucket bounds are the shared
+// control_jitter_bounds_us table in protocol_latency.h. The per-cause max
+// fields attribute the worst observed lateness to whatever non-control work
+// ran since the prior tick (flash pauses freeze both cores; Class B slices
+// and Core 0 alarm sends share the idle gap).
+typedef struct __attribute__((packed)) {
+    uint32_t samples;                                   // Control ticks measured since boot
+    uint32_t late_buckets[CONTROL_JITTER_BUCKET_COUNT]; // Lateness histogram
+    uint32_t max_late_us;                               // Worst lateness overall
+    uint32_t max_late_flash_us;                         // Worst with a flash op since the prior tick
+    uint32_t max_late_class_b_us;                       // Worst dominated by Class B slice time
+    uint32_t max_late_protocol_us;                      // Worst dominated by Core 0 protocol sends
+    uint32_t max_late_other_us;                         // Worst with no identified cause
+} jitter_payload_t;  // 56 bytes
+
+// -----------------------------------------------------------------------------
+// Warm-Boot State Payload (MSG_WARM_STATE = 0x2B)
+// -----------------------------------------------------------------------------
+// Pushed once per handshake. When only the ESP32 rebooted (OTA, crash, power
+// blip on its rail) the Pico has been running the whole time; this bundles
+// the identity fields from boot info with a full status frame so the UI and
+// dashboard are truthful within one message instead of one polling round.
+typedef struct __attribute__((packed)) {
+    uint8_t version_major;      // Pico firmware version
+    uint8_t version_minor;
+    uint8_t version_patch;
+    uint8_t machine_type;       // See MACHINE_TYPE_* in protocol_defs.h
+    uint8_t active_shot;        // 1 if a brew is in progress right now
+    uint8_t reserved;           // Alignment / future use
+    uint32_t pico_uptime_ms;    // How long the Pico has been up (detects ESP32-only reboot)
+    status_payload_t status;    // Full current status frame (delta baseline)
+} warm_state_payload_t;  // 10 + 39 = 49 bytes
+
+// -----------------------------------------------------------------------------
+// Sensor Burst Payload (MSG_SENSOR_BURST = 0x2C)
+// -----------------------------------------------------------------------------
+// One frame of a raw ADC burst capture (see burst_capture.c). The capture
+// drains as a sequence of these after the shot ends; frame/total_frames and
+// first_sample let the ESP32 reassemble the buffer without per-frame state
+// and detect gaps if a frame is lost. Samples are raw 12-bit ADC counts,
+// taken before the median/moving-average chain in sensors.c.
+#define SENSOR_BURST_SAMPLES_PER_FRAME  28
+
+typedef struct __attribute__((packed)) {
+    uint8_t frame;              // Frame index within this capture (0-based)
+    uint8_t total_frames;       // Frames in the whole capture
+    uint16_t first_sample;      // Capture index of samples[0]
+    uint16_t sample_rate_hz;    // Raw ADC rate per channel
+    uint8_t count;              // Valid entries in samples[]
+    uint8_t adc_channel;        // ADC channel captured (GPIO26=0 .. GPIO29=3)
+    uint16_t samples[SENSOR_BURST_SAMPLES_PER_FRAME];  // Raw ADC counts
+} sensor_burst_payload_t;  // 8 + 56 = 64 bytes (exact fit when full)
+
 // -----------------------------------------------------------------------------
 // ACK Payload (MSG_ACK = 0x04)
 // -----------------------------------------------------------------------------
@@ -274,9 +377,14 @@ void protocol_process(void);
 
 // Send packets
 bool protocol_send_status(const status_payload_t* status);
+// Send a MSG_STATUS_DELTA with only the fields that changed since the last
+// send; automatically falls back to a full MSG_STATUS keyframe periodically,
+// after (re)handshake, and when nearly everything changed anyway
+bool protocol_send_status_delta(const status_payload_t* status);
 bool protocol_send_alarm(uint8_t code, uint8_t severity, uint16_t value);
 bool protocol_send_boot(void);
 bool protocol_send_config(const config_payload_t* config);
+bool protocol_send_config_snapshot(const config_snapshot_payload_t* snapshot);
 bool protocol_send_env_config(const env_config_payload_t* env_config);
 // DEPRECATED: Statistics are now tracked by ESP32. This function is retained for compatibility.
 bool protocol_send_statistics(const statistics_payload_t* stats);
@@ -284,10 +392,35 @@ bool protocol_send_ack(uint8_t for_type, uint8_t seq, uint8_t result);
 bool protocol_send_debug(const char* message);
 // Log forwarding (MSG_LOG)
 bool protocol_send_log(uint8_t level, const char* message);
+// Compact log forwarding (MSG_LOG_COMPACT) - catalog id + packed int32 args,
+// expanded to text on the ESP32 via the shared log_catalog.h table
+bool protocol_send_log_compact(uint8_t level, uint16_t id, uint8_t argc, const int32_t* args);
+#if TRACEPOINTS
+// Tracepoint batch forwarding (MSG_TRACE) - record layout in trace_format.h
+bool protocol_send_trace(uint32_t cpu_hz, const trace_record_t* records, uint8_t count);
+#endif
 // Power meter removed (v2.32) - power metering via MQTT smart plugs on ESP32
 // Diagnostics
 bool protocol_send_diag_header(const diag_header_payload_t* header);
 bool protocol_send_diag_result(const diag_result_payload_t* result);
+// Control-loop jitter report (MSG_JITTER) - pushed with the 60s stats block
+bool protocol_send_jitter(const jitter_payload_t* jitter);
+// Raw ADC burst frame (MSG_SENSOR_BURST) - sends only the valid prefix of
+// samples[], so the usual partial last frame doesn't ship zero padding
+bool protocol_send_sensor_burst(const sensor_burst_payload_t* burst);
+// Warm-boot state snapshot (MSG_WARM_STATE) - sent once per handshake.
+// protocol_take_warm_state_request() returns true exactly once after each
+// handshake; the Core 1 loop consumes it and builds the payload (it owns the
+// status double-buffer read path).
+bool protocol_take_warm_state_request(void);
+bool protocol_send_warm_state(const warm_state_payload_t* warm);
+
+// Batched frames (MSG_BATCH) - accumulate small messages and ship them under
+// one header + CRC, halving framing overhead at high telemetry rates.
+// Add sub-messages during a telemetry cycle, then flush once per cycle.
+// batch_add() auto-flushes when the next sub-message would not fit.
+bool protocol_batch_add(uint8_t type, const uint8_t* payload, uint8_t length);
+bool protocol_batch_flush(void);
 
 // Error tracking
 uint32_t protocol_get_crc_errors(void);
@@ -304,6 +437,11 @@ bool protocol_is_ready(void);           // Returns true if handshake complete
 bool protocol_handshake_complete(void); // Check handshake status
 void protocol_request_handshake(void);  // Initiate handshake
 
+// Negotiated telemetry rates (set during handshake, see PROTOCOL_CAP_RATE_NEGOTIATION)
+// Returns the status send interval for the current activity level; falls back
+// to STATUS_SEND_PERIOD_MS when the peer didn't negotiate rates
+uint32_t protocol_get_status_interval_ms(bool active);
+
 // Packet callback
 typedef void (*packet_callback_t)(const packet_t* packet);
 void protocol_set_callback(packet_callback_t callback);
@@ -340,7 +478,15 @@ _Static_assert(sizeof(config_machine_info_t) + 1 <= PROTOCOL_MAX_PAYLOAD,
                "config_machine_info_t + config_type byte exceeds PROTOCOL_MAX_PAYLOAD");
 _Static_assert(sizeof(boot_payload_t) <= PROTOCOL_MAX_PAYLOAD,
                "boot_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
+_Static_assert(sizeof(config_snapshot_payload_t) <= PROTOCOL_MAX_PAYLOAD,
+               "config_snapshot_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
 _Static_assert(sizeof(diag_result_payload_t) <= PROTOCOL_MAX_PAYLOAD,
                "diag_result_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
+_Static_assert(sizeof(jitter_payload_t) <= PROTOCOL_MAX_PAYLOAD,
+               "jitter_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
+_Static_assert(sizeof(warm_state_payload_t) <= PROTOCOL_MAX_PAYLOAD,
+               "warm_state_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
+_Static_assert(sizeof(sensor_burst_payload_t) <= PROTOCOL_MAX_PAYLOAD,
+               "sensor_burst_payload_t exceeds PROTOCOL_MAX_PAYLOAD");
 
 #endif // PROTOCOL_H
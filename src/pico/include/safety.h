@@ -43,6 +43,11 @@ void safety_init(void);
 // Check all safety conditions (call in main loop, returns state)
 safety_state_t safety_check(void);
 
+// Fast table-driven temperature limit pass (SAF-020/021/023/024 only).
+// Constant-time and cheap enough to run every main-loop iteration between
+// full safety_check() ticks for faster over-temp/sensor-fault detection.
+safety_state_t safety_check_limits(void);
+
 // Get current safety flags
 uint8_t safety_get_flags(void);
 
@@ -70,6 +75,13 @@ uint32_t safety_get_last_heartbeat_time(void);
 // Check if in defensive mode (ESP32 not connected, machine forced to IDLE)
 bool safety_is_defensive_mode(void);
 
+// Suspend defensive-mode IDLE forcing for a bounded window so an autonomous
+// scheduled wake (wake_schedule.c) can heat with the ESP32 down. All real
+// safety layers (over-temp, SSR monitoring, water levels, Class B) stay
+// fully active - this only lifts the "no ESP32, no operation" policy, and
+// IDLE forcing resumes when the window expires without a reconnect.
+void safety_defensive_wake_override(uint32_t duration_ms);
+
 // Get last alarm code
 uint8_t safety_get_last_alarm(void);
 
@@ -106,6 +106,58 @@ float filter_moving_avg_update(moving_avg_filter_t* filter, float value);
  */
 void filter_moving_avg_reset(moving_avg_filter_t* filter);
 
+// =============================================================================
+// Temperature Estimator (alpha-beta with heater feedforward)
+// =============================================================================
+// Optional second-stage replacement for the moving average: an alpha-beta
+// tracker (steady-state Kalman) whose prediction step feeds forward the SSR
+// heater duty. The moving average always lags a heating boiler by half its
+// window; the estimator's model already contains the rise the heater is
+// producing, so the PID sees it sooner. Selected per sensor via the
+// estimator config in machine_config.h.
+
+/**
+ * Temperature estimator state
+ */
+typedef struct {
+    float temp_c;           // Estimated temperature (°C)
+    float rate_c_per_s;     // Estimated unmodeled rate - losses, lag (°C/s)
+    float alpha;            // Temperature correction gain (0..1)
+    float beta;             // Rate correction gain (0..1)
+    float heater_gain;      // Heating rate at 100% duty (°C/s)
+    bool  initialized;      // First sample seeds the state
+} temp_estimator_t;
+
+/**
+ * Initialize temperature estimator
+ *
+ * @param est Estimator structure to initialize
+ * @param alpha Temperature correction gain (0..1, higher = trust measurement)
+ * @param beta Rate correction gain (0..1, fraction of residual per update)
+ * @param heater_gain_c_per_s Heating rate at 100% SSR duty (°C/s)
+ */
+void temp_estimator_init(temp_estimator_t* est, float alpha, float beta,
+                         float heater_gain_c_per_s);
+
+/**
+ * Feed a measurement and the current heater duty, get the estimate
+ *
+ * @param est Estimator structure
+ * @param measured_c Measured temperature (°C), typically median-filtered
+ * @param heater_duty_pct Current SSR duty for this boiler (0-100)
+ * @param dt Time since last update (seconds)
+ * @return Estimated temperature (°C); the raw measurement until seeded
+ */
+float temp_estimator_update(temp_estimator_t* est, float measured_c,
+                            float heater_duty_pct, float dt);
+
+/**
+ * Reset estimator (next measurement re-seeds the state)
+ *
+ * @param est Estimator structure
+ */
+void temp_estimator_reset(temp_estimator_t* est);
+
 // =============================================================================
 // NTC Temperature Conversion
 // =============================================================================
@@ -145,7 +197,7 @@ float ntc_adc_to_temp(uint16_t adc_value, float vref, float r_series,
 
 /**
  * Validate temperature reading
- * 
+ *
  * @param temp_c Temperature in Celsius
  * @param min_temp Minimum valid temperature
  * @param max_temp Maximum valid temperature
@@ -153,5 +205,37 @@ float ntc_adc_to_temp(uint16_t adc_value, float vref, float r_series,
  */
 bool sensor_validate_temp(float temp_c, float min_temp, float max_temp);
 
+// =============================================================================
+// NTC ADC-to-Temperature Lookup Table
+// =============================================================================
+// Precomputed replacement for the per-sample Steinhart-Hart math: the table
+// covers the 12-bit ADC range in 256 segments (16 counts each) and lookup is
+// two loads plus an integer lerp. One table per NTC profile (the brew and
+// steam channels can have different series resistors).
+
+#define NTC_LUT_SEGMENTS  256
+#define NTC_LUT_STEP      16              // 4096 / NTC_LUT_SEGMENTS
+#define NTC_LUT_INVALID   INT16_MIN       // Marks open/short-circuit codes
+
+typedef struct {
+    int16_t temp_c10[NTC_LUT_SEGMENTS + 1];  // Celsius*10; +1 guard for lerp
+} ntc_lut_t;
+
+/**
+ * Build a lookup table from the analytic conversion.
+ * Call once at init (~257 logf calls); parameters as ntc_adc_to_temp().
+ */
+void ntc_lut_init(ntc_lut_t* lut, float vref, float r_series,
+                  float r_ntc_25, float b_value);
+
+/**
+ * Convert ADC reading to temperature via table lookup.
+ *
+ * @param lut Table built by ntc_lut_init()
+ * @param adc_value ADC reading (0-4095)
+ * @return Temperature in Celsius, or NAN in invalid (open/short) regions
+ */
+float ntc_lut_lookup(const ntc_lut_t* lut, uint16_t adc_value);
+
 #endif // SENSOR_UTILS_H
 
@@ -23,15 +23,21 @@ typedef struct {
 // Functions
 // -----------------------------------------------------------------------------
 
-// Initialize all sensors
+// Initialize all sensors (call on Core 0 before launching Core 1)
 void sensors_init(void);
 
-// Read all sensors (call periodically)
+// Read all sensors and publish to the cross-core mailbox.
+// Called periodically from Core 1; Core 0 must not call this.
 void sensors_read(void);
 
-// Get all sensor data
+// Copy a consistent snapshot of all sensor data (seqlock read, lock-free).
+// Safe to call from either core.
 void sensors_get_data(sensor_data_t* data);
 
+// Milliseconds since the mailbox was last published. Lets Core 0 detect
+// stale data if Core 1 stops acquiring.
+uint32_t sensors_data_age_ms(void);
+
 // Get individual values
 int16_t sensors_get_brew_temp(void);
 int16_t sensors_get_steam_temp(void);
@@ -80,6 +80,33 @@ void state_get_preinfusion(bool* enabled, uint16_t* on_ms, uint16_t* pause_ms);
 uint32_t state_get_brew_duration_ms(void);  // Deprecated: use state_get_brew_start_timestamp_ms()
 uint32_t state_get_brew_start_timestamp_ms(void);  // Returns brew start timestamp (0 if not brewing)
 
+// -----------------------------------------------------------------------------
+// Shot Phases
+// -----------------------------------------------------------------------------
+// Phase ids are wire format (BREW_PHASE_* in protocol_defs.h) and reported
+// in the status payload, so the ESP32 UI shows phase progress directly
+// instead of inferring it from pressure heuristics.
+
+// Number of phase slots in the per-shot log (BREW_PHASE_NONE..POST_BREW)
+#define SHOT_PHASE_COUNT 5
+
+// Per-shot phase log: absolute entry time of each phase in microseconds
+// since boot (0 = phase not reached this shot). The BREW_PHASE_NONE slot
+// records shot completion (solenoid off after the post-brew delay), so it
+// doubles as the shot-end timestamp for phase-aligned telemetry analysis.
+typedef struct {
+    uint64_t enter_us[SHOT_PHASE_COUNT];  // Indexed by BREW_PHASE_*
+} shot_phase_log_t;
+
+// Current shot phase (BREW_PHASE_NONE when no shot in progress)
+uint8_t state_get_brew_phase(void);
+
+// Entry time of the current phase, low 32 bits of us since boot (0 = none)
+uint32_t state_get_phase_start_us(void);
+
+// Phase log of the current (or most recent) shot; reset on brew start
+const shot_phase_log_t* state_get_shot_phase_log(void);
+
 // -----------------------------------------------------------------------------
 // Eco Mode
 // -----------------------------------------------------------------------------
@@ -0,0 +1,35 @@
+/**
+ * Pico Firmware - Hot-Path Tracepoints
+ *
+ * Per-core cycle-counter tracepoint rings (see trace_format.h for the shared
+ * record layout and the TRACE_BEGIN/TRACE_END macros). Records are forwarded
+ * to the ESP32 in MSG_TRACE batches from the Core 1 loop, next to the log
+ * forwarding drain, and end up in the merged /api/trace dump.
+ *
+ * Everything here compiles out unless built with -DTRACEPOINTS=1; the stubs
+ * below let main.c call init/flush unconditionally.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "trace_format.h"
+
+#if TRACEPOINTS
+
+// Enable the DWT cycle counter on the calling core. Each core has its own
+// counter - call once from main() (Core 0) and once from core1_main().
+void trace_init(void);
+
+// Drain both cores' rings into MSG_TRACE batches. Call from the Core 1 loop;
+// bounded per call so a full ring can't monopolize the UART.
+void trace_flush(void);
+
+#else
+
+#define trace_init()  ((void)0)
+#define trace_flush() ((void)0)
+
+#endif // TRACEPOINTS
+
+#endif // TRACE_H
@@ -0,0 +1,72 @@
+/**
+ * DMA-driven UART TX for the ESP32 protocol link
+ *
+ * Replaces the byte-polling write loop in the protocol path with a DMA
+ * channel that streams frames into the UART TX FIFO (DREQ paced). Frames
+ * are staged in a software ring; when the in-flight DMA transfer completes,
+ * the IRQ handler chains the next contiguous span of the ring into the
+ * channel. protocol_process() therefore never spins waiting for a writable
+ * UART, which was the main source of control-loop overshoot during log storms.
+ */
+
+#ifndef UART_TX_DMA_H
+#define UART_TX_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "config.h"
+
+// Software staging ring - sized for a burst of status + log frames
+// (~70 bytes/frame, so ~14 max-size frames can be in flight)
+#define UART_TX_DMA_RING_SIZE 1024
+
+#ifndef UNIT_TEST
+#include "hardware/uart.h"
+#else
+typedef void uart_inst_t;
+#endif
+
+/**
+ * Claim a DMA channel and attach it to the given UART's TX FIFO.
+ * @return true on success, false if no DMA channel was available
+ * (callers fall back to the polling write path)
+ */
+bool uart_tx_dma_init(uart_inst_t* uart);
+
+/**
+ * Release the DMA channel (call before handing the UART to the bootloader)
+ */
+void uart_tx_dma_deinit(void);
+
+/**
+ * Queue bytes for transmission. Non-blocking: copies into the staging ring
+ * and kicks the DMA channel if idle.
+ * @return true if all bytes were queued, false if the ring is full
+ * (frame must be dropped whole - partial frames corrupt the stream)
+ */
+bool uart_tx_dma_write(const uint8_t* data, size_t len);
+
+/**
+ * Bytes queued but not yet handed to the DMA channel
+ */
+size_t uart_tx_dma_pending(void);
+
+/**
+ * True once the ring is empty and the DMA channel is idle
+ */
+bool uart_tx_dma_is_idle(void);
+
+/**
+ * Block until all queued bytes have entered the UART FIFO or timeout expires.
+ * Only used on slow paths (bootloader entry) - never from the control loop.
+ * @return true if fully drained, false on timeout
+ */
+bool uart_tx_dma_flush(uint32_t timeout_ms);
+
+/**
+ * True if init succeeded and DMA TX is active
+ */
+bool uart_tx_dma_is_initialized(void);
+
+#endif // UART_TX_DMA_H
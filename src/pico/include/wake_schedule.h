@@ -0,0 +1,88 @@
+/**
+ * Pico Firmware - Autonomous Wake Schedule
+ *
+ * Schedules normally run on the ESP32 (it has the wall clock and the full
+ * schedule UI), but that makes the 6am warmup depend on the ESP32 being
+ * alive at 6am - a crashed, updating, or WiFi-less ESP32 silently skips it.
+ *
+ * This module keeps a compiled copy of the turn-on schedule on the Pico.
+ * The ESP32 pushes it (MSG_CMD_SET_WAKE_SCHEDULE) on every Pico reconnect,
+ * on every schedule edit, and periodically as a clock refresh; the table is
+ * persisted to flash so it survives Pico reboots. The push carries the
+ * current local minute-of-week, which the Pico extends with its own
+ * millisecond clock - no RTC needed, and crystal drift is bounded by the
+ * periodic refresh.
+ *
+ * Reconciliation with a live ESP32 is by deference, not negotiation: the
+ * Pico only fires an entry once it is a full minute past due and the
+ * machine is still idle. A healthy ESP32 fires the same schedule within
+ * seconds of the deadline (MSG_CMD_MODE), so by the time the Pico looks,
+ * the machine is already heating and the entry is skipped.
+ *
+ * After a Pico power cycle the persisted table is restored but the clock
+ * reference is not (milliseconds-since-boot restarted), so the table stays
+ * dormant until the next ESP32 push re-anchors it.
+ */
+
+#ifndef WAKE_SCHEDULE_H
+#define WAKE_SCHEDULE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "protocol_defs.h"  // WAKE_SCHEDULE_MAX
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+#define WAKE_GRACE_MINUTES      1   // Defer to a live ESP32 for this long past due
+#define WAKE_WINDOW_MINUTES     5   // Give up on an entry this long past due
+
+// How long a fired wake suspends defensive-mode IDLE forcing (safety.c).
+// Long enough to cover a morning routine with the ESP32 dead; if it stays
+// dead past this, the machine idles again. Eco timeout still applies
+// within the window, so an untouched machine drops to eco temp regardless.
+#define WAKE_DEFENSIVE_OVERRIDE_MS  (2u * 60u * 60u * 1000u)
+
+// One compiled schedule entry as pushed by the ESP32 (wire and flash format)
+typedef struct __attribute__((packed)) {
+    uint16_t minute_of_day;     // 0-1439, local time
+    uint8_t days;               // Day-of-week bitmask, bit 0 = Sunday
+    uint8_t strategy;           // HEAT_STRATEGY_* to apply on wake
+} wake_schedule_entry_t;
+
+// =============================================================================
+// Functions
+// =============================================================================
+
+/**
+ * Initialize: restore the persisted table from flash.
+ * The clock reference starts invalid - entries cannot fire until the
+ * ESP32 pushes one (see module comment).
+ */
+void wake_schedule_init(void);
+
+/**
+ * Apply a pushed schedule: replace the table, persist it, and re-anchor
+ * the clock reference. Entries must already be validated by the caller.
+ *
+ * @param entries Compiled entries (NULL allowed when count is 0)
+ * @param count   Number of entries (0 clears the table)
+ * @param cur_mow Current local minute-of-week (Sunday 00:00 = 0)
+ * @param cur_sec Seconds into the current minute (0-59)
+ */
+void wake_schedule_apply(const wake_schedule_entry_t* entries, uint8_t count,
+                         uint16_t cur_mow, uint8_t cur_sec);
+
+/**
+ * Evaluate the table and fire due entries (call every main loop pass;
+ * internally gated to ~1Hz). No-op while the clock reference is invalid.
+ */
+void wake_schedule_update(void);
+
+/**
+ * True once an ESP32 push has anchored the clock reference.
+ */
+bool wake_schedule_clock_valid(void);
+
+#endif // WAKE_SCHEDULE_H
@@ -0,0 +1,148 @@
+/**
+ * Pico Firmware - Shot-Start Sensor Burst Capture Implementation
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "burst_capture.h"
+#include "protocol.h"
+#include "config.h"
+
+// =============================================================================
+// State
+// =============================================================================
+
+// Buffer ceiling: BURST_CAPTURE_SECONDS at the 200Hz per-channel DMA rate.
+// A faster configured rate just shortens the captured window.
+#define BURST_CAPTURE_MAX_SAMPLES   600
+
+// Capture lifecycle. Core 0 (state machine) moves IDLE->CAPTURING->DRAINING;
+// Core 1 (comm loop) moves DRAINING->IDLE when the last frame has been sent.
+typedef enum {
+    BURST_IDLE = 0,       // Dormant - push() is a single compare
+    BURST_CAPTURING,      // Recording raw samples (brew in progress)
+    BURST_DRAINING,       // Shot over - shipping frames to the ESP32
+} burst_state_t;
+
+static volatile burst_state_t g_burst_state = BURST_IDLE;
+
+// Configured at init (from sensors.c, once ADC channels are resolved)
+static int8_t g_channel = -1;
+static uint16_t g_sample_rate_hz = 0;
+static uint16_t g_window_samples = 0;   // min(rate * seconds, MAX)
+
+// Sample buffer - written by push() and read by the drain, both on Core 1
+static uint16_t g_samples[BURST_CAPTURE_MAX_SAMPLES];
+static volatile uint16_t g_sample_count = 0;
+
+// Drain cursor - Core 1 only
+static bool g_drain_active = false;
+static uint8_t g_drain_frame = 0;
+static uint8_t g_drain_total_frames = 0;
+static uint32_t g_last_send_ms = 0;
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+void burst_capture_init(int8_t adc_channel, uint16_t sample_rate_hz) {
+    g_channel = adc_channel;
+    g_sample_rate_hz = sample_rate_hz;
+
+    uint32_t window = (uint32_t)sample_rate_hz * BURST_CAPTURE_SECONDS;
+    if (window > BURST_CAPTURE_MAX_SAMPLES) {
+        window = BURST_CAPTURE_MAX_SAMPLES;
+    }
+    g_window_samples = (uint16_t)window;
+
+    if (g_channel < 0) {
+        LOG_PRINT("Burst capture: disabled (no pressure channel)\n");
+    } else {
+        LOG_PRINT("Burst capture: ADC%d, %uHz, %u sample window\n",
+                  g_channel, g_sample_rate_hz, g_window_samples);
+    }
+}
+
+void burst_capture_start(void) {
+    if (g_channel < 0) {
+        return;  // No transducer on this PCB
+    }
+    // A new shot discards any undrained previous capture
+    g_sample_count = 0;
+    __dmb();  // Count reset must be visible before Core 1 sees CAPTURING
+    g_burst_state = BURST_CAPTURING;
+}
+
+void burst_capture_stop(void) {
+    if (g_burst_state == BURST_CAPTURING) {
+        g_burst_state = BURST_DRAINING;
+    }
+}
+
+void burst_capture_push(uint8_t adc_channel, const uint16_t* samples, uint8_t count) {
+    if (g_burst_state != BURST_CAPTURING || (int8_t)adc_channel != g_channel) {
+        return;
+    }
+
+    uint16_t pos = g_sample_count;
+    for (uint8_t i = 0; i < count && pos < g_window_samples; i++) {
+        g_samples[pos++] = samples[i];
+    }
+    g_sample_count = pos;
+    // Window full: keep state CAPTURING (so a late stop() still drains) but
+    // simply stop appending - the transient of interest is at the front
+}
+
+void burst_capture_task(void) {
+    if (g_burst_state != BURST_DRAINING) {
+        g_drain_active = false;
+        return;
+    }
+
+    if (!g_drain_active) {
+        uint16_t total = g_sample_count;
+        if (total == 0) {
+            // Nothing captured (e.g. DMA capture not running) - stand down
+            g_burst_state = BURST_IDLE;
+            return;
+        }
+        g_drain_active = true;
+        g_drain_frame = 0;
+        g_drain_total_frames = (uint8_t)((total + SENSOR_BURST_SAMPLES_PER_FRAME - 1) /
+                                         SENSOR_BURST_SAMPLES_PER_FRAME);
+        g_last_send_ms = 0;  // First frame goes out immediately
+    }
+
+    // Pace the drain so burst frames never crowd out status traffic
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if (g_last_send_ms != 0 && now - g_last_send_ms < BURST_CAPTURE_SEND_MS) {
+        return;
+    }
+
+    uint16_t first = (uint16_t)(g_drain_frame * SENSOR_BURST_SAMPLES_PER_FRAME);
+    uint16_t remaining = (uint16_t)(g_sample_count - first);
+    uint8_t count = remaining > SENSOR_BURST_SAMPLES_PER_FRAME
+                        ? SENSOR_BURST_SAMPLES_PER_FRAME : (uint8_t)remaining;
+
+    sensor_burst_payload_t frame;
+    frame.frame = g_drain_frame;
+    frame.total_frames = g_drain_total_frames;
+    frame.first_sample = first;
+    frame.sample_rate_hz = g_sample_rate_hz;
+    frame.count = count;
+    frame.adc_channel = (uint8_t)g_channel;
+    memcpy(frame.samples, &g_samples[first], count * sizeof(uint16_t));
+
+    if (!protocol_send_sensor_burst(&frame)) {
+        return;  // TX buffer full - retry this frame next pass
+    }
+    g_last_send_ms = now;
+
+    if (++g_drain_frame >= g_drain_total_frames) {
+        LOG_PRINT("Burst capture: %u samples sent in %u frames\n",
+                  g_sample_count, g_drain_total_frames);
+        g_drain_active = false;
+        g_burst_state = BURST_IDLE;
+    }
+}
@@ -46,6 +46,23 @@ static uint32_t g_flash_crc_offset = 0;
 static uint32_t g_flash_crc_running = 0xFFFFFFFF;
 static bool g_flash_crc_in_progress = false;
 
+// Deferred test scheduling: class_b_periodic_test() marks tests pending on
+// their staggered cadence and checks completion deadlines; the actual work
+// runs in class_b_run_slice() during main-loop idle gaps so the control
+// path no longer pays for it.
+static bool g_pending_ram = false;
+static bool g_pending_cpu = false;
+static bool g_pending_io = false;
+static bool g_pending_clock = false;
+static bool g_pending_flash = false;
+
+// Last completion timestamps for the deadline watchdog
+static uint32_t g_ram_done_ms = 0;
+static uint32_t g_cpu_done_ms = 0;
+static uint32_t g_io_done_ms = 0;
+static uint32_t g_clock_done_ms = 0;
+static uint32_t g_flash_done_ms = 0;
+
 // RAM test: Reuses protocol RX buffer instead of dedicated buffer (saves 64 bytes)
 // The March C- test is non-destructive and completes in microseconds, so it's safe
 // to temporarily use the protocol buffer when it's not actively receiving data.
@@ -241,9 +258,11 @@ class_b_result_t class_b_test_ram(void) {
 // =============================================================================
 
 // Chunk size for incremental CRC calculation (to avoid blocking)
-// This is tunable - smaller chunks reduce Flash contention but take more cycles
-// 4KB chunks provide good balance: ~100µs per chunk, completes 256KB in ~60 seconds
-#define FLASH_CRC_CHUNK_SIZE    4096
+// Sized so one chunk fits inside CLASS_B_SLICE_BUDGET_US: the bit-by-bit CRC
+// costs roughly 250-350ns per byte, so 256 bytes is ~65-90µs per chunk.
+// The previous 4KB chunks took over 1ms each and were the traced source of
+// control-loop period outliers.
+#define FLASH_CRC_CHUNK_SIZE    256
 
 // NOTE: Flash CRC accesses Flash (XIP) which may cause contention if Core 0
 // tries to fetch instructions from Flash simultaneously. For maximum real-time
@@ -586,7 +605,21 @@ class_b_result_t class_b_init(void) {
     g_class_b_status.flash_crc_reference = crc ^ 0xFFFFFFFF;
     
     DEBUG_PRINT("CLASS B: Flash CRC reference = 0x%08lX\n", g_class_b_status.flash_crc_reference);
-    
+
+    // Deferred tests count as "just completed" at boot so the completion
+    // deadlines measure from init instead of tripping on the first cycle
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    g_ram_done_ms = now;
+    g_cpu_done_ms = now;
+    g_io_done_ms = now;
+    g_clock_done_ms = now;
+    g_flash_done_ms = now;
+    g_pending_ram = false;
+    g_pending_cpu = false;
+    g_pending_io = false;
+    g_pending_clock = false;
+    g_pending_flash = false;
+
     g_class_b_status.initialized = true;
     g_class_b_status.last_result = CLASS_B_PASS;
     
@@ -655,61 +688,115 @@ class_b_result_t class_b_periodic_test(void) {
     if (!g_class_b_status.initialized) {
         return CLASS_B_NOT_INITIALIZED;
     }
-    
-    class_b_result_t result = CLASS_B_PASS;
-    
+
+    class_b_result_t result;
+
     g_cycle_count++;
-    g_class_b_status.last_test_time_ms = to_ms_since_boot(get_absolute_time());
-    
-    // Stagger tests across cycles to minimize latency impact
-    
-    // RAM test (every 1 second)
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    g_class_b_status.last_test_time_ms = now;
+
+    // Stack test runs inline every cycle - it is a two-word compare, and
+    // an overflow must be caught promptly rather than deferred to idle time
+    result = class_b_test_stack();
+    if (result != CLASS_B_PASS) {
+        return result;
+    }
+
+    // Mark the remaining tests pending on their usual staggered cadence.
+    // The work itself runs in class_b_run_slice() during main-loop idle
+    // gaps, time-budgeted so it cannot delay the control tick.
     if ((g_cycle_count % CLASS_B_RAM_TEST_INTERVAL) == 0) {
+        g_pending_ram = true;
+    }
+    if ((g_cycle_count % CLASS_B_CPU_TEST_INTERVAL) == 5) {
+        g_pending_cpu = true;
+    }
+    if ((g_cycle_count % CLASS_B_IO_TEST_INTERVAL) == 3) {
+        g_pending_io = true;
+    }
+    if ((g_cycle_count % CLASS_B_CLOCK_TEST_INTERVAL) == 0) {
+        g_pending_clock = true;
+    }
+    if ((g_cycle_count % CLASS_B_FLASH_TEST_INTERVAL) == 0) {
+        g_pending_flash = true;
+    }
+
+    // Completion-deadline watchdog: if a deferred test has not completed
+    // within its deadline, the slice scheduler is starved and safety
+    // coverage has silently lapsed - treat it like any other failure
+    if ((now - g_ram_done_ms)   > CLASS_B_FAST_TEST_DEADLINE_MS ||
+        (now - g_cpu_done_ms)   > CLASS_B_FAST_TEST_DEADLINE_MS ||
+        (now - g_io_done_ms)    > CLASS_B_FAST_TEST_DEADLINE_MS ||
+        (now - g_clock_done_ms) > CLASS_B_CLOCK_TEST_DEADLINE_MS ||
+        (now - g_flash_done_ms) > CLASS_B_FLASH_TEST_DEADLINE_MS) {
+        g_class_b_status.fail_count++;
+        g_class_b_status.last_result = CLASS_B_FAIL_DEADLINE;
+        DEBUG_PRINT("CLASS B: Deferred test missed completion deadline!\n");
+        return CLASS_B_FAIL_DEADLINE;
+    }
+
+    return CLASS_B_PASS;
+}
+
+// =============================================================================
+// Idle-Gap Slice Execution
+// =============================================================================
+
+class_b_result_t class_b_run_slice(void) {
+    if (!g_class_b_status.initialized) {
+        return CLASS_B_NOT_INITIALIZED;
+    }
+
+    uint32_t slice_start_us = time_us_32();
+    class_b_result_t result;
+
+    // Run at most one fast test per slice - each is well under the budget,
+    // and one-per-slice keeps the worst-case slice length bounded
+    if (g_pending_ram) {
+        g_pending_ram = false;
         result = class_b_test_ram();
         if (result != CLASS_B_PASS) {
             return result;
         }
-    }
-    
-    // CPU test (every 1 second, offset from RAM)
-    if ((g_cycle_count % CLASS_B_CPU_TEST_INTERVAL) == 5) {
+        g_ram_done_ms = to_ms_since_boot(get_absolute_time());
+    } else if (g_pending_cpu) {
+        g_pending_cpu = false;
         result = class_b_test_cpu_registers();
         if (result != CLASS_B_PASS) {
             return result;
         }
-    }
-    
-    // I/O test (every 1 second, offset)
-    if ((g_cycle_count % CLASS_B_IO_TEST_INTERVAL) == 3) {
+        g_cpu_done_ms = to_ms_since_boot(get_absolute_time());
+    } else if (g_pending_io) {
+        g_pending_io = false;
         result = class_b_test_io();
         if (result != CLASS_B_PASS) {
             return result;
         }
-    }
-    
-    // Stack test (every cycle - very fast)
-    result = class_b_test_stack();
-    if (result != CLASS_B_PASS) {
-        return result;
-    }
-    
-    // Clock test (every 10 seconds)
-    if ((g_cycle_count % CLASS_B_CLOCK_TEST_INTERVAL) == 0) {
+        g_io_done_ms = to_ms_since_boot(get_absolute_time());
+    } else if (g_pending_clock) {
+        g_pending_clock = false;
         result = class_b_test_clock();
         if (result != CLASS_B_PASS) {
             return result;
         }
+        g_clock_done_ms = to_ms_since_boot(get_absolute_time());
     }
-    
-    // Flash CRC (incremental, completes every ~60 seconds)
-    // Run a small chunk each cycle
-    if ((g_cycle_count % 10) == 0) {  // Every second
+
+    // Flash CRC pass: fill whatever budget remains with small chunks
+    while (g_pending_flash &&
+           (time_us_32() - slice_start_us) < CLASS_B_SLICE_BUDGET_US) {
         result = class_b_test_flash();
         if (result != CLASS_B_PASS) {
+            g_pending_flash = false;
             return result;
         }
+        if (!g_flash_crc_in_progress) {
+            // Full pass completed and matched the reference
+            g_pending_flash = false;
+            g_flash_done_ms = to_ms_since_boot(get_absolute_time());
+        }
     }
-    
+
     return CLASS_B_PASS;
 }
 
@@ -733,6 +820,7 @@ const char* class_b_result_string(class_b_result_t result) {
         case CLASS_B_FAIL_CLOCK:        return "Clock frequency error";
         case CLASS_B_FAIL_STACK:        return "Stack overflow detected";
         case CLASS_B_FAIL_PC:           return "Program counter test failed";
+        case CLASS_B_FAIL_DEADLINE:     return "Self-test deadline missed";
         case CLASS_B_NOT_INITIALIZED:   return "Not initialized";
         default:                        return "Unknown error";
     }
@@ -760,7 +848,16 @@ bool class_b_reset(void) {
     
     // Reset failure state
     g_class_b_status.last_result = CLASS_B_PASS;
-    
+
+    // Restart the deferred-test deadlines so a starvation failure does not
+    // immediately re-trip after reset
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    g_ram_done_ms = now;
+    g_cpu_done_ms = now;
+    g_io_done_ms = now;
+    g_clock_done_ms = now;
+    g_flash_done_ms = now;
+
     DEBUG_PRINT("CLASS B: Failure state reset\n");
     return true;
 }
@@ -24,6 +24,8 @@ static cleaning_state_t g_cleaning_state = CLEANING_IDLE;
 static uint16_t g_brew_count = 0;
 static uint16_t g_cleaning_threshold = CLEANING_DEFAULT_THRESHOLD;
 static uint32_t g_cleaning_cycle_start = 0;
+static uint8_t g_cleaning_cycle_index = 0;   // Current backflush cycle (1-based)
+static uint32_t g_phase_deadline = 0;        // Absolute deadline of the current phase (ms)
 static bool g_cleaning_initialized = false;
 
 // Flash wear reduction: track pending saves and last saved value
@@ -143,6 +145,18 @@ bool cleaning_is_reminder_due(void) {
 // Cleaning Cycle
 // =============================================================================
 
+/**
+ * Drive pump and brew solenoid together for the pressure/release phases
+ */
+static void cleaning_set_outputs(bool pressurize) {
+    control_set_pump(pressurize ? 100 : 0);
+
+    const pcb_config_t* pcb = pcb_config_get();
+    if (pcb && pcb->pins.relay_brew_solenoid >= 0) {
+        hw_set_gpio(pcb->pins.relay_brew_solenoid, pressurize);
+    }
+}
+
 bool cleaning_start_cycle(void) {
     // Can't start if already active or in safe state
     if (g_cleaning_state != CLEANING_IDLE) {
@@ -164,19 +178,18 @@ bool cleaning_start_cycle(void) {
         return false;  // Machine must be at operating temperature (STATE_READY)
     }
     
+    uint32_t now = to_ms_since_boot(get_absolute_time());
     g_cleaning_state = CLEANING_ACTIVE;
-    g_cleaning_cycle_start = to_ms_since_boot(get_absolute_time());
-    
-    // Start pump and open brew solenoid (backflush)
-    control_set_pump(100);  // 100% pump power
-    
-    const pcb_config_t* pcb = pcb_config_get();
-    if (pcb && pcb->pins.relay_brew_solenoid >= 0) {
-        hw_set_gpio(pcb->pins.relay_brew_solenoid, true);  // Open solenoid
-    }
-    
-    LOG_PRINT("Cleaning: Cycle started (brew_count=%d)\n", g_brew_count);
-    
+    g_cleaning_cycle_start = now;
+    g_cleaning_cycle_index = 1;
+    g_phase_deadline = now + CLEANING_CYCLE_DURATION_MS;
+
+    // First pressure phase: pump on, brew solenoid open (backflush)
+    cleaning_set_outputs(true);
+
+    LOG_PRINT("Cleaning: Backflush started (cycle 1/%d, brew_count=%d)\n",
+              CLEANING_BACKFLUSH_CYCLES, g_brew_count);
+
     return true;
 }
 
@@ -184,34 +197,59 @@ void cleaning_stop_cycle(void) {
     if (g_cleaning_state == CLEANING_IDLE) {
         return;
     }
-    
-    // Stop pump and close solenoid
-    control_set_pump(0);
-    
-    const pcb_config_t* pcb = pcb_config_get();
-    if (pcb && pcb->pins.relay_brew_solenoid >= 0) {
-        hw_set_gpio(pcb->pins.relay_brew_solenoid, false);  // Close solenoid
-    }
-    
+
+    // Stop pump and close solenoid (aborts the whole program)
+    cleaning_set_outputs(false);
+
     g_cleaning_state = CLEANING_IDLE;
     g_cleaning_cycle_start = 0;
-    
+    g_cleaning_cycle_index = 0;
+
     LOG_PRINT("Cleaning: Cycle stopped\n");
 }
 
 void cleaning_update(void) {
+    if (g_cleaning_state == CLEANING_IDLE) {
+        return;
+    }
+
+    // Deadline-stepped phases, no blocking waits: this runs every Core 0
+    // loop pass, so control_update() and safety checks keep their full rate
+    // mid-cleaning and valve actuations land within one pass of their
+    // deadline. Each new deadline advances from the PREVIOUS deadline (not
+    // from now), so late servicing of one phase boundary cannot accumulate
+    // into drift over the program.
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if ((int32_t)(now - g_phase_deadline) < 0) {
+        return;  // Current phase still running
+    }
+
     if (g_cleaning_state == CLEANING_ACTIVE) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        uint32_t elapsed = now - g_cleaning_cycle_start;
-        
-        // Auto-stop after CLEANING_CYCLE_DURATION_MS (10 seconds)
-        if (elapsed >= CLEANING_CYCLE_DURATION_MS) {
-            cleaning_stop_cycle();
-            DEBUG_PRINT("Cleaning: Cycle auto-stopped after %lu ms\n", elapsed);
+        // Pressure phase done - release: pump off, solenoid closed, the
+        // expansion valve vents the puck pressure back through the group
+        cleaning_set_outputs(false);
+        g_cleaning_state = CLEANING_PAUSED;
+        g_phase_deadline += CLEANING_PAUSE_DURATION_MS;
+        DEBUG_PRINT("Cleaning: Cycle %d/%d release phase\n",
+                    g_cleaning_cycle_index, CLEANING_BACKFLUSH_CYCLES);
+    } else {  // CLEANING_PAUSED
+        if (g_cleaning_cycle_index >= CLEANING_BACKFLUSH_CYCLES) {
+            // Program complete
+            uint32_t elapsed = now - g_cleaning_cycle_start;
+            g_cleaning_state = CLEANING_IDLE;
+            g_cleaning_cycle_start = 0;
+            g_cleaning_cycle_index = 0;
+            LOG_PRINT("Cleaning: Backflush complete (%d cycles, %lu ms)\n",
+                      CLEANING_BACKFLUSH_CYCLES, elapsed);
+        } else {
+            // Next pressure phase
+            g_cleaning_cycle_index++;
+            cleaning_set_outputs(true);
+            g_cleaning_state = CLEANING_ACTIVE;
+            g_phase_deadline += CLEANING_CYCLE_DURATION_MS;
+            DEBUG_PRINT("Cleaning: Cycle %d/%d pressure phase\n",
+                        g_cleaning_cycle_index, CLEANING_BACKFLUSH_CYCLES);
         }
-        
-        // Also stop if brew lever is released (user manual stop)
-        // This is handled in state.c by checking brew switch
     }
 }
 
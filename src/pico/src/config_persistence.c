@@ -2,7 +2,8 @@
  * Pico Firmware - Configuration Persistence Implementation
  * 
  * Saves and loads configuration to/from flash storage using Pico SDK.
- * Uses a reserved flash sector for configuration storage.
+ * Uses a small A/B journal across two reserved flash sectors: each save
+ * appends a new generation, boot picks the newest valid one.
  */
 
 #include "config_persistence.h"
@@ -17,6 +18,7 @@
 #include "hardware/flash.h"
 #include <string.h>
 #include <stddef.h>  // for offsetof
+#include <math.h>    // for isfinite (heat-up lag validation)
 
 // =============================================================================
 // Compile-Time Safety Checks
@@ -36,11 +38,35 @@ _Static_assert(sizeof(persisted_config_t) <= FLASH_PAGE_SIZE,
 // Flash Storage Configuration
 // =============================================================================
 
-// Use last flash sector for configuration (2MB flash = 512 sectors, use sector 511)
-// Each sector is 4KB, we only need ~200 bytes, but must erase entire sector
+// Config journal: the last two flash sectors form a small A/B pool. Each save
+// appends one generation (a page-sized record with a monotonic sequence
+// number) to the active sector; only when that sector fills up is the OTHER
+// sector erased and writing rotates into it. Boot scans both sectors and
+// picks the valid record with the highest sequence. Compared to the old
+// erase-and-rewrite on every save this makes most saves a single page
+// program (~hundreds of microseconds of core pause instead of a multi-ms
+// sector erase punching a hole in control timing) and spreads wear across
+// 32 pages instead of hammering one sector.
+//
+// Slot 1 is the sector configs lived in before the journal existed. A legacy
+// record there reads back with an erased (0xFFFFFFFF) sequence, which the
+// scan treats as generation 0, so old saves migrate transparently.
 // PICO_FLASH_SIZE_BYTES and FLASH_SECTOR_SIZE are defined in hardware/flash.h
-#define CONFIG_FLASH_OFFSET   (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
-#define CONFIG_FLASH_SECTOR   (CONFIG_FLASH_OFFSET / FLASH_SECTOR_SIZE)
+#define CONFIG_JOURNAL_SECTORS    2
+#define CONFIG_POOL_OFFSET        (PICO_FLASH_SIZE_BYTES - CONFIG_JOURNAL_SECTORS * FLASH_SECTOR_SIZE)
+#define CONFIG_SECTOR_OFFSET(s)   (CONFIG_POOL_OFFSET + (uint32_t)(s) * FLASH_SECTOR_SIZE)
+#define CONFIG_RECORDS_PER_SECTOR (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+
+#define CONFIG_SEQ_ERASED         0xFFFFFFFFu  // Sequence bytes of a pre-journal record
+
+// One journal record = one flash page
+typedef struct __attribute__((packed)) {
+    persisted_config_t config;  // Carries its own magic/version/CRC
+    uint32_t sequence;          // Generation counter (CONFIG_SEQ_ERASED = legacy record)
+} config_journal_record_t;
+
+_Static_assert(sizeof(config_journal_record_t) <= FLASH_PAGE_SIZE,
+    "config_journal_record_t exceeds FLASH_PAGE_SIZE - journal assumes one record per page");
 
 // Current configuration in RAM
 static persisted_config_t g_persisted_config = {0};
@@ -48,6 +74,10 @@ static bool g_config_loaded = false;
 static bool g_env_valid = false;
 static volatile bool g_pending_boot_save = false;  // Deferred flash write after Core 1 starts
 
+// Journal write cursor (set by the boot scan, advanced on save)
+static uint8_t g_active_sector = 0;   // Pool slot holding the newest record
+static uint32_t g_journal_seq = 0;    // Sequence of the newest record
+
 // =============================================================================
 // CRC32 Calculation
 // =============================================================================
@@ -122,82 +152,193 @@ static void set_defaults(persisted_config_t* config) {
     // Machine brand/model: Empty by default (user must set via UI)
     memset(config->machine_brand, 0, sizeof(config->machine_brand));
     memset(config->machine_model, 0, sizeof(config->machine_model));
+
+    // Wake schedule: empty until the ESP32 pushes one
+    config->wake_count = 0;
 }
 
 // =============================================================================
 // Flash Operations
 // =============================================================================
 
-static bool flash_read_config(persisted_config_t* config) {
-    if (!config) return false;
-    
-    // Read from flash into RAM buffer
-    // We can't read directly from XIP while executing, so we use a local buffer
-    persisted_config_t flash_config;
-    
-    // Read from flash using flash_read (reads into RAM)
-    // Note: flash_read requires the data to be in a RAM buffer
-    // We'll read directly from XIP address (safe for read-only access)
-    const uint8_t* flash_addr = (const uint8_t*)(XIP_BASE + CONFIG_FLASH_OFFSET);
-    memcpy(&flash_config, flash_addr, sizeof(persisted_config_t));
-    
+/**
+ * XIP address of a journal page (safe for read-only access)
+ */
+static const uint8_t* journal_page_addr(uint8_t sector, uint32_t page) {
+    return (const uint8_t*)(XIP_BASE + CONFIG_SECTOR_OFFSET(sector) + page * FLASH_PAGE_SIZE);
+}
+
+// The v1 layout ended where wake_count now starts: its CRC32 occupied the
+// four bytes at this offset, and its journal sequence the four after that.
+// Used to recognize and migrate v1 records in place (see below).
+#define CONFIG_V1_CRC_OFFSET  offsetof(persisted_config_t, wake_count)
+
+/**
+ * Read and validate one journal record
+ *
+ * Version 1 records (pre wake-schedule) are migrated in place: their CRC is
+ * validated at the v1 offset, the appended wake fields are defaulted, and
+ * the record is reported as current-version. The sequence number is also
+ * re-read from its v1 location so journal ordering survives the upgrade
+ * boot (at the v2 offset a v1 record shows erased bytes, which would demote
+ * every generation to 0).
+ *
+ * @return true if the record carries a valid config (magic, version, CRC)
+ */
+static bool journal_read_record(uint8_t sector, uint32_t page, config_journal_record_t* record) {
+    // Read from flash into RAM buffer (packed struct, XIP is read-only safe)
+    const uint8_t* raw = journal_page_addr(sector, page);
+    memcpy(record, raw, sizeof(config_journal_record_t));
+
     // Validate magic number
-    if (flash_config.magic != CONFIG_MAGIC) {
-        return false;  // No valid config in flash
+    if (record->config.magic != CONFIG_MAGIC) {
+        return false;  // Erased page or garbage
     }
-    
+
     // Validate version
-    if (flash_config.version != CONFIG_VERSION) {
+    if (record->config.version == 1) {
+        // v1 record: CRC covers only the v1 prefix
+        uint32_t stored_crc;
+        memcpy(&stored_crc, raw + CONFIG_V1_CRC_OFFSET, sizeof(stored_crc));
+        if (crc32_calculate((const uint8_t*)&record->config, CONFIG_V1_CRC_OFFSET) != stored_crc) {
+            return false;
+        }
+
+        // Migrate: default the appended fields, restore the v1 sequence
+        record->config.version = CONFIG_VERSION;
+        record->config.wake_count = 0;
+        memset(record->config.wake_reserved, 0, sizeof(record->config.wake_reserved));
+        memset(record->config.wake_schedule, 0, sizeof(record->config.wake_schedule));
+        memcpy(&record->sequence, raw + CONFIG_V1_CRC_OFFSET + sizeof(stored_crc),
+               sizeof(record->sequence));
+        return true;
+    }
+
+    if (record->config.version != CONFIG_VERSION) {
         return false;  // Wrong version
     }
-    
+
     // Calculate CRC32 (excluding CRC field itself)
     size_t crc_size = offsetof(persisted_config_t, crc32);
-    uint32_t calculated_crc = crc32_calculate((const uint8_t*)&flash_config, crc_size);
-    
-    if (calculated_crc != flash_config.crc32) {
-        return false;  // CRC mismatch - data corrupted
+    uint32_t calculated_crc = crc32_calculate((const uint8_t*)&record->config, crc_size);
+
+    return calculated_crc == record->config.crc32;
+}
+
+/**
+ * Find the first fully-erased page in a sector (next append position)
+ * @return page index, or -1 if the sector has no free page
+ */
+static int journal_find_free_page(uint8_t sector) {
+    for (uint32_t page = 0; page < CONFIG_RECORDS_PER_SECTOR; page++) {
+        const uint8_t* addr = journal_page_addr(sector, page);
+        bool erased = true;
+        for (uint32_t i = 0; i < FLASH_PAGE_SIZE; i++) {
+            if (addr[i] != 0xFF) {
+                erased = false;
+                break;
+            }
+        }
+        if (erased) {
+            return (int)page;
+        }
     }
-    
-    // Copy to output
-    *config = flash_config;
+    return -1;
+}
+
+/**
+ * Scan the journal pool for the newest valid config.
+ * Also positions the write cursor (active sector, sequence counter).
+ */
+static bool flash_read_config(persisted_config_t* config) {
+    if (!config) return false;
+
+    config_journal_record_t newest;
+    uint32_t newest_seq = 0;
+    bool found = false;
+
+    for (uint8_t sector = 0; sector < CONFIG_JOURNAL_SECTORS; sector++) {
+        for (uint32_t page = 0; page < CONFIG_RECORDS_PER_SECTOR; page++) {
+            config_journal_record_t record;
+            if (!journal_read_record(sector, page, &record)) {
+                continue;
+            }
+
+            // Pre-journal records have erased sequence bytes - treat as
+            // generation 0 so any journal append supersedes them
+            uint32_t seq = (record.sequence == CONFIG_SEQ_ERASED) ? 0 : record.sequence;
+
+            if (!found || seq > newest_seq) {
+                newest = record;
+                newest_seq = seq;
+                g_active_sector = sector;
+                found = true;
+            }
+        }
+    }
+
+    if (!found) {
+        return false;  // No valid config in the pool
+    }
+
+    g_journal_seq = newest_seq;
+    *config = newest.config;
     return true;
 }
 
 /**
- * Write configuration to flash.
- * 
+ * Append a new config generation to the journal.
+ *
+ * Normally a single page program into the active sector's next free page.
+ * Only when the active sector is full is the other sector erased and writing
+ * rotated into it - the newest record stays intact in the full sector until
+ * the new generation is programmed, so power loss mid-erase cannot lose the
+ * config.
+ *
  * Uses the flash_safe API which handles:
- * - Multicore lockout (pausing Core 0)
+ * - Multicore lockout (pausing Core 1)
  * - Interrupt disabling
  * - Running flash operations from RAM
- * 
+ *
  * Compatible with both RP2040 and RP2350 (Pico 2).
  */
 static bool flash_write_config(const persisted_config_t* config) {
     if (!config) return false;
-    
-    // Calculate CRC32 before saving
-    persisted_config_t config_with_crc = *config;
+
+    // Build the record: config with fresh CRC plus the next sequence number
+    // (flash endurance is exhausted long before the counter could wrap)
+    config_journal_record_t record;
+    record.config = *config;
     size_t crc_size = offsetof(persisted_config_t, crc32);
-    config_with_crc.crc32 = crc32_calculate((const uint8_t*)&config_with_crc, crc_size);
-    
-    // Prepare write buffer (must be page-aligned)
+    record.config.crc32 = crc32_calculate((const uint8_t*)&record.config, crc_size);
+    record.sequence = g_journal_seq + 1;
+
+    int page = journal_find_free_page(g_active_sector);
+    if (page < 0) {
+        // Active sector full - erase the other slot and rotate into it
+        uint8_t other = (uint8_t)(1 - g_active_sector);
+        if (!flash_safe_erase(CONFIG_SECTOR_OFFSET(other), FLASH_SECTOR_SIZE)) {
+            LOG_PRINT("Config: ERROR - Flash erase failed\n");
+            return false;
+        }
+        g_active_sector = other;
+        page = 0;
+    }
+
+    // Prepare write buffer (must be a full page)
     uint8_t write_buffer[FLASH_PAGE_SIZE];
     memset(write_buffer, 0xFF, FLASH_PAGE_SIZE);
-    memcpy(write_buffer, &config_with_crc, sizeof(persisted_config_t));
-    
-    // Use flash_safe API which handles multicore lockout and interrupt safety
-    if (!flash_safe_erase(CONFIG_FLASH_OFFSET, FLASH_SECTOR_SIZE)) {
-        LOG_PRINT("Config: ERROR - Flash erase failed\n");
-        return false;
-    }
-    
-    if (!flash_safe_program(CONFIG_FLASH_OFFSET, write_buffer, FLASH_PAGE_SIZE)) {
+    memcpy(write_buffer, &record, sizeof(config_journal_record_t));
+
+    uint32_t offset = CONFIG_SECTOR_OFFSET(g_active_sector) + (uint32_t)page * FLASH_PAGE_SIZE;
+    if (!flash_safe_program(offset, write_buffer, FLASH_PAGE_SIZE)) {
         LOG_PRINT("Config: ERROR - Flash program failed\n");
         return false;
     }
-    
+
+    g_journal_seq = record.sequence;
+    DEBUG_PRINT("Config: Journal append gen %lu (sector %d, page %d)\n",
+               (unsigned long)record.sequence, g_active_sector, page);
     return true;
 }
 
@@ -531,9 +672,113 @@ void config_persistence_get_eco(bool* enabled, int16_t* brew_temp, uint16_t* tim
     }
 }
 
-// config_persistence_save_power_meter() and config_persistence_get_power_meter() 
+bool config_persistence_save_wake_schedule(uint8_t count,
+                                           const wake_schedule_entry_t* entries) {
+    if (count > WAKE_SCHEDULE_MAX) {
+        return false;
+    }
+
+    // Compare-before-write: Skip flash write if nothing changed
+    // Flash has limited endurance (~100k cycles), avoid unnecessary wear
+    if (g_persisted_config.wake_count == count &&
+        (count == 0 ||
+         memcmp(g_persisted_config.wake_schedule, entries,
+                count * sizeof(wake_schedule_entry_t)) == 0)) {
+        DEBUG_PRINT("Config: Wake schedule unchanged, skipping flash write\n");
+        return true;  // Success - nothing to save
+    }
+
+    // Update wake table in persisted config (unused slots zeroed)
+    g_persisted_config.wake_count = count;
+    memset(g_persisted_config.wake_schedule, 0, sizeof(g_persisted_config.wake_schedule));
+    if (count > 0) {
+        memcpy(g_persisted_config.wake_schedule, entries,
+               count * sizeof(wake_schedule_entry_t));
+    }
+
+    // Ensure magic and version are set
+    g_persisted_config.magic = CONFIG_MAGIC;
+    g_persisted_config.version = CONFIG_VERSION;
+
+    // Save to flash
+    if (flash_write_config(&g_persisted_config)) {
+        g_config_loaded = true;
+        DEBUG_PRINT("Config: Saved wake schedule (%d entries)\n", count);
+        return true;
+    }
+
+    DEBUG_PRINT("Config: Failed to save wake schedule\n");
+    return false;
+}
+
+void config_persistence_get_wake_schedule(uint8_t* count,
+                                          wake_schedule_entry_t* entries) {
+    uint8_t n = g_persisted_config.wake_count;
+    if (n > WAKE_SCHEDULE_MAX) {
+        n = WAKE_SCHEDULE_MAX;  // Corrupt count - clamp rather than overrun
+    }
+    if (count) {
+        *count = n;
+    }
+    if (entries && n > 0) {
+        memcpy(entries, g_persisted_config.wake_schedule,
+               n * sizeof(wake_schedule_entry_t));
+    }
+}
+
+// config_persistence_save_power_meter() and config_persistence_get_power_meter()
 // removed (v2.32 - hardware power metering removed, MQTT only)
 
+bool config_persistence_save_heatup(float brew_lag_s, float steam_lag_s) {
+    // Compare-before-write: Skip flash write if nothing changed
+    // Flash has limited endurance (~100k cycles), avoid unnecessary wear
+    if (g_persisted_config.heatup_brew_lag_s == brew_lag_s &&
+        g_persisted_config.heatup_steam_lag_s == steam_lag_s) {
+        DEBUG_PRINT("Config: Heat-up model unchanged, skipping flash write\n");
+        return true;  // Success - nothing to save
+    }
+
+    // Update heat-up model values in persisted config
+    g_persisted_config.heatup_brew_lag_s = brew_lag_s;
+    g_persisted_config.heatup_steam_lag_s = steam_lag_s;
+
+    // Ensure magic and version are set
+    g_persisted_config.magic = CONFIG_MAGIC;
+    g_persisted_config.version = CONFIG_VERSION;
+
+    // Save to flash
+    if (flash_write_config(&g_persisted_config)) {
+        g_config_loaded = true;
+        DEBUG_PRINT("Config: Saved heat-up model (brew=%.1fs, steam=%.1fs)\n",
+                   brew_lag_s, steam_lag_s);
+        return true;
+    }
+
+    DEBUG_PRINT("Config: Failed to save heat-up model to flash\n");
+    return false;
+}
+
+/**
+ * Validate a persisted lag value - these bytes held power meter settings in
+ * older saves, so anything non-finite or outside the plausible range reads
+ * as 0 (not yet learned)
+ */
+static float validate_heatup_lag(float lag_s) {
+    if (!isfinite(lag_s) || lag_s < HEATUP_LAG_MIN_S || lag_s > HEATUP_LAG_MAX_S) {
+        return 0.0f;
+    }
+    return lag_s;
+}
+
+void config_persistence_get_heatup(float* brew_lag_s, float* steam_lag_s) {
+    if (brew_lag_s) {
+        *brew_lag_s = validate_heatup_lag(g_persisted_config.heatup_brew_lag_s);
+    }
+    if (steam_lag_s) {
+        *steam_lag_s = validate_heatup_lag(g_persisted_config.heatup_steam_lag_s);
+    }
+}
+
 bool config_persistence_save_log_forwarding(bool enabled) {
     // Compare-before-write: Skip flash write if nothing changed
     if (g_persisted_config.log_forwarding_enabled == enabled) {
@@ -26,6 +26,7 @@
 #include "pcb_config.h"
 #include "safety.h"
 #include "state.h"
+#include "config_persistence.h"  // For learned heat-up model lags
 #include <math.h>
 #include <string.h>
 
@@ -84,7 +85,7 @@ typedef struct {
 } ssr_schedule_t;
 
 // Note: These are accessed from both main loop and timer interrupt.
-// Write access is protected by critical sections in set_ssr_schedule().
+// Write access is protected by a critical section in set_ssr_schedules().
 // volatile ensures compiler doesn't cache values in the timer callback.
 static volatile ssr_schedule_t g_brew_schedule = {0};
 static volatile ssr_schedule_t g_steam_schedule = {0};
@@ -93,7 +94,16 @@ static bool g_phase_sync_active = false;
 static uint32_t g_phase_period_start = 0;  // Timestamp of current period start
 
 // Forward declaration for phase sync helper
-static void set_ssr_schedule(uint8_t ssr_id, uint32_t start_ms, uint32_t duration_ms);
+static void set_ssr_schedules(uint32_t brew_start_ms, uint32_t brew_duration_ms,
+                              uint32_t steam_start_ms, uint32_t steam_duration_ms);
+
+// Burst-fire output mode state (see Burst-Fire section below)
+static struct repeating_timer g_burst_timer;
+static bool g_burst_fire_enabled = (SSR_BURST_FIRE_DEFAULT != 0);
+static bool g_burst_fire_running = false;
+static volatile uint8_t g_burst_duty_brew = 0;
+static volatile uint8_t g_burst_duty_steam = 0;
+static void stop_burst_fire(void);
 
 // =============================================================================
 // PID Initialization
@@ -103,6 +113,10 @@ void pid_init(pid_state_t* pid, float setpoint) {
     pid->kp = PID_DEFAULT_KP;
     pid->ki = PID_DEFAULT_KI;
     pid->kd = PID_DEFAULT_KD;
+    pid->eff_kp = pid->kp;
+    pid->eff_ki = pid->ki;
+    pid->eff_kd = pid->kd;
+    pid->regime = PID_REGIME_STEADY;
     pid->setpoint = setpoint;
     pid->setpoint_target = setpoint;
     pid->integral = 0.0f;
@@ -115,6 +129,65 @@ void pid_init(pid_state_t* pid, float setpoint) {
     pid->first_run = true;  // Skip derivative on first call to avoid spike
 }
 
+// =============================================================================
+// PID Gain Scheduling
+// =============================================================================
+// One gain set per boiler cannot cover heat-up, steady-state and the pull
+// back after a shot - the steady-state tuning is visibly sluggish during
+// post-shot recovery. The configured gains stay the steady-state set; the
+// heat-up and recovery sets are derived by the multipliers in config.h and
+// the effective gains blend exponentially toward the active regime's set,
+// so a regime boundary bends the gains over PID_REGIME_BLEND_TAU_S instead
+// of stepping the output. The integral is never reset on a regime change -
+// gain continuity plus term continuity is what makes the handover bumpless.
+
+static bool g_pid_scheduling_enabled = (PID_SCHEDULING_DEFAULT != 0);
+
+static void __not_in_flash_func(pid_schedule_gains)(pid_state_t* pid, float error, float dt) {
+    // Regime detection from setpoint error and temperature slope. The slope
+    // is the filtered measurement derivative the D term already maintains
+    // (negative = falling temperature).
+    uint8_t regime;
+    if (error >= PID_REGIME_HEATUP_ERROR_C) {
+        regime = PID_REGIME_HEATUP;
+    } else if (error >= PID_REGIME_RECOVER_ENTER_C) {
+        regime = PID_REGIME_RECOVERY;
+    } else if (pid->regime == PID_REGIME_STEADY &&
+               error > PID_REGIME_RECOVER_EXIT_C &&
+               pid->last_derivative < -PID_REGIME_RECOVER_SLOPE_C_S) {
+        // A shot's cold slug shows up as a fast falling slope before the
+        // error threshold trips - enter recovery early on the slope signal
+        regime = PID_REGIME_RECOVERY;
+    } else if (pid->regime != PID_REGIME_STEADY &&
+               error > PID_REGIME_RECOVER_EXIT_C) {
+        // Hysteresis: hold an active regime until the error genuinely
+        // closes, so the gains don't chatter at the enter threshold
+        regime = PID_REGIME_RECOVERY;
+    } else {
+        regime = PID_REGIME_STEADY;
+    }
+    pid->regime = regime;
+
+    // Target gain set for the regime (steady-state = the configured gains)
+    float tkp = pid->kp, tki = pid->ki, tkd = pid->kd;
+    if (regime == PID_REGIME_HEATUP) {
+        tkp *= PID_HEATUP_KP_MULT;
+        tki *= PID_HEATUP_KI_MULT;
+        tkd *= PID_HEATUP_KD_MULT;
+    } else if (regime == PID_REGIME_RECOVERY) {
+        tkp *= PID_RECOVER_KP_MULT;
+        tki *= PID_RECOVER_KI_MULT;
+        tkd *= PID_RECOVER_KD_MULT;
+    }
+
+    // Exponential blend toward the target set (same first-order form as the
+    // derivative filter)
+    float alpha = dt / (PID_REGIME_BLEND_TAU_S + dt);
+    pid->eff_kp += alpha * (tkp - pid->eff_kp);
+    pid->eff_ki += alpha * (tki - pid->eff_ki);
+    pid->eff_kd += alpha * (tkd - pid->eff_kd);
+}
+
 // =============================================================================
 // PID Computation with Derivative Filtering
 // =============================================================================
@@ -122,20 +195,14 @@ void pid_init(pid_state_t* pid, float setpoint) {
 // CRITICAL: Execute from SRAM to prevent cache eviction stalls during flash CRC checks
 // This ensures deterministic timing for PID calculations regardless of flash access
 float __not_in_flash_func(pid_compute)(pid_state_t* pid, float process_value, float dt) {
-    // Lock for entire PID computation to prevent race with control_set_pid on Core 1
-    // This protects all state fields: setpoint, integral, last_error, last_measurement,
-    // last_derivative, first_run, output - which could be modified by control_set_pid
-    //
-    // PERFORMANCE NOTE: This is a blocking mutex, but the risk is low because:
-    // 1. control_set_pid() (called by Core 1) is very fast (just variable assignments)
-    // 2. Pico mutex implementation uses fast spinlocks (not OS-level blocking)
-    // 3. PID parameter updates are infrequent (user-initiated, not continuous)
-    //
-    // Alternative approaches (double-buffering PID params) would add complexity
-    // for minimal benefit. This trade-off prioritizes thread safety and code simplicity.
-    control_lock();
-    
-    // Read parameters (protected by lock)
+    // LOCKING: The caller (the control_update() tick) holds the control
+    // mutex across the whole machine update, so brew and steam PIDs compute
+    // from one consistent parameter view - a control_set_pid/setpoint from
+    // Core 1 lands between ticks, never between the two boiler computations.
+    // Taking the mutex here as well would deadlock (pico mutexes are not
+    // recursive).
+
+    // Read parameters (protected by the tick-level lock)
     float kp = pid->kp;
     float ki = pid->ki;
     float kd = pid->kd;
@@ -165,7 +232,16 @@ float __not_in_flash_func(pid_compute)(pid_state_t* pid, float process_value, fl
     }
     
     float error = setpoint - process_value;
-    
+
+    // Gain scheduling: pick the regime from error and slope, then compute
+    // with the blended effective gains instead of the raw configured set
+    if (g_pid_scheduling_enabled) {
+        pid_schedule_gains(pid, error, dt);
+        kp = pid->eff_kp;
+        ki = pid->eff_ki;
+        kd = pid->eff_kd;
+    }
+
     // Proportional
     float p_term = kp * error;
     
@@ -221,12 +297,159 @@ float __not_in_flash_func(pid_compute)(pid_state_t* pid, float process_value, fl
     if (output < PID_OUTPUT_MIN) output = PID_OUTPUT_MIN;
     
     pid->output = output;
-    
-    control_unlock();
-    
+
     return output;
 }
 
+// =============================================================================
+// Predictive Heat-Up
+// =============================================================================
+// From a cold start, plain PID rides to the setpoint with a wound-up integral
+// and the boiler's thermal lag then carries the temperature past it. Instead,
+// model the rise as first order: during the boost phase the heater runs at
+// full demand while the rise rate is tracked, and the heater switches off
+// once (temp + rate * lag) reaches the setpoint. The lag (seconds of rise
+// "in flight" in the element after switch-off) is learned per boiler from
+// the observed coast to peak and persisted, so the cutoff point sharpens
+// over the first few heat-ups. The default lag is deliberately long - a too
+// early cutoff just hands over to PID sooner, a too late one overshoots.
+
+#define HEATUP_MIN_ERROR_C       15.0f   // Boost only engages this far below setpoint
+#define HEATUP_PEAK_MARGIN_C     0.3f    // Drop below peak that ends coast tracking
+#define HEATUP_MIN_RATE_C_S      0.05f   // Below this rise rate a coast teaches nothing
+#define HEATUP_RATE_ALPHA        0.2f    // Smoothing for the rise-rate estimate
+#define HEATUP_LAG_ALPHA         0.3f    // Weight of the newest lag observation
+#define HEATUP_LEARN_TIMEOUT_MS  120000  // Give up waiting for the coast peak after 2 min
+
+typedef struct {
+    float lag_s;            // Learned thermal lag (model parameter)
+    float rate_c_s;         // Filtered rise rate during boost
+    float last_temp;        // Previous measurement for rate estimation
+    float cutoff_temp;      // Temperature at model-predicted switch-off
+    float cutoff_rate;      // Rise rate at switch-off
+    float peak_temp;        // Highest temperature seen while coasting
+    uint32_t cutoff_ms;     // Timestamp of switch-off
+    bool boosting;          // Full-power phase active
+    bool learning;          // Tracking the post-cutoff coast
+    bool have_last;         // last_temp is valid
+} heatup_state_t;
+
+static heatup_state_t g_heatup[2];  // [0] = brew boiler, [1] = steam boiler
+static bool g_heatup_enabled = (HEATUP_PREDICTIVE_DEFAULT != 0);
+
+static void heatup_init(void) {
+    memset(g_heatup, 0, sizeof(g_heatup));
+
+    // Learned lags from flash; 0 = not yet learned, start conservative
+    float brew_lag = 0.0f, steam_lag = 0.0f;
+    config_persistence_get_heatup(&brew_lag, &steam_lag);
+    g_heatup[0].lag_s = (brew_lag > 0.0f) ? brew_lag : HEATUP_LAG_DEFAULT_S;
+    g_heatup[1].lag_s = (steam_lag > 0.0f) ? steam_lag : HEATUP_LAG_DEFAULT_S;
+
+    if (g_heatup_enabled) {
+        DEBUG_PRINT("Control: Predictive heat-up enabled (lag brew=%.1fs steam=%.1fs)\n",
+                   g_heatup[0].lag_s, g_heatup[1].lag_s);
+    }
+}
+
+float heatup_shape_demand(uint8_t target, float temp, float dt, float pid_demand) {
+    if (!g_heatup_enabled || target > 1) {
+        return pid_demand;
+    }
+
+    heatup_state_t* hu = &g_heatup[target];
+    pid_state_t* pid = (target == 0) ? &g_brew_pid : &g_steam_pid;
+
+    // Invalid reading: abandon any boost/coast in progress, let PID (which
+    // also sees the invalid value and outputs 0) handle it
+    if (isnan(temp) || isinf(temp)) {
+        hu->boosting = false;
+        hu->learning = false;
+        hu->have_last = false;
+        return pid_demand;
+    }
+
+    // Track the rise rate (filtered, same first-order form as the PID
+    // derivative filter)
+    if (hu->have_last && dt > 0.0f) {
+        float inst_rate = (temp - hu->last_temp) / dt;
+        hu->rate_c_s += HEATUP_RATE_ALPHA * (inst_rate - hu->rate_c_s);
+    }
+    hu->last_temp = temp;
+    hu->have_last = true;
+
+    float setpoint = pid->setpoint_target;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+
+    if (hu->boosting) {
+        // Model-predicted switch-off: the rise still "in flight" in the
+        // element is rate * lag - cut when that carries us to the setpoint
+        float predicted_coast = hu->rate_c_s * hu->lag_s;
+        if (predicted_coast < 0.0f) predicted_coast = 0.0f;
+
+        if (temp + predicted_coast >= setpoint) {
+            hu->boosting = false;
+            hu->learning = true;
+            hu->cutoff_temp = temp;
+            hu->cutoff_rate = hu->rate_c_s;
+            hu->peak_temp = temp;
+            hu->cutoff_ms = now;
+
+            // The boost ran open loop with a large error - clear the wound-up
+            // integral so PID takes over clean once the coast settles
+            // (control mutex already held by the control_update() tick)
+            pid->integral = 0.0f;
+            pid->first_run = true;
+
+            DEBUG_PRINT("Control: Heat-up[%d] cutoff at %.1fC (rate=%.2fC/s, predicted coast=%.1fC)\n",
+                       target, temp, hu->cutoff_rate, predicted_coast);
+            return 0.0f;
+        }
+        return 100.0f;
+    }
+
+    if (hu->learning) {
+        if (temp > hu->peak_temp) {
+            hu->peak_temp = temp;
+        }
+
+        bool peaked = (temp <= hu->peak_temp - HEATUP_PEAK_MARGIN_C);
+        bool timed_out = (now - hu->cutoff_ms) > HEATUP_LEARN_TIMEOUT_MS;
+
+        if (peaked || timed_out) {
+            hu->learning = false;
+            if (peaked && hu->cutoff_rate > HEATUP_MIN_RATE_C_S) {
+                // Observed lag = coast height / rate at cutoff; fold it into
+                // the model and persist so the next cold start benefits
+                float lag_obs = (hu->peak_temp - hu->cutoff_temp) / hu->cutoff_rate;
+                if (lag_obs < HEATUP_LAG_MIN_S) lag_obs = HEATUP_LAG_MIN_S;
+                if (lag_obs > HEATUP_LAG_MAX_S) lag_obs = HEATUP_LAG_MAX_S;
+                hu->lag_s += HEATUP_LAG_ALPHA * (lag_obs - hu->lag_s);
+                config_persistence_save_heatup(g_heatup[0].lag_s, g_heatup[1].lag_s);
+                LOG_PRINT("Control: Heat-up[%d] learned: coast %.1fC -> lag %.1fs\n",
+                          target, hu->peak_temp - hu->cutoff_temp, hu->lag_s);
+            }
+            return pid_demand;
+        }
+
+        // Hold the heater off while the coast plays out - heating here would
+        // both corrupt the lag observation and overshoot the setpoint
+        return 0.0f;
+    }
+
+    // Engage the boost only on a genuine cold start - small errors are PID
+    // territory (and teach the model nothing)
+    if ((setpoint - temp) >= HEATUP_MIN_ERROR_C) {
+        hu->boosting = true;
+        hu->rate_c_s = 0.0f;
+        DEBUG_PRINT("Control: Heat-up[%d] boost engaged (%.1fC -> %.1fC)\n",
+                   target, temp, setpoint);
+        return 100.0f;
+    }
+
+    return pid_demand;
+}
+
 // =============================================================================
 // Heating Strategy Implementation (Dual Boiler Only)
 // =============================================================================
@@ -339,9 +562,9 @@ static void strategy_smart_stagger(
         steam_start = 0;  // Wrap to beginning - creates controlled overlap
     }
     
-    // Set schedules for phase-synchronized control
-    set_ssr_schedule(0, brew_start, brew_time_ms);      // Brew SSR
-    set_ssr_schedule(1, steam_start, steam_time_ms);     // Steam SSR
+    // Publish both schedules atomically - the timer ISR must never run a
+    // new brew window against the previous steam window
+    set_ssr_schedules(brew_start, brew_time_ms, steam_start, steam_time_ms);
     
     // Return duty values for reporting (but actual control uses phase sync)
     *brew_duty = brew_duty_pct;
@@ -504,41 +727,185 @@ static void stop_phase_sync(void) {
     DEBUG_PRINT("Control: Phase sync timer stopped\n");
 }
 
-/**
- * Set SSR schedule for phase-synchronized control
- * 
- * CRITICAL: This function is called from the main loop, but the schedule
- * is read from a timer interrupt (phase_sync_timer_callback). We use
- * critical sections to ensure atomic updates of the schedule struct.
- */
-static void set_ssr_schedule(uint8_t ssr_id, uint32_t start_ms, uint32_t duration_ms) {
-    // Validate and clamp inputs
+// Clamp a schedule into the phase-sync period (helper for set_ssr_schedules)
+static void write_ssr_schedule(volatile ssr_schedule_t* schedule,
+                               uint32_t start_ms, uint32_t duration_ms) {
     if (start_ms >= PHASE_SYNC_PERIOD_MS) {
         start_ms = start_ms % PHASE_SYNC_PERIOD_MS;
     }
     if (duration_ms > PHASE_SYNC_PERIOD_MS) {
         duration_ms = PHASE_SYNC_PERIOD_MS;
     }
-    
-    // Calculate active flag
-    bool active = (duration_ms > 0);
-    
-    // Critical section: Disable interrupts while updating shared state
-    // This prevents the timer interrupt from reading a partially-updated schedule
-    uint32_t irq_state = save_and_disable_interrupts();
-    
-    // Update the volatile schedule struct field by field
-    volatile ssr_schedule_t* schedule = (ssr_id == 0) ? &g_brew_schedule : &g_steam_schedule;
     schedule->start_ms = start_ms;
     schedule->duration_ms = duration_ms;
-    schedule->active = active;
-    
+    schedule->active = (duration_ms > 0);
+}
+
+/**
+ * Set both SSR schedules for phase-synchronized control
+ *
+ * CRITICAL: Called from the control loop, but the schedules are read from a
+ * timer interrupt (phase_sync_timer_callback). Both schedules are published
+ * under ONE critical section: the stagger math computes the steam window
+ * relative to the brew window, so if the 10ms timer fired between two
+ * separate updates it could run a new brew schedule against the previous
+ * steam schedule - overlapping windows the stagger was meant to prevent.
+ */
+static void set_ssr_schedules(uint32_t brew_start_ms, uint32_t brew_duration_ms,
+                              uint32_t steam_start_ms, uint32_t steam_duration_ms) {
+    // Critical section: Disable interrupts while updating shared state
+    // This prevents the timer interrupt from reading a partially-updated
+    // schedule or a mixed old/new pair
+    uint32_t irq_state = save_and_disable_interrupts();
+
+    write_ssr_schedule(&g_brew_schedule, brew_start_ms, brew_duration_ms);
+    write_ssr_schedule(&g_steam_schedule, steam_start_ms, steam_duration_ms);
+
     // Reset period start when schedules change to ensure clean phase alignment
     g_phase_period_start = to_ms_since_boot(get_absolute_time());
-    
+
     restore_interrupts(irq_state);
 }
 
+// =============================================================================
+// Burst-Fire Output Mode (half-cycle distribution)
+// =============================================================================
+// Alternative to the 25Hz hardware PWM: duty is quantized into mains
+// half-cycles and spread evenly with a Bresenham accumulator, instead of one
+// contiguous ON block per 40ms PWM period. The zero-crossing SSRs align
+// every fired half-cycle to the mains zero cross themselves, so no ZC input
+// is needed - the timer only decides WHICH half-cycles fire and spaces them
+// evenly, which removes the slow thermal ripple the long ON/OFF blocks
+// produce. Each pulse is a whole half-cycle, so the SSR_MIN_DUTY_PERCENT
+// floor of the PWM path does not apply here.
+//
+// The 10ms tick matches the half-cycle at 50Hz mains (the assumption already
+// baked into SSR_MIN_DUTY_PERCENT, see config.h). At 60Hz the SSR still
+// fires whole half-cycles; the distribution just beats slightly against the
+// 8.33ms half-cycle, which is harmless at these thermal time constants.
+#define BURST_FIRE_TICK_MS 10
+
+/**
+ * Timer callback: one tick per mains half-cycle.
+ * Bresenham accumulators fire a half-cycle each time the running duty sum
+ * crosses 100, spreading pulses evenly across any window length. The steam
+ * accumulator starts half a quantum out of phase so the two heaters
+ * interleave rather than fire coincident half-cycles when duty allows.
+ */
+static bool burst_fire_timer_callback(struct repeating_timer *t) {
+    (void)t;  // Unused
+
+    const pcb_config_t* pcb = pcb_config_get();
+    if (!pcb) return true;
+
+    static uint16_t acc_brew = 0;
+    static uint16_t acc_steam = 50;
+
+    if (pcb->pins.ssr_brew >= 0) {
+        acc_brew += g_burst_duty_brew;
+        bool fire = (acc_brew >= 100);
+        if (fire) acc_brew -= 100;
+        hw_set_gpio((uint8_t)pcb->pins.ssr_brew, fire);
+    }
+
+    if (pcb->pins.ssr_steam >= 0) {
+        acc_steam += g_burst_duty_steam;
+        bool fire = (acc_steam >= 100);
+        if (fire) acc_steam -= 100;
+        hw_set_gpio((uint8_t)pcb->pins.ssr_steam, fire);
+    }
+
+    return true;  // Continue repeating
+}
+
+/**
+ * Start burst-fire timer and take the SSR pins over from hardware PWM
+ */
+static bool start_burst_fire(void) {
+    if (g_burst_fire_running) {
+        return true;  // Already active
+    }
+
+    // Disable hardware PWM for SSRs (we'll control GPIO directly)
+    const pcb_config_t* pcb = pcb_config_get();
+    if (pcb) {
+        if (pcb->pins.ssr_brew >= 0 && g_pwm_slice_brew != 0xFF) {
+            hw_pwm_set_enabled(g_pwm_slice_brew, false);
+            hw_gpio_init_output((uint8_t)pcb->pins.ssr_brew, false);
+        }
+        if (pcb->pins.ssr_steam >= 0 && g_pwm_slice_steam != 0xFF) {
+            hw_pwm_set_enabled(g_pwm_slice_steam, false);
+            hw_gpio_init_output((uint8_t)pcb->pins.ssr_steam, false);
+        }
+    }
+
+    g_burst_duty_brew = 0;
+    g_burst_duty_steam = 0;
+
+    if (add_repeating_timer_ms(-BURST_FIRE_TICK_MS, burst_fire_timer_callback,
+                               NULL, &g_burst_timer)) {
+        g_burst_fire_running = true;
+        DEBUG_PRINT("Control: Burst-fire timer started\n");
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Stop burst-fire timer and restore hardware PWM on the SSR pins
+ */
+static void stop_burst_fire(void) {
+    if (!g_burst_fire_running) {
+        return;
+    }
+
+    cancel_repeating_timer(&g_burst_timer);
+    g_burst_fire_running = false;
+    g_burst_duty_brew = 0;
+    g_burst_duty_steam = 0;
+
+    // Turn off SSRs and restore PWM function
+    const pcb_config_t* pcb = pcb_config_get();
+    if (pcb) {
+        if (pcb->pins.ssr_brew >= 0) {
+            hw_set_gpio((uint8_t)pcb->pins.ssr_brew, false);
+            gpio_set_function((uint)pcb->pins.ssr_brew, GPIO_FUNC_PWM);
+            if (g_pwm_slice_brew != 0xFF) {
+                hw_pwm_set_enabled(g_pwm_slice_brew, true);
+            }
+        }
+        if (pcb->pins.ssr_steam >= 0) {
+            hw_set_gpio((uint8_t)pcb->pins.ssr_steam, false);
+            gpio_set_function((uint)pcb->pins.ssr_steam, GPIO_FUNC_PWM);
+            if (g_pwm_slice_steam != 0xFF) {
+                hw_pwm_set_enabled(g_pwm_slice_steam, true);
+            }
+        }
+    }
+
+    DEBUG_PRINT("Control: Burst-fire timer stopped\n");
+}
+
+void control_set_burst_fire(bool enable) {
+    if (g_burst_fire_enabled == enable) {
+        return;
+    }
+
+    g_burst_fire_enabled = enable;
+    if (!enable) {
+        stop_burst_fire();
+    }
+    // When enabling, the timer starts on the next apply_hardware_outputs()
+    // so the PWM handover happens in the control loop, not mid-packet
+
+    LOG_PRINT("Control: Burst-fire output mode %s\n", enable ? "enabled" : "disabled");
+}
+
+bool control_get_burst_fire(void) {
+    return g_burst_fire_enabled;
+}
+
 // =============================================================================
 // Hardware Output Control
 // =============================================================================
@@ -579,10 +946,12 @@ void apply_hardware_outputs(uint8_t brew_heater, uint8_t steam_heater, uint8_t p
     // For HEAT_SMART_STAGGER, phase sync timer handles SSR control
     // Schedules are set in apply_heating_strategy()
     if (g_heating_strategy == HEAT_SMART_STAGGER) {
+        if (g_burst_fire_running) {
+            stop_burst_fire();  // Stagger phase sync owns the SSR pins
+        }
         if (brew_heater == 0 && steam_heater == 0) {
             // Safe/IDLE: clear schedules so timer stops toggling; drive SSRs off
-            set_ssr_schedule(0, 0, 0);
-            set_ssr_schedule(1, 0, 0);
+            set_ssr_schedules(0, 0, 0, 0);
             if (pcb->pins.ssr_brew >= 0) hw_set_gpio((uint8_t)pcb->pins.ssr_brew, false);
             if (pcb->pins.ssr_steam >= 0) hw_set_gpio((uint8_t)pcb->pins.ssr_steam, false);
         } else {
@@ -591,17 +960,37 @@ void apply_hardware_outputs(uint8_t brew_heater, uint8_t steam_heater, uint8_t p
                 start_phase_sync();
             }
         }
+    } else if (g_burst_fire_enabled) {
+        // Burst-fire mode: timer distributes half-cycles, we just publish duty
+        if (g_phase_sync_active) {
+            stop_phase_sync();
+        }
+        if (!g_burst_fire_running && !start_burst_fire()) {
+            // Timer slot unavailable - fall back to hardware PWM this tick
+            if (g_pwm_slice_brew != 0xFF && pcb->pins.ssr_brew >= 0) {
+                hw_set_pwm_duty(g_pwm_slice_brew, (float)brew_heater);
+            }
+            if (g_pwm_slice_steam != 0xFF && pcb->pins.ssr_steam >= 0) {
+                hw_set_pwm_duty(g_pwm_slice_steam, (float)steam_heater);
+            }
+        } else {
+            g_burst_duty_brew = (brew_heater > 100) ? 100 : brew_heater;
+            g_burst_duty_steam = (steam_heater > 100) ? 100 : steam_heater;
+        }
     } else {
         // Other strategies use hardware PWM
         if (g_phase_sync_active) {
             stop_phase_sync();
         }
-        
+        if (g_burst_fire_running) {
+            stop_burst_fire();
+        }
+
         // Apply SSR outputs via hardware PWM
         if (g_pwm_slice_brew != 0xFF && pcb->pins.ssr_brew >= 0) {
             hw_set_pwm_duty(g_pwm_slice_brew, (float)brew_heater);
         }
-        
+
         if (g_pwm_slice_steam != 0xFF && pcb->pins.ssr_steam >= 0) {
             hw_set_pwm_duty(g_pwm_slice_steam, (float)steam_heater);
         }
@@ -620,6 +1009,30 @@ uint16_t estimate_power_watts(uint8_t brew_duty, uint8_t steam_duty) {
     return brew_watts + steam_watts;
 }
 
+// =============================================================================
+// Per-Boiler Energy Accounting
+// =============================================================================
+// Integrates SSR duty x configured element wattage every control tick - a
+// zero-hardware energy estimate per boiler. Accumulated in millijoules: at
+// the 100ms tick, duty% x watts x 0.1s works out to exactly duty * watts mJ,
+// so the per-tick cost is one multiply-add in integer math. Streamed in the
+// status payload as Wh since boot; the ESP32 folds it into statistics and
+// can cross-validate an external meter where one is present.
+
+static uint64_t g_brew_energy_mj = 0;
+static uint64_t g_steam_energy_mj = 0;
+
+static inline void accumulate_energy(uint8_t brew_duty, uint8_t steam_duty) {
+    const machine_electrical_t* elec = machine_get_electrical();
+    g_brew_energy_mj += (uint64_t)brew_duty * elec->brew_heater_power;
+    g_steam_energy_mj += (uint64_t)steam_duty * elec->steam_heater_power;
+}
+
+uint32_t control_get_energy_wh(uint8_t target) {
+    uint64_t mj = (target == 0) ? g_brew_energy_mj : g_steam_energy_mj;
+    return (uint32_t)(mj / 3600000ULL);  // 1 Wh = 3.6e6 mJ
+}
+
 // =============================================================================
 // Public API: Initialization
 // =============================================================================
@@ -632,7 +1045,10 @@ void control_init(void) {
     // Initialize PIDs with default values
     pid_init(&g_brew_pid, TEMP_DECI_TO_C(DEFAULT_BREW_TEMP));
     pid_init(&g_steam_pid, TEMP_DECI_TO_C(DEFAULT_STEAM_TEMP));
-    
+
+    // Load learned heat-up model (predictive heat-up)
+    heatup_init();
+
     // Initialize hardware
     init_hardware_outputs();
     
@@ -681,10 +1097,20 @@ void __not_in_flash_func(control_update)(void) {
     // Machine-specific control logic
     float brew_duty = 0.0f;
     float steam_duty = 0.0f;
-    
+
+    // Hold the control mutex across the whole machine update: both boiler
+    // PIDs, heat-up shaping and the heating strategy then see one coherent
+    // parameter view per tick. Previously each pid_compute() locked
+    // individually, so a Core 1 setpoint/tuning write could land between
+    // the brew and steam computations - visible as tiny steam-temp
+    // disturbances during brew PID transients on dual boilers. Core 1
+    // setters are all sub-microsecond, so holding the mutex for the full
+    // (bounded, allocation-free) update does not add meaningful latency.
+    control_lock();
     control_update_machine(mode, brew_temp, steam_temp, group_temp, dt,
                           &brew_duty, &steam_duty);
-    
+    control_unlock();
+
     // Store and apply outputs
     g_outputs.brew_heater = (uint8_t)brew_duty;
     g_outputs.steam_heater = (uint8_t)steam_duty;
@@ -695,6 +1121,10 @@ void __not_in_flash_func(control_update)(void) {
     
     // Power estimation (hardware metering removed v2.32 - MQTT only)
     g_outputs.power_watts = estimate_power_watts(g_outputs.brew_heater, g_outputs.steam_heater);
+
+    // Per-boiler energy accounting (the early safe-state/idle returns skip
+    // this, but both heaters are off there - nothing to accumulate)
+    accumulate_energy(g_outputs.brew_heater, g_outputs.steam_heater);
 }
 
 // =============================================================================
@@ -742,6 +1172,12 @@ void control_set_pid(uint8_t target, float kp, float ki, float kd) {
     pid->kp = kp;
     pid->ki = ki;
     pid->kd = kd;
+    // New tuning replaces the whole schedule - snap the effective gains to
+    // the new steady-state set rather than blending from the old tuning
+    pid->eff_kp = kp;
+    pid->eff_ki = ki;
+    pid->eff_kd = kd;
+    pid->regime = PID_REGIME_STEADY;
     pid->integral = 0.0f;
     pid->last_error = 0.0f;
     pid->last_measurement = 0.0f;
@@ -762,6 +1198,11 @@ void control_get_pid(uint8_t target, float* kp, float* ki, float* kd) {
     *kd = pid->kd;
 }
 
+uint8_t control_get_pid_regime(uint8_t target) {
+    pid_state_t* pid = (target == 0) ? &g_brew_pid : &g_steam_pid;
+    return pid->regime;
+}
+
 // =============================================================================
 // Public API: Output Control
 // =============================================================================
@@ -44,7 +44,12 @@ void control_update_machine(
 ) {
     (void)mode;        // Dual boiler doesn't change behavior based on mode
     (void)group_temp;  // Not used in dual boiler control
-    
+
+    // Both temperatures come from the same seqlock snapshot taken at the top
+    // of the tick, and the caller holds the control mutex for this whole
+    // update - brew and steam PIDs therefore compute from one coherent view,
+    // and a Core 1 setpoint/tuning write can never land between them.
+
     // Safety: Handle invalid sensor readings
     float brew_demand = 0.0f;
     float steam_demand = 0.0f;
@@ -52,10 +57,12 @@ void control_update_machine(
     // Only compute PID if temperature is valid
     if (!isnan(brew_temp) && !isinf(brew_temp)) {
         brew_demand = pid_compute(&g_brew_pid, brew_temp, dt);
+        brew_demand = heatup_shape_demand(0, brew_temp, dt, brew_demand);
     }
-    
+
     if (!isnan(steam_temp) && !isinf(steam_temp)) {
         steam_demand = pid_compute(&g_steam_pid, steam_temp, dt);
+        steam_demand = heatup_shape_demand(1, steam_temp, dt, steam_demand);
     }
     
     // Apply heating strategy
@@ -129,6 +129,7 @@ void control_update_machine(
             // PID based on steam boiler temperature
             if (!isnan(steam_temp) && !isinf(steam_temp)) {
                 demand = pid_compute(&g_steam_pid, steam_temp, dt);
+                demand = heatup_shape_demand(1, steam_temp, dt, demand);
             }
             break;
             
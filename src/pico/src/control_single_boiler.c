@@ -130,6 +130,7 @@ void control_update_machine(
     float demand = 0.0f;
     if (!isnan(brew_temp) && !isinf(brew_temp)) {
         demand = pid_compute(&g_brew_pid, brew_temp, dt);
+        demand = heatup_shape_demand(0, brew_temp, dt, demand);
     }
     
     // Single boiler uses brew SSR only
@@ -8,6 +8,7 @@
 #include "pico/stdlib.h"
 #include "hardware/watchdog.h"
 #include "hardware/clocks.h"
+#include "hardware/irq.h"
 #include "diagnostics.h"
 #include "config.h"
 #include "hardware.h"
@@ -29,6 +30,18 @@
 static bool g_running = false;
 static uint32_t g_start_time = 0;
 
+// WEIGHT_STOP edge capture (armed once at boot - see
+// diagnostics_weight_stop_capture_init). The IRQ timestamps every rising
+// edge on the stop line; the latency test compares the newest edge against
+// the arrival time of the ESP32's loopback command.
+#define WEIGHT_STOP_EDGE_FRESH_US  (1000 * 1000)  // Edges older than this are from an earlier assertion
+
+static int8_t g_weight_stop_pin = -1;
+static volatile uint32_t g_weight_stop_edge_us = 0;
+static volatile uint32_t g_weight_stop_edge_count = 0;
+static uint32_t g_weight_stop_cmd_us = 0;
+static bool g_weight_stop_cmd_seen = false;
+
 // =============================================================================
 // Helper Functions
 // =============================================================================
@@ -73,6 +86,43 @@ void diagnostics_abort(void) {
     LOG_PRINT("Diagnostics: Aborted\n");
 }
 
+/**
+ * Rising-edge handler for the WEIGHT_STOP input
+ *
+ * Raw handler, not the shared gpio callback - that one belongs to the flow
+ * meter (flow_meter.c). The SDK masks raw-handled pins out of the default
+ * callback dispatch, so the two coexist on IO_IRQ_BANK0.
+ */
+static void __isr weight_stop_edge_irq(void) {
+    uint32_t events = gpio_get_irq_event_mask((uint)g_weight_stop_pin);
+    if (events & GPIO_IRQ_EDGE_RISE) {
+        gpio_acknowledge_irq((uint)g_weight_stop_pin, GPIO_IRQ_EDGE_RISE);
+        g_weight_stop_edge_us = time_us_32();
+        g_weight_stop_edge_count++;
+    }
+}
+
+void diagnostics_weight_stop_capture_init(void) {
+    const pcb_config_t* pcb = pcb_config_get();
+    if (!pcb || !PIN_VALID(pcb->pins.input_weight_stop)) {
+        return;
+    }
+    g_weight_stop_pin = pcb->pins.input_weight_stop;
+
+    // Pin is already a pulled-down input (see gpio_init.c)
+    gpio_add_raw_irq_handler((uint)g_weight_stop_pin, weight_stop_edge_irq);
+    gpio_set_irq_enabled((uint)g_weight_stop_pin, GPIO_IRQ_EDGE_RISE, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+
+    LOG_PRINT("Diagnostics: WEIGHT_STOP edge capture on GPIO%d\n",
+              g_weight_stop_pin);
+}
+
+void diagnostics_note_weight_stop_cmd(void) {
+    g_weight_stop_cmd_us = time_us_32();
+    g_weight_stop_cmd_seen = true;
+}
+
 // =============================================================================
 // Run All Tests
 // =============================================================================
@@ -109,6 +159,8 @@ bool diagnostics_run_all(diag_report_t* report) {
         { DIAG_TEST_BUZZER, diag_test_buzzer },
         { DIAG_TEST_LED, diag_test_led },
         { DIAG_TEST_WEIGHT_STOP_INPUT, diag_test_weight_stop_input },
+        // DIAG_TEST_WEIGHT_STOP_LATENCY (0x14) excluded: needs the ESP32
+        // loopback pulse, which triggers it individually at boot
     };
     
     const int num_tests = sizeof(tests) / sizeof(tests[0]);
@@ -195,6 +247,9 @@ uint8_t diagnostics_run_test(uint8_t test_id, diag_result_t* result) {
         case DIAG_TEST_WEIGHT_STOP_INPUT:
             diag_test_weight_stop_input(result);
             break;
+        case DIAG_TEST_WEIGHT_STOP_LATENCY:
+            diag_test_weight_stop_latency(result);
+            break;
         // Class B Safety Tests
         case DIAG_TEST_CLASS_B_ALL:
             diag_test_class_b_all(result);
@@ -758,6 +813,69 @@ uint8_t diag_test_weight_stop_input(diag_result_t* result) {
     return result->status;
 }
 
+uint8_t diag_test_weight_stop_latency(diag_result_t* result) {
+    init_result(result, DIAG_TEST_WEIGHT_STOP_LATENCY);
+
+    if (g_weight_stop_pin < 0) {
+        set_result(result, DIAG_STATUS_SKIP, "Not configured");
+        return result->status;
+    }
+    if (!g_weight_stop_cmd_seen) {
+        // Test was run without the ESP32 loopback pulse (e.g. from run-all)
+        set_result(result, DIAG_STATUS_SKIP, "No loopback command");
+        return result->status;
+    }
+
+    // The ESP32 raises WEIGHT_STOP and THEN sends this command, so the edge
+    // should already be captured by the time we run. If the newest edge is
+    // missing or predates this run's pulse, give it a brief grace window -
+    // it may still be in flight (IRQ latency, line settling).
+    uint32_t count_before = g_weight_stop_edge_count;
+    int32_t margin_us = (int32_t)(g_weight_stop_cmd_us - g_weight_stop_edge_us);
+
+    if (count_before == 0 || margin_us > WEIGHT_STOP_EDGE_FRESH_US) {
+        uint32_t deadline = time_us_32() + 100 * 1000;
+        while (g_weight_stop_edge_count == count_before &&
+               (int32_t)(deadline - time_us_32()) > 0) {
+            sleep_ms(1);
+        }
+        if (g_weight_stop_edge_count == count_before) {
+            set_result(result, DIAG_STATUS_FAIL, "No edge captured (check wiring)");
+            result->raw_value = -1;
+            g_weight_stop_cmd_seen = false;
+            return result->status;
+        }
+        margin_us = (int32_t)(g_weight_stop_cmd_us - g_weight_stop_edge_us);
+    }
+
+    // raw_value is the margin by which the hardware stop path beat the UART
+    // command path, clamped to the int16 wire field (>32ms saturates)
+    int32_t clamped = margin_us;
+    if (clamped > 32767) clamped = 32767;
+    if (clamped < -32768) clamped = -32768;
+    result->raw_value = (int16_t)clamped;
+    result->expected_min = 0;
+    result->expected_max = 32767;
+
+    char msg[sizeof(result->message)];
+    if (margin_us >= 0) {
+        snprintf(msg, sizeof(msg), "GPIO led command by %ld us", (long)margin_us);
+        set_result(result, DIAG_STATUS_PASS, msg);
+        DEBUG_PRINT("WEIGHT_STOP latency (GPIO%d): PASS - edge led command by %ld us\n",
+                    g_weight_stop_pin, (long)margin_us);
+    } else {
+        // The command overtook the GPIO edge - the "fast" stop path is not
+        // actually faster than the message path. Wiring or shifter problem.
+        snprintf(msg, sizeof(msg), "GPIO trailed command by %ld us", (long)-margin_us);
+        set_result(result, DIAG_STATUS_WARN, msg);
+        DEBUG_PRINT("WEIGHT_STOP latency (GPIO%d): WARN - edge trailed command by %ld us\n",
+                    g_weight_stop_pin, (long)-margin_us);
+    }
+
+    g_weight_stop_cmd_seen = false;  // One measurement per loopback command
+    return result->status;
+}
+
 // =============================================================================
 // Class B Safety Test Implementations (IEC 60730/60335 Annex R)
 // =============================================================================
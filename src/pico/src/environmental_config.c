@@ -1,10 +1,20 @@
 /**
  * Pico Firmware - Environmental Configuration Implementation
- * 
+ *
  * Manages environmental electrical configuration and runtime electrical state.
+ *
+ * Writes arrive on Core 1 (MSG_CMD_CONFIG packet handler, e.g. a seasonal
+ * mains-voltage recalibration pushed from the ESP32) while Core 0 reads the
+ * electrical state inside every control tick for current limiting. The
+ * config and its derived state publish through a seqlock (same idiom as the
+ * sensor mailbox in sensors.c): the writer stages the new values in locals,
+ * then swaps both structs between an odd/even sequence bump, so a control
+ * tick either sees the old calibration or the new one - never a torn mix -
+ * and a recalibration needs no reboot or heating interruption.
  */
 
 #include "environmental_config.h"
+#include "pico/stdlib.h"
 
 // Current electrical state (computed from machine + environment)
 static electrical_state_t g_electrical_state = {0};
@@ -12,23 +22,27 @@ static electrical_state_t g_electrical_state = {0};
 // Current environmental config (can be set at compile-time or runtime)
 static environmental_electrical_t g_environmental_config = ENVIRONMENTAL_ELECTRICAL_CONFIG;
 
+// Seqlock guarding both structs above (odd = write in progress). Bumped
+// twice per environmental_config_set(), so generation = seq / 2.
+static volatile uint32_t g_env_seq = 0;
+
 // =============================================================================
 // Initialization
 // =============================================================================
 
-void electrical_state_init(electrical_state_t* state, 
+void electrical_state_init(electrical_state_t* state,
                           const machine_electrical_t* machine,
                           const environmental_electrical_t* env) {
     if (!state || !machine || !env) return;
-    
+
     // Copy machine specs
     state->brew_heater_power = machine->brew_heater_power;
     state->steam_heater_power = machine->steam_heater_power;
-    
+
     // Copy environmental config
     state->nominal_voltage = env->nominal_voltage;
     state->max_current_draw = env->max_current_draw;
-    
+
     // Calculate currents
     if (env->nominal_voltage > 0) {
         state->brew_heater_current = (float)machine->brew_heater_power / env->nominal_voltage;
@@ -37,21 +51,30 @@ void electrical_state_init(electrical_state_t* state,
         state->brew_heater_current = 0;
         state->steam_heater_current = 0;
     }
-    
+
     // Calculate max combined current with 5% safety margin
     state->max_combined_current = env->max_current_draw * 0.95f;
 }
 
 void electrical_state_get(electrical_state_t* state) {
-    if (state) {
-        // Initialize from current configs if not already initialized
-        if (g_electrical_state.nominal_voltage == 0) {
-            electrical_state_init(&g_electrical_state, 
-                                 machine_get_electrical(),
-                                 &g_environmental_config);
-        }
-        *state = g_electrical_state;
+    if (!state) return;
+
+    // Initialize from current configs if not already initialized
+    if (g_electrical_state.nominal_voltage == 0) {
+        electrical_state_init(&g_electrical_state,
+                             machine_get_electrical(),
+                             &g_environmental_config);
     }
+
+    // Seqlock read: retry if a Core 1 recalibration overlapped the copy
+    uint32_t seq_before, seq_after;
+    do {
+        seq_before = g_env_seq;
+        __dmb();
+        *state = g_electrical_state;
+        __dmb();
+        seq_after = g_env_seq;
+    } while ((seq_before & 1u) || seq_before != seq_after);
 }
 
 // =============================================================================
@@ -59,18 +82,38 @@ void electrical_state_get(electrical_state_t* state) {
 // =============================================================================
 
 void environmental_config_set(const environmental_electrical_t* config) {
-    if (config) {
-        g_environmental_config = *config;
-        // Recalculate electrical state
-        electrical_state_init(&g_electrical_state,
-                             machine_get_electrical(),
-                             &g_environmental_config);
-    }
+    if (!config) return;
+
+    // Stage the derived state first so the publish window is just two
+    // struct copies, not a recalculation
+    electrical_state_t staged;
+    electrical_state_init(&staged, machine_get_electrical(), config);
+
+    // Seqlock write (odd = in progress): Core 0 control ticks retry
+    // around this window instead of reading a half-swapped calibration
+    g_env_seq++;
+    __dmb();
+    g_environmental_config = *config;
+    g_electrical_state = staged;
+    __dmb();
+    g_env_seq++;
 }
 
 void environmental_config_get(environmental_electrical_t* config) {
-    if (config) {
+    if (!config) return;
+
+    uint32_t seq_before, seq_after;
+    do {
+        seq_before = g_env_seq;
+        __dmb();
         *config = g_environmental_config;
-    }
+        __dmb();
+        seq_after = g_env_seq;
+    } while ((seq_before & 1u) || seq_before != seq_after);
 }
 
+uint32_t environmental_config_generation(void) {
+    // Each set() bumps the seqlock twice; expose the stable half so
+    // diagnostics can confirm a pushed recalibration was adopted
+    return g_env_seq / 2;
+}
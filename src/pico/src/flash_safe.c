@@ -30,6 +30,11 @@
 
 static bool g_flash_safe_initialized = false;
 
+// Lockout-based operations completed (either core). The control-loop jitter
+// tracker on Core 0 compares this across ticks to attribute lateness to a
+// flash pause - these are the only operations that freeze both cores.
+static volatile uint32_t g_flash_op_count = 0;
+
 // Default timeout for flash_safe_execute (10 seconds should be plenty)
 #define FLASH_SAFE_TIMEOUT_MS 10000
 
@@ -102,11 +107,12 @@ bool flash_safe_erase(uint32_t offset, size_t size) {
     // and re-enables them after. This prevents ISRs from crashing if they execute
     // from flash during a write operation.
     int result = flash_safe_execute(do_flash_erase, &op, FLASH_SAFE_TIMEOUT_MS);
+    g_flash_op_count++;
     if (result != PICO_OK) {
         LOG_PRINT("Flash: ERROR - Erase failed (error %d)\n", result);
         return false;
     }
-    
+
     return true;
 }
 
@@ -149,14 +155,19 @@ bool flash_safe_program(uint32_t offset, const uint8_t* data, size_t size) {
     // and re-enables them after. This prevents ISRs from crashing if they execute
     // from flash during a write operation.
     int result = flash_safe_execute(do_flash_program, &op, FLASH_SAFE_TIMEOUT_MS);
+    g_flash_op_count++;
     if (result != PICO_OK) {
         DEBUG_PRINT("Flash safety: Program failed (error %d)\n", result);
         return false;
     }
-    
+
     return true;
 }
 
+uint32_t flash_safe_op_count(void) {
+    return g_flash_op_count;
+}
+
 // =============================================================================
 // Bootloader-specific Flash Functions (NO multicore lockout)
 // =============================================================================
@@ -0,0 +1,141 @@
+/**
+ * Pico Firmware - Flow Meter Pulse Capture
+ *
+ * Edge-interrupt capture with microsecond timestamping for the flow meter
+ * pulse input. The IRQ handler only stores a timestamp, the inter-pulse
+ * period and a count - the rate conversion happens in the getter, so the
+ * per-pulse cost is a few dozen cycles and nothing polls the pin.
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"      // For save_and_disable_interrupts
+#include "flow_meter.h"
+#include "config.h"
+#include "hardware.h"
+#include "pcb_config.h"
+
+// =============================================================================
+// Private State
+// =============================================================================
+
+static int8_t g_flow_pin = -1;          // -1 = no flow meter on this PCB
+
+// Written only from the IRQ handler, read from the main loop with IRQs
+// briefly disabled so period/timestamp/count are seen coherently
+static volatile uint32_t g_pulse_count = 0;
+static volatile uint32_t g_last_pulse_us = 0;
+static volatile uint32_t g_last_period_us = 0;
+
+// =============================================================================
+// Interrupt Handler
+// =============================================================================
+
+/**
+ * Falling-edge handler for the flow pulse pin
+ *
+ * Registered via gpio_set_irq_enabled_with_callback, which installs a
+ * single shared callback for all GPIO IRQs on this core - filter by pin
+ * in case another module registers edges later.
+ */
+static void flow_pulse_irq(uint gpio, uint32_t events) {
+    if ((int8_t)gpio != g_flow_pin || !(events & GPIO_IRQ_EDGE_FALL)) {
+        return;
+    }
+
+    uint32_t now_us = time_us_32();
+    uint32_t period = now_us - g_last_pulse_us;
+
+    // Glitch filter: edges faster than any physically possible flow are
+    // switching noise from the pump/SSRs coupling into the pulse line
+    if (g_pulse_count > 0 && period < FLOW_METER_MIN_PERIOD_US) {
+        return;
+    }
+
+    g_last_pulse_us = now_us;
+    g_last_period_us = period;
+    g_pulse_count++;
+}
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void flow_meter_init(void) {
+    const pcb_config_t* pcb = pcb_config_get();
+    if (!pcb || !PIN_VALID(pcb->pins.input_flow_pulse)) {
+        DEBUG_PRINT("Flow: No flow meter pin configured\n");
+        return;
+    }
+
+    g_flow_pin = pcb->pins.input_flow_pulse;
+    g_pulse_count = 0;
+    g_last_pulse_us = 0;
+    g_last_period_us = 0;
+
+    if (hw_is_simulation_mode()) {
+        DEBUG_PRINT("Flow: Simulation mode - edge capture not attached\n");
+        return;
+    }
+
+    // Pin is already a pulled-up input (see gpio_init.c) - meters with
+    // open-collector outputs pull it low once per rotor revolution
+    gpio_set_irq_enabled_with_callback((uint)g_flow_pin, GPIO_IRQ_EDGE_FALL,
+                                       true, &flow_pulse_irq);
+
+    LOG_PRINT("Flow: Pulse capture on GPIO%d (%d pulses/L)\n",
+              g_flow_pin, FLOW_METER_PULSES_PER_LITER);
+}
+
+// =============================================================================
+// Getters
+// =============================================================================
+
+bool flow_meter_is_available(void) {
+    return g_flow_pin >= 0;
+}
+
+uint16_t flow_meter_get_rate_ml_min(void) {
+    if (g_flow_pin < 0) {
+        return 0;
+    }
+
+    // Snapshot IRQ-written state coherently
+    uint32_t irq_state = save_and_disable_interrupts();
+    uint32_t count = g_pulse_count;
+    uint32_t last_pulse_us = g_last_pulse_us;
+    uint32_t period_us = g_last_period_us;
+    restore_interrupts(irq_state);
+
+    // Need two pulses for a period
+    if (count < 2 || period_us == 0) {
+        return 0;
+    }
+
+    // If the gap since the last pulse exceeds the measured period, flow is
+    // slowing - use the gap instead so the estimate decays instead of
+    // holding the last (now stale) rate
+    uint32_t elapsed_us = time_us_32() - last_pulse_us;
+    if (elapsed_us > (uint32_t)FLOW_METER_TIMEOUT_MS * 1000u) {
+        return 0;
+    }
+    if (elapsed_us > period_us) {
+        period_us = elapsed_us;
+    }
+
+    // ml/min = (60e6 us/min / period_us) pulses/min * (1000 ml/L / pulses/L)
+    uint64_t rate = 60000000ull * 1000ull /
+                    ((uint64_t)period_us * FLOW_METER_PULSES_PER_LITER);
+    return (rate > UINT16_MAX) ? UINT16_MAX : (uint16_t)rate;
+}
+
+uint32_t flow_meter_get_pulse_count(void) {
+    return g_pulse_count;
+}
+
+void flow_meter_reset_count(void) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    g_pulse_count = 0;
+    restore_interrupts(irq_state);
+}
@@ -7,6 +7,7 @@
 #include "gpio_init.h"
 #include "pcb_config.h"
 #include "config.h"
+#include "hardware.h"
 #include "hardware/gpio.h"
 #include "hardware/adc.h"
 #include "hardware/spi.h"
@@ -228,14 +229,32 @@ void gpio_init_outputs(void) {
     INIT_OUTPUT(pins->relay_water_led, 0);
     INIT_OUTPUT(pins->relay_fill_solenoid, 0);
     INIT_OUTPUT(pins->relay_spare, 0);
-    
+
     // User interface
     INIT_OUTPUT(pins->led_status, 0);
     INIT_OUTPUT(pins->buzzer, 0);
-    
+
+    // Route the actuation relays through the batched output image: control
+    // code writes the shadow, one commit per main loop pass applies all
+    // transitions simultaneously (see hw_gpio_out_commit). LED and buzzer
+    // stay direct - they are driven from IRQ timer callbacks in safe state.
+    #define CLAIM_OUTPUT(pin) \
+        do { \
+            if (PIN_VALID(pin)) { \
+                hw_gpio_out_claim((uint8_t)(pin)); \
+            } \
+        } while (0)
+
+    CLAIM_OUTPUT(pins->relay_pump);
+    CLAIM_OUTPUT(pins->relay_brew_solenoid);
+    CLAIM_OUTPUT(pins->relay_water_led);
+    CLAIM_OUTPUT(pins->relay_fill_solenoid);
+    CLAIM_OUTPUT(pins->relay_spare);
+
     // Note: ESP32 control pins (RUN and BOOTSEL) are hardware pins, not GPIO
     // They are controlled by ESP32 via J15 pins 5 and 6, not initialized here
-    
+
+    #undef CLAIM_OUTPUT
     #undef INIT_OUTPUT
 }
 
@@ -16,6 +16,8 @@
 
 // Pico SDK includes
 #include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 #include "hardware/spi.h"
 #include "hardware/pwm.h"
 #include "hardware/gpio.h"
@@ -33,6 +35,15 @@ static uint16_t g_sim_adc[HW_ADC_CHANNEL_COUNT] = {0};
 static uint32_t g_sim_max31855 = 0;
 static bool g_sim_gpio[32] = {0};  // 32 GPIO pins max
 
+// Output image state. The shadow is written with atomic or/and so Core 1
+// paths (diagnostics relay tests via packet handlers) can post output
+// requests without racing the Core 0 writers; the commit itself only runs
+// on Core 0. Interlock is written by the safety module (Core 0 only).
+static volatile uint32_t g_out_claimed = 0;    // Pins routed through the image
+static volatile uint32_t g_out_shadow = 0;     // Pending output image
+static uint32_t g_out_applied = 0;             // Last committed image
+static volatile uint32_t g_out_interlock = 0;  // Pins forced low at commit
+
 // Hardware state
 static uint8_t g_pwm_slice_brew = 0xFF;  // Invalid slice number
 static uint8_t g_pwm_slice_steam = 0xFF;
@@ -49,6 +60,20 @@ static float g_pwm_duty[MAX_PWM_SLICES] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0
 // Simulation mode duty tracking
 static float g_sim_pwm_duty[MAX_PWM_SLICES] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
 
+// ADC DMA capture state
+// The ADC free-runs in round-robin mode and DMA drains the FIFO into a ring
+// buffer. The completion IRQ restarts every block from the first enabled
+// channel, so ring slot i always holds channel g_adc_rr_order[i % count] -
+// readers recover per-channel samples by position, no tags needed.
+#define ADC_DMA_SAMPLES_PER_CHANNEL 64
+static uint16_t g_adc_dma_ring[ADC_DMA_SAMPLES_PER_CHANNEL * HW_ADC_CHANNEL_COUNT];
+static volatile bool g_adc_dma_active = false;
+static int g_adc_dma_chan = -1;
+static uint8_t g_adc_rr_order[HW_ADC_CHANNEL_COUNT];  // Enabled channels, lowest first
+static uint8_t g_adc_rr_count = 0;
+static uint8_t g_adc_rr_slot[HW_ADC_CHANNEL_COUNT];   // Channel -> slot, 0xFF = not captured
+static uint16_t g_adc_dma_block = 0;                  // Ring size in samples
+
 // =============================================================================
 // Initialization
 // =============================================================================
@@ -103,31 +128,174 @@ bool hw_is_simulation_mode(void) {
 // ADC Implementation
 // =============================================================================
 
+static void __isr adc_dma_irq_handler(void) {
+    if (!dma_channel_get_irq0_status(g_adc_dma_chan)) {
+        return;  // Not our channel
+    }
+    dma_channel_acknowledge_irq0(g_adc_dma_chan);
+
+    // Restart the block with a clean phase: stop the ADC, drop any samples
+    // that accumulated during IRQ latency, and resume the round robin from
+    // the first enabled channel. This keeps the slot->channel mapping exact
+    // instead of letting FIFO backlog rotate it over time.
+    adc_run(false);
+    adc_fifo_drain();
+    adc_select_input(g_adc_rr_order[0]);
+    dma_channel_set_write_addr(g_adc_dma_chan, g_adc_dma_ring, true);
+    adc_run(true);
+}
+
+bool hw_adc_dma_start(uint32_t channel_mask, uint32_t per_channel_hz) {
+    if (!g_initialized) {
+        hw_init();
+    }
+
+    if (g_simulation_mode || g_adc_dma_active || per_channel_hz == 0) {
+        return false;
+    }
+
+    // Build the round-robin order (hardware scans enabled channels lowest
+    // first) and the reverse channel->slot map used by the readers
+    g_adc_rr_count = 0;
+    for (uint8_t ch = 0; ch < HW_ADC_CHANNEL_COUNT; ch++) {
+        g_adc_rr_slot[ch] = 0xFF;
+        if (channel_mask & (1u << ch)) {
+            adc_gpio_init(26 + ch);
+            g_adc_rr_slot[ch] = g_adc_rr_count;
+            g_adc_rr_order[g_adc_rr_count++] = ch;
+        }
+    }
+    if (g_adc_rr_count == 0) {
+        return false;
+    }
+    g_adc_dma_block = (uint16_t)(g_adc_rr_count * ADC_DMA_SAMPLES_PER_CHANNEL);
+
+    int chan = dma_claim_unused_channel(false);
+    if (chan < 0) {
+        LOG_WARN("Hardware: No free DMA channel for ADC, staying polled\n");
+        return false;
+    }
+    g_adc_dma_chan = chan;
+
+    // Pace conversions so each channel sees per_channel_hz samples. The ADC
+    // runs from a 48MHz clock and needs 96 cycles per conversion; the divider
+    // is clamped to that floor and to the 16-bit hardware maximum.
+    float clkdiv = 48000000.0f / ((float)per_channel_hz * (float)g_adc_rr_count);
+    if (clkdiv < 96.0f) clkdiv = 96.0f;
+    if (clkdiv > 65535.0f) clkdiv = 65535.0f;
+    adc_set_clkdiv(clkdiv - 1.0f);
+
+    adc_set_round_robin(channel_mask);
+    adc_select_input(g_adc_rr_order[0]);
+    adc_fifo_setup(true,    // Write conversions to the FIFO
+                   true,    // Assert DREQ for DMA
+                   1,       // DREQ at 1 sample
+                   false,   // No error bit in samples
+                   false);  // Keep full 12-bit samples
+    adc_fifo_drain();
+
+    // 16-bit transfers from the FIFO into the ring, paced by the ADC DREQ.
+    // 16-bit aligned writes are atomic, so readers on the other core never
+    // see a torn sample.
+    dma_channel_config cfg = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_dreq(&cfg, DREQ_ADC);
+    dma_channel_configure(chan, &cfg, g_adc_dma_ring, &adc_hw->fifo,
+                          g_adc_dma_block, false);
+
+    // Completion IRQ re-arms the ring with a phase resync
+    dma_channel_set_irq0_enabled(chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, adc_dma_irq_handler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    dma_channel_start(chan);
+    adc_run(true);
+    g_adc_dma_active = true;
+
+    LOG_PRINT("Hardware: ADC DMA capture started (%u channels, %luHz each, ring %u samples)\n",
+              (unsigned)g_adc_rr_count, (unsigned long)per_channel_hz,
+              (unsigned)g_adc_dma_block);
+    return true;
+}
+
+bool hw_adc_dma_is_active(void) {
+    return g_adc_dma_active;
+}
+
+/**
+ * Ring index the DMA will write next (derived from the live write address)
+ */
+static uint16_t adc_dma_write_index(void) {
+    uintptr_t write_addr = (uintptr_t)dma_channel_hw_addr(g_adc_dma_chan)->write_addr;
+    uint32_t idx = (uint32_t)(write_addr - (uintptr_t)g_adc_dma_ring) / sizeof(uint16_t);
+    return (uint16_t)(idx % g_adc_dma_block);
+}
+
+uint8_t hw_adc_read_burst(uint8_t channel, uint16_t* samples, uint8_t max_samples) {
+    if (!samples || max_samples == 0 || channel >= HW_ADC_CHANNEL_COUNT) {
+        return 0;
+    }
+    if (!g_adc_dma_active || g_adc_rr_slot[channel] == 0xFF) {
+        return 0;
+    }
+
+    uint8_t slot = g_adc_rr_slot[channel];
+    uint16_t write_idx = adc_dma_write_index();
+
+    // Walk backwards from the write position collecting this channel's slots,
+    // newest first. Older entries can be concurrently overwritten by the next
+    // block, but an overwritten slot still holds a valid recent conversion -
+    // a stale-vs-fresh race, never a torn value.
+    uint8_t count = 0;
+    for (uint16_t back = 1; back <= g_adc_dma_block && count < max_samples; back++) {
+        uint16_t idx = (uint16_t)((write_idx + g_adc_dma_block - back) % g_adc_dma_block);
+        if ((idx % g_adc_rr_count) == slot) {
+            samples[count++] = g_adc_dma_ring[idx];
+        }
+    }
+    return count;
+}
+
 uint16_t hw_read_adc(uint8_t channel) {
     if (!g_initialized) {
         hw_init();
     }
-    
+
     if (channel >= HW_ADC_CHANNEL_COUNT) {
         DEBUG_PRINT("Hardware: Invalid ADC channel %d\n", channel);
         return 0;
     }
-    
+
     if (g_simulation_mode) {
         return g_sim_adc[channel];
     }
-    
+
+    // DMA capture active: serve the newest already-captured sample instead of
+    // blocking on a conversion
+    if (g_adc_dma_active && g_adc_rr_slot[channel] != 0xFF) {
+        uint16_t latest;
+        if (hw_adc_read_burst(channel, &latest, 1) == 1) {
+            return latest;
+        }
+    }
+
     // Real hardware: Read ADC
     // ADC channels map to GPIO: 26=0, 27=1, 28=2, 29=3
+    // Note: a polled read of a channel outside the DMA capture set disturbs
+    // the round-robin phase for at most one block - the completion IRQ
+    // resyncs it. Channels in the capture set never reach this path.
     uint8_t gpio_pin = 26 + channel;
-    
+
     // Select ADC input
     adc_gpio_init(gpio_pin);
     adc_select_input(channel);
-    
+
     // Read ADC (12-bit, 0-4095)
     uint16_t value = adc_read();
-    
+
     return value;
 }
 
@@ -445,31 +613,118 @@ bool hw_gpio_init_input(uint8_t pin, bool pull_up, bool pull_down) {
 }
 
 void hw_set_gpio(uint8_t pin, bool state) {
+    // Claimed pins: write the shadow image, actuation happens at commit
+    uint32_t bit = 1u << pin;
+    if (g_out_claimed & bit) {
+        if (state) {
+            __atomic_or_fetch(&g_out_shadow, bit, __ATOMIC_RELAXED);
+        } else {
+            __atomic_and_fetch(&g_out_shadow, ~bit, __ATOMIC_RELAXED);
+        }
+        return;
+    }
+
     if (g_simulation_mode) {
         g_sim_gpio[pin] = state;
         return;
     }
-    
+
     gpio_put(pin, state);
 }
 
 bool hw_read_gpio(uint8_t pin) {
+    // Claimed pins: read-your-write against the pending image, so control
+    // code sees its own requests even before the commit applies them
+    uint32_t bit = 1u << pin;
+    if (g_out_claimed & bit) {
+        return (g_out_shadow & bit) != 0;
+    }
+
     if (g_simulation_mode) {
         return g_sim_gpio[pin];
     }
-    
+
     return gpio_get(pin);
 }
 
 void hw_toggle_gpio(uint8_t pin) {
+    uint32_t bit = 1u << pin;
+    if (g_out_claimed & bit) {
+        __atomic_xor_fetch(&g_out_shadow, bit, __ATOMIC_RELAXED);
+        return;
+    }
+
     if (g_simulation_mode) {
         g_sim_gpio[pin] = !g_sim_gpio[pin];
         return;
     }
-    
+
     gpio_put(pin, !gpio_get(pin));
 }
 
+void hw_gpio_out_claim(uint8_t pin) {
+    if (pin >= 32) {
+        return;
+    }
+
+    // Seed shadow and applied from the pin's current level so claiming
+    // doesn't glitch an already-initialized output
+    uint32_t bit = 1u << pin;
+    bool level = g_simulation_mode ? g_sim_gpio[pin] : gpio_get(pin);
+    if (level) {
+        __atomic_or_fetch(&g_out_shadow, bit, __ATOMIC_RELAXED);
+        g_out_applied |= bit;
+    } else {
+        __atomic_and_fetch(&g_out_shadow, ~bit, __ATOMIC_RELAXED);
+        g_out_applied &= ~bit;
+    }
+    __atomic_or_fetch(&g_out_claimed, bit, __ATOMIC_RELAXED);
+}
+
+void hw_gpio_out_commit(void) {
+    uint32_t target = (g_out_shadow & ~g_out_interlock) & g_out_claimed;
+    uint32_t diff = target ^ (g_out_applied & g_out_claimed);
+    if (diff == 0) {
+        return;  // Nothing changed since the last commit
+    }
+
+    uint32_t set_mask = diff & target;
+    uint32_t clr_mask = diff & ~target;
+
+    if (g_simulation_mode) {
+        for (uint8_t pin = 0; pin < 32; pin++) {
+            uint32_t bit = 1u << pin;
+            if (set_mask & bit) g_sim_gpio[pin] = true;
+            if (clr_mask & bit) g_sim_gpio[pin] = false;
+        }
+    } else {
+        // One set and one clear register write - all rising edges land in
+        // the same cycle, all falling edges in the next
+        if (set_mask) sio_hw->gpio_set = set_mask;
+        if (clr_mask) sio_hw->gpio_clr = clr_mask;
+    }
+
+    g_out_applied = (g_out_applied & ~diff) | target;
+}
+
+void hw_gpio_out_interlock(uint32_t force_low_mask) {
+    g_out_interlock = force_low_mask;
+
+    // Apply immediately - safety must not wait for the next loop commit
+    if (force_low_mask) {
+        if (g_simulation_mode) {
+            for (uint8_t pin = 0; pin < 32; pin++) {
+                if (force_low_mask & (1u << pin)) {
+                    g_sim_gpio[pin] = false;
+                }
+            }
+        } else {
+            sio_hw->gpio_clr = force_low_mask;
+        }
+        g_out_applied &= ~force_low_mask;
+    }
+}
+
 // =============================================================================
 // Simulation Helpers
 // =============================================================================
@@ -21,6 +21,7 @@
 // =============================================================================
 
 static bool g_enabled = false;
+static uint8_t g_forward_level = LOG_FWD_INFO;  // Max severity shipped over UART (set by ESP32)
 static bool g_initialized = false;
 static bool g_pending_flash_write = false;
 static bool g_pending_flash_value = false;
@@ -78,11 +79,29 @@ bool log_forward_is_enabled(void) {
     return g_enabled;
 }
 
+void log_forward_set_level(uint8_t level) {
+    if (level > LOG_FWD_DEBUG) {
+        level = LOG_FWD_DEBUG;
+    }
+    g_forward_level = level;
+}
+
+uint8_t log_forward_get_level(void) {
+    return g_forward_level;
+}
+
 void log_forward_send(uint8_t level, const char* message) {
     if (!g_enabled || !g_initialized || !message) {
         return;
     }
-    
+
+    // Severity filter at the source: debug spam must not consume UART
+    // bandwidth it shares with control traffic (the ESP32 used to filter
+    // after the bytes were already on the wire)
+    if (level > g_forward_level) {
+        return;
+    }
+
     // Rate limiting: Don't send logs too frequently to prevent protocol flooding
     uint32_t now = to_ms_since_boot(get_absolute_time());
     if (now - g_last_send_time < LOG_SEND_MIN_INTERVAL_MS) {
@@ -109,13 +128,42 @@ void log_forward_sendf(uint8_t level, const char* format, ...) {
     log_forward_send(level, buffer);
 }
 
+void log_forward_send_compact(uint8_t level, uint16_t id, uint8_t argc, const int32_t* args) {
+    if (!g_enabled || !g_initialized) {
+        return;
+    }
+
+    // Same source-side severity filter as log_forward_send()
+    if (level > g_forward_level) {
+        return;
+    }
+
+    // No rate limiting (matches log_forward_send) and no formatting - the
+    // whole point of the compact path is that the hot call site never
+    // touches vsnprintf. MSG_LOG_COMPACT is excluded from ACK tracking
+    // like MSG_LOG.
+    protocol_send_log_compact(level, id, argc, args);
+}
+
 void log_forward_handle_command(const uint8_t* payload, uint8_t length) {
     if (!payload || length < 1) {
         return;
     }
     
     bool enabled = payload[0] != 0;
-    
+
+    // Optional second byte carries the forward level threshold. Apply it
+    // before enabling so no over-threshold message slips out in between.
+    // Older ESP32 builds send a 1-byte payload - keep the current level.
+    if (length >= 2) {
+        log_forward_set_level(payload[1]);
+        // Keep local emission in step: a pushed DEBUG level is a diagnostics
+        // session, so those messages must clear the level filter at the
+        // LOG_DEBUG call sites to exist at all; pushing INFO restores the
+        // default and silences the spam where it's generated.
+        logging_set_level((log_level_t)log_forward_get_level());
+    }
+
     // Update both the log_forward state and the logging system's forwarding flag
     // We call logging_set_forward_enabled() which will:
     // 1. Set g_forward_enabled in logging.c
@@ -9,6 +9,7 @@
 
 #include "logging.h"
 #include "log_forward.h"
+#include "log_catalog.h"
 #include "pico/sync.h"  // For critical sections
 #include <stdio.h>
 #include <string.h>
@@ -31,6 +32,29 @@ typedef struct {
 static log_ring_buffer_t g_log_buffer = {0};
 static bool g_use_ring_buffer = true;  // Enable ring buffer by default
 
+// =============================================================================
+// Compact Record Ring (catalog logging)
+// =============================================================================
+// log_message_id() call sites queue (id, args) records here instead of
+// formatted text - no vsnprintf on the hot path. Records are expanded from
+// the shared log_catalog.h table at drain time in logging_process_pending().
+// Separate from the byte-stream ring above because that one is not
+// message-framed; fixed-size records keep the critical section to a memcpy.
+
+#define LOG_COMPACT_RING_RECORDS 24
+
+typedef struct {
+    uint16_t id;                        // Catalog id (log_catalog_id_t)
+    uint8_t level;                      // log_level_t
+    uint8_t argc;                       // Valid entries in args[]
+    int32_t args[LOG_COMPACT_MAX_ARGS];
+} log_compact_record_t;
+
+static log_compact_record_t g_compact_ring[LOG_COMPACT_RING_RECORDS];
+static volatile uint32_t g_compact_write = 0;  // Next write slot
+static volatile uint32_t g_compact_read = 0;   // Next read slot
+static volatile uint32_t g_compact_count = 0;  // Records queued
+
 // =============================================================================
 // Private State
 // =============================================================================
@@ -159,6 +183,20 @@ static size_t log_buffer_read(char* dest, size_t max_len) {
 // Logging Functions
 // =============================================================================
 
+/**
+ * Map a log_level_t to the log_forward wire level
+ */
+static uint8_t log_fwd_level(log_level_t level) {
+    switch (level) {
+        case LOG_LEVEL_ERROR: return LOG_FWD_ERROR;
+        case LOG_LEVEL_WARN:  return LOG_FWD_WARN;
+        case LOG_LEVEL_INFO:  return LOG_FWD_INFO;
+        case LOG_LEVEL_DEBUG: return LOG_FWD_DEBUG;
+        case LOG_LEVEL_TRACE: return LOG_FWD_DEBUG;
+        default:              return LOG_FWD_INFO;
+    }
+}
+
 void log_message_va(log_level_t level, const char* format, va_list args) {
     if (!g_initialized) {
         logging_init();
@@ -189,17 +227,8 @@ void log_message_va(log_level_t level, const char* format, va_list args) {
         // the ring buffer ensures we don't block the control loop
         // Check both flags: g_forward_enabled (logging system) and log_forward_is_enabled() (persisted state)
         if (g_forward_enabled && log_forward_is_enabled()) {
-            // Map log level to log_forward level
-            uint8_t fwd_level = LOG_FWD_INFO;
-            switch (level) {
-                case LOG_LEVEL_ERROR: fwd_level = LOG_FWD_ERROR; break;
-                case LOG_LEVEL_WARN:  fwd_level = LOG_FWD_WARN;  break;
-                case LOG_LEVEL_INFO:  fwd_level = LOG_FWD_INFO;  break;
-                case LOG_LEVEL_DEBUG: fwd_level = LOG_FWD_DEBUG; break;
-                case LOG_LEVEL_TRACE: fwd_level = LOG_FWD_DEBUG; break;
-            }
             // Forward the log message to ESP32
-            log_forward_send(fwd_level, buffer);
+            log_forward_send(log_fwd_level(level), buffer);
         }
     } else {
         // Direct printf (may block if USB buffer is full - not recommended for Core 0)
@@ -208,16 +237,7 @@ void log_message_va(log_level_t level, const char* format, va_list args) {
         
         // Forward to ESP32 if enabled
         if (g_forward_enabled && log_forward_is_enabled()) {
-            // Map log level to log_forward level
-            uint8_t fwd_level = LOG_FWD_INFO;
-            switch (level) {
-                case LOG_LEVEL_ERROR: fwd_level = LOG_FWD_ERROR; break;
-                case LOG_LEVEL_WARN:  fwd_level = LOG_FWD_WARN;  break;
-                case LOG_LEVEL_INFO:  fwd_level = LOG_FWD_INFO;  break;
-                case LOG_LEVEL_DEBUG: fwd_level = LOG_FWD_DEBUG; break;
-                case LOG_LEVEL_TRACE: fwd_level = LOG_FWD_DEBUG; break;
-            }
-            log_forward_send(fwd_level, buffer);
+            log_forward_send(log_fwd_level(level), buffer);
         }
     }
 }
@@ -229,6 +249,50 @@ void log_message(log_level_t level, const char* format, ...) {
     va_end(args);
 }
 
+void log_message_id(log_level_t level, uint16_t id, uint8_t argc, ...) {
+    if (!g_initialized) {
+        logging_init();
+    }
+
+    // Filter by level
+    if (level > g_log_level) {
+        return;
+    }
+
+    if (argc > LOG_COMPACT_MAX_ARGS) {
+        argc = LOG_COMPACT_MAX_ARGS;
+    }
+
+    // Pack the record - arguments are promoted to int in varargs, so read
+    // them as int and widen; this is the entire per-call formatting cost
+    log_compact_record_t rec;
+    rec.id = id;
+    rec.level = (uint8_t)level;
+    rec.argc = argc;
+    va_list args;
+    va_start(args, argc);
+    for (uint8_t i = 0; i < LOG_COMPACT_MAX_ARGS; i++) {
+        rec.args[i] = (i < argc) ? (int32_t)va_arg(args, int) : 0;
+    }
+    va_end(args);
+
+    // Queue for local output (expanded in logging_process_pending()) -
+    // drop the record if the ring is full, same policy as the text ring
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (g_compact_count < LOG_COMPACT_RING_RECORDS) {
+        g_compact_ring[g_compact_write] = rec;
+        g_compact_write = (g_compact_write + 1) % LOG_COMPACT_RING_RECORDS;
+        g_compact_count++;
+    }
+    restore_interrupts(irq_state);
+
+    // Forward the packed record to ESP32 - it expands the id from the same
+    // catalog table, so the wire carries ~8-20 bytes instead of full text
+    if (g_forward_enabled && log_forward_is_enabled()) {
+        log_forward_send_compact(log_fwd_level(level), id, argc, rec.args);
+    }
+}
+
 // =============================================================================
 // Utility Functions
 // =============================================================================
@@ -277,7 +341,33 @@ void logging_process_pending(void) {
             break;  // Process more on next call
         }
     }
-    
+
+    // Expand queued compact records to text (this is where the vsnprintf cost
+    // deferred by log_message_id() is actually paid - off the control loop).
+    // Note: compact records drain after the text ring, so strict interleaving
+    // with log_message() output is not preserved.
+    for (int processed = 0; processed < 8; processed++) {
+        log_compact_record_t rec;
+        uint32_t irq_state = save_and_disable_interrupts();
+        if (g_compact_count == 0) {
+            restore_interrupts(irq_state);
+            break;  // Ring empty
+        }
+        rec = g_compact_ring[g_compact_read];
+        g_compact_read = (g_compact_read + 1) % LOG_COMPACT_RING_RECORDS;
+        g_compact_count--;
+        restore_interrupts(irq_state);
+
+        const char* format = log_catalog_format(rec.id);
+        if (format == NULL) {
+            printf("LOG: unknown catalog id 0x%04X\n", rec.id);
+            continue;
+        }
+        // Catalog formats consume at most LOG_COMPACT_MAX_ARGS int32 args;
+        // passing unused trailing arguments to printf is well-defined
+        printf(format, rec.args[0], rec.args[1], rec.args[2], rec.args[3]);
+    }
+
     // Forward to ESP32 if enabled (process any queued messages)
     if (g_forward_enabled && log_forward_is_enabled() && total_read > 0) {
         // Note: log_forward_send() should also be non-blocking
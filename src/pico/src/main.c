@@ -3,8 +3,14 @@
  * 
  * Main entry point for the RP2350-based control board (Raspberry Pi Pico 2).
  * 
- * Core 0: Real-time control loop (safety, sensors, PID, outputs)
- * Core 1: Communication with ESP32
+ * Core 0: Real-time control loop (safety, PID, outputs)
+ * Core 1: Sensor acquisition and communication with ESP32
+ *
+ * Sensor reads (ADC + two-stage filtering) run on Core 1 and publish
+ * through a lock-free seqlock mailbox in sensors.c, so the Core 0 control
+ * period never absorbs acquisition jitter. This also puts all ADC access
+ * on one core (diagnostics already samples the ADC from Core 1 packet
+ * handlers, which used to race Core 0's adc_select_input).
  * 
  * FLOATING POINT COMPATIBILITY NOTE:
  * This firmware uses float extensively in the control loop (PID, temperature calculations).
@@ -33,8 +39,11 @@
 #include "gpio_init.h"
 #include "hardware.h"
 #include "water_management.h"
+#include "flow_meter.h"
+#include "burst_capture.h"
 #include "config_persistence.h"
 #include "cleaning.h"
+#include "wake_schedule.h"
 #include "bootloader.h"
 #include "diagnostics.h"
 #include "flash_safe.h"
@@ -43,6 +52,7 @@
 #include "packet_handlers.h"
 #include "logging.h"
 #include "validation.h"
+#include "trace.h"
 
 // -----------------------------------------------------------------------------
 // Globals
@@ -72,9 +82,20 @@ static volatile bool g_status_updated = false;  // Flag to indicate new data ava
 // Alarm state tracking - only send alarm messages when state changes
 static uint8_t g_last_sent_alarm = ALARM_NONE;
 
+// Control-loop jitter tracking (timing quality of the Core 0 control tick).
+// Core 0 is the only writer; Core 1 snapshots it for the 60s MSG_JITTER
+// report. Monotone counters, so an unlocked cross-core read is benign
+// (same pattern as protocol_stats_t). The *_since_tick accumulators feed
+// the per-cause attribution when the next tick arrives late.
+static jitter_payload_t g_jitter;
+static uint32_t g_jitter_class_b_us_since_tick = 0;   // Class B slice time
+static uint32_t g_jitter_protocol_us_since_tick = 0;  // Core 0 alarm send time
+
 // -----------------------------------------------------------------------------
 // Helper: Send environmental config to ESP32
 // -----------------------------------------------------------------------------
+static const char* get_msg_name(uint8_t type);  // Defined below handle_packet
+
 static void send_environmental_config(void) {
     environmental_electrical_t env;
     environmental_config_get(&env);
@@ -101,7 +122,10 @@ void core1_main(void) {
     // Without this, Core 1 continues executing from XIP flash during erase/program,
     // causing a hard fault (RP2350 reads garbage from invalidated XIP cache).
     multicore_lockout_victim_init();
-    
+
+    // Cycle counter for tracepoints - per-core, so Core 1 enables its own
+    trace_init();
+
     // Initialize protocol
     protocol_init();
     
@@ -119,10 +143,11 @@ void core1_main(void) {
     uint32_t last_status_send = 0;
     uint32_t last_boot_info_send = 0;  // For periodic boot info resend
     uint32_t last_protocol_stats_log = 0;  // For periodic protocol diagnostics
-    
+    uint32_t last_sensor_read = 0;     // Sensor acquisition timer
+
     while (true) {
         uint32_t now = to_ms_since_boot(get_absolute_time());
-        
+
         // CRITICAL: When bootloader is active, Core 1 must be completely suspended
         // Bootloader has exclusive access to UART and flash
         if (bootloader_is_active()) {
@@ -135,10 +160,23 @@ void core1_main(void) {
         }
         
         // Process incoming packets (only when bootloader is NOT active)
+        TRACE_BEGIN(TRACE_PT_PROTOCOL_PROCESS);
         protocol_process();
-        
-        // Send status periodically
-        if (now - last_status_send >= STATUS_SEND_PERIOD_MS) {
+        TRACE_END(TRACE_PT_PROTOCOL_PROCESS);
+
+        // Sensor acquisition (20Hz) - runs here so Core 0 keeps a tight,
+        // jitter-free control period. Results publish through the seqlock
+        // mailbox in sensors.c; Core 0 only ever copies the latest snapshot.
+        if (now - last_sensor_read >= SENSOR_READ_PERIOD_MS) {
+            last_sensor_read = now;
+            sensors_read();
+        }
+
+        // Send status periodically - interval adapts to the negotiated rate:
+        // fast while brewing, slow while idle (see protocol handshake)
+        uint32_t status_period = protocol_get_status_interval_ms(
+            g_status_buffers[g_active_buffer].state == STATE_BREWING);
+        if (now - last_status_send >= status_period) {
             last_status_send = now;
             
             // Double-buffered read: read from active buffer (no mutex needed)
@@ -153,10 +191,45 @@ void core1_main(void) {
             }
             
             if (should_send) {
-                protocol_send_status(&status_copy);
+                // Delta frame with periodic full keyframe - most intervals only
+                // a temperature and uptime moved, no need to resend all 32 bytes
+                protocol_send_status_delta(&status_copy);
             }
         }
-        
+
+        // Warm-state snapshot: queued by the handshake handler whenever the
+        // ESP32 (re)connects. One message carries version, machine type and a
+        // full status frame so an ESP32-only reboot doesn't have to poll its
+        // way back to a truthful UI while the machine keeps running.
+        if (protocol_take_warm_state_request() && g_status_updated) {
+            warm_state_payload_t warm;
+            memset(&warm, 0, sizeof(warm));
+
+            uint32_t read_idx = g_active_buffer;
+            __dmb();  // Pair with Core 0's publish barrier (see control loop)
+            memcpy(&warm.status, &g_status_buffers[read_idx], sizeof(status_payload_t));
+
+            warm.version_major = FIRMWARE_VERSION_MAJOR;
+            warm.version_minor = FIRMWARE_VERSION_MINOR;
+            warm.version_patch = FIRMWARE_VERSION_PATCH;
+            // Persisted machine type is the source of truth (same fallback as
+            // protocol_send_boot)
+            warm.machine_type = config_persistence_get_machine_type();
+            if (warm.machine_type == 0 || warm.machine_type > 4) {
+                warm.machine_type = (uint8_t)machine_get_type();
+            }
+            warm.active_shot = (warm.status.state == STATE_BREWING) ? 1 : 0;
+            warm.pico_uptime_ms = now;
+
+            protocol_send_warm_state(&warm);
+            LOG_INFO("Core 1: Warm-state snapshot sent (uptime=%lums, shot=%d)\n",
+                     warm.pico_uptime_ms, warm.active_shot);
+        }
+
+        // Drain shot-start burst capture frames (no-op outside the
+        // post-shot window; paced internally so status traffic wins)
+        burst_capture_task();
+
         // Power meter: Hardware metering removed (v2.32). Power monitoring via MQTT smart plugs on ESP32.
         
         // Periodically resend boot info (version, env config) to ensure ESP32 stays in sync
@@ -183,7 +256,46 @@ void core1_main(void) {
                      stats.crc_errors, stats.packet_errors, stats.timeout_errors,
                      stats.retries, stats.ack_timeouts,
                      stats.nacks_received, stats.pending_cmd_count);
-            
+
+            // Command->ACK round-trip distribution (for retry timeout tuning)
+            if (stats.ack_latency_samples > 0) {
+                LOG_INFO("Protocol RTT: p50=%lums p95=%lums max=%lums (n=%lu)\n",
+                         protocol_latency_percentile_ms(stats.ack_latency_buckets,
+                                                        stats.ack_latency_samples, 50),
+                         protocol_latency_percentile_ms(stats.ack_latency_buckets,
+                                                        stats.ack_latency_samples, 95),
+                         stats.ack_latency_max_ms, stats.ack_latency_samples);
+            }
+
+            // Per-command dispatch counters from the handler table - which
+            // command types the ESP32 is actually sending, for free
+            {
+                size_t n;
+                const uint32_t* counts = packet_dispatch_counts(&n);
+                char buf[160];
+                size_t off = 0;
+                for (size_t i = 0; i < n; i++) {
+                    if (counts[i] == 0) continue;
+                    int w = snprintf(buf + off, sizeof(buf) - off, " %s=%lu",
+                                     get_msg_name((uint8_t)i),
+                                     (unsigned long)counts[i]);
+                    if (w < 0 || (size_t)w >= sizeof(buf) - off) break;
+                    off += (size_t)w;
+                }
+                if (off > 0) {
+                    LOG_INFO("CMD counts:%s\n", buf);
+                }
+            }
+
+            // Ship the control-loop jitter report alongside the stats log.
+            // Snapshot first: Core 0 keeps updating g_jitter and send_packet
+            // reads the payload over a DMA setup window.
+            if (g_jitter.samples > 0) {
+                jitter_payload_t jitter_copy;
+                memcpy(&jitter_copy, &g_jitter, sizeof(jitter_copy));
+                protocol_send_jitter(&jitter_copy);
+            }
+
             // Check for protocol health issues
             if (stats.crc_errors > 100) {
                 LOG_WARN("High CRC error rate detected - check wiring/EMI\n");
@@ -206,6 +318,9 @@ void core1_main(void) {
         
         // Process pending flash writes for log forwarding (deferred to avoid blocking protocol handler)
         log_forward_process();
+
+        // Drain tracepoint rings to the ESP32 (no-op unless built with TRACEPOINTS)
+        trace_flush();
         
         // Signal that Core 1 is alive (for watchdog monitoring by Core 0)
         g_core1_alive = true;
@@ -222,6 +337,7 @@ static const char* get_msg_name(uint8_t type) {
     switch (type) {
         case MSG_PING:                    return "PING";
         case MSG_STATUS:                  return "STATUS";
+        case MSG_STATUS_DELTA:            return "STATUS_DELTA";
         case MSG_ALARM:                   return "ALARM";
         case MSG_BOOT:                    return "BOOT";
         case MSG_ACK:                     return "ACK";
@@ -238,6 +354,7 @@ static const char* get_msg_name(uint8_t type) {
         case MSG_CMD_MODE:                return "MODE";
         case MSG_CMD_CONFIG:              return "CONFIG";
         case MSG_CMD_GET_CONFIG:          return "GET_CONFIG";
+        case MSG_CMD_GET_SNAPSHOT:        return "GET_SNAPSHOT";
         case MSG_CMD_GET_ENV_CONFIG:      return "GET_ENV_CONFIG";
         case MSG_CMD_CLEANING_START:      return "CLEANING_START";
         case MSG_CMD_CLEANING_STOP:       return "CLEANING_STOP";
@@ -264,86 +381,59 @@ void handle_packet(const packet_t* packet) {
     
     // Register heartbeat from ESP32 - critical for safety system
     safety_esp32_heartbeat();
-    
-    // Dispatch to modular packet handlers
-    // Each handler validates inputs, applies changes, and sends responses
-    switch (packet->type) {
-        case MSG_PING:
-            handle_cmd_ping(packet);
-            break;
-            
-        case MSG_CMD_SET_TEMP:
-            handle_cmd_set_temp(packet);
-            break;
-            
-        case MSG_CMD_SET_PID:
-            handle_cmd_set_pid(packet);
-            break;
-            
-        case MSG_CMD_BREW:
-            handle_cmd_brew(packet);
-            break;
-            
-        case MSG_CMD_MODE:
-            handle_cmd_mode(packet);
-            break;
-            
-        case MSG_CMD_GET_CONFIG:
-            handle_cmd_get_config(packet);
-            break;
-            
-        case MSG_CMD_CONFIG:
-            handle_cmd_config(packet);
-            break;
-            
-        case MSG_CMD_GET_ENV_CONFIG:
-            handle_cmd_get_env_config(packet);
-            break;
-            
-        case MSG_CMD_CLEANING_START:
-        case MSG_CMD_CLEANING_STOP:
-        case MSG_CMD_CLEANING_RESET:
-        case MSG_CMD_CLEANING_SET_THRESHOLD:
-            handle_cmd_cleaning(packet);
-            break;
-            
-        case MSG_CMD_GET_STATISTICS:
-            handle_cmd_get_statistics(packet);
-            break;
-            
-        case MSG_CMD_DEBUG:
-            handle_cmd_debug(packet);
-            break;
-            
-        case MSG_CMD_SET_ECO:
-            handle_cmd_set_eco(packet);
-            break;
-            
-        case MSG_CMD_BOOTLOADER:
-            handle_cmd_bootloader(packet);
-            break;
-            
-        case MSG_CMD_DIAGNOSTICS:
-            handle_cmd_diagnostics(packet);
-            break;
-            
-        // MSG_CMD_POWER_METER_CONFIG/DISCOVER removed (v2.32 - MQTT only)
-            break;
-            
-        case MSG_CMD_GET_BOOT:
-            handle_cmd_get_boot(packet);
-            break;
-            
-        case MSG_CMD_LOG_CONFIG:
-            handle_cmd_log_config(packet);
-            break;
-            
-        default:
-            LOG_WARN("Unknown packet type: 0x%02X\n", packet->type);
-            break;
+
+    // Dispatch through the const handler table in packet_handlers.c - one
+    // bounds check and one indirect call, with per-entry minimum payload
+    // validation and per-type counters
+    packet_dispatch(packet);
+}
+
+
+// -----------------------------------------------------------------------------
+// Boot-Phase Timing
+// -----------------------------------------------------------------------------
+// Each init phase in main() records its duration; one compact summary line
+// goes out once log forwarding is up, so the ESP32-side log can attribute a
+// boot-time regression to a phase instead of just noticing the total grew.
+#define BOOT_PHASE_MAX 12
+
+typedef struct {
+    const char* name;
+    uint16_t ms;
+} boot_phase_t;
+
+static boot_phase_t g_boot_phases[BOOT_PHASE_MAX];
+static uint8_t g_boot_phase_count = 0;
+static uint32_t g_boot_phase_start = 0;
+
+static void boot_phase_begin(void) {
+    g_boot_phase_start = to_ms_since_boot(get_absolute_time());
+}
+
+static void boot_phase_end(const char* name) {
+    uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - g_boot_phase_start;
+    if (g_boot_phase_count < BOOT_PHASE_MAX) {
+        g_boot_phases[g_boot_phase_count].name = name;
+        g_boot_phases[g_boot_phase_count].ms =
+            (elapsed > UINT16_MAX) ? UINT16_MAX : (uint16_t)elapsed;
+        g_boot_phase_count++;
     }
 }
 
+static void boot_phase_log_summary(uint32_t total_ms) {
+    // Single line so it survives the rate limiter and forwards as one record
+    char line[160];
+    int used = snprintf(line, sizeof(line), "Boot: %lu ms (", (unsigned long)total_ms);
+    for (uint8_t i = 0; i < g_boot_phase_count && used < (int)sizeof(line) - 1; i++) {
+        used += snprintf(line + used, sizeof(line) - used, "%s%s=%u",
+                         (i > 0) ? " " : "",
+                         g_boot_phases[i].name, g_boot_phases[i].ms);
+    }
+    if (used < (int)sizeof(line) - 1) {
+        snprintf(line + used, sizeof(line) - used, ")");
+    }
+    LOG_INFO("%s\n", line);
+}
 
 // -----------------------------------------------------------------------------
 // Core 0 Entry Point (Control)
@@ -363,6 +453,10 @@ int main(void) {
     // For a control system with sporadic logging, buffering is unnecessary overhead
     setvbuf(stdout, NULL, _IONBF, 0);
     setvbuf(stdin, NULL, _IONBF, 0);
+
+    // Cycle counter for tracepoints (no-op unless built with TRACEPOINTS);
+    // Core 1 enables its own counter in core1_main()
+    trace_init();
     
     // Always print boot banner to USB serial
     LOG_PRINT("\n========================================\n");
@@ -374,6 +468,7 @@ int main(void) {
     LOG_PRINT("========================================\n");
     
     // Initialize hardware abstraction layer
+    boot_phase_begin();
     if (!hw_init()) {
         LOG_PRINT("ERROR: Failed to initialize hardware abstraction layer\n");
         // Continue anyway, but hardware may not work correctly
@@ -410,7 +505,8 @@ int main(void) {
     } else {
         LOG_PRINT("ERROR: Machine configuration not available!\n");
     }
-    
+    boot_phase_end("hw_gpio");
+
     // SAF-001: Enable watchdog immediately after GPIO initialization
     watchdog_enable(SAFETY_WATCHDOG_TIMEOUT_MS, true);
     LOG_PRINT("Watchdog enabled (%dms timeout)\n", SAFETY_WATCHDOG_TIMEOUT_MS);
@@ -436,13 +532,16 @@ int main(void) {
     watchdog_hw->scratch[WD_RESET_SCRATCH_IDX] = WD_RESET_MAGIC | (uint32_t)watchdog_reset_count;
     
     // Initialize safety system FIRST
+    boot_phase_begin();
     safety_init();
     LOG_PRINT("Safety system initialized\n");
     watchdog_update();  // Feed watchdog during boot init
-    
+    boot_phase_end("safety");
+
     // Initialize Class B safety routines (IEC 60730/60335 compliance)
     // Note: class_b_init() calculates a CRC32 over 256KB of flash which
     // can take 100-200ms on cold boot (empty XIP cache after power-on).
+    boot_phase_begin();
     if (class_b_init() != CLASS_B_PASS) {
         LOG_PRINT("ERROR: Class B initialization failed!\n");
         // Continue but log the error - safety system will catch issues
@@ -460,20 +559,24 @@ int main(void) {
         LOG_PRINT("Class B startup tests PASSED\n");
     }
     watchdog_update();  // Feed watchdog after startup tests
-    
+    boot_phase_end("class_b");
+
     // Initialize sensors
+    boot_phase_begin();
     sensors_init();
     DEBUG_PRINT("Sensors initialized\n");
-    
+    boot_phase_end("sensors");
+
     // Initialize flash safety system on Core 0 BEFORE launching Core 1.
     // This registers Core 0 as a multicore lockout victim, allowing Core 1
     // to safely pause Core 0 during flash operations (XIP safety).
     flash_safe_init();
     watchdog_update();  // Feed watchdog after flash safety init
-    
+
     // Initialize configuration persistence (loads from flash, applies settings).
     // Flash writes are DEFERRED to after Core 1 starts - flash_safe_execute()
     // requires Core 1 for multicore lockout; calling it now would hang.
+    boot_phase_begin();
     bool env_valid = config_persistence_init();
     if (!env_valid) {
         DEBUG_PRINT("ERROR: Environmental configuration not set - machine disabled\n");
@@ -498,12 +601,14 @@ int main(void) {
     // an uninitialized UART peripheral, which hangs the bus on RP2350.
     // Forwarding is enabled after Core 1 starts (see below).
     log_forward_init();
-    
+    boot_phase_end("config");
+
     // Note: Power meter is no longer auto-initialized at boot from saved config.
     // The ESP32 re-sends the enable command after Pico connects (handleBoot).
     // This eliminates boot-time watchdog risks from power meter blocking I/O.
     
     // Initialize control
+    boot_phase_begin();
     control_init();
     DEBUG_PRINT("Control initialized\n");
     
@@ -514,26 +619,38 @@ int main(void) {
     // Initialize water management
     water_management_init();
     DEBUG_PRINT("Water management initialized\n");
-    
+
+    // Initialize flow meter pulse capture (dormant if PCB has no flow pin)
+    flow_meter_init();
+
+    // Arm WEIGHT_STOP edge capture for the stop-path latency test (0x14)
+    diagnostics_weight_stop_capture_init();
+
     // Initialize cleaning mode
     cleaning_init();
     DEBUG_PRINT("Cleaning mode initialized\n");
+
+    // Restore the autonomous wake schedule (dormant until ESP32 clock push)
+    wake_schedule_init();
     watchdog_update();  // Feed watchdog before Core 1 launch
-    
+    boot_phase_end("subsystems");
+
     // Note: Statistics are now tracked by ESP32 (has NTP for accurate timestamps)
     // Pico only sends brew completion events to ESP32 via alarms
     
     // Launch Core 1 for communication
+    boot_phase_begin();
     multicore_launch_core1(core1_main);
     DEBUG_PRINT("Core 1 launched\n");
-    
+
     // Wait for Core 1 to be ready
     // Feed watchdog while waiting to prevent timeout if Core 1 init is slow
     while (!g_core1_ready) {
         watchdog_update();
         sleep_ms(1);
     }
-    
+    boot_phase_end("core1_wait");
+
     // Set up packet handler
     protocol_set_callback(handle_packet);
     
@@ -541,9 +658,11 @@ int main(void) {
     // flash_safe_execute() requires Core 1 for multicore lockout handshake.
     // Calling it before Core 1 launches hangs until its 10s timeout,
     // exceeding the 2s watchdog and causing an infinite restart loop.
+    boot_phase_begin();
     config_persistence_process_boot_save();
     watchdog_update();
-    
+    boot_phase_end("boot_save");
+
     // NOW safe to enable log forwarding - Core 1 has initialized protocol/UART.
     // Before this point, protocol_send_log() would write to an uninitialized
     // UART peripheral, hanging the RP2350 bus and causing a watchdog reset loop.
@@ -551,7 +670,11 @@ int main(void) {
         logging_set_forward_enabled(true);
         LOG_PRINT("Log forwarding enabled (loaded from flash)\n");
     }
-    
+
+    // Boot is done - publish the phase breakdown (forwards to the ESP32 log
+    // when forwarding is on, otherwise lands on the USB console)
+    boot_phase_log_summary(to_ms_since_boot(get_absolute_time()) - g_boot_time);
+
     DEBUG_PRINT("Entering main control loop\n");
     
     // Clear watchdog reset counter - we've successfully booted and are about to enter the main loop.
@@ -560,7 +683,6 @@ int main(void) {
     
     // Timing
     uint32_t last_control = 0;
-    uint32_t last_sensor = 0;
     uint32_t last_water = 0;
     
     // Initialize Core 1 last-seen timestamp to current time
@@ -583,20 +705,20 @@ int main(void) {
             continue;
         }
         
-        // Read sensors (20Hz)
-        if (now - last_sensor >= SENSOR_READ_PERIOD_MS) {
-            last_sensor = now;
-            sensors_read();
-        }
-        
+        // Sensors are acquired on Core 1 (see core1_main) and read here
+        // through the lock-free mailbox - no acquisition work on this core
+
         // Update water management (10Hz)
         if (now - last_water >= 100) {
             last_water = now;
             water_management_update();
         }
         
-        // Update cleaning mode (10Hz)
+        // Update cleaning mode (deadline-stepped, runs every pass)
         cleaning_update();
+
+        // Evaluate the autonomous wake schedule (internally gated to ~1Hz)
+        wake_schedule_update();
         
         // Note: Power meter config is no longer saved to Pico flash.
         // ESP32 handles persistence (NVS) and re-enables on each Pico boot.
@@ -604,7 +726,60 @@ int main(void) {
         // Control loop (10Hz)
         if (now - last_control >= CONTROL_LOOP_PERIOD_MS) {
             last_control = now;
-            
+
+            // Measure the actual tick period against the nominal 100ms and
+            // attribute lateness to whatever non-control work ran since the
+            // prior tick: a flash pause (freezes both cores), Class B
+            // slices, or Core 0 protocol sends - "other" when none of them
+            // showed up (e.g. the ms-granularity scheduling itself).
+            {
+                static uint32_t last_tick_us = 0;
+                static uint32_t last_flash_ops = 0;
+                uint32_t tick_us = time_us_32();
+                if (last_tick_us != 0) {
+                    uint32_t period_us = tick_us - last_tick_us;
+                    uint32_t late_us = (period_us > CONTROL_LOOP_PERIOD_MS * 1000u)
+                                           ? period_us - CONTROL_LOOP_PERIOD_MS * 1000u
+                                           : 0;
+                    g_jitter.late_buckets[control_jitter_bucket(late_us)]++;
+                    g_jitter.samples++;
+                    if (late_us > g_jitter.max_late_us) {
+                        g_jitter.max_late_us = late_us;
+                    }
+
+                    uint32_t flash_ops = flash_safe_op_count();
+                    if (flash_ops != last_flash_ops) {
+                        if (late_us > g_jitter.max_late_flash_us) {
+                            g_jitter.max_late_flash_us = late_us;
+                        }
+                    } else if (g_jitter_class_b_us_since_tick > 0 &&
+                               g_jitter_class_b_us_since_tick >= g_jitter_protocol_us_since_tick) {
+                        if (late_us > g_jitter.max_late_class_b_us) {
+                            g_jitter.max_late_class_b_us = late_us;
+                        }
+                    } else if (g_jitter_protocol_us_since_tick > 0) {
+                        if (late_us > g_jitter.max_late_protocol_us) {
+                            g_jitter.max_late_protocol_us = late_us;
+                        }
+                    } else if (late_us > g_jitter.max_late_other_us) {
+                        g_jitter.max_late_other_us = late_us;
+                    }
+                    last_flash_ops = flash_ops;
+                }
+                last_tick_us = tick_us;
+                g_jitter_class_b_us_since_tick = 0;
+                g_jitter_protocol_us_since_tick = 0;
+            }
+
+
+            // Sensor data comes from Core 1 now - if the mailbox goes stale
+            // (Core 1 wedged mid-acquisition), force safe state instead of
+            // letting PID act on frozen temperatures while waiting for the
+            // Core 1 watchdog path below to expire.
+            if (sensors_data_age_ms() > CORE1_TIMEOUT_MS) {
+                safety_enter_safe_state();
+            }
+
             // Check safety first
             safety_state_t safety = safety_check();
             
@@ -622,6 +797,7 @@ int main(void) {
             
             // Send alarm message only if state changed
             if (current_alarm != g_last_sent_alarm) {
+                uint32_t send_start_us = time_us_32();
                 if (safety == SAFETY_CRITICAL) {
                     protocol_send_alarm(current_alarm, 2, 0);
                 } else if (safety == SAFETY_FAULT) {
@@ -632,10 +808,12 @@ int main(void) {
                 }
                 // else: both current and last are ALARM_NONE, no need to send
                 g_last_sent_alarm = current_alarm;
+                g_jitter_protocol_us_since_tick += time_us_32() - send_start_us;
             }
             
-            // Run periodic Class B self-tests (IEC 60730/60335)
-            // Tests are staggered across cycles to minimize latency impact
+            // Class B self-test scheduler + deadline watchdog (IEC 60730/60335)
+            // Only the stack check runs here; the heavy tests execute in
+            // time-budgeted slices during the idle gap below
             class_b_result_t class_b_periodic = class_b_periodic_test();
             if (class_b_periodic != CLASS_B_PASS) {
                 // Class B failure - enter safe state
@@ -680,7 +858,9 @@ int main(void) {
             
             // Run control (PID, outputs). Always call so safe/IDLE still apply outputs off
             // (e.g. phase-sync schedules cleared, SSRs driven low).
+            TRACE_BEGIN(TRACE_PT_CONTROL_UPDATE);
             control_update();
+            TRACE_END(TRACE_PT_CONTROL_UPDATE);
             
             // Update status for Core 1 (double-buffered, non-blocking)
             sensor_data_t sensor_data;
@@ -729,6 +909,11 @@ int main(void) {
             new_status.heating_strategy = control_get_heating_strategy();
             new_status.cleaning_reminder = cleaning_is_reminder_due() ? 1 : 0;
             new_status.brew_count = cleaning_get_brew_count();
+            new_status.flow_ml_min = flow_meter_get_rate_ml_min();
+            new_status.brew_phase = state_get_brew_phase();
+            new_status.phase_start_us = state_get_phase_start_us();
+            new_status.brew_energy_wh = control_get_energy_wh(0);
+            new_status.steam_energy_wh = control_get_energy_wh(1);
             
             // Set flags
             new_status.flags = 0;
@@ -747,7 +932,37 @@ int main(void) {
             g_status_updated = true;
             __dmb();  // Ensure flag update is visible to Core 1
         }
-        
+
+        // Commit the pending output image: every relay transition requested
+        // this pass (state machine, control, water management, cleaning)
+        // lands in one SIO set/clr pair - simultaneous actuation at a fixed
+        // point instead of microsecond-skewed gpio_put calls scattered
+        // through the tick. No-op when nothing changed.
+        hw_gpio_out_commit();
+
+        // Run deferred Class B work in the idle gap between control ticks.
+        // Each slice is bounded by CLASS_B_SLICE_BUDGET_US so it cannot
+        // delay the next tick (the flash CRC walk used to run inside the
+        // control tick and caused loop-period outliers).
+        uint32_t class_b_start_us = time_us_32();
+        class_b_result_t class_b_slice = class_b_run_slice();
+        g_jitter_class_b_us_since_tick += time_us_32() - class_b_start_us;
+        if (class_b_slice != CLASS_B_PASS) {
+            DEBUG_PRINT("CLASS B FAILURE: %s - entering safe state\n",
+                       class_b_result_string(class_b_slice));
+            safety_enter_safe_state();
+            protocol_send_alarm(ALARM_WATCHDOG, 2, 0);  // Use watchdog alarm for internal fault
+        }
+
+        // Fast limit-table pass between control ticks: over-temp and NTC
+        // faults kill the heaters within one loop iteration instead of
+        // waiting up to 100ms for the next safety_check(), shrinking the
+        // worst-case SSR-on time after a sensor failure. Alarm reporting
+        // stays with the 10Hz safety tick above.
+        if (safety_check_limits() == SAFETY_CRITICAL) {
+            safety_enter_safe_state();
+        }
+
         // Small sleep
         sleep_us(100);
     }
@@ -14,10 +14,12 @@
 #include "config_persistence.h"
 #include "environmental_config.h"
 #include "cleaning.h"
+#include "wake_schedule.h"
 #include "bootloader.h"
 #include "diagnostics.h"
 #include "log_forward.h"
 #include "safety.h"
+#include "uart_tx_dma.h"
 #include "pico/stdlib.h"  // For sleep_ms
 #include "hardware/uart.h"  // For uart_putc, uart_tx_wait_blocking
 #include <string.h>
@@ -191,6 +193,51 @@ void handle_cmd_get_config(const packet_t* packet) {
     protocol_send_config(&config);
 }
 
+void handle_cmd_get_snapshot(const packet_t* packet) {
+    (void)packet;
+    config_snapshot_payload_t snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.snapshot_version = CONFIG_SNAPSHOT_VERSION;
+
+    // Control config
+    config_payload_t config;
+    control_get_config(&config);
+    snapshot.brew_setpoint = config.brew_setpoint;
+    snapshot.steam_setpoint = config.steam_setpoint;
+    snapshot.temp_offset = config.temp_offset;
+    snapshot.pid_kp = config.pid_kp;
+    snapshot.pid_ki = config.pid_ki;
+    snapshot.pid_kd = config.pid_kd;
+    snapshot.heating_strategy = config.heating_strategy;
+    snapshot.machine_type = config.machine_type;
+
+    // Environmental electrical config
+    environmental_electrical_t env;
+    environmental_config_get(&env);
+    snapshot.nominal_voltage = env.nominal_voltage;
+    snapshot.max_current_draw = env.max_current_draw;
+
+    // Pre-infusion
+    bool pi_enabled;
+    uint16_t pi_on_ms, pi_pause_ms;
+    state_get_preinfusion(&pi_enabled, &pi_on_ms, &pi_pause_ms);
+    snapshot.preinfusion_enabled = pi_enabled ? 1 : 0;
+    snapshot.preinfusion_on_ms = pi_on_ms;
+    snapshot.preinfusion_pause_ms = pi_pause_ms;
+
+    // Eco mode
+    eco_config_t eco;
+    state_get_eco_config(&eco);
+    snapshot.eco_enabled = eco.enabled ? 1 : 0;
+    snapshot.eco_brew_temp = eco.eco_brew_temp;
+    snapshot.eco_timeout_minutes = eco.timeout_minutes;
+
+    // Cleaning
+    snapshot.cleaning_threshold = cleaning_get_threshold();
+
+    protocol_send_config_snapshot(&snapshot);
+}
+
 void handle_cmd_config(const packet_t* packet) {
     if (packet->length < 1) {
         protocol_send_ack(MSG_CMD_CONFIG, packet->seq, ACK_ERROR_INVALID);
@@ -467,11 +514,56 @@ void handle_cmd_set_eco(const packet_t* packet) {
     }
 }
 
+void handle_cmd_set_wake_schedule(const packet_t* packet) {
+    // [count][cur_sec][cur_mow u16 LE] + count x [minute_of_day u16 LE][days][strategy]
+    if (packet->length < 4) {
+        protocol_send_ack(MSG_CMD_SET_WAKE_SCHEDULE, packet->seq, ACK_ERROR_INVALID);
+        return;
+    }
+
+    uint8_t count = packet->payload[0];
+    uint8_t cur_sec = packet->payload[1];
+    uint16_t cur_mow = (uint16_t)(packet->payload[2] | (packet->payload[3] << 8));
+
+    if (count > WAKE_SCHEDULE_MAX ||
+        packet->length != 4 + count * sizeof(wake_schedule_entry_t) ||
+        cur_sec > 59 || cur_mow >= 7 * 24 * 60) {
+        LOG_WARN("SET_WAKE_SCHEDULE: Invalid header (count=%d, sec=%d, mow=%d)\n",
+                 count, cur_sec, cur_mow);
+        protocol_send_ack(MSG_CMD_SET_WAKE_SCHEDULE, packet->seq, ACK_ERROR_INVALID);
+        return;
+    }
+
+    wake_schedule_entry_t entries[WAKE_SCHEDULE_MAX];
+    for (uint8_t i = 0; i < count; i++) {
+        const uint8_t* p = &packet->payload[4 + i * sizeof(wake_schedule_entry_t)];
+        entries[i].minute_of_day = (uint16_t)(p[0] | (p[1] << 8));
+        entries[i].days = p[2];
+        entries[i].strategy = p[3];
+
+        if (entries[i].minute_of_day >= 24 * 60 ||
+            entries[i].strategy > HEAT_STRATEGY_SMART_STAGGER) {
+            LOG_WARN("SET_WAKE_SCHEDULE: Invalid entry %d (minute=%d, strategy=%d)\n",
+                     i, entries[i].minute_of_day, entries[i].strategy);
+            protocol_send_ack(MSG_CMD_SET_WAKE_SCHEDULE, packet->seq, ACK_ERROR_INVALID);
+            return;
+        }
+    }
+
+    wake_schedule_apply(entries, count, cur_mow, cur_sec);
+
+    LOG_INFO("Wake schedule set: %d entries, clock anchored at mow %d\n", count, cur_mow);
+    protocol_send_ack(MSG_CMD_SET_WAKE_SCHEDULE, packet->seq, ACK_SUCCESS);
+}
+
 void handle_cmd_bootloader(const packet_t* packet) {
     LOG_INFO("Entering bootloader mode\n");
     protocol_send_ack(MSG_CMD_BOOTLOADER, packet->seq, ACK_SUCCESS);
-    
+
     // CRITICAL: Wait for protocol ACK to finish transmitting
+    // Release the TX DMA channel first - the bootloader owns the UART directly
+    // and queued DMA spans must not interleave with its raw byte stream
+    uart_tx_dma_deinit();
     uart_tx_wait_blocking(ESP32_UART_ID);
     
     // CRITICAL: Prepare system FIRST before sending bootloader ACK
@@ -524,7 +616,13 @@ void handle_cmd_diagnostics(const packet_t* packet) {
     if (packet->length >= 1) {
         test_id = packet->payload[0];
     }
-    
+
+    // Latency loopback (0x14): timestamp the command's arrival before the
+    // ACK/dispatch overhead so the GPIO-vs-command margin is honest
+    if (test_id == DIAG_TEST_WEIGHT_STOP_LATENCY) {
+        diagnostics_note_weight_stop_cmd();
+    }
+
     LOG_INFO("Running diagnostics (test_id=%d)\n", test_id);
     protocol_send_ack(MSG_CMD_DIAGNOSTICS, packet->seq, ACK_SUCCESS);
     
@@ -607,3 +705,76 @@ void handle_cmd_log_config(const packet_t* packet) {
     log_forward_handle_command(packet->payload, packet->length);
     protocol_send_ack(MSG_CMD_LOG_CONFIG, packet->seq, ACK_SUCCESS);
 }
+
+// =============================================================================
+// Dispatch Table
+// =============================================================================
+// One const entry per command type, indexed directly by the type byte.
+// Dispatch is a bounds check plus an indirect call instead of a switch
+// re-evaluated per packet, the minimum payload lengths sit in one audited
+// place tied to the protocol_defs.h command structs, and the per-type
+// counters fall out of the shared path for free.
+
+typedef void (*packet_handler_fn)(const packet_t* packet);
+
+typedef struct {
+    packet_handler_fn handler;  // NULL = type not handled on the Pico
+    uint8_t min_length;         // Shortest valid payload for this type
+} dispatch_entry_t;
+
+// Covers every defined message type (highest: MSG_CMD_SET_WAKE_SCHEDULE
+// 0x2D) - grow this when a new command passes it
+#define DISPATCH_TABLE_SIZE 0x30
+
+static const dispatch_entry_t dispatch_table[DISPATCH_TABLE_SIZE] = {
+    [MSG_PING]                       = { handle_cmd_ping,              0 },
+    [MSG_CMD_SET_TEMP]               = { handle_cmd_set_temp,          sizeof(cmd_set_temp_t) },
+    [MSG_CMD_SET_PID]                = { handle_cmd_set_pid,           sizeof(cmd_set_pid_t) },
+    [MSG_CMD_BREW]                   = { handle_cmd_brew,              sizeof(cmd_brew_t) },
+    [MSG_CMD_MODE]                   = { handle_cmd_mode,              sizeof(cmd_mode_t) },
+    [MSG_CMD_CONFIG]                 = { handle_cmd_config,            1 },  // [section] + section payload
+    [MSG_CMD_GET_CONFIG]             = { handle_cmd_get_config,        0 },
+    [MSG_CMD_GET_SNAPSHOT]           = { handle_cmd_get_snapshot,      0 },
+    [MSG_CMD_GET_ENV_CONFIG]         = { handle_cmd_get_env_config,    0 },
+    [MSG_CMD_CLEANING_START]         = { handle_cmd_cleaning,          0 },
+    [MSG_CMD_CLEANING_STOP]          = { handle_cmd_cleaning,          0 },
+    [MSG_CMD_CLEANING_RESET]         = { handle_cmd_cleaning,          0 },
+    [MSG_CMD_CLEANING_SET_THRESHOLD] = { handle_cmd_cleaning,          0 },  // Handler branches on length
+    [MSG_CMD_GET_STATISTICS]         = { handle_cmd_get_statistics,    0 },
+    [MSG_CMD_DEBUG]                  = { handle_cmd_debug,             0 },
+    [MSG_CMD_SET_ECO]                = { handle_cmd_set_eco,           1 },  // 1 = enter/exit, 5 = full config
+    [MSG_CMD_SET_WAKE_SCHEDULE]      = { handle_cmd_set_wake_schedule, 4 },  // Header before variable table
+    [MSG_CMD_BOOTLOADER]             = { handle_cmd_bootloader,        0 },
+    [MSG_CMD_DIAGNOSTICS]            = { handle_cmd_diagnostics,       0 },  // Optional [test_id]
+    [MSG_CMD_GET_BOOT]               = { handle_cmd_get_boot,          0 },
+    [MSG_CMD_LOG_CONFIG]             = { handle_cmd_log_config,        0 },
+};
+
+static uint32_t dispatch_counts[DISPATCH_TABLE_SIZE];
+
+void packet_dispatch(const packet_t* packet) {
+    uint8_t type = packet->type;
+
+    if (type >= DISPATCH_TABLE_SIZE || dispatch_table[type].handler == NULL) {
+        LOG_WARN("Unknown packet type: 0x%02X\n", type);
+        return;
+    }
+
+    dispatch_counts[type]++;
+
+    if (packet->length < dispatch_table[type].min_length) {
+        LOG_WARN("CMD 0x%02X: Payload too short (%d < %d)\n",
+                 type, packet->length, dispatch_table[type].min_length);
+        protocol_send_ack(type, packet->seq, ACK_ERROR_INVALID);
+        return;
+    }
+
+    dispatch_table[type].handler(packet);
+}
+
+const uint32_t* packet_dispatch_counts(size_t* count) {
+    if (count) {
+        *count = DISPATCH_TABLE_SIZE;
+    }
+    return dispatch_counts;
+}
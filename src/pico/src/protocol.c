@@ -4,11 +4,16 @@
  * Binary protocol implementation for ESP32 communication.
  */
 
+#include <stddef.h>
 #include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/uart.h"
 #include "hardware/watchdog.h"
 #include "protocol.h"
+#include "protocol_crc.h"
+#include "log_catalog.h"
+#include "trace_format.h"
+#include "uart_tx_dma.h"
 #include "config.h"
 #include "pcb_config.h"
 #include "machine_config.h"
@@ -55,6 +60,13 @@ static protocol_stats_t g_stats = {0};
 static bool g_handshake_complete = false;
 static uint32_t g_handshake_request_time = 0;
 
+// Warm-state snapshot pending (set on handshake, consumed by the Core 1 loop)
+static volatile bool g_warm_state_requested = false;
+
+// Negotiated telemetry rates (0 = not negotiated, use STATUS_SEND_PERIOD_MS)
+static uint8_t g_status_rate_idle_hz = 0;
+static uint8_t g_status_rate_active_hz = 0;
+
 // Retry tracking - pending commands awaiting ACK
 static pending_cmd_t g_pending_cmds[PROTOCOL_MAX_PENDING_CMDS] = {0};
 
@@ -65,20 +77,9 @@ static bool g_backpressure_active = false;
 // CRC-16-CCITT
 // -----------------------------------------------------------------------------
 uint16_t protocol_crc16(const uint8_t* data, size_t length) {
-    uint16_t crc = 0xFFFF;
-    
-    for (size_t i = 0; i < length; i++) {
-        crc ^= (uint16_t)data[i] << 8;
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x8000) {
-                crc = (crc << 1) ^ 0x1021;
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    
-    return crc;
+    // Table-driven (see protocol_crc.h) - one lookup per byte instead of
+    // 8 shifts, keeping the CRC pass negligible in the Core 0 timing budget
+    return protocol_crc16_ccitt(data, length);
 }
 
 // -----------------------------------------------------------------------------
@@ -123,13 +124,27 @@ static bool add_pending_command(uint8_t type, uint8_t seq, const uint8_t* payloa
     return false; // No free slots
 }
 
+// Record a command->ACK round-trip into the latency histogram
+static void record_ack_latency(uint32_t rtt_ms) {
+    g_stats.ack_latency_buckets[protocol_latency_bucket(rtt_ms)]++;
+    g_stats.ack_latency_samples++;
+    if (rtt_ms > g_stats.ack_latency_max_ms) {
+        g_stats.ack_latency_max_ms = rtt_ms;
+    }
+}
+
 // Remove command from pending list (ACK received)
 static void remove_pending_command(uint8_t seq) {
     for (int i = 0; i < PROTOCOL_MAX_PENDING_CMDS; i++) {
         if (g_pending_cmds[i].active && g_pending_cmds[i].seq == seq) {
             g_pending_cmds[i].active = false;
             g_stats.pending_cmd_count--;
-            
+
+            // RTT measured from the most recent (re)send - a retried command
+            // reports the latency of the attempt that actually got through
+            record_ack_latency(to_ms_since_boot(get_absolute_time()) -
+                               g_pending_cmds[i].sent_time_ms);
+
             // Release backpressure if below threshold
             if (g_stats.pending_cmd_count < PROTOCOL_BACKPRESSURE_THRESHOLD) {
                 g_backpressure_active = false;
@@ -151,7 +166,15 @@ static bool uart_write_nonblocking(uart_inst_t* uart, const uint8_t* data, size_
     if (!uart || !data || len == 0) {
         return false;
     }
-    
+
+    // Preferred path: hand the frame to the TX DMA ring and return immediately.
+    // The DMA channel streams it into the UART FIFO (DREQ paced) so the
+    // protocol path never spins on uart_is_writable() during log storms.
+    if (uart_tx_dma_is_initialized()) {
+        return uart_tx_dma_write(data, len);
+    }
+
+    // Fallback: polled write with timeout (DMA init failed or not yet run)
     uint32_t start_time = to_ms_since_boot(get_absolute_time());
     size_t written = 0;
     
@@ -288,6 +311,10 @@ void protocol_init(void) {
     uart_set_format(ESP32_UART_ID, 8, 1, UART_PARITY_NONE);
     uart_set_hw_flow(ESP32_UART_ID, false, false);
     uart_set_fifo_enabled(ESP32_UART_ID, true);
+
+    // DMA-driven TX: frames stream into the FIFO without CPU polling.
+    // If no channel is free we keep the polled fallback in uart_write_nonblocking()
+    uart_tx_dma_init(ESP32_UART_ID);
     
     // Initialize statistics
     memset(&g_stats, 0, sizeof(protocol_stats_t));
@@ -384,6 +411,67 @@ bool protocol_send_status(const status_payload_t* status) {
     return send_packet(MSG_STATUS, (const uint8_t*)status, sizeof(status_payload_t));
 }
 
+// Delta status state - last payload actually sent and frames since keyframe
+static status_payload_t g_last_status;
+static bool g_last_status_valid = false;
+static uint8_t g_delta_frames_since_keyframe = 0;
+
+// Append `field` to the delta payload and set its mask bit if it changed.
+// Field bit order comes from STATUS_FIELD_LIST in protocol_defs.h - the same
+// schema that generates status_payload_t and the ESP32's apply table.
+#define DELTA_FIELD(bit, field)                                               \
+    do {                                                                      \
+        if (status->field != g_last_status.field) {                           \
+            mask |= (1u << (bit));                                            \
+            memcpy(&payload[len], &status->field, sizeof(status->field));     \
+            len += sizeof(status->field);                                     \
+        }                                                                     \
+    } while (0)
+
+bool protocol_send_status_delta(const status_payload_t* status) {
+    // Keyframe conditions: no baseline yet (boot or post-handshake reset),
+    // or the periodic interval elapsed
+    if (!g_last_status_valid ||
+        g_delta_frames_since_keyframe >= STATUS_DELTA_KEYFRAME_INTERVAL - 1) {
+        if (!protocol_send_status(status)) {
+            return false;
+        }
+        g_last_status = *status;
+        g_last_status_valid = true;
+        g_delta_frames_since_keyframe = 0;
+        return true;
+    }
+
+    uint8_t payload[STATUS_DELTA_MASK_SIZE + sizeof(status_payload_t)];
+    uint32_t mask = 0;
+    uint8_t len = STATUS_DELTA_MASK_SIZE;  // Fields append after the mask
+
+    // One DELTA_FIELD per schema entry, in mask-bit order
+#define DELTA_EMIT(bit, ftype, name) DELTA_FIELD(bit, name);
+    STATUS_FIELD_LIST(DELTA_EMIT)
+#undef DELTA_EMIT
+
+    // If nearly everything moved the delta costs more than a full frame -
+    // send the keyframe instead (also resets the interval)
+    if (len >= sizeof(status_payload_t)) {
+        if (!protocol_send_status(status)) {
+            return false;
+        }
+        g_delta_frames_since_keyframe = 0;
+    } else {
+        memcpy(&payload[0], &mask, STATUS_DELTA_MASK_SIZE);
+        if (!send_packet(MSG_STATUS_DELTA, payload, len)) {
+            return false;
+        }
+        g_delta_frames_since_keyframe++;
+    }
+
+    g_last_status = *status;
+    return true;
+}
+
+#undef DELTA_FIELD
+
 // protocol_send_power_meter() removed (v2.32 - hardware power metering removed, MQTT only)
 
 bool protocol_send_alarm(uint8_t code, uint8_t severity, uint16_t value) {
@@ -485,6 +573,10 @@ bool protocol_send_config(const config_payload_t* config) {
     return send_packet(MSG_CONFIG, (const uint8_t*)config, sizeof(config_payload_t));
 }
 
+bool protocol_send_config_snapshot(const config_snapshot_payload_t* snapshot) {
+    return send_packet(MSG_CONFIG_SNAPSHOT, (const uint8_t*)snapshot, sizeof(config_snapshot_payload_t));
+}
+
 bool protocol_send_env_config(const env_config_payload_t* env_config) {
     return send_packet(MSG_ENV_CONFIG, (const uint8_t*)env_config, sizeof(env_config_payload_t));
 }
@@ -527,6 +619,71 @@ bool protocol_send_log(uint8_t level, const char* message) {
     return send_packet(MSG_LOG, payload, msg_len + 1);
 }
 
+bool protocol_send_log_compact(uint8_t level, uint16_t id, uint8_t argc, const int32_t* args) {
+    if (argc > LOG_COMPACT_MAX_ARGS || (argc > 0 && !args)) {
+        return false;
+    }
+
+    // Payload format: [level][id_lo][id_hi][argc][int32 args LE x argc]
+    uint8_t payload[4 + LOG_COMPACT_MAX_ARGS * 4];
+    payload[0] = level;
+    payload[1] = (uint8_t)(id & 0xFF);
+    payload[2] = (uint8_t)(id >> 8);
+    payload[3] = argc;
+    for (uint8_t i = 0; i < argc; i++) {
+        uint32_t v = (uint32_t)args[i];
+        payload[4 + i * 4] = (uint8_t)(v & 0xFF);
+        payload[5 + i * 4] = (uint8_t)((v >> 8) & 0xFF);
+        payload[6 + i * 4] = (uint8_t)((v >> 16) & 0xFF);
+        payload[7 + i * 4] = (uint8_t)((v >> 24) & 0xFF);
+    }
+
+    return send_packet(MSG_LOG_COMPACT, payload, 4 + (size_t)argc * 4);
+}
+
+#if TRACEPOINTS
+bool protocol_send_trace(uint32_t cpu_hz, const trace_record_t* records, uint8_t count) {
+    if (count == 0 || count > TRACE_BATCH_MAX_RECORDS || !records) {
+        return false;
+    }
+
+    // Payload format: [cpu_hz u32 LE][count][trace_record_t x count]
+    uint8_t payload[5 + TRACE_BATCH_MAX_RECORDS * sizeof(trace_record_t)];
+    payload[0] = (uint8_t)(cpu_hz & 0xFF);
+    payload[1] = (uint8_t)((cpu_hz >> 8) & 0xFF);
+    payload[2] = (uint8_t)((cpu_hz >> 16) & 0xFF);
+    payload[3] = (uint8_t)((cpu_hz >> 24) & 0xFF);
+    payload[4] = count;
+    memcpy(&payload[5], records, (size_t)count * sizeof(trace_record_t));
+
+    return send_packet(MSG_TRACE, payload, 5 + (size_t)count * sizeof(trace_record_t));
+}
+#endif // TRACEPOINTS
+
+bool protocol_send_jitter(const jitter_payload_t* jitter) {
+    return send_packet(MSG_JITTER, (const uint8_t*)jitter, sizeof(jitter_payload_t));
+}
+
+bool protocol_send_sensor_burst(const sensor_burst_payload_t* burst) {
+    // Variable length: only the valid prefix of samples[] goes on the wire,
+    // so the partial last frame of a capture doesn't ship zero padding
+    uint8_t length = (uint8_t)(offsetof(sensor_burst_payload_t, samples) +
+                               burst->count * sizeof(uint16_t));
+    return send_packet(MSG_SENSOR_BURST, (const uint8_t*)burst, length);
+}
+
+bool protocol_take_warm_state_request(void) {
+    if (!g_warm_state_requested) {
+        return false;
+    }
+    g_warm_state_requested = false;
+    return true;
+}
+
+bool protocol_send_warm_state(const warm_state_payload_t* warm) {
+    return send_packet(MSG_WARM_STATE, (const uint8_t*)warm, sizeof(warm_state_payload_t));
+}
+
 bool protocol_send_diag_header(const diag_header_payload_t* header) {
     return send_packet(MSG_DIAGNOSTICS, (const uint8_t*)header, sizeof(diag_header_payload_t));
 }
@@ -535,10 +692,106 @@ bool protocol_send_diag_result(const diag_result_payload_t* result) {
     return send_packet(MSG_DIAGNOSTICS, (const uint8_t*)result, sizeof(diag_result_payload_t));
 }
 
+// -----------------------------------------------------------------------------
+// Batched Frames (MSG_BATCH)
+// -----------------------------------------------------------------------------
+// Sub-messages accumulate here during a telemetry cycle and go out as a single
+// header + CRC frame. A lone sub-message is sent unwrapped - no point paying
+// the batch overhead for one message.
+
+static uint8_t g_batch_buffer[PROTOCOL_MAX_PAYLOAD];
+static uint8_t g_batch_used = 0;
+static uint8_t g_batch_count = 0;
+
+bool protocol_batch_add(uint8_t type, const uint8_t* payload, uint8_t length) {
+    if (length > PROTOCOL_MAX_PAYLOAD - PROTOCOL_BATCH_SUBHDR_SIZE) {
+        // Too large to ever fit in a batch - send as its own frame
+        return send_packet(type, payload, length);
+    }
+
+    // Flush first if this sub-message won't fit alongside what's queued
+    if (g_batch_used + PROTOCOL_BATCH_SUBHDR_SIZE + length > PROTOCOL_MAX_PAYLOAD) {
+        if (!protocol_batch_flush()) {
+            return false;
+        }
+    }
+
+    g_batch_buffer[g_batch_used++] = type;
+    g_batch_buffer[g_batch_used++] = length;
+    if (length > 0 && payload != NULL) {
+        memcpy(&g_batch_buffer[g_batch_used], payload, length);
+        g_batch_used += length;
+    }
+    g_batch_count++;
+    return true;
+}
+
+bool protocol_batch_flush(void) {
+    if (g_batch_count == 0) {
+        return true;
+    }
+
+    bool result;
+    if (g_batch_count == 1) {
+        // Single sub-message: unwrap and send directly
+        result = send_packet(g_batch_buffer[0], &g_batch_buffer[2], g_batch_buffer[1]);
+    } else {
+        result = send_packet(MSG_BATCH, g_batch_buffer, g_batch_used);
+    }
+
+    g_batch_used = 0;
+    g_batch_count = 0;
+    return result;
+}
+
 // -----------------------------------------------------------------------------
 // Receive Processing
 // -----------------------------------------------------------------------------
 
+// Deliver a validated packet to the registered callback, unpacking MSG_BATCH
+// containers into their sub-messages so handlers never see the wrapper
+static void dispatch_packet(const packet_t* packet) {
+    if (!g_packet_callback) {
+        DEBUG_PRINT("Protocol: WARNING - No callback registered for packet 0x%02X\n",
+                   packet->type);
+        return;
+    }
+
+    if (packet->type != MSG_BATCH) {
+        g_packet_callback(packet);
+        return;
+    }
+
+    // Walk [type | length | payload] sub-messages
+    uint8_t offset = 0;
+    while (offset + PROTOCOL_BATCH_SUBHDR_SIZE <= packet->length) {
+        uint8_t sub_type = packet->payload[offset];
+        uint8_t sub_length = packet->payload[offset + 1];
+        offset += PROTOCOL_BATCH_SUBHDR_SIZE;
+
+        if (sub_length > PROTOCOL_MAX_PAYLOAD || offset + sub_length > packet->length) {
+            g_stats.packet_errors++;
+            LOG_WARN("Protocol: Malformed batch sub-message (type=0x%02X, len=%d)\n",
+                   sub_type, sub_length);
+            break;
+        }
+
+        packet_t sub_packet;
+        sub_packet.type = sub_type;
+        sub_packet.length = sub_length;
+        sub_packet.seq = packet->seq;
+        sub_packet.crc = packet->crc;
+        sub_packet.valid = true;
+        sub_packet.timestamp_ms = packet->timestamp_ms;
+        if (sub_length > 0) {
+            memcpy(sub_packet.payload, &packet->payload[offset], sub_length);
+        }
+        offset += sub_length;
+
+        g_packet_callback(&sub_packet);
+    }
+}
+
 static void process_byte(uint8_t byte) {
     // CRITICAL: Don't process bytes if bootloader is active
     // This prevents bootloader data (0x55AA chunks) from being misinterpreted as protocol packets
@@ -641,6 +894,32 @@ static void process_byte(uint8_t byte) {
                     if (packet.type == MSG_HANDSHAKE) {
                         g_handshake_complete = true;
                         g_stats.handshake_complete = true;
+
+                        // Telemetry rate negotiation: honor the ESP32's requested
+                        // per-activity status rates if it advertises the capability
+                        if (packet.length >= sizeof(handshake_payload_t)) {
+                            handshake_payload_t hs;
+                            memcpy(&hs, packet.payload, sizeof(handshake_payload_t));
+                            if (hs.capabilities & PROTOCOL_CAP_RATE_NEGOTIATION) {
+                                if (hs.status_rate_idle_hz >= PROTOCOL_STATUS_RATE_MIN_HZ &&
+                                    hs.status_rate_idle_hz <= PROTOCOL_STATUS_RATE_MAX_HZ) {
+                                    g_status_rate_idle_hz = hs.status_rate_idle_hz;
+                                }
+                                if (hs.status_rate_active_hz >= PROTOCOL_STATUS_RATE_MIN_HZ &&
+                                    hs.status_rate_active_hz <= PROTOCOL_STATUS_RATE_MAX_HZ) {
+                                    g_status_rate_active_hz = hs.status_rate_active_hz;
+                                }
+                                LOG_INFO("Protocol: Negotiated status rates (idle=%dHz, active=%dHz)\n",
+                                       g_status_rate_idle_hz, g_status_rate_active_hz);
+                            }
+                        }
+                        // ESP32 side starts with no delta baseline - force the
+                        // next status send to be a full keyframe
+                        g_last_status_valid = false;
+                        // Every handshake means the ESP32 (re)booted - queue a
+                        // warm-state snapshot so it doesn't have to poll us
+                        // back to a truthful view (Core 1 loop consumes this)
+                        g_warm_state_requested = true;
                         LOG_INFO("Protocol: Handshake complete\n");
                     }
                     
@@ -660,13 +939,8 @@ static void process_byte(uint8_t byte) {
                         // ESP32 is busy - could slow down command sending
                     }
                     
-                    // Call callback
-                    if (g_packet_callback) {
-                        g_packet_callback(&packet);
-                    } else {
-                        DEBUG_PRINT("Protocol: WARNING - No callback registered for packet 0x%02X\n",
-                                   packet.type);
-                    }
+                    // Deliver to handler (unpacks MSG_BATCH containers)
+                    dispatch_packet(&packet);
                 } else {
                     // CRC validation failed
                     g_stats.crc_errors++;
@@ -783,13 +1057,23 @@ bool protocol_handshake_complete(void) {
     return g_handshake_complete;
 }
 
+uint32_t protocol_get_status_interval_ms(bool active) {
+    uint8_t rate_hz = active ? g_status_rate_active_hz : g_status_rate_idle_hz;
+    if (rate_hz == 0) {
+        return STATUS_SEND_PERIOD_MS;  // Not negotiated - legacy fixed rate
+    }
+    return 1000u / rate_hz;
+}
+
 void protocol_request_handshake(void) {
     handshake_payload_t handshake = {
         .protocol_version_major = PROTOCOL_VERSION_MAJOR,
         .protocol_version_minor = PROTOCOL_VERSION_MINOR,
-        .capabilities = 0,  // No special capabilities yet
+        .capabilities = PROTOCOL_CAP_RATE_NEGOTIATION,
         .max_retry_count = PROTOCOL_RETRY_COUNT,
-        .ack_timeout_ms = PROTOCOL_ACK_TIMEOUT_MS
+        .ack_timeout_ms = PROTOCOL_ACK_TIMEOUT_MS,
+        .status_rate_idle_hz = 0,    // Rates are requested by the ESP32 side
+        .status_rate_active_hz = 0
     };
     send_packet(MSG_HANDSHAKE, (const uint8_t*)&handshake, sizeof(handshake_payload_t));
     g_handshake_request_time = to_ms_since_boot(get_absolute_time());
@@ -54,6 +54,22 @@ static uint32_t g_last_esp32_heartbeat = 0;
 static uint32_t g_safe_state_entered_time = 0;
 static bool g_defensive_mode = false;  // True when ESP32 not connected - machine forced to IDLE
 
+// Scheduled-wake override of defensive mode (see safety_defensive_wake_override)
+static uint32_t g_wake_override_start = 0;
+static uint32_t g_wake_override_duration = 0;  // 0 = no override active
+
+static bool safety_wake_override_active(void) {
+    if (g_wake_override_duration == 0) {
+        return false;
+    }
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if (now - g_wake_override_start >= g_wake_override_duration) {
+        g_wake_override_duration = 0;  // Expired - defensive forcing resumes
+        return false;
+    }
+    return true;
+}
+
 // Water sensor debounce state
 static uint8_t g_reservoir_debounce_count = 0;
 static uint8_t g_tank_level_debounce_count = 0;
@@ -72,11 +88,17 @@ static uint32_t g_steam_ssr_on_time = 0;
 static float g_brew_temp_when_on = 0.0f;
 static float g_steam_temp_when_on = 0.0f;
 
-// Safe state UI (LED and buzzer)
-static uint32_t g_led_last_toggle = 0;
-static bool g_led_state = false;
-static uint8_t g_buzzer_beep_count = 0;
-static uint32_t g_buzzer_last_beep = 0;
+// Safe state UI (LED and buzzer) - IRQ-driven hardware alarm timers, armed
+// on safe-state entry and cancelled on reset. The main loop has no UI
+// obligation while in safe state, and the blink keeps running even if the
+// loop stalls (the watchdog would catch that, but the operator sees the
+// fault pattern immediately either way).
+static repeating_timer_t g_led_timer;
+static repeating_timer_t g_buzzer_timer;
+static bool g_led_timer_armed = false;
+static bool g_buzzer_timer_armed = false;
+static volatile bool g_led_state = false;
+static volatile uint8_t g_buzzer_toggles = 0;
 
 // Rate-limiting for safety log messages (avoid spamming during faults)
 // Messages only print once per SAFETY_MSG_RATE_LIMIT_MS while condition persists
@@ -122,27 +144,6 @@ static bool check_water_sensor_debounced(int8_t gpio_pin, uint8_t* debounce_coun
     return *last_state;  // Return last stable state
 }
 
-/**
- * Check if NTC sensor has fault (open or short circuit)
- */
-static bool check_ntc_fault(float temp_c) {
-    if (isnan(temp_c) || isinf(temp_c)) {
-        return true;  // Invalid reading
-    }
-    
-    // Check for open circuit (SAF-023)
-    if (temp_c > SAFETY_NTC_OPEN_CIRCUIT_C) {
-        return true;
-    }
-    
-    // Check for short circuit (SAF-024)
-    if (temp_c < SAFETY_NTC_SHORT_CIRCUIT_C) {
-        return true;
-    }
-    
-    return false;
-}
-
 /**
  * Disable all outputs (SAF-030, SAF-004)
  */
@@ -152,22 +153,30 @@ static void disable_all_outputs(void) {
     control_set_output(1, 0, 1);  // Steam heater OFF (manual mode)
     control_set_pump(0);          // Pump OFF
     
-    // Disable relays via hardware
+    // Disable relays via the output-image interlock: clears them in one SIO
+    // write immediately and keeps them masked low at every commit, so
+    // control code writing the shadow image cannot re-energize anything
+    // until safety_reset() releases the mask
     const pcb_config_t* pcb = pcb_config_get();
     if (pcb) {
+        uint32_t mask = 0;
         if (pcb->pins.relay_pump >= 0) {
-            hw_set_gpio(pcb->pins.relay_pump, false);
+            mask |= 1u << pcb->pins.relay_pump;
         }
         if (pcb->pins.relay_brew_solenoid >= 0) {
-            hw_set_gpio(pcb->pins.relay_brew_solenoid, false);
+            mask |= 1u << pcb->pins.relay_brew_solenoid;
         }
         if (pcb->pins.relay_water_led >= 0) {
-            hw_set_gpio(pcb->pins.relay_water_led, false);
+            mask |= 1u << pcb->pins.relay_water_led;
+        }
+        if (pcb->pins.relay_fill_solenoid >= 0) {
+            mask |= 1u << pcb->pins.relay_fill_solenoid;
         }
         if (pcb->pins.relay_spare >= 0) {
-            hw_set_gpio(pcb->pins.relay_spare, false);
+            mask |= 1u << pcb->pins.relay_spare;
         }
-        
+        hw_gpio_out_interlock(mask);
+
         // Disable SSR via PWM
         if (pcb->pins.ssr_brew >= 0) {
             // Note: PWM would need to be initialized first
@@ -180,34 +189,158 @@ static void disable_all_outputs(void) {
 }
 
 /**
- * Update safe state UI (LED blinking and buzzer)
+ * Safe state LED blink at 2Hz (SAF-030). Runs in hardware alarm IRQ
+ * context - just a toggle, no allocation or logging.
  */
-static void update_safe_state_ui(void) {
+static bool safe_led_timer_cb(repeating_timer_t* t) {
+    (void)t;
     const pcb_config_t* pcb = pcb_config_get();
-    if (!pcb) {
-        return;
+    if (pcb && pcb->pins.led_status >= 0) {
+        g_led_state = !g_led_state;
+        hw_set_gpio(pcb->pins.led_status, g_led_state);
     }
-    
-    uint32_t now = to_ms_since_boot(get_absolute_time());
-    
-    // Blink status LED at 2Hz (SAF-030)
-    if (pcb->pins.led_status >= 0) {
-        if (now - g_led_last_toggle >= SAFE_STATE_LED_PERIOD_MS / 2) {
-            g_led_state = !g_led_state;
-            hw_set_gpio(pcb->pins.led_status, g_led_state);
-            g_led_last_toggle = now;
-        }
+    return true;  // Keep repeating until safety_reset() cancels
+}
+
+/**
+ * Safe state buzzer: 3 beeps of BUZZER_BEEP_DURATION_MS then silent
+ * (SAF-030). Self-cancels after the pattern - each beep is one on toggle
+ * and one off toggle, so the buzzer always ends low.
+ */
+static bool safe_buzzer_timer_cb(repeating_timer_t* t) {
+    (void)t;
+    const pcb_config_t* pcb = pcb_config_get();
+    if (!pcb || pcb->pins.buzzer < 0) {
+        g_buzzer_timer_armed = false;
+        return false;
     }
-    
-    // Buzzer: 3 beeps then silent (SAF-030)
-    if (pcb->pins.buzzer >= 0 && g_buzzer_beep_count < BUZZER_BEEP_COUNT) {
-        if (now - g_buzzer_last_beep >= BUZZER_BEEP_DURATION_MS * 2) {
-            // Toggle buzzer for beep
-            hw_toggle_gpio(pcb->pins.buzzer);
-            g_buzzer_beep_count++;
-            g_buzzer_last_beep = now;
+
+    g_buzzer_toggles++;
+    if (g_buzzer_toggles >= BUZZER_BEEP_COUNT * 2) {
+        hw_set_gpio(pcb->pins.buzzer, false);  // Pattern complete
+        g_buzzer_timer_armed = false;
+        return false;
+    }
+    hw_toggle_gpio(pcb->pins.buzzer);
+    return true;
+}
+
+// =============================================================================
+// Limit Table (SAF-020, SAF-021, SAF-023, SAF-024)
+// =============================================================================
+// The over-temperature and NTC plausibility checks are pure range checks, so
+// they are compiled into a table and evaluated in one tight loop over a
+// sensor snapshot instead of per-condition branches. The loop is constant
+// time and branch-predictable, which makes the pass cheap enough to also run
+// between control ticks (see safety_check_limits) - faster fault detection
+// shrinks the worst-case SSR-on time after a sensor failure. The debounced
+// water interlocks and SSR timers stay in safety_check(): they carry state
+// and are tied to the fixed tick rate.
+
+// Sentinel bounds for rows that only limit one side
+#define LIMIT_NO_MIN    (-1000.0f)
+#define LIMIT_NO_MAX    (1000.0f)
+
+// Indices into the sensor snapshot passed to the limit loop
+typedef enum {
+    LIMIT_VALUE_BREW_TEMP = 0,
+    LIMIT_VALUE_STEAM_TEMP,
+    LIMIT_VALUE_COUNT
+} limit_value_index_t;
+
+// Feature gates (bit positions in the per-pass feature mask)
+typedef enum {
+    LIMIT_FEATURE_BREW_NTC = 0,
+    LIMIT_FEATURE_STEAM_NTC
+} limit_feature_t;
+
+typedef struct {
+    uint8_t value;          // Index into the sensor snapshot
+    uint8_t feature;        // LIMIT_FEATURE_* gate (row skipped if absent)
+    float min;              // Readings below this trip the row
+    float max;              // Readings at or above this trip the row
+    uint8_t flag;           // SAFETY_FLAG_* set when tripped
+    uint8_t alarm;          // ALARM_* raised when tripped
+    bool force_alarm;       // true = overrides a pending alarm (over-temp)
+    const char* message;    // Rate-limited log text
+} safety_limit_row_t;
+
+// A reading passes a row when (min <= value < max); NaN/Inf fail every
+// comparison and therefore trip the plausibility rows, covering the old
+// isnan/isinf checks for free.
+static const safety_limit_row_t SAFETY_LIMITS[] = {
+    // SAF-020/021: over-temperature
+    { LIMIT_VALUE_BREW_TEMP,  LIMIT_FEATURE_BREW_NTC,  LIMIT_NO_MIN, SAFETY_BREW_MAX_TEMP_C,
+      SAFETY_FLAG_OVER_TEMP, ALARM_OVER_TEMP, true, "Brew boiler over temperature" },
+    { LIMIT_VALUE_STEAM_TEMP, LIMIT_FEATURE_STEAM_NTC, LIMIT_NO_MIN, SAFETY_STEAM_MAX_TEMP_C,
+      SAFETY_FLAG_OVER_TEMP, ALARM_OVER_TEMP, true, "Steam boiler over temperature" },
+    // SAF-023/024: NTC plausibility (open/short circuit)
+    { LIMIT_VALUE_BREW_TEMP,  LIMIT_FEATURE_BREW_NTC,  SAFETY_NTC_SHORT_CIRCUIT_C, SAFETY_NTC_OPEN_CIRCUIT_C,
+      SAFETY_FLAG_SENSOR_FAIL, ALARM_SENSOR_FAIL, false, "Brew NTC sensor fault" },
+    { LIMIT_VALUE_STEAM_TEMP, LIMIT_FEATURE_STEAM_NTC, SAFETY_NTC_SHORT_CIRCUIT_C, SAFETY_NTC_OPEN_CIRCUIT_C,
+      SAFETY_FLAG_SENSOR_FAIL, ALARM_SENSOR_FAIL, false, "Steam NTC sensor fault" },
+};
+
+#define SAFETY_LIMIT_ROW_COUNT  (sizeof(SAFETY_LIMITS) / sizeof(SAFETY_LIMITS[0]))
+
+// Per-row log rate limiting (the fast pass may run at kHz rates)
+static uint32_t g_limit_last_msg[SAFETY_LIMIT_ROW_COUNT];
+
+/**
+ * Evaluate the limit table against a sensor snapshot
+ * Sets safety flags and alarm for tripped rows.
+ * @return SAFETY_CRITICAL if any row tripped, SAFETY_OK otherwise
+ */
+static safety_state_t __not_in_flash_func(evaluate_limit_table)(const float* snapshot, uint32_t now) {
+    uint8_t feature_mask = 0;
+    if (machine_has_brew_ntc()) {
+        feature_mask |= (1u << LIMIT_FEATURE_BREW_NTC);
+    }
+    if (machine_has_steam_ntc()) {
+        feature_mask |= (1u << LIMIT_FEATURE_STEAM_NTC);
+    }
+
+    safety_state_t result = SAFETY_OK;
+
+    for (uint32_t i = 0; i < SAFETY_LIMIT_ROW_COUNT; i++) {
+        const safety_limit_row_t* row = &SAFETY_LIMITS[i];
+        if (!(feature_mask & (1u << row->feature))) {
+            continue;  // Sensor not present on this machine type
+        }
+
+        float value = snapshot[row->value];
+        if (value >= row->min && value < row->max) {
+            continue;  // In range (NaN fails both comparisons and trips)
+        }
+
+        g_safety_flags |= row->flag;
+        if (row->force_alarm || g_last_alarm == ALARM_NONE) {
+            g_last_alarm = row->alarm;
+        }
+        result = SAFETY_CRITICAL;
+
+        if ((now - g_limit_last_msg[i]) >= SAFETY_MSG_RATE_LIMIT_MS) {
+            g_limit_last_msg[i] = now;
+            LOG_PRINT("SAFETY: %s! (temp=%.1fC)\n", row->message, value);
         }
     }
+
+    return result;
+}
+
+safety_state_t __not_in_flash_func(safety_check_limits)(void) {
+    if (bootloader_is_active()) {
+        return SAFETY_OK;  // Already safe during OTA
+    }
+
+    sensor_data_t data;
+    sensors_get_data(&data);
+
+    float snapshot[LIMIT_VALUE_COUNT];
+    snapshot[LIMIT_VALUE_BREW_TEMP] = data.brew_temp / 10.0f;
+    snapshot[LIMIT_VALUE_STEAM_TEMP] = data.steam_temp / 10.0f;
+
+    return evaluate_limit_table(snapshot, to_ms_since_boot(get_absolute_time()));
 }
 
 // =============================================================================
@@ -239,12 +372,10 @@ void safety_init(void) {
     g_brew_temp_when_on = 0.0f;
     g_steam_temp_when_on = 0.0f;
     
-    // Initialize UI state
-    g_led_last_toggle = 0;
+    // Initialize UI state (timers armed lazily on safe-state entry)
     g_led_state = false;
-    g_buzzer_beep_count = 0;
-    g_buzzer_last_beep = 0;
-    
+    g_buzzer_toggles = 0;
+
     LOG_PRINT("Safety system initialized\n");
 }
 
@@ -399,75 +530,40 @@ safety_state_t __not_in_flash_func(safety_check)(void) {
     }
     
     // =========================================================================
-    // SAF-020, SAF-021, SAF-022: Over-Temperature Protection
-    // Machine-type aware - only check sensors that exist
+    // SAF-020, SAF-021, SAF-023, SAF-024: Temperature Limits (table-driven)
+    // Over-temperature and NTC plausibility in one pass over the limit table
     // =========================================================================
-    
+
     const machine_features_t* features = machine_get_features();
-    
-    // Check brew boiler temperature (SAF-020) - only if machine has brew NTC
-    if (features && machine_has_brew_ntc()) {
-        if (!isnan(brew_temp_c) && !isinf(brew_temp_c)) {
-            if (brew_temp_c >= SAFETY_BREW_MAX_TEMP_C) {
-                g_brew_over_temp = true;
-                g_safety_flags |= SAFETY_FLAG_OVER_TEMP;
-                g_last_alarm = ALARM_OVER_TEMP;
-                result = SAFETY_CRITICAL;
-                LOG_PRINT("SAFETY: Brew boiler over temperature: %.1fC (max: %.1fC)\n", brew_temp_c, SAFETY_BREW_MAX_TEMP_C);
-            } else if (brew_temp_c <= (SAFETY_BREW_MAX_TEMP_C - SAFETY_TEMP_HYSTERESIS_C)) {
-                // Hysteresis: re-enable 10°C below max (SAF-025)
-                g_brew_over_temp = false;
-            }
+
+    float limit_snapshot[LIMIT_VALUE_COUNT];
+    limit_snapshot[LIMIT_VALUE_BREW_TEMP] = brew_temp_c;
+    limit_snapshot[LIMIT_VALUE_STEAM_TEMP] = steam_temp_c;
+
+    safety_state_t limit_result = evaluate_limit_table(limit_snapshot, now);
+    if (limit_result > result) {
+        result = limit_result;
+    }
+
+    // Over-temp latch with hysteresis: re-enable 10°C below max (SAF-025)
+    if (features && machine_has_brew_ntc() && !isnan(brew_temp_c) && !isinf(brew_temp_c)) {
+        if (brew_temp_c >= SAFETY_BREW_MAX_TEMP_C) {
+            g_brew_over_temp = true;
+        } else if (brew_temp_c <= (SAFETY_BREW_MAX_TEMP_C - SAFETY_TEMP_HYSTERESIS_C)) {
+            g_brew_over_temp = false;
         }
     }
-    
-    // Check steam boiler temperature (SAF-021) - only if machine has steam NTC
-    if (features && machine_has_steam_ntc()) {
-        if (!isnan(steam_temp_c) && !isinf(steam_temp_c)) {
-            if (steam_temp_c >= SAFETY_STEAM_MAX_TEMP_C) {
-                g_steam_over_temp = true;
-                g_safety_flags |= SAFETY_FLAG_OVER_TEMP;
-                g_last_alarm = ALARM_OVER_TEMP;
-                result = SAFETY_CRITICAL;
-                LOG_PRINT("SAFETY: Steam boiler over temperature: %.1fC (max: %.1fC)\n", steam_temp_c, SAFETY_STEAM_MAX_TEMP_C);
-            } else if (steam_temp_c <= (SAFETY_STEAM_MAX_TEMP_C - SAFETY_TEMP_HYSTERESIS_C)) {
-                g_steam_over_temp = false;
-            }
+    if (features && machine_has_steam_ntc() && !isnan(steam_temp_c) && !isinf(steam_temp_c)) {
+        if (steam_temp_c >= SAFETY_STEAM_MAX_TEMP_C) {
+            g_steam_over_temp = true;
+        } else if (steam_temp_c <= (SAFETY_STEAM_MAX_TEMP_C - SAFETY_TEMP_HYSTERESIS_C)) {
+            g_steam_over_temp = false;
         }
     }
-    
+
     // Note: Group head thermocouple (SAF-022) removed in v2.24.3
     // Boiler NTC sensors provide sufficient over-temperature protection
-    
-    // =========================================================================
-    // SAF-023, SAF-024: NTC Sensor Fault Detection
-    // Machine-type aware - only check sensors that exist
-    // =========================================================================
-    
-    // Only check brew NTC if machine should have one
-    if (features && machine_has_brew_ntc()) {
-        if (check_ntc_fault(brew_temp_c)) {
-            g_safety_flags |= SAFETY_FLAG_SENSOR_FAIL;
-            if (g_last_alarm == ALARM_NONE) {
-                g_last_alarm = ALARM_SENSOR_FAIL;
-            }
-            result = SAFETY_CRITICAL;  // Critical: disable brew heater
-            LOG_PRINT("SAFETY: Brew NTC sensor fault! (temp=%.1fC)\n", brew_temp_c);
-        }
-    }
-    
-    // Only check steam NTC if machine should have one
-    if (features && machine_has_steam_ntc()) {
-        if (check_ntc_fault(steam_temp_c)) {
-            g_safety_flags |= SAFETY_FLAG_SENSOR_FAIL;
-            if (g_last_alarm == ALARM_NONE) {
-                g_last_alarm = ALARM_SENSOR_FAIL;
-            }
-            result = SAFETY_CRITICAL;  // Critical: disable steam heater
-            LOG_PRINT("SAFETY: Steam NTC sensor fault! (temp=%.1fC)\n", steam_temp_c);
-        }
-    }
-    
+
     // =========================================================================
     // SAF-031: SSR Maximum On Time Check
     // Machine-type aware - only check SSRs that exist
@@ -558,10 +654,10 @@ safety_state_t __not_in_flash_func(safety_check)(void) {
     // =========================================================================
     
     bool esp32_connected = (now - g_last_esp32_heartbeat) < SAFETY_HEARTBEAT_TIMEOUT_MS;
-    
+
         if (!esp32_connected) {
         g_safety_flags |= SAFETY_FLAG_COMM_TIMEOUT;
-        
+
         // Enter defensive mode: force machine to IDLE state for safety
         // Machine should not operate without ESP32 control/monitoring
         if (!g_defensive_mode) {
@@ -570,10 +666,12 @@ safety_state_t __not_in_flash_func(safety_check)(void) {
             // Force machine to IDLE mode immediately
             state_set_mode(MODE_IDLE);
         }
-        
-        // Keep machine in IDLE if it tries to change mode
+
+        // Keep machine in IDLE if it tries to change mode - unless a
+        // scheduled wake holds a bounded override (the Pico's own safety
+        // layers keep monitoring; only this policy is suspended)
         machine_mode_t current_mode = state_get_mode();
-        if (current_mode != MODE_IDLE) {
+        if (current_mode != MODE_IDLE && !safety_wake_override_active()) {
             LOG_PRINT("Defensive mode: forcing IDLE (current mode: %d)\n", current_mode);
             state_set_mode(MODE_IDLE);
         }
@@ -597,12 +695,10 @@ safety_state_t __not_in_flash_func(safety_check)(void) {
     if (result == SAFETY_CRITICAL) {
         safety_enter_safe_state();
     }
-    
-    // Update safe state UI if in safe state
-    if (g_safe_state) {
-        update_safe_state_ui();
-    }
-    
+
+    // Safe state UI runs on hardware alarm timers armed at entry - no
+    // per-pass work here
+
     return result;
 }
 
@@ -617,12 +713,21 @@ void safety_enter_safe_state(void) {
         
         // Disable all outputs (SAF-004, SAF-030)
         disable_all_outputs();
-        
-        // Reset UI state
-        g_led_last_toggle = 0;
-        g_led_state = false;
-        g_buzzer_beep_count = 0;
-        g_buzzer_last_beep = 0;
+
+        // Arm the indicator timers (SAF-030): hardware alarms drive the
+        // 2Hz LED blink and the 3-beep pattern from IRQ context, so the
+        // main loop spends zero cycles on UI while in safe state.
+        // Negative period = fixed-rate scheduling (no per-callback drift).
+        if (!g_led_timer_armed) {
+            g_led_state = false;
+            g_led_timer_armed = add_repeating_timer_ms(
+                -(SAFE_STATE_LED_PERIOD_MS / 2), safe_led_timer_cb, NULL, &g_led_timer);
+        }
+        if (!g_buzzer_timer_armed) {
+            g_buzzer_toggles = 0;
+            g_buzzer_timer_armed = add_repeating_timer_ms(
+                -BUZZER_BEEP_DURATION_MS, safe_buzzer_timer_cb, NULL, &g_buzzer_timer);
+        }
     }
     g_safe_state = true;
 }
@@ -638,12 +743,26 @@ bool safety_reset(void) {
         g_safe_state = false;
         g_last_alarm = ALARM_NONE;
         g_safe_state_entered_time = 0;
-        
-        // Reset UI
+
+        // Release the output interlock - commits apply the control image again
+        hw_gpio_out_interlock(0);
+
+        // Disarm the indicator timers and restore normal LED state
+        if (g_led_timer_armed) {
+            cancel_repeating_timer(&g_led_timer);
+            g_led_timer_armed = false;
+        }
+        if (g_buzzer_timer_armed) {
+            cancel_repeating_timer(&g_buzzer_timer);
+            g_buzzer_timer_armed = false;
+        }
         const pcb_config_t* pcb = pcb_config_get();
         if (pcb && pcb->pins.led_status >= 0) {
             hw_set_gpio(pcb->pins.led_status, true);  // LED on (normal)
         }
+        if (pcb && pcb->pins.buzzer >= 0) {
+            hw_set_gpio(pcb->pins.buzzer, false);  // In case the pattern was mid-beep
+        }
         
         return true;
     }
@@ -690,6 +809,15 @@ uint32_t safety_get_last_heartbeat_time(void) {
 }
 
 bool safety_is_defensive_mode(void) {
-    return g_defensive_mode;
+    return g_defensive_mode && !safety_wake_override_active();
+}
+
+void safety_defensive_wake_override(uint32_t duration_ms) {
+    g_wake_override_start = to_ms_since_boot(get_absolute_time());
+    g_wake_override_duration = duration_ms;
+    if (g_defensive_mode) {
+        LOG_PRINT("Defensive mode: scheduled wake override for %lu ms\n",
+                  (unsigned long)duration_ms);
+    }
 }
 
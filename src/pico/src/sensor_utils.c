@@ -143,6 +143,74 @@ void filter_moving_avg_reset(moving_avg_filter_t* filter) {
     }
 }
 
+// =============================================================================
+// Temperature Estimator Implementation
+// =============================================================================
+
+void temp_estimator_init(temp_estimator_t* est, float alpha, float beta,
+                         float heater_gain_c_per_s) {
+    if (!est) {
+        return;
+    }
+
+    est->temp_c = 0.0f;
+    est->rate_c_per_s = 0.0f;
+    est->alpha = alpha;
+    est->beta = beta;
+    est->heater_gain = heater_gain_c_per_s;
+    est->initialized = false;
+}
+
+float temp_estimator_update(temp_estimator_t* est, float measured_c,
+                            float heater_duty_pct, float dt) {
+    if (!est) {
+        return measured_c;  // Return unfiltered if invalid
+    }
+
+    // Hold the last estimate through a bad sample (mirrors the filter chain,
+    // which also coasts on sensor faults)
+    if (isnan(measured_c)) {
+        return est->initialized ? est->temp_c : measured_c;
+    }
+
+    if (!est->initialized) {
+        est->temp_c = measured_c;
+        est->rate_c_per_s = 0.0f;
+        est->initialized = true;
+        return measured_c;
+    }
+
+    if (dt <= 0.0f) {
+        return est->temp_c;  // No time elapsed, nothing to predict
+    }
+
+    if (heater_duty_pct < 0.0f) heater_duty_pct = 0.0f;
+    if (heater_duty_pct > 100.0f) heater_duty_pct = 100.0f;
+
+    // Predict: the feedforward term is the heating rate the SSR duty is
+    // producing right now; rate_c_per_s absorbs what the model misses
+    // (thermal losses, transport lag), learned from the residuals below
+    float ff_rate = est->heater_gain * (heater_duty_pct / 100.0f);
+    float temp_pred = est->temp_c + (est->rate_c_per_s + ff_rate) * dt;
+
+    // Correct: blend the prediction toward the measurement
+    float residual = measured_c - temp_pred;
+    est->temp_c = temp_pred + est->alpha * residual;
+    est->rate_c_per_s += est->beta * residual;
+
+    return est->temp_c;
+}
+
+void temp_estimator_reset(temp_estimator_t* est) {
+    if (!est) {
+        return;
+    }
+
+    est->temp_c = 0.0f;
+    est->rate_c_per_s = 0.0f;
+    est->initialized = false;
+}
+
 // =============================================================================
 // NTC Temperature Conversion Implementation
 // =============================================================================
@@ -213,7 +281,59 @@ bool sensor_validate_temp(float temp_c, float min_temp, float max_temp) {
     if (isnan(temp_c) || isinf(temp_c)) {
         return false;
     }
-    
+
     return (temp_c >= min_temp && temp_c <= max_temp);
 }
 
+// =============================================================================
+// NTC Lookup Table Implementation
+// =============================================================================
+
+void ntc_lut_init(ntc_lut_t* lut, float vref, float r_series,
+                  float r_ntc_25, float b_value) {
+    if (!lut) {
+        return;
+    }
+
+    for (uint16_t i = 0; i <= NTC_LUT_SEGMENTS; i++) {
+        uint32_t adc = (uint32_t)i * NTC_LUT_STEP;
+        if (adc > 4095) {
+            adc = 4095;  // Guard entry clamps to the last valid code
+        }
+
+        float temp_c = ntc_adc_to_temp((uint16_t)adc, vref, r_series,
+                                       r_ntc_25, b_value);
+
+        // Celsius*10 in int16 covers -3276.8..3276.7C - anything outside is
+        // as unphysical as a NAN, so mark both invalid
+        if (isnan(temp_c) || temp_c < -3000.0f || temp_c > 3000.0f) {
+            lut->temp_c10[i] = NTC_LUT_INVALID;
+        } else {
+            lut->temp_c10[i] = (int16_t)lroundf(temp_c * 10.0f);
+        }
+    }
+}
+
+float ntc_lut_lookup(const ntc_lut_t* lut, uint16_t adc_value) {
+    if (!lut || adc_value > 4095) {
+        return NAN;
+    }
+
+    uint16_t idx = adc_value / NTC_LUT_STEP;
+    uint16_t frac = adc_value % NTC_LUT_STEP;
+
+    int16_t t0 = lut->temp_c10[idx];
+    int16_t t1 = lut->temp_c10[idx + 1];
+
+    // A segment bordering the open/short-circuit region is rejected whole -
+    // slightly stricter than the analytic path at the extreme ends of the
+    // ADC range, where readings are sensor faults anyway
+    if (t0 == NTC_LUT_INVALID || t1 == NTC_LUT_INVALID) {
+        return NAN;
+    }
+
+    // Integer lerp in Celsius*10, back to float for the filter chain
+    int32_t temp_c10 = (int32_t)t0 + ((int32_t)(t1 - t0) * frac) / NTC_LUT_STEP;
+    return (float)temp_c10 / 10.0f;
+}
+
@@ -14,6 +14,9 @@
 #include "sensor_utils.h"
 #include "pcb_config.h"
 #include "machine_config.h"
+#include "control.h"  // control_get_outputs() for estimator feedforward
+#include "burst_capture.h"  // Raw sample tap for shot-start transient capture
+#include "log_catalog.h"  // Compact catalog ids for hot-path fault logging
 #include <stdlib.h>
 #include <math.h>
 
@@ -34,6 +37,13 @@
 #define FILTER_SIZE_STEAM_NTC   8   // Moving average samples for steam NTC
 #define FILTER_SIZE_PRESSURE    4   // Moving average samples for pressure
 
+// DMA ADC capture: per-channel sample rate. 200Hz is 10x the 20Hz Core 1
+// read loop, so each tick averages ~10 fresh conversions ahead of the
+// median/moving-average chain - the oversampling is free because DMA fills
+// the capture ring with no CPU in the sample path.
+#define SENSOR_ADC_SAMPLE_HZ    200
+#define SENSOR_ADC_OVERSAMPLE   10   // Samples averaged per read (one tick's worth)
+
 // =============================================================================
 // Private State
 // =============================================================================
@@ -41,6 +51,15 @@
 static sensor_data_t g_sensor_data = {0};
 static bool g_use_hardware = false;  // Use hardware abstraction (sim or real)
 
+// Cross-core mailbox (seqlock): sensors_read() runs on Core 1 and publishes
+// the filtered snapshot here; control/safety on Core 0 copy it through
+// sensors_get_data(). The sequence counter is odd while a publish is in
+// progress, so a reader that races a publish just retries - neither core
+// ever blocks the other.
+static sensor_data_t g_mailbox = {0};
+static volatile uint32_t g_mailbox_seq = 0;
+static volatile uint32_t g_mailbox_update_ms = 0;
+
 // Median filter buffers (first stage - rejects noise spikes)
 static float g_median_buf_brew[MEDIAN_FILTER_SIZE_BREW_NTC];
 static float g_median_buf_steam[MEDIAN_FILTER_SIZE_STEAM_NTC];
@@ -61,6 +80,26 @@ static moving_avg_filter_t g_filter_brew;
 static moving_avg_filter_t g_filter_steam;
 static moving_avg_filter_t g_filter_pressure;
 
+// Temperature estimators (second stage alternative to the moving average,
+// selected per sensor in machine_config.h). The heater-duty feedforward
+// makes the estimate lead the raw filter chain instead of lagging it.
+static temp_estimator_t g_estimator_brew;
+static temp_estimator_t g_estimator_steam;
+static uint32_t g_last_read_ms = 0;  // For the estimator time step
+
+// Group temperature conduction model state (°C). Kept as float so the slow
+// lag accumulates sub-0.1°C steps; quantized to deci-degrees only on publish.
+// Seeded at ambient to match the sensor_data_t default (25.0C).
+static float g_group_model_temp = 25.0f;
+
+// ADC-to-temperature lookup tables, one per channel (series resistors can
+// differ per PCB). Built once in sensors_init() from the analytic
+// Steinhart-Hart conversion; per-sample conversion is then two loads and an
+// integer lerp instead of logf(), cheap enough to raise the sampling rate
+// without eating into the Core 1 loop budget.
+static ntc_lut_t g_ntc_lut_brew;
+static ntc_lut_t g_ntc_lut_steam;
+
 // Simulation state (fallback if hardware abstraction is in simulation mode)
 static float g_sim_brew_temp = 25.0f;
 static float g_sim_steam_temp = 25.0f;
@@ -89,10 +128,61 @@ static uint32_t g_last_sensor_status_log_ms = 0;
 static uint16_t g_last_brew_adc = ADC_NOT_READ;
 static uint16_t g_last_steam_adc = ADC_NOT_READ;
 
+// ADC channels resolved once at init (-1 = not configured on this PCB).
+// Pin assignments are fixed at boot, so per-read pin validation collapses
+// to a single cached-channel check.
+static int8_t g_adc_chan_brew = -1;
+static int8_t g_adc_chan_steam = -1;
+static int8_t g_adc_chan_pressure = -1;
+static int8_t g_adc_chan_5v = -1;
+
 // =============================================================================
 // Helper Functions
 // =============================================================================
 
+/**
+ * Map a GPIO pin to its ADC channel (GPIO26=0 .. GPIO29=3), -1 if invalid
+ */
+static int8_t resolve_adc_channel(int8_t gpio_pin) {
+    return (gpio_pin >= 26 && gpio_pin <= 29) ? (int8_t)(gpio_pin - 26) : -1;
+}
+
+/**
+ * Read an ADC channel, averaging the burst of DMA-captured samples since the
+ * last tick. Falls back to a single blocking conversion when DMA capture is
+ * not running (simulation mode, or no free DMA channel at init).
+ */
+static uint16_t read_adc_oversampled(uint8_t adc_channel) {
+    uint16_t burst[SENSOR_ADC_OVERSAMPLE];
+    uint8_t n = hw_adc_read_burst(adc_channel, burst, SENSOR_ADC_OVERSAMPLE);
+    if (n == 0) {
+        return hw_read_adc(adc_channel);
+    }
+
+    // Raw samples tap for shot-start transient capture (filters by channel,
+    // a single compare when no capture is armed)
+    burst_capture_push(adc_channel, burst, n);
+
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        sum += burst[i];
+    }
+    return (uint16_t)(sum / n);
+}
+
+// Split a temperature into (whole, tenth) ints for the compact catalog
+// formats ("%d.%uC") - catalog records carry only int32 args, no floats.
+// The sign rides on the whole part; the readings these messages report are
+// outside -10..200C, so the whole part is never 0 and the sign never lost.
+static inline int temp_whole_c(float temp_c) {
+    return (int)(temp_c * 10.0f) / 10;
+}
+
+static inline int temp_tenth_c(float temp_c) {
+    int tenths = (int)(temp_c * 10.0f) % 10;
+    return tenths < 0 ? -tenths : tenths;
+}
+
 /**
  * Read brew NTC thermistor
  * Returns NAN if sensor doesn't exist for this machine type
@@ -109,37 +199,21 @@ static float read_brew_ntc(void) {
         return NAN;  // Not present on this machine type
     }
 
-    const pcb_config_t* pcb = pcb_config_get();
-    if (!pcb || pcb->pins.adc_brew_ntc < 0) {
+    // Channel resolved and validated once in sensors_init()
+    if (g_adc_chan_brew < 0) {
         if (now_ms - g_last_brew_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
             g_last_brew_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Brew NTC not read (pin not configured)\n");
+            LOG_PRINT("Sensors: Brew NTC not read (no ADC channel configured)\n");
         }
         return NAN;  // Not configured
     }
 
-    // Get ADC channel (GPIO26=0, GPIO27=1, GPIO28=2, GPIO29=3)
-    uint8_t adc_channel = pcb->pins.adc_brew_ntc - 26;
-    if (adc_channel > 3) {
-        if (now_ms - g_last_brew_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
-            g_last_brew_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Brew NTC not read (invalid ADC channel %u)\n", (unsigned)adc_channel);
-        }
-        return NAN;  // Invalid channel
-    }
-
-    // Read ADC
-    uint16_t adc_value = hw_read_adc(adc_channel);
+    // Read ADC (oversampled from the DMA capture ring)
+    uint16_t adc_value = read_adc_oversampled((uint8_t)g_adc_chan_brew);
     g_last_brew_adc = adc_value;
 
-    // Convert to temperature (brew: 3.3k series; 50k or 3.3k NTC per PCB)
-    float temp_c = ntc_adc_to_temp(
-        adc_value,
-        HW_ADC_VREF_VOLTAGE,
-        NTC_SERIES_BREW_OHMS,
-        NTC_R25_OHMS,
-        NTC_B_VALUE
-    );
+    // Convert to temperature via precomputed table (brew NTC profile)
+    float temp_c = ntc_lut_lookup(&g_ntc_lut_brew, adc_value);
 
     // Validate
     if (!sensor_validate_temp(temp_c, -10.0f, 200.0f)) {
@@ -147,19 +221,20 @@ static float read_brew_ntc(void) {
         g_brew_ntc_error_count++;
         if (g_brew_ntc_error_count >= SENSOR_ERROR_THRESHOLD &&
             g_brew_ntc_error_count == SENSOR_ERROR_THRESHOLD) {
-            LOG_PRINT("Sensors: ERROR - Brew NTC invalid reading (%.1fC) - %d consecutive failures\n",
-                       temp_c, g_brew_ntc_error_count);
+            log_message_id(LOG_LEVEL_INFO, LOG_CAT_BREW_NTC_FAULT, 3,
+                           temp_whole_c(temp_c), temp_tenth_c(temp_c),
+                           g_brew_ntc_error_count);
         } else if (now_ms - g_last_brew_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
             g_last_brew_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Brew NTC invalid (ADC=%u -> %.1fC, out of range -10..200C)\n",
-                      (unsigned)adc_value, (double)temp_c);
+            log_message_id(LOG_LEVEL_INFO, LOG_CAT_BREW_NTC_RANGE, 3,
+                           (int)adc_value, temp_whole_c(temp_c), temp_tenth_c(temp_c));
         }
         return NAN;
     }
 
     // Valid reading - reset error count
     if (g_brew_ntc_error_count > 0) {
-        LOG_PRINT("Sensors: Brew NTC recovered after %d failures\n", g_brew_ntc_error_count);
+        log_message_id(LOG_LEVEL_INFO, LOG_CAT_BREW_NTC_RECOVER, 1, g_brew_ntc_error_count);
     }
     g_brew_ntc_fault = false;
     g_brew_ntc_error_count = 0;
@@ -182,37 +257,21 @@ static float read_steam_ntc(void) {
         return NAN;  // Not present on this machine type
     }
 
-    const pcb_config_t* pcb = pcb_config_get();
-    if (!pcb || pcb->pins.adc_steam_ntc < 0) {
+    // Channel resolved and validated once in sensors_init()
+    if (g_adc_chan_steam < 0) {
         if (now_ms - g_last_steam_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
             g_last_steam_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Steam NTC not read (pin not configured)\n");
+            LOG_PRINT("Sensors: Steam NTC not read (no ADC channel configured)\n");
         }
         return NAN;  // Not configured
     }
 
-    // Get ADC channel
-    uint8_t adc_channel = pcb->pins.adc_steam_ntc - 26;
-    if (adc_channel > 3) {
-        if (now_ms - g_last_steam_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
-            g_last_steam_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Steam NTC not read (invalid ADC channel %u)\n", (unsigned)adc_channel);
-        }
-        return NAN;  // Invalid channel
-    }
-
-    // Read ADC
-    uint16_t adc_value = hw_read_adc(adc_channel);
+    // Read ADC (oversampled from the DMA capture ring)
+    uint16_t adc_value = read_adc_oversampled((uint8_t)g_adc_chan_steam);
     g_last_steam_adc = adc_value;
 
-    // Convert to temperature (steam: 1.2k series on ECM, else 3.3k; 50k or 3.3k NTC per PCB)
-    float temp_c = ntc_adc_to_temp(
-        adc_value,
-        HW_ADC_VREF_VOLTAGE,
-        NTC_SERIES_STEAM_OHMS,
-        NTC_R25_OHMS,
-        NTC_B_VALUE
-    );
+    // Convert to temperature via precomputed table (steam NTC profile)
+    float temp_c = ntc_lut_lookup(&g_ntc_lut_steam, adc_value);
 
     // Validate
     if (!sensor_validate_temp(temp_c, -10.0f, 200.0f)) {
@@ -220,19 +279,20 @@ static float read_steam_ntc(void) {
         g_steam_ntc_error_count++;
         if (g_steam_ntc_error_count >= SENSOR_ERROR_THRESHOLD &&
             g_steam_ntc_error_count == SENSOR_ERROR_THRESHOLD) {
-            LOG_PRINT("Sensors: ERROR - Steam NTC invalid reading (%.1fC) - %d consecutive failures\n",
-                       temp_c, g_steam_ntc_error_count);
+            log_message_id(LOG_LEVEL_INFO, LOG_CAT_STEAM_NTC_FAULT, 3,
+                           temp_whole_c(temp_c), temp_tenth_c(temp_c),
+                           g_steam_ntc_error_count);
         } else if (now_ms - g_last_steam_ntc_log_ms >= SENSOR_LOG_INTERVAL_MS) {
             g_last_steam_ntc_log_ms = now_ms;
-            LOG_PRINT("Sensors: Steam NTC invalid (ADC=%u -> %.1fC, out of range -10..200C)\n",
-                      (unsigned)adc_value, (double)temp_c);
+            log_message_id(LOG_LEVEL_INFO, LOG_CAT_STEAM_NTC_RANGE, 3,
+                           (int)adc_value, temp_whole_c(temp_c), temp_tenth_c(temp_c));
         }
         return NAN;
     }
 
     // Valid reading - reset error count
     if (g_steam_ntc_error_count > 0) {
-        LOG_PRINT("Sensors: Steam NTC recovered after %d failures\n", g_steam_ntc_error_count);
+        log_message_id(LOG_LEVEL_INFO, LOG_CAT_STEAM_NTC_RECOVER, 1, g_steam_ntc_error_count);
     }
     g_steam_ntc_fault = false;
     g_steam_ntc_error_count = 0;
@@ -253,19 +313,13 @@ static float read_group_thermocouple(void) {
  * Read pressure sensor
  */
 static float read_pressure(void) {
-    const pcb_config_t* pcb = pcb_config_get();
-    if (!pcb || pcb->pins.adc_pressure < 0) {
+    // Channel resolved and validated once in sensors_init()
+    if (g_adc_chan_pressure < 0) {
         return 0.0f;  // Not configured, return 0 bar
     }
-    
-    // Get ADC channel
-    uint8_t adc_channel = pcb->pins.adc_pressure - 26;
-    if (adc_channel > 3) {
-        return 0.0f;  // Invalid channel
-    }
-    
-    // Read ADC voltage
-    float voltage = hw_read_adc_voltage(adc_channel);
+
+    // Read ADC voltage (oversampled from the DMA capture ring)
+    float voltage = hw_adc_to_voltage(read_adc_oversampled((uint8_t)g_adc_chan_pressure));
     
     // Validate voltage range (sanity check)
     // Expected range: 0.3V to 2.7V (after voltage divider: 0.5V to 4.5V transducer)
@@ -298,26 +352,22 @@ static float read_pressure(void) {
     // If 5V rail sags (e.g., to 4.5V), sensor output drops proportionally
     // We must DIVIDE by the ratio (or multiply by inverse) to correct it
     float v_transducer = v_transducer_nominal;
-    
-    const pcb_config_t* pcb_5v = pcb_config_get();
-    if (pcb_5v && pcb_5v->pins.adc_5v_monitor >= 0) {
+
+    if (g_adc_chan_5v >= 0) {
         // Read 5V rail monitor (GPIO29, ADC3)
-        uint8_t adc_5v_channel = pcb_5v->pins.adc_5v_monitor - 26;
-        if (adc_5v_channel <= 3) {
-            float v_adc_5v = hw_read_adc_voltage(adc_5v_channel);
-            
-            // Calculate actual 5V rail voltage (divider: R91=10kΩ, R92=5.6kΩ)
-            // V_5V_actual = V_adc_5v × (R91+R92)/R92 = V_adc_5v × 15.6k/5.6k = V_adc_5v × 2.786
-            float v_5v_actual = v_adc_5v * 2.786f;
-            
-            // Validate 5V rail reading (sanity check: 4.0V to 5.5V)
-            if (v_5v_actual >= 4.0f && v_5v_actual <= 5.5f) {
-                // Apply ratiometric compensation: multiply by inverse ratio
-                // Formula: V_sensor_actual = V_sensor_nominal × (5.0V / V_5V_actual)
-                v_transducer = v_transducer_nominal * (5.0f / v_5v_actual);
-            }
-            // If 5V reading is invalid, use nominal value (fallback)
+        float v_adc_5v = hw_adc_to_voltage(read_adc_oversampled((uint8_t)g_adc_chan_5v));
+
+        // Calculate actual 5V rail voltage (divider: R91=10kΩ, R92=5.6kΩ)
+        // V_5V_actual = V_adc_5v × (R91+R92)/R92 = V_adc_5v × 15.6k/5.6k = V_adc_5v × 2.786
+        float v_5v_actual = v_adc_5v * 2.786f;
+
+        // Validate 5V rail reading (sanity check: 4.0V to 5.5V)
+        if (v_5v_actual >= 4.0f && v_5v_actual <= 5.5f) {
+            // Apply ratiometric compensation: multiply by inverse ratio
+            // Formula: V_sensor_actual = V_sensor_nominal × (5.0V / V_5V_actual)
+            v_transducer = v_transducer_nominal * (5.0f / v_5v_actual);
         }
+        // If 5V reading is invalid, use nominal value (fallback)
     }
     
     // Validate transducer voltage range
@@ -439,6 +489,21 @@ void sensors_init(void) {
     filter_moving_avg_init(&g_filter_brew, g_filter_buf_brew, FILTER_SIZE_BREW_NTC);
     filter_moving_avg_init(&g_filter_steam, g_filter_buf_steam, FILTER_SIZE_STEAM_NTC);
     filter_moving_avg_init(&g_filter_pressure, g_filter_buf_pressure, FILTER_SIZE_PRESSURE);
+
+    // Initialize temperature estimators from the machine config (only used
+    // for sensors whose estimator config has enabled = true)
+    const temp_estimator_config_t* est_brew = machine_get_brew_estimator();
+    const temp_estimator_config_t* est_steam = machine_get_steam_estimator();
+    temp_estimator_init(&g_estimator_brew, est_brew->alpha, est_brew->beta,
+                        est_brew->heater_gain_c_per_s);
+    temp_estimator_init(&g_estimator_steam, est_steam->alpha, est_steam->beta,
+                        est_steam->heater_gain_c_per_s);
+
+    // Precompute ADC-to-temperature tables (replaces per-sample log math)
+    ntc_lut_init(&g_ntc_lut_brew, HW_ADC_VREF_VOLTAGE,
+                 NTC_SERIES_BREW_OHMS, NTC_R25_OHMS, NTC_B_VALUE);
+    ntc_lut_init(&g_ntc_lut_steam, HW_ADC_VREF_VOLTAGE,
+                 NTC_SERIES_STEAM_OHMS, NTC_R25_OHMS, NTC_B_VALUE);
     
     // Check if hardware abstraction is available
     g_use_hardware = true;  // Always use hardware abstraction (sim or real)
@@ -448,6 +513,13 @@ void sensors_init(void) {
     // This is a safety net for pins that might not be covered there.
     const pcb_config_t* pcb = pcb_config_get();
     if (pcb) {
+        // Resolve ADC channels once; the read helpers then only check the
+        // cached channel instead of re-validating pins every tick
+        g_adc_chan_brew = resolve_adc_channel(pcb->pins.adc_brew_ntc);
+        g_adc_chan_steam = resolve_adc_channel(pcb->pins.adc_steam_ntc);
+        g_adc_chan_pressure = resolve_adc_channel(pcb->pins.adc_pressure);
+        g_adc_chan_5v = resolve_adc_channel(pcb->pins.adc_5v_monitor);
+
         if (pcb->pins.input_reservoir >= 0) {
             hw_gpio_init_input(pcb->pins.input_reservoir, true, false);  // Pull-up (switch)
         }
@@ -464,7 +536,35 @@ void sensors_init(void) {
     g_sensor_data.group_temp = 250;    // 25.0C
     g_sensor_data.pressure = 0;        // 0.00 bar
     g_sensor_data.water_level = 80;    // 80%
-    
+
+    // Seed the mailbox with the defaults so Core 0 readers see sane values
+    // (and a fresh timestamp) before Core 1 starts acquiring
+    g_mailbox = g_sensor_data;
+    g_mailbox_update_ms = to_ms_since_boot(get_absolute_time());
+
+    // Start free-running ADC capture (real hardware only): the ADC round-
+    // robins the configured channels at SENSOR_ADC_SAMPLE_HZ each and DMA
+    // fills the ring, so the reads above become buffer lookups. On failure
+    // (no free DMA channel) read_adc_oversampled() stays on polled reads.
+    if (!hw_is_simulation_mode()) {
+        uint32_t adc_mask = 0;
+        const int8_t adc_channels[] = {
+            g_adc_chan_brew, g_adc_chan_steam, g_adc_chan_pressure, g_adc_chan_5v,
+        };
+        for (size_t i = 0; i < sizeof(adc_channels) / sizeof(adc_channels[0]); i++) {
+            if (adc_channels[i] >= 0) {
+                adc_mask |= 1u << adc_channels[i];
+            }
+        }
+        if (adc_mask != 0) {
+            hw_adc_dma_start(adc_mask, SENSOR_ADC_SAMPLE_HZ);
+        }
+    }
+
+    // Shot-start transient capture taps the raw pressure samples in
+    // read_adc_oversampled(); dormant if no transducer is configured
+    burst_capture_init(g_adc_chan_pressure, SENSOR_ADC_SAMPLE_HZ);
+
     LOG_PRINT("Sensors: Initialized (mode: %s, brew_ntc: %s, steam_ntc: %s, NTC: %.0fR@25C series=%.0fR)\n",
               hw_is_simulation_mode() ? "SIMULATION" : "REAL",
               machine_has_brew_ntc() ? "yes" : "no",
@@ -479,35 +579,77 @@ void sensors_init(void) {
 void sensors_read(void) {
     if (g_use_hardware) {
         // Use hardware abstraction layer (works in both sim and real mode)
-        
-        // Read and filter brew NTC (two-stage: median + moving average)
+
+        // Time step for the estimator stage (nominal 50ms on the first pass
+        // or after a clock hiccup)
+        uint32_t read_ms = to_ms_since_boot(get_absolute_time());
+        float dt = (read_ms - g_last_read_ms) / 1000.0f;
+        if (g_last_read_ms == 0 || dt <= 0.0f || dt > 1.0f) {
+            dt = 0.05f;
+        }
+        g_last_read_ms = read_ms;
+
+        // Current SSR duties for the estimator feedforward (byte fields, so
+        // the cross-core read can't tear)
+        control_outputs_t outputs;
+        control_get_outputs(&outputs);
+
+        // Read and filter brew NTC (median, then estimator or moving average)
         float brew_temp_raw = read_brew_ntc();
         if (!isnan(brew_temp_raw)) {
             // First stage: median filter rejects noise spikes
             float brew_temp_median = filter_median_update(&g_median_filter_brew, brew_temp_raw);
-            // Second stage: moving average smooths the median output
-            float brew_temp_filtered = filter_moving_avg_update(&g_filter_brew, brew_temp_median);
+            // Second stage: heater-feedforward estimator where configured,
+            // moving average otherwise
+            float brew_temp_filtered;
+            if (machine_get_brew_estimator()->enabled) {
+                brew_temp_filtered = temp_estimator_update(&g_estimator_brew, brew_temp_median,
+                                                           (float)outputs.brew_heater, dt);
+            } else {
+                brew_temp_filtered = filter_moving_avg_update(&g_filter_brew, brew_temp_median);
+            }
             g_sensor_data.brew_temp = (int16_t)(brew_temp_filtered * 10.0f);
         } else {
             // Sensor fault - keep last valid value (filter maintains it)
             // Safety system will detect NAN and handle appropriately
         }
-        
-        // Read and filter steam NTC (two-stage: median + moving average)
+
+        // Read and filter steam NTC (median, then estimator or moving average)
         float steam_temp_raw = read_steam_ntc();
         if (!isnan(steam_temp_raw)) {
             // First stage: median filter rejects noise spikes
             float steam_temp_median = filter_median_update(&g_median_filter_steam, steam_temp_raw);
-            // Second stage: moving average smooths the median output
-            float steam_temp_filtered = filter_moving_avg_update(&g_filter_steam, steam_temp_median);
+            // Second stage: heater-feedforward estimator where configured,
+            // moving average otherwise
+            float steam_temp_filtered;
+            if (machine_get_steam_estimator()->enabled) {
+                steam_temp_filtered = temp_estimator_update(&g_estimator_steam, steam_temp_median,
+                                                            (float)outputs.steam_heater, dt);
+            } else {
+                steam_temp_filtered = filter_moving_avg_update(&g_filter_steam, steam_temp_median);
+            }
             g_sensor_data.steam_temp = (int16_t)(steam_temp_filtered * 10.0f);
         } else {
             // Sensor fault - keep last valid value
         }
         
-        // Note: Group head thermocouple support removed (v2.24.3)
-        // g_sensor_data.group_temp remains at default/last value (NAN data)
-        
+        // Group head temperature: model estimate. The physical thermocouple
+        // was removed in v2.24.3; the group metal still matters for shot
+        // quality, so fill group_temp with a first-order conduction lag from
+        // the boiler temperature (coefficients per machine type in
+        // machine_config.h). HX machines have no brew NTC - their
+        // thermosyphon is fed from the steam boiler, so model from that side.
+        const group_temp_model_t* group_model = machine_get_group_model();
+        if (group_model->enabled) {
+            float source_c = machine_has_brew_ntc()
+                                 ? g_sensor_data.brew_temp / 10.0f
+                                 : g_sensor_data.steam_temp / 10.0f;
+            float settle_c = group_model->gain * source_c + group_model->offset_c;
+            g_group_model_temp += (dt / group_model->tau_s) * (settle_c - g_group_model_temp);
+            g_sensor_data.group_temp = (int16_t)(g_group_model_temp * 10.0f);
+        }
+
+
         // Read and filter pressure (two-stage: median + moving average)
         float pressure_raw = read_pressure();
         if (!g_pressure_sensor_fault) {
@@ -575,36 +717,59 @@ void sensors_read(void) {
         g_sensor_data.group_temp = (int16_t)((g_sim_brew_temp - 5.0f + noise) * 10);
         g_sensor_data.pressure = 100 + (rand() % 20);  // ~1.0 bar
     }
+
+    // Publish the snapshot for Core 0 (seqlock write: odd = in progress)
+    g_mailbox_seq++;
+    __dmb();
+    g_mailbox = g_sensor_data;
+    g_mailbox_update_ms = to_ms_since_boot(get_absolute_time());
+    __dmb();
+    g_mailbox_seq++;
 }
 
 void sensors_get_data(sensor_data_t* data) {
-    if (data) {
-        *data = g_sensor_data;
+    if (!data) {
+        return;
     }
+    // Seqlock read: retry if a Core 1 publish overlapped the copy
+    uint32_t seq_before, seq_after;
+    do {
+        seq_before = g_mailbox_seq;
+        __dmb();
+        *data = g_mailbox;
+        __dmb();
+        seq_after = g_mailbox_seq;
+    } while ((seq_before & 1u) || seq_before != seq_after);
+}
+
+uint32_t sensors_data_age_ms(void) {
+    return to_ms_since_boot(get_absolute_time()) - g_mailbox_update_ms;
 }
 
 // =============================================================================
 // Individual Sensor Access
 // =============================================================================
+// Single-field reads skip the seqlock: each field is a naturally-aligned
+// load of 2 bytes or less, which is atomic on the Cortex-M33.
 
 int16_t sensors_get_brew_temp(void) {
-    return g_sensor_data.brew_temp;
+    return g_mailbox.brew_temp;
 }
 
 int16_t sensors_get_steam_temp(void) {
-    return g_sensor_data.steam_temp;
+    return g_mailbox.steam_temp;
 }
 
 int16_t sensors_get_group_temp(void) {
-    return g_sensor_data.group_temp;
+    return g_mailbox.group_temp;
 }
 
 uint16_t sensors_get_pressure(void) {
-    return g_sensor_data.pressure;
+    return g_mailbox.pressure;
 }
 
 uint8_t sensors_get_water_level(void) {
-    return g_sensor_data.water_level;
+    return g_mailbox.water_level;
 }
 
 // =============================================================================
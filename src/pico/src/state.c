@@ -6,6 +6,7 @@
  */
 
 #include "pico/stdlib.h"
+#include <string.h>
 #include "state.h"
 #include "config.h"
 #include "sensors.h"
@@ -18,6 +19,7 @@
 #include "protocol.h"
 #include "cleaning.h"
 #include "config_persistence.h"
+#include "burst_capture.h"
 
 // =============================================================================
 // Brew Cycle Configuration
@@ -79,19 +81,28 @@ static machine_state_t g_previous_state = STATE_INIT;
 static machine_mode_t g_mode = MODE_BREW;
 static bool g_brewing = false;
 
-// Brew cycle state
-typedef enum {
-    BREW_PHASE_NONE = 0,
-    BREW_PHASE_PREINFUSION,
-    BREW_PHASE_BREWING,
-    BREW_PHASE_POST_BREW
-} brew_phase_t;
-
-static brew_phase_t g_brew_phase = BREW_PHASE_NONE;
+// Brew cycle state - phase ids are wire format (BREW_PHASE_* in
+// protocol_defs.h). Every transition stamps the per-shot log with a
+// microsecond entry time so telemetry captures can be phase-aligned.
+static uint8_t g_brew_phase = BREW_PHASE_NONE;
+static uint64_t g_phase_start_us = 0;
+static shot_phase_log_t g_shot_phase_log = {0};
 static uint32_t g_brew_start_time = 0;
 static uint32_t g_brew_stop_time = 0;
 static uint32_t g_post_brew_start_time = 0;
 
+/**
+ * Enter a shot phase: record the microsecond timestamp in the per-shot
+ * log and expose it for the status payload
+ */
+static void enter_brew_phase(uint8_t phase) {
+    g_brew_phase = phase;
+    g_phase_start_us = time_us_64();
+    if (phase < SHOT_PHASE_COUNT) {
+        g_shot_phase_log.enter_us[phase] = g_phase_start_us;
+    }
+}
+
 // Pre-infusion configuration
 static bool g_preinfusion_enabled = false;
 static uint16_t g_preinfusion_on_ms = PREINFUSION_DEFAULT_ON_MS;
@@ -201,7 +212,9 @@ static void state_entry_action(machine_state_t state) {
             // Start brew cycle and shot timer
             g_brew_start_time = now;
             g_brew_stop_time = 0;  // Reset stop time (timer running)
-            g_brew_phase = g_preinfusion_enabled ? BREW_PHASE_PREINFUSION : BREW_PHASE_BREWING;
+            burst_capture_start();  // Record the raw pressure transient
+            memset(&g_shot_phase_log, 0, sizeof(g_shot_phase_log));  // New shot, fresh log
+            enter_brew_phase(g_preinfusion_enabled ? BREW_PHASE_PREINFUSION : BREW_PHASE_BREWING);
             
             if (g_preinfusion_enabled) {
                 // Pre-infusion: pump on, solenoid on
@@ -272,7 +285,8 @@ static void state_exit_action(machine_state_t state) {
             control_set_pump(0);
             // Solenoid will be turned off after post-brew delay
             g_post_brew_start_time = to_ms_since_boot(get_absolute_time());
-            g_brew_phase = BREW_PHASE_POST_BREW;
+            enter_brew_phase(BREW_PHASE_POST_BREW);
+            burst_capture_stop();  // Shot over - Core 1 drains the capture
             DEBUG_PRINT("Brew: Stopped (shot time: %lu ms)\n", 
                        g_brew_stop_time - g_brew_start_time);
             break;
@@ -292,6 +306,8 @@ void state_init(void) {
     g_mode = MODE_IDLE;  // Start in IDLE mode - machine idle until heating strategy selected
     g_brewing = false;
     g_brew_phase = BREW_PHASE_NONE;
+    g_phase_start_us = 0;
+    memset(&g_shot_phase_log, 0, sizeof(g_shot_phase_log));
     g_brew_start_time = 0;
     g_brew_stop_time = 0;
     g_post_brew_start_time = 0;
@@ -460,25 +476,25 @@ void state_update(void) {
             break;
             
         case STATE_BREWING:
-            // Handle brew cycle phases
+            // Handle brew cycle phases (each transition timestamps the
+            // per-shot log via enter_brew_phase)
             if (g_brew_phase == BREW_PHASE_PREINFUSION) {
-                // Check pre-infusion timing
-                uint32_t preinfusion_elapsed = now - g_brew_start_time;
-                
-                if (preinfusion_elapsed >= g_preinfusion_on_ms) {
-                    // Pre-infusion pause: turn off pump, keep solenoid on
+                // Pre-infusion pump window elapsed -> soak pause
+                if (now - g_brew_start_time >= g_preinfusion_on_ms) {
+                    // Turn off pump, keep solenoid on
+                    enter_brew_phase(BREW_PHASE_PAUSE);
                     control_set_pump(0);
                     DEBUG_PRINT("Brew: Pre-infusion pause\n");
-                    
-                    if (preinfusion_elapsed >= (g_preinfusion_on_ms + g_preinfusion_pause_ms)) {
-                        // Pre-infusion complete, start full pressure brew
-                        g_brew_phase = BREW_PHASE_BREWING;
-                        control_set_pump(100);
-                        DEBUG_PRINT("Brew: Full pressure started\n");
-                    }
+                }
+            } else if (g_brew_phase == BREW_PHASE_PAUSE) {
+                // Soak elapsed -> full pressure extraction
+                if (now - g_brew_start_time >= (uint32_t)(g_preinfusion_on_ms + g_preinfusion_pause_ms)) {
+                    enter_brew_phase(BREW_PHASE_BREWING);
+                    control_set_pump(100);
+                    DEBUG_PRINT("Brew: Full pressure started\n");
                 }
             }
-            
+
             // Check for brew stop (manual or automatic)
             if (!g_brewing) {
                 new_state = STATE_READY;
@@ -518,7 +534,8 @@ void state_update(void) {
             if (pcb && pcb->pins.relay_brew_solenoid >= 0) {
                 hw_set_gpio(pcb->pins.relay_brew_solenoid, false);
             }
-            g_brew_phase = BREW_PHASE_NONE;
+            // The NONE slot records shot completion in the phase log
+            enter_brew_phase(BREW_PHASE_NONE);
             DEBUG_PRINT("Brew: Post-brew complete, solenoid off\n");
         }
     }
@@ -540,7 +557,7 @@ void state_update(void) {
             new_state = STATE_READY;  // Return to ready after cleaning
         }
         
-        // Cleaning cycle auto-stops after 10s (handled in cleaning_update())
+        // Backflush program completes itself (deadline-stepped in cleaning_update())
         if (g_brewing && !cleaning_is_active()) {
             // Cleaning cycle auto-stopped
             g_brewing = false;
@@ -831,6 +848,22 @@ uint32_t state_get_brew_start_timestamp_ms(void) {
     return 0;
 }
 
+// =============================================================================
+// Shot Phases
+// =============================================================================
+
+uint8_t state_get_brew_phase(void) {
+    return g_brew_phase;
+}
+
+uint32_t state_get_phase_start_us(void) {
+    return (uint32_t)g_phase_start_us;
+}
+
+const shot_phase_log_t* state_get_shot_phase_log(void) {
+    return &g_shot_phase_log;
+}
+
 // =============================================================================
 // Eco Mode
 // =============================================================================
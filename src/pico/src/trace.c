@@ -0,0 +1,98 @@
+/**
+ * Pico Firmware - Hot-Path Tracepoints
+ *
+ * Implementation of the tracepoint rings declared in trace.h. Compiled into
+ * the image only when built with -DTRACEPOINTS=1.
+ */
+
+#include "trace.h"
+
+#if TRACEPOINTS
+
+#include "protocol.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/m33.h"
+#include "pico/platform.h"
+
+// =============================================================================
+// Per-Core Rings
+// =============================================================================
+// Single-producer single-consumer per ring: the owning core is the only
+// writer of head, Core 1's trace_flush() is the only writer of tail. No
+// locks needed; newest records are dropped when the consumer falls behind
+// (same policy as the compact log ring in logging.c).
+
+typedef struct {
+    trace_record_t records[TRACE_RING_RECORDS];
+    volatile uint32_t head;     // Next slot to write (producer core only)
+    volatile uint32_t tail;     // Next slot to drain (Core 1 only)
+    uint32_t dropped;           // Records dropped because the ring was full
+} trace_ring_t;
+
+static trace_ring_t g_rings[2];
+
+// UART backpressure bound: at most this many MSG_TRACE packets per flush
+// call, so a full ring shares the link with status/log traffic instead of
+// monopolizing it.
+#define TRACE_FLUSH_MAX_BATCHES 4
+
+// =============================================================================
+// Public Functions
+// =============================================================================
+
+void trace_init(void) {
+    // Each M33 core has its own DWT - this enables the cycle counter on
+    // whichever core calls it.
+    m33_hw->demcr |= M33_DEMCR_TRCENA_BITS;
+    m33_hw->dwt_cyccnt = 0;
+    m33_hw->dwt_ctrl |= M33_DWT_CTRL_CYCCNTENA_BITS;
+}
+
+void trace_record_event(uint16_t id, uint8_t phase) {
+    uint32_t core = get_core_num();
+    trace_ring_t* ring = &g_rings[core];
+
+    uint32_t head = ring->head;
+    uint32_t next = (head + 1) % TRACE_RING_RECORDS;
+    if (next == ring->tail) {
+        ring->dropped++;  // Ring full - drop newest, keep the older window
+        return;
+    }
+
+    trace_record_t* rec = &ring->records[head];
+    rec->cycles = m33_hw->dwt_cyccnt;
+    rec->id = id;
+    rec->core = (uint8_t)core;
+    rec->phase = phase;
+
+    __dmb();  // Record contents visible before head moves (cross-core reader)
+    ring->head = next;
+}
+
+void trace_flush(void) {
+    uint32_t cpu_hz = clock_get_hz(clk_sys);
+
+    for (int pass = 0; pass < TRACE_FLUSH_MAX_BATCHES; pass++) {
+        trace_record_t batch[TRACE_BATCH_MAX_RECORDS];
+        uint8_t count = 0;
+
+        // Fill one batch from both rings; the core field in each record
+        // keeps the origin so mixing them in one packet is fine
+        for (uint32_t core = 0; core < 2 && count < TRACE_BATCH_MAX_RECORDS; core++) {
+            trace_ring_t* ring = &g_rings[core];
+            while (count < TRACE_BATCH_MAX_RECORDS && ring->tail != ring->head) {
+                batch[count++] = ring->records[ring->tail];
+                ring->tail = (ring->tail + 1) % TRACE_RING_RECORDS;
+            }
+        }
+
+        if (count == 0) {
+            return;  // Rings drained
+        }
+        if (!protocol_send_trace(cpu_hz, batch, count)) {
+            return;  // TX backpressure - remaining records wait for next pass
+        }
+    }
+}
+
+#endif // TRACEPOINTS
@@ -0,0 +1,202 @@
+/**
+ * DMA-driven UART TX Implementation
+ *
+ * A single DMA channel is paced by the UART TX DREQ and fed from a software
+ * staging ring. Writers copy frames into the ring; the DMA completion IRQ
+ * chains the next contiguous span (up to the ring wrap point) into the
+ * channel, so the CPU never waits on FIFO space.
+ *
+ * Concurrency model: writers run on Core 1 (protocol path). The IRQ handler
+ * only advances the tail and restarts the channel; writers only advance the
+ * head. The short critical section in uart_tx_dma_write() guards the
+ * idle-check-then-kick race against the completion IRQ.
+ */
+
+#include "uart_tx_dma.h"
+#include "logging.h"
+
+#ifndef UNIT_TEST
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+static uart_inst_t* g_uart = NULL;
+static int g_dma_chan = -1;
+static bool g_initialized = false;
+
+// Staging ring: head = write position (producer), tail = read position
+// (consumed by DMA). in_flight tracks the span currently owned by the channel.
+static uint8_t g_ring[UART_TX_DMA_RING_SIZE];
+static volatile uint32_t g_head = 0;
+static volatile uint32_t g_tail = 0;
+static volatile uint32_t g_in_flight = 0;
+static volatile bool g_dma_busy = false;
+
+static spin_lock_t* g_lock = NULL;
+
+// Start a DMA transfer for the longest contiguous span from tail.
+// Must be called with the lock held (or from the IRQ with IRQs implicit).
+static void start_next_transfer(void) {
+    uint32_t head = g_head;
+    uint32_t tail = g_tail;
+
+    if (head == tail) {
+        g_dma_busy = false;
+        return;
+    }
+
+    // Contiguous span: stop at the wrap point, the next chain picks up the rest
+    uint32_t span;
+    if (head > tail) {
+        span = head - tail;
+    } else {
+        span = UART_TX_DMA_RING_SIZE - tail;
+    }
+
+    g_in_flight = span;
+    g_dma_busy = true;
+    dma_channel_set_read_addr(g_dma_chan, &g_ring[tail], false);
+    dma_channel_set_trans_count(g_dma_chan, span, true);  // true = start now
+}
+
+static void __isr dma_tx_irq_handler(void) {
+    if (!dma_channel_get_irq0_status(g_dma_chan)) {
+        return;  // Not our channel
+    }
+    dma_channel_acknowledge_irq0(g_dma_chan);
+
+    // Retire the completed span and chain the next one
+    g_tail = (g_tail + g_in_flight) % UART_TX_DMA_RING_SIZE;
+    g_in_flight = 0;
+    start_next_transfer();
+}
+
+bool uart_tx_dma_init(uart_inst_t* uart) {
+    if (g_initialized) {
+        uart_tx_dma_deinit();
+    }
+
+    int chan = dma_claim_unused_channel(false);
+    if (chan < 0) {
+        LOG_WARN("UART TX DMA: No free DMA channel, falling back to polled writes\n");
+        return false;
+    }
+
+    g_uart = uart;
+    g_dma_chan = chan;
+    g_head = 0;
+    g_tail = 0;
+    g_in_flight = 0;
+    g_dma_busy = false;
+    g_lock = spin_lock_instance(spin_lock_claim_unused(true));
+
+    // 8-bit transfers from the ring into the UART data register, paced by
+    // the TX DREQ so the FIFO never overflows
+    dma_channel_config cfg = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, uart_get_dreq(uart, true));
+    dma_channel_configure(chan, &cfg, &uart_get_hw(uart)->dr, g_ring, 0, false);
+
+    // Completion IRQ chains the next ring span
+    dma_channel_set_irq0_enabled(chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, dma_tx_irq_handler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    g_initialized = true;
+    LOG_PRINT("UART TX DMA: Initialized (channel %d, ring %d bytes)\n",
+              chan, UART_TX_DMA_RING_SIZE);
+    return true;
+}
+
+void uart_tx_dma_deinit(void) {
+    if (!g_initialized) return;
+
+    // Let the in-flight transfer finish so the last frame isn't truncated
+    uart_tx_dma_flush(PROTOCOL_UART_WRITE_TIMEOUT_MS);
+
+    dma_channel_set_irq0_enabled(g_dma_chan, false);
+    irq_remove_handler(DMA_IRQ_0, dma_tx_irq_handler);
+    dma_channel_abort(g_dma_chan);
+    dma_channel_unclaim(g_dma_chan);
+    g_dma_chan = -1;
+    g_initialized = false;
+}
+
+bool uart_tx_dma_write(const uint8_t* data, size_t len) {
+    if (!g_initialized || !data || len == 0) {
+        return false;
+    }
+    if (len >= UART_TX_DMA_RING_SIZE) {
+        return false;
+    }
+
+    uint32_t save = spin_lock_blocking(g_lock);
+
+    // Free space: one slot is kept open to distinguish full from empty
+    uint32_t head = g_head;
+    uint32_t tail = g_tail;
+    uint32_t used = (head + UART_TX_DMA_RING_SIZE - tail) % UART_TX_DMA_RING_SIZE;
+    if (used + len >= UART_TX_DMA_RING_SIZE) {
+        spin_unlock(g_lock, save);
+        return false;  // Ring full - caller drops the whole frame
+    }
+
+    // Copy (possibly split across the wrap point)
+    uint32_t first = UART_TX_DMA_RING_SIZE - head;
+    if (first > len) first = len;
+    memcpy(&g_ring[head], data, first);
+    if (first < len) {
+        memcpy(&g_ring[0], data + first, len - first);
+    }
+    g_head = (head + len) % UART_TX_DMA_RING_SIZE;
+
+    // Kick the channel if it went idle
+    if (!g_dma_busy) {
+        start_next_transfer();
+    }
+
+    spin_unlock(g_lock, save);
+    return true;
+}
+
+size_t uart_tx_dma_pending(void) {
+    uint32_t head = g_head;
+    uint32_t tail = g_tail;
+    return (head + UART_TX_DMA_RING_SIZE - tail) % UART_TX_DMA_RING_SIZE;
+}
+
+bool uart_tx_dma_is_idle(void) {
+    return !g_dma_busy && g_head == g_tail;
+}
+
+bool uart_tx_dma_flush(uint32_t timeout_ms) {
+    uint32_t start = to_ms_since_boot(get_absolute_time());
+    while (!uart_tx_dma_is_idle()) {
+        if (to_ms_since_boot(get_absolute_time()) - start > timeout_ms) {
+            return false;
+        }
+        tight_loop_contents();
+    }
+    return true;
+}
+
+bool uart_tx_dma_is_initialized(void) {
+    return g_initialized;
+}
+
+#else
+// Unit test stubs (mirrors pio_uart.c style)
+bool uart_tx_dma_init(uart_inst_t* uart) { (void)uart; return false; }
+void uart_tx_dma_deinit(void) {}
+bool uart_tx_dma_write(const uint8_t* data, size_t len) { (void)data; (void)len; return false; }
+size_t uart_tx_dma_pending(void) { return 0; }
+bool uart_tx_dma_is_idle(void) { return true; }
+bool uart_tx_dma_flush(uint32_t timeout_ms) { (void)timeout_ms; return true; }
+bool uart_tx_dma_is_initialized(void) { return false; }
+#endif
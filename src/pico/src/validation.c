@@ -5,30 +5,12 @@
  */
 
 #include "validation.h"
+#include "config_limits.h"
 #include <stddef.h>
 
-// =============================================================================
-// Constants
-// =============================================================================
-
-// Temperature limits (in decicelsius)
-#define TEMP_ABSOLUTE_MIN    0      // 0.0°C
-#define TEMP_ABSOLUTE_MAX    2000   // 200.0°C
-#define TEMP_BREW_MAX        1300   // 130.0°C (safety limit)
-#define TEMP_STEAM_MAX       1650   // 165.0°C (safety limit)
-
-// PID limits (scaled by 100)
-#define PID_GAIN_MAX         10000  // 100.00 (very aggressive)
-
-// Electrical limits
-#define VOLTAGE_MIN          100    // 100V
-#define VOLTAGE_MAX          250    // 250V
-#define CURRENT_MIN          1.0f   // 1A
-#define CURRENT_MAX          50.0f  // 50A
-
-// Pre-infusion limits
-#define PREINFUSION_ON_MAX   10000  // 10 seconds
-#define PREINFUSION_PAUSE_MAX 30000 // 30 seconds
+// Fixed per-field bounds live in the shared constraint table
+// (config_limits.h) so the ESP32 rejects out-of-range values before they
+// go on the wire and both sides always agree on the limits.
 
 // =============================================================================
 // Temperature Validation
@@ -42,7 +24,7 @@ validation_result_t validate_temperature(int16_t temp, int16_t min_temp, int16_t
 }
 
 validation_result_t validate_setpoint_target(uint8_t target) {
-    if (target > 1) {  // 0=brew, 1=steam
+    if (!config_limit_check(CFG_LIMIT_SETPOINT_TARGET, (float)target)) {
         return VALIDATION_ERROR_INVALID_TARGET;
     }
     return VALIDATION_OK;
@@ -53,8 +35,12 @@ validation_result_t validate_setpoint_target(uint8_t target) {
 // =============================================================================
 
 validation_result_t validate_pid_gains(uint16_t kp, uint16_t ki, uint16_t kd) {
-    if (kp > PID_GAIN_MAX || ki > PID_GAIN_MAX || kd > PID_GAIN_MAX) {
-        return VALIDATION_ERROR_OUT_OF_RANGE;
+    // Single loop over the three gains against one table entry
+    const uint16_t gains[3] = { kp, ki, kd };
+    for (int i = 0; i < 3; i++) {
+        if (!config_limit_check(CFG_LIMIT_PID_GAIN, (float)gains[i])) {
+            return VALIDATION_ERROR_OUT_OF_RANGE;
+        }
     }
     return VALIDATION_OK;
 }
@@ -64,14 +50,14 @@ validation_result_t validate_pid_gains(uint16_t kp, uint16_t ki, uint16_t kd) {
 // =============================================================================
 
 validation_result_t validate_voltage(uint16_t voltage) {
-    if (voltage < VOLTAGE_MIN || voltage > VOLTAGE_MAX) {
+    if (!config_limit_check(CFG_LIMIT_VOLTAGE, (float)voltage)) {
         return VALIDATION_ERROR_OUT_OF_RANGE;
     }
     return VALIDATION_OK;
 }
 
 validation_result_t validate_current(float current) {
-    if (current < CURRENT_MIN || current > CURRENT_MAX) {
+    if (!config_limit_check(CFG_LIMIT_CURRENT, current)) {
         return VALIDATION_ERROR_OUT_OF_RANGE;
     }
     return VALIDATION_OK;
@@ -97,10 +83,10 @@ validation_result_t validate_buffer_copy(const void* dest, const void* src,
 // =============================================================================
 
 validation_result_t validate_preinfusion_timing(uint16_t on_time_ms, uint16_t pause_time_ms) {
-    if (on_time_ms > PREINFUSION_ON_MAX) {
+    if (!config_limit_check(CFG_LIMIT_PREINFUSION_ON, (float)on_time_ms)) {
         return VALIDATION_ERROR_OUT_OF_RANGE;
     }
-    if (pause_time_ms > PREINFUSION_PAUSE_MAX) {
+    if (!config_limit_check(CFG_LIMIT_PREINFUSION_PAUSE, (float)pause_time_ms)) {
         return VALIDATION_ERROR_OUT_OF_RANGE;
     }
     return VALIDATION_OK;
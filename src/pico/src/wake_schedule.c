@@ -0,0 +1,182 @@
+/**
+ * Pico Firmware - Autonomous Wake Schedule Implementation
+ *
+ * Fires persisted turn-on schedules when the ESP32 is not around to do it.
+ * See wake_schedule.h for the clock-anchoring and reconciliation model.
+ */
+
+#include "wake_schedule.h"
+#include "state.h"
+#include "control.h"
+#include "safety.h"
+#include "config_persistence.h"
+#include "config.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+#define WEEK_MINUTES (7u * 24u * 60u)
+#define DAY_MINUTES  (24u * 60u)
+
+// =============================================================================
+// Private State
+// =============================================================================
+
+static wake_schedule_entry_t g_entries[WAKE_SCHEDULE_MAX];
+static uint8_t g_count = 0;
+
+// Clock reference: local minute-of-week at a known ms-since-boot instant.
+// Only valid after an ESP32 push - NOT restored from flash, because
+// ms-since-boot restarts on reboot and would anchor the week to garbage.
+static bool g_clock_valid = false;
+static uint32_t g_ref_mow = 0;        // Minute-of-week at the reference instant
+static uint32_t g_ref_ms = 0;         // ms-since-boot of the reference instant
+
+// Per-entry fired latch: set when an entry fires, cleared once the entry is
+// more than WAKE_WINDOW_MINUTES past due (i.e. rearmed for next occurrence)
+static bool g_fired[WAKE_SCHEDULE_MAX];
+
+static uint32_t g_last_eval_ms = 0;   // 1Hz evaluation gate
+
+// =============================================================================
+// Time Arithmetic
+// =============================================================================
+
+/**
+ * Current local minute-of-week extended from the clock reference.
+ * Wraps correctly across the ~49-day ms rollover because the subtraction
+ * is unsigned.
+ */
+static uint32_t current_mow(uint32_t now_ms) {
+    uint32_t elapsed_min = (now_ms - g_ref_ms) / 60000u;
+    return (g_ref_mow + elapsed_min) % WEEK_MINUTES;
+}
+
+/**
+ * Minutes since this entry was last due (0 = due this minute).
+ * Scans the entry's enabled days and returns the most recent occurrence.
+ */
+static uint32_t minutes_past_due(const wake_schedule_entry_t* entry, uint32_t now_mow) {
+    uint32_t best = WEEK_MINUTES;  // "Never" - no day enabled
+    for (uint8_t day = 0; day < 7; day++) {
+        if (!(entry->days & (1u << day))) {
+            continue;
+        }
+        uint32_t mow = day * DAY_MINUTES + entry->minute_of_day;
+        uint32_t past = (now_mow + WEEK_MINUTES - mow) % WEEK_MINUTES;
+        if (past < best) {
+            best = past;
+        }
+    }
+    return best;
+}
+
+// =============================================================================
+// Firing
+// =============================================================================
+
+static void fire_entry(const wake_schedule_entry_t* entry) {
+    LOG_INFO("Wake schedule: firing (minute %u, strategy %u)\n",
+             entry->minute_of_day, entry->strategy);
+
+    // With the ESP32 down the machine sits in defensive mode, which would
+    // reject (and keep reverting) the mode change - lift it for a bounded
+    // window first. No-op when the ESP32 is alive.
+    safety_defensive_wake_override(WAKE_DEFENSIVE_OVERRIDE_MS);
+
+    // Mirror what the ESP32's schedule callback sends: heating strategy
+    // first (when it differs from the default and the hardware allows it),
+    // then MODE_BREW to start heating
+    if (entry->strategy != HEAT_STRATEGY_SEQUENTIAL &&
+        control_is_heating_strategy_allowed(entry->strategy)) {
+        control_set_heating_strategy(entry->strategy);
+    }
+
+    if (!state_set_mode(MODE_BREW)) {
+        LOG_WARN("Wake schedule: mode change rejected\n");
+    }
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+void wake_schedule_init(void) {
+    g_count = 0;
+    memset(g_entries, 0, sizeof(g_entries));
+    memset(g_fired, 0, sizeof(g_fired));
+
+    config_persistence_get_wake_schedule(&g_count, g_entries);
+    if (g_count > 0) {
+        LOG_INFO("Wake schedule: %u entries restored (dormant until clock sync)\n",
+                 g_count);
+    }
+}
+
+void wake_schedule_apply(const wake_schedule_entry_t* entries, uint8_t count,
+                         uint16_t cur_mow, uint8_t cur_sec) {
+    if (count > WAKE_SCHEDULE_MAX) {
+        count = WAKE_SCHEDULE_MAX;
+    }
+
+    // Only touch flash when the table itself changed - clock-refresh pushes
+    // carry the same entries and should not cost a flash write
+    bool table_changed = (count != g_count) ||
+        (count > 0 && memcmp(entries, g_entries, count * sizeof(wake_schedule_entry_t)) != 0);
+
+    g_count = count;
+    if (count > 0) {
+        memcpy(g_entries, entries, count * sizeof(wake_schedule_entry_t));
+    }
+
+    if (table_changed) {
+        memset(g_fired, 0, sizeof(g_fired));
+        config_persistence_save_wake_schedule(g_count, g_entries);
+    }
+
+    // Re-anchor the clock at the start of the current minute
+    g_ref_mow = cur_mow % WEEK_MINUTES;
+    g_ref_ms = to_ms_since_boot(get_absolute_time()) - (uint32_t)cur_sec * 1000u;
+    g_clock_valid = true;
+}
+
+void wake_schedule_update(void) {
+    if (!g_clock_valid || g_count == 0) {
+        return;
+    }
+
+    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+    if (now_ms - g_last_eval_ms < 1000) {
+        return;
+    }
+    g_last_eval_ms = now_ms;
+
+    uint32_t now_mow = current_mow(now_ms);
+
+    for (uint8_t i = 0; i < g_count; i++) {
+        uint32_t past = minutes_past_due(&g_entries[i], now_mow);
+
+        if (past > WAKE_WINDOW_MINUTES) {
+            g_fired[i] = false;  // Occurrence over - rearm for next week/day
+            continue;
+        }
+        if (past < WAKE_GRACE_MINUTES || g_fired[i]) {
+            continue;  // Still deferring to the ESP32, or already handled
+        }
+
+        g_fired[i] = true;
+
+        // Only wake a machine that is actually asleep. HEATING/READY means
+        // the ESP32 (or the user) beat us to it; BREWING/FAULT/SAFE must
+        // not be disturbed.
+        machine_state_t state = state_get();
+        if (state != STATE_IDLE && state != STATE_ECO) {
+            continue;
+        }
+
+        fire_entry(&g_entries[i]);
+    }
+}
+
+bool wake_schedule_clock_valid(void) {
+    return g_clock_valid;
+}
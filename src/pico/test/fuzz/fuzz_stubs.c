@@ -0,0 +1,187 @@
+/**
+ * Host stubs backing the real protocol.c for the fuzz harness.
+ *
+ * Everything protocol.c links against that isn't the parser itself: the
+ * UART (RX injection ring, TX counted and discarded), the TX DMA ring
+ * (reports uninitialized so the polled fallback runs), the bootloader
+ * flag, board/persistence lookups, and silent logging.
+ */
+
+#include "hardware/uart.h"
+#include "logging.h"
+#include "pcb_config.h"
+#include "config_persistence.h"
+#include "bootloader.h"
+#include "uart_tx_dma.h"
+#include <string.h>
+
+// Harness-controlled clock (declared in stubs/pico/stdlib.h)
+uint32_t fuzz_time_ms = 0;
+
+// UART instances only need distinct addresses
+static int g_uart0_dummy;
+static int g_uart1_dummy;
+uart_inst_t* const uart0 = &g_uart0_dummy;
+uart_inst_t* const uart1 = &g_uart1_dummy;
+
+// =============================================================================
+// RX injection ring / TX sink
+// =============================================================================
+
+// Sized so a soak chunk (several KB of frames) fits in one injection
+#define FUZZ_UART_RING_SIZE 65536
+
+static uint8_t g_rx_ring[FUZZ_UART_RING_SIZE];
+static size_t g_rx_head = 0;   // Next write
+static size_t g_rx_tail = 0;   // Next read
+static uint64_t g_tx_count = 0;
+
+void fuzz_uart_inject(const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        size_t next = (g_rx_head + 1) % FUZZ_UART_RING_SIZE;
+        if (next == g_rx_tail) {
+            return;  // Ring full - harness injects in bounded chunks
+        }
+        g_rx_ring[g_rx_head] = data[i];
+        g_rx_head = next;
+    }
+}
+
+size_t fuzz_uart_pending(void) {
+    return (g_rx_head + FUZZ_UART_RING_SIZE - g_rx_tail) % FUZZ_UART_RING_SIZE;
+}
+
+void fuzz_uart_clear(void) {
+    g_rx_head = 0;
+    g_rx_tail = 0;
+}
+
+uint64_t fuzz_uart_tx_count(void) {
+    return g_tx_count;
+}
+
+uint uart_init(uart_inst_t* uart, uint baudrate) {
+    (void)uart;
+    return baudrate;
+}
+
+void uart_set_format(uart_inst_t* uart, uint data_bits, uint stop_bits, uint parity) {
+    (void)uart; (void)data_bits; (void)stop_bits; (void)parity;
+}
+
+void uart_set_hw_flow(uart_inst_t* uart, bool cts, bool rts) {
+    (void)uart; (void)cts; (void)rts;
+}
+
+void uart_set_fifo_enabled(uart_inst_t* uart, bool enabled) {
+    (void)uart; (void)enabled;
+}
+
+bool uart_is_readable(uart_inst_t* uart) {
+    (void)uart;
+    return g_rx_tail != g_rx_head;
+}
+
+char uart_getc(uart_inst_t* uart) {
+    (void)uart;
+    if (g_rx_tail == g_rx_head) {
+        return 0;
+    }
+    char c = (char)g_rx_ring[g_rx_tail];
+    g_rx_tail = (g_rx_tail + 1) % FUZZ_UART_RING_SIZE;
+    return c;
+}
+
+bool uart_is_writable(uart_inst_t* uart) {
+    (void)uart;
+    return true;
+}
+
+void uart_putc(uart_inst_t* uart, char c) {
+    (void)uart; (void)c;
+    g_tx_count++;
+}
+
+void uart_putc_raw(uart_inst_t* uart, char c) {
+    uart_putc(uart, c);
+}
+
+void gpio_set_function(uint gpio, uint fn) {
+    (void)gpio; (void)fn;
+}
+
+// =============================================================================
+// TX DMA - report uninitialized so protocol.c takes the polled fallback
+// =============================================================================
+
+bool uart_tx_dma_init(uart_inst_t* uart) {
+    (void)uart;
+    return false;
+}
+
+void uart_tx_dma_deinit(void) {}
+
+bool uart_tx_dma_write(const uint8_t* data, size_t len) {
+    (void)data;
+    g_tx_count += len;
+    return true;
+}
+
+size_t uart_tx_dma_pending(void) {
+    return 0;
+}
+
+bool uart_tx_dma_is_idle(void) {
+    return true;
+}
+
+bool uart_tx_dma_is_initialized(void) {
+    return false;
+}
+
+// =============================================================================
+// Bootloader flag (toggleable so the harness can cover the drain path)
+// =============================================================================
+
+static bool g_bootloader_active = false;
+
+bool bootloader_is_active(void) {
+    return g_bootloader_active;
+}
+
+void fuzz_set_bootloader_active(bool active) {
+    g_bootloader_active = active;
+}
+
+// =============================================================================
+// Board / persistence lookups
+// =============================================================================
+
+const pcb_config_t* pcb_config_get(void) {
+    return NULL;  // protocol_init() falls back to compile-time pins
+}
+
+uint8_t config_persistence_get_machine_type(void) {
+    return 0;  // Not persisted - protocol falls back to compile-time type
+}
+
+// =============================================================================
+// Logging - silent; the fuzzer drives millions of deliberately bad frames
+// =============================================================================
+
+void log_message(log_level_t level, const char* format, ...) {
+    (void)level; (void)format;
+}
+
+void log_message_va(log_level_t level, const char* format, va_list args) {
+    (void)level; (void)format; (void)args;
+}
+
+void log_message_id(log_level_t level, uint16_t id, uint8_t argc, ...) {
+    (void)level; (void)id; (void)argc;
+}
+
+const char* log_level_name(log_level_t level) {
+    (void)level;
+    return "FUZZ";
+}
@@ -0,0 +1,393 @@
+/**
+ * Protocol Fuzz / Soak Harness
+ *
+ * Drives the REAL parser (../src/protocol.c, not a reimplementation)
+ * through the stubbed UART with corrupted frames, timing gaps, garbage
+ * bursts, batch containers, and mid-stream resyncs. Two modes:
+ *
+ *   fuzz (default): deterministic PRNG-driven frame mutations with
+ *   invariant checks - the parser must never deliver an invalid or
+ *   oversized packet, must account for every injected byte, and must
+ *   always recover to parsing pristine frames after a parser-timeout
+ *   reset. A failure prints the seed and iteration so the exact byte
+ *   sequence can be replayed.
+ *
+ *   soak (--soak): replays a representative day of ESP32->Pico traffic
+ *   (5Hz status ACKs, commands, logs, ~0.1% line corruption) compressed
+ *   into seconds, and measures parse throughput. Fails below --min-mbps
+ *   so a protocol change that slows the hot loop is caught in CI, not
+ *   on the machine.
+ *
+ * Usage:
+ *   protocol_fuzz [--iterations N] [--seed S] [--verbose]
+ *   protocol_fuzz --soak [--mb N] [--min-mbps F] [--verbose]
+ */
+
+#include "protocol.h"
+#include "hardware/uart.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// From fuzz_stubs.c
+extern uint32_t fuzz_time_ms;
+void fuzz_set_bootloader_active(bool active);
+
+#define FRAME_MAX PROTOCOL_MAX_PACKET  // sync + header + max payload + CRC
+
+// =============================================================================
+// Deterministic PRNG (xorshift32) - same seed, same byte stream
+// =============================================================================
+
+static uint32_t g_rng_state = 0x1234ABCD;
+
+static uint32_t prng(void) {
+    uint32_t x = g_rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g_rng_state = x;
+    return x;
+}
+
+static uint32_t prng_range(uint32_t n) {
+    return prng() % n;
+}
+
+// =============================================================================
+// Delivery tracking
+// =============================================================================
+
+static uint64_t g_delivered = 0;
+static uint64_t g_invariant_violations = 0;
+
+static void on_packet(const packet_t* packet) {
+    g_delivered++;
+    // The parser must only ever hand validated, in-bounds packets upward
+    if (!packet->valid || packet->length > PROTOCOL_MAX_PAYLOAD) {
+        g_invariant_violations++;
+        fprintf(stderr, "INVARIANT: delivered packet valid=%d length=%d\n",
+                packet->valid, packet->length);
+    }
+}
+
+// =============================================================================
+// Frame building / injection
+// =============================================================================
+
+// Build a wire frame with a correct CRC; returns total length
+static size_t build_frame(uint8_t* out, uint8_t type, uint8_t seq,
+                          const uint8_t* payload, uint8_t length) {
+    size_t idx = 0;
+    out[idx++] = PROTOCOL_SYNC_BYTE;
+    out[idx++] = type;
+    out[idx++] = length;
+    out[idx++] = seq;
+    if (length > 0) {
+        memcpy(&out[idx], payload, length);
+        idx += length;
+    }
+    uint16_t crc = protocol_crc16(&out[1], 3 + length);
+    out[idx++] = crc & 0xFF;
+    out[idx++] = (crc >> 8) & 0xFF;
+    return idx;
+}
+
+static size_t build_random_frame(uint8_t* out, uint8_t* payload_buf) {
+    uint8_t type = (uint8_t)(prng_range(0x30) + 1);
+    if (type == MSG_BATCH) {
+        type++;  // Batch containers get their own well-formed test case
+    }
+    uint8_t length = (uint8_t)prng_range(PROTOCOL_MAX_PAYLOAD + 1);
+    for (uint8_t i = 0; i < length; i++) {
+        payload_buf[i] = (uint8_t)prng();
+    }
+    return build_frame(out, type, (uint8_t)prng(), payload_buf, length);
+}
+
+// Reset the parser via its own timeout path, then require that a pristine
+// frame parses - this is the recovery invariant every fuzz case ends with
+static bool check_recovery(void) {
+    fuzz_time_ms += PROTOCOL_PARSER_TIMEOUT_MS + 1;
+    protocol_process();  // Timeout fires, state machine resets
+
+    uint8_t frame[FRAME_MAX];
+    uint8_t payload[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+    size_t len = build_frame(frame, 0x05, 0, payload, sizeof(payload));
+
+    uint64_t before = g_delivered;
+    fuzz_uart_inject(frame, len);
+    protocol_process();
+    return g_delivered == before + 1;
+}
+
+// =============================================================================
+// Fuzz mode
+// =============================================================================
+
+static int run_fuzz(uint32_t iterations, uint32_t seed) {
+    g_rng_state = seed ? seed : 0x1234ABCD;
+    uint64_t injected_bytes = 0;
+
+    uint8_t frame[FRAME_MAX];
+    uint8_t scratch[FRAME_MAX];
+    uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+
+    for (uint32_t iter = 0; iter < iterations; iter++) {
+        uint64_t before = g_delivered;
+        uint32_t op = prng_range(6);
+
+        switch (op) {
+            case 0: {
+                // Pristine frame - must deliver exactly once
+                size_t len = build_random_frame(frame, payload);
+                fuzz_uart_inject(frame, len);
+                injected_bytes += len;
+                protocol_process();
+                if (g_delivered != before + 1) {
+                    fprintf(stderr, "FAIL iter=%u seed=0x%08X: pristine frame not delivered\n",
+                            iter, seed);
+                    return 1;
+                }
+                break;
+            }
+
+            case 1: {
+                // Single flipped byte - CRC-16 catches every single-byte
+                // error inside the covered region; a corrupted sync byte
+                // just never starts a frame
+                size_t len = build_random_frame(frame, payload);
+                frame[prng_range((uint32_t)len)] ^= (uint8_t)(prng_range(255) + 1);
+                fuzz_uart_inject(frame, len);
+                injected_bytes += len;
+                protocol_process();
+                break;
+            }
+
+            case 2: {
+                // Garbage burst - random bytes, random length
+                uint32_t n = prng_range(FRAME_MAX) + 1;
+                for (uint32_t i = 0; i < n; i++) {
+                    scratch[i] = (uint8_t)prng();
+                }
+                fuzz_uart_inject(scratch, n);
+                injected_bytes += n;
+                protocol_process();
+                break;
+            }
+
+            case 3: {
+                // Timing gap: half a frame, then silence past the parser
+                // timeout - timeout_errors must move and recovery must hold
+                protocol_stats_t s0, s1;
+                protocol_get_stats(&s0);
+                size_t len = build_random_frame(frame, payload);
+                size_t half = len / 2 > 4 ? len / 2 : 4;
+                fuzz_uart_inject(frame, half);
+                injected_bytes += half;
+                protocol_process();
+
+                fuzz_time_ms += PROTOCOL_PARSER_TIMEOUT_MS + 1;
+                protocol_process();
+                protocol_get_stats(&s1);
+                if (s1.timeout_errors == s0.timeout_errors) {
+                    fprintf(stderr, "FAIL iter=%u seed=0x%08X: parser timeout did not fire\n",
+                            iter, seed);
+                    return 1;
+                }
+                break;
+            }
+
+            case 4: {
+                // Well-formed MSG_BATCH - every sub-message must deliver
+                uint32_t subs = prng_range(3) + 1;
+                uint8_t batch[PROTOCOL_MAX_PAYLOAD];
+                uint8_t off = 0;
+                for (uint32_t s = 0; s < subs; s++) {
+                    uint8_t sub_len = (uint8_t)prng_range(12);
+                    if (off + PROTOCOL_BATCH_SUBHDR_SIZE + sub_len > PROTOCOL_MAX_PAYLOAD) {
+                        subs = s;
+                        break;
+                    }
+                    batch[off++] = (uint8_t)(prng_range(0x30) + 1);
+                    batch[off++] = sub_len;
+                    for (uint8_t i = 0; i < sub_len; i++) {
+                        batch[off++] = (uint8_t)prng();
+                    }
+                }
+                if (subs == 0) break;
+                size_t len = build_frame(frame, MSG_BATCH, (uint8_t)prng(), batch, off);
+                fuzz_uart_inject(frame, len);
+                injected_bytes += len;
+                protocol_process();
+                if (g_delivered != before + subs) {
+                    fprintf(stderr, "FAIL iter=%u seed=0x%08X: batch delivered %llu of %u subs\n",
+                            iter, seed,
+                            (unsigned long long)(g_delivered - before), subs);
+                    return 1;
+                }
+                break;
+            }
+
+            case 5: {
+                // Mid-stream resync: truncate one frame, splice the next in
+                // immediately - the splice is swallowed into the truncated
+                // frame's CRC window, so only recovery below is asserted
+                size_t len = build_random_frame(frame, payload);
+                size_t cut = prng_range((uint32_t)len - 1) + 1;
+                fuzz_uart_inject(frame, cut);
+                injected_bytes += cut;
+                size_t len2 = build_random_frame(scratch, payload);
+                fuzz_uart_inject(scratch, len2);
+                injected_bytes += len2;
+                protocol_process();
+                break;
+            }
+        }
+
+        // Every case ends with the parser able to parse a pristine frame
+        if (!check_recovery()) {
+            fprintf(stderr, "FAIL iter=%u seed=0x%08X op=%u: parser did not recover\n",
+                    iter, seed, op);
+            return 1;
+        }
+        injected_bytes += 10;              // check_recovery's 4-byte-payload frame
+    }
+
+    // Bookkeeping invariants over the whole run
+    protocol_stats_t stats;
+    protocol_get_stats(&stats);
+    if (stats.bytes_received != injected_bytes) {
+        fprintf(stderr, "FAIL seed=0x%08X: bytes_received=%llu != injected=%llu\n",
+                seed, (unsigned long long)stats.bytes_received,
+                (unsigned long long)injected_bytes);
+        return 1;
+    }
+    if (g_invariant_violations != 0) {
+        fprintf(stderr, "FAIL seed=0x%08X: %llu invariant violations\n",
+                seed, (unsigned long long)g_invariant_violations);
+        return 1;
+    }
+
+    fprintf(stderr, "protocol_fuzz: %u iterations OK (seed=0x%08X, delivered=%llu, "
+            "crc_errors=%lu, timeouts=%lu, pkt_errors=%lu)\n",
+            iterations, seed, (unsigned long long)g_delivered,
+            (unsigned long)stats.crc_errors, (unsigned long)stats.timeout_errors,
+            (unsigned long)stats.packet_errors);
+    return 0;
+}
+
+// =============================================================================
+// Soak mode
+// =============================================================================
+
+// Build one "second" of representative ESP32->Pico traffic into buf:
+// 5 status ACKs, a command, a couple of logs - with a ~0.1% corrupted byte
+static size_t build_soak_second(uint8_t* buf) {
+    size_t off = 0;
+    uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+
+    for (int i = 0; i < 5; i++) {  // 5Hz ACK traffic
+        memset(payload, i, 4);
+        off += build_frame(&buf[off], MSG_ACK, (uint8_t)i, payload, 4);
+    }
+    memset(payload, 0x42, 8);      // One command
+    off += build_frame(&buf[off], 0x10, 0, payload, 8);
+    memset(payload, 0x55, 24);     // Two mid-size frames (logs/config)
+    off += build_frame(&buf[off], 0x06, 0, payload, 24);
+    off += build_frame(&buf[off], 0x07, 0, payload, 24);
+
+    if (prng_range(1000) == 0) {   // ~0.1% line corruption
+        buf[prng_range((uint32_t)off)] ^= (uint8_t)(prng_range(255) + 1);
+    }
+    return off;
+}
+
+static int run_soak(uint32_t megabytes, double min_mbps) {
+    // A day at this mix is ~15MB; default 64MB is four days of traffic
+    uint8_t chunk[8192];
+    uint64_t target_bytes = (uint64_t)megabytes * 1024 * 1024;
+    uint64_t total_bytes = 0;
+    uint64_t total_frames = 0;
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    while (total_bytes < target_bytes) {
+        size_t off = 0;
+        uint64_t frames = 0;
+        while (off + (8 * FRAME_MAX) < sizeof(chunk)) {
+            off += build_soak_second(&chunk[off]);
+            frames += 8;
+        }
+        fuzz_uart_inject(chunk, off);
+        protocol_process();
+        total_bytes += off;
+        total_frames += frames;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double secs = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    double mbps = ((double)total_bytes / (1024.0 * 1024.0)) / secs;
+
+    protocol_stats_t stats;
+    protocol_get_stats(&stats);
+    fprintf(stderr, "protocol_soak: %llu MB in %.2fs = %.1f MB/s (%.0f frames/s, "
+            "crc_errors=%lu)\n",
+            (unsigned long long)(total_bytes >> 20), secs, mbps,
+            (double)total_frames / secs, (unsigned long)stats.crc_errors);
+
+    if (g_invariant_violations != 0) {
+        fprintf(stderr, "FAIL: %llu invariant violations during soak\n",
+                (unsigned long long)g_invariant_violations);
+        return 1;
+    }
+    if (mbps < min_mbps) {
+        fprintf(stderr, "FAIL: throughput %.1f MB/s below threshold %.1f MB/s - "
+                "a parser change likely regressed the hot loop\n", mbps, min_mbps);
+        return 1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// Entry point
+// =============================================================================
+
+int main(int argc, char** argv) {
+    bool soak = false;
+    bool verbose = false;
+    uint32_t iterations = 20000;
+    uint32_t seed = 0x1234ABCD;
+    uint32_t megabytes = 64;
+    double min_mbps = 10.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--soak") == 0) soak = true;
+        else if (strcmp(argv[i], "--verbose") == 0) verbose = true;
+        else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--mb") == 0 && i + 1 < argc) megabytes = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--min-mbps") == 0 && i + 1 < argc) min_mbps = strtod(argv[++i], NULL);
+        else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    // protocol.c's LOG_PRINT maps to printf under UNIT_TEST; millions of
+    // deliberately corrupted frames would drown the report (and the soak
+    // timing), so parser chatter goes to /dev/null unless asked for
+    if (!verbose) {
+        if (!freopen("/dev/null", "w", stdout)) {
+            return 2;
+        }
+    }
+
+    fuzz_time_ms = 1000;  // Non-zero so the timeout path's guard is armed
+    protocol_init();
+    protocol_set_callback(on_packet);
+
+    return soak ? run_soak(megabytes, min_mbps) : run_fuzz(iterations, seed);
+}
@@ -0,0 +1,43 @@
+/**
+ * Host stub of hardware/uart.h for the protocol fuzz harness.
+ *
+ * RX is an injection ring the harness fills with fuzz_uart_inject();
+ * protocol_process() then drains it through uart_is_readable()/uart_getc()
+ * exactly as it would drain the real FIFO. TX bytes are counted and
+ * discarded (the harness never asserts on outbound traffic).
+ */
+
+#ifndef _HARDWARE_UART_H
+#define _HARDWARE_UART_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pico/stdlib.h"
+
+// Matches the UNIT_TEST typedef in uart_tx_dma.h - both are visible from
+// protocol.c, and C11 only permits identical typedef redefinitions
+typedef void uart_inst_t;
+
+extern uart_inst_t* const uart0;
+extern uart_inst_t* const uart1;
+
+#define UART_PARITY_NONE 0
+
+uint uart_init(uart_inst_t* uart, uint baudrate);
+void uart_set_format(uart_inst_t* uart, uint data_bits, uint stop_bits, uint parity);
+void uart_set_hw_flow(uart_inst_t* uart, bool cts, bool rts);
+void uart_set_fifo_enabled(uart_inst_t* uart, bool enabled);
+bool uart_is_readable(uart_inst_t* uart);
+char uart_getc(uart_inst_t* uart);
+bool uart_is_writable(uart_inst_t* uart);
+void uart_putc(uart_inst_t* uart, char c);
+void uart_putc_raw(uart_inst_t* uart, char c);
+
+// Harness-side controls
+void fuzz_uart_inject(const uint8_t* data, size_t len);
+size_t fuzz_uart_pending(void);
+void fuzz_uart_clear(void);
+uint64_t fuzz_uart_tx_count(void);
+
+#endif // _HARDWARE_UART_H
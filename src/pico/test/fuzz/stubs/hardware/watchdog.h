@@ -0,0 +1,13 @@
+/**
+ * Host stub of hardware/watchdog.h for the protocol fuzz harness.
+ */
+
+#ifndef _HARDWARE_WATCHDOG_H
+#define _HARDWARE_WATCHDOG_H
+
+#include <stdbool.h>
+
+static inline bool watchdog_caused_reboot(void) { return false; }
+static inline bool watchdog_enable_caused_reboot(void) { return false; }
+
+#endif // _HARDWARE_WATCHDOG_H
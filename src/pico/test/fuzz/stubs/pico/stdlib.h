@@ -0,0 +1,35 @@
+/**
+ * Host stub of pico/stdlib.h for the protocol fuzz harness.
+ *
+ * Only the slice protocol.c touches. The clock is a harness-controlled
+ * variable so tests can open timing gaps without actually sleeping.
+ */
+
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+// Harness-controlled clock (milliseconds)
+extern uint32_t fuzz_time_ms;
+
+static inline absolute_time_t get_absolute_time(void) {
+    return (absolute_time_t)fuzz_time_ms;
+}
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t)t;
+}
+
+static inline void sleep_us(uint64_t us) { (void)us; }
+static inline void sleep_ms(uint32_t ms) { (void)ms; }
+
+// hardware/gpio.h arrives via pico/stdlib.h on the real SDK
+#define GPIO_FUNC_UART 2
+void gpio_set_function(uint gpio, uint fn);
+
+#endif // _PICO_STDLIB_H
@@ -22,6 +22,7 @@
 
 typedef struct {
     float kp, ki, kd;
+    float eff_kp, eff_ki, eff_kd;  // Blended effective gains (gain scheduling)
     float setpoint;
     float setpoint_target;
     float integral;
@@ -31,6 +32,7 @@ typedef struct {
     float output;
     bool setpoint_ramping;
     float ramp_rate;
+    uint8_t regime;             // PID_REGIME_* (gain scheduling)
     bool first_run;             // Skip derivative on first call
 } pid_state_t;
 
@@ -39,6 +41,22 @@ typedef struct {
 #define PID_OUTPUT_MAX 100.0f
 #define PID_OUTPUT_MIN 0.0f
 
+// Gain scheduling constants (from config.h) and regimes (control_impl.h)
+#define PID_REGIME_STEADY   0
+#define PID_REGIME_HEATUP   1
+#define PID_REGIME_RECOVERY 2
+#define PID_REGIME_HEATUP_ERROR_C    8.0f
+#define PID_REGIME_RECOVER_ENTER_C   1.5f
+#define PID_REGIME_RECOVER_EXIT_C    0.5f
+#define PID_REGIME_RECOVER_SLOPE_C_S 0.05f
+#define PID_REGIME_BLEND_TAU_S       2.0f
+#define PID_HEATUP_KP_MULT           1.5f
+#define PID_HEATUP_KI_MULT           0.2f
+#define PID_HEATUP_KD_MULT           1.0f
+#define PID_RECOVER_KP_MULT          1.6f
+#define PID_RECOVER_KI_MULT          1.4f
+#define PID_RECOVER_KD_MULT          0.7f
+
 // =============================================================================
 // PID Functions (matches fixed control_common.c implementation)
 // =============================================================================
@@ -47,6 +65,10 @@ static void pid_init(pid_state_t* pid, float kp, float ki, float kd, float setpo
     pid->kp = kp;
     pid->ki = ki;
     pid->kd = kd;
+    pid->eff_kp = kp;
+    pid->eff_ki = ki;
+    pid->eff_kd = kd;
+    pid->regime = PID_REGIME_STEADY;
     pid->setpoint = setpoint;
     pid->setpoint_target = setpoint;
     pid->integral = 0.0f;
@@ -111,6 +133,44 @@ static float pid_compute(pid_state_t* pid, float measurement, float dt) {
     return output;
 }
 
+// Gain scheduler (matches pid_schedule_gains in control_common.c):
+// regime from setpoint error and filtered slope, with hysteresis, then an
+// exponential blend of the effective gains toward the regime's set
+static void pid_schedule_gains(pid_state_t* pid, float error, float dt) {
+    uint8_t regime;
+    if (error >= PID_REGIME_HEATUP_ERROR_C) {
+        regime = PID_REGIME_HEATUP;
+    } else if (error >= PID_REGIME_RECOVER_ENTER_C) {
+        regime = PID_REGIME_RECOVERY;
+    } else if (pid->regime == PID_REGIME_STEADY &&
+               error > PID_REGIME_RECOVER_EXIT_C &&
+               pid->last_derivative < -PID_REGIME_RECOVER_SLOPE_C_S) {
+        regime = PID_REGIME_RECOVERY;
+    } else if (pid->regime != PID_REGIME_STEADY &&
+               error > PID_REGIME_RECOVER_EXIT_C) {
+        regime = PID_REGIME_RECOVERY;
+    } else {
+        regime = PID_REGIME_STEADY;
+    }
+    pid->regime = regime;
+
+    float tkp = pid->kp, tki = pid->ki, tkd = pid->kd;
+    if (regime == PID_REGIME_HEATUP) {
+        tkp *= PID_HEATUP_KP_MULT;
+        tki *= PID_HEATUP_KI_MULT;
+        tkd *= PID_HEATUP_KD_MULT;
+    } else if (regime == PID_REGIME_RECOVERY) {
+        tkp *= PID_RECOVER_KP_MULT;
+        tki *= PID_RECOVER_KI_MULT;
+        tkd *= PID_RECOVER_KD_MULT;
+    }
+
+    float alpha = dt / (PID_REGIME_BLEND_TAU_S + dt);
+    pid->eff_kp += alpha * (tkp - pid->eff_kp);
+    pid->eff_ki += alpha * (tki - pid->eff_ki);
+    pid->eff_kd += alpha * (tkd - pid->eff_kd);
+}
+
 // =============================================================================
 // Test State
 // =============================================================================
@@ -384,6 +444,97 @@ void test_pid_pd_control(void) {
     TEST_ASSERT_FLOAT_WITHIN(5.0f, 20.0f, stable);  // ~P*error
 }
 
+// --- Gain Scheduling ---
+
+void test_pid_schedule_large_error_is_heatup(void) {
+    // SPEC: Error beyond the heat-up threshold selects the heat-up regime
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    pid_schedule_gains(&g_pid, 20.0f, 0.1f);  // 20C below setpoint
+
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_HEATUP, g_pid.regime);
+}
+
+void test_pid_schedule_moderate_error_is_recovery(void) {
+    // SPEC: Error past the recovery enter threshold selects recovery
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    pid_schedule_gains(&g_pid, 3.0f, 0.1f);
+
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_RECOVERY, g_pid.regime);
+}
+
+void test_pid_schedule_small_error_is_steady(void) {
+    // SPEC: At the setpoint (within the exit band) the regime is steady-state
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    pid_schedule_gains(&g_pid, 0.2f, 0.1f);
+
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_STEADY, g_pid.regime);
+}
+
+void test_pid_schedule_fast_drop_enters_recovery_early(void) {
+    // SPEC: A fast falling temperature (the shot's cold slug) enters recovery
+    // before the error threshold trips
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+    g_pid.last_derivative = -0.3f;  // Falling hard
+
+    // Error still inside the enter threshold (0.5 < 0.8 < 1.5)
+    pid_schedule_gains(&g_pid, 0.8f, 0.1f);
+
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_RECOVERY, g_pid.regime);
+}
+
+void test_pid_schedule_hysteresis_holds_recovery(void) {
+    // SPEC: Once in recovery, the regime holds until the error genuinely
+    // closes (below the exit threshold) - no chatter at the enter threshold
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    pid_schedule_gains(&g_pid, 3.0f, 0.1f);   // Enter recovery
+    pid_schedule_gains(&g_pid, 1.0f, 0.1f);   // Between exit (0.5) and enter (1.5)
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_RECOVERY, g_pid.regime);
+
+    pid_schedule_gains(&g_pid, 0.3f, 0.1f);   // Below exit threshold
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_STEADY, g_pid.regime);
+}
+
+void test_pid_schedule_blend_is_smooth(void) {
+    // SPEC: A regime switch must not step the effective gains - they blend
+    // toward the new set with the configured time constant
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    pid_schedule_gains(&g_pid, 3.0f, 0.1f);  // One tick into recovery
+
+    float recovery_kp = 2.0f * PID_RECOVER_KP_MULT;  // 3.2
+    // One 0.1s tick moves ~5% of the way (alpha = 0.1 / 2.1)
+    TEST_ASSERT_GREATER_THAN(2.0f, g_pid.eff_kp);
+    TEST_ASSERT_LESS_THAN(2.2f, g_pid.eff_kp);
+
+    // Many ticks converge onto the recovery set
+    for (int i = 0; i < 500; i++) {
+        pid_schedule_gains(&g_pid, 3.0f, 0.1f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, recovery_kp, g_pid.eff_kp);
+}
+
+void test_pid_schedule_returns_to_configured_gains(void) {
+    // SPEC: Back at steady-state the effective gains converge onto the
+    // configured set - scheduling must not permanently alter the tuning
+    pid_init(&g_pid, 2.0f, 0.1f, 1.0f, 93.0f);
+
+    for (int i = 0; i < 500; i++) {
+        pid_schedule_gains(&g_pid, 20.0f, 0.1f);  // Heat-up regime
+    }
+    for (int i = 0; i < 500; i++) {
+        pid_schedule_gains(&g_pid, 0.1f, 0.1f);   // Settled
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(PID_REGIME_STEADY, g_pid.regime);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 2.0f, g_pid.eff_kp);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.1f, g_pid.eff_ki);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f, g_pid.eff_kd);
+}
+
 // =============================================================================
 // Test Runner
 // =============================================================================
@@ -423,6 +574,15 @@ int run_pid_tests(void) {
     RUN_TEST(test_pid_p_only_control);
     RUN_TEST(test_pid_pi_control);
     RUN_TEST(test_pid_pd_control);
-    
+
+    // Gain Scheduling
+    RUN_TEST(test_pid_schedule_large_error_is_heatup);
+    RUN_TEST(test_pid_schedule_moderate_error_is_recovery);
+    RUN_TEST(test_pid_schedule_small_error_is_steady);
+    RUN_TEST(test_pid_schedule_fast_drop_enters_recovery_early);
+    RUN_TEST(test_pid_schedule_hysteresis_holds_recovery);
+    RUN_TEST(test_pid_schedule_blend_is_smooth);
+    RUN_TEST(test_pid_schedule_returns_to_configured_gains);
+
     return UnityEnd();
 }
@@ -14,10 +14,17 @@
 #define PROTOCOL_SYNC_BYTE 0xAA
 #define PROTOCOL_MAX_PAYLOAD 56
 
-// CRC-16-CCITT implementation (copied from protocol.c for testing)
+// Shared table-driven implementation (same one protocol.c uses in production)
+#include "protocol_crc.h"
+
 uint16_t protocol_crc16(const uint8_t* data, size_t length) {
+    return protocol_crc16_ccitt(data, length);
+}
+
+// Bit-at-a-time reference implementation - kept to verify the lookup table
+static uint16_t crc16_bitwise_reference(const uint8_t* data, size_t length) {
     uint16_t crc = 0xFFFF;
-    
+
     for (size_t i = 0; i < length; i++) {
         crc ^= (uint16_t)data[i] << 8;
         for (int j = 0; j < 8; j++) {
@@ -28,7 +35,7 @@ uint16_t protocol_crc16(const uint8_t* data, size_t length) {
             }
         }
     }
-    
+
     return crc;
 }
 
@@ -243,6 +250,138 @@ void test_crc16_incremental_data(void) {
     }
 }
 
+// =============================================================================
+// Table vs Bitwise Cross-Check
+// =============================================================================
+
+void test_crc16_table_matches_bitwise_reference(void) {
+    // Every table entry must agree with the bit-at-a-time implementation
+    for (int i = 0; i < 256; i++) {
+        uint8_t byte = (uint8_t)i;
+        TEST_ASSERT_EQUAL_UINT16(crc16_bitwise_reference(&byte, 1),
+                                 protocol_crc16(&byte, 1));
+    }
+
+    // And over a multi-byte pseudo-random buffer
+    uint8_t data[128];
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < 128; i++) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+    for (size_t len = 0; len <= sizeof(data); len += 7) {
+        TEST_ASSERT_EQUAL_UINT16(crc16_bitwise_reference(data, len),
+                                 protocol_crc16(data, len));
+    }
+}
+
+// =============================================================================
+// Batch Frame Tests (MSG_BATCH)
+// =============================================================================
+
+// Batch sub-header: type(1) + length(1) per sub-message
+// (mirrors PROTOCOL_BATCH_SUBHDR_SIZE in protocol.h)
+#define BATCH_SUBHDR_SIZE 2
+
+void test_batch_frame_overhead_savings(void) {
+    // Three 4-byte messages sent individually: 3 * (6 frame overhead + 4) = 30 bytes
+    // Batched: 6 frame overhead + 3 * (2 sub-header + 4) = 24 bytes
+    int individual = 3 * (6 + 4);
+    int batched = 6 + 3 * (BATCH_SUBHDR_SIZE + 4);
+    TEST_ASSERT_EQUAL_INT(30, individual);
+    TEST_ASSERT_EQUAL_INT(24, batched);
+    TEST_ASSERT_TRUE(batched < individual);
+}
+
+void test_batch_payload_walk(void) {
+    // Build a batch payload with three sub-messages and walk it the way
+    // the dispatcher does: [type | length | payload] repeated
+    uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+    uint8_t used = 0;
+
+    const uint8_t types[3] = {0x01, 0x02, 0x25};
+    const uint8_t lengths[3] = {4, 0, 8};
+
+    for (int i = 0; i < 3; i++) {
+        payload[used++] = types[i];
+        payload[used++] = lengths[i];
+        for (int j = 0; j < lengths[i]; j++) {
+            payload[used++] = (uint8_t)(i * 16 + j);
+        }
+    }
+
+    // Walk and verify each sub-message is recovered intact
+    uint8_t offset = 0;
+    int count = 0;
+    while (offset + BATCH_SUBHDR_SIZE <= used) {
+        uint8_t sub_type = payload[offset];
+        uint8_t sub_length = payload[offset + 1];
+        offset += BATCH_SUBHDR_SIZE;
+
+        TEST_ASSERT_TRUE(offset + sub_length <= used);
+        TEST_ASSERT_EQUAL_UINT8(types[count], sub_type);
+        TEST_ASSERT_EQUAL_UINT8(lengths[count], sub_length);
+        for (int j = 0; j < sub_length; j++) {
+            TEST_ASSERT_EQUAL_UINT8((uint8_t)(count * 16 + j), payload[offset + j]);
+        }
+        offset += sub_length;
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT_EQUAL_UINT8(used, offset);
+}
+
+void test_batch_truncated_subheader_rejected(void) {
+    // A trailing lone byte (type with no length) must not parse as a sub-message
+    uint8_t payload[3] = {0x01, 0x00, 0x02};  // valid empty msg + orphan type byte
+    uint8_t used = 3;
+
+    uint8_t offset = 0;
+    int count = 0;
+    while (offset + BATCH_SUBHDR_SIZE <= used) {
+        uint8_t sub_length = payload[offset + 1];
+        offset += BATCH_SUBHDR_SIZE + sub_length;
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(1, count);  // Orphan byte ignored
+}
+
+// =============================================================================
+// Latency Histogram Tests
+// =============================================================================
+
+#include "protocol_latency.h"
+
+void test_latency_bucket_bounds(void) {
+    // Bucket edges are inclusive upper bounds; above the top bound goes to
+    // the overflow bucket
+    TEST_ASSERT_EQUAL_UINT8(0, protocol_latency_bucket(0));
+    TEST_ASSERT_EQUAL_UINT8(0, protocol_latency_bucket(10));
+    TEST_ASSERT_EQUAL_UINT8(1, protocol_latency_bucket(11));
+    TEST_ASSERT_EQUAL_UINT8(6, protocol_latency_bucket(1000));
+    TEST_ASSERT_EQUAL_UINT8(7, protocol_latency_bucket(1001));
+    TEST_ASSERT_EQUAL_UINT8(7, protocol_latency_bucket(0xFFFFFFFF));
+}
+
+void test_latency_percentile_from_buckets(void) {
+    uint32_t buckets[PROTOCOL_LATENCY_BUCKET_COUNT] = {0};
+
+    // No samples yet
+    TEST_ASSERT_EQUAL_UINT32(0, protocol_latency_percentile_ms(buckets, 0, 50));
+
+    // 90 fast samples (<=10ms), 10 slow ones (<=250ms)
+    buckets[0] = 90;
+    buckets[4] = 10;
+    TEST_ASSERT_EQUAL_UINT32(10, protocol_latency_percentile_ms(buckets, 100, 50));
+    TEST_ASSERT_EQUAL_UINT32(250, protocol_latency_percentile_ms(buckets, 100, 95));
+
+    // Single sample: every percentile lands on it
+    uint32_t one[PROTOCOL_LATENCY_BUCKET_COUNT] = {0};
+    one[2] = 1;  // <=50ms
+    TEST_ASSERT_EQUAL_UINT32(50, protocol_latency_percentile_ms(one, 1, 50));
+    TEST_ASSERT_EQUAL_UINT32(50, protocol_latency_percentile_ms(one, 1, 95));
+}
+
 // =============================================================================
 // Test Runner
 // =============================================================================
@@ -273,7 +412,17 @@ int run_protocol_tests(void) {
     // CRC Edge Cases
     RUN_TEST(test_crc16_large_payload);
     RUN_TEST(test_crc16_incremental_data);
-    
+    RUN_TEST(test_crc16_table_matches_bitwise_reference);
+
+    // Batch Frame Tests
+    RUN_TEST(test_batch_frame_overhead_savings);
+    RUN_TEST(test_batch_payload_walk);
+    RUN_TEST(test_batch_truncated_subheader_rejected);
+
+    // Latency Histogram Tests
+    RUN_TEST(test_latency_bucket_bounds);
+    RUN_TEST(test_latency_percentile_from_buckets);
+
     return UnityEnd();
 }
 
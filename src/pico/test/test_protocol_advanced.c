@@ -144,24 +144,28 @@ void test_crc16_nack_packet(void) {
 void test_handshake_payload_size(void) {
     handshake_payload_t handshake;
     
-    // Handshake payload should be 6 bytes
-    TEST_ASSERT_EQUAL(6, sizeof(handshake));
-    
+    // Handshake payload should be 8 bytes (6 legacy + 2 status rate fields)
+    TEST_ASSERT_EQUAL(8, sizeof(handshake));
+
     // Verify field layout
     handshake.protocol_version_major = 1;
     handshake.protocol_version_minor = 1;
-    handshake.capabilities = 0;
+    handshake.capabilities = PROTOCOL_CAP_RATE_NEGOTIATION;
     handshake.max_retry_count = 3;
     handshake.ack_timeout_ms = 1000;
-    
+    handshake.status_rate_idle_hz = 2;
+    handshake.status_rate_active_hz = 20;
+
     // Check packed correctly
     uint8_t* bytes = (uint8_t*)&handshake;
     TEST_ASSERT_EQUAL_UINT8(1, bytes[0]);  // major
     TEST_ASSERT_EQUAL_UINT8(1, bytes[1]);  // minor
-    TEST_ASSERT_EQUAL_UINT8(0, bytes[2]);  // capabilities
+    TEST_ASSERT_EQUAL_UINT8(PROTOCOL_CAP_RATE_NEGOTIATION, bytes[2]);  // capabilities
     TEST_ASSERT_EQUAL_UINT8(3, bytes[3]);  // max_retry
     TEST_ASSERT_EQUAL_UINT8(0xE8, bytes[4]); // timeout low (1000 = 0x03E8)
     TEST_ASSERT_EQUAL_UINT8(0x03, bytes[5]); // timeout high
+    TEST_ASSERT_EQUAL_UINT8(2, bytes[6]);  // idle status rate
+    TEST_ASSERT_EQUAL_UINT8(20, bytes[7]); // active status rate
 }
 
 void test_pending_command_structure(void) {
@@ -252,6 +256,18 @@ void test_boot_payload_includes_protocol_version(void) {
     TEST_ASSERT_EQUAL_UINT8(1, boot.protocol_version_minor);
 }
 
+void test_status_delta_format_limits(void) {
+    // Worst-case delta (mask + every field changed) must fit a single frame
+    TEST_ASSERT_TRUE(STATUS_DELTA_MASK_SIZE + sizeof(status_payload_t) <= PROTOCOL_MAX_PAYLOAD);
+
+    // All field bits must fit the uint32 mask prefix
+    TEST_ASSERT_TRUE(STATUS_DELTA_FIELD_COUNT <= 32);
+
+    // The ESP32-side field table assumes this exact struct size - a new
+    // status field means updating STATUS_DELTA_FIELD_COUNT and both tables
+    TEST_ASSERT_EQUAL(47, sizeof(status_payload_t));
+}
+
 // =============================================================================
 // Test Runner
 // =============================================================================
@@ -272,6 +288,7 @@ int run_protocol_advanced_tests(void) {
     RUN_TEST(test_protocol_constants);
     RUN_TEST(test_protocol_version);
     RUN_TEST(test_boot_payload_includes_protocol_version);
+    RUN_TEST(test_status_delta_format_limits);
     
     return UnityEnd();
 }
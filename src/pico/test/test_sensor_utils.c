@@ -176,6 +176,54 @@ void test_ntc_adc_to_temp_cold_temperature(void) {
     TEST_ASSERT_FLOAT_WITHIN(3.0f, 0.0f, temp);
 }
 
+// =============================================================================
+// NTC Lookup Table Tests
+// =============================================================================
+
+void test_ntc_lut_matches_analytic_conversion(void) {
+    // SPEC: Table lookup with lerp must track the analytic Steinhart-Hart
+    // conversion within 0.5C across the usable ADC range
+    ntc_lut_t lut;
+    ntc_lut_init(&lut, 3.3f, 3300.0f, 3300.0f, 3950.0f);
+
+    for (uint16_t adc = 64; adc <= 3900; adc += 7) {
+        float analytic = ntc_adc_to_temp(adc, 3.3f, 3300.0f, 3300.0f, 3950.0f);
+        float from_lut = ntc_lut_lookup(&lut, adc);
+
+        if (isnan(analytic)) {
+            TEST_ASSERT_FLOAT_IS_NAN(from_lut);
+        } else {
+            TEST_ASSERT_FLOAT_WITHIN(0.5f, analytic, from_lut);
+        }
+    }
+}
+
+void test_ntc_lut_key_temperatures(void) {
+    // SPEC: Same physical reference points as the analytic tests above
+    ntc_lut_t lut;
+    ntc_lut_init(&lut, 3.3f, 3300.0f, 3300.0f, 3950.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, 25.0f, ntc_lut_lookup(&lut, ADC_AT_25C));
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 93.0f, ntc_lut_lookup(&lut, ADC_AT_93C));
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, 140.0f, ntc_lut_lookup(&lut, ADC_AT_140C));
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 0.0f, ntc_lut_lookup(&lut, ADC_AT_0C));
+}
+
+void test_ntc_lut_invalid_codes_return_nan(void) {
+    // SPEC: Open/short-circuit ADC codes are sensor faults, not temperatures
+    ntc_lut_t lut;
+    ntc_lut_init(&lut, 3.3f, 3300.0f, 3300.0f, 3950.0f);
+
+    TEST_ASSERT_FLOAT_IS_NAN(ntc_lut_lookup(&lut, 0));
+    TEST_ASSERT_FLOAT_IS_NAN(ntc_lut_lookup(&lut, 4095));
+    TEST_ASSERT_FLOAT_IS_NAN(ntc_lut_lookup(&lut, 5000));  // Out of ADC range
+}
+
+void test_ntc_lut_null_safety(void) {
+    ntc_lut_init(NULL, 3.3f, 3300.0f, 3300.0f, 3950.0f);  // Must not crash
+    TEST_ASSERT_FLOAT_IS_NAN(ntc_lut_lookup(NULL, 2048));
+}
+
 // =============================================================================
 // Temperature Validation Tests
 // =============================================================================
@@ -323,6 +371,96 @@ void test_filter_moving_avg_null_safety(void) {
     TEST_ASSERT_EQUAL_FLOAT(99.0f, result);
 }
 
+// =============================================================================
+// Temperature Estimator Tests (Alpha-Beta with Heater Feedforward)
+// =============================================================================
+
+void test_temp_estimator_first_sample_seeds_state(void) {
+    // SPEC: First measurement seeds the estimate and is returned unchanged
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    float result = temp_estimator_update(&est, 93.0f, 0.0f, 0.05f);
+
+    TEST_ASSERT_EQUAL_FLOAT(93.0f, result);
+    TEST_ASSERT_EQUAL_FLOAT(93.0f, est.temp_c);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, est.rate_c_per_s);
+}
+
+void test_temp_estimator_constant_input_stable(void) {
+    // SPEC: Constant measurement with heater off converges to the measurement
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    float result = 0.0f;
+    for (int i = 0; i < 100; i++) {
+        result = temp_estimator_update(&est, 93.0f, 0.0f, 0.05f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 93.0f, result);
+}
+
+void test_temp_estimator_feedforward_leads_measurement(void) {
+    // SPEC: With the heater on, the prediction contains the heating the
+    // measurement has not shown yet - the estimate must lead a measurement
+    // held at the pre-heating value
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    temp_estimator_update(&est, 80.0f, 0.0f, 0.05f);  // Seed at 80°C
+    float result = temp_estimator_update(&est, 80.0f, 100.0f, 0.05f);
+
+    // Predicted rise: 0.5°C/s * 0.05s = 0.025°C, pulled back by alpha
+    TEST_ASSERT_TRUE(result > 80.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.025f, 80.02f, result);
+}
+
+void test_temp_estimator_tracks_ramp(void) {
+    // SPEC: The beta term learns a steady rate, so a linear ramp is tracked
+    // with much less lag than a moving average of the same data
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    // Ramp 0.5°C/s with the heater at 100% (matched model: no residual lag)
+    float temp = 80.0f;
+    float result = 0.0f;
+    for (int i = 0; i < 200; i++) {
+        temp += 0.5f * 0.05f;
+        result = temp_estimator_update(&est, temp, 100.0f, 0.05f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, temp, result);
+}
+
+void test_temp_estimator_nan_coasts_on_estimate(void) {
+    // SPEC: A bad sample returns the held estimate, not NAN
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    temp_estimator_update(&est, 93.0f, 0.0f, 0.05f);
+    float result = temp_estimator_update(&est, NAN, 0.0f, 0.05f);
+
+    TEST_ASSERT_EQUAL_FLOAT(93.0f, result);
+}
+
+void test_temp_estimator_reset_and_null_safety(void) {
+    temp_estimator_t est;
+    temp_estimator_init(&est, 0.25f, 0.05f, 0.5f);
+
+    temp_estimator_update(&est, 93.0f, 0.0f, 0.05f);
+    temp_estimator_reset(&est);
+    TEST_ASSERT_FALSE(est.initialized);
+
+    // After reset, next sample re-seeds
+    float result = temp_estimator_update(&est, 50.0f, 0.0f, 0.05f);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, result);
+
+    // Should not crash with NULL; update returns the input unchanged
+    temp_estimator_init(NULL, 0.25f, 0.05f, 0.5f);
+    temp_estimator_reset(NULL);
+    TEST_ASSERT_EQUAL_FLOAT(99.0f, temp_estimator_update(NULL, 99.0f, 0.0f, 0.05f));
+}
+
 // =============================================================================
 // Test Runner
 // =============================================================================
@@ -352,6 +490,12 @@ int run_sensor_utils_tests(void) {
     RUN_TEST(test_ntc_adc_to_temp_steam_temperature);
     RUN_TEST(test_ntc_adc_to_temp_cold_temperature);
     
+    // NTC Lookup Table
+    RUN_TEST(test_ntc_lut_matches_analytic_conversion);
+    RUN_TEST(test_ntc_lut_key_temperatures);
+    RUN_TEST(test_ntc_lut_invalid_codes_return_nan);
+    RUN_TEST(test_ntc_lut_null_safety);
+
     // Temperature Validation
     RUN_TEST(test_sensor_validate_temp_valid_brew_range);
     RUN_TEST(test_sensor_validate_temp_invalid_brew_range);
@@ -367,6 +511,14 @@ int run_sensor_utils_tests(void) {
     RUN_TEST(test_filter_moving_avg_reset_works);
     RUN_TEST(test_filter_moving_avg_constant_input_stable);
     RUN_TEST(test_filter_moving_avg_null_safety);
+
+    // Temperature Estimator
+    RUN_TEST(test_temp_estimator_first_sample_seeds_state);
+    RUN_TEST(test_temp_estimator_constant_input_stable);
+    RUN_TEST(test_temp_estimator_feedforward_leads_measurement);
+    RUN_TEST(test_temp_estimator_tracks_ramp);
+    RUN_TEST(test_temp_estimator_nan_coasts_on_estimate);
+    RUN_TEST(test_temp_estimator_reset_and_null_safety);
     
     return UnityEnd();
 }
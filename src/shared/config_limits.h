@@ -0,0 +1,87 @@
+/**
+ * Coffee Machine Controller - Shared Config Field Limits
+ *
+ * Build-time registry of numeric bounds for every configurable field that
+ * crosses the UART, shared between ESP32 and Pico firmware. The Pico
+ * enforces these bounds at the packet boundary (validation.c); the ESP32
+ * checks the same table before transmitting, so an out-of-range value from
+ * the web UI is rejected locally instead of costing a command/NACK round
+ * trip during bulk config sync - and the two sides can never disagree
+ * about what a valid value is.
+ *
+ * Bounds are expressed in the field's wire units (decicelsius, gain*100,
+ * milliseconds...) as floats, which represent every integer range below
+ * exactly. Tightening a bound only needs agreement with the Pico's
+ * safety limits in config.h - loosening one requires both sides updated
+ * first, or old Pico firmware will NACK values the ESP32 now allows.
+ *
+ * Include path setup (same as protocol_defs.h):
+ *   ESP32: -I../../shared
+ *   Pico:  ${CMAKE_SOURCE_DIR}/../shared in include_directories
+ */
+
+#ifndef CONFIG_LIMITS_H
+#define CONFIG_LIMITS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// X(name, id, min, max, unit) - keep sorted by id; ids are stable but not
+// wire format (only values travel, both sides index by the same name)
+#define CONFIG_LIMITS(X) \
+    X(CFG_LIMIT_SETPOINT_TARGET,   0x01, 0.0f,   1.0f,     "0=brew 1=steam") \
+    X(CFG_LIMIT_SETPOINT_TEMP,     0x02, 0.0f,   2000.0f,  "decicelsius")    \
+    X(CFG_LIMIT_PID_GAIN,          0x03, 0.0f,   10000.0f, "gain * 100")     \
+    X(CFG_LIMIT_VOLTAGE,           0x04, 100.0f, 250.0f,   "volts")          \
+    X(CFG_LIMIT_CURRENT,           0x05, 1.0f,   50.0f,    "amps")           \
+    X(CFG_LIMIT_PREINFUSION_ON,    0x06, 0.0f,   10000.0f, "milliseconds")   \
+    X(CFG_LIMIT_PREINFUSION_PAUSE, 0x07, 0.0f,   30000.0f, "milliseconds")
+
+#define CONFIG_LIMIT_ENUM_ENTRY(name, id, mn, mx, unit) name = id,
+typedef enum {
+    CONFIG_LIMITS(CONFIG_LIMIT_ENUM_ENTRY)
+} config_limit_id_t;
+#undef CONFIG_LIMIT_ENUM_ENTRY
+
+typedef struct {
+    uint8_t id;     // config_limit_id_t
+    float   min;    // Inclusive, wire units
+    float   max;    // Inclusive, wire units
+} config_limit_t;
+
+/**
+ * Look up the bounds for a field id
+ * @return Table entry, or NULL for an unknown id
+ */
+static inline const config_limit_t* config_limit_find(uint8_t id) {
+#define CONFIG_LIMIT_TABLE_ROW(name, idv, mn, mx, unit) { idv, mn, mx },
+    static const config_limit_t table[] = {
+        CONFIG_LIMITS(CONFIG_LIMIT_TABLE_ROW)
+    };
+#undef CONFIG_LIMIT_TABLE_ROW
+    for (unsigned i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+        if (table[i].id == id) {
+            return &table[i];
+        }
+    }
+    return (const config_limit_t*)0;
+}
+
+/**
+ * Check one value against its field's bounds
+ * @return true if the field is known and the value is in range
+ */
+static inline bool config_limit_check(uint8_t id, float value) {
+    const config_limit_t* limit = config_limit_find(id);
+    return limit && value >= limit->min && value <= limit->max;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONFIG_LIMITS_H
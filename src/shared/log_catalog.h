@@ -0,0 +1,71 @@
+/**
+ * Coffee Machine Controller - Shared Compact Log Catalog
+ *
+ * Build-time registry of log format strings shared between ESP32 and Pico
+ * firmware. Hot-path call sites on the Pico log a (catalog-id, packed int32
+ * args) record instead of formatting text: no vsnprintf in the control loop,
+ * and the forwarded MSG_LOG_COMPACT frame carries ~8-20 bytes where the
+ * equivalent MSG_LOG text frame carries 60-100. Text is produced only at
+ * display time - by logging_process_pending() on the Pico and by
+ * LogManager::handlePicoLogCompact() on the ESP32 - both from this table,
+ * so the two sides can never disagree about what an id means.
+ *
+ * Adding an entry: append an X() line with the next free id. Ids are wire
+ * format - never renumber or reuse one, even for a deleted entry, or old
+ * firmware on one side will expand the wrong string.
+ *
+ * Formats may only consume int32 arguments (%d/%u/%x and friends - no %s,
+ * no %f). Temperatures are passed pre-split as whole/tenth integer pairs
+ * and formatted "%d.%uC"; the sign lives in the whole part.
+ *
+ * Include path setup (same as protocol_defs.h):
+ *   ESP32: -I../../shared
+ *   Pico:  ${CMAKE_SOURCE_DIR}/../shared in include_directories
+ */
+
+#ifndef LOG_CATALOG_H
+#define LOG_CATALOG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum packed arguments per record (sizes wire payload and ring records)
+#define LOG_COMPACT_MAX_ARGS 4
+
+// X(name, id, format) - keep sorted by id
+#define LOG_CATALOG(X) \
+    X(LOG_CAT_BREW_NTC_FAULT,     0x0001, "Sensors: ERROR - Brew NTC invalid reading (%d.%uC) - %d consecutive failures\n") \
+    X(LOG_CAT_BREW_NTC_RANGE,     0x0002, "Sensors: Brew NTC invalid (ADC=%d -> %d.%uC, out of range -10..200C)\n") \
+    X(LOG_CAT_BREW_NTC_RECOVER,   0x0003, "Sensors: Brew NTC recovered after %d failures\n") \
+    X(LOG_CAT_STEAM_NTC_FAULT,    0x0004, "Sensors: ERROR - Steam NTC invalid reading (%d.%uC) - %d consecutive failures\n") \
+    X(LOG_CAT_STEAM_NTC_RANGE,    0x0005, "Sensors: Steam NTC invalid (ADC=%d -> %d.%uC, out of range -10..200C)\n") \
+    X(LOG_CAT_STEAM_NTC_RECOVER,  0x0006, "Sensors: Steam NTC recovered after %d failures\n")
+
+#define LOG_CATALOG_ENUM_ENTRY(name, id, fmt) name = id,
+typedef enum {
+    LOG_CATALOG(LOG_CATALOG_ENUM_ENTRY)
+} log_catalog_id_t;
+#undef LOG_CATALOG_ENUM_ENTRY
+
+/**
+ * Look up the format string for a catalog id
+ * @return Format string, or NULL for an unknown id (peer newer than us)
+ */
+static inline const char* log_catalog_format(uint16_t id) {
+    switch (id) {
+#define LOG_CATALOG_FORMAT_CASE(name, idv, fmt) case name: return fmt;
+        LOG_CATALOG(LOG_CATALOG_FORMAT_CASE)
+#undef LOG_CATALOG_FORMAT_CASE
+        default:
+            return (const char*)0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_CATALOG_H
@@ -0,0 +1,85 @@
+/**
+ * Coffee Machine Controller - Machine Capability Predicates
+ *
+ * Feature flags derived from the machine type protocol ID (the byte the
+ * Pico reports in its handshake, see "Machine Types" in protocol_defs.h).
+ * The Pico carries the full capability table in machine_config.h; the ESP32
+ * and simulator only ever see the one-byte type, so these predicates mirror
+ * the capability fields that shape what crosses the wire and what the UI
+ * shows. Status serializers, the change detector, MQTT discovery, and the
+ * screens all key off the same functions instead of scattering literal
+ * type comparisons - a single-boiler machine stops shipping dead steam
+ * fields on every hop.
+ *
+ * MACHINE_TYPE_UNKNOWN (0x00) reports the full dual-boiler surface: until
+ * the handshake fills the type in, hiding fields would drop real data,
+ * so unknown errs on the side of sending everything (same default the
+ * screens have always used).
+ *
+ * Include path setup (same as protocol_defs.h):
+ *   ESP32: -I../../shared
+ *   Pico:  ${CMAKE_SOURCE_DIR}/../shared in include_directories
+ */
+
+#ifndef MACHINE_FEATURES_H
+#define MACHINE_FEATURES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Protocol machine type IDs (matches the machine_type_t enum in the Pico's
+// machine_config.h; kept as literals here because the enum is Pico-only)
+#define MACHINE_FEAT_TYPE_UNKNOWN        0x00
+#define MACHINE_FEAT_TYPE_DUAL_BOILER    0x01
+#define MACHINE_FEAT_TYPE_SINGLE_BOILER  0x02
+#define MACHINE_FEAT_TYPE_HEAT_EXCHANGER 0x03
+#define MACHINE_FEAT_TYPE_THERMOBLOCK    0x04
+
+/**
+ * Machine has a steam boiler with its own temperature reading - dual
+ * boiler and heat exchanger. Gates the temps.steam group, steamWh energy,
+ * steam MQTT entities, and steam change detection. Single boiler steams
+ * by mode-switching the one boiler (brew fields carry the live values);
+ * thermoblock has no boiler at all.
+ */
+static inline bool machine_has_steam_boiler(uint8_t machine_type) {
+    return machine_type != MACHINE_FEAT_TYPE_SINGLE_BOILER &&
+           machine_type != MACHINE_FEAT_TYPE_THERMOBLOCK;
+}
+
+/**
+ * Machine switches one boiler between brew and steam mode (single boiler).
+ * The UI relabels the main temperature "BOILER" and drops the steam readout.
+ */
+static inline bool machine_needs_mode_switching(uint8_t machine_type) {
+    return machine_type == MACHINE_FEAT_TYPE_SINGLE_BOILER;
+}
+
+/**
+ * Steam boiler provides brew heat through a passive heat exchanger (HX).
+ * Only the steam NTC exists - the UI shows it as the one "BOILER" reading
+ * and brew-side temperatures are not real sensors.
+ */
+static inline bool machine_steam_provides_brew_heat(uint8_t machine_type) {
+    return machine_type == MACHINE_FEAT_TYPE_HEAT_EXCHANGER;
+}
+
+/**
+ * Two independently switched heaters (dual boiler, and unknown until the
+ * handshake resolves). Gates the heating-strategy picker - sequencing
+ * heaters is meaningless with a single element.
+ */
+static inline bool machine_has_separate_steam_heater(uint8_t machine_type) {
+    return machine_type == MACHINE_FEAT_TYPE_UNKNOWN ||
+           machine_type == MACHINE_FEAT_TYPE_DUAL_BOILER;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MACHINE_FEATURES_H
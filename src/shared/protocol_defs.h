@@ -36,13 +36,13 @@ extern "C" {
 
 #define PROTOCOL_SYNC_BYTE      0xAA
 #define PROTOCOL_MAX_PAYLOAD    64      // Increased from 32 to allow room for expansion
-                                        // status_payload_t is 32 bytes, leaving 32 bytes headroom
+                                        // status_payload_t is 47 bytes, leaving 17 bytes headroom
 #define PROTOCOL_HEADER_SIZE    4       // sync + type + length + seq
 #define PROTOCOL_CRC_SIZE       2
 #define PROTOCOL_MAX_PACKET     (PROTOCOL_HEADER_SIZE + PROTOCOL_MAX_PAYLOAD + PROTOCOL_CRC_SIZE)
 
 // Note: All payload types fit within 64 bytes:
-//   - status_payload_t: 32 bytes (room for expansion)
+//   - status_payload_t: 47 bytes (room for expansion)
 //   - config_payload_t: 14 bytes
 //   - env_config_payload_t: 18 bytes
 //   - diag_result_payload_t: 32 bytes (exact fit)
@@ -66,6 +66,11 @@ extern "C" {
 #define MSG_POWER_METER         0x0B    // DEPRECATED (v2.32) - Hardware power meter removed, MQTT only. ID reserved.
 #define MSG_HANDSHAKE           0x0C    // Protocol handshake for version negotiation
 #define MSG_NACK                0x0D    // Negative acknowledgment (busy/rejected)
+#define MSG_BATCH               0x0E    // Aggregate frame: several sub-messages under one CRC
+                                        // Payload: repeated [type (1) | length (1) | payload (length)]
+                                        // Receivers unpack and dispatch each sub-message as if it
+                                        // arrived in its own frame (seq/timestamp inherited)
+#define MSG_CONFIG_SNAPSHOT     0x0F    // Bulk config snapshot - whole machine config in one frame
 
 // =============================================================================
 // Diagnostic Test IDs
@@ -108,6 +113,7 @@ extern "C" {
 #define DIAG_TEST_WEIGHT_STOP_OUTPUT  0x11    // ESP32 GPIO19 (USB D+) - WEIGHT_STOP output test
 #define DIAG_TEST_PICO_RUN_OUTPUT     0x12    // ESP32 GPIO20 (USB D-) - Pico RUN pin output test
 #define DIAG_TEST_WEIGHT_STOP_INPUT   0x13    // Pico GPIO21 - WEIGHT_STOP input test (reads ESP32 GPIO19 signal)
+#define DIAG_TEST_WEIGHT_STOP_LATENCY 0x14    // Pico GPIO21 - WEIGHT_STOP latency: GPIO edge arrival vs loopback command
 
 // Class B Safety Tests (IEC 60730/60335 Annex R)
 #define DIAG_TEST_CLASS_B_ALL   0x30    // Run all Class B tests
@@ -159,8 +165,49 @@ extern "C" {
 #define MSG_CMD_POWER_METER_CONFIG 0x21 // DEPRECATED (v2.32) - Hardware power meter removed. ID reserved.
 #define MSG_CMD_POWER_METER_DISCOVER 0x22 // DEPRECATED (v2.32) - Hardware power meter removed. ID reserved.
 #define MSG_CMD_GET_BOOT        0x23    // Request boot info (version, machine type)
-#define MSG_CMD_LOG_CONFIG      0x24    // Configure log forwarding (Pico -> ESP32)
+#define MSG_CMD_LOG_CONFIG      0x24    // Configure log forwarding (Pico -> ESP32):
+                                        // [enabled][max level (optional)] - the level byte
+                                        // filters severity at the source so debug spam
+                                        // never shares UART bandwidth with control traffic
 #define MSG_LOG                 0x25    // Log message from Pico
+#define MSG_CMD_GET_SNAPSHOT    0x26    // Request bulk config snapshot (replaces the chatty
+                                        // per-config_type exchange on reconnect-after-OTA)
+#define MSG_STATUS_DELTA        0x27    // Delta status: uint32 changed-field mask + only the
+                                        // changed status_payload_t fields in declaration order.
+                                        // Pico sends a full MSG_STATUS keyframe periodically;
+                                        // deltas between keyframes carry only what moved.
+                                        // (Pico->ESP32 despite the ID range - like MSG_LOG.)
+#define MSG_LOG_COMPACT         0x28    // Catalog log record from Pico:
+                                        // [level][id_lo][id_hi][argc][int32 args LE x argc].
+                                        // Format strings live in log_catalog.h on both sides;
+                                        // text is expanded at display time, not on the wire.
+#define MSG_TRACE               0x29    // Tracepoint batch from Pico (TRACEPOINTS builds only):
+                                        // [cpu_hz u32 LE][count][trace_record_t x count].
+                                        // Record layout and ids live in trace_format.h.
+#define MSG_JITTER              0x2A    // Control-loop jitter report from Pico
+                                        // (jitter_payload_t, pushed with the 60s stats block).
+                                        // Bucket bounds live in protocol_latency.h.
+#define MSG_WARM_STATE          0x2B    // Warm-boot state snapshot from Pico
+                                        // (warm_state_payload_t: version + machine type +
+                                        // embedded status frame). Sent once per handshake so
+                                        // an ESP32-only reboot rebuilds its view in one message
+                                        // instead of polling boot info and waiting for status.
+#define MSG_SENSOR_BURST        0x2C    // Raw ADC burst frame from Pico (sensor_burst_payload_t).
+                                        // Shot-start transient capture: unfiltered pressure
+                                        // samples recorded at the full ADC rate during the first
+                                        // seconds of a brew, drained in these frames after the
+                                        // shot ends (see burst_capture.c).
+#define MSG_CMD_SET_WAKE_SCHEDULE 0x2D  // Push compiled wake schedule to Pico (wake_schedule.c):
+                                        // [count][cur_sec][cur_mow u16 LE]
+                                        // [minute_of_day u16 LE][days][strategy] x count.
+                                        // cur_mow is the current local minute-of-week (Sunday
+                                        // 00:00 = 0) and doubles as the Pico's clock reference,
+                                        // so turn-on schedules still fire when the ESP32 is
+                                        // down at the deadline. count=0 clears the table.
+
+// Entry limit for MSG_CMD_SET_WAKE_SCHEDULE (matches MAX_SCHEDULES on the
+// ESP32 side; 4 + 10*4 = 44 bytes fits the 64-byte payload)
+#define WAKE_SCHEDULE_MAX       10
 
 // =============================================================================
 // Alarm Codes
@@ -185,6 +232,15 @@ extern "C" {
 #define STATE_SAFE              6       // Safe state (all outputs off)
 #define STATE_ECO               7       // Eco mode (reduced temperature)
 
+// =============================================================================
+// Shot Phases (within STATE_BREWING, reported in status brew_phase)
+// =============================================================================
+#define BREW_PHASE_NONE         0       // No shot in progress
+#define BREW_PHASE_PREINFUSION  1       // Pre-infusion: pump on at low flow
+#define BREW_PHASE_PAUSE        2       // Pre-infusion soak: pump off, puck saturating
+#define BREW_PHASE_BREWING      3       // Full-pressure extraction
+#define BREW_PHASE_POST_BREW    4       // Shot over, solenoid venting delay
+
 // =============================================================================
 // Status Flags (bitfield)
 // =============================================================================
@@ -224,6 +280,57 @@ extern "C" {
 #define CONFIG_ECO               0x06   // Eco mode configuration
 #define CONFIG_MACHINE_INFO      0x07   // Machine brand and model (source of truth on Pico)
 
+// =============================================================================
+// Status Payload Schema (MSG_STATUS = 0x01)
+// =============================================================================
+// Single source of truth for the status frame layout. This X-macro list
+// expands into the packed status_payload_t struct, the Pico's delta-builder
+// field table (protocol.c), and the ESP32's delta-apply offset table
+// (pico_protocol_handler.cpp) - previously three hand-synced copies of the
+// same field order. To add a field: append one F() line here (bits must stay
+// sequential and fit the uint32 delta mask) and both sides regenerate at
+// compile time.
+//
+// F(bit, type, name) - bit is the field's position in the delta mask.
+#include <stdint.h>
+
+#define STATUS_FIELD_LIST(F)                                                  \
+    F(0,  int16_t,  brew_temp)               /* Celsius * 10 (0.1C res) */    \
+    F(1,  int16_t,  steam_temp)              /* Celsius * 10 */               \
+    F(2,  int16_t,  group_temp)              /* Celsius * 10 (if available) */\
+    F(3,  uint16_t, pressure)                /* Bar * 100 (0.01 bar res) */   \
+    F(4,  int16_t,  brew_setpoint)           /* Celsius * 10 */               \
+    F(5,  int16_t,  steam_setpoint)          /* Celsius * 10 */               \
+    F(6,  uint8_t,  brew_output)             /* 0-100% */                     \
+    F(7,  uint8_t,  steam_output)            /* 0-100% */                     \
+    F(8,  uint8_t,  pump_output)             /* 0-100% */                     \
+    F(9,  uint8_t,  state)                   /* Machine state (STATE_*) */    \
+    F(10, uint8_t,  flags)                   /* Status flags (STATUS_FLAG_*) */\
+    F(11, uint8_t,  water_level)             /* 0-100% */                     \
+    F(12, uint16_t, power_watts)             /* Current power draw */         \
+    F(13, uint32_t, uptime_ms)               /* Milliseconds since boot */    \
+    F(14, uint32_t, shot_start_timestamp_ms) /* Brew start (ms since boot, 0 idle) */\
+    F(15, uint8_t,  heating_strategy)        /* HEAT_STRATEGY_* */            \
+    F(16, uint8_t,  cleaning_reminder)       /* 1 if cleaning due */          \
+    F(17, uint16_t, brew_count)              /* Brews since last cleaning */  \
+    F(18, uint16_t, flow_ml_min)             /* Flow meter ml/min (0 = none) */   \
+    F(19, uint8_t,  brew_phase)              /* Shot phase (BREW_PHASE_*) */      \
+    F(20, uint32_t, phase_start_us)          /* Phase entry (us since boot, low 32 bits) */\
+    F(21, uint32_t, brew_energy_wh)          /* Brew element energy since boot (Wh) */\
+    F(22, uint32_t, steam_energy_wh)         /* Steam element energy since boot (Wh) */
+
+// Generated packed struct - field order is exactly the list order, which is
+// also the delta mask bit order
+typedef struct __attribute__((packed)) {
+#define STATUS_FIELD_MEMBER(bit, ftype, name) ftype name;
+    STATUS_FIELD_LIST(STATUS_FIELD_MEMBER)
+#undef STATUS_FIELD_MEMBER
+} status_payload_t;
+
+// Generated field count (one +1 per list entry)
+#define STATUS_FIELD_COUNT_ONE(bit, ftype, name) +1
+#define STATUS_FIELD_COUNT (0 STATUS_FIELD_LIST(STATUS_FIELD_COUNT_ONE))
+
 // =============================================================================
 // CRC-16-CCITT
 // =============================================================================
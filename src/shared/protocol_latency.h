@@ -0,0 +1,102 @@
+/**
+ * Coffee Machine Controller - Shared Command Latency Histogram
+ *
+ * Command -> ACK round-trip latency tracking shared between ESP32 and Pico
+ * firmware. Both sides maintain the same fixed-bucket histogram so the
+ * blanket PROTOCOL_ACK_TIMEOUT_MS (1000ms) retry timeout can eventually be
+ * tuned from real distribution data instead of guesswork.
+ *
+ * Buckets are cumulative-friendly counters with fixed upper bounds; p50/p95
+ * are derived from the counts at query time (bucket upper bound of the first
+ * bucket that crosses the percentile rank). Cheap enough to run on every ACK:
+ * one linear scan over 8 bounds on record, no allocation, no sorting.
+ *
+ * Include path setup (same as protocol_defs.h):
+ *   ESP32: -I../../shared
+ *   Pico:  ${CMAKE_SOURCE_DIR}/../shared in include_directories
+ */
+
+#ifndef PROTOCOL_LATENCY_H
+#define PROTOCOL_LATENCY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bucket N counts samples <= PROTOCOL_LATENCY_BOUNDS_MS[N]; the last bucket
+// catches everything above the highest bound (i.e. >= ACK timeout territory)
+#define PROTOCOL_LATENCY_BUCKET_COUNT 8
+
+static const uint16_t protocol_latency_bounds_ms[PROTOCOL_LATENCY_BUCKET_COUNT - 1] = {
+    10, 25, 50, 100, 250, 500, 1000
+};
+
+// Map a round-trip time to its histogram bucket index
+static inline uint8_t protocol_latency_bucket(uint32_t rtt_ms) {
+    for (uint8_t i = 0; i < PROTOCOL_LATENCY_BUCKET_COUNT - 1; i++) {
+        if (rtt_ms <= protocol_latency_bounds_ms[i]) {
+            return i;
+        }
+    }
+    return PROTOCOL_LATENCY_BUCKET_COUNT - 1;
+}
+
+// Derive a percentile (e.g. 50, 95) from bucket counts. Returns the upper
+// bound of the bucket containing the percentile rank - an overestimate by at
+// most one bucket width, which is fine for timeout tuning. Returns 0 when no
+// samples have been recorded; the overflow bucket reports the highest bound
+// (actual worst case is tracked separately as a max value).
+static inline uint32_t protocol_latency_percentile_ms(
+    const uint32_t buckets[PROTOCOL_LATENCY_BUCKET_COUNT],
+    uint32_t total_samples, uint8_t percentile) {
+    if (total_samples == 0) {
+        return 0;
+    }
+
+    // Rank of the target sample, rounding up so p50 of 1 sample is sample 1
+    uint32_t rank = ((uint64_t)total_samples * percentile + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < PROTOCOL_LATENCY_BUCKET_COUNT - 1; i++) {
+        cumulative += buckets[i];
+        if (cumulative >= rank) {
+            return protocol_latency_bounds_ms[i];
+        }
+    }
+    return protocol_latency_bounds_ms[PROTOCOL_LATENCY_BUCKET_COUNT - 2];
+}
+
+// -----------------------------------------------------------------------------
+// Control-Loop Jitter Buckets (MSG_JITTER)
+// -----------------------------------------------------------------------------
+// Lateness of the Core 0 control tick versus CONTROL_LOOP_PERIOD_MS, in
+// microseconds past the nominal period. Same fixed-bucket scheme as the RTT
+// histogram above - one linear scan per tick, no allocation - with the last
+// bucket catching everything more than 10ms late (PID-visible territory).
+
+#define CONTROL_JITTER_BUCKET_COUNT 8
+
+static const uint16_t control_jitter_bounds_us[CONTROL_JITTER_BUCKET_COUNT - 1] = {
+    100, 250, 500, 1000, 2500, 5000, 10000
+};
+
+// Map a tick's lateness to its histogram bucket index
+static inline uint8_t control_jitter_bucket(uint32_t late_us) {
+    for (uint8_t i = 0; i < CONTROL_JITTER_BUCKET_COUNT - 1; i++) {
+        if (late_us <= control_jitter_bounds_us[i]) {
+            return i;
+        }
+    }
+    return CONTROL_JITTER_BUCKET_COUNT - 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PROTOCOL_LATENCY_H
@@ -0,0 +1,130 @@
+/**
+ * Coffee Machine Controller - Shared Hot-Path Tracepoint Format
+ *
+ * Cycle-counter tracepoints shared between ESP32 and Pico firmware. Each
+ * instrumented region records a begin/end record pair into a small per-core
+ * ring; the dump is emitted as Chrome Trace Event JSON (/api/trace on the
+ * ESP32) so it loads directly into chrome://tracing or Perfetto as a
+ * flamegraph. Pico records travel to the ESP32 in MSG_TRACE batches the same
+ * way forwarded logs do, so both MCUs end up in one merged timeline.
+ *
+ * Everything compiles out unless the firmware is built with -DTRACEPOINTS=1
+ * (on both sides if a merged timeline is wanted): the macros expand to
+ * nothing and no rings or flush code are linked. Recording costs one cycle
+ * counter read and an 8-byte store - cheap enough for control_update() and
+ * protocol_process() at their real rates.
+ *
+ * Record timestamps are raw CPU cycle counts; they are converted to
+ * microseconds at dump time using each MCU's clock frequency (the Pico
+ * reports its clk_sys in every MSG_TRACE batch). The two MCUs' clocks are
+ * not synchronized - the viewer shows them as separate processes, not on a
+ * shared absolute axis.
+ *
+ * IDs are wire-stable like log_catalog.h: never renumber or reuse.
+ *
+ * Include path setup (same as protocol_defs.h):
+ *   ESP32: -I../../shared
+ *   Pico:  ${CMAKE_SOURCE_DIR}/../shared in include_directories
+ */
+
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Build-time switch; default off so release images carry no trace code.
+#ifndef TRACEPOINTS
+#define TRACEPOINTS 0
+#endif
+
+// -----------------------------------------------------------------------------
+// Tracepoint Catalog
+// -----------------------------------------------------------------------------
+// X(symbol, id, display_name) - display_name is what the trace viewer shows.
+#define TRACE_POINTS(X) \
+    X(TRACE_PT_CONTROL_UPDATE,        0x01, "control_update") \
+    X(TRACE_PT_PROTOCOL_PROCESS,      0x02, "protocol_process") \
+    X(TRACE_PT_PICO_UART_LOOP,        0x03, "PicoUART::loop") \
+    X(TRACE_PT_BROADCAST_FULL_STATUS, 0x04, "broadcastFullStatus") \
+    X(TRACE_PT_LVGL_FLUSH,            0x05, "lvgl_flush")
+
+#define TRACE_POINT_ENUM(sym, id, name) sym = id,
+typedef enum {
+    TRACE_POINTS(TRACE_POINT_ENUM)
+} trace_point_id_t;
+#undef TRACE_POINT_ENUM
+
+// Look up the display name for a tracepoint id. Returns NULL for unknown ids
+// (e.g. a newer peer firmware with tracepoints this side doesn't know yet).
+static inline const char* trace_point_name(uint16_t id) {
+    switch (id) {
+#define TRACE_POINT_NAME_CASE(sym, pt_id, name) case pt_id: return name;
+        TRACE_POINTS(TRACE_POINT_NAME_CASE)
+#undef TRACE_POINT_NAME_CASE
+        default:
+            return (const char*)0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Record Layout
+// -----------------------------------------------------------------------------
+
+#define TRACE_PHASE_BEGIN 0
+#define TRACE_PHASE_END   1
+
+// One tracepoint event - 8 bytes, same layout in the rings and on the wire
+typedef struct __attribute__((packed)) {
+    uint32_t cycles;    // Raw CPU cycle counter at the event (wraps; the dump
+                        // handles one wrap between begin and end)
+    uint16_t id;        // trace_point_id_t
+    uint8_t core;       // Core the event was recorded on
+    uint8_t phase;      // TRACE_PHASE_BEGIN or TRACE_PHASE_END
+} trace_record_t;
+
+// Per-core ring depth. 256 records = 128 begin/end pairs per core, 2KB per
+// ring - a recent window, not a full history (newest records are dropped
+// when the consumer falls behind, same policy as the compact log ring).
+#define TRACE_RING_RECORDS 256
+
+// MSG_TRACE payload: [cpu_hz u32 LE][count u8][trace_record_t x count].
+// 7 records (61 bytes) is the most that fits in PROTOCOL_MAX_PAYLOAD (64).
+#define TRACE_BATCH_MAX_RECORDS 7
+
+// -----------------------------------------------------------------------------
+// Instrumentation Macros
+// -----------------------------------------------------------------------------
+// Each platform implements trace_record_event() (trace.c / trace.cpp);
+// the macros are the only thing instrumented code should touch.
+
+#if TRACEPOINTS
+void trace_record_event(uint16_t id, uint8_t phase);
+#define TRACE_BEGIN(id) trace_record_event((id), TRACE_PHASE_BEGIN)
+#define TRACE_END(id)   trace_record_event((id), TRACE_PHASE_END)
+#else
+#define TRACE_BEGIN(id) ((void)0)
+#define TRACE_END(id)   ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+
+// RAII guard for C++ call sites with multiple returns (ESP32 side); pairs
+// the TRACE_END with every exit path automatically.
+#if TRACEPOINTS
+struct TraceScope {
+    uint16_t id;
+    explicit TraceScope(uint16_t id_) : id(id_) { trace_record_event(id, TRACE_PHASE_BEGIN); }
+    ~TraceScope() { trace_record_event(id, TRACE_PHASE_END); }
+};
+#define TRACE_SCOPE(id) TraceScope _traceScope(id)
+#else
+#define TRACE_SCOPE(id) ((void)0)
+#endif
+#endif // __cplusplus
+
+#endif // TRACE_FORMAT_H